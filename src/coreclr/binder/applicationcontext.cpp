@@ -18,6 +18,7 @@
 #include "utils.hpp"
 #include "ex.h"
 #include "clr/fs/path.h"
+#include "hostinformation.h"
 using namespace clr::fs;
 
 namespace BINDER_SPACE
@@ -28,6 +29,8 @@ namespace BINDER_SPACE
         m_pFailureCache = NULL;
         m_contextCS = NULL;
         m_pTrustedPlatformAssemblyMap = nullptr;
+        m_pTpaLookupSlots = nullptr;
+        m_tpaLookupMask = 0;
     }
 
     ApplicationContext::~ApplicationContext()
@@ -44,6 +47,11 @@ namespace BINDER_SPACE
         {
             delete m_pTrustedPlatformAssemblyMap;
         }
+
+        if (m_pTpaLookupSlots != nullptr)
+        {
+            delete [] m_pTpaLookupSlots;
+        }
     }
 
     HRESULT ApplicationContext::Init()
@@ -91,80 +99,94 @@ namespace BINDER_SPACE
             GO_WITH_HRESULT(S_OK);
         }
 
-        //
-        // Parse TrustedPlatformAssemblies
-        //
         m_pTrustedPlatformAssemblyMap = new SimpleNameToFileNameMap();
 
-        sTrustedPlatformAssemblies.Normalize();
-
-        for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
+        //
+        // Use the TrustedPlatformAssemblies table if the host provides one
+        //
+        const host_runtime_tpa_entry *pTpaEntries;
+        size_t tpaCount;
+        if (HostInformation::GetTrustedPlatformAssemblies(&pTpaEntries, &tpaCount))
         {
-            SString fileName;
-            SString simpleName;
-            bool isNativeImage = false;
-            HRESULT pathResult = S_OK;
-            IF_FAIL_GO(pathResult = GetNextTPAPath(sTrustedPlatformAssemblies, i, /*dllOnly*/ false, fileName, simpleName, isNativeImage));
-            if (pathResult == S_FALSE)
+            IF_FAIL_GO(SetupTrustedPlatformAssemblyMap(pTpaEntries, tpaCount));
+        }
+        else
+        {
+            //
+            // Parse TrustedPlatformAssemblies
+            //
+            sTrustedPlatformAssemblies.Normalize();
+
+            for (SString::Iterator i = sTrustedPlatformAssemblies.Begin(); i != sTrustedPlatformAssemblies.End(); )
             {
-                break;
-            }
+                SString fileName;
+                SString simpleName;
+                bool isNativeImage = false;
+                HRESULT pathResult = S_OK;
+                IF_FAIL_GO(pathResult = GetNextTPAPath(sTrustedPlatformAssemblies, i, /*dllOnly*/ false, fileName, simpleName, isNativeImage));
+                if (pathResult == S_FALSE)
+                {
+                    break;
+                }
 
-            const SimpleNameToFileNameMapEntry *pExistingEntry = m_pTrustedPlatformAssemblyMap->LookupPtr(simpleName.GetUnicode());
+                const SimpleNameToFileNameMapEntry *pExistingEntry = m_pTrustedPlatformAssemblyMap->LookupPtr(simpleName.GetUnicode());
 
-            if (pExistingEntry != nullptr)
-            {
-                //
-                // We want to store only the first entry matching a simple name we encounter.
-                // The exception is if we first store an IL reference and later in the string
-                // we encounter a native image.  Since we don't touch IL in the presence of
-                // native images, we replace the IL entry with the NI.
-                //
-                if ((pExistingEntry->m_wszILFileName != nullptr && !isNativeImage) ||
-                    (pExistingEntry->m_wszNIFileName != nullptr && isNativeImage))
+                if (pExistingEntry != nullptr)
                 {
-                    continue;
+                    //
+                    // We want to store only the first entry matching a simple name we encounter.
+                    // The exception is if we first store an IL reference and later in the string
+                    // we encounter a native image.  Since we don't touch IL in the presence of
+                    // native images, we replace the IL entry with the NI.
+                    //
+                    if ((pExistingEntry->m_wszILFileName != nullptr && !isNativeImage) ||
+                        (pExistingEntry->m_wszNIFileName != nullptr && isNativeImage))
+                    {
+                        continue;
+                    }
                 }
-            }
 
-            LPWSTR wszSimpleName = nullptr;
-            if (pExistingEntry == nullptr)
-            {
-                wszSimpleName = new WCHAR[simpleName.GetCount() + 1];
-                if (wszSimpleName == nullptr)
+                LPWSTR wszSimpleName = nullptr;
+                if (pExistingEntry == nullptr)
+                {
+                    wszSimpleName = new WCHAR[simpleName.GetCount() + 1];
+                    if (wszSimpleName == nullptr)
+                    {
+                        GO_WITH_HRESULT(E_OUTOFMEMORY);
+                    }
+                    wcscpy_s(wszSimpleName, simpleName.GetCount() + 1, simpleName.GetUnicode());
+                }
+                else
+                {
+                    wszSimpleName = pExistingEntry->m_wszSimpleName;
+                }
+
+                LPWSTR wszFileName = new WCHAR[fileName.GetCount() + 1];
+                if (wszFileName == nullptr)
                 {
                     GO_WITH_HRESULT(E_OUTOFMEMORY);
                 }
-                wcscpy_s(wszSimpleName, simpleName.GetCount() + 1, simpleName.GetUnicode());
-            }
-            else
-            {
-                wszSimpleName = pExistingEntry->m_wszSimpleName;
-            }
+                wcscpy_s(wszFileName, fileName.GetCount() + 1, fileName.GetUnicode());
 
-            LPWSTR wszFileName = new WCHAR[fileName.GetCount() + 1];
-            if (wszFileName == nullptr)
-            {
-                GO_WITH_HRESULT(E_OUTOFMEMORY);
-            }
-            wcscpy_s(wszFileName, fileName.GetCount() + 1, fileName.GetUnicode());
+                SimpleNameToFileNameMapEntry mapEntry;
+                mapEntry.m_wszSimpleName = wszSimpleName;
+                if (isNativeImage)
+                {
+                    mapEntry.m_wszNIFileName = wszFileName;
+                    mapEntry.m_wszILFileName = pExistingEntry == nullptr ? nullptr : pExistingEntry->m_wszILFileName;
+                }
+                else
+                {
+                    mapEntry.m_wszILFileName = wszFileName;
+                    mapEntry.m_wszNIFileName = pExistingEntry == nullptr ? nullptr : pExistingEntry->m_wszNIFileName;
+                }
 
-            SimpleNameToFileNameMapEntry mapEntry;
-            mapEntry.m_wszSimpleName = wszSimpleName;
-            if (isNativeImage)
-            {
-                mapEntry.m_wszNIFileName = wszFileName;
-                mapEntry.m_wszILFileName = pExistingEntry == nullptr ? nullptr : pExistingEntry->m_wszILFileName;
-            }
-            else
-            {
-                mapEntry.m_wszILFileName = wszFileName;
-                mapEntry.m_wszNIFileName = pExistingEntry == nullptr ? nullptr : pExistingEntry->m_wszNIFileName;
+                m_pTrustedPlatformAssemblyMap->AddOrReplace(mapEntry);
             }
-
-            m_pTrustedPlatformAssemblyMap->AddOrReplace(mapEntry);
         }
 
+        IF_FAIL_GO(BuildTpaLookupIndex());
+
         //
         // Parse PlatformResourceRoots
         //
@@ -215,6 +237,117 @@ namespace BINDER_SPACE
         return hr;
     }
 
+    // Populate the TPA map from the table provided by the host. The host lists each simple name once
+    // and only IL images, so unlike the property string there is nothing to parse or reconcile.
+    HRESULT ApplicationContext::SetupTrustedPlatformAssemblyMap(const host_runtime_tpa_entry *pEntries,
+                                                                size_t count)
+    {
+        HRESULT hr = S_OK;
+
+        // Size the map up front so it does not rehash while it is populated
+        m_pTrustedPlatformAssemblyMap->Reallocate(static_cast<count_t>(count * 2));
+
+        for (size_t i = 0; i < count; i++)
+        {
+            SString simpleName(SString::Utf8, pEntries[i].simple_name);
+            SString fileName(SString::Utf8, pEntries[i].path);
+            simpleName.Normalize();
+            fileName.Normalize();
+
+            if (simpleName.IsEmpty() || Path::IsRelative(fileName))
+            {
+                GO_WITH_HRESULT(E_INVALIDARG);
+            }
+
+            if (m_pTrustedPlatformAssemblyMap->LookupPtr(simpleName.GetUnicode()) != nullptr)
+            {
+                continue;
+            }
+
+            LPWSTR wszSimpleName = new WCHAR[simpleName.GetCount() + 1];
+            wcscpy_s(wszSimpleName, simpleName.GetCount() + 1, simpleName.GetUnicode());
+
+            LPWSTR wszFileName = new WCHAR[fileName.GetCount() + 1];
+            wcscpy_s(wszFileName, fileName.GetCount() + 1, fileName.GetUnicode());
+
+            SimpleNameToFileNameMapEntry mapEntry;
+            mapEntry.m_wszSimpleName = wszSimpleName;
+            mapEntry.m_wszILFileName = wszFileName;
+            mapEntry.m_wszNIFileName = nullptr;
+
+            m_pTrustedPlatformAssemblyMap->Add(mapEntry);
+        }
+
+    Exit:
+        return hr;
+    }
+
+    // Build the read-only lookup index over the completed TPA map. Slots are kept at most half full
+    // and store the hash inline, so a lookup for a name that is not on the list rarely touches a string.
+    HRESULT ApplicationContext::BuildTpaLookupIndex()
+    {
+        HRESULT hr = S_OK;
+
+        count_t count = m_pTrustedPlatformAssemblyMap->GetCount();
+        count_t size = 1;
+        while (size < count * 2)
+        {
+            size <<= 1;
+        }
+
+        TpaLookupSlot *pSlots = new TpaLookupSlot[size];
+        if (pSlots == nullptr)
+        {
+            GO_WITH_HRESULT(E_OUTOFMEMORY);
+        }
+        memset(pSlots, 0, size * sizeof(TpaLookupSlot));
+
+        for (SimpleNameToFileNameMap::Iterator it = m_pTrustedPlatformAssemblyMap->Begin(), end = m_pTrustedPlatformAssemblyMap->End(); it != end; ++it)
+        {
+            const SimpleNameToFileNameMapEntry &entry = *it;
+            count_t hash = SimpleNameToFileNameMapTraits::Hash(entry.m_wszSimpleName);
+
+            count_t index = hash & (size - 1);
+            while (pSlots[index].m_pEntry != nullptr)
+            {
+                index = (index + 1) & (size - 1);
+            }
+
+            pSlots[index].m_hash = hash;
+            pSlots[index].m_pEntry = &entry;
+        }
+
+        m_pTpaLookupSlots = pSlots;
+        m_tpaLookupMask = size - 1;
+
+    Exit:
+        return hr;
+    }
+
+    const SimpleNameToFileNameMapEntry *ApplicationContext::LookupTpaEntry(const SString &simpleName)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        PCWSTR wszSimpleName = simpleName.GetUnicode();
+        if (m_pTpaLookupSlots == nullptr)
+        {
+            // The index is only missing if setting up the binding paths failed part way through
+            return m_pTrustedPlatformAssemblyMap->LookupPtr(wszSimpleName);
+        }
+
+        count_t hash = SimpleNameToFileNameMapTraits::Hash(wszSimpleName);
+        for (count_t index = hash & m_tpaLookupMask; m_pTpaLookupSlots[index].m_pEntry != nullptr; index = (index + 1) & m_tpaLookupMask)
+        {
+            const TpaLookupSlot &slot = m_pTpaLookupSlots[index];
+            if (slot.m_hash == hash && SimpleNameToFileNameMapTraits::Equals(slot.m_pEntry->m_wszSimpleName, wszSimpleName))
+            {
+                return slot.m_pEntry;
+            }
+        }
+
+        return nullptr;
+    }
+
     bool ApplicationContext::IsTpaListProvided()
     {
         return m_pTrustedPlatformAssemblyMap != nullptr;
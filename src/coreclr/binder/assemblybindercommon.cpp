@@ -829,6 +829,7 @@ namespace BINDER_SPACE
                                                 BindResult          *pBindResult)
     {
         HRESULT hr = S_OK;
+        BinderTracing::TpaListBindOperation tpaListBindOperation(pRequestedAssemblyName, hr);
 
         bool fPartialMatchOnTpa = false;
 
@@ -889,8 +890,7 @@ namespace BINDER_SPACE
             }
 
             // Is assembly on TPA list?
-            SimpleNameToFileNameMap * tpaMap = pApplicationContext->GetTpaList();
-            const SimpleNameToFileNameMapEntry *pTpaEntry = tpaMap->LookupPtr(simpleName.GetUnicode());
+            const SimpleNameToFileNameMapEntry *pTpaEntry = pApplicationContext->LookupTpaEntry(simpleName);
             if (pTpaEntry != nullptr)
             {
                 if (pTpaEntry->m_wszNIFileName != nullptr)
@@ -16,6 +16,7 @@
 #include "bindresult.hpp"
 
 #include "activitytracker.h"
+#include "minipal/time.h"
 
 #ifdef FEATURE_EVENT_TRACE
 #include "eventtracebase.h"
@@ -398,3 +399,36 @@ void BinderTracing::PathProbed(const WCHAR *path, BinderTracing::PathSource sour
 {
     FireEtwKnownPathProbed(GetClrInstanceId(), path, source, hr);
 }
+
+namespace BinderTracing
+{
+    TpaListBindOperation::TpaListBindOperation(AssemblyName *assemblyName, const HRESULT& hr)
+        : m_assemblyName { assemblyName }
+        , m_hr { hr }
+        , m_startTicks { 0 }
+        , m_tracingEnabled { false }
+    {
+#ifdef FEATURE_EVENT_TRACE
+        m_tracingEnabled = EventEnabledTpaListBind();
+        if (m_tracingEnabled)
+            m_startTicks = minipal_hires_ticks();
+#endif // FEATURE_EVENT_TRACE
+    }
+
+    TpaListBindOperation::~TpaListBindOperation()
+    {
+#ifdef FEATURE_EVENT_TRACE
+        if (!m_tracingEnabled)
+            return;
+
+        int64_t elapsedTicks = minipal_hires_ticks() - m_startTicks;
+        uint64_t elapsedNanoseconds = (uint64_t)((double)elapsedTicks * 1000000000.0 / (double)minipal_hires_tick_frequency());
+
+        StackSString assemblyName;
+        if (m_assemblyName != nullptr)
+            m_assemblyName->GetDisplayName(assemblyName, AssemblyName::INCLUDE_VERSION | AssemblyName::INCLUDE_PUBLIC_KEY_TOKEN);
+
+        FireEtwTpaListBind(GetClrInstanceId(), assemblyName.GetUnicode(), m_hr, elapsedNanoseconds);
+#endif // FEATURE_EVENT_TRACE
+    }
+}
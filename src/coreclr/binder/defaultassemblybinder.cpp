@@ -141,8 +141,7 @@ HRESULT DefaultAssemblyBinder::BindUsingPEImage( /* in */ PEImage *pPEImage,
             // Ensure we are not being asked to bind to a TPA assembly
             //
             const SString& simpleName = pAssemblyName->GetSimpleName();
-            SimpleNameToFileNameMap* tpaMap = GetAppContext()->GetTpaList();
-            if (tpaMap->LookupPtr(simpleName.GetUnicode()) != NULL)
+            if (GetAppContext()->LookupTpaEntry(simpleName) != NULL)
             {
                 // The simple name of the assembly being requested to be bound was found in the TPA list.
                 // Now, perform the actual bind to see if the assembly was really in the TPA assembly list or not.
@@ -18,6 +18,8 @@
 #include "failurecache.hpp"
 #include "stringarraylist.h"
 
+struct host_runtime_tpa_entry;
+
 namespace BINDER_SPACE
 {
     //=============================================================================================
@@ -103,6 +105,7 @@ namespace BINDER_SPACE
                                          HRESULT  hrBindResult);
         inline StringArrayList *GetAppPaths();
         inline SimpleNameToFileNameMap *GetTpaList();
+        const SimpleNameToFileNameMapEntry *LookupTpaEntry(/* in */ const SString &simpleName);
         inline StringArrayList *GetPlatformResourceRoots();
 
         // Using a host-configured Trusted Platform Assembly list
@@ -112,6 +115,18 @@ namespace BINDER_SPACE
         inline void IncrementVersion();
 
     private:
+        HRESULT SetupTrustedPlatformAssemblyMap(/* in */ const host_runtime_tpa_entry *pEntries,
+                                                /* in */ size_t count);
+        HRESULT BuildTpaLookupIndex();
+
+        // Slot in the read-only TPA lookup index. The case-insensitive hash of the simple name is
+        // stored next to the map entry so a probe only compares strings when the hashes match.
+        struct TpaLookupSlot
+        {
+            count_t m_hash;
+            const SimpleNameToFileNameMapEntry *m_pEntry;
+        };
+
         Volatile<LONG>     m_cVersion;
         SString            m_applicationName;
         ExecutionContext  *m_pExecutionContext;
@@ -122,6 +137,11 @@ namespace BINDER_SPACE
         StringArrayList    m_appPaths;
 
         SimpleNameToFileNameMap * m_pTrustedPlatformAssemblyMap;
+
+        // Open-addressed index over m_pTrustedPlatformAssemblyMap, built once the map is complete.
+        // The map is never modified afterwards, so the entry pointers stay valid.
+        TpaLookupSlot     *m_pTpaLookupSlots;
+        count_t            m_tpaLookupMask;
     };
 
 #include "applicationcontext.inl"
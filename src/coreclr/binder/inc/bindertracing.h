@@ -184,6 +184,22 @@ namespace BinderTracing
     };
 
     void PathProbed(const WCHAR *path, PathSource source, HRESULT hr);
+
+    // If tracing is enabled, this class measures a single TPA list bind and fires an event with
+    // its result and elapsed time on destruction. It should be declared in the stack.
+    class TpaListBindOperation
+    {
+    public:
+        // This class assumes the assembly name and HRESULT will have a longer lifetime than itself
+        TpaListBindOperation(BINDER_SPACE::AssemblyName *assemblyName, const HRESULT& hr);
+        ~TpaListBindOperation();
+
+    private:
+        BINDER_SPACE::AssemblyName *m_assemblyName;
+        const HRESULT &m_hr;
+        int64_t m_startTicks;
+        bool m_tracingEnabled;
+    };
 };
 
 #endif // __BINDER_TRACING_H__
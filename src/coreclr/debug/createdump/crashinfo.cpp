@@ -28,9 +28,11 @@ CrashInfo::CrashInfo(const CreateDumpOptions& options) :
     m_exceptionRecord(options.ExceptionRecord),
     m_moduleInfos(&ModuleInfoCompare),
     m_mainModule(nullptr),
+    m_typeFilterDepth(options.TypeFilterDepth),
     m_cbModuleMappings(0),
     m_dataTargetPagesAdded(0),
-    m_enumMemoryPagesAdded(0)
+    m_enumMemoryPagesAdded(0),
+    m_suppressDataTargetPages(false)
 {
     g_crashInfo = this;
     m_runtimeBaseAddress = 0;
@@ -45,6 +47,25 @@ CrashInfo::CrashInfo(const CreateDumpOptions& options) :
     m_siginfo.si_code = options.SignalCode;
     m_siginfo.si_errno = options.SignalErrno;
     m_siginfo.si_addr = (void*)options.SignalAddress;
+
+    if (options.TypeFilter != nullptr)
+    {
+        std::string typeFilter(options.TypeFilter);
+        size_t start = 0;
+        while (start <= typeFilter.size())
+        {
+            size_t end = typeFilter.find(',', start);
+            if (end == std::string::npos)
+            {
+                end = typeFilter.size();
+            }
+            if (end > start)
+            {
+                m_typeFilter.push_back(typeFilter.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+    }
 }
 
 CrashInfo::~CrashInfo()
@@ -414,10 +435,261 @@ CrashInfo::EnumerateMemoryRegionsWithDAC(DumpType dumpType)
             return false;
         }
         TRACE("EnumerateMemoryRegionsWithDAC: Memory enumeration FINISHED (%d %d)\n", m_enumMemoryPagesAdded, m_dataTargetPagesAdded);
+
+        if (!m_typeFilter.empty())
+        {
+            EnumerateFilteredHeapObjects();
+        }
+    }
+    return true;
+}
+
+//
+// Returns true if the managed type name matches one of the --typefilter names
+//
+bool
+CrashInfo::MatchesTypeFilter(const std::string& typeName)
+{
+    for (const std::string& filter : m_typeFilter)
+    {
+        if (!filter.empty() && filter.back() == '*')
+        {
+            if (typeName.compare(0, filter.size() - 1, filter, 0, filter.size() - 1) == 0)
+            {
+                return true;
+            }
+        }
+        else if (typeName == filter)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//
+// Gets the address ranges of all the GC heap segments (or regions)
+//
+static bool
+GetGCHeapRanges(ISOSDacInterface* pSos, std::vector<std::pair<uint64_t, uint64_t>>& ranges)
+{
+    DacpGcHeapData heapData;
+    if (FAILED(heapData.Request(pSos)) || !heapData.bGcStructuresValid)
+    {
+        return false;
+    }
+    std::vector<CLRDATA_ADDRESS> heaps(heapData.bServerMode ? heapData.HeapCount : 1, 0);
+    if (heapData.bServerMode)
+    {
+        unsigned int needed = 0;
+        if (FAILED(pSos->GetGCHeapList(heapData.HeapCount, heaps.data(), &needed)))
+        {
+            return false;
+        }
+    }
+    // ISOSDacInterface8 also returns the pinned object heap generation; the details generation table stops at the LOH.
+    ReleaseHolder<ISOSDacInterface8> pSos8 = nullptr;
+    unsigned int generationCount = 0;
+    if (FAILED(pSos->QueryInterface(__uuidof(ISOSDacInterface8), (void**)&pSos8)) || FAILED(pSos8->GetNumberGenerations(&generationCount)))
+    {
+        pSos8 = nullptr;
+        generationCount = DAC_NUMBERGENERATIONS;
+    }
+    std::set<CLRDATA_ADDRESS> visited;
+    for (CLRDATA_ADDRESS heap : heaps)
+    {
+        DacpGcHeapDetails details;
+        if (FAILED(heapData.bServerMode ? details.Request(pSos, heap) : details.Request(pSos)))
+        {
+            return false;
+        }
+        std::vector<DacpGenerationData> generations(details.generation_table, details.generation_table + DAC_NUMBERGENERATIONS);
+        if (pSos8 != nullptr)
+        {
+            generations.resize(generationCount);
+            unsigned int needed = 0;
+            HRESULT hr = heapData.bServerMode ?
+                pSos8->GetGenerationTableSvr(heap, generationCount, generations.data(), &needed) :
+                pSos8->GetGenerationTable(generationCount, generations.data(), &needed);
+            if (FAILED(hr))
+            {
+                generations.assign(details.generation_table, details.generation_table + DAC_NUMBERGENERATIONS);
+            }
+        }
+        // With segments the ephemeral generations share the gen2 segment list, with regions each
+        // generation has its own list; the visited set skips the segments already added.
+        for (const DacpGenerationData& generation : generations)
+        {
+            CLRDATA_ADDRESS segment = generation.start_segment;
+            while (segment != 0 && visited.insert(segment).second)
+            {
+                DacpHeapSegmentData segmentData;
+                if (FAILED(segmentData.Request(pSos, segment, details)))
+                {
+                    break;
+                }
+                if (segmentData.highAllocMark > segmentData.mem)
+                {
+                    ranges.push_back(std::make_pair((uint64_t)segmentData.mem, (uint64_t)segmentData.highAllocMark));
+                }
+                segment = segmentData.next;
+            }
+        }
     }
+    std::sort(ranges.begin(), ranges.end());
     return true;
 }
 
+static bool
+InGCHeapRange(const std::vector<std::pair<uint64_t, uint64_t>>& ranges, uint64_t address)
+{
+    auto found = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(address, UINT64_MAX));
+    return found != ranges.begin() && address < (--found)->second;
+}
+
+//
+// Walks the GC heap and adds the objects whose type matches the --typefilter names, and the objects
+// they reference up to the --typedepth levels, to the dump.
+//
+void
+CrashInfo::EnumerateFilteredHeapObjects()
+{
+    ReleaseHolder<ISOSDacInterface> pSos = nullptr;
+    if (m_pClrDataProcess == nullptr || FAILED(m_pClrDataProcess->QueryInterface(__uuidof(ISOSDacInterface), (void**)&pSos)))
+    {
+        printf_error("Type filtered heap objects not supported by this runtime\n");
+        return;
+    }
+    TRACE("EnumerateFilteredHeapObjects: STARTED (%d %d)\n", m_enumMemoryPagesAdded, m_dataTargetPagesAdded);
+
+    // The heap walk reads every object header (and method table) through the DAC; don't let
+    // those reads add the whole GC heap to the dump.
+    m_suppressDataTargetPages = true;
+
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    if (!GetGCHeapRanges(pSos, ranges))
+    {
+        m_suppressDataTargetPages = false;
+        printf_error("Type filtered heap objects: GC heap enumeration FAILED\n");
+        return;
+    }
+
+    // method table -> (matches filter, contains pointers)
+    std::map<CLRDATA_ADDRESS, std::pair<bool, bool>> methodTables;
+    std::set<CLRDATA_ADDRESS> addedMethodTables;
+    size_t matchedTypes = 0;
+    std::vector<std::pair<uint64_t, int>> pending;  // object address, reference depth
+    std::set<uint64_t> added;
+    WCHAR typeName[MAX_LONGPATH];
+
+    auto getMethodTableInfo = [&](CLRDATA_ADDRESS methodTable) -> std::pair<bool, bool>
+    {
+        const auto& found = methodTables.find(methodTable);
+        if (found != methodTables.end())
+        {
+            return found->second;
+        }
+        std::pair<bool, bool> info(false, false);
+        DacpMethodTableData methodTableData;
+        if (SUCCEEDED(methodTableData.Request(pSos, methodTable)) && !methodTableData.bIsFree)
+        {
+            info.second = methodTableData.bContainsPointers != FALSE;
+            unsigned int needed = 0;
+            if (SUCCEEDED(pSos->GetMethodTableName(methodTable, MAX_LONGPATH, typeName, &needed)) && MatchesTypeFilter(ConvertString(typeName)))
+            {
+                info.first = true;
+                matchedTypes++;
+            }
+        }
+        methodTables[methodTable] = info;
+        return info;
+    };
+
+    // Find all the objects of the filtered types
+    for (const std::pair<uint64_t, uint64_t>& range : ranges)
+    {
+        uint64_t address = range.first;
+        while (address < range.second)
+        {
+            uint64_t methodTable = 0;
+            size_t read = 0;
+            if (!ReadProcessMemory(address, &methodTable, sizeof(methodTable), &read) || read != sizeof(methodTable))
+            {
+                break;
+            }
+            // The unused part of the allocation contexts is zero filled
+            if (methodTable == 0)
+            {
+                address += sizeof(void*);
+                continue;
+            }
+            DacpObjectData objectData;
+            if (FAILED(objectData.Request(pSos, address)) || objectData.Size == 0)
+            {
+                TRACE("EnumerateFilteredHeapObjects: invalid object %" PRIx64 " in range %" PRIx64 "-%" PRIx64 "\n", address, range.first, range.second);
+                break;
+            }
+            if (objectData.ObjectType != OBJ_FREE && getMethodTableInfo(objectData.MethodTable).first)
+            {
+                pending.push_back(std::make_pair(address, 0));
+            }
+            address += (objectData.Size + sizeof(void*) - 1) & ~(uint64_t)(sizeof(void*) - 1);
+        }
+    }
+    size_t matchedObjects = pending.size();
+
+    // Add the objects and follow their references. Any pointer sized field that points to a valid object in
+    // the GC heap is treated as a reference; this may add a few extra objects but never misses one.
+    while (!pending.empty())
+    {
+        std::pair<uint64_t, int> entry = pending.back();
+        pending.pop_back();
+        uint64_t address = entry.first;
+        if (!added.insert(address).second)
+        {
+            continue;
+        }
+        DacpObjectData objectData;
+        if (FAILED(objectData.Request(pSos, address)))
+        {
+            continue;
+        }
+        // Include the object header before the object
+        InsertMemoryRegion(address - sizeof(void*), objectData.Size + sizeof(void*));
+        addedMethodTables.insert(objectData.MethodTable);
+
+        if (entry.second < m_typeFilterDepth && getMethodTableInfo(objectData.MethodTable).second)
+        {
+            for (uint64_t field = address + sizeof(void*); field + sizeof(void*) <= address + objectData.Size; field += sizeof(void*))
+            {
+                uint64_t reference = 0;
+                size_t read = 0;
+                if (ReadProcessMemory(field, &reference, sizeof(void*), &read) && read == sizeof(void*) &&
+                    InGCHeapRange(ranges, reference) && added.find(reference) == added.end())
+                {
+                    DacpObjectData referenceData;
+                    if (SUCCEEDED(referenceData.Request(pSos, reference)) && referenceData.ObjectType != OBJ_FREE)
+                    {
+                        pending.push_back(std::make_pair(reference, entry.second + 1));
+                    }
+                }
+            }
+        }
+    }
+
+    // Add the method tables of the objects so the debugger can interpret them
+    m_suppressDataTargetPages = false;
+    for (CLRDATA_ADDRESS methodTable : addedMethodTables)
+    {
+        DacpMethodTableData methodTableData;
+        unsigned int needed = 0;
+        methodTableData.Request(pSos, methodTable);
+        pSos->GetMethodTableName(methodTable, MAX_LONGPATH, typeName, &needed);
+    }
+    TRACE("EnumerateFilteredHeapObjects: FINISHED %zu matched, %zu added, %zu types (%d %d)\n",
+        matchedObjects, added.size(), matchedTypes, m_enumMemoryPagesAdded, m_dataTargetPagesAdded);
+}
+
 //
 // Enumerate all the managed modules and replace the module mapping with the module name found.
 //
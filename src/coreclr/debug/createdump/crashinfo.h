@@ -77,6 +77,8 @@ private:
     std::set<MemoryRegion> m_moduleAddresses;       // memory region to module base address
     std::set<ModuleInfo*, bool (*)(const ModuleInfo* lhs, const ModuleInfo* rhs)> m_moduleInfos; // module infos (base address and module name)
     ModuleInfo* m_mainModule;                       // the module containing "Main"
+    std::vector<std::string> m_typeFilter;          // managed type names whose heap objects are added (--typefilter)
+    int m_typeFilterDepth;                          // reference levels followed from the filtered objects
 
     // no public copy constructor
     CrashInfo(const CrashInfo&) = delete;
@@ -90,6 +92,7 @@ public:
     uint64_t m_cbModuleMappings;
     int m_dataTargetPagesAdded;
     int m_enumMemoryPagesAdded;
+    bool m_suppressDataTargetPages;                 // if true, data target reads aren't added to the dump
 
     bool Initialize();
     void CleanupAndResumeProcess();
@@ -99,6 +102,9 @@ public:
     bool EnumerateMemoryRegionsWithDAC(DumpType dumpType);
     bool ReadMemory(uint64_t address, void* buffer, size_t size);                       // read memory and add to dump
     bool ReadProcessMemory(uint64_t address, void* buffer, size_t size, size_t* read);  // read raw memory
+#if !defined(__APPLE__) && defined(HAVE_PROCESS_VM_READV)
+    bool ReadProcessMemoryBatch(const iovec* remote, int remoteCount, void* buffer, size_t size, size_t* read); // read several ranges with one syscall
+#endif
     uint64_t GetBaseAddressFromAddress(uint64_t address);
     uint64_t GetBaseAddressFromName(const char* moduleName);
     ModuleInfo* GetModuleInfoFromBaseAddress(uint64_t baseAddress);
@@ -161,6 +167,8 @@ private:
     bool InitializeDAC(DumpType dumpType);
     bool EnumerateManagedModules();
     bool UnwindAllThreads();
+    void EnumerateFilteredHeapObjects();
+    bool MatchesTypeFilter(const std::string& typeName);
     void AddOrReplaceModuleMapping(uint64_t baseAddress, uint64_t size, const std::string& pszName);
     int InsertMemoryRegion(const MemoryRegion& region);
     uint32_t GetMemoryRegionFlags(uint64_t start);
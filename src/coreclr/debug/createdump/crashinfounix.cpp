@@ -545,6 +545,37 @@ CrashInfo::ReadProcessMemory(uint64_t address, void* buffer, size_t size, size_t
     return true;
 }
 
+#ifdef HAVE_PROCESS_VM_READV
+//
+// Read several memory ranges into consecutive bytes of the buffer with a single process_vm_readv. The
+// read stops at the first range that can't be read completely, so *read can be less than size. Returns
+// false if nothing could be read this way and the ranges need to be read one at a time.
+//
+bool
+CrashInfo::ReadProcessMemoryBatch(const iovec* remote, int remoteCount, void* buffer, size_t size, size_t* read)
+{
+    assert(remote != nullptr);
+    assert(buffer != nullptr);
+    assert(read != nullptr);
+    *read = 0;
+
+    if (!m_canUseProcVmReadSyscall)
+    {
+        return false;
+    }
+
+    iovec local{ buffer, size };
+    ssize_t result = process_vm_readv(m_pid, &local, 1, remote, remoteCount, 0);
+    if (result <= 0)
+    {
+        TRACE_VERBOSE("ReadProcessMemoryBatch FAILED count: %d size: %zu error: %s (%d)\n", remoteCount, size, strerror(errno), errno);
+        return false;
+    }
+    *read = (size_t)result;
+    return true;
+}
+#endif
+
 //
 // Get the process or thread status
 //
@@ -85,6 +85,7 @@ typedef int T_CONTEXT;
 #include <winternl.h>
 #include <dbghelp.h>
 #endif
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -120,6 +121,8 @@ typedef struct
     int SignalErrno;
     uint64_t SignalAddress;
     uint64_t ExceptionRecord;
+    const char* TypeFilter;
+    int TypeFilterDepth;
 } CreateDumpOptions;
 
 #ifdef HOST_UNIX
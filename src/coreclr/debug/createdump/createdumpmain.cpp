@@ -36,6 +36,9 @@ const char* g_help = "createdump [options]\n"
 "--signal <code> - the signal code of the crash.\n"
 "--singlefile - single-file app model.\n"
 "--nativeaot - native AOT app model.\n"
+"--typefilter <types> - comma separated list of managed type names (a trailing '*' matches a prefix). Only the GC heap objects\n"
+"   of these types and the objects they reference are added to the dump. Implies --normal unless --triage is given.\n"
+"--typedepth <n> - the number of reference levels followed from the --typefilter objects. The default is 1.\n"
 #endif
 ;
 
@@ -74,6 +77,8 @@ int createdump_main(const int argc, const char* argv[])
     options.SignalErrno = 0;
     options.SignalAddress = 0;
     options.ExceptionRecord = 0;
+    options.TypeFilter = nullptr;
+    options.TypeFilterDepth = 1;
     bool help = false;
     int exitCode = 0;
 
@@ -145,6 +150,14 @@ int createdump_main(const int argc, const char* argv[])
             {
                 options.ExceptionRecord = atoll(*++argv);
             }
+            else if (strcmp(*argv, "--typefilter") == 0)
+            {
+                options.TypeFilter = *++argv;
+            }
+            else if (strcmp(*argv, "--typedepth") == 0)
+            {
+                options.TypeFilterDepth = atoi(*++argv);
+            }
 #endif
             else if ((strcmp(*argv, "-d") == 0) || (strcmp(*argv, "--diag") == 0))
             {
@@ -188,6 +201,11 @@ int createdump_main(const int argc, const char* argv[])
     {
         help = true;
     }
+    // The type filtered objects are added on top of a minidump; the heap and full dumps already contain them
+    if (options.TypeFilter != nullptr && options.DumpType != DumpType::Triage)
+    {
+        options.DumpType = DumpType::Mini;
+    }
 #endif
 
     if (help)
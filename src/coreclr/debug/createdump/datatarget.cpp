@@ -126,7 +126,10 @@ DumpDataTarget::ReadVirtual(
         *done = 0;
         return E_FAIL;
     }
-    m_crashInfo.m_dataTargetPagesAdded += m_crashInfo.InsertMemoryRegion(address, read);
+    if (!m_crashInfo.m_suppressDataTargetPages)
+    {
+        m_crashInfo.m_dataTargetPagesAdded += m_crashInfo.InsertMemoryRegion(address, read);
+    }
     *done = read;
     return S_OK;
 }
@@ -168,52 +168,119 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
-    // Read from target process and write memory regions to core
+    return WriteMemoryRegions();
+}
+
+//
+// Read from target process and write memory regions to core. The target stays suspended until
+// the dump is written so the regions are copied through a large buffer, and runs of regions that
+// fit in it are read with a single batched read instead of a syscall per region.
+//
+bool
+DumpWriter::WriteMemoryRegions()
+{
+    const std::set<MemoryRegion>& memoryRegions = m_crashInfo.MemoryRegions();
     uint64_t total = 0;
-    for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
-    {
-        uint64_t address = memoryRegion.StartAddress();
-        size_t size = memoryRegion.Size();
-        total += size;
 
-        if (address == SpecialDiagInfoAddress)
+    m_copyBuffer.resize(COPY_BUFFER_SIZE);
+
+    auto region = memoryRegions.begin();
+    while (region != memoryRegions.end())
+    {
+        if (region->StartAddress() == SpecialDiagInfoAddress)
         {
-            if (!WriteDiagInfo(size)) {
+            total += region->Size();
+            if (!WriteDiagInfo(region->Size())) {
                 return false;
             }
+            ++region;
+            continue;
         }
-        else
+
+#ifdef HAVE_PROCESS_VM_READV
+        iovec remote[MAX_BATCHED_REGIONS];
+        int remoteCount = 0;
+        size_t batchSize = 0;
+        auto batchEnd = region;
+        while (batchEnd != memoryRegions.end() &&
+               remoteCount < MAX_BATCHED_REGIONS &&
+               batchEnd->StartAddress() != SpecialDiagInfoAddress &&
+               batchSize + batchEnd->Size() <= m_copyBuffer.size())
         {
-            while (size > 0)
-            {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
-                size_t read = 0;
+            remote[remoteCount].iov_base = (void*)batchEnd->StartAddress();
+            remote[remoteCount].iov_len = batchEnd->Size();
+            remoteCount++;
+            batchSize += batchEnd->Size();
+            ++batchEnd;
+        }
 
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+        if (remoteCount > 1)
+        {
+            size_t read = 0;
+            if (m_crashInfo.ReadProcessMemoryBatch(remote, remoteCount, m_copyBuffer.data(), batchSize, &read)) {
+                if (!WriteData(m_copyBuffer.data(), read)) {
                     return false;
                 }
+            }
 
-                // This can happen if the target process dies before createdump is finished
-                if (read == 0) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
-                    return false;
+            // Whatever the batched read couldn't read is read one region at a time
+            for (; region != batchEnd; ++region)
+            {
+                size_t size = region->Size();
+                total += size;
+                if (read >= size)
+                {
+                    read -= size;
+                    continue;
                 }
-
-                if (!WriteData(m_tempBuffer, read)) {
+                if (!WriteMemory(region->StartAddress() + read, size - read)) {
                     return false;
                 }
-
-                address += read;
-                size -= read;
+                read = 0;
             }
+            continue;
         }
+#endif
+        total += region->Size();
+        if (!WriteMemory(region->StartAddress(), region->Size())) {
+            return false;
+        }
+        ++region;
     }
 
     printf_status("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
     return true;
 }
 
+bool
+DumpWriter::WriteMemory(uint64_t address, size_t size)
+{
+    while (size > 0)
+    {
+        size_t bytesToRead = std::min(size, m_copyBuffer.size());
+        size_t read = 0;
+
+        if (!m_crashInfo.ReadProcessMemory(address, m_copyBuffer.data(), bytesToRead, &read)) {
+            printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+            return false;
+        }
+
+        // This can happen if the target process dies before createdump is finished
+        if (read == 0) {
+            printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+            return false;
+        }
+
+        if (!WriteData(m_copyBuffer.data(), read)) {
+            return false;
+        }
+
+        address += read;
+        size -= read;
+    }
+    return true;
+}
+
 bool
 DumpWriter::WriteProcessInfo()
 {
@@ -37,12 +37,17 @@
 #define NT_SIGINFO	0x53494749
 #endif
 
+// Size of the buffer memory regions are copied through and how many regions are read with one batched read
+#define COPY_BUFFER_SIZE 0x100000
+#define MAX_BATCHED_REGIONS 256
+
 class DumpWriter
 {
 private:
     int m_fd;
     CrashInfo& m_crashInfo;
     BYTE m_tempBuffer[0x4000];
+    std::vector<BYTE> m_copyBuffer;
 
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
@@ -62,6 +67,8 @@ private:
     size_t GetNTFileInfoSize(size_t* alignmentBytes = nullptr);
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread);
+    bool WriteMemoryRegions();
+    bool WriteMemory(uint64_t address, size_t size);
     bool WriteData(const void* buffer, size_t length) { return WriteData(m_fd, buffer, length); }
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
@@ -307,6 +307,14 @@ public:
     //  true if it has succeeded, false if it has failed
     static bool VirtualReset(void *address, size_t size, bool unlock);
 
+    // Advise the OS to back a committed virtual memory range with transparent huge pages.
+    // Parameters:
+    //  address - starting virtual address
+    //  size    - size of the virtual memory range
+    // Return:
+    //  true if it has succeeded, false if it has failed or is not supported
+    static bool VirtualAdviseHugePages(void *address, size_t size);
+
     //
     // Write watching
     //
@@ -444,6 +452,14 @@ public:
     //  Any parameter can be null.
     static void GetMemoryStatus(uint64_t restricted_limit, uint32_t* memory_load, uint64_t* available_physical, uint64_t* available_page_file);
 
+    // Get the memory pressure of the container the process runs in
+    // Parameters:
+    //  pressure - A number between 0 and 100 that specifies the percentage of recent time in which
+    //      tasks were stalled waiting on memory.
+    // Return:
+    //  true if the pressure could be obtained, false otherwise (e.g. not running under cgroup v2)
+    static bool GetMemoryPressure(uint32_t* pressure);
+
     // Get size of an OS memory page
     static size_t GetPageSize();
 
@@ -42,10 +42,16 @@
 #endif // defined(FEATURE_SVR_GC)
 #endif // __INTELLISENSE__
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
 #include "vxsort/do_vxsort.h"
 #endif
 
+#if defined(TARGET_AMD64)
+#include <emmintrin.h>
+#elif defined(TARGET_ARM64)
+#include <arm_neon.h>
+#endif
+
 #ifdef SERVER_GC
 namespace SVR {
 #else // SERVER_GC
@@ -55,7 +61,7 @@ namespace WKS {
 #include "gcimpl.h"
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -114,6 +120,11 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 // If the survived due to cards from old generations / region_size is 90+%,
 // we don't compact this region, also we immediately promote it to gen2.
 #define sip_old_card_surv_ratio_th (90)
+#ifdef BACKGROUND_GC
+// If the survived / region_size measured by BGC sweep is below 30%, the gen2
+// region is a candidate for evacuation.
+#define bgc_low_surv_ratio_th (30)
+#endif //BACKGROUND_GC
 #endif //USE_REGIONS
 
 #ifdef HOST_64BIT
@@ -127,6 +138,9 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 
 #define UOH_ALLOCATION_RETRY_MAX_COUNT 2
 
+// UOH allocations up to this size will go to another heap when the more space lock of the one picked is taken
+#define UOH_MSL_BALANCE_MAX_SIZE (1024*1024)
+
 #define MAX_YP_SPIN_COUNT_UNIT 32768
 
 uint32_t yp_spin_count_unit = 0;
@@ -664,7 +678,8 @@ enum gc_join_stage
     gc_join_disable_software_write_watch = 38,
     gc_join_merge_temp_fl = 39,
     gc_join_bridge_processing = 40,
-    gc_join_max = 41
+    gc_join_bridge_headers_restored = 41,
+    gc_join_max = 42
 };
 
 enum gc_join_flavor
@@ -694,6 +709,21 @@ struct DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE) join_structure
     VOLATILE(int) r_join_lock;
 
 };
+
+// With many heaps, threads first join per group of join_group_size consecutive heaps (which
+// usually share a NUMA node) and only the last thread of each group touches the shared counter.
+// Waiting threads spin on the color of their group so a restart doesn't have every waiting
+// thread fetching the same cache line.
+#define join_group_size 16
+#define max_join_groups ((MAX_SUPPORTED_CPUS + join_group_size - 1) / join_group_size)
+
+struct DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE) join_group
+{
+    VOLATILE(int) join_lock;
+    int n_threads;
+    // Follows join_structure::lock_color, which is what decides whether a join is done.
+    Volatile<int> lock_color;
+};
 #pragma warning(pop)
 
 enum join_type
@@ -724,6 +754,16 @@ class t_join
     int id;
     gc_join_flavor flavor;
 
+    // Thread count from which threads join through groups (GCJoinGroupThreshold), 0 means never.
+    int group_threshold;
+    int n_groups;
+    join_group groups[max_join_groups];
+
+    // Time threads spent waiting and number of joins per join id since the last
+    // fire_wait_time_events, only collected when the JoinWaitTime event is enabled.
+    uint64_t wait_time_us[gc_join_max];
+    uint32_t join_count[gc_join_max];
+
 #ifdef JOIN_STATS
     uint64_t start[MAX_SUPPORTED_CPUS], end[MAX_SUPPORTED_CPUS], start_seq;
     // remember join id and last thread to arrive so restart can use these
@@ -757,11 +797,15 @@ public:
                     return FALSE;
             }
         }
-        join_struct.join_lock = join_struct.n_threads;
         join_struct.r_join_lock = join_struct.n_threads;
         join_struct.wait_done = FALSE;
         flavor = f;
 
+        group_threshold = (int)GCConfig::GetGCJoinGroupThreshold();
+        init_groups (n_th);
+        memset (wait_time_us, 0, sizeof (wait_time_us));
+        memset (join_count, 0, sizeof (join_count));
+
 #ifdef JOIN_STATS
         start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //JOIN_STATS
@@ -772,10 +816,74 @@ public:
     void update_n_threads(int n_th)
     {
         join_struct.n_threads = n_th;
-        join_struct.join_lock = n_th;
+        init_groups (n_th);
         join_struct.r_join_lock = n_th;
     }
 
+    // Sets up the groups for n_th threads and the shared counter, which counts groups when
+    // there are groups and threads otherwise.
+    void init_groups (int n_th)
+    {
+        n_groups = 0;
+        if ((group_threshold > 0) && (n_th >= group_threshold))
+        {
+            n_groups = (n_th + join_group_size - 1) / join_group_size;
+        }
+
+        int color = join_struct.lock_color.LoadWithoutBarrier();
+        for (int i = 0; i < n_groups; i++)
+        {
+            groups[i].n_threads = min (join_group_size, n_th - (i * join_group_size));
+            groups[i].join_lock = groups[i].n_threads;
+            groups[i].lock_color = color;
+        }
+
+        join_struct.join_lock = ((n_groups != 0) ? n_groups : n_th);
+    }
+
+    // Returns true if this is the last thread to arrive at the join.
+    bool arrive (int thread_index)
+    {
+        if (n_groups != 0)
+        {
+            join_group* group = &groups[thread_index / join_group_size];
+            if (Interlocked::Decrement (&group->join_lock) != 0)
+            {
+                return false;
+            }
+        }
+
+        return (Interlocked::Decrement (&join_struct.join_lock) == 0);
+    }
+
+    // Fires a JoinWaitTime event for each join id used since the last call.
+    void fire_wait_time_events (size_t gc_index)
+    {
+#ifdef FEATURE_EVENT_TRACE
+        if (!EVENT_ENABLED (JoinWaitTime_V1)) return;
+
+        for (int i = 0; i < gc_join_max; i++)
+        {
+            if (join_count[i] == 0)
+            {
+                continue;
+            }
+
+            GCEventFireJoinWaitTime_V1 (
+                (uint64_t)gc_index,
+                (uint8_t)flavor,
+                (uint16_t)i,
+                (uint16_t)join_struct.n_threads,
+                (uint16_t)n_groups,
+                join_count[i],
+                wait_time_us[i]);
+
+            join_count[i] = 0;
+            wait_time_us[i] = 0;
+        }
+#endif //FEATURE_EVENT_TRACE
+    }
+
     int get_num_threads()
     {
         return join_struct.n_threads;
@@ -812,13 +920,18 @@ public:
         assert (!join_struct.joined_p);
         int color = join_struct.lock_color.LoadWithoutBarrier();
 
-        if (Interlocked::Decrement(&join_struct.join_lock) != 0)
+        if (!arrive (gch->heap_number))
         {
             dprintf (JOIN_LOG, ("join%d(%d): Join() Waiting...join_lock is now %d",
                 flavor, join_id, (int32_t)(join_struct.join_lock)));
 
             fire_event (gch->heap_number, time_start, type_join, join_id);
 
+            uint64_t wait_start = (EVENT_ENABLED (JoinWaitTime_V1) ? GetHighPrecisionTimeStamp() : 0);
+            Volatile<int>* spin_color = ((n_groups != 0) ?
+                &groups[gch->heap_number / join_group_size].lock_color :
+                &join_struct.lock_color);
+
             //busy wait around the color
             if (color == join_struct.lock_color.LoadWithoutBarrier())
             {
@@ -826,7 +939,7 @@ respin:
                 int spin_count = 128 * yp_spin_count_unit;
                 for (int j = 0; j < spin_count; j++)
                 {
-                    if (color != join_struct.lock_color.LoadWithoutBarrier())
+                    if (color != spin_color->LoadWithoutBarrier())
                     {
                         break;
                     }
@@ -860,6 +973,11 @@ respin:
                     flavor, join_id, (int32_t)(join_struct.join_lock)));
             }
 
+            if (wait_start != 0)
+            {
+                Interlocked::ExchangeAdd64 (&wait_time_us[join_id], GetHighPrecisionTimeStamp() - wait_start);
+            }
+
             fire_event (gch->heap_number, time_end, type_join, join_id);
 
 #ifdef JOIN_STATS
@@ -876,6 +994,7 @@ respin:
             dprintf (JOIN_LOG, ("join%d(%d): Last thread to complete the join, setting id", flavor, join_id));
             join_struct.joined_event[!color].Reset();
             id = join_id;
+            join_count[join_id]++;
 #ifdef JOIN_STATS
             // remember the join id, the last thread arriving, the start of the sequential phase,
             // and keep track of the cycles spent waiting in the join
@@ -1018,10 +1137,18 @@ respin:
         fire_event (join_heap_restart, time_start, type_restart, -1);
         assert (join_struct.joined_p);
         join_struct.joined_p = FALSE;
-        join_struct.join_lock = join_struct.n_threads;
+        for (int i = 0; i < n_groups; i++)
+        {
+            groups[i].join_lock = groups[i].n_threads;
+        }
+        join_struct.join_lock = ((n_groups != 0) ? n_groups : join_struct.n_threads);
         dprintf (JOIN_LOG, ("join%d(%d): Restarting from join: join_lock is %d", flavor, id, (int32_t)(join_struct.join_lock)));
         int color = join_struct.lock_color.LoadWithoutBarrier();
         join_struct.lock_color = !color;
+        for (int i = 0; i < n_groups; i++)
+        {
+            groups[i].lock_color = !color;
+        }
         join_struct.joined_event[color].Set();
 
         fire_event (join_heap_restart, time_end, type_restart, -1);
@@ -1408,6 +1535,8 @@ bool gc_heap::should_move_heap (GCSpinLock* msl)
 // so we can try another heap or we can continue the allocation on the same heap.
 enter_msl_status gc_heap::enter_spin_lock_msl_helper (GCSpinLock* msl)
 {
+    Interlocked::Increment (&msl->msl_contention_count);
+
     do
     {
 #ifdef DYNAMIC_HEAP_COUNT
@@ -2053,6 +2182,23 @@ uint8_t* align_lower_page (uint8_t* add)
     return (uint8_t*)align_lower_page ((size_t)add);
 }
 
+#ifdef USE_REGIONS
+// the size of a transparent huge page
+#define THP_PAGE_SIZE ((size_t)2*1024*1024)
+
+inline
+uint8_t* align_on_thp_page (uint8_t* add)
+{
+    return (uint8_t*)(((size_t)add + THP_PAGE_SIZE - 1) & ~(THP_PAGE_SIZE - 1));
+}
+
+inline
+uint8_t* align_lower_thp_page (uint8_t* add)
+{
+    return (uint8_t*)((size_t)add & ~(THP_PAGE_SIZE - 1));
+}
+#endif //USE_REGIONS
+
 inline
 size_t align_write_watch_lower_page (size_t add)
 {
@@ -2309,6 +2455,7 @@ VOLATILE(BOOL) gc_heap::gc_started;
 #ifdef MULTIPLE_HEAPS
 GCEvent     gc_heap::gc_start_event;
 bool        gc_heap::gc_thread_no_affinitize_p = false;
+bool        gc_heap::parallel_handle_scan_p = true;
 uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;       // current number of heaps
@@ -2403,6 +2550,8 @@ bool        gc_heap::use_frozen_segments_p = false;
 #ifdef FEATURE_LOH_COMPACTION
 gc_heap::etw_loh_compact_info* gc_heap::loh_compact_info;
 #endif //FEATURE_LOH_COMPACTION
+
+gc_heap::etw_heap_phase_time_info* gc_heap::heap_phase_time_info;
 #endif //FEATURE_EVENT_TRACE
 
 bool        gc_heap::hard_limit_config_p = false;
@@ -2467,6 +2616,8 @@ uint32_t    gc_heap::v_high_memory_load_th;
 
 uint32_t    gc_heap::almost_high_memory_load_th;
 
+uint32_t    gc_heap::memory_pressure_th = 0;
+
 bool        gc_heap::is_restricted_physical_mem;
 
 uint64_t    gc_heap::total_physical_mem = 0;
@@ -2549,6 +2700,8 @@ uint32_t    gc_heap::fgn_maxgen_percent = 0;
 size_t      gc_heap::fgn_last_alloc = 0;
 
 int         gc_heap::generation_skip_ratio = 100;
+VOLATILE(size_t) gc_heap::total_cards_scanned = 0;
+VOLATILE(size_t) gc_heap::total_cards_set = 0;
 #ifdef FEATURE_CARD_MARKING_STEALING
 VOLATILE(size_t) gc_heap::n_eph_soh = 0;
 VOLATILE(size_t) gc_heap::n_gen_soh = 0;
@@ -2587,6 +2740,8 @@ fgm_history gc_heap::fgm_result;
 
 size_t      gc_heap::allocated_since_last_gc[total_oh_count];
 
+uint64_t    gc_heap::phase_times[max_heap_phase_time_type];
+
 #ifndef USE_REGIONS
 BOOL        gc_heap::ro_segments_in_range = FALSE;
 uint8_t*    gc_heap::ephemeral_low;
@@ -2649,6 +2804,8 @@ size_t      gc_heap::num_condemned_regions = 0;
 
 region_free_list gc_heap::free_regions[count_free_region_kinds];
 
+size_t      gc_heap::young_uoh_size = 0;
+
 int         gc_heap::num_regions_freed_in_sweep = 0;
 
 int         gc_heap::regions_per_gen[max_generation + 1];
@@ -2714,7 +2871,7 @@ BOOL        gc_heap::loh_compacted_p = FALSE;
 
 EEThreadId  gc_heap::bgc_thread_id;
 
-uint8_t*    gc_heap::background_written_addresses [array_size+2];
+uint8_t*    gc_heap::background_written_addresses [2 * array_size];
 
 heap_segment* gc_heap::freeable_soh_segment = 0;
 
@@ -2732,6 +2889,11 @@ size_t      gc_heap::uoh_a_bgc_planning[uoh_generation_count] = {};
 size_t      gc_heap::bgc_maxgen_end_fl_size = 0;
 #endif //BGC_SERVO_TUNING
 
+#ifdef USE_REGIONS
+size_t      gc_heap::bgc_low_surv_regions = 0;
+size_t      gc_heap::bgc_low_surv_free_size = 0;
+#endif //USE_REGIONS
+
 size_t      gc_heap::bgc_loh_size_increased = 0;
 
 size_t      gc_heap::bgc_poh_size_increased = 0;
@@ -2776,6 +2938,8 @@ size_t      gc_heap::c_mark_list_length = 0;
 
 size_t      gc_heap::c_mark_list_index = 0;
 
+mark_queue_t gc_heap::background_mark_queue;
+
 gc_history_per_heap gc_heap::bgc_data_per_heap;
 
 BOOL    gc_heap::bgc_thread_running;
@@ -2876,11 +3040,19 @@ size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 #endif //USE_REGIONS
 bool          gc_heap::use_large_pages_p = 0;
+#ifdef USE_REGIONS
+bool          gc_heap::use_thp_p = false;
+bool          gc_heap::use_young_uoh_p = false;
+size_t        gc_heap::young_uoh_size_limit = 0;
+#endif //USE_REGIONS
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+#ifdef FEATURE_RELOCATE_STEALING
+bool          gc_heap::relocate_stealing_p = false;
+#endif //FEATURE_RELOCATE_STEALING
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2957,9 +3129,9 @@ BOOL        gc_heap::heap_analyze_enabled = FALSE;
 
 #ifndef MULTIPLE_HEAPS
 
-alloc_list gc_heap::gen2_alloc_list[NUM_GEN2_ALIST - 1];
-alloc_list gc_heap::loh_alloc_list [NUM_LOH_ALIST - 1];
-alloc_list gc_heap::poh_alloc_list [NUM_POH_ALIST - 1];
+alloc_list gc_heap::gen2_alloc_list[NUM_GEN2_SFIT_ALIST - 1];
+alloc_list gc_heap::loh_alloc_list [NUM_LOH_SFIT_ALIST - 1];
+alloc_list gc_heap::poh_alloc_list [NUM_POH_SFIT_ALIST - 1];
 
 #ifdef DOUBLY_LINKED_FL
 // size we removed with no undo; only for recording purpose
@@ -2968,7 +3140,7 @@ size_t gc_heap::saved_pinned_plug_index = INVALID_SAVED_PINNED_PLUG_INDEX;
 #endif //DOUBLY_LINKED_FL
 
 #ifdef FEATURE_EVENT_TRACE
-etw_bucket_info gc_heap::bucket_info[NUM_GEN2_ALIST];
+etw_bucket_info gc_heap::bucket_info[NUM_GEN2_SFIT_ALIST];
 #endif //FEATURE_EVENT_TRACE
 
 dynamic_data gc_heap::dynamic_data_table [total_generation_count];
@@ -3290,7 +3462,121 @@ void gc_heap::fire_pevents()
                    (void *)loh_compact_info);
     }
 #endif //FEATURE_LOH_COMPACTION
+
+    if (!settings.concurrent && EVENT_ENABLED (GCPerHeapPhaseTimes))
+    {
+#ifdef MULTIPLE_HEAPS
+        for (int i = 0; i < gc_heap::n_heaps; i++)
+        {
+            gc_heap* hp = gc_heap::g_heaps[i];
+#else //MULTIPLE_HEAPS
+        {
+            gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+            for (int phase = 0; phase < max_heap_phase_time_type; phase++)
+            {
+                heap_phase_time_info[hp->heap_number].times[phase] = limit_time_to_uint32 (hp->phase_times[phase]);
+            }
+        }
+
+        FIRE_EVENT(GCPerHeapPhaseTimes,
+                   (uint16_t)get_num_heaps(),
+                   (uint32_t)(sizeof (etw_heap_phase_time_info)),
+                   (void *)heap_phase_time_info);
+    }
+#endif //FEATURE_EVENT_TRACE
+}
+
+#ifdef USE_REGIONS
+void gc_heap::walk_region_shape_list (heap_segment* region, uint16_t heap, uint8_t gen_num, size_t max_regions,
+                                      region_shape_fn fn, void* context)
+{
+    // max_regions only matters when we are racing with a BGC that moves regions between lists.
+    for (size_t i = 0; (region != nullptr) && (i < max_regions); i++)
+    {
+        gc_region_shape shape;
+        shape.start = heap_segment_mem (region);
+        shape.reserved = heap_segment_reserved (region) - heap_segment_mem (region);
+        shape.committed = heap_segment_committed (region) - heap_segment_mem (region);
+        shape.allocated = heap_segment_allocated (region) - heap_segment_mem (region);
+        shape.survived = heap_segment_survived (region);
+        shape.pinned_survived = (size_t)heap_segment_pinned_survived (region);
+        shape.free_list = heap_segment_free_list_size (region);
+        shape.free_obj = heap_segment_free_obj_size (region);
+        shape.heap = heap;
+        shape.generation = gen_num;
+        fn (shape, context);
+
+        region = heap_segment_next (region);
+    }
+}
+
+// Calls fn with the shape of each region in the generations and free lists of each heap, then of the global
+// free and decommit lists. Only the region metadata is read so this is also cheap to do outside of a GC.
+void gc_heap::walk_region_shapes (region_shape_fn fn, void* context)
+{
+    size_t max_regions = (size_t)(g_gc_highest_address - g_gc_lowest_address) >> min_segment_size_shr;
+
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+        int i = 0;
+#endif //MULTIPLE_HEAPS
+        for (int gen_idx = 0; gen_idx < total_generation_count; gen_idx++)
+        {
+            heap_segment* region = heap_segment_rw (generation_start_segment (hp->generation_of (gen_idx)));
+            walk_region_shape_list (region, (uint16_t)i, (uint8_t)gen_idx, max_regions, fn, context);
+        }
+
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            walk_region_shape_list (hp->free_regions[kind].get_first_free_region(), (uint16_t)i,
+                                    GC_REGION_SHAPE_FREE, max_regions, fn, context);
+        }
+    }
+
+    for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+    {
+        walk_region_shape_list (global_regions_to_decommit[kind].get_first_free_region(), GC_REGION_SHAPE_NO_HEAP,
+                                GC_REGION_SHAPE_FREE, max_regions, fn, context);
+    }
+
+    walk_region_shape_list (global_free_huge_regions.get_first_free_region(), GC_REGION_SHAPE_NO_HEAP,
+                            GC_REGION_SHAPE_FREE, max_regions, fn, context);
+}
+
+#ifdef FEATURE_EVENT_TRACE
+static void fire_region_shape_event (const gc_region_shape& shape, void* context)
+{
+    GCEventFireRegionShape_V1 (
+        (uint64_t)*(size_t*)context,
+        (uint64_t)shape.start,
+        (uint64_t)shape.reserved,
+        (uint64_t)shape.committed,
+        (uint64_t)shape.allocated,
+        (uint64_t)shape.survived,
+        (uint64_t)shape.pinned_survived,
+        (uint64_t)shape.free_list,
+        (uint64_t)shape.free_obj,
+        shape.heap,
+        shape.generation);
+}
 #endif //FEATURE_EVENT_TRACE
+#endif //USE_REGIONS
+
+// This fires one RegionShape event per region at the end of each blocking GC, while the EE is still suspended.
+void gc_heap::fire_region_shape_events()
+{
+#if defined(FEATURE_EVENT_TRACE) && defined(USE_REGIONS)
+    if (!EVENT_ENABLED (RegionShape_V1)) return;
+
+    size_t gc_index = (size_t)settings.gc_index;
+    walk_region_shapes (fire_region_shape_event, &gc_index);
+#endif //FEATURE_EVENT_TRACE && USE_REGIONS
 }
 
 // This fires the amount of total committed in use, in free and on the decommit list.
@@ -3337,6 +3623,35 @@ void gc_heap::fire_committed_usage_event()
 #endif //FEATURE_EVENT_TRACE
 }
 
+// This fires how many times allocating threads found the SOH and UOH more space locks taken
+// since the last GC, summed over all heaps.
+void gc_heap::fire_msl_contention_event()
+{
+#ifdef FEATURE_EVENT_TRACE
+    if (!EVENT_ENABLED (MoreSpaceLockContention_V1)) return;
+
+    uint32_t soh_msl_contention_count = 0;
+    uint32_t uoh_msl_contention_count = 0;
+
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        soh_msl_contention_count += Interlocked::Exchange (&hp->more_space_lock_soh.msl_contention_count, 0u);
+        uoh_msl_contention_count += Interlocked::Exchange (&hp->more_space_lock_uoh.msl_contention_count, 0u);
+    }
+
+    GCEventFireMoreSpaceLockContention_V1 (
+        (uint64_t)settings.gc_index,
+        soh_msl_contention_count,
+        uoh_msl_contention_count);
+#endif //FEATURE_EVENT_TRACE
+}
+
 inline BOOL
 gc_heap::dt_low_ephemeral_space_p (gc_tuning_point tp)
 {
@@ -3567,6 +3882,12 @@ gc_heap::dt_high_memory_load_p()
     return ((settings.entry_memory_load >= high_memory_load_th) || g_low_memory_status);
 }
 
+inline bool
+gc_heap::memory_pressure_high_p()
+{
+    return ((memory_pressure_th != 0) && (settings.entry_memory_pressure >= memory_pressure_th));
+}
+
 inline BOOL
 in_range_for_segment(uint8_t* add, heap_segment* seg)
 {
@@ -6284,6 +6605,14 @@ gc_heap::get_uoh_segment (int gen_number, size_t size, BOOL* did_full_compact_gc
 #endif //MULTIPLE_HEAPS
                                             );
 
+#ifdef USE_REGIONS
+    // Holding gc_lock means no GC can start before the region is tagged.
+    if (res && (gen_number == loh_generation) && should_make_young_uoh_region_p (res))
+    {
+        make_young_uoh_region (res);
+    }
+#endif //USE_REGIONS
+
     dprintf (SPINLOCK_LOG, ("[%d]Seg: A Lgc", heap_number));
     leave_spin_lock (&gc_heap::gc_lock);
     *msl_status = enter_spin_lock_msl (&more_space_lock_uoh);
@@ -7848,6 +8177,7 @@ void gc_mechanisms::init_mechanisms()
     entry_memory_load = 0;
     entry_available_physical_mem = 0;
     exit_memory_load = 0;
+    entry_memory_pressure = 0;
 
 #ifdef STRESS_HEAP
     stress_induced = FALSE;
@@ -10494,8 +10824,20 @@ private:
 #endif //defined(USE_INTROSORT) || defined(USE_VXSORT)
 
 #ifdef USE_VXSORT
+// Whether the vectorized sort can be used at all - this decides how big
+// we allow the mark list to grow.
+static bool is_vxsort_supported()
+{
+#if defined(TARGET_AMD64)
+    return IsSupportedInstructionSet (InstructionSet::AVX2);
+#elif defined(TARGET_ARM64)
+    return IsSupportedInstructionSet (InstructionSet::NEON);
+#endif
+}
+
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
+#if defined(TARGET_AMD64)
     // above this threshold, using AVX2 for sorting will likely pay off
     // despite possible downclocking on some devices
     const ptrdiff_t AVX2_THRESHOLD_SIZE = 8 * 1024;
@@ -10503,10 +10845,17 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // above this threshold, using AVX512F for sorting will likely pay off
     // despite possible downclocking on current devices
     const ptrdiff_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
+#elif defined(TARGET_ARM64)
+    // NEON vectors only hold 2 pointers so the partitioning gain per
+    // iteration is smaller than with AVX2, but there is no downclocking
+    // to pay for either.
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 4 * 1024;
+#endif
 
     if (item_count <= 1)
         return;
 
+#if defined(TARGET_AMD64)
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -10521,6 +10870,13 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
             do_vxsort_avx2 (item_array, &item_array[item_count - 1], range_low, range_high);
         }
     }
+#elif defined(TARGET_ARM64)
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+#endif
     else
     {
         dprintf (3, ("Sorting mark lists"));
@@ -11163,10 +11519,10 @@ void gc_heap::grow_mark_list ()
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = is_vxsort_supported() ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = is_vxsort_supported() ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -12071,6 +12427,19 @@ heap_segment* gc_heap::get_free_region (int gen_number, size_t size)
             region_start, region_end,
             gen_number));
 
+#ifdef MULTIPLE_HEAPS
+        if (GCToOSInterface::CanEnableGCNumaAware())
+        {
+            uint16_t heap_numa_node = heap_select::find_numa_node_from_heap_no (heap_number);
+            if (heap_segment_numa_node (region) != heap_numa_node)
+            {
+                num_remote_regions++;
+                dprintf (REGIONS_LOG, ("h%d (node %d) got region %p committed on node %d, %zd remote regions so far",
+                    heap_number, heap_numa_node, region_start, heap_segment_numa_node (region), num_remote_regions));
+            }
+        }
+#endif //MULTIPLE_HEAPS
+
         // Something is wrong if a free region is already filled
         assert (heap_segment_allocated(region) == heap_segment_mem (region));
     }
@@ -12436,6 +12805,9 @@ heap_segment* gc_heap::make_heap_segment (uint8_t* new_pages, size_t size, gc_he
     heap_segment_used (new_segment) = start;
     heap_segment_reserved (new_segment) = new_pages + size;
     heap_segment_committed (new_segment) = new_pages + initial_commit;
+#if defined(USE_REGIONS) && defined(MULTIPLE_HEAPS)
+    heap_segment_numa_node (new_segment) = heap_select::find_numa_node_from_heap_no (h_number);
+#endif //USE_REGIONS && MULTIPLE_HEAPS
 
     init_heap_segment (new_segment, hp
 #ifdef USE_REGIONS
@@ -12603,6 +12975,13 @@ size_t gc_heap::decommit_heap_segment_pages_worker (heap_segment* seg,
 {
     assert (!use_large_pages_p);
     uint8_t* page_start = align_on_page (new_committed);
+#ifdef USE_REGIONS
+    if (use_thp_p && (heap_segment_gen_num (seg) <= soh_gen1))
+    {
+        // don't split a huge page by decommitting only part of it
+        page_start = align_on_thp_page (page_start);
+    }
+#endif //USE_REGIONS
     ptrdiff_t size = heap_segment_committed (seg) - page_start;
     if (size > 0)
     {
@@ -12840,10 +13219,33 @@ static void trim_region_list (region_free_list* dest, region_free_list* src, siz
     }
 }
 
-// add regions from src to dest, trying to grow the size of dest to target_count
-static int64_t grow_region_list (region_free_list* dest, region_free_list* src, size_t target_count)
+// add regions from src to dest, trying to grow the size of dest to target_count.
+// If numa_node is specified, regions committed on that node are taken first.
+static int64_t grow_region_list (region_free_list* dest, region_free_list* src, size_t target_count, uint16_t numa_node = NUMA_NODE_UNDEFINED)
 {
     int64_t added_count = 0;
+#ifdef MULTIPLE_HEAPS
+    if (numa_node != NUMA_NODE_UNDEFINED)
+    {
+        heap_segment* next_region = nullptr;
+        for (heap_segment* region = src->get_first_free_region();
+             (region != nullptr) && (dest->get_num_free_regions() < target_count);
+             region = next_region)
+        {
+            next_region = heap_segment_next (region);
+            if (heap_segment_numa_node (region) == numa_node)
+            {
+                added_count++;
+
+                region_free_list::unlink_region (region);
+                dest->add_region_front (region);
+            }
+        }
+    }
+#else //MULTIPLE_HEAPS
+    UNREFERENCED_PARAMETER(numa_node);
+#endif //MULTIPLE_HEAPS
+
     while (dest->get_num_free_regions() < target_count)
     {
         if (src->get_num_free_regions() == 0)
@@ -13690,7 +14092,14 @@ void gc_heap::distribute_free_regions()
             // second pass: fill all the regions having less than budget
             if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[kind][i])
             {
-                int64_t num_added_regions = grow_region_list (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[kind][i]);
+                uint16_t numa_node = NUMA_NODE_UNDEFINED;
+#ifdef MULTIPLE_HEAPS
+                if (GCToOSInterface::CanEnableGCNumaAware())
+                {
+                    numa_node = heap_select::find_numa_node_from_heap_no (i);
+                }
+#endif //MULTIPLE_HEAPS
+                int64_t num_added_regions = grow_region_list (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[kind][i], numa_node);
                 dprintf (REGIONS_LOG, ("added %zd %s regions to heap %d - now has %zd, budget is %zd",
                     (size_t)num_added_regions,
                     free_region_kind_name[kind],
@@ -13895,6 +14304,18 @@ void gc_heap::decide_on_decommit_strategy(bool joined_last_gc_before_oom)
         return;
     }
 
+    if (memory_pressure_high_p())
+    {
+        // The memory load may still look fine but tasks in the container are stalling on
+        // memory - don't wait for the gradual decommit to catch up.
+        dprintf (REGIONS_LOG, ("memory pressure %d - decommitting everything", settings.entry_memory_pressure));
+
+        while (decommit_step(DECOMMIT_TIME_STEP_MILLISECONDS))
+        {
+        }
+        return;
+    }
+
     ptrdiff_t size_to_decommit_for_heap_hard_limit = 0;
     if (heap_hard_limit)
     {
@@ -13941,6 +14362,12 @@ void gc_heap::decide_on_decommit_strategy(bool joined_last_gc_before_oom)
     // we don't want to decommit fractions of regions here
     dynamic_data* dd0 = dynamic_data_of (0);
     size_t ephemeral_elapsed = (size_t)((dd_time_clock (dd0) - gc_last_ephemeral_decommit_time) / 1000);
+    if (memory_pressure_high_p())
+    {
+        // under memory pressure we decommit as much as we would after idling for the max elapsed time
+        dprintf (REGIONS_LOG, ("memory pressure %d - decommitting max", settings.entry_memory_pressure));
+        ephemeral_elapsed = (size_t)(10*1000);
+    }
     if (ephemeral_elapsed >= DECOMMIT_TIME_STEP_MILLISECONDS)
     {
         gc_last_ephemeral_decommit_time = dd_time_clock (dd0);
@@ -14117,6 +14544,77 @@ void gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 }
 
+// Like get_write_watch_for_gc_heap but contiguous dirty pages are returned as
+// [start, end) pairs so the number of entries scales with the dirtied ranges
+// instead of the dirtied pages. *dirty_range_count_ref is in ranges and
+// dirty_ranges needs room for twice that many entries.
+// static
+void gc_heap::get_write_watch_ranges_for_gc_heap(bool reset, void *base_address, size_t region_size,
+                                                 void** dirty_ranges, uintptr_t* dirty_range_count_ref,
+                                                 bool is_runtime_suspended)
+{
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    SoftwareWriteWatch::GetDirtyRanges(base_address, region_size, dirty_ranges, dirty_range_count_ref,
+                                       reset, is_runtime_suspended);
+#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    // The OS only gives us pages, coalesce them as we go. Each page can start
+    // at most one new range and the pages we get back may have been reset, so
+    // only ask for as many pages as we still have room for.
+    uintptr_t range_capacity = *dirty_range_count_ref;
+    uintptr_t range_count = 0;
+    uint8_t* range_start = 0;
+    uint8_t* range_end = 0;
+    uint8_t* next_address = (uint8_t*)base_address;
+    uint8_t* region_end = next_address + region_size;
+    void* dirty_pages[array_size];
+
+    while (next_address < region_end)
+    {
+        uintptr_t room = range_capacity - range_count - ((range_start != 0) ? 1 : 0);
+        if (room == 0)
+        {
+            break;
+        }
+
+        uintptr_t requested_count = min (room, (uintptr_t)array_size);
+        uintptr_t page_count = requested_count;
+        get_write_watch_for_gc_heap (reset, next_address, (region_end - next_address),
+                                     dirty_pages, &page_count, is_runtime_suspended);
+
+        for (uintptr_t i = 0; i < page_count; i++)
+        {
+            uint8_t* page = (uint8_t*)dirty_pages[i];
+            if (page != range_end)
+            {
+                if (range_start != 0)
+                {
+                    dirty_ranges[range_count * 2] = range_start;
+                    dirty_ranges[range_count * 2 + 1] = range_end;
+                    range_count++;
+                }
+                range_start = page;
+            }
+            range_end = page + WRITE_WATCH_UNIT_SIZE;
+        }
+
+        if (page_count < requested_count)
+        {
+            break;
+        }
+        next_address = range_end;
+    }
+
+    if (range_start != 0)
+    {
+        dirty_ranges[range_count * 2] = range_start;
+        dirty_ranges[range_count * 2 + 1] = range_end;
+        range_count++;
+    }
+
+    *dirty_range_count_ref = range_count;
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+}
+
 const size_t ww_reset_quantum = 128*1024*1024;
 
 inline
@@ -14936,6 +15434,12 @@ gc_heap::init_semi_shared()
         goto cleanup;
     }
 #endif //FEATURE_LOH_COMPACTION
+
+    heap_phase_time_info = new (nothrow) etw_heap_phase_time_info [get_num_heaps()];
+    if (!heap_phase_time_info)
+    {
+        goto cleanup;
+    }
 #endif //FEATURE_EVENT_TRACE
 
     reset_mm_p = TRUE;
@@ -15228,6 +15732,10 @@ gc_heap::init_gc_heap (int h_number)
 
     loh_alloc_since_cg = 0;
 
+#ifdef USE_REGIONS
+    young_uoh_size = 0;
+#endif //USE_REGIONS
+
 #ifndef USE_REGIONS
     new_heap_segment = NULL;
 
@@ -15440,9 +15948,31 @@ gc_heap::init_gc_heap (int h_number)
 
 #endif //MULTIPLE_HEAPS
 
-    generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_ALIST, BASE_GEN2_ALIST_BITS, gen2_alloc_list, max_generation);
-    generation_of (loh_generation)->free_list_allocator = allocator(NUM_LOH_ALIST, BASE_LOH_ALIST_BITS, loh_alloc_list);
-    generation_of (poh_generation)->free_list_allocator = allocator(NUM_POH_ALIST, BASE_POH_ALIST_BITS, poh_alloc_list);
+    int sfit_gens = (int)GCConfig::GetGCSegregatedFitGens();
+    if (sfit_gens & (1 << max_generation))
+    {
+        generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_SFIT_ALIST, BASE_GEN2_ALIST_BITS, gen2_alloc_list, max_generation, SFIT_SIZE_CLASS_BITS);
+    }
+    else
+    {
+        generation_of (max_generation)->free_list_allocator = allocator(NUM_GEN2_ALIST, BASE_GEN2_ALIST_BITS, gen2_alloc_list, max_generation);
+    }
+    if (sfit_gens & (1 << loh_generation))
+    {
+        generation_of (loh_generation)->free_list_allocator = allocator(NUM_LOH_SFIT_ALIST, BASE_LOH_ALIST_BITS, loh_alloc_list, -1, SFIT_SIZE_CLASS_BITS);
+    }
+    else
+    {
+        generation_of (loh_generation)->free_list_allocator = allocator(NUM_LOH_ALIST, BASE_LOH_ALIST_BITS, loh_alloc_list);
+    }
+    if (sfit_gens & (1 << poh_generation))
+    {
+        generation_of (poh_generation)->free_list_allocator = allocator(NUM_POH_SFIT_ALIST, BASE_POH_ALIST_BITS, poh_alloc_list, -1, POH_SFIT_SIZE_CLASS_BITS);
+    }
+    else
+    {
+        generation_of (poh_generation)->free_list_allocator = allocator(NUM_POH_ALIST, BASE_POH_ALIST_BITS, poh_alloc_list);
+    }
 
     total_alloc_bytes_soh = 0;
     total_alloc_bytes_uoh = 0;
@@ -15477,6 +16007,9 @@ gc_heap::init_gc_heap (int h_number)
 #endif //BGC_SERVO_TUNING
     freeable_soh_segment = 0;
     gchist_index_per_heap = 0;
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+    num_remote_regions = 0;
+#endif //MULTIPLE_HEAPS && USE_REGIONS
     if (gc_can_use_concurrent)
     {
         uint8_t** b_arr = new (nothrow) (uint8_t * [MARK_STACK_INITIAL_LENGTH]);
@@ -15765,6 +16298,14 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
 
     size_t c_size = align_on_page ((size_t)(high_address - heap_segment_committed (seg)));
     c_size = max (c_size, commit_min_th);
+#ifdef USE_REGIONS
+    bool thp_region_p = use_thp_p && (heap_segment_gen_num (seg) <= soh_gen1);
+    if (thp_region_p)
+    {
+        // commit up to a huge page boundary so the OS can back the whole range with huge pages
+        c_size = align_on_thp_page (heap_segment_committed (seg) + c_size) - heap_segment_committed (seg);
+    }
+#endif //USE_REGIONS
     c_size = min (c_size, (size_t)(heap_segment_reserved (seg) - heap_segment_committed (seg)));
 
     if (c_size == 0)
@@ -15777,6 +16318,19 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
     bool ret = virtual_commit (heap_segment_committed (seg), c_size, heap_segment_oh (seg), heap_number, hard_limit_exceeded_p);
     if (ret)
     {
+#ifdef USE_REGIONS
+        if (thp_region_p)
+        {
+            // include the part of the huge page that was already committed - decommitting
+            // recreates the mapping so the advice needs to be given again on every commit.
+            uint8_t* advise_start = max (align_lower_thp_page (heap_segment_committed (seg)), get_region_start (seg));
+            uint8_t* advise_end = heap_segment_committed (seg) + c_size;
+            if (!GCToOSInterface::VirtualAdviseHugePages (advise_start, (advise_end - advise_start)))
+            {
+                dprintf (REGIONS_LOG, ("h%d failed to advise huge pages for [%p, %p)", heap_number, advise_start, advise_end));
+            }
+        }
+#endif //USE_REGIONS
         heap_segment_committed (seg) += c_size;
 
         STRESS_LOG1(LF_GC, LL_INFO10000, "New commit: %zx\n",
@@ -16141,13 +16695,16 @@ void gc_heap::check_batch_mark_array_bits (uint8_t* start, uint8_t* end)
 }
 #endif //VERIFY_HEAP && BACKGROUND_GC
 
-allocator::allocator (unsigned int num_b, int fbb, alloc_list* b, int gen)
+allocator::allocator (unsigned int num_b, int fbb, alloc_list* b, int gen, int scb)
 {
     assert (num_b < MAX_BUCKET_COUNT);
+    assert (num_b <= sizeof (non_empty_buckets) * 8);
     num_buckets = num_b;
     first_bucket_bits = fbb;
+    size_class_bits = scb;
     buckets = b;
     gen_number = gen;
+    non_empty_buckets = 0;
 }
 
 alloc_list& allocator::alloc_list_of (unsigned int bn)
@@ -16349,6 +16906,7 @@ int allocator::thread_item_front_added (uint8_t* item, size_t size)
 {
     unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
+    set_bucket_non_empty (a_l_number);
 
     free_list_slot (item) = al->added_alloc_list_head();
     free_list_prev (item) = 0;
@@ -16568,6 +17126,8 @@ void allocator::merge_items (gc_heap* current_heap, int to_num_heaps, int from_n
 
             if (head_other_heap)
             {
+                set_bucket_non_empty (i);
+
 #ifdef DOUBLY_LINKED_FL
                 if (is_doubly_linked_p())
                 {
@@ -16601,6 +17161,8 @@ void allocator::clear()
         alloc_list_head_of (i) = 0;
         alloc_list_tail_of (i) = 0;
     }
+
+    non_empty_buckets = 0;
 }
 
 //always thread to the end.
@@ -16608,6 +17170,7 @@ void allocator::thread_item (uint8_t* item, size_t size)
 {
     unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
+    set_bucket_non_empty (a_l_number);
     uint8_t*& head = al->alloc_list_head();
     uint8_t*& tail = al->alloc_list_tail();
 
@@ -16663,6 +17226,7 @@ void allocator::thread_item_front (uint8_t* item, size_t size)
 {
     unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
+    set_bucket_non_empty (a_l_number);
 
     if (al->alloc_list_head() == 0)
     {
@@ -16740,6 +17304,8 @@ void allocator::copy_to_alloc_list (alloc_list* toalist)
 void allocator::copy_from_alloc_list (alloc_list* fromalist)
 {
     BOOL repair_list = !discard_if_no_fit_p ();
+    // the lists we are restoring may have had items in buckets we found empty since they were saved
+    set_all_buckets_non_empty();
 #ifdef DOUBLY_LINKED_FL
     BOOL bgc_repair_p = FALSE;
     if (gen_number == max_generation)
@@ -16903,6 +17469,7 @@ void allocator::commit_alloc_list_changes()
 
                 if (head_added)
                 {
+                    set_bucket_non_empty (i);
                     alloc_list_head_of (i) = head_added;
                     uint8_t* final_head = alloc_list_head_of (i);
 
@@ -16940,6 +17507,7 @@ void allocator::thread_sip_fl (heap_segment* region)
         alloc_list* al = &alloc_list_of (0);
         uint8_t*& head = al->alloc_list_head();
         uint8_t*& tail = al->alloc_list_tail();
+        set_bucket_non_empty (0);
 
         if (tail == 0)
         {
@@ -17811,7 +18379,11 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
     int cookie = -1;
 #endif //BACKGROUND_GC
 
-    for (unsigned int a_l_idx = allocator->first_suitable_bucket(size); a_l_idx < allocator->number_of_buckets(); a_l_idx++)
+    // With segregated fit the items in the first suitable bucket are all close to the size
+    // we want, so taking the first one that fits there is a best fit within a size class.
+    for (unsigned int a_l_idx = allocator->next_non_empty_bucket (allocator->first_suitable_bucket(size));
+         a_l_idx < allocator->number_of_buckets();
+         a_l_idx = allocator->next_non_empty_bucket (a_l_idx + 1))
     {
         uint8_t* free_list = allocator->alloc_list_head_of (a_l_idx);
         uint8_t* prev_free_item = 0;
@@ -19719,6 +20291,30 @@ try_again:
         goto try_again;
     }
 
+    // Medium sized UOH allocations (e.g. rented buffers) can be frequent enough that threads
+    // pile up on the more space lock of the heap we picked. If that lock is taken, use another
+    // heap on the same node whose lock isn't, as long as it still has budget for this allocation.
+    if ((alloc_size <= UOH_MSL_BALANCE_MAX_SIZE) &&
+        (VolatileLoad (&max_hp->more_space_lock_uoh.lock) != lock_free))
+    {
+        int node_start, node_end;
+        heap_select::get_heap_range_for_heap (max_hp->heap_number, &node_start, &node_end);
+        int node_heap_count = node_end - node_start;
+
+        // start from the heap after the one we picked so threads don't all move to the same heap
+        for (int i = 1; i < node_heap_count; i++)
+        {
+            gc_heap* hp = GCHeap::GetHeap (node_start + ((max_hp->heap_number - node_start + i) % node_heap_count))->pGenGCHeap;
+            if ((VolatileLoad (&hp->more_space_lock_uoh.lock) == lock_free) &&
+                (hp->get_balance_heaps_uoh_effective_budget (generation_num) >= (ptrdiff_t)alloc_size))
+            {
+                dprintf (3, ("uoh msl taken on h%d, using h%d", max_hp->heap_number, hp->heap_number));
+                max_hp = hp;
+                break;
+            }
+        }
+    }
+
     if (max_hp != home_hp)
     {
         dprintf (3, ("uoh: %d(%zd)->%d(%zd)",
@@ -20133,8 +20729,15 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
     if (! (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, generation_allocation_pointer (gen),
                        generation_allocation_limit (gen), old_loc, USE_PADDING_TAIL | pad_in_front)))
     {
-        for (unsigned int a_l_idx = gen_allocator->first_suitable_bucket(real_size * 2);
-             a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+        // With segregated fit every item from the next size class up is big enough; otherwise start from the
+        // bucket of twice the size so we rarely need to look at more than one item.
+        unsigned int first_a_l_idx = (gen_allocator->segregated_fit_p() ?
+            min ((gen_allocator->first_suitable_bucket (real_size) + 1), (gen_allocator->number_of_buckets() - 1)) :
+            gen_allocator->first_suitable_bucket (real_size * 2));
+
+        for (unsigned int a_l_idx = gen_allocator->next_non_empty_bucket (first_a_l_idx);
+             a_l_idx < gen_allocator->number_of_buckets();
+             a_l_idx = gen_allocator->next_non_empty_bucket (a_l_idx + 1))
         {
             uint8_t* free_list = 0;
             uint8_t* prev_free_item = 0;
@@ -20265,6 +20868,15 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
                 }
                 free_list = free_list_slot (free_list);
             }
+
+            if (gen_allocator->alloc_list_head_of (a_l_idx) == 0
+#ifdef DOUBLY_LINKED_FL
+                && (!try_added_list_p || (gen_allocator->added_alloc_list_head_of (a_l_idx) == 0))
+#endif //DOUBLY_LINKED_FL
+                )
+            {
+                gen_allocator->set_bucket_empty (a_l_idx);
+            }
         }
 #ifdef USE_REGIONS
         // We don't want to always go back to the first region since there might be many.
@@ -22120,6 +22732,30 @@ int gc_heap::generation_to_condemn (int n_initial,
         memory_load = max (memory_load, va_memory_load);
 #endif //USE_REGIONS
 
+        if (memory_pressure_th != 0)
+        {
+            // In a container the kernel starts reclaiming (and tasks start stalling on memory) well
+            // before the memory load we compute gets high, and the OOM killer can kick in before it
+            // ever does. So when the stall percentage goes over the threshold we act as if we were
+            // in high memory load, and in very high memory load when it's twice the threshold.
+            uint32_t memory_pressure = 0;
+            if (GCToOSInterface::GetMemoryPressure (&memory_pressure))
+            {
+                local_settings->entry_memory_pressure = memory_pressure;
+                if (memory_pressure >= memory_pressure_th)
+                {
+                    uint32_t pressure_memory_load = ((memory_pressure >= (2 * memory_pressure_th)) ?
+                                                     v_high_memory_load_th : high_memory_load_th);
+                    if (heap_number == 0)
+                    {
+                        dprintf (GTC_LOG, ("memory pressure %d (th %d), ML %d->%d", memory_pressure, memory_pressure_th,
+                            memory_load, max (memory_load, pressure_memory_load)));
+                    }
+                    memory_load = max (memory_load, pressure_memory_load);
+                }
+            }
+        }
+
         // Need to get it early enough for all heaps to use.
         local_settings->entry_available_physical_mem = available_physical;
         local_settings->entry_memory_load = memory_load;
@@ -22699,6 +23335,15 @@ void gc_heap::gc1()
         }
 #endif //USE_REGIONS
 
+#ifdef USE_REGIONS
+        // A full GC reclaims young LOH regions like any other LOH region. A BGC runs alongside
+        // ephemeral GCs that would sweep them, so they need to be old before it starts marking.
+        if (n == max_generation)
+        {
+            promote_young_uoh_regions();
+        }
+#endif //USE_REGIONS
+
 #ifdef BACKGROUND_GC
         if (settings.concurrent)
         {
@@ -22720,12 +23365,21 @@ void gc_heap::gc1()
         else
 #endif //BACKGROUND_GC
         {
+            memset (phase_times, 0, sizeof (phase_times));
+
+            uint64_t phase_start = GetHighPrecisionTimeStamp();
             mark_phase (n);
+            uint64_t phase_end = GetHighPrecisionTimeStamp();
+            phase_times[heap_phase_mark] = phase_end - phase_start;
 
             check_gen0_bricks();
 
             GCScan::GcRuntimeStructuresValid (FALSE);
+            phase_start = GetHighPrecisionTimeStamp();
             plan_phase (n);
+            phase_end = GetHighPrecisionTimeStamp();
+            phase_times[heap_phase_plan] = (phase_end - phase_start) -
+                (phase_times[heap_phase_relocate] + phase_times[heap_phase_compact] + phase_times[heap_phase_sweep]);
             GCScan::GcRuntimeStructuresValid (TRUE);
 
             check_gen0_bricks();
@@ -25543,7 +26197,7 @@ void gc_heap::decommission_heap()
 
     freeable_uoh_segment                = DECOMMISSIONED_REGION_P;
 
-    memset ((void *)gen2_alloc_list, DECOMMISSIONED_INT, sizeof(gen2_alloc_list[0])*(NUM_GEN2_ALIST - 1));
+    memset ((void *)gen2_alloc_list, DECOMMISSIONED_INT, sizeof(gen2_alloc_list[0])*(NUM_GEN2_SFIT_ALIST - 1));
 
 #ifdef BACKGROUND_GC
     // keep these fields
@@ -26022,7 +26676,11 @@ void gc_heap::calculate_new_heap_count ()
     float target_tcp = dynamic_heap_count_data.target_tcp;
     float target_gen2_tcp = dynamic_heap_count_data.target_gen2_tcp;
 
-    if (process_eph_samples_p)
+    if (process_eph_samples_p && (dynamic_heap_count_data.target_pause_ms > 0.0))
+    {
+        new_n_heaps = calculate_new_heap_count_for_target_pause (current_gc_index, actual_n_max_heaps);
+    }
+    else if (process_eph_samples_p)
     {
         dynamic_heap_count_data.add_to_recorded_tcp (median_throughput_cost_percent);
 
@@ -26232,6 +26890,82 @@ void gc_heap::calculate_new_heap_count ()
     }
 }
 
+// With a pause target we grow the heap count when the ephemeral GC pauses are above the target, as
+// each heap then has less to mark and compact, and shrink it when there's enough headroom below it.
+// The total gen0 budget DATAS computes still bounds how many heaps we can have.
+int gc_heap::calculate_new_heap_count_for_target_pause (size_t current_gc_index, int actual_n_max_heaps)
+{
+    float target_pause_ms = dynamic_heap_count_data.target_pause_ms;
+    float pauses_ms[dynamic_heap_count_data_t::sample_size];
+    for (int i = 0; i < dynamic_heap_count_data_t::sample_size; i++)
+    {
+        pauses_ms[i] = (float)dynamic_heap_count_data.samples[i].gc_pause_time / 1000.0f;
+    }
+    float median_pause_ms = median_of_3 (pauses_ms[0], pauses_ms[1], pauses_ms[2]);
+
+    size_t total_soh_stable_size = get_total_soh_stable_size();
+    size_t total_bcd = dynamic_heap_count_data.compute_total_gen0_budget (total_soh_stable_size);
+    int max_heap_count_datas = (int)(total_bcd / dynamic_heap_count_data.min_gen0_new_allocation);
+    int min_heap_count_datas = (int)(total_bcd / dynamic_heap_count_data.max_gen0_new_allocation);
+    int max_heap_count_growth = min (dynamic_heap_count_data.get_max_growth (n_heaps),
+                                     min (max ((max_heap_count_datas - n_heaps), 0), (actual_n_max_heaps - n_heaps)));
+
+    float distance = median_pause_ms - target_pause_ms;
+    float diff_pct = distance / target_pause_ms;
+    int change_int = 0;
+
+    if (diff_pct > 0.0)
+    {
+        change_int = max (1, (int)round (diff_pct / 1.5 * n_heaps));
+        change_int = min (change_int, max_heap_count_growth);
+    }
+    else if (median_pause_ms < (target_pause_ms * dynamic_heap_count_data.target_pause_headroom))
+    {
+        // Different factor for above and below target to avoid oscillation.
+        change_int = (int)round (diff_pct / 3.0 * n_heaps);
+        int min_n_heaps = max (1, min_heap_count_datas);
+        if ((n_heaps + change_int) < min_n_heaps)
+        {
+            change_int = min (0, (min_n_heaps - n_heaps));
+        }
+    }
+
+    dynamic_heap_count_data_t::adjustment* adj = dynamic_heap_count_data.get_last_adjustment();
+    size_t num_gcs_since_last_change = (adj->gc_index ? (current_gc_index - adj->gc_index) : current_gc_index);
+    bool change_too_soon_p = false;
+
+    // Give the last change a chance to show up in the samples before we change again.
+    if ((change_int != 0) && adj->gc_index && (num_gcs_since_last_change <= (size_t)(2 * dynamic_heap_count_data_t::sample_size)))
+    {
+        change_too_soon_p = true;
+        change_int = 0;
+    }
+
+    dprintf (6666, ("median pause %.3fms - target %.3fms = %.3f (%.3f), max hc allowed by datas %d | min %d, max growth %d, %Id GCs since last change -> %d heaps%s",
+        median_pause_ms, target_pause_ms, distance, diff_pct, max_heap_count_datas, min_heap_count_datas, max_heap_count_growth,
+        num_gcs_since_last_change, change_int, (change_too_soon_p ? " (too soon)" : "")));
+
+    if (change_int != 0)
+    {
+        dynamic_heap_count_data.record_adjustment (dynamic_heap_count_data_t::adjust_metric::adjust_hc, distance, change_int, current_gc_index);
+    }
+
+#ifdef FEATURE_EVENT_TRACE
+    GCEventFireSizeAdaptationPauseTuning_V1 (
+        (uint16_t)(n_heaps + change_int),
+        (uint16_t)max_heap_count_datas,
+        (uint16_t)min_heap_count_datas,
+        (uint64_t)current_gc_index,
+        (uint64_t)total_soh_stable_size,
+        (float)median_pause_ms,
+        (float)target_pause_ms,
+        (uint32_t)num_gcs_since_last_change,
+        (uint8_t)change_too_soon_p);
+#endif //FEATURE_EVENT_TRACE
+
+    return (n_heaps + change_int);
+}
+
 void gc_heap::check_heap_count ()
 {
     dynamic_heap_count_data.new_n_heaps = dynamic_heap_count_data.heap_count_to_change_to;
@@ -27342,6 +28076,23 @@ BOOL gc_heap::background_mark (uint8_t* o, uint8_t* low, uint8_t* high)
     return marked;
 }
 
+// whether background_mark would consider marking o
+inline
+bool gc_heap::background_object_in_range_p (uint8_t* o)
+{
+    if ((o >= background_saved_lowest_address) && (o < background_saved_highest_address))
+        return true;
+#ifdef MULTIPLE_HEAPS
+    if (o)
+    {
+        gc_heap* hp = heap_of (o);
+        assert (hp);
+        return ((o >= hp->background_saved_lowest_address) && (o < hp->background_saved_highest_address));
+    }
+#endif //MULTIPLE_HEAPS
+    return false;
+}
+
 #endif //BACKGROUND_GC
 
 #define new_start() {if (ppstop <= start) {break;} else {parm = start}}
@@ -27667,27 +28418,43 @@ BOOL ref_p (uint8_t* r)
     return (straight_ref_p (r) || partial_object_p (r));
 }
 
+#ifdef MARK_PHASE_PREFETCH
+size_t mark_queue_t::slot_count = mark_queue_t::default_slot_count;
+
+// This must be called before any marking happens.
+void mark_queue_t::set_slot_count (size_t count)
+{
+    if (count == 0)
+        return;
+
+    size_t rounded_count = 1;
+    while ((rounded_count < count) && (rounded_count < max_slot_count))
+    {
+        rounded_count *= 2;
+    }
+    slot_count = rounded_count;
+}
+#endif //MARK_PHASE_PREFETCH
+
 mark_queue_t::mark_queue_t()
 #ifdef MARK_PHASE_PREFETCH
     : curr_slot_index(0)
 #endif //MARK_PHASE_PREFETCH
 {
 #ifdef MARK_PHASE_PREFETCH
-    for (size_t i = 0; i < slot_count; i++)
+    for (size_t i = 0; i < max_slot_count; i++)
     {
         slot_table[i] = nullptr;
     }
 #endif //MARK_PHASE_PREFETCH
 }
 
-// place an object in the mark queue
-// returns a *different* object or nullptr
-// if a non-null object is returned, that object is newly marked
-// object o *must* be in a condemned generation
+#ifdef MARK_PHASE_PREFETCH
+// prefetch o and park it in the queue, returns the object that has been
+// sitting in the queue for slot_count calls (or nullptr)
 FORCEINLINE
-uint8_t *mark_queue_t::queue_mark(uint8_t *o)
+uint8_t* mark_queue_t::park (uint8_t* o)
 {
-#ifdef MARK_PHASE_PREFETCH
     Prefetch (o);
 
     // while the prefetch is taking effect, park our object in the queue
@@ -27697,7 +28464,20 @@ uint8_t *mark_queue_t::queue_mark(uint8_t *o)
     uint8_t* old_o = slot_table[slot_index];
     slot_table[slot_index] = o;
 
-    curr_slot_index = (slot_index + 1) % slot_count;
+    curr_slot_index = (slot_index + 1) & (slot_count - 1);
+    return old_o;
+}
+#endif //MARK_PHASE_PREFETCH
+
+// place an object in the mark queue
+// returns a *different* object or nullptr
+// if a non-null object is returned, that object is newly marked
+// object o *must* be in a condemned generation
+FORCEINLINE
+uint8_t *mark_queue_t::queue_mark(uint8_t *o)
+{
+#ifdef MARK_PHASE_PREFETCH
+    uint8_t* old_o = park (o);
     if (old_o == nullptr)
         return nullptr;
 #else //MARK_PHASE_PREFETCH
@@ -27761,7 +28541,7 @@ uint8_t* mark_queue_t::get_next_marked()
     {
         uint8_t* o = slot_table[slot_index];
         slot_table[slot_index] = nullptr;
-        slot_index = (slot_index + 1) % slot_count;
+        slot_index = (slot_index + 1) & (slot_count - 1);
         if (o != nullptr)
         {
             BOOL already_marked = marked (o);
@@ -27778,10 +28558,65 @@ uint8_t* mark_queue_t::get_next_marked()
     return nullptr;
 }
 
-void mark_queue_t::verify_empty()
+#ifdef BACKGROUND_GC
+// place an object in the background mark queue
+// returns a *different* object or nullptr
+// if a non-null object is returned, that object is newly background marked
+FORCEINLINE
+uint8_t* mark_queue_t::queue_background_mark (uint8_t* o, gc_heap* hp)
+{
+#ifdef MARK_PHASE_PREFETCH
+    uint8_t* old_o = park (o);
+    if (old_o == nullptr)
+        return nullptr;
+#else //MARK_PHASE_PREFETCH
+    uint8_t* old_o = o;
+#endif //MARK_PHASE_PREFETCH
+
+    return (hp->background_mark1 (old_o) ? old_o : nullptr);
+}
+
+// retrieve a newly background marked object from the queue
+// returns nullptr if there is no such object
+uint8_t* mark_queue_t::get_next_background_marked (gc_heap* hp)
+{
+#ifdef MARK_PHASE_PREFETCH
+    size_t slot_index = curr_slot_index;
+    size_t empty_slot_count = 0;
+    while (empty_slot_count < slot_count)
+    {
+        uint8_t* o = slot_table[slot_index];
+        slot_table[slot_index] = nullptr;
+        slot_index = (slot_index + 1) & (slot_count - 1);
+        if ((o != nullptr) && hp->background_mark1 (o))
+        {
+            curr_slot_index = slot_index;
+            return o;
+        }
+        empty_slot_count++;
+    }
+#endif //MARK_PHASE_PREFETCH
+    return nullptr;
+}
+
+void mark_queue_t::scan (promote_func* fn, ScanContext* sc)
 {
 #ifdef MARK_PHASE_PREFETCH
     for (size_t slot_index = 0; slot_index < slot_count; slot_index++)
+    {
+        if (slot_table[slot_index] != nullptr)
+        {
+            (*fn) ((Object**)&slot_table[slot_index], sc, 0);
+        }
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+#endif //BACKGROUND_GC
+
+void mark_queue_t::verify_empty()
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t slot_index = 0; slot_index < max_slot_count; slot_index++)
     {
         assert(slot_table[slot_index] == nullptr);
     }
@@ -28529,18 +29364,19 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
-                        if (background_mark (o,
-                                             background_saved_lowest_address,
-                                             background_saved_highest_address))
+                        if (background_object_in_range_p (o))
                         {
-                            //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
+                            o = background_mark_queue.queue_background_mark (o, this);
+                            if (o != nullptr)
                             {
-                                *(background_mark_stack_tos++) = o;
+                                //m_boundary (o);
+                                size_t obj_size = size (o);
+                                bpromoted_bytes (thread) += obj_size;
+                                if (contain_pointers_or_collectible (o))
+                                {
+                                    *(background_mark_stack_tos++) = o;
 
+                                }
                             }
                         }
                     }
@@ -28628,11 +29464,8 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                                        start, use_start, (oo + s),
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
-
-                        if (background_mark (o,
-                                            background_saved_lowest_address,
-                                            background_saved_highest_address))
+                        if (background_object_in_range_p (o) &&
+                            ((o = background_mark_queue.queue_background_mark (o, this)) != nullptr))
                         {
                             //m_boundary (o);
                             size_t obj_size = size (o);
@@ -28698,10 +29531,20 @@ next_level:
 #endif //SORT_MARK_STACK
         }
         else
-            break;
+        {
+            // the stack is empty, continue with what's left in the queue
+            oo = background_mark_queue.get_next_background_marked (this);
+            if (oo == nullptr)
+                break;
+
+            bpromoted_bytes (thread) += size (oo);
+            if (!contain_pointers_or_collectible (oo))
+                oo = 0;
+        }
     }
 
     assert (background_mark_stack_tos == background_mark_stack_array);
+    background_mark_queue.verify_empty();
 
 
 }
@@ -28847,6 +29690,9 @@ gc_heap::scan_background_roots (promote_func* fn, int hn, ScanContext *pSC)
         mark_list_finger++;
     }
 
+    dprintf (3, ("Scanning background mark queue"));
+    background_mark_queue.scan (fn, pSC);
+
     //scan the mark stack
     dprintf (3, ("Scanning background mark stack"));
 
@@ -29767,16 +30613,32 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         gc_t_join.join(this, gc_join_rescan_dependent_handles);
         if (gc_t_join.joined())
         {
+            if (parallel_handle_scan_p)
+            {
+                GCScan::GcPrepareParallelDhReScan();
+            }
+
             dprintf(3, ("Starting all gc thread for dependent handle promotion"));
             gc_t_join.restart();
         }
 
-        // If the portion of the dependent handle table managed by this worker has handles that could still be
-        // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
-            if (GCScan::GcDhReScan(sc))
+        if (parallel_handle_scan_p)
+        {
+            // All workers share the rescan by claiming segments from every heap's dependent handle table, so
+            // each of them takes part regardless of what its own portion looked like after the last scan. The
+            // passes repeat in lock step until a pass on all workers promotes nothing.
+            if (GCScan::GcDhReScan(sc, true))
                 s_fUnscannedPromotions = TRUE;
+        }
+        else
+        {
+            // If the portion of the dependent handle table managed by this worker has handles that could still be
+            // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
+            // could require a rescan of handles on this or other workers.
+            if (GCScan::GcDhUnpromotedHandlesExist(sc))
+                if (GCScan::GcDhReScan(sc))
+                    s_fUnscannedPromotions = TRUE;
+        }
     }
 }
 #else //MULTIPLE_HEAPS
@@ -29928,7 +30790,7 @@ void gc_heap::verify_region_to_generation_map()
                 }
                 size_t region_index_start = get_basic_region_index_for_address (get_region_start (region));
                 size_t region_index_end = get_basic_region_index_for_address (heap_segment_reserved (region));
-                int gen_num = min (gen_number, (int)soh_gen2);
+                int gen_num = (heap_segment_young_uoh_p (region) ? (int)soh_gen0 : min (gen_number, (int)soh_gen2));
                 assert (gen_num == heap_segment_gen_num (region));
                 int plan_gen_num = heap_segment_plan_gen_num (region);
                 bool is_demoted = (region->flags & heap_segment_flags_demoted) != 0;
@@ -30009,6 +30871,31 @@ void gc_heap::compute_gc_and_ephemeral_range (int condemned_gen_number, bool end
                 }
             }
         }
+
+        if (use_young_uoh_p)
+        {
+            // Young LOH regions are in gen0, so they are condemned by every GC.
+#ifdef MULTIPLE_HEAPS
+            for (int i = 0; i < n_heaps; i++)
+            {
+                gc_heap* hp = g_heaps[i];
+#else //MULTIPLE_HEAPS
+            {
+                gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+                generation *gen = hp->generation_of (loh_generation);
+                for (heap_segment *region = generation_start_segment (gen); region != nullptr; region = heap_segment_next (region))
+                {
+                    if (heap_segment_young_uoh_p (region))
+                    {
+                        ephemeral_low = min ((uint8_t*)ephemeral_low, get_region_start (region));
+                        ephemeral_high = max ((uint8_t*)ephemeral_high, heap_segment_reserved (region));
+                        gc_low = min (gc_low, get_region_start (region));
+                        gc_high = max (gc_high, heap_segment_reserved (region));
+                    }
+                }
+            }
+        }
     }
     dprintf (2, ("ephemeral_low = %p, ephemeral_high = %p, gc_low = %p, gc_high = %p", (uint8_t*)ephemeral_low, (uint8_t*)ephemeral_high, gc_low, gc_high));
 }
@@ -30322,6 +31209,8 @@ void gc_heap::mark_phase (int condemned_gen_number)
             n_eph_loh = 0;
             n_gen_loh = 0;
 #endif //FEATURE_CARD_MARKING_STEALING
+            total_cards_scanned = 0;
+            total_cards_set = 0;
 
 #ifdef CARD_BUNDLE
 #ifdef MULTIPLE_HEAPS
@@ -30464,6 +31353,22 @@ void gc_heap::mark_phase (int condemned_gen_number)
     }
 #endif //MULTIPLE_HEAPS
 
+    if (num_global_bridge_objs != 0)
+    {
+        // The bridge objects and everything bridge processing visited still have their
+        // headers replaced, restore them before any of them can be marked.
+        GCScan::GcRestoreBridgeObjectHeaders (heap_number, n_heaps);
+
+#ifdef MULTIPLE_HEAPS
+        dprintf (3, ("Joining after restoring bridge object headers"));
+        gc_t_join.join(this, gc_join_bridge_headers_restored);
+        if (gc_t_join.joined())
+        {
+            gc_t_join.restart();
+        }
+#endif //MULTIPLE_HEAPS
+    }
+
     {
         int thread = heap_number;
         // Each thread will receive an equal chunk of bridge objects, with the last thread
@@ -30516,6 +31421,11 @@ void gc_heap::mark_phase (int condemned_gen_number)
             gc_t_join.r_init();
         }
 
+        if (parallel_handle_scan_p)
+        {
+            GCScan::GcPrepareParallelShortWeakPtrScan();
+        }
+
         dprintf(3, ("Starting all gc thread for short weak handle scan"));
         gc_t_join.restart();
 #endif //MULTIPLE_HEAPS
@@ -30545,8 +31455,19 @@ void gc_heap::mark_phase (int condemned_gen_number)
     }
 #endif // FEATURE_CARD_MARKING_STEALING
 
+    if (!full_p)
+    {
+        dprintf (3, ("h%d cards scanned: %zd, set: %zd (%d%%)", heap_number,
+            (size_t)total_cards_scanned, (size_t)total_cards_set,
+            (total_cards_scanned ? (int)(((float)total_cards_set / (float)total_cards_scanned) * 100) : 0)));
+    }
+
     // null out the target of short weakref that were not promoted.
+#ifdef MULTIPLE_HEAPS
+    GCScan::GcShortWeakPtrScan (condemned_gen_number, max_generation, &sc, parallel_handle_scan_p);
+#else
     GCScan::GcShortWeakPtrScan (condemned_gen_number, max_generation,&sc);
+#endif //MULTIPLE_HEAPS
 
 #ifdef MULTIPLE_HEAPS
     dprintf(3, ("Joining for finalization"));
@@ -30605,13 +31526,22 @@ void gc_heap::mark_phase (int condemned_gen_number)
 #endif //USE_REGIONS
 
 #ifdef MULTIPLE_HEAPS
+        if (parallel_handle_scan_p)
+        {
+            GCScan::GcPrepareParallelWeakPtrScan();
+        }
+
         syncblock_scan_p = 0;
         gc_t_join.restart();
     }
 #endif //MULTIPLE_HEAPS
 
     // null out the target of long weakref that were not promoted.
+#ifdef MULTIPLE_HEAPS
+    GCScan::GcWeakPtrScan (condemned_gen_number, max_generation, &sc, parallel_handle_scan_p);
+#else
     GCScan::GcWeakPtrScan (condemned_gen_number, max_generation, &sc);
+#endif //MULTIPLE_HEAPS
 
 #ifdef MULTIPLE_HEAPS
     size_t total_mark_list_size = sort_mark_list();
@@ -34263,6 +35193,11 @@ void gc_heap::plan_phase (int condemned_gen_number)
     else
     {
         settings.loh_compaction = FALSE;
+#ifdef USE_REGIONS
+        // This has to happen before relocation as it sets the cards relocation goes through
+        // for the young LOH objects that survive.
+        sweep_young_uoh_regions();
+#endif //USE_REGIONS
     }
 
 #ifdef MULTIPLE_HEAPS
@@ -34606,7 +35541,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
                 // For plugs allocated in condemned we kept track of each one but only fire the
                 // event for buckets with non zero items.
                 uint16_t non_zero_buckets = 0;
-                for (uint16_t bucket_index = 0; bucket_index < NUM_GEN2_ALIST; bucket_index++)
+                for (uint16_t bucket_index = 0; bucket_index < generation_allocator (older_gen)->number_of_buckets(); bucket_index++)
                 {
                     if (bucket_info[bucket_index].count != 0)
                     {
@@ -34666,9 +35601,15 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
         GCToEEInterface::DiagWalkSurvivors(__this, true);
 
+        uint64_t phase_start = GetHighPrecisionTimeStamp();
         relocate_phase (condemned_gen_number, first_condemned_address);
+        uint64_t phase_end = GetHighPrecisionTimeStamp();
+        phase_times[heap_phase_relocate] = phase_end - phase_start;
+
+        phase_start = phase_end;
         compact_phase (condemned_gen_number, first_condemned_address,
                        (!settings.demotion && settings.promotion));
+        phase_times[heap_phase_compact] = GetHighPrecisionTimeStamp() - phase_start;
         fix_generation_bounds (condemned_gen_number, consing_gen);
         assert (generation_allocation_limit (youngest_generation) ==
                 generation_allocation_pointer (youngest_generation));
@@ -34914,7 +35855,9 @@ void gc_heap::plan_phase (int condemned_gen_number)
 
         GCToEEInterface::DiagWalkSurvivors(__this, false);
 
+        uint64_t phase_start = GetHighPrecisionTimeStamp();
         make_free_lists (condemned_gen_number);
+        phase_times[heap_phase_sweep] = GetHighPrecisionTimeStamp() - phase_start;
         size_t total_recovered_sweep_size = recover_saved_pinned_info();
         if (total_recovered_sweep_size > 0)
         {
@@ -35856,63 +36799,68 @@ void gc_heap::check_demotion_helper_sip (uint8_t** pval, int parent_gen_num, uin
     dprintf (3, ("SCS %d, %d", child_object_plan_gen, parent_gen_num));
 }
 
-heap_segment* gc_heap::relocate_advance_to_non_sip (heap_segment* region)
+void gc_heap::relocate_in_sip_region (heap_segment* region)
 {
     THREAD_FROM_HEAP;
 
-    heap_segment* current_region = region;
-    dprintf (REGIONS_LOG, ("Relocate searching for next non SIP, starting from %p",
-        (region ? heap_segment_mem (region) : 0)));
+    int gen_num = heap_segment_gen_num (region);
+    int plan_gen_num = heap_segment_plan_gen_num (region);
+    bool use_sip_demotion = (plan_gen_num > get_plan_gen_num (gen_num));
 
-    while (current_region)
+    dprintf (REGIONS_LOG, ("region %p is SIP, relocating, gen %d, plan gen: %d(supposed to be %d) %s",
+        heap_segment_mem (region), gen_num, plan_gen_num, get_plan_gen_num (gen_num),
+        (use_sip_demotion ? "Sd" : "d")));
+    uint8_t* x = heap_segment_mem (region);
+    uint8_t* end = heap_segment_allocated (region);
+
+    // For SIP regions, we go linearly in the region and relocate each object's references.
+    while (x < end)
     {
-        if (heap_segment_swept_in_plan (current_region))
+        size_t s = size (x);
+        assert (s > 0);
+        uint8_t* next_obj = x + Align (s);
+        Prefetch (next_obj);
+        if (!(((CObjectHeader*)x)->IsFree()))
         {
-            int gen_num = heap_segment_gen_num (current_region);
-            int plan_gen_num = heap_segment_plan_gen_num (current_region);
-            bool use_sip_demotion = (plan_gen_num > get_plan_gen_num (gen_num));
-
-            dprintf (REGIONS_LOG, ("region %p is SIP, relocating, gen %d, plan gen: %d(supposed to be %d) %s",
-                heap_segment_mem (current_region), gen_num, plan_gen_num, get_plan_gen_num (gen_num),
-                (use_sip_demotion ? "Sd" : "d")));
-            uint8_t* x = heap_segment_mem (current_region);
-            uint8_t* end = heap_segment_allocated (current_region);
-
-            // For SIP regions, we go linearly in the region and relocate each object's references.
-            while (x < end)
+            //relocate_obj_helper (x, s);
+            if (contain_pointers (x))
             {
-                size_t s = size (x);
-                assert (s > 0);
-                uint8_t* next_obj = x + Align (s);
-                Prefetch (next_obj);
-                if (!(((CObjectHeader*)x)->IsFree()))
-                {
-                    //relocate_obj_helper (x, s);
-                    if (contain_pointers (x))
-                    {
-                        dprintf (3, ("$%zx$", (size_t)x));
+                dprintf (3, ("$%zx$", (size_t)x));
 
-                        go_through_object_nostart (method_table(x), x, s, pval,
-                        {
-                            uint8_t* child = *pval;
-                            //reloc_survivor_helper (pval);
-                            relocate_address (pval THREAD_NUMBER_ARG);
-                            if (use_sip_demotion)
-                                check_demotion_helper_sip (pval, plan_gen_num, (uint8_t*)pval);
-                            else
-                                check_demotion_helper (pval, (uint8_t*)pval);
+                go_through_object_nostart (method_table(x), x, s, pval,
+                {
+                    uint8_t* child = *pval;
+                    //reloc_survivor_helper (pval);
+                    relocate_address (pval THREAD_NUMBER_ARG);
+                    if (use_sip_demotion)
+                        check_demotion_helper_sip (pval, plan_gen_num, (uint8_t*)pval);
+                    else
+                        check_demotion_helper (pval, (uint8_t*)pval);
 
-                            if (child)
-                            {
-                                dprintf (4444, ("SIP %p(%p)->%p->%p(%p)",
-                                    x, (uint8_t*)pval, child, *pval, method_table (child)));
-                            }
-                        });
+                    if (child)
+                    {
+                        dprintf (4444, ("SIP %p(%p)->%p->%p(%p)",
+                            x, (uint8_t*)pval, child, *pval, method_table (child)));
                     }
-                    check_class_object_demotion (x);
-                }
-                x = next_obj;
+                });
             }
+            check_class_object_demotion (x);
+        }
+        x = next_obj;
+    }
+}
+
+heap_segment* gc_heap::relocate_advance_to_non_sip (heap_segment* region)
+{
+    heap_segment* current_region = region;
+    dprintf (REGIONS_LOG, ("Relocate searching for next non SIP, starting from %p",
+        (region ? heap_segment_mem (region) : 0)));
+
+    while (current_region)
+    {
+        if (heap_segment_swept_in_plan (current_region))
+        {
+            relocate_in_sip_region (current_region);
         }
         else
         {
@@ -36912,6 +37860,21 @@ void gc_heap::relocate_survivors_in_brick (uint8_t* tree, relocate_args* args)
         BOOL   has_post_plug_info_p = FALSE;
         BOOL   has_pre_plug_info_p = FALSE;
 
+#ifdef FEATURE_RELOCATE_STEALING
+        if (args->use_region_pins)
+        {
+            if (tree == args->next_pinned_plug)
+            {
+                args->pinned_plug_entry = get_next_region_pinned_entry (args,
+                                                                        &has_pre_plug_info_p,
+                                                                        &has_post_plug_info_p);
+                assert (tree == pinned_plug (args->pinned_plug_entry));
+
+                dprintf (3, ("tree is the next pin of the region: %p", tree));
+            }
+        }
+        else
+#endif //FEATURE_RELOCATE_STEALING
         if (tree == oldest_pinned_plug)
         {
             args->pinned_plug_entry = get_oldest_pinned_entry (&has_pre_plug_info_p,
@@ -36981,6 +37944,20 @@ heap_segment* gc_heap::get_start_segment (generation* gen)
 void gc_heap::relocate_survivors (int condemned_gen_number,
                                   uint8_t* first_condemned_address)
 {
+#ifdef FEATURE_RELOCATE_STEALING
+    if (relocate_stealing_p && relocate_regions_claimable_p)
+    {
+        // Our own regions are claimed first, the rest of the time is spent
+        // helping the heaps that aren't done yet.
+        relocate_survivors_stealing (condemned_gen_number, 0);
+
+        // Leave the pinned plug queue the way the sequential walk would.
+        mark_stack_bos = mark_stack_tos;
+        update_oldest_pinned_plug();
+        return;
+    }
+#endif //FEATURE_RELOCATE_STEALING
+
     reset_pinned_queue_bos();
     update_oldest_pinned_plug();
 
@@ -37011,6 +37988,9 @@ void gc_heap::relocate_survivors (int condemned_gen_number,
         args.is_shortened = FALSE;
         args.pinned_plug_entry = 0;
         args.last_plug = 0;
+#ifdef FEATURE_RELOCATE_STEALING
+        args.use_region_pins = false;
+#endif //FEATURE_RELOCATE_STEALING
 
         while (1)
         {
@@ -37063,7 +38043,169 @@ void gc_heap::relocate_survivors (int condemned_gen_number,
             current_brick++;
         }
     }
+
+#ifdef FEATURE_RELOCATE_STEALING
+    if (relocate_stealing_p)
+    {
+        // We had to relocate our own regions in order, we can still help others.
+        relocate_survivors_stealing (condemned_gen_number, 1);
+    }
+#endif //FEATURE_RELOCATE_STEALING
+}
+
+#ifdef FEATURE_RELOCATE_STEALING
+void gc_heap::prepare_relocate_stealing (int condemned_gen_number)
+{
+    relocate_regions_claimable_p = false;
+
+    if (!relocate_stealing_p)
+        return;
+
+    // The pinned plugs were enqueued during plan in the order we walk the
+    // condemned regions here, so each region's pins are a contiguous range.
+    size_t pin_index = 0;
+    int stop_gen_idx = get_stop_generation_index (condemned_gen_number);
+
+    for (int i = condemned_gen_number; i >= stop_gen_idx; i--)
+    {
+        heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (i)));
+
+        while (region)
+        {
+            heap_segment_reloc_pin_start (region) = pin_index;
+
+            if (!heap_segment_swept_in_plan (region))
+            {
+                uint8_t* start = heap_segment_mem (region);
+                uint8_t* end = heap_segment_allocated (region);
+
+                while (pin_index < mark_stack_tos)
+                {
+                    uint8_t* plug = pinned_plug (pinned_plug_of (pin_index));
+                    if ((plug < start) || (plug >= end))
+                        break;
+                    pin_index++;
+                }
+            }
+
+            heap_segment_reloc_pin_end (region) = pin_index;
+            heap_segment_reloc_claimed (region) = 0;
+
+            region = heap_segment_next (region);
+        }
+    }
+
+    // If some pins were not attributed to a region we don't know how the walk
+    // would have consumed them so we relocate this heap sequentially.
+    relocate_regions_claimable_p = (pin_index == mark_stack_tos);
+
+    dprintf (REGIONS_LOG, ("h%d relocate stealing %s, %zd pins",
+        heap_number, (relocate_regions_claimable_p ? "enabled" : "disabled"), mark_stack_tos));
+}
+
+inline
+bool gc_heap::claim_region_for_relocate (heap_segment* region)
+{
+    if (heap_segment_reloc_claimed (region) != 0)
+        return false;
+
+    return (Interlocked::CompareExchange ((volatile int32_t*)&heap_segment_reloc_claimed (region), 1, 0) == 0);
+}
+
+mark* gc_heap::get_next_region_pinned_entry (relocate_args* args,
+                                             BOOL* has_pre_plug_info_p,
+                                             BOOL* has_post_plug_info_p)
+{
+    assert (args->pinned_plug_index < args->pinned_plug_end);
+
+    mark* entry = pinned_plug_of (args->pinned_plug_index);
+    *has_pre_plug_info_p = entry->has_pre_plug_info();
+    *has_post_plug_info_p = entry->has_post_plug_info();
+
+    args->pinned_plug_index++;
+    args->next_pinned_plug = ((args->pinned_plug_index < args->pinned_plug_end) ?
+                              pinned_plug (pinned_plug_of (args->pinned_plug_index)) : 0);
+    return entry;
+}
+
+// This is called on the heap that owns the region, but possibly on another
+// heap's GC thread.
+void gc_heap::relocate_survivors_in_region (heap_segment* region)
+{
+    if (heap_segment_swept_in_plan (region))
+    {
+        relocate_in_sip_region (region);
+        return;
+    }
+
+    relocate_args args;
+    args.is_shortened = FALSE;
+    args.pinned_plug_entry = 0;
+    args.last_plug = 0;
+    args.use_region_pins = true;
+    args.pinned_plug_index = heap_segment_reloc_pin_start (region);
+    args.pinned_plug_end = heap_segment_reloc_pin_end (region);
+    args.next_pinned_plug = ((args.pinned_plug_index < args.pinned_plug_end) ?
+                             pinned_plug (pinned_plug_of (args.pinned_plug_index)) : 0);
+
+    size_t current_brick = brick_of (heap_segment_mem (region));
+    size_t end_brick = brick_of (heap_segment_allocated (region) - 1);
+
+    for (; current_brick <= end_brick; current_brick++)
+    {
+        int brick_entry = brick_table [current_brick];
+
+        if (brick_entry >= 0)
+        {
+            relocate_survivors_in_brick (brick_address (current_brick) +
+                                         brick_entry - 1,
+                                         &args);
+        }
+    }
+
+    if (args.last_plug)
+    {
+        assert (!(args.is_shortened));
+        relocate_survivors_in_plug (args.last_plug,
+                                    heap_segment_allocated (region),
+                                    args.is_shortened,
+                                    args.pinned_plug_entry);
+    }
+
+    assert (args.pinned_plug_index == args.pinned_plug_end);
+}
+
+void gc_heap::relocate_survivors_stealing (int condemned_gen_number, int start_offset)
+{
+    int stop_gen_idx = get_stop_generation_index (condemned_gen_number);
+
+    for (int heap_offset = start_offset; heap_offset < n_heaps; heap_offset++)
+    {
+        gc_heap* hp = g_heaps[(heap_number + heap_offset) % n_heaps];
+
+        // This heap is relocating its own regions sequentially.
+        if (!hp->relocate_regions_claimable_p)
+            continue;
+
+        for (int i = condemned_gen_number; i >= stop_gen_idx; i--)
+        {
+            heap_segment* region = heap_segment_rw (generation_start_segment (hp->generation_of (i)));
+
+            while (region)
+            {
+                if (claim_region_for_relocate (region))
+                {
+                    dprintf (3, ("h%d relocating region %p of h%d",
+                        heap_number, heap_segment_mem (region), hp->heap_number));
+                    hp->relocate_survivors_in_region (region);
+                }
+
+                region = heap_segment_next (region);
+            }
+        }
+    }
 }
+#endif //FEATURE_RELOCATE_STEALING
 
 void gc_heap::walk_plug (uint8_t* plug, size_t size, BOOL check_last_object_p, walk_relocate_args* args)
 {
@@ -37339,6 +38481,12 @@ void gc_heap::relocate_phase (int condemned_gen_number,
     sc.promotion = FALSE;
     sc.concurrent = FALSE;
 
+#ifdef FEATURE_RELOCATE_STEALING
+    // This needs to be done before the join so the other heaps see the
+    // regions' pin ranges by the time they start claiming them.
+    prepare_relocate_stealing (condemned_gen_number);
+#endif //FEATURE_RELOCATE_STEALING
+
 #ifdef MULTIPLE_HEAPS
     //join all threads to make sure they are synchronized
     dprintf(3, ("Joining after end of plan"));
@@ -39232,6 +40380,22 @@ void gc_heap::background_mark_phase ()
     }
 #endif //MULTIPLE_HEAPS
 
+    if (num_global_bridge_objs != 0)
+    {
+        // The bridge objects and everything bridge processing visited still have their
+        // headers replaced, restore them before any of them can be marked.
+        GCScan::GcRestoreBridgeObjectHeaders (heap_number, n_heaps);
+
+#ifdef MULTIPLE_HEAPS
+        dprintf (3, ("Joining after restoring bridge object headers"));
+        gc_t_join.join(this, gc_join_bridge_headers_restored);
+        if (gc_t_join.joined())
+        {
+            gc_t_join.restart();
+        }
+#endif //MULTIPLE_HEAPS
+    }
+
     {
         int thread = heap_number;
         // Each thread will receive an equal chunk of bridge objects, with the last thread
@@ -39731,9 +40895,9 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
                         }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
-                        get_write_watch_for_gc_heap (reset_watch_state, base_address, region_size,
-                                                     (void**)background_written_addresses,
-                                                     &bcount, is_runtime_suspended);
+                        get_write_watch_ranges_for_gc_heap (reset_watch_state, base_address, region_size,
+                                                            (void**)background_written_addresses,
+                                                            &bcount, is_runtime_suspended);
 
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
                         if (!is_runtime_suspended)
@@ -39744,10 +40908,16 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
 
                         if (bcount != 0)
                         {
-                            total_dirtied_pages += bcount;
+                            size_t dirtied_pages = 0;
+                            for (unsigned i = 0; i < bcount; i++)
+                            {
+                                dirtied_pages += (background_written_addresses[i * 2 + 1] -
+                                                  background_written_addresses[i * 2]) / WRITE_WATCH_UNIT_SIZE;
+                            }
+                            total_dirtied_pages += dirtied_pages;
 
-                            dprintf (3, ("Found %zu pages [%zx, %zx[",
-                                            bcount, (size_t)base_address, (size_t)high_address));
+                            dprintf (3, ("Found %zu pages in %zu ranges [%zx, %zx[",
+                                            dirtied_pages, (size_t)bcount, (size_t)base_address, (size_t)high_address));
                         }
 
                         if (!reset_only_p)
@@ -39759,27 +40929,32 @@ void gc_heap::revisit_written_pages (BOOL concurrent_p, BOOL reset_only_p)
 
                             for (unsigned i = 0; i < bcount; i++)
                             {
-                                uint8_t* page = (uint8_t*)background_written_addresses[i];
-                                dprintf (3, ("looking at page %d at %zx(h: %zx)", i,
-                                    (size_t)page, (size_t)high_address));
-                                if (page < high_address)
-                                {
-                                    //search for marked objects in the page
-                                    revisit_written_page (page, high_address, concurrent_p,
-                                                          last_page, last_object,
-                                                          !small_object_segments,
-                                                          total_marked_objects);
-                                }
-                                else
+                                uint8_t* range_end = background_written_addresses[i * 2 + 1];
+                                dprintf (3, ("looking at range %d at [%zx, %zx[(h: %zx)", i,
+                                    (size_t)background_written_addresses[i * 2], (size_t)range_end, (size_t)high_address));
+
+                                for (uint8_t* page = background_written_addresses[i * 2]; page < range_end; page += WRITE_WATCH_UNIT_SIZE)
                                 {
-                                    dprintf (3, ("page %d at %zx is >= %zx!", i, (size_t)page, (size_t)high_address));
-                                    assert (!"page shouldn't have exceeded limit");
+                                    if (page < high_address)
+                                    {
+                                        //search for marked objects in the page
+                                        revisit_written_page (page, high_address, concurrent_p,
+                                                              last_page, last_object,
+                                                              !small_object_segments,
+                                                              total_marked_objects);
+                                    }
+                                    else
+                                    {
+                                        dprintf (3, ("page at %zx is >= %zx!", (size_t)page, (size_t)high_address));
+                                        assert (!"page shouldn't have exceeded limit");
+                                        break;
+                                    }
                                 }
                             }
                         }
 
                         if (bcount >= array_size){
-                            base_address = background_written_addresses [array_size-1] + WRITE_WATCH_UNIT_SIZE;
+                            base_address = background_written_addresses [(array_size - 1) * 2 + 1];
                             bcount = array_size;
                         }
                     }
@@ -41800,6 +42975,44 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non zero word in [card_word, card_word_end), or card_word_end if
+// they are all zero. On large heaps the card table is mostly clean so we check 8
+// words (256 cards) at a time with SIMD where it's available. This is also used to
+// skip clear card bundle words.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(TARGET_AMD64)
+    const __m128i zero = _mm_setzero_si128();
+    while ((card_word_end - card_word) >= 8)
+    {
+        __m128i words = _mm_or_si128 (_mm_loadu_si128 ((const __m128i*)card_word),
+                                      _mm_loadu_si128 ((const __m128i*)(card_word + 4)));
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (words, zero)) != 0xFFFF)
+        {
+            break;
+        }
+        card_word += 8;
+    }
+#elif defined(TARGET_ARM64)
+    while ((card_word_end - card_word) >= 8)
+    {
+        uint32x4_t words = vorrq_u32 (vld1q_u32 (card_word), vld1q_u32 (card_word + 4));
+        if (vmaxvq_u32 (words) != 0)
+        {
+            break;
+        }
+        card_word += 8;
+    }
+#endif //TARGET_AMD64
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -41827,6 +43040,13 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
                 else
                 {
                     cardb += sizeof(cbw)*8 - card_bundle_bit (cardb);
+                    if (cardb < end_cardb)
+                    {
+                        // skip the following bundle words that are all clear
+                        uint32_t* cbw_start = &card_bundle_table[card_bundle_word (cardb)];
+                        uint32_t* cbw_end = &card_bundle_table[card_bundle_word (end_cardb - 1) + 1];
+                        cardb += (find_non_zero_card_word (cbw_start, cbw_end) - cbw_start) * card_bundle_word_width;
+                    }
                 }
             }
             if (cardb >= end_cardb)
@@ -41834,10 +43054,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -41851,10 +43068,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -41871,18 +43085,11 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
-
-        while (card_word < card_word_end)
+        uint32_t* card_word = find_non_zero_card_word (&card_table[cardw], &card_table[cardw_end]);
+        if (card_word < &card_table[cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -41897,10 +43104,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 //                              As output, the first card that's set.
 //     card_word_end : The card word at which to stop looking.
 //     end_card      : [out] The last card which is set.
+//     n_cards_scanned : [in/out] Incremented by the number of cards looked at.
 BOOL gc_heap::find_card(uint32_t* card_table,
                         size_t&   card,
                         size_t    card_word_end,
-                        size_t&   end_card)
+                        size_t&   end_card,
+                        size_t&   n_cards_scanned)
 {
     uint32_t* last_card_word;
     uint32_t card_word_value;
@@ -41909,6 +43118,8 @@ BOOL gc_heap::find_card(uint32_t* card_table,
     if (card_word (card) >= card_word_end)
         return FALSE;
 
+    size_t start_card = card;
+
     // Find the first card which is set
     last_card_word = &card_table [card_word (card)];
     bit_position = card_bit (card);
@@ -41931,6 +43142,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
         size_t lcw = card_word(card) + (bit_position != 0);
         if (gc_heap::find_card_dword (lcw, card_word_end) == FALSE)
         {
+            n_cards_scanned += card_word_end * card_word_width - start_card;
             return FALSE;
         }
         else
@@ -41942,12 +43154,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -41955,6 +43162,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
         else
         {
             // We failed to find any non-zero card words before we got to card_word_end
+            n_cards_scanned += card_word_end * card_word_width - start_card;
             return FALSE;
         }
 #endif //CARD_BUNDLE
@@ -41994,6 +43202,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
     } while (card_word_value & 1);
 
     end_card = (last_card_word - &card_table [0])* card_word_width + bit_position;
+    n_cards_scanned += end_card - start_card;
 
     //dprintf (3, ("find_card: [%zx, %zx[ set", card, end_card));
     dprintf (3, ("fc: [%zx, %zx[", card, end_card));
@@ -42125,7 +43334,7 @@ gc_heap::mark_through_cards_helper (uint8_t** poo, size_t& n_gen,
 
 BOOL gc_heap::card_transition (uint8_t* po, uint8_t* end, size_t card_word_end,
                                size_t& cg_pointers_found,
-                               size_t& n_eph, size_t& n_card_set,
+                               size_t& n_eph, size_t& n_card_set, size_t& n_cards_scanned,
                                size_t& card, size_t& end_card,
                                BOOL& foundp, uint8_t*& start_address,
                                uint8_t*& limit, size_t& n_cards_cleared
@@ -42153,7 +43362,7 @@ BOOL gc_heap::card_transition (uint8_t* po, uint8_t* end, size_t card_word_end,
         passed_end_card_p = TRUE;
         dprintf (3, ("card %zx exceeding end_card %zx",
                     (size_t)card, (size_t)end_card));
-        foundp = find_card (card_table, card, card_word_end, end_card);
+        foundp = find_card (card_table, card, card_word_end, end_card, n_cards_scanned);
         if (foundp)
         {
             n_card_set+= end_card - card;
@@ -42172,7 +43381,7 @@ BOOL gc_heap::card_transition (uint8_t* po, uint8_t* end, size_t card_word_end,
         if (!foundp)
         {
             card_word_end_out = 0;
-            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, start_address, limit, card, end_card, card_word_end_out);
+            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, n_cards_scanned, start_address, limit, card, end_card, card_word_end_out);
         }
 #else
         // the card bit @ end_card should not be set -
@@ -42255,12 +43464,12 @@ bool card_marking_enumerator::move_next(heap_segment* seg, uint8_t*& low, uint8_
 }
 
 bool gc_heap::find_next_chunk(card_marking_enumerator& card_mark_enumerator, heap_segment* seg, size_t& n_card_set,
-    uint8_t*& start_address, uint8_t*& limit,
+    size_t& n_cards_scanned, uint8_t*& start_address, uint8_t*& limit,
     size_t& card, size_t& end_card, size_t& card_word_end)
 {
     while (true)
     {
-        if (card_word_end != 0 && find_card(card_table, card, card_word_end, end_card))
+        if (card_word_end != 0 && find_card(card_table, card, card_word_end, end_card, n_cards_scanned))
         {
             assert(end_card <= card_word_end * card_word_width);
             n_card_set += end_card - card;
@@ -42349,6 +43558,7 @@ void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating CARD_
     size_t        n_eph             = 0;
     size_t        n_gen             = 0;
     size_t        n_card_set        = 0;
+    size_t        n_cards_scanned   = 0;
 
     BOOL          foundp            = FALSE;
     uint8_t*      start_address     = 0;
@@ -42403,9 +43613,9 @@ void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating CARD_
         {
 #ifdef FEATURE_CARD_MARKING_STEALING
             // find another chunk with some cards set
-            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, start_address, limit, card, end_card, card_word_end);
+            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, n_cards_scanned, start_address, limit, card, end_card, card_word_end);
 #else // FEATURE_CARD_MARKING_STEALING
-            foundp = find_card(card_table, card, card_word_end, end_card);
+            foundp = find_card(card_table, card, card_word_end, end_card, n_cards_scanned);
             if (foundp)
             {
                 n_card_set += end_card - card;
@@ -42545,7 +43755,7 @@ void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating CARD_
                     {
                         passed_end_card_p = card_transition (o, end, card_word_end,
                             cg_pointers_found,
-                            n_eph, n_card_set,
+                            n_eph, n_card_set, n_cards_scanned,
                             card, end_card,
                             foundp, start_address,
                             limit, total_cards_cleared
@@ -42604,7 +43814,7 @@ go_through_refs:
                                      BOOL passed_end_card_p  = card_transition ((uint8_t*)poo, end,
                                             card_word_end,
                                             cg_pointers_found,
-                                            n_eph, n_card_set,
+                                            n_eph, n_card_set, n_cards_scanned,
                                             card, end_card,
                                             foundp, start_address,
                                             limit, total_cards_cleared
@@ -42659,6 +43869,8 @@ go_through_refs:
 #ifdef FEATURE_CARD_MARKING_STEALING
         Interlocked::ExchangeAddPtr(&n_eph_soh, n_eph);
         Interlocked::ExchangeAddPtr(&n_gen_soh, n_gen);
+        Interlocked::ExchangeAddPtr(&total_cards_scanned, n_cards_scanned);
+        Interlocked::ExchangeAddPtr(&total_cards_set, (n_card_set + total_cards_cleared));
         dprintf (3, ("h%d marking h%d Msoh: cross: %zd, useful: %zd, cards set: %zd, cards cleared: %zd, ratio: %d",
             hpt->heap_number, heap_number, n_eph, n_gen, n_card_set, total_cards_cleared,
             (n_eph ? (int)(((float)n_gen / (float)n_eph) * 100) : 0)));
@@ -42667,6 +43879,8 @@ go_through_refs:
             (n_eph_soh ? (int)(((float)n_gen_soh / (float)n_eph_soh) * 100) : 0)));
 #else
         generation_skip_ratio = ((n_eph > MIN_SOH_CROSS_GEN_REFS) ? (int)(((float)n_gen / (float)n_eph) * 100) : 100);
+        total_cards_scanned += n_cards_scanned;
+        total_cards_set += (n_card_set + total_cards_cleared);
         dprintf (3, ("marking h%d Msoh: cross: %zd, useful: %zd, cards set: %zd, cards cleared: %zd, ratio: %d",
             heap_number, n_eph, n_gen, n_card_set, total_cards_cleared, generation_skip_ratio));
 #endif //FEATURE_CARD_MARKING_STEALING
@@ -46670,6 +47884,28 @@ void gc_heap::background_ephemeral_sweep()
     generation_allocator (youngest_gen)->copy_with_no_repair (&youngest_free_list);
 }
 
+#ifdef USE_REGIONS
+// BGC marks all of gen2 so its sweep is the only time we know how much of each
+// gen2 region survived without a blocking gen2 - record it so the regions that
+// are mostly free can be found.
+void gc_heap::record_bgc_region_survival (heap_segment* region, size_t survived)
+{
+    heap_segment_survived (region) = survived;
+
+    size_t region_size = heap_segment_reserved (region) - heap_segment_mem (region);
+    int surv_ratio = (int)(((double)survived * 100.0) / (double)region_size);
+
+    if (surv_ratio < bgc_low_surv_ratio_th)
+    {
+        bgc_low_surv_regions++;
+        bgc_low_surv_free_size += (heap_segment_background_allocated (region) - heap_segment_mem (region)) - survived;
+
+        dprintf (REGIONS_LOG, ("h%d BGC gen2 region %p surv %zd (%d%%), evacuation candidate",
+            heap_number, heap_segment_mem (region), survived, surv_ratio));
+    }
+}
+#endif //USE_REGIONS
+
 void gc_heap::background_sweep()
 {
     //concurrent_print_time_delta ("finished with mark and start with sweep");
@@ -46732,6 +47968,11 @@ void gc_heap::background_sweep()
 
     init_free_and_plug();
 
+#ifdef USE_REGIONS
+    bgc_low_surv_regions = 0;
+    bgc_low_surv_free_size = 0;
+#endif //USE_REGIONS
+
     current_bgc_state = bgc_sweep_soh;
     verify_soh_segment_list();
 
@@ -46904,6 +48145,10 @@ void gc_heap::background_sweep()
             // on a seg is unmarked, we will process this in process_background_segment_end.
             size_t free_obj_size_last_gap = 0;
 
+#ifdef USE_REGIONS
+            size_t region_survived = 0;
+#endif //USE_REGIONS
+
             allow_fgc();
             uint8_t* end = background_next_end (seg, (i > max_generation));
             dprintf (3333, ("bgs: seg: %zx, [%zx, %zx[%zx", (size_t)seg,
@@ -46961,6 +48206,9 @@ void gc_heap::background_sweep()
                     {
                         add_gen_plug (max_generation, plug_end-plug_start);
                         dd_survived_size (dd) += (plug_end - plug_start);
+#ifdef USE_REGIONS
+                        region_survived += (plug_end - plug_start);
+#endif //USE_REGIONS
                     }
                     dprintf (3, ("bgs: plug [%zx, %zx[", (size_t)plug_start, (size_t)plug_end));
                 }
@@ -47060,6 +48308,13 @@ void gc_heap::background_sweep()
                     process_background_segment_end (seg, gen, plug_end,
                                                     start_seg, &delete_p, free_obj_size_last_gap);
 
+#ifdef USE_REGIONS
+                    if (!delete_p)
+                    {
+                        record_bgc_region_survival (seg, region_survived);
+                    }
+#endif //USE_REGIONS
+
 #ifndef USE_REGIONS
                     assert (next_seg || !delete_p);
 #endif //!USE_REGIONS
@@ -47134,6 +48389,11 @@ void gc_heap::background_sweep()
         generation_free_list_space (generation_of (max_generation)),
         generation_free_obj_space (generation_of (max_generation))));
 
+#ifdef USE_REGIONS
+    dprintf (GTC_LOG, ("h%d: end of bgc sweep: %zd low surv gen2 regions, %zd reclaimable",
+        heap_number, bgc_low_surv_regions, bgc_low_surv_free_size));
+#endif //USE_REGIONS
+
     dprintf (GTC_LOG, ("h%d: end of bgc sweep: loh FL: %zd, FO: %zd",
         heap_number,
         generation_free_list_space (generation_of (loh_generation)),
@@ -47257,19 +48517,36 @@ void gc_heap::sweep_uoh_objects (int gen_num)
         {
             heap_segment* next_seg = heap_segment_next (seg);
             //delete the empty segment if not the only one
-            // REGIONS TODO: for regions we can get rid of the start_seg. Just need
-            // to update start region accordingly.
+#ifdef USE_REGIONS
+            // For regions the start region can go too as long as there's a region after it -
+            // pinned buffers tend to be freed in bulk, and keeping the first region of POH
+            // around means it never gets returned.
+            bool deletable_p = ((seg != start_seg) || (next_seg != 0));
+#else
+            bool deletable_p = (seg != start_seg);
+#endif //USE_REGIONS
             if ((plug_end == heap_segment_mem (seg)) &&
-                (seg != start_seg) && !heap_segment_read_only_p (seg))
+                deletable_p && !heap_segment_read_only_p (seg))
             {
                 //prepare for deletion
                 dprintf (3, ("Preparing empty large segment %zx", (size_t)seg));
-                assert (prev_seg);
-                heap_segment_next (prev_seg) = next_seg;
+                if (prev_seg)
+                {
+                    heap_segment_next (prev_seg) = next_seg;
+                }
+                else
+                {
+                    assert (seg == start_seg);
+                }
                 heap_segment_next (seg) = freeable_uoh_segment;
                 freeable_uoh_segment = seg;
 #ifdef USE_REGIONS
                 update_start_tail_regions (gen, seg, prev_seg, next_seg);
+                if (seg == start_seg)
+                {
+                    // the next region is the one we need to keep now.
+                    start_seg = next_seg;
+                }
 #endif //USE_REGIONS
             }
             else
@@ -47330,6 +48607,169 @@ void gc_heap::sweep_uoh_objects (int gen_num)
     _ASSERTE(generation_allocation_segment(gen) != NULL);
 }
 
+#ifdef USE_REGIONS
+// Called by the allocator with gc_lock held for a LOH region it just got.
+bool gc_heap::should_make_young_uoh_region_p (heap_segment* region)
+{
+    if (!use_young_uoh_p)
+    {
+        return false;
+    }
+
+#ifdef BACKGROUND_GC
+    // What a BGC marks and sweeps must not be swept by the ephemeral GCs during it.
+    if (background_running_p())
+    {
+        return false;
+    }
+#endif //BACKGROUND_GC
+
+    size_t limit = young_uoh_size_limit;
+    if (limit == 0)
+    {
+        limit = dd_desired_allocation (dynamic_data_of (soh_gen0));
+    }
+
+    size_t region_size = heap_segment_reserved (region) - get_region_start (region);
+    return ((young_uoh_size + region_size) <= limit);
+}
+
+void gc_heap::make_young_uoh_region (heap_segment* region)
+{
+    assert (heap_segment_loh_p (region));
+
+    dprintf (REGIONS_LOG, ("h%d LOH region %p(%p) is young", heap_number, region, heap_segment_mem (region)));
+
+    region->flags |= heap_segment_flags_young_uoh;
+    set_region_gen_num (region, soh_gen0);
+    heap_segment_plan_gen_num (region) = soh_gen0;
+    young_uoh_size += heap_segment_reserved (region) - get_region_start (region);
+}
+
+void gc_heap::promote_young_uoh_region (heap_segment* region)
+{
+    assert (heap_segment_young_uoh_p (region));
+
+    region->flags &= ~heap_segment_flags_young_uoh;
+    set_region_gen_num (region, max_generation);
+    heap_segment_plan_gen_num (region) = max_generation;
+
+    // Heap count changes can move regions between heaps, so this is only an estimate.
+    size_t region_size = heap_segment_reserved (region) - get_region_start (region);
+    young_uoh_size -= min (young_uoh_size, region_size);
+
+    // Stores of younger objects into these objects didn't set cards while they were in gen0
+    // themselves, so have the next ephemeral GC look at all of them.
+    size_t end_card = card_of (align_on_card (heap_segment_allocated (region)));
+    for (size_t card = card_of (heap_segment_mem (region)); card < end_card; card++)
+    {
+        set_card (card);
+    }
+}
+
+void gc_heap::promote_young_uoh_regions()
+{
+    if (!use_young_uoh_p)
+    {
+        return;
+    }
+
+    generation* gen = generation_of (loh_generation);
+    for (heap_segment* region = generation_start_segment (gen); region != nullptr; region = heap_segment_next (region))
+    {
+        if (heap_segment_young_uoh_p (region))
+        {
+            promote_young_uoh_region (region);
+        }
+    }
+}
+
+// Young LOH regions are condemned by every ephemeral GC. Dead objects are freed and regions
+// with no survivors are deleted; the rest are promoted to gen2.
+void gc_heap::sweep_young_uoh_regions()
+{
+    if (!use_young_uoh_p)
+    {
+        return;
+    }
+
+    generation* gen = generation_of (loh_generation);
+    heap_segment* region = generation_start_segment (gen);
+    heap_segment* prev_region = 0;
+    size_t freed_size = 0;
+    bool deleted_p = false;
+
+    while (region)
+    {
+        heap_segment* next_region = heap_segment_next (region);
+
+        if (!heap_segment_young_uoh_p (region))
+        {
+            prev_region = region;
+            region = next_region;
+            continue;
+        }
+
+        uint8_t* o = heap_segment_mem (region);
+        uint8_t* plug_end = o;
+        while (o < heap_segment_allocated (region))
+        {
+            uint8_t* next_o = o + AlignQword (size (o));
+            if (uoh_object_marked (o, TRUE))
+            {
+                thread_gap (plug_end, o - plug_end, gen);
+                plug_end = next_o;
+            }
+            else if (method_table (o) != g_gc_pFreeObjectMethodTable)
+            {
+                freed_size += next_o - o;
+            }
+            o = next_o;
+        }
+
+        dprintf (REGIONS_LOG, ("h%d young LOH region %p(%p) survived %zd",
+            heap_number, region, heap_segment_mem (region), (size_t)(plug_end - heap_segment_mem (region))));
+
+        if ((plug_end == heap_segment_mem (region)) &&
+            ((region != generation_start_segment (gen)) || (next_region != 0)))
+        {
+            size_t region_size = heap_segment_reserved (region) - get_region_start (region);
+            young_uoh_size -= min (young_uoh_size, region_size);
+
+            if (prev_region)
+            {
+                heap_segment_next (prev_region) = next_region;
+            }
+            heap_segment_next (region) = freeable_uoh_segment;
+            freeable_uoh_segment = region;
+            update_start_tail_regions (gen, region, prev_region, next_region);
+            deleted_p = true;
+        }
+        else
+        {
+            heap_segment_allocated (region) = plug_end;
+            decommit_heap_segment_pages (region, 0);
+            if (plug_end != heap_segment_mem (region))
+            {
+                promote_young_uoh_region (region);
+            }
+            prev_region = region;
+        }
+
+        region = next_region;
+    }
+
+    if (deleted_p)
+    {
+        generation_allocation_segment (gen) = heap_segment_rw (generation_start_segment (gen));
+    }
+
+    // What these objects took from the LOH budget should not push us towards a gen2 GC.
+    dynamic_data* dd = dynamic_data_of (loh_generation);
+    dd_new_allocation (dd) = min ((ptrdiff_t)(dd_new_allocation (dd) + freed_size), (ptrdiff_t)dd_desired_allocation (dd));
+}
+#endif //USE_REGIONS
+
 void gc_heap::relocate_in_uoh_objects (int gen_num)
 {
     generation* gen = generation_of (gen_num);
@@ -47395,6 +48835,7 @@ void gc_heap::mark_through_cards_for_uoh_objects (card_fn fn,
     size_t      n_eph             = 0;
     size_t      n_gen             = 0;
     size_t      n_card_set        = 0;
+    size_t      n_cards_scanned   = 0;
 
 #ifdef USE_REGIONS
     uint8_t*    next_boundary = 0;
@@ -47462,9 +48903,9 @@ void gc_heap::mark_through_cards_for_uoh_objects (card_fn fn,
         {
 #ifdef FEATURE_CARD_MARKING_STEALING
             // find another chunk with some cards set
-            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, start_address, limit, card, end_card, card_word_end);
+            foundp = find_next_chunk(card_mark_enumerator, seg, n_card_set, n_cards_scanned, start_address, limit, card, end_card, card_word_end);
 #else // FEATURE_CARD_MARKING_STEALING
-            foundp = find_card (card_table, card, card_word_end, end_card);
+            foundp = find_card (card_table, card, card_word_end, end_card, n_cards_scanned);
             if (foundp)
             {
                 n_card_set+= end_card - card;
@@ -47550,7 +48991,7 @@ void gc_heap::mark_through_cards_for_uoh_objects (card_fn fn,
                     {
                         passed_end_card_p = card_transition (o, end, card_word_end,
                             cg_pointers_found,
-                            n_eph, n_card_set,
+                            n_eph, n_card_set, n_cards_scanned,
                             card, end_card,
                             foundp, start_address,
                             limit, total_cards_cleared
@@ -47602,7 +49043,7 @@ go_through_refs:
                                 BOOL passed_end_card_p  = card_transition ((uint8_t*)poo, end,
                                         card_word_end,
                                         cg_pointers_found,
-                                        n_eph, n_card_set,
+                                        n_eph, n_card_set, n_cards_scanned,
                                         card, end_card,
                                         foundp, start_address,
                                         limit, total_cards_cleared
@@ -47648,6 +49089,8 @@ go_through_refs:
 #ifdef FEATURE_CARD_MARKING_STEALING
         Interlocked::ExchangeAddPtr(&n_eph_loh, n_eph);
         Interlocked::ExchangeAddPtr(&n_gen_loh, n_gen);
+        Interlocked::ExchangeAddPtr(&total_cards_scanned, n_cards_scanned);
+        Interlocked::ExchangeAddPtr(&total_cards_set, (n_card_set + total_cards_cleared));
         dprintf (3, ("h%d marking h%d Mloh: cross: %zd, useful: %zd, cards set: %zd, cards cleared: %zd, ratio: %d",
             hpt->heap_number, heap_number, n_eph, n_gen, n_card_set, total_cards_cleared,
             (n_eph ? (int)(((float)n_gen / (float)n_eph) * 100) : 0)));
@@ -47658,6 +49101,8 @@ go_through_refs:
         generation_skip_ratio = min (((n_eph > MIN_LOH_CROSS_GEN_REFS) ?
             (int)(((float)n_gen / (float)n_eph) * 100) : 100),
             generation_skip_ratio);
+        total_cards_scanned += n_cards_scanned;
+        total_cards_set += (n_card_set + total_cards_cleared);
         dprintf (3, ("marking h%d Mloh: cross: %zd, useful: %zd, cards cleared: %zd, cards set: %zd, ratio: %d",
             heap_number, n_eph, n_gen, total_cards_cleared, n_card_set, generation_skip_ratio));
 #endif //FEATURE_CARD_MARKING_STEALING
@@ -48521,7 +49966,8 @@ void gc_heap::verify_regions (int gen_number, bool can_verify_gen_num, bool can_
     {
         if (can_verify_gen_num)
         {
-            if (heap_segment_gen_num (seg_in_gen) != min (gen_number, (int)max_generation))
+            int expected_gen_num = (heap_segment_young_uoh_p (seg_in_gen) ? (int)soh_gen0 : min (gen_number, (int)max_generation));
+            if (heap_segment_gen_num (seg_in_gen) != expected_gen_num)
             {
                 dprintf (REGIONS_LOG, ("h%d gen%d region %p(%p) gen is %d!",
                     heap_number, gen_number, seg_in_gen, heap_segment_mem (seg_in_gen),
@@ -48772,9 +50218,6 @@ void gc_heap::verify_heap (BOOL begin_gc_p)
     {
         int             align_const = get_alignment_constant (curr_gen_num == max_generation);
         BOOL            large_brick_p = (curr_gen_num > max_generation);
-#ifdef USE_REGIONS
-        gen_num_for_cards = ((curr_gen_num >= max_generation) ? max_generation : curr_gen_num);
-#endif //USE_REGIONS
         heap_segment*   seg = heap_segment_in_range (generation_start_segment (generation_of (curr_gen_num) ));
 
         while (seg)
@@ -48784,6 +50227,9 @@ void gc_heap::verify_heap (BOOL begin_gc_p)
 
             bool verify_bricks_p = true;
 #ifdef USE_REGIONS
+            // Objects in young LOH regions are in gen0 and need no cards.
+            gen_num_for_cards = (heap_segment_young_uoh_p (seg) ? (int)soh_gen0 :
+                                 ((curr_gen_num >= max_generation) ? max_generation : curr_gen_num));
             if (heap_segment_read_only_p(seg))
             {
                 dprintf(1, ("seg %zx is ro! Shouldn't happen with regions", (size_t)seg));
@@ -49342,6 +50788,8 @@ HRESULT GCHeap::Initialize()
     gc_heap::gc_thread_no_affinitize_p = (gc_heap::heap_hard_limit ?
         !affinity_config_specified_p : (GCConfig::GetNoAffinitize() != 0));
 
+    gc_heap::parallel_handle_scan_p = GCConfig::GetGCParallelHandleScan();
+
     if (!(gc_heap::gc_thread_no_affinitize_p))
     {
         uint32_t num_affinitized_processors = (uint32_t)process_affinity_set->Count();
@@ -49446,8 +50894,15 @@ HRESULT GCHeap::Initialize()
     loh_size_threshold = (size_t)GCConfig::GetLOHThreshold();
     loh_size_threshold = max (loh_size_threshold, LARGE_OBJECT_SIZE);
 
+#ifdef MARK_PHASE_PREFETCH
+    mark_queue_t::set_slot_count ((size_t)GCConfig::GetGCMarkPrefetchDistance());
+#endif //MARK_PHASE_PREFETCH
+
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+#ifdef FEATURE_RELOCATE_STEALING
+    gc_heap::relocate_stealing_p = (bool)GCConfig::GetGCRelocateStealing();
+#endif //FEATURE_RELOCATE_STEALING
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -49518,6 +50973,15 @@ HRESULT GCHeap::Initialize()
     GCConfig::SetLOHThreshold(loh_size_threshold);
 
     gc_heap::min_segment_size_shr = index_of_highest_set_bit (gc_region_size);
+
+    // Transparent huge pages only help if a region covers whole huge pages; with large pages
+    // everything is already committed with large pages.
+    gc_heap::use_thp_p = GCConfig::GetGCTransparentHugePages() &&
+                         !gc_heap::use_large_pages_p &&
+                         ((gc_region_size % THP_PAGE_SIZE) == 0);
+
+    gc_heap::use_young_uoh_p = GCConfig::GetGCYoungUOH();
+    gc_heap::young_uoh_size_limit = (size_t)GCConfig::GetGCYoungUOHSize();
 #else
     gc_heap::min_segment_size_shr = index_of_highest_set_bit (gc_heap::min_segment_size);
 #endif //USE_REGIONS
@@ -49720,6 +51184,11 @@ HRESULT GCHeap::Initialize()
             {
                 gc_heap::dynamic_heap_count_data.target_tcp = (float)target_tcp;
             }
+            int target_pause = (int)GCConfig::GetGCDTargetPause();
+            if (target_pause > 0)
+            {
+                gc_heap::dynamic_heap_count_data.target_pause_ms = (float)target_pause;
+            }
             // This should be adjusted based on the target tcp. See comments in gcpriv.h
             gc_heap::dynamic_heap_count_data.around_target_threshold = 10.0;
             // This should really be set as part of computing static data and should take conserve_mem_setting into consideration.
@@ -51298,6 +52767,30 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+void gc_heap::update_recorded_phase_times (last_recorded_gc_info* gc_info)
+{
+    memset (gc_info->max_phase_durations, 0, sizeof (gc_info->max_phase_durations));
+
+    // Phase times are only recorded for blocking GCs.
+    if (settings.concurrent)
+        return;
+
+#ifdef MULTIPLE_HEAPS
+    for (int i = 0; i < gc_heap::n_heaps; i++)
+    {
+        gc_heap* hp = gc_heap::g_heaps[i];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+        for (int phase = 0; phase < max_heap_phase_time_type; phase++)
+        {
+            gc_info->max_phase_durations[phase] = max (gc_info->max_phase_durations[phase], (size_t)(hp->phase_times[phase]));
+        }
+    }
+}
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -51423,6 +52916,7 @@ void gc_heap::do_post_gc()
         ((double)total_suspended_time / (double)total_process_time * 100.0) : 0);
 
     update_recorded_gen_data (last_gc_info);
+    update_recorded_phase_times (last_gc_info);
     last_gc_info->heap_size = get_total_heap_size();
     last_gc_info->fragmentation = get_total_fragmentation();
     if (settings.exit_memory_load != 0)
@@ -51505,7 +52999,21 @@ void gc_heap::do_post_gc()
     if (!settings.concurrent)
     {
         fire_committed_usage_event ();
+        fire_region_shape_events ();
     }
+    fire_msl_contention_event ();
+#ifdef MULTIPLE_HEAPS
+#ifdef BACKGROUND_GC
+    if (settings.concurrent)
+    {
+        bgc_t_join.fire_wait_time_events ((size_t)settings.gc_index);
+    }
+    else
+#endif //BACKGROUND_GC
+    {
+        gc_t_join.fire_wait_time_events ((size_t)settings.gc_index);
+    }
+#endif //MULTIPLE_HEAPS
     GCHeap::UpdatePostGCCounters();
 
     // We need to reinitialize the number of pinned objects because it's used in the GCHeapStats
@@ -53276,6 +54784,43 @@ size_t GCHeap::GetLOHThreshold()
     return loh_size_threshold;
 }
 
+#ifdef USE_REGIONS
+struct region_shape_buffer
+{
+    gc_region_shape* regions;
+    size_t count;
+    size_t total;
+};
+
+static void copy_region_shape (const gc_region_shape& shape, void* context)
+{
+    region_shape_buffer* buffer = (region_shape_buffer*)context;
+    if (buffer->total < buffer->count)
+    {
+        buffer->regions[buffer->total] = shape;
+    }
+    buffer->total++;
+}
+#endif //USE_REGIONS
+
+size_t GCHeap::GetHeapShape (gc_region_shape* regions, size_t count)
+{
+#ifdef USE_REGIONS
+    region_shape_buffer buffer = { regions, count, 0 };
+
+    // Keeps blocking GCs from rearranging the region lists while we walk them.
+    enter_spin_lock (&gc_heap::gc_lock);
+    gc_heap::walk_region_shapes (copy_region_shape, &buffer);
+    leave_spin_lock (&gc_heap::gc_lock);
+
+    return buffer.total;
+#else
+    UNREFERENCED_PARAMETER(regions);
+    UNREFERENCED_PARAMETER(count);
+    return 0;
+#endif //USE_REGIONS
+}
+
 void GCHeap::DiagGetGCSettings(EtwGCSettingsInfo* etw_settings)
 {
 #ifdef FEATURE_EVENT_TRACE
@@ -53867,6 +55412,8 @@ bool gc_heap::compute_memory_settings(bool is_initialization, uint32_t& nhp, uin
     m_high_memory_load_th = min ((high_memory_load_th + 5), v_high_memory_load_th);
     almost_high_memory_load_th = (high_memory_load_th > 5) ? (high_memory_load_th - 5) : 1; // avoid underflow of high_memory_load_th - 5
 
+    memory_pressure_th = min (100u, (uint32_t)GCConfig::GetGCMemoryPressureTh());
+
     return true;
 }
 
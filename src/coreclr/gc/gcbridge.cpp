@@ -8,6 +8,7 @@
 #include "gcenv.h"
 #include "gc.h"
 #include "gcbridge.h"
+#include "gceventstatus.h"
 
 struct DynPtrArray
 {
@@ -438,12 +439,19 @@ static ScanData* FindData(Object* obj)
     return a;
 }
 
-static void ResetObjectsHeader()
+// Restores the headers of the objects visited by the last ProcessBridgeObjects call.
+// The object buckets are dealt out round robin, so the GC threads can each call this
+// with their own index to share the work.
+void BridgeRestoreObjectHeaders(int threadIndex, int threadCount)
 {
     ObjectBucket* cur;
+    int bucketIndex = 0;
 
-    for (cur = g_rootObjectBucket; cur; cur = cur->next)
+    for (cur = g_rootObjectBucket; cur; cur = cur->next, bucketIndex++)
     {
+        if ((bucketIndex % threadCount) != threadIndex)
+            continue;
+
         ScanData* sd;
         for (sd = &cur->data[0]; sd < cur->nextData; sd++)
         {
@@ -1050,7 +1058,6 @@ static uint64_t g_afterTarjanTime;
 
 static void BridgeFinish()
 {
-#if DUMP_GRAPH
     int bridgeCount = DynPtrArraySize(&g_registeredBridges);
     int objectCount = g_objectDataCount;
     int colorCount = g_colorDataCount;
@@ -1058,6 +1065,18 @@ static void BridgeFinish()
 
     uint64_t curtime = GetHighPrecisionTimeStamp();
 
+    FIRE_EVENT(BridgeProcessing_V1,
+        (uint64_t)g_theGCHeap->GetGcCount(),
+        (uint32_t)bridgeCount,
+        (uint32_t)objectCount,
+        (uint32_t)colorCount,
+        (uint32_t)colorsWithBridgesCount,
+        (uint32_t)g_numSccs,
+        (uint32_t)g_xrefCount,
+        (uint64_t)(g_afterTarjanTime - g_startTime),
+        (uint64_t)(curtime - g_afterTarjanTime));
+
+#if DUMP_GRAPH
     printf("GC_TAR_BRIDGE bridges %d objects %d colors %d colors-bridged %d colors-visible %d xref %d cache-hit %d cache-%s %d cache-miss %d tarjan %dms scc-setup %dms\n",
         bridgeCount, objectCount,
         colorCount, colorsWithBridgesCount, g_numSccs, g_xrefCount,
@@ -1272,7 +1291,8 @@ MarkCrossReferencesArgs* ProcessBridgeObjects()
 
     MarkCrossReferencesArgs* args = BuildSccCallbackData();
 
-    ResetObjectsHeader();
+    // The object headers still point to the ScanDatas; the GC restores them with
+    // BridgeRestoreObjectHeaders before it marks anything reachable from the bridges.
 
     BridgeFinish();
 
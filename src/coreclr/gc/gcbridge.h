@@ -11,6 +11,7 @@
 
 void BridgeResetData();
 MarkCrossReferencesArgs* ProcessBridgeObjects();
+void BridgeRestoreObjectHeaders(int threadIndex, int threadCount);
 
 void RegisterBridgeObject(Object *object, uintptr_t context);
 uint8_t** GetRegisteredBridges(size_t *pNumBridges);
@@ -102,6 +102,41 @@ OBJECTHANDLE GCHandleStore::CreateDependentHandle(Object* primary, Object* secon
     return handle;
 }
 
+uint32_t GCHandleStore::CreateHandlesOfType(Object** objects, HandleType type, OBJECTHANDLE* handles, uint32_t count)
+{
+    // a batch goes to a single table so it can be allocated under one lock acquisition
+    HHANDLETABLE handletable = _underlyingBucket.pTable[GetCurrentThreadHomeHeapNumber()];
+    uint32_t created = ::HndCreateHandles(handletable, type, handles, count);
+
+    if (objects != nullptr)
+    {
+        for (uint32_t i = 0; i < created; i++)
+        {
+            ::HndAssignHandle(handles[i], ObjectToOBJECTREF(objects[i]));
+        }
+    }
+
+    return created;
+}
+
+void GCHandleStore::DestroyHandlesOfType(OBJECTHANDLE* handles, HandleType type, uint32_t count)
+{
+    // handles created in separate batches may live in different tables, free each run from the same table at once
+    uint32_t start = 0;
+    while (start < count)
+    {
+        HHANDLETABLE handletable = ::HndGetHandleTable(handles[start]);
+        uint32_t end = start + 1;
+        while ((end < count) && (::HndGetHandleTable(handles[end]) == handletable))
+        {
+            end++;
+        }
+
+        ::HndDestroyHandles(handletable, type, handles + start, end - start);
+        start = end;
+    }
+}
+
 GCHandleStore::~GCHandleStore()
 {
     ::Ref_DestroyHandleTableBucket(&_underlyingBucket);
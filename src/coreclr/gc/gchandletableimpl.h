@@ -22,6 +22,10 @@ public:
 
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary);
 
+    virtual uint32_t CreateHandlesOfType(Object** objects, HandleType type, OBJECTHANDLE* handles, uint32_t count);
+
+    virtual void DestroyHandlesOfType(OBJECTHANDLE* handles, HandleType type, uint32_t count);
+
     virtual ~GCHandleStore();
 
     HandleTableBucket _underlyingBucket;
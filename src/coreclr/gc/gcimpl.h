@@ -206,6 +206,7 @@ public:
     FinalizerWorkItem* GetExtraWorkForFinalization();
     uint64_t GetGenerationBudget(int generation);
     size_t GetLOHThreshold();
+    size_t GetHeapShape(gc_region_shape* regions, size_t count);
 
     unsigned GetGcCount();
 
@@ -189,6 +189,9 @@ public:
     void FireDestroyGCHandle(void *handleID) PURE_VIRTUAL
     virtual
     void FirePrvDestroyGCHandle(void *handleID) PURE_VIRTUAL
+
+    virtual
+    void FireGCPerHeapPhaseTimes(uint16_t count, uint32_t valuesLen, void *values) PURE_VIRTUAL
 };
 
 // This interface provides the interface that the GC will use to speak to the rest
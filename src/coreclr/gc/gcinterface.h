@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 5
+#define GC_INTERFACE_MINOR_VERSION 7
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -239,6 +239,27 @@ struct segment_info
     size_t ibReserved; // limit of reserved memory in the segment (>= commit)
 };
 
+// Generation of a gc_region_shape that describes a free region.
+#define GC_REGION_SHAPE_FREE 0xFF
+
+// Heap of a gc_region_shape that describes a free region that doesn't belong to any heap.
+#define GC_REGION_SHAPE_NO_HEAP 0xFFFF
+
+// Metadata of a region of the GC heap, see IGCHeap::GetHeapShape.
+struct gc_region_shape
+{
+    uint8_t* start;             // first address of the region
+    size_t reserved;            // bytes reserved for the region
+    size_t committed;           // bytes committed in the region
+    size_t allocated;           // bytes allocated in the region
+    size_t survived;            // bytes of the region that survived the last GC that condemned it
+    size_t pinned_survived;     // part of survived that's in pinned plugs
+    size_t free_list;           // bytes of free objects threaded on the generation's free list
+    size_t free_obj;            // bytes of free objects that aren't on the free list
+    uint16_t heap;              // heap that owns the region, or GC_REGION_SHAPE_NO_HEAP
+    uint8_t generation;         // generation of the region, or GC_REGION_SHAPE_FREE
+};
+
 #ifdef PROFILING_SUPPORTED
 #define GC_PROFILING       //Turn on profiling
 #endif // PROFILING_SUPPORTED
@@ -590,6 +611,14 @@ public:
 
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary) PURE_VIRTUAL
 
+    // Creates up to count handles of the given type in one go, pointing at the corresponding elements of objects
+    // (or at null if objects is null). Returns the number of handles created, which is smaller than count only
+    // if the GC ran out of memory.
+    virtual uint32_t CreateHandlesOfType(Object** objects, HandleType type, OBJECTHANDLE* handles, uint32_t count) PURE_VIRTUAL
+
+    // Destroys count handles of the given type that were created by this store.
+    virtual void DestroyHandlesOfType(OBJECTHANDLE* handles, HandleType type, uint32_t count) PURE_VIRTUAL
+
     virtual ~IGCHandleStore() {};
 };
 
@@ -1068,6 +1097,12 @@ public:
 
     // Returns whether nor this GC was promoted by the last GC.
     virtual bool IsPromoted(Object* object, bool bVerifyNextHeader) PURE_VIRTUAL
+
+    // Copies the metadata of up to count regions into regions and returns the total number of regions, including
+    // free ones. This only reads the region lists, so it neither suspends the EE nor walks objects; blocking GCs
+    // are held off meanwhile but a background GC may still be sweeping, in which case the snapshot is approximate.
+    // Returns 0 if the GC doesn't use regions.
+    virtual size_t GetHeapShape(gc_region_shape* regions, size_t count) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
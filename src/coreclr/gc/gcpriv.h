@@ -358,6 +358,8 @@ struct GCDebugSpinLock {
     // time in microseconds we wait for the more space lock
     uint64_t msl_wait_time;
 #endif //DYNAMIC_HEAP_COUNT
+    // number of times a thread found the more space lock taken, reset when it's reported
+    uint32_t msl_contention_count;
 
     GCDebugSpinLock()
         : lock(-1)
@@ -370,6 +372,7 @@ struct GCDebugSpinLock {
 #if defined(DYNAMIC_HEAP_COUNT)
         , msl_wait_time(0)
 #endif //DYNAMIC_HEAP_COUNT
+        , msl_contention_count(0)
     {
     }
 
@@ -420,6 +423,12 @@ class card_marking_enumerator;
 #define CARD_MARKING_STEALING_ARGS(a,b,c)
 #endif // FEATURE_CARD_MARKING_STEALING
 
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+// With regions the relocate phase can be split up into per region work items
+// that any heap can claim, so heaps that finish early help out the others.
+#define FEATURE_RELOCATE_STEALING
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
 // The following 2 modes are of the same format as in clr\src\bcl\system\runtime\gcsettings.cs
 // make sure you change that one if you change this one!
 enum gc_pause_mode
@@ -663,6 +672,8 @@ public:
     uint32_t entry_memory_load;
     uint64_t entry_available_physical_mem;
     uint32_t exit_memory_load;
+    // Only obtained when GCMemoryPressureThreshold is specified
+    uint32_t entry_memory_pressure;
 
     void init_mechanisms(); //for each GC
     void first_init(); // for the life of the EE
@@ -748,9 +759,15 @@ typedef DPTR(class CFinalize)                  PTR_CFinalize;
 //-------------------------------------
 //generation free list. It is an array of free lists bucketed by size, starting at sizes lower than (1 << first_bucket_bits)
 //and doubling each time. The last bucket (index == num_buckets) is for largest sizes with no limit
-
-#define MAX_SOH_BUCKET_COUNT (13)//Max number of buckets for the SOH generations.
-#define MAX_BUCKET_COUNT (20)//Max number of buckets.
+//
+//With segregated fit each of these power of two buckets is further split into (1 << SFIT_SIZE_CLASS_BITS) size classes,
+//so the items of a bucket are close enough in size that the first one in the next bucket up always fits.
+
+#define SFIT_SIZE_CLASS_BITS (2)
+// POH has more power of two buckets, so it gets fewer size classes to stay within MAX_BUCKET_COUNT.
+#define POH_SFIT_SIZE_CLASS_BITS (1)
+#define MAX_SOH_BUCKET_COUNT (49)//Max number of buckets for the SOH generations.
+#define MAX_BUCKET_COUNT (49)//Max number of buckets.
 class alloc_list
 {
 #ifdef DOUBLY_LINKED_FL
@@ -820,21 +837,27 @@ struct min_fl_list_info
 class allocator
 {
     int first_bucket_bits;
+    // 0 for power of two buckets, SFIT_SIZE_CLASS_BITS for segregated fit.
+    int size_class_bits;
     unsigned int num_buckets;
     alloc_list first_bucket;
     alloc_list* buckets;
     int gen_number;
+    // Bit n is only clear if bucket n is known to be empty, it's set whenever an item may have been threaded onto it.
+    uint64_t non_empty_buckets;
     alloc_list& alloc_list_of (unsigned int bn);
     size_t& alloc_list_damage_count_of (unsigned int bn);
     void thread_free_item_end (uint8_t* free_item, uint8_t*& head, uint8_t*& tail, int bn);
 
 public:
-    allocator (unsigned int num_b, int fbb, alloc_list* b, int gen=-1);
+    allocator (unsigned int num_b, int fbb, alloc_list* b, int gen=-1, int scb=0);
 
     allocator()
     {
         num_buckets = 1;
         first_bucket_bits = sizeof(size_t) * 8 - 1;
+        size_class_bits = 0;
+        non_empty_buckets = 0;
         // for young gens we just set it to 0 since we don't treat
         // them differently from each other
         gen_number = 0;
@@ -860,7 +883,58 @@ public:
         BitScanReverse(&highest_set_bit_index, size);
     #endif
 
-        return min ((unsigned int)highest_set_bit_index, (num_buckets - 1));
+        if (size_class_bits == 0)
+        {
+            return min ((unsigned int)highest_set_bit_index, (num_buckets - 1));
+        }
+
+        // with segregated fit the size_class_bits bits below the highest set bit pick the
+        // size class within that power of two
+        unsigned int size_class = ((highest_set_bit_index >= (DWORD)size_class_bits) ?
+                                   (unsigned int)(size >> (highest_set_bit_index - size_class_bits)) :
+                                   (unsigned int)(size << (size_class_bits - highest_set_bit_index)));
+        size_class &= ((1 << size_class_bits) - 1);
+
+        return min ((((unsigned int)highest_set_bit_index << size_class_bits) | size_class), (num_buckets - 1));
+    }
+
+    bool segregated_fit_p()
+    {
+        return (size_class_bits != 0);
+    }
+
+    void set_bucket_non_empty (unsigned int bn)
+    {
+        non_empty_buckets |= ((uint64_t)1 << bn);
+    }
+
+    void set_all_buckets_non_empty()
+    {
+        non_empty_buckets = ~(uint64_t)0;
+    }
+
+    // Only called when no other thread can be threading items onto this allocator.
+    void set_bucket_empty (unsigned int bn)
+    {
+        non_empty_buckets &= ~((uint64_t)1 << bn);
+    }
+
+    // Returns the first bucket starting at bn that may have items, or num_buckets if there isn't any.
+    // Without segregated fit the buckets are few enough that this just returns bn.
+    unsigned int next_non_empty_bucket (unsigned int bn)
+    {
+        if (!segregated_fit_p() || (bn >= num_buckets))
+        {
+            return bn;
+        }
+
+        uint32_t index;
+        if (!BitScanForward64 (&index, (non_empty_buckets >> bn)))
+        {
+            return num_buckets;
+        }
+
+        return min ((bn + index), num_buckets);
     }
 
     size_t first_bucket_size()
@@ -910,6 +984,7 @@ public:
     void copy_with_no_repair (allocator* allocator_to_copy)
     {
         assert (num_buckets == allocator_to_copy->number_of_buckets());
+        set_all_buckets_non_empty();
         for (unsigned int i = 0; i < num_buckets; i++)
         {
             alloc_list* al = &(allocator_to_copy->alloc_list_of (i));
@@ -1177,6 +1252,20 @@ struct recorded_generation_info
     size_t fragmentation_after;
 };
 
+// Time each heap spent in the phases of a GC. For a BGC only mark and sweep
+// are recorded.
+enum gc_heap_phase_time
+{
+    heap_phase_mark = 0,
+    // This excludes the time of the phases plan_phase calls into.
+    heap_phase_plan = 1,
+    heap_phase_relocate = 2,
+    heap_phase_compact = 3,
+    // make_free_lists for a sweeping GC, background_sweep for a BGC.
+    heap_phase_sweep = 4,
+    max_heap_phase_time_type = 5
+};
+
 struct last_recorded_gc_info
 {
     VOLATILE(size_t) index;
@@ -1193,6 +1282,8 @@ struct last_recorded_gc_info
     uint8_t condemned_generation;
     bool compaction;
     bool concurrent;
+    // The longest time any heap spent in each phase, in microseconds.
+    size_t max_phase_durations[max_heap_phase_time_type];
 };
 
 // alignment helpers
@@ -1425,6 +1516,8 @@ static_assert(count_free_region_kinds == FREE_REGION_KINDS, "Keep count_free_reg
 static const char * const free_region_kind_name[count_free_region_kinds] = { "basic", "large", "huge"};
 #endif // TRACE_GC
 
+typedef void (*region_shape_fn)(const gc_region_shape& shape, void* context);
+
 class region_free_list
 {
     size_t  num_free_regions;
@@ -1488,19 +1581,40 @@ enum bookkeeping_element
 class mark_queue_t
 {
 #ifdef MARK_PHASE_PREFETCH
-    static const size_t slot_count = 16;
-    uint8_t* slot_table[slot_count];
+    // The number of slots in use is a power of 2 no larger than max_slot_count,
+    // it's the distance between prefetching an object and visiting it.
+    static const size_t default_slot_count = 16;
+    static const size_t max_slot_count = 64;
+    static size_t slot_count;
+    uint8_t* slot_table[max_slot_count];
     size_t curr_slot_index;
+
+    uint8_t* park (uint8_t* o);
 #endif //MARK_PHASE_PREFETCH
 
 public:
     mark_queue_t();
 
+#ifdef MARK_PHASE_PREFETCH
+    static void set_slot_count (size_t count);
+#endif //MARK_PHASE_PREFETCH
+
     uint8_t *queue_mark(uint8_t *o);
     uint8_t *queue_mark(uint8_t *o, int condemned_gen);
 
     uint8_t* get_next_marked();
 
+#ifdef BACKGROUND_GC
+    // Same as above but with the background mark bits, used by BGC marking.
+    // o must be in the range BGC marks.
+    uint8_t* queue_background_mark (uint8_t* o, gc_heap* hp);
+    uint8_t* get_next_background_marked (gc_heap* hp);
+
+    // Objects in the background queue are not marked yet and can be moved
+    // by a foreground GC, so they need to be reported as its roots.
+    void scan (promote_func* fn, ScanContext* sc);
+#endif //BACKGROUND_GC
+
     void verify_empty();
 };
 
@@ -1639,6 +1753,17 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void fire_committed_usage_event();
 
+    PER_HEAP_ISOLATED_METHOD void fire_region_shape_events();
+
+    PER_HEAP_ISOLATED_METHOD void fire_msl_contention_event();
+
+#ifdef USE_REGIONS
+    PER_HEAP_ISOLATED_METHOD void walk_region_shapes (region_shape_fn fn, void* context);
+
+    PER_HEAP_ISOLATED_METHOD void walk_region_shape_list (heap_segment* region, uint16_t heap, uint8_t gen_num, size_t max_regions,
+                                                          region_shape_fn fn, void* context);
+#endif //USE_REGIONS
+
 #ifdef FEATURE_BASICFREEZE
     PER_HEAP_ISOLATED_METHOD void walk_read_only_segment(heap_segment *seg, void *pvContext, object_callback_func pfnMethodTable, object_callback_func pfnObjRef);
 #endif
@@ -1728,6 +1853,8 @@ private:
     // This relocates the SIP regions and return the next non SIP region.
     PER_HEAP_METHOD heap_segment* relocate_advance_to_non_sip (heap_segment* region);
 
+    PER_HEAP_METHOD void relocate_in_sip_region (heap_segment* region);
+
     // Compute the size committed for the mark array for this region.
     PER_HEAP_METHOD size_t get_mark_array_size(heap_segment* seg);
 
@@ -1820,6 +1947,7 @@ private:
     PER_HEAP_ISOLATED_METHOD void do_post_gc();
 
     PER_HEAP_ISOLATED_METHOD void update_recorded_gen_data (last_recorded_gc_info* gc_info);
+    PER_HEAP_ISOLATED_METHOD void update_recorded_phase_times (last_recorded_gc_info* gc_info);
 
     PER_HEAP_METHOD void update_end_gc_time_per_heap();
 
@@ -2491,6 +2619,7 @@ private:
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_METHOD void reset_write_watch_for_gc_heap(void* base_address, size_t region_size);
     PER_HEAP_ISOLATED_METHOD void get_write_watch_for_gc_heap(bool reset, void *base_address, size_t region_size, void** dirty_pages, uintptr_t* dirty_page_count_ref, bool is_runtime_suspended);
+    PER_HEAP_ISOLATED_METHOD void get_write_watch_ranges_for_gc_heap(bool reset, void *base_address, size_t region_size, void** dirty_ranges, uintptr_t* dirty_range_count_ref, bool is_runtime_suspended);
     PER_HEAP_METHOD void switch_one_quantum();
     PER_HEAP_METHOD void reset_ww_by_chunk (uint8_t* start_address, size_t total_reset_size);
     PER_HEAP_METHOD void switch_on_reset (BOOL concurrent_p, size_t* current_total_reset_size, size_t last_reset_size);
@@ -2535,7 +2664,7 @@ private:
 #endif //CARD_BUNDLE
 
     PER_HEAP_METHOD BOOL find_card (uint32_t* card_table, size_t& card,
-                    size_t card_word_end, size_t& end_card);
+                    size_t card_word_end, size_t& end_card, size_t& n_cards_scanned);
     PER_HEAP_METHOD BOOL grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool* hard_limit_exceeded_p=NULL);
     PER_HEAP_METHOD int grow_heap_segment (heap_segment* seg, uint8_t* high_address, uint8_t* old_loc, size_t size, BOOL pad_front_p REQD_ALIGN_AND_OFFSET_DCL);
     PER_HEAP_METHOD void clear_brick_table (uint8_t* from, uint8_t* end);
@@ -2670,6 +2799,7 @@ private:
     PER_HEAP_METHOD void recommission_heap();
 
     PER_HEAP_ISOLATED_METHOD void calculate_new_heap_count();
+    PER_HEAP_ISOLATED_METHOD int calculate_new_heap_count_for_target_pause (size_t current_gc_index, int actual_n_max_heaps);
 
     // check if we should change the heap count
     PER_HEAP_METHOD void check_heap_count();
@@ -2762,6 +2892,7 @@ private:
     PER_HEAP_METHOD BOOL background_marked (uint8_t* o);
     PER_HEAP_METHOD BOOL background_mark1 (uint8_t* o);
     PER_HEAP_METHOD BOOL background_mark (uint8_t* o, uint8_t* low, uint8_t* high);
+    PER_HEAP_METHOD bool background_object_in_range_p (uint8_t* o);
     PER_HEAP_METHOD uint8_t* background_mark_object (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_METHOD void background_mark_simple (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_METHOD void background_mark_simple1 (uint8_t* o THREAD_NUMBER_DCL);
@@ -2796,6 +2927,9 @@ private:
 
     PER_HEAP_METHOD void background_ephemeral_sweep();
     PER_HEAP_METHOD void background_sweep ();
+#ifdef USE_REGIONS
+    PER_HEAP_METHOD void record_bgc_region_survival (heap_segment* region, size_t survived);
+#endif //USE_REGIONS
     // Check if we should grow the mark stack proactively to avoid mark stack
     // overflow and grow if necessary.
     PER_HEAP_METHOD void check_bgc_mark_stack_length();
@@ -2983,6 +3117,15 @@ private:
         uint8_t* last_plug;
         BOOL is_shortened;
         mark* pinned_plug_entry;
+#ifdef FEATURE_RELOCATE_STEALING
+        // When a region is relocated on its own (possibly by another heap) we
+        // can't dequeue from the owning heap's pinned plug queue; instead we
+        // walk the range of pinned plugs that was recorded for the region.
+        bool use_region_pins;
+        size_t pinned_plug_index;
+        size_t pinned_plug_end;
+        uint8_t* next_pinned_plug;
+#endif //FEATURE_RELOCATE_STEALING
     };
 
     PER_HEAP_METHOD void reloc_survivor_helper (uint8_t** pval);
@@ -3054,6 +3197,24 @@ private:
 
     PER_HEAP_METHOD mark* get_oldest_pinned_entry (BOOL* has_pre_plug_info_p, BOOL* has_post_plug_info_p);
 
+#ifdef FEATURE_RELOCATE_STEALING
+    // Records the pinned plug range of each condemned region so the regions
+    // can be relocated independently of each other.
+    PER_HEAP_METHOD void prepare_relocate_stealing (int condemned_gen_number);
+
+    PER_HEAP_METHOD bool claim_region_for_relocate (heap_segment* region);
+
+    PER_HEAP_METHOD void relocate_survivors_in_region (heap_segment* region);
+
+    // Relocates the regions not yet claimed on all heaps, starting with heap
+    // (heap_number + start_offset).
+    PER_HEAP_METHOD void relocate_survivors_stealing (int condemned_gen_number, int start_offset);
+
+    PER_HEAP_METHOD mark* get_next_region_pinned_entry (relocate_args* args,
+                                                        BOOL* has_pre_plug_info_p,
+                                                        BOOL* has_post_plug_info_p);
+#endif //FEATURE_RELOCATE_STEALING
+
     PER_HEAP_METHOD size_t recover_saved_pinned_info();
 
     PER_HEAP_METHOD void compact_phase (int condemned_gen_number, uint8_t*
@@ -3092,7 +3253,7 @@ private:
                                     CARD_MARKING_STEALING_ARG(gc_heap* hpt));
     PER_HEAP_METHOD BOOL card_transition (uint8_t* po, uint8_t* end, size_t card_word_end,
                           size_t& cg_pointers_found,
-                          size_t& n_eph, size_t& n_card_set,
+                          size_t& n_eph, size_t& n_card_set, size_t& n_cards_scanned,
                           size_t& card, size_t& end_card,
                           BOOL& foundp, uint8_t*& start_address,
                           uint8_t*& limit, size_t& n_cards_cleared
@@ -3244,6 +3405,13 @@ private:
 
     PER_HEAP_METHOD BOOL ephemeral_gen_fit_p (gc_tuning_point tp);
     PER_HEAP_METHOD void sweep_uoh_objects (int gen_num);
+#ifdef USE_REGIONS
+    PER_HEAP_METHOD bool should_make_young_uoh_region_p (heap_segment* region);
+    PER_HEAP_METHOD void make_young_uoh_region (heap_segment* region);
+    PER_HEAP_METHOD void promote_young_uoh_region (heap_segment* region);
+    PER_HEAP_METHOD void promote_young_uoh_regions();
+    PER_HEAP_METHOD void sweep_young_uoh_regions();
+#endif //USE_REGIONS
     PER_HEAP_METHOD void relocate_in_uoh_objects (int gen_num);
     PER_HEAP_METHOD void mark_through_cards_for_uoh_objects(card_fn fn, int oldest_gen_num, BOOL relocating
                                               CARD_MARKING_STEALING_ARG(gc_heap* hpt));
@@ -3457,13 +3625,14 @@ private:
     }
 
     PER_HEAP_METHOD bool find_next_chunk(card_marking_enumerator& card_mark_enumerator, heap_segment* seg,
-                         size_t& n_card_set, uint8_t*& start_address, uint8_t*& limit,
+                         size_t& n_card_set, size_t& n_cards_scanned, uint8_t*& start_address, uint8_t*& limit,
                          size_t& card, size_t& end_card, size_t& card_word_end);
 #endif //FEATURE_CARD_MARKING_STEALING
 
     PER_HEAP_ISOLATED_METHOD size_t exponential_smoothing (int gen, size_t collection_count, size_t desired_per_heap);
 
     PER_HEAP_ISOLATED_METHOD BOOL dt_high_memory_load_p();
+    PER_HEAP_ISOLATED_METHOD bool memory_pressure_high_p();
 
     PER_HEAP_ISOLATED_METHOD bool compute_hard_limit();
 
@@ -3507,6 +3676,12 @@ private:
 
     PER_HEAP_FIELD_SINGLE_GC uint8_t* oldest_pinned_plug;
 
+#ifdef FEATURE_RELOCATE_STEALING
+    // Set when every pinned plug of this heap was attributed to a condemned
+    // region so its regions can be relocated by any heap.
+    PER_HEAP_FIELD_SINGLE_GC bool relocate_regions_claimable_p;
+#endif //FEATURE_RELOCATE_STEALING
+
     PER_HEAP_FIELD_SINGLE_GC uint8_t** mark_list;
     PER_HEAP_FIELD_SINGLE_GC uint8_t** mark_list_end;
     PER_HEAP_FIELD_SINGLE_GC uint8_t** mark_list_index;
@@ -3562,6 +3737,10 @@ private:
     // But the ephemeral GCs that happen during this BGC so in that sense it can be used in multiple GCs.
     PER_HEAP_FIELD_SINGLE_GC size_t     c_mark_list_index;
 
+    // Prefetch queue for background marking, separate from mark_queue
+    // since ephemeral GCs can happen while BGC is marking.
+    PER_HEAP_FIELD_SINGLE_GC mark_queue_t background_mark_queue;
+
     PER_HEAP_FIELD_SINGLE_GC uint8_t* next_sweep_obj;
     PER_HEAP_FIELD_SINGLE_GC uint8_t* current_sweep_pos;
 
@@ -3586,7 +3765,8 @@ private:
 #endif //USE_REGIONS
 
 #ifdef WRITE_WATCH
-    PER_HEAP_FIELD_SINGLE_GC uint8_t* background_written_addresses[array_size + 2];
+    // Pairs of [start, end) dirty ranges, array_size of them.
+    PER_HEAP_FIELD_SINGLE_GC uint8_t* background_written_addresses[2 * array_size];
 #endif //WRITE_WATCH
 
 #ifdef SNOOP_STATS
@@ -3596,6 +3776,13 @@ private:
 #ifdef BGC_SERVO_TUNING
     PER_HEAP_FIELD_SINGLE_GC size_t     bgc_maxgen_end_fl_size;
 #endif //BGC_SERVO_TUNING
+
+#ifdef USE_REGIONS
+    // gen2 regions whose survival measured by the last BGC sweep was below
+    // bgc_low_surv_ratio_th, and the space they would free if evacuated.
+    PER_HEAP_FIELD_SINGLE_GC size_t     bgc_low_surv_regions;
+    PER_HEAP_FIELD_SINGLE_GC size_t     bgc_low_surv_free_size;
+#endif //USE_REGIONS
 #endif //BACKGROUND_GC
 
 #ifdef USE_REGIONS
@@ -3703,6 +3890,11 @@ private:
     PER_HEAP_FIELD_SINGLE_GC size_t total_ephemeral_size;
 #endif //USE_REGIONS
 
+    // Number of cards looked at when marking through cards in this heap's card table
+    // during the current ephemeral GC and how many of them were set.
+    PER_HEAP_FIELD_SINGLE_GC VOLATILE(size_t) total_cards_scanned;
+    PER_HEAP_FIELD_SINGLE_GC VOLATILE(size_t) total_cards_set;
+
 #ifdef FEATURE_CARD_MARKING_STEALING
     PER_HEAP_FIELD_SINGLE_GC VOLATILE(uint32_t)    card_mark_chunk_index_soh;
     PER_HEAP_FIELD_SINGLE_GC VOLATILE(bool)        card_mark_done_soh;
@@ -3830,7 +4022,8 @@ private:
     // bucket 0 contains sizes less than 128
 #define BASE_GEN2_ALIST_BITS (6)
 #endif //HOST_64BIT
-    PER_HEAP_FIELD_MAINTAINED alloc_list gen2_alloc_list[NUM_GEN2_ALIST - 1];
+#define NUM_GEN2_SFIT_ALIST (NUM_GEN2_ALIST << SFIT_SIZE_CLASS_BITS)
+    PER_HEAP_FIELD_MAINTAINED alloc_list gen2_alloc_list[NUM_GEN2_SFIT_ALIST - 1];
 
 #ifdef BACKGROUND_GC
     // Loosely maintained. Can change if the BGC thread times out and re-created.
@@ -3890,12 +4083,14 @@ private:
     // the "BITS" number here is the highest bit in 64*1024 - 1, zero-based as in BitScanReverse.
     // see first_suitable_bucket(size_t size) for details.
 #define BASE_LOH_ALIST_BITS (15)
-    PER_HEAP_FIELD_MAINTAINED_ALLOC alloc_list loh_alloc_list[NUM_LOH_ALIST - 1];
+#define NUM_LOH_SFIT_ALIST (NUM_LOH_ALIST << SFIT_SIZE_CLASS_BITS)
+    PER_HEAP_FIELD_MAINTAINED_ALLOC alloc_list loh_alloc_list[NUM_LOH_SFIT_ALIST - 1];
 
 #define NUM_POH_ALIST (19)
     // bucket 0 contains sizes less than 256
 #define BASE_POH_ALIST_BITS (7)
-    PER_HEAP_FIELD_MAINTAINED_ALLOC alloc_list poh_alloc_list[NUM_POH_ALIST - 1];
+#define NUM_POH_SFIT_ALIST (NUM_POH_ALIST << POH_SFIT_SIZE_CLASS_BITS)
+    PER_HEAP_FIELD_MAINTAINED_ALLOC alloc_list poh_alloc_list[NUM_POH_SFIT_ALIST - 1];
 
     // Keeps track of the highest address allocated by Alloc
     // Used in allocator code path. Blocking GCs do use it at the beginning (to update heap_segment_allocated) and
@@ -3912,6 +4107,10 @@ private:
 #ifdef USE_REGIONS
     // This is updated during each GC and used by the allocator path to get more regions during allocation.
     PER_HEAP_FIELD_MAINTAINED_ALLOC region_free_list free_regions[count_free_region_kinds];
+
+    // Reserved size of this heap's young LOH regions. Grown by the allocator, shrunk by GCs when
+    // they free or promote those regions. Only used to cap how many regions are made young.
+    PER_HEAP_FIELD_MAINTAINED_ALLOC size_t young_uoh_size;
 #endif //USE_REGIONS
 
     /*******************************/
@@ -3995,6 +4194,9 @@ private:
     // For dprintf in do_pre_gc
     PER_HEAP_FIELD_DIAG_ONLY size_t allocated_since_last_gc[total_oh_count];
 
+    // This heap's phase times of the current GC, in microseconds.
+    PER_HEAP_FIELD_DIAG_ONLY uint64_t phase_times[max_heap_phase_time_type];
+
     PER_HEAP_FIELD_DIAG_ONLY fgm_history fgm_result;
 
     struct gc_history
@@ -4022,6 +4224,12 @@ private:
     PER_HEAP_FIELD_DIAG_ONLY int gchist_index_per_heap;
     PER_HEAP_FIELD_DIAG_ONLY gc_history gchist_per_heap[max_history_count];
 
+#if defined(MULTIPLE_HEAPS) && defined(USE_REGIONS)
+    // Number of free regions this heap took that were committed on a different
+    // NUMA node than the one this heap is on.
+    PER_HEAP_FIELD_DIAG_ONLY size_t num_remote_regions;
+#endif //MULTIPLE_HEAPS && USE_REGIONS
+
 #if defined(MULTIPLE_HEAPS) && defined(_DEBUG)
     PER_HEAP_FIELD_DIAG_ONLY size_t committed_by_oh_per_heap[total_oh_count];
     PER_HEAP_FIELD_DIAG_ONLY size_t committed_by_oh_per_heap_refresh[total_oh_count];
@@ -4084,7 +4292,7 @@ private:
     // This event is only to give us a rough idea of the largest gen2 fl
     // items or plugs that we had to allocate in condemned. We only fire
     // these events on verbose level and stop at max_etw_item_count items.
-    PER_HEAP_FIELD_DIAG_ONLY etw_bucket_info bucket_info[NUM_GEN2_ALIST];
+    PER_HEAP_FIELD_DIAG_ONLY etw_bucket_info bucket_info[NUM_GEN2_SFIT_ALIST];
 #endif //FEATURE_EVENT_TRACE
 
 #ifdef SPINLOCK_HISTORY
@@ -4385,6 +4593,12 @@ private:
         float target_tcp = 2.0;
         float target_gen2_tcp = 10.0;
 
+        // If this is set (GCDTargetPause), the ephemeral samples are used to keep the median ephemeral
+        // GC pause under this many ms instead of keeping the tcp around target_tcp. We only shrink the
+        // heap count when the pause is below target_pause_headroom of the target.
+        float target_pause_ms = 0.0;
+        float target_pause_headroom = 0.5;
+
         static const int recorded_adjustment_size = 4;
         static const int sample_size = 3;
         static const int recorded_tcp_array_size = 64;
@@ -5265,6 +5479,8 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint32_t m_high_memory_load_th;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint32_t v_high_memory_load_th;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint32_t almost_high_memory_load_th;
+    // 0 means we don't look at the memory pressure.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint32_t memory_pressure_th;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool is_restricted_physical_mem;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint64_t mem_one_percent;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint64_t total_physical_mem;
@@ -5348,11 +5564,28 @@ private:
     // Indicate to use large pages. This only works if hardlimit is also enabled.
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_large_pages_p;
 
+#ifdef USE_REGIONS
+    // Indicate to commit and decommit gen0/gen1 regions in THP_PAGE_SIZE units and to advise
+    // the OS to back them with transparent huge pages. Unlike large pages this doesn't need
+    // the memory to be reserved up front so it doesn't require a hard limit.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_thp_p;
+
+    // Indicate to put new LOH regions in gen0 (GCYoungUOH) so short lived large objects are
+    // reclaimed by the next ephemeral GC instead of waiting for a gen2 GC. Objects that survive
+    // it are promoted to gen2 with their region.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_young_uoh_p;
+
+    // Per heap cap on young_uoh_size (GCYoungUOHSize), 0 means use the gen0 budget.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t young_uoh_size_limit;
+#endif //USE_REGIONS
+
 #ifdef MULTIPLE_HEAPS
     // Init-ed in gc_heap::initialize_gc
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY gc_heap** g_heaps;
 
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool gc_thread_no_affinitize_p;
+    // Whether GC threads share the weak and dependent handle scans of all heaps (GCParallelHandleScan).
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool parallel_handle_scan_p;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_gen0_balance_delta;
 
 #define alloc_quantum_balance_units (16)
@@ -5375,6 +5608,9 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+#ifdef FEATURE_RELOCATE_STEALING
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool relocate_stealing_p;
+#endif //FEATURE_RELOCATE_STEALING
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -5574,6 +5810,15 @@ private:
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY etw_loh_compact_info* loh_compact_info;
 #endif //FEATURE_LOH_COMPACTION
 
+    // The per heap phase times compressed to 32-bit for the
+    // GCPerHeapPhaseTimes event, one entry per heap.
+    struct etw_heap_phase_time_info
+    {
+        uint32_t times[max_heap_phase_time_type];
+    };
+
+    PER_HEAP_ISOLATED_FIELD_DIAG_ONLY etw_heap_phase_time_info* heap_phase_time_info;
+
     // config stuff and only init-ed once at the beginning.
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t physical_memory_from_config;
     PER_HEAP_ISOLATED_FIELD_DIAG_ONLY size_t gen0_min_budget_from_config;
@@ -6167,6 +6412,8 @@ struct loh_padding_obj
 
 #ifdef USE_REGIONS
 #define heap_segment_flags_demoted       2048
+// A LOH region whose objects are in gen0 until the next GC, see use_young_uoh_p.
+#define heap_segment_flags_young_uoh     4096
 
 struct generation_region_info
 {
@@ -6251,6 +6498,22 @@ public:
     PTR_heap_segment prev_free_region;
     region_free_list* containing_free_list;
 
+#ifdef MULTIPLE_HEAPS
+    // The NUMA node of the heap this region was first committed for. Physical
+    // pages are bound to a node when they are committed, so a region that is
+    // reused by a heap on another node after going through the free list is
+    // remote memory for that heap.
+    uint16_t        numa_node;
+#endif //MULTIPLE_HEAPS
+
+#ifdef FEATURE_RELOCATE_STEALING
+    // Range of this region's entries in the owning heap's pinned plug queue
+    // and whether a heap has already claimed it in the relocate phase.
+    size_t          reloc_pin_start;
+    size_t          reloc_pin_end;
+    int32_t         reloc_claimed;
+#endif //FEATURE_RELOCATE_STEALING
+
     // Fields that we need to provide in response to a
     // random address that might land anywhere on the region.
     // - heap
@@ -6687,6 +6950,30 @@ int& heap_segment_pinned_survived (heap_segment* inst)
 {
     return inst->pinned_survived;
 }
+#ifdef MULTIPLE_HEAPS
+inline
+uint16_t& heap_segment_numa_node (heap_segment* inst)
+{
+    return inst->numa_node;
+}
+#endif //MULTIPLE_HEAPS
+#ifdef FEATURE_RELOCATE_STEALING
+inline
+size_t& heap_segment_reloc_pin_start (heap_segment* inst)
+{
+    return inst->reloc_pin_start;
+}
+inline
+size_t& heap_segment_reloc_pin_end (heap_segment* inst)
+{
+    return inst->reloc_pin_end;
+}
+inline
+int32_t& heap_segment_reloc_claimed (heap_segment* inst)
+{
+    return inst->reloc_claimed;
+}
+#endif //FEATURE_RELOCATE_STEALING
 inline
 uint8_t* heap_segment_free_list_head (heap_segment* inst)
 {
@@ -6712,6 +6999,11 @@ bool heap_segment_demoted_p (heap_segment* inst)
 {
     return ((inst->flags & heap_segment_flags_demoted) != 0);
 }
+inline
+bool heap_segment_young_uoh_p (heap_segment* inst)
+{
+    return ((inst->flags & heap_segment_flags_young_uoh) != 0);
+}
 #endif //USE_REGIONS
 
 inline
@@ -17,6 +17,7 @@
 #include "gcscan.h"
 #include "gc.h"
 #include "objecthandle.h"
+#include "gcbridge.h"
 
 VOLATILE(int32_t) GCScan::m_GcStructuresInvalidCnt = 1;
 
@@ -58,6 +59,13 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // Have the first pass over the table record the handles whose primary isn't promoted yet, so that later
+    // passes only look at those instead of the whole table. Handles may change under a concurrent scan, so the
+    // worklist is only used when the EE is suspended.
+    pDhContext->m_fBuildingWorklist = !sc->concurrent;
+    pDhContext->m_fWorklistValid = !sc->concurrent;
+    pDhContext->m_cWorklist = 0;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -85,25 +93,36 @@ bool GCScan::GcDhUnpromotedHandlesExist(ScanContext* sc)
 // this method in a loop. The scan records state that let's us know when to terminate (no further handles to
 // be promoted or no promotions in the last scan). Returns true if at least one object was promoted as a
 // result of the scan.
-bool GCScan::GcDhReScan(ScanContext* sc)
+bool GCScan::GcDhReScan(ScanContext* sc, bool parallel_p)
 {
     // Locate our dependent handle context based on the GC context.
     DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
 
-    return Ref_ScanDependentHandlesForPromotion(pDhContext);
+    return Ref_ScanDependentHandlesForPromotion(pDhContext, parallel_p);
+}
+
+void GCScan::GcPrepareParallelDhReScan()
+{
+    Ref_ResetParallelScan(REF_PSCAN_DH_PROMOTION);
 }
 
 /*
  * Scan for dead weak pointers
  */
 
-void GCScan::GcWeakPtrScan(int condemned, int max_gen, ScanContext* sc)
+void GCScan::GcWeakPtrScan(int condemned, int max_gen, ScanContext* sc, bool parallel_p)
 {
     // Clear out weak pointers that are no longer live.
-    Ref_CheckReachable(condemned, max_gen, sc);
+    Ref_CheckReachable(condemned, max_gen, sc, parallel_p);
 
     // Clear any secondary objects whose primary object is now definitely dead.
-    Ref_ScanDependentHandlesForClearing(condemned, max_gen, sc);
+    Ref_ScanDependentHandlesForClearing(condemned, max_gen, sc, parallel_p);
+}
+
+void GCScan::GcPrepareParallelWeakPtrScan()
+{
+    Ref_ResetParallelScan(REF_PSCAN_LONG_WEAK);
+    Ref_ResetParallelScan(REF_PSCAN_DH_CLEARING);
 }
 
 static void CALLBACK CheckPromoted(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t * /*pExtraInfo*/, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
@@ -139,9 +158,14 @@ void GCScan::GcScanSizedRefs(promote_func* fn, int condemned, int max_gen, ScanC
 }
 #endif // FEATURE_SIZED_REF_HANDLES
 
-void GCScan::GcShortWeakPtrScan(int condemned, int max_gen, ScanContext* sc)
+void GCScan::GcShortWeakPtrScan(int condemned, int max_gen, ScanContext* sc, bool parallel_p)
 {
-    Ref_CheckAlive(condemned, max_gen, sc);
+    Ref_CheckAlive(condemned, max_gen, sc, parallel_p);
+}
+
+void GCScan::GcPrepareParallelShortWeakPtrScan()
+{
+    Ref_ResetParallelScan(REF_PSCAN_SHORT_WEAK);
 }
 
 /*
@@ -188,6 +212,15 @@ uint8_t** GCScan::GcProcessBridgeObjects (int condemned, int max_gen, ScanContex
 
     return bridgeObjectsToPromote;
 }
+
+/*
+ * Bridge processing keeps its bookkeeping in the headers of the objects it visits.
+ * Each GC thread restores its share of them before any of these objects get marked.
+ */
+void GCScan::GcRestoreBridgeObjectHeaders (int thread, int num_threads)
+{
+    BridgeRestoreObjectHeaders (thread, num_threads);
+}
 #endif //FEATURE_JAVAMARSHAL
 
 /*
@@ -20,6 +20,14 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+// A dependent handle whose primary wasn't promoted yet when the worklist was built. Objects don't move while
+// marking, so the primary is recorded by value and is what the worklist is sorted on.
+struct DhWorkItem
+{
+    Object         *m_pPrimary;                 // The primary object of the handle
+    Object        **m_ppSecondary;              // The secondary slot of the handle, NULL once the item is done
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
@@ -28,6 +36,11 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    bool            m_fBuildingWorklist;        // Is the current table scan recording unpromoted handles?
+    bool            m_fWorklistValid;           // Does the worklist hold every handle that may still be promoted?
+    DhWorkItem     *m_pWorklist;                // Handles with an unpromoted primary, sorted by primary
+    size_t          m_cWorklist;                // Number of items in use in m_pWorklist
+    size_t          m_cWorklistCapacity;        // Number of items allocated for m_pWorklist
 };
 
 class GCScan
@@ -45,6 +58,7 @@ class GCScan
 
 #ifdef FEATURE_JAVAMARSHAL
     static uint8_t** GcProcessBridgeObjects (int condemned, int max_gen, ScanContext* sc, size_t* numObjs);
+    static void GcRestoreBridgeObjectHeaders (int thread, int num_threads);
 #endif //FEATURE_JAVAMARSHAL
 
     static void GcRuntimeStructuresValid (BOOL bValid);
@@ -58,11 +72,18 @@ class GCScan
     static void GcScanDependentHandlesForProfilerAndETW (int max_gen, ScanContext* sc, handle_scan_fn fn);
 
     // scan for dead weak pointers
-    static void GcWeakPtrScan (int condemned, int max_gen, ScanContext*sc);
+    static void GcWeakPtrScan (int condemned, int max_gen, ScanContext*sc, bool parallel_p = false);
     static void GcWeakPtrScanBySingleThread (int condemned, int max_gen, ScanContext*sc);
 
     // scan for dead weak pointers
-    static void GcShortWeakPtrScan (int condemned, int max_gen, ScanContext* sc);
+    static void GcShortWeakPtrScan (int condemned, int max_gen, ScanContext* sc, bool parallel_p = false);
+
+    // With parallel_p the scans above (and GcDhReScan below) are shared by all GC threads, which claim handle
+    // table segments from every heap. The matching prepare method must be called by a single thread before
+    // any thread starts such a scan.
+    static void GcPrepareParallelShortWeakPtrScan ();
+    static void GcPrepareParallelWeakPtrScan ();
+    static void GcPrepareParallelDhReScan ();
 
     //
     // Dependent handle promotion scan support
@@ -77,7 +98,7 @@ class GCScan
 
     // Rescan the handles for additional primaries that have been promoted since the last scan. Return true if
     // any objects were promoted as a result.
-    static bool GcDhReScan(ScanContext* sc);
+    static bool GcDhReScan(ScanContext* sc, bool parallel_p = false);
 
     // post-promotions callback
     static void GcPromotionsGranted (int condemned, int max_gen,
@@ -426,6 +426,135 @@ void HndDestroyHandleOfUnknownType(HHANDLETABLE hTable, OBJECTHANDLE handle)
     HndDestroyHandle(hTable, HandleFetchType(handle), handle);
 }
 
+
+/*
+ * HndCreateHandles
+ *
+ * Entrypoint for allocating a batch of handles of the same type.
+ *
+ * The handles are returned with a NULL referent. Batches that are larger than
+ * a cache bank are allocated straight from the segments under a single
+ * acquisition of the table lock instead of going through the cache one handle
+ * at a time.
+ *
+ * Returns the number of handles that were allocated, which is smaller than
+ * uCount only in out-of-memory conditions.
+ *
+ */
+uint32_t HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    uint32_t uSatisfied = 0;
+
+    if (uCount > HANDLES_PER_CACHE_BANK)
+    {
+        CrstHolder ch(&pTable->Lock);
+
+        // we intentionally don't check for success here - the cache may still have some handles
+        FAULT_NOT_FATAL();
+
+        uSatisfied = TableAllocBulkHandles(pTable, uType, pHandles, uCount);
+    }
+
+    // small batches, or whatever the bulk allocation couldn't satisfy, come from the cache
+    if (uSatisfied < uCount)
+        uSatisfied += TableAllocHandlesFromCache(pTable, uType, pHandles + uSatisfied, uCount - uSatisfied);
+
+    for (uint32_t i = 0; i < uSatisfied; i++)
+    {
+#ifdef DEBUG_DestroyedHandleValue
+        if (*(_UNCHECKED_OBJECTREF *)pHandles[i] == DEBUG_DestroyedHandleValue)
+            *(_UNCHECKED_OBJECTREF *)pHandles[i] = NULL;
+#endif
+
+        // the handles better not point at anything yet
+        _ASSERTE(*(_UNCHECKED_OBJECTREF *)pHandles[i] == NULL);
+    }
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles += uSatisfied;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+
+    STRESS_LOG3(LF_GC, LL_INFO1000, "CreateHandles: %p, count=%d, type=%d\n", uSatisfied ? pHandles[0] : NULL, uSatisfied, uType);
+
+    // return the number of handles we allocated
+    return uSatisfied;
+}
+
+
+/*
+ * HndDestroyHandles
+ *
+ * Entrypoint for freeing a batch of handles of the same type.
+ *
+ * Batches that are larger than a cache bank are sorted and returned straight
+ * to their segments under a single acquisition of the table lock.
+ *
+ */
+void HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (!uCount)
+        return;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    STRESS_LOG3(LF_GC, LL_INFO1000, "DestroyHandles: %p, count=%d, type=%d\n", pHandles[0], uCount, uType);
+
+    for (uint32_t i = 0; i < uCount; i++)
+    {
+        // sanity check handles we are being asked to free
+        _ASSERTE(pHandles[i]);
+        _ASSERTE(HandleFetchType(pHandles[i]) == uType);
+        _ASSERTE(HndGetHandleTable(pHandles[i]) == hTable);
+
+        FIRE_EVENT(DestroyGCHandle, (void *)pHandles[i]);
+        FIRE_EVENT(PrvDestroyGCHandle, (void *)pHandles[i]);
+    }
+
+    if (uCount > HANDLES_PER_CACHE_BANK)
+    {
+        // this zeroes the handles before putting them back in their segments
+        CrstHolder ch(&pTable->Lock);
+        TableFreeBulkUnpreparedHandles(pTable, uType, pHandles, uCount);
+    }
+    else
+    {
+        // return the handles to the table's cache
+        TableFreeHandlesToCache(pTable, uType, pHandles, uCount);
+    }
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles -= uCount;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+}
+
 /*
  * HndSetHandleExtraInfo
  *
@@ -802,6 +931,85 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
 
 #ifndef DACCESS_COMPILE
 
+/*
+ * HndResetParallelScan
+ *
+ * Rewinds a cooperative scan cursor to the start of the table's segment list.
+ *
+ * This must be done by a single thread while no other thread scans with the
+ * same cursor, typically inside a GC join.
+ *
+ */
+void HndResetParallelScan(HHANDLETABLE hTable, uint32_t cursor)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(cursor < HNDPSCAN_CURSORS);
+
+    HandleTable *pTable = Table(hTable);
+    pTable->rgpParallelScanSegment[cursor] = pTable->pSegmentList;
+}
+
+
+/*
+ * HndScanHandlesForGCParallel
+ *
+ * Cooperative variant of HndScanHandlesForGC.
+ *
+ * Every GC thread that calls this with the same cursor scans a disjoint set of
+ * the table's segments; together they scan the whole table once. Only blocking
+ * scans with a callback are supported, and no aging is done along the way.
+ *
+ */
+void HndScanHandlesForGCParallel(HHANDLETABLE hTable, uint32_t cursor, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                 const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(scanProc);
+    _ASSERTE((flags & (HNDGCF_ASYNC | HNDGCF_AGE)) == 0);
+
+    // fetch the table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // do we need to support user data?
+    BOOL enumUserData =
+        ((flags & HNDGCF_EXTRAINFO) &&
+        TypesRequireUserDataScanning(pTable, types, typeCount));
+
+    // pick the same block callbacks HndScanHandlesForGC would
+    BLOCKSCANPROC pfnBlock;
+    if (condemned >= maxgen)
+    {
+        pfnBlock = enumUserData ? BlockScanBlocksWithUserData : BlockScanBlocksWithoutUserData;
+    }
+    else
+    {
+        pfnBlock = BlockScanBlocksEphemeral;
+    }
+
+    // set up parameters for scan callbacks
+    ScanCallbackInfo info;
+
+    info.uFlags          = flags;
+    info.fEnumUserData   = enumUserData;
+    info.dwAgeMask       = BuildAgeMask(condemned, maxgen);
+    info.pCurrentSegment = NULL;
+    info.pfnScan         = scanProc;
+    info.param1          = param1;
+    info.param2          = param2;
+
+#ifdef _DEBUG
+    info.DEBUG_BlocksScanned                = 0;
+    info.DEBUG_BlocksScannedNonTrivially    = 0;
+    info.DEBUG_HandleSlotsScanned           = 0;
+    info.DEBUG_HandlesActuallyScanned       = 0;
+#endif
+
+    TableScanHandlesParallel(pTable, cursor, types, typeCount, pfnBlock, &info);
+}
+
+
 
 /*
  * HndResetAgeMap
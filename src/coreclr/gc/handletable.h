@@ -71,6 +71,12 @@ void            HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHAND
 
 void            HndDestroyHandleOfUnknownType(HHANDLETABLE hTable, OBJECTHANDLE handle);
 
+/*
+ * bulk handle allocation and deallocation
+ */
+uint32_t        HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE *pHandles, uint32_t uCount);
+void            HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount);
+
 /*
  * owner data associated with handles
  */
@@ -123,6 +129,28 @@ void            HndScanHandlesForGC(HHANDLETABLE hTable,
                                     uint32_t maxgen,
                                     uint32_t flags);
 
+/*
+ * Cooperative GC-time handle scanning
+ *
+ * Several GC threads may scan the same table at once by claiming its segments from a shared
+ * cursor. A cursor must be reset by a single thread before any thread starts claiming from it.
+ */
+#define HNDPSCAN_CURSORS    (4)
+
+#ifndef DACCESS_COMPILE
+void            HndResetParallelScan(HHANDLETABLE hTable, uint32_t cursor);
+void            HndScanHandlesForGCParallel(HHANDLETABLE hTable,
+                                            uint32_t cursor,
+                                            HANDLESCANPROC scanProc,
+                                            uintptr_t param1,
+                                            uintptr_t param2,
+                                            const uint32_t *types,
+                                            uint32_t typeCount,
+                                            uint32_t condemned,
+                                            uint32_t maxgen,
+                                            uint32_t flags);
+#endif // !DACCESS_COMPILE
+
 void            HndResetAgeMap(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags);
 
@@ -403,6 +403,11 @@ struct HandleTable
      */
     AsyncScanInfo *pAsyncScanInfo;
 
+    /*
+     * next segment to hand out for each cooperative GC scan (see HndScanHandlesForGCParallel)
+     */
+    PTR_TableSegment rgpParallelScanSegment[HNDPSCAN_CURSORS];  // interlocked ops used here
+
     /*
      * per-table user info
      */
@@ -810,6 +815,22 @@ void CALLBACK xxxTableScanHandlesAsync(PTR_HandleTable pTable,
                                        CrstHolderWithState *pCrstHolder);
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * TableScanHandlesParallel
+ *
+ * Implements handle scanning for a table that several GC threads scan at once.
+ *
+ */
+void CALLBACK TableScanHandlesParallel(PTR_HandleTable pTable,
+                                       uint32_t uCursor,
+                                       const uint32_t *puType,
+                                       uint32_t uTypeCount,
+                                       BLOCKSCANPROC pfnBlockHandler,
+                                       ScanCallbackInfo *pInfo);
+#endif
+
+
 /*
  * TypesRequireUserDataScanning
  *
@@ -1761,6 +1761,89 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
 }
 
 
+#ifndef DACCESS_COMPILE
+/*
+ * TableClaimSegmentForParallelScan
+ *
+ * Hands out the next unclaimed segment of a cooperative scan, or NULL once
+ * every segment of the table has been claimed.
+ *
+ */
+static TableSegment *TableClaimSegmentForParallelScan(HandleTable *pTable, uint32_t uCursor)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    TableSegment **ppCursor = (TableSegment **)&pTable->rgpParallelScanSegment[uCursor];
+    TableSegment *pSegment = VolatileLoad(ppCursor);
+
+    while (pSegment)
+    {
+        TableSegment *pSeen = (TableSegment *)Interlocked::CompareExchangePointer((void **)ppCursor,
+                                                                                 (void *)pSegment->pNextSegment,
+                                                                                 (void *)pSegment);
+        if (pSeen == pSegment)
+            break;
+
+        pSegment = pSeen;
+    }
+
+    return pSegment;
+}
+
+
+/*
+ * TableScanHandlesParallel
+ *
+ * Implements the core handle scanning loop for a table that several GC threads
+ * scan at once. Rather than walking the segment list each thread keeps claiming
+ * segments until there are none left.
+ *
+ * N.B. segments are neither trimmed nor freed here since other threads may be
+ *      walking the list; the serial scans of the same GC still do that.
+ *
+ */
+void CALLBACK TableScanHandlesParallel(PTR_HandleTable pTable,
+                                       uint32_t uCursor,
+                                       const uint32_t *puType,
+                                       uint32_t uTypeCount,
+                                       BLOCKSCANPROC pfnBlockHandler,
+                                       ScanCallbackInfo *pInfo)
+{
+    WRAPPER_NO_CONTRACT;
+
+    // sanity - we need a callback, a type array and a valid cursor
+    _ASSERTE(pInfo && pfnBlockHandler && puType && uTypeCount);
+    _ASSERTE(uCursor < HNDPSCAN_CURSORS);
+
+    // we may need a type inclusion map for multi-type scans
+    BOOL rgTypeInclusion[INCLUSION_MAP_SIZE];
+    if (uTypeCount > 1)
+        BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
+
+    TableSegment *pSegment;
+    while ((pSegment = TableClaimSegmentForParallelScan(pTable, uCursor)) != NULL)
+    {
+        // only the thread that claimed a segment touches its chains, but the
+        // resort still needs to synchronize with preemptive mode allocations
+        if (pSegment->fResortChains)
+        {
+            CrstHolder ch(&pTable->Lock);
+            SegmentResortChains(pSegment);
+        }
+
+        pInfo->pCurrentSegment = pSegment;
+
+        if (uTypeCount == 1)
+            SegmentScanByTypeChain(pSegment, *puType, pfnBlockHandler, pInfo);
+        else
+            SegmentScanByTypeMap(pSegment, rgTypeInclusion, pfnBlockHandler, pInfo);
+
+        pInfo->pCurrentSegment = NULL;
+    }
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * xxxTableScanHandlesAsync
  *
@@ -227,6 +227,169 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Record a dependent handle with an unpromoted primary in the worklist. If the worklist can't grow it is given up
+// on and promotion keeps scanning the handle tables.
+static void AddDependentHandleWorkItem(DhContext *pDhContext, Object *pPrimary, Object **ppSecondary)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!pDhContext->m_fWorklistValid)
+        return;
+
+    if (pDhContext->m_cWorklist == pDhContext->m_cWorklistCapacity)
+    {
+        size_t cNewCapacity = (pDhContext->m_cWorklistCapacity != 0) ? (pDhContext->m_cWorklistCapacity * 2) : 256;
+        DhWorkItem *pNewWorklist = new (nothrow) DhWorkItem[cNewCapacity];
+        if (pNewWorklist == NULL)
+        {
+            pDhContext->m_fWorklistValid = false;
+            return;
+        }
+
+        if (pDhContext->m_pWorklist != NULL)
+        {
+            memcpy(pNewWorklist, pDhContext->m_pWorklist, pDhContext->m_cWorklist * sizeof(DhWorkItem));
+            delete [] pDhContext->m_pWorklist;
+        }
+
+        pDhContext->m_pWorklist = pNewWorklist;
+        pDhContext->m_cWorklistCapacity = cNewCapacity;
+    }
+
+    DhWorkItem *pItem = &pDhContext->m_pWorklist[pDhContext->m_cWorklist++];
+    pItem->m_pPrimary = pPrimary;
+    pItem->m_ppSecondary = ppSecondary;
+}
+
+// Heap sort the worklist by primary so the items of a primary can be found with a binary search.
+static void SortDependentHandleWorklist(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DhWorkItem *pItems = pDhContext->m_pWorklist;
+    size_t cItems = pDhContext->m_cWorklist;
+    if (cItems < 2)
+        return;
+
+    auto siftDown = [pItems](size_t iRoot, size_t cHeap)
+    {
+        for (;;)
+        {
+            size_t iChild = iRoot * 2 + 1;
+            if (iChild >= cHeap)
+                break;
+            if ((iChild + 1 < cHeap) && (pItems[iChild].m_pPrimary < pItems[iChild + 1].m_pPrimary))
+                iChild++;
+            if (!(pItems[iRoot].m_pPrimary < pItems[iChild].m_pPrimary))
+                break;
+            DhWorkItem tmp = pItems[iRoot];
+            pItems[iRoot] = pItems[iChild];
+            pItems[iChild] = tmp;
+            iRoot = iChild;
+        }
+    };
+
+    for (size_t i = cItems / 2; i-- > 0; )
+        siftDown(i, cItems);
+
+    for (size_t cHeap = cItems - 1; cHeap > 0; cHeap--)
+    {
+        DhWorkItem tmp = pItems[0];
+        pItems[0] = pItems[cHeap];
+        pItems[cHeap] = tmp;
+        siftDown(0, cHeap);
+    }
+}
+
+// pPrimary is now known to be promoted: promote the secondaries of all its items, then follow the secondaries that
+// are primaries themselves. Chains of dependent handles are thus promoted in one go rather than one link per pass.
+// Objects only reachable through what gets promoted here are picked up by the next pass.
+static void PromoteDependentHandleWorkItems(DhContext *pDhContext, Object *pPrimary)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    const int cMaxStack = 64;
+    Object *rgStack[cMaxStack];
+    int cStack = 0;
+    rgStack[cStack++] = pPrimary;
+
+    DhWorkItem *pItems = pDhContext->m_pWorklist;
+    size_t cItems = pDhContext->m_cWorklist;
+
+    while (cStack > 0)
+    {
+        Object *pObject = rgStack[--cStack];
+
+        // find the first item for pObject
+        size_t iLow = 0;
+        size_t iHigh = cItems;
+        while (iLow < iHigh)
+        {
+            size_t iMid = iLow + (iHigh - iLow) / 2;
+            if (pItems[iMid].m_pPrimary < pObject)
+                iLow = iMid + 1;
+            else
+                iHigh = iMid;
+        }
+
+        for (size_t i = iLow; (i < cItems) && (pItems[i].m_pPrimary == pObject); i++)
+        {
+            Object **ppSecondary = pItems[i].m_ppSecondary;
+            if (ppSecondary == NULL)
+                continue;
+
+            pItems[i].m_ppSecondary = NULL;
+
+            if (!g_theGCHeap->IsPromoted(*ppSecondary))
+            {
+                LOG((LF_GC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*ppSecondary)));
+                pDhContext->m_pfnPromoteFunction(ppSecondary, pDhContext->m_pScanContext, 0);
+                pDhContext->m_fPromoted = true;
+
+                // if the stack is full the secondary's own items are left for the next pass
+                if (cStack < cMaxStack)
+                    rgStack[cStack++] = *ppSecondary;
+            }
+        }
+    }
+}
+
+// Promotion passes over the worklist. Every pass only visits the handles that were still pending after the last
+// one, and drops the ones it completes.
+static bool ScanDependentHandleWorklist(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    bool fAnyPromotions = false;
+
+    do
+    {
+        pDhContext->m_fPromoted = false;
+
+        DhWorkItem *pItems = pDhContext->m_pWorklist;
+        for (size_t i = 0; i < pDhContext->m_cWorklist; i++)
+        {
+            if ((pItems[i].m_ppSecondary != NULL) && g_theGCHeap->IsPromoted(pItems[i].m_pPrimary))
+                PromoteDependentHandleWorkItems(pDhContext, pItems[i].m_pPrimary);
+        }
+
+        size_t cPending = 0;
+        for (size_t i = 0; i < pDhContext->m_cWorklist; i++)
+        {
+            if (pItems[i].m_ppSecondary != NULL)
+                pItems[cPending++] = pItems[i];
+        }
+        pDhContext->m_cWorklist = cPending;
+        pDhContext->m_fUnpromotedPrimaries = (cPending != 0);
+
+        if (pDhContext->m_fPromoted)
+            fAnyPromotions = true;
+
+    } while (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
+
+    return fAnyPromotions;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -262,6 +425,9 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        if (pDhContext->m_fBuildingWorklist)
+            AddDependentHandleWorkItem(pDhContext, *pPrimaryRef, pSecondaryRef);
     }
 }
 
@@ -696,7 +862,7 @@ bool Ref_Initialize()
 
     // Allocate contexts used during dependent handle promotion scanning. There's one of these for every GC
     // heap since they're scanned in parallel.
-    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots];
+    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots]();
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
@@ -718,6 +884,11 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+        {
+            delete [] g_pDependentHandleContexts[i].m_pWorklist;
+        }
+
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -888,6 +1059,64 @@ int getThreadCount(ScanContext* sc)
     return sc->thread_count;
 }
 
+static_assert(REF_PSCAN_DH_PROMOTION < HNDPSCAN_CURSORS, "every cooperative scan needs its own handle table cursor");
+
+// Rewind the given cooperative scan in every handle table. Must be called by a single thread while no other
+// thread takes part in that scan (the GC does it inside the join that precedes the scan).
+void Ref_ResetParallelScan(RefParallelScan scan)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleTableMap *walk = &g_HandleTableMap;
+    while (walk)
+    {
+        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        {
+            if (walk->pBuckets[i] != NULL)
+            {
+                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                for (int uCPUindex = 0; uCPUindex < getNumberOfSlots(); uCPUindex++)
+                {
+                    if (pTable[uCPUindex])
+                        HndResetParallelScan(pTable[uCPUindex], scan);
+                }
+            }
+        }
+        walk = walk->pNext;
+    }
+}
+
+// Scan the given handle types in every handle table together with the other GC threads. Rather than only
+// covering the tables of its own slots, each thread claims segments from every table, starting with its own
+// slot, so a single heap with most of the handles no longer keeps one thread busy while the others wait.
+static void ScanHandlesForGCParallel(RefParallelScan scan, ScanContext* sc, HANDLESCANPROC scanProc, uintptr_t param1, uintptr_t param2,
+                                     const uint32_t *types, uint32_t typeCount, uint32_t condemned, uint32_t maxgen, uint32_t flags)
+{
+    WRAPPER_NO_CONTRACT;
+
+    HandleTableMap *walk = &g_HandleTableMap;
+    while (walk)
+    {
+        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        {
+            if (walk->pBuckets[i] != NULL)
+            {
+                int uCPUstart = getSlotNumber(sc);
+                int uCPUlimit = getNumberOfSlots();
+                assert(uCPUlimit > 0);
+                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                for (int n = 0; n < uCPUlimit; n++)
+                {
+                    HHANDLETABLE hTable = pTable[(uCPUstart + n) % uCPUlimit];
+                    if (hTable)
+                        HndScanHandlesForGCParallel(hTable, scan, scanProc, param1, param2, types, typeCount, condemned, maxgen, flags);
+                }
+            }
+        }
+        walk = walk->pNext;
+    }
+}
+
 void SetDependentHandleSecondary(OBJECTHANDLE handle, OBJECTREF objref)
 {
     CONTRACTL
@@ -1208,7 +1437,7 @@ void Ref_TraceRefCountHandles(HANDLESCANPROC callback, uintptr_t lParam1, uintpt
 #endif // FEATURE_REFCOUNTED_HANDLES
 }
 
-void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
+void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc, bool fParallel)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -1227,26 +1456,33 @@ void Ref_CheckReachable(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     // check objects pointed to by short weak handles
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk) {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
-        {
-            if (walk->pBuckets[i] != NULL)
+    if (fParallel)
+    {
+        ScanHandlesForGCParallel(REF_PSCAN_LONG_WEAK, sc, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    }
+    else
+    {
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk) {
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
             {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                if (walk->pBuckets[i] != NULL)
                 {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    int uCPUindex = getSlotNumber(sc);
+                    int uCPUlimit = getNumberOfSlots();
+                    assert(uCPUlimit > 0);
+                    int uCPUstep = getThreadCount(sc);
+                    HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                    for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                    {
+                        HHANDLETABLE hTable = pTable[uCPUindex];
+                        if (hTable)
+                            HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    }
                 }
             }
+            walk = walk->pNext;
         }
-        walk = walk->pNext;
     }
 
 #ifdef FEATURE_VARIABLE_HANDLES
@@ -1289,13 +1525,39 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
 // initially calls us.
 //
 // Returns true if any promotions resulted from this scan.
-bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
+bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext, bool fParallel)
 {
     LOG((LF_GC, LL_INFO10000, "Checking liveness of referents of dependent handles in generation %u\n", pDhContext->m_iCondemned));
+
+    // Once the worklist holds every handle that may still be promoted there's no need to go back to the tables.
+    if (pDhContext->m_fWorklistValid && !pDhContext->m_fBuildingWorklist)
+        return ScanDependentHandleWorklist(pDhContext);
+
     uint32_t type = HNDTYPE_DEPENDENT;
     uint32_t flags = (pDhContext->m_pScanContext->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
     flags |= HNDGCF_EXTRAINFO;
 
+    if (fParallel)
+    {
+        // The other GC threads are scanning the same tables, so this thread can't tell whether rescanning would
+        // find more to promote. Do a single pass; the GC keeps running passes on all threads until none of them
+        // promotes anything (see gc_heap::scan_dependent_handles).
+        pDhContext->m_fUnpromotedPrimaries = false;
+        pDhContext->m_fPromoted = false;
+
+        ScanHandlesForGCParallel(REF_PSCAN_DH_PROMOTION,
+                                 pDhContext->m_pScanContext,
+                                 PromoteDependentHandle,
+                                 uintptr_t(pDhContext->m_pScanContext),
+                                 uintptr_t(pDhContext->m_pfnPromoteFunction),
+                                 &type, 1,
+                                 pDhContext->m_iCondemned,
+                                 pDhContext->m_iMaxGen,
+                                 flags);
+
+        return pDhContext->m_fPromoted;
+    }
+
     // Keep a note of whether we promoted anything over the entire scan (not just the last iteration). We need
     // to return this data since under server GC promotions from this table may cause further promotions in
     // tables handled by other threads.
@@ -1351,6 +1613,23 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         if (pDhContext->m_fPromoted)
             fAnyPromotions = true;
 
+        if (pDhContext->m_fBuildingWorklist)
+        {
+            // The first pass recorded every handle whose primary isn't promoted yet; the following passes only
+            // need to look at those.
+            pDhContext->m_fBuildingWorklist = false;
+            if (pDhContext->m_fWorklistValid)
+            {
+                SortDependentHandleWorklist(pDhContext);
+                if (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted)
+                {
+                    if (ScanDependentHandleWorklist(pDhContext))
+                        fAnyPromotions = true;
+                }
+                return fAnyPromotions;
+            }
+        }
+
     } while (pDhContext->m_fUnpromotedPrimaries && pDhContext->m_fPromoted);
 
     return fAnyPromotions;
@@ -1358,13 +1637,19 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
 
 // Perform a scan of dependent handles for the purpose of clearing any that haven't had their primary
 // promoted.
-void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, ScanContext* sc)
+void Ref_ScanDependentHandlesForClearing(uint32_t condemned, uint32_t maxgen, ScanContext* sc, bool fParallel)
 {
     LOG((LF_GC, LL_INFO10000, "Clearing dead dependent handles in generation %u\n", condemned));
     uint32_t type = HNDTYPE_DEPENDENT;
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
     flags |= HNDGCF_EXTRAINFO;
 
+    if (fParallel)
+    {
+        ScanHandlesForGCParallel(REF_PSCAN_DH_CLEARING, sc, ClearDependentHandle, uintptr_t(sc), 0, &type, 1, condemned, maxgen, flags);
+        return;
+    }
+
     HandleTableMap *walk = &g_HandleTableMap;
     while (walk)
     {
@@ -1635,7 +1920,7 @@ uint8_t** Ref_ScanBridgeObjects(uint32_t condemned, uint32_t maxgen, ScanContext
 }
 #endif // FEATURE_JAVAMARSHAL
 
-void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
+void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc, bool fParallel)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -1651,27 +1936,34 @@ void Ref_CheckAlive(uint32_t condemned, uint32_t maxgen, ScanContext *sc)
     };
     uint32_t flags = sc->concurrent ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
-    HandleTableMap *walk = &g_HandleTableMap;
-    while (walk)
+    if (fParallel)
     {
-        for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+        ScanHandlesForGCParallel(REF_PSCAN_SHORT_WEAK, sc, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+    }
+    else
+    {
+        HandleTableMap *walk = &g_HandleTableMap;
+        while (walk)
         {
-            if (walk->pBuckets[i] != NULL)
+            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
             {
-                int uCPUindex = getSlotNumber(sc);
-                int uCPUlimit = getNumberOfSlots();
-                assert(uCPUlimit > 0);
-                int uCPUstep = getThreadCount(sc);
-                HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
-                for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                if (walk->pBuckets[i] != NULL)
                 {
-                    HHANDLETABLE hTable = pTable[uCPUindex];
-                    if (hTable)
-                        HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    int uCPUindex = getSlotNumber(sc);
+                    int uCPUlimit = getNumberOfSlots();
+                    assert(uCPUlimit > 0);
+                    int uCPUstep = getThreadCount(sc);
+                    HHANDLETABLE* pTable = walk->pBuckets[i]->pTable;
+                    for ( ; uCPUindex < uCPUlimit; uCPUindex += uCPUstep)
+                    {
+                        HHANDLETABLE hTable = pTable[uCPUindex];
+                        if (hTable)
+                            HndScanHandlesForGC(hTable, CheckPromoted, (uintptr_t)sc, 0, types, ARRAY_SIZE(types), condemned, maxgen, flags);
+                    }
                 }
             }
+            walk = walk->pNext;
         }
-        walk = walk->pNext;
     }
 
 #ifdef FEATURE_VARIABLE_HANDLES
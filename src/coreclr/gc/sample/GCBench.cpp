@@ -0,0 +1,469 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBench.cpp
+//
+
+//
+//  A microbenchmark for the GC that runs on the same environment as GCSample.cpp, without the rest of CoreCLR.
+//
+//  Each iteration builds a tree of objects with the given depth and fan-out. With probability 'survival' the
+//  root of the tree is stored in one of 'retained' strong handles (replacing the tree that was there) so it
+//  survives, otherwise it becomes garbage right away. With probability 'pin-rate' each node is stored in one
+//  of 'pinned' pinned handles, which keeps it pinned until that handle is reused.
+//
+//  The GC environment notifies the benchmark of the phases of each GC (see gc_bench_phase in gcenv.h), which
+//  are reported as one JSON object per line, followed by a summary line:
+//
+//    {"type":"gc","index":1,"gen":0,"compacting":true,"pause_us":..,"roots_us":..,"mark_plan_us":..,"relocate_compact_us":..}
+//    {"type":"summary","iterations":..,"allocated_bytes":..,"elapsed_us":..,"alloc_mb_per_s":..,"gc_count":..,...}
+//
+//  The roots phase only covers the roots reported by the environment (there are no stack roots here, so this
+//  is mostly handles). Marking through the heap and planning are not separated by a notification, so they are
+//  reported together, and so are relocating and compacting.
+//
+//  Usage: gcbench [--iterations N] [--depth N] [--fanout N] [--survival F] [--pin-rate F]
+//                 [--retained N] [--pinned N] [--seed N] [--quiet]
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#ifdef TARGET_X86
+#define LOCALGC_CALLCONV __cdecl
+#else
+#define LOCALGC_CALLCONV
+#endif
+
+#define MAX_FANOUT 16
+
+class Node : Object {
+public:
+    Object * m_children[MAX_FANOUT];
+};
+
+static struct Node_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+static Object * AllocateObject(MethodTable * pMT)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    size_t size = pMT->GetBaseSize();
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, 0);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+#if defined(HOST_64BIT)
+// Card byte shift is different on 64bit.
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+static void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+struct BenchConfig
+{
+    int iterations;
+    int depth;
+    int fanout;
+    double survival;
+    double pinRate;
+    int retained;
+    int pinned;
+    uint64_t seed;
+    bool quiet;
+};
+
+struct BenchState
+{
+    // xorshift64, we want the same graphs for the same seed across builds
+    uint64_t random;
+
+    OBJECTHANDLE * retainedHandles;
+    OBJECTHANDLE * pinnedHandles;
+    size_t nextPinned;
+
+    // The environment doesn't report stack roots, so the node being filled in on each level of the tree
+    // is kept alive (and tracked if it moves) by the handle for that level.
+    OBJECTHANDLE * levelHandles;
+
+    uint64_t allocatedBytes;
+};
+
+static double NextRandom(BenchState * state)
+{
+    uint64_t x = state->random;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    state->random = x;
+    return (double)(x >> 11) / (double)(1ULL << 53);
+}
+
+//
+// Per GC phase timing, driven by the notifications from the GC environment
+//
+
+struct GCPhaseTimes
+{
+    int64_t suspend;
+    int64_t mark;
+    int64_t rootsDone;
+    int64_t relocate;
+    int64_t done;
+    int condemned;
+};
+
+static GCPhaseTimes g_currentGC;
+static uint64_t g_gcCount;
+static int64_t g_totalPause;
+static int64_t g_maxPause;
+static uint64_t g_gcCountPerGen[3];
+static int64_t g_qpcFrequency;
+static bool g_quiet;
+
+static int64_t ToMicroseconds(int64_t ticks)
+{
+    return (int64_t)((double)ticks * 1000000.0 / (double)g_qpcFrequency);
+}
+
+static void OnGCPhase(gc_bench_phase phase, int condemned)
+{
+    int64_t now = GCToOSInterface::QueryPerformanceCounter();
+
+    switch (phase)
+    {
+    case gc_bench_phase_suspend:
+        memset(&g_currentGC, 0, sizeof(g_currentGC));
+        g_currentGC.suspend = now;
+        g_currentGC.condemned = -1;
+        break;
+    case gc_bench_phase_start:
+        g_currentGC.condemned = condemned;
+        break;
+    case gc_bench_phase_mark:
+        g_currentGC.mark = now;
+        break;
+    case gc_bench_phase_roots_done:
+        if (g_currentGC.rootsDone == 0)
+            g_currentGC.rootsDone = now;
+        break;
+    case gc_bench_phase_relocate:
+        if (g_currentGC.relocate == 0)
+            g_currentGC.relocate = now;
+        break;
+    case gc_bench_phase_done:
+        g_currentGC.done = now;
+        break;
+    case gc_bench_phase_restart:
+    {
+        // a suspension that was not for a GC
+        if (g_currentGC.done == 0)
+            break;
+
+        int64_t pause = ToMicroseconds(now - g_currentGC.suspend);
+        int64_t roots = g_currentGC.rootsDone ? ToMicroseconds(g_currentGC.rootsDone - g_currentGC.mark) : 0;
+        int64_t markEnd = g_currentGC.relocate ? g_currentGC.relocate : g_currentGC.done;
+        int64_t markPlan = g_currentGC.rootsDone ? ToMicroseconds(markEnd - g_currentGC.rootsDone) : 0;
+        int64_t relocateCompact = g_currentGC.relocate ? ToMicroseconds(g_currentGC.done - g_currentGC.relocate) : 0;
+
+        g_gcCount++;
+        g_totalPause += pause;
+        if (pause > g_maxPause)
+            g_maxPause = pause;
+        if ((g_currentGC.condemned >= 0) && (g_currentGC.condemned < 3))
+            g_gcCountPerGen[g_currentGC.condemned]++;
+
+        if (!g_quiet)
+        {
+            printf("{\"type\":\"gc\",\"index\":%llu,\"gen\":%d,\"compacting\":%s,\"pause_us\":%lld,\"roots_us\":%lld,\"mark_plan_us\":%lld,\"relocate_compact_us\":%lld}\n",
+                (unsigned long long)g_gcCount, g_currentGC.condemned, (g_currentGC.relocate ? "true" : "false"),
+                (long long)pause, (long long)roots, (long long)markPlan, (long long)relocateCompact);
+        }
+
+        memset(&g_currentGC, 0, sizeof(g_currentGC));
+        break;
+    }
+    }
+}
+
+//
+// Graph building
+//
+
+static Object * BuildTree(BenchConfig * config, BenchState * state, int depth)
+{
+    Object * pNode = AllocateObject(&Node_MethodTable.m_MT);
+    if (pNode == NULL)
+        return NULL;
+
+    state->allocatedBytes += Node_MethodTable.m_MT.GetBaseSize();
+
+    if ((config->pinned > 0) && (NextRandom(state) < config->pinRate))
+    {
+        HndAssignHandle(state->pinnedHandles[state->nextPinned], pNode);
+        state->nextPinned = (state->nextPinned + 1) % config->pinned;
+    }
+
+    if (depth == 0)
+        return pNode;
+
+    OBJECTHANDLE oh = state->levelHandles[depth];
+    HndAssignHandle(oh, pNode);
+
+    for (int i = 0; i < config->fanout; i++)
+    {
+        Object * pChild = BuildTree(config, state, depth - 1);
+        if (pChild == NULL)
+            return NULL;
+
+        WriteBarrier(&(((Node *)HndFetchHandle(oh))->m_children[i]), pChild);
+    }
+
+    pNode = HndFetchHandle(oh);
+    HndAssignHandle(oh, NULL);
+
+    return pNode;
+}
+
+static bool ParseArgs(int argc, char* argv[], BenchConfig * config)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        const char * value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--quiet") == 0)
+        {
+            config->quiet = true;
+            continue;
+        }
+
+        if (value == NULL)
+            return false;
+
+        if (strcmp(arg, "--iterations") == 0)
+            config->iterations = atoi(value);
+        else if (strcmp(arg, "--depth") == 0)
+            config->depth = atoi(value);
+        else if (strcmp(arg, "--fanout") == 0)
+            config->fanout = atoi(value);
+        else if (strcmp(arg, "--survival") == 0)
+            config->survival = atof(value);
+        else if (strcmp(arg, "--pin-rate") == 0)
+            config->pinRate = atof(value);
+        else if (strcmp(arg, "--retained") == 0)
+            config->retained = atoi(value);
+        else if (strcmp(arg, "--pinned") == 0)
+            config->pinned = atoi(value);
+        else if (strcmp(arg, "--seed") == 0)
+            config->seed = strtoull(value, NULL, 10);
+        else
+            return false;
+
+        i++;
+    }
+
+    return (config->iterations > 0) && (config->depth >= 0) &&
+           (config->fanout > 0) && (config->fanout <= MAX_FANOUT) &&
+           (config->retained > 0) && (config->pinned >= 0) && (config->seed != 0);
+}
+
+int __cdecl main(int argc, char* argv[])
+{
+    BenchConfig config;
+    config.iterations = 10000;
+    config.depth = 6;
+    config.fanout = 4;
+    config.survival = 0.1;
+    config.pinRate = 0.0;
+    config.retained = 64;
+    config.pinned = 1024;
+    config.seed = 1;
+    config.quiet = false;
+
+    if (!ParseArgs(argc, argv, &config))
+    {
+        fprintf(stderr, "Usage: gcbench [--iterations N] [--depth N] [--fanout N (max %d)] [--survival F] [--pin-rate F]\n"
+                        "               [--retained N] [--pinned N] [--seed N (non zero)] [--quiet]\n", MAX_FANOUT);
+        return -1;
+    }
+
+    g_quiet = config.quiet;
+
+    //
+    // Initialize system info
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    g_qpcFrequency = GCToOSInterface::QueryPerformanceFrequency();
+
+    //
+    // Initialize GC heap
+    //
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    //
+    // Initialize handle manager
+    //
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    //
+    // Initialize current thread
+    //
+    ThreadStore::AttachCurrentThread();
+
+    //
+    // Create the node Methodtable with GCDesc, all the children are a single series
+    //
+    uint32_t baseSize = sizeof(Node);
+    // GC expects the size of ObjHeader (extra void*) to be included in the size.
+    baseSize = baseSize + sizeof(ObjHeader);
+    // Add padding as necessary. GC requires the object size to be at least MIN_OBJECT_SIZE.
+    Node_MethodTable.m_MT.m_baseSize = max(baseSize, (uint32_t)MIN_OBJECT_SIZE);
+
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsGCPointers;
+
+    Node_MethodTable.m_numSeries = 1;
+
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_children));
+    Node_MethodTable.m_series[0].SetSeriesCount(MAX_FANOUT);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    //
+    // Create the handles the trees are retained and pinned with
+    //
+    BenchState state;
+    memset(&state, 0, sizeof(state));
+    state.random = config.seed;
+
+    HHANDLETABLE hTable = g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+
+    state.retainedHandles = new (nothrow) OBJECTHANDLE[config.retained];
+    state.pinnedHandles = new (nothrow) OBJECTHANDLE[config.pinned > 0 ? config.pinned : 1];
+    state.levelHandles = new (nothrow) OBJECTHANDLE[config.depth + 1];
+    if ((state.retainedHandles == NULL) || (state.pinnedHandles == NULL) || (state.levelHandles == NULL))
+        return -1;
+
+    for (int i = 0; i <= config.depth; i++)
+    {
+        state.levelHandles[i] = HndCreateHandle(hTable, HNDTYPE_DEFAULT, NULL);
+        if (state.levelHandles[i] == NULL)
+            return -1;
+    }
+
+    for (int i = 0; i < config.retained; i++)
+    {
+        state.retainedHandles[i] = HndCreateHandle(hTable, HNDTYPE_DEFAULT, NULL);
+        if (state.retainedHandles[i] == NULL)
+            return -1;
+    }
+
+    for (int i = 0; i < config.pinned; i++)
+    {
+        state.pinnedHandles[i] = HndCreateHandle(hTable, HNDTYPE_PINNED, NULL);
+        if (state.pinnedHandles[i] == NULL)
+            return -1;
+    }
+
+    //
+    // Run
+    //
+    g_gcBenchPhaseCallback = OnGCPhase;
+
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+    size_t nextRetained = 0;
+
+    for (int i = 0; i < config.iterations; i++)
+    {
+        Object * pRoot = BuildTree(&config, &state, config.depth);
+        if (pRoot == NULL)
+            return -1;
+
+        if (NextRandom(&state) < config.survival)
+        {
+            HndAssignHandle(state.retainedHandles[nextRetained], pRoot);
+            nextRetained = (nextRetained + 1) % config.retained;
+        }
+    }
+
+    int64_t elapsed = ToMicroseconds(GCToOSInterface::QueryPerformanceCounter() - start);
+
+    g_gcBenchPhaseCallback = NULL;
+
+    double allocMBPerSec = (elapsed > 0) ? ((double)state.allocatedBytes / (1024.0 * 1024.0)) / ((double)elapsed / 1000000.0) : 0.0;
+
+    printf("{\"type\":\"summary\",\"iterations\":%d,\"depth\":%d,\"fanout\":%d,\"survival\":%g,\"pin_rate\":%g,"
+           "\"allocated_bytes\":%llu,\"elapsed_us\":%lld,\"alloc_mb_per_s\":%.2f,"
+           "\"gc_count\":%llu,\"gen0_count\":%llu,\"gen1_count\":%llu,\"gen2_count\":%llu,"
+           "\"total_pause_us\":%lld,\"max_pause_us\":%lld,\"pause_pct\":%.2f}\n",
+        config.iterations, config.depth, config.fanout, config.survival, config.pinRate,
+        (unsigned long long)state.allocatedBytes, (long long)elapsed, allocMBPerSec,
+        (unsigned long long)g_gcCount, (unsigned long long)g_gcCountPerGen[0],
+        (unsigned long long)g_gcCountPerGen[1], (unsigned long long)g_gcCountPerGen[2],
+        (long long)g_totalPause, (long long)g_maxPause,
+        (elapsed > 0) ? ((double)g_totalPause * 100.0 / (double)elapsed) : 0.0);
+
+    return 0;
+}
@@ -10,6 +10,14 @@
 
 EEConfig * g_pConfig;
 
+gc_bench_phase_callback g_gcBenchPhaseCallback = NULL;
+
+static void NotifyGCPhase(gc_bench_phase phase, int condemned)
+{
+    if (g_gcBenchPhaseCallback != NULL)
+        g_gcBenchPhaseCallback(phase, condemned);
+}
+
 bool CLREventStatic::CreateManualEventNoThrow(bool bInitialState)
 {
     m_hEvent = CreateEventW(NULL, TRUE, bInitialState, NULL);
@@ -126,6 +134,8 @@ void ThreadStore::AttachCurrentThread()
 
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    NotifyGCPhase(gc_bench_phase_suspend, -1);
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,27 +146,36 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    NotifyGCPhase(gc_bench_phase_restart, -1);
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
 {
     // TODO: Implement - Scan stack roots on given thread
+
+    if (!sc->promotion)
+        NotifyGCPhase(gc_bench_phase_relocate, condemned);
 }
 
 void GCToEEInterface::GcStartWork(int condemned, int max_gen)
 {
+    NotifyGCPhase(gc_bench_phase_start, condemned);
 }
 
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
 {
+    NotifyGCPhase(gc_bench_phase_mark, condemned);
 }
 
 void GCToEEInterface::AfterGcScanRoots(int condemned, int max_gen, ScanContext* sc)
 {
+    NotifyGCPhase(gc_bench_phase_roots_done, condemned);
 }
 
 void GCToEEInterface::GcDone(int condemned)
 {
+    NotifyGCPhase(gc_bench_phase_done, condemned);
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -137,6 +137,25 @@ public:
     static void AttachCurrentThread();
 };
 
+// -----------------------------------------------------------------------------------------------------------
+// GC phase notifications, the benchmark uses them to time the phases of each GC
+//
+
+enum gc_bench_phase
+{
+    gc_bench_phase_suspend,         // SuspendEE
+    gc_bench_phase_start,           // GcStartWork
+    gc_bench_phase_mark,            // BeforeGcScanRoots
+    gc_bench_phase_roots_done,      // AfterGcScanRoots
+    gc_bench_phase_relocate,        // GcScanRoots during the relocate phase, only for compacting GCs
+    gc_bench_phase_done,            // GcDone
+    gc_bench_phase_restart          // RestartEE
+};
+
+typedef void (*gc_bench_phase_callback)(gc_bench_phase phase, int condemned);
+
+extern gc_bench_phase_callback g_gcBenchPhaseCallback;
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
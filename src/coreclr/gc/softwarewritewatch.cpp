@@ -237,5 +237,91 @@ void SoftwareWriteWatch::GetDirty(
     }
 }
 
+void SoftwareWriteWatch::GetDirtyRanges(
+    void *baseAddress,
+    size_t regionByteSize,
+    void **dirtyRanges,
+    size_t *dirtyRangeCountRef,
+    bool clearDirty,
+    bool isRuntimeSuspended)
+{
+    VerifyCreated();
+    VerifyMemoryRegion(baseAddress, regionByteSize);
+    assert(dirtyRanges != nullptr);
+    assert(dirtyRangeCountRef != nullptr);
+
+    size_t dirtyRangeCount = *dirtyRangeCountRef;
+    if (dirtyRangeCount == 0)
+    {
+        return;
+    }
+
+    if (!isRuntimeSuspended)
+    {
+        // See GetDirty()
+        GCToOSInterface::FlushProcessWriteBuffers();
+    }
+
+    uint8_t *tableRegionStart;
+    size_t tableRegionByteSize;
+    TranslateToTableRegion(baseAddress, regionByteSize, &tableRegionStart, &tableRegionByteSize);
+    uint8_t *tableRegionEnd = tableRegionStart + tableRegionByteSize;
+
+    size_t dirtyRangeIndex = 0;
+    uint8_t *current = tableRegionStart;
+    while (current < tableRegionEnd)
+    {
+        // Mostly the table is clean, skip it a block (sizeof(size_t) pages) at a time where possible
+        if (ALIGN_DOWN(current, sizeof(size_t)) == current)
+        {
+            while ((current + sizeof(size_t) <= tableRegionEnd) && (*reinterpret_cast<size_t *>(current) == 0))
+            {
+                current += sizeof(size_t);
+            }
+            if (current == tableRegionEnd)
+            {
+                break;
+            }
+        }
+
+        if (*current == 0)
+        {
+            ++current;
+            continue;
+        }
+
+        uint8_t *runStart = current;
+        do
+        {
+            // Each byte is only ever set to 0 or 0xff
+            assert(*current == 0xff);
+            if (clearDirty)
+            {
+                // Clear only the bytes for which pages are recorded as dirty
+                *current = 0;
+            }
+            ++current;
+        } while ((current < tableRegionEnd) && (*current != 0));
+
+        uint8_t *runStartAddress = reinterpret_cast<uint8_t *>(GetPageAddress(runStart - GetTable()));
+        dirtyRanges[dirtyRangeIndex * 2] = runStartAddress;
+        dirtyRanges[dirtyRangeIndex * 2 + 1] = runStartAddress + (current - runStart) * WRITE_WATCH_UNIT_SIZE;
+        ++dirtyRangeIndex;
+        if (dirtyRangeIndex == dirtyRangeCount)
+        {
+            break;
+        }
+    }
+
+    *dirtyRangeCountRef = dirtyRangeIndex;
+
+    if (!isRuntimeSuspended && clearDirty && dirtyRangeIndex != 0)
+    {
+        // See GetDirty()
+        MemoryBarrier(); // flush writes from this thread first to guarantee ordering
+        GCToOSInterface::FlushProcessWriteBuffers();
+    }
+}
+
 #endif // !DACCESS_COMPILE
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
@@ -77,6 +77,10 @@ private:
     static bool GetDirtyFromBlock(uint8_t *block, uint8_t *firstPageAddressInBlock, size_t startByteIndex, size_t endByteIndex, void **dirtyPages, size_t *dirtyPageIndexRef, size_t dirtyPageCount, bool clearDirty);
 public:
     static void GetDirty(void *baseAddress, size_t regionByteSize, void **dirtyPages, size_t *dirtyPageCountRef, bool clearDirty, bool isRuntimeSuspended);
+
+    // Same as GetDirty(), but contiguous dirty pages are coalesced into [start, end) ranges. 'dirtyRanges' holds two entries
+    // per range and *dirtyRangeCountRef is the capacity in ranges on input, and the number of ranges found on output.
+    static void GetDirtyRanges(void *baseAddress, size_t regionByteSize, void **dirtyRanges, size_t *dirtyRangeCountRef, bool clearDirty, bool isRuntimeSuspended);
 };
 
 inline void SoftwareWriteWatch::VerifyCreated()
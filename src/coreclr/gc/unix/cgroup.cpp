@@ -52,6 +52,8 @@ Abstract:
 #define CGROUP1_MEMORY_STAT_HIERARCHICAL_MEMORY_LIMIT_FIELD "hierarchical_memory_limit "
 #define CGROUP1_MEMORY_STAT_INACTIVE_FIELD "total_inactive_file "
 #define CGROUP2_MEMORY_STAT_INACTIVE_FIELD "inactive_file "
+#define CGROUP2_MEMORY_PRESSURE_FILENAME "/memory.pressure"
+#define CGROUP2_MEMORY_PRESSURE_SOME_AVG10_FIELD "some avg10="
 
 extern bool ReadMemoryValueFromFile(const char* filename, uint64_t* val);
 
@@ -107,6 +109,15 @@ public:
         }
     }
 
+    static bool GetMemoryPressure(uint32_t *val)
+    {
+        // Pressure stall information is only available with cgroup v2
+        if (s_cgroup_version != 2)
+            return false;
+
+        return GetCGroupMemoryPressureV2(val);
+    }
+
 private:
     static int FindCGroupVersion()
     {
@@ -505,6 +516,56 @@ private:
         return found_any_limit;
     }
 
+    static bool GetCGroupMemoryPressureV2(uint32_t *val)
+    {
+        // 'memory.pressure' looks like
+        //   some avg10=1.23 avg60=0.50 avg300=0.10 total=12345
+        //   full avg10=0.00 avg60=0.00 avg300=0.00 total=678
+        // where avg10 is the percentage of the last 10 seconds in which at least one task
+        // in the cgroup was stalled on memory. That is the one that reacts fast enough to
+        // be useful to the GC.
+        if (s_memory_cgroup_path == nullptr)
+            return false;
+
+        char* pressure_filename = nullptr;
+        if (asprintf(&pressure_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_PRESSURE_FILENAME) < 0)
+            return false;
+
+        FILE *pressure_file = fopen(pressure_filename, "r");
+        free(pressure_filename);
+        if (pressure_file == nullptr)
+            return false;
+
+        char *line = nullptr;
+        size_t lineLen = 0;
+        bool foundFieldValue = false;
+        char* endptr;
+
+        size_t fieldNameLength = strlen(CGROUP2_MEMORY_PRESSURE_SOME_AVG10_FIELD);
+
+        while (getline(&line, &lineLen, pressure_file) != -1)
+        {
+            if (strncmp(line, CGROUP2_MEMORY_PRESSURE_SOME_AVG10_FIELD, fieldNameLength) == 0)
+            {
+                errno = 0;
+                const char* startptr = line + fieldNameLength;
+                double fieldValue = strtod(startptr, &endptr);
+                if (endptr != startptr && errno == 0 && fieldValue >= 0)
+                {
+                    foundFieldValue = true;
+                    *val = (fieldValue < 100) ? (uint32_t)fieldValue : 100;
+                }
+
+                break;
+            }
+        }
+
+        fclose(pressure_file);
+        free(line);
+
+        return foundFieldValue;
+    }
+
     static bool GetCGroupMemoryUsage(size_t *val, const char *filename, const char *inactiveFileFieldName)
     {
         // Use the same way to calculate memory load as popular container tools (Docker, Kubernetes, Containerd etc.)
@@ -614,6 +675,14 @@ size_t GetRestrictedPhysicalMemoryLimit()
     }
 }
 
+bool GetCGroupMemoryPressure(uint32_t* val)
+{
+    if (val == nullptr)
+        return false;
+
+    return CGroup::GetMemoryPressure(val);
+}
+
 bool GetPhysicalMemoryUsed(size_t* val)
 {
     bool result = false;
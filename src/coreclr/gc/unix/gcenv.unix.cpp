@@ -184,6 +184,7 @@ static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
 bool GetPhysicalMemoryUsed(size_t* val);
+bool GetCGroupMemoryPressure(uint32_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
@@ -763,6 +764,21 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return (st == 0);
 }
 
+// Advise the OS to back a committed virtual memory range with transparent huge pages.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if it has succeeded, false if it has failed or is not supported
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    return (madvise(address, size, MADV_HUGEPAGE) == 0);
+#else
+    return false;
+#endif
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -1445,6 +1461,17 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
         *available_page_file = GetAvailablePageFile();
 }
 
+// Get the memory pressure of the container the process runs in
+// Parameters:
+//  pressure - A number between 0 and 100 that specifies the percentage of recent time in which
+//      tasks were stalled waiting on memory.
+// Return:
+//  true if the pressure could be obtained, false otherwise
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    return GetCGroupMemoryPressure(pressure);
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
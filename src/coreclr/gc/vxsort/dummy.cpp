@@ -19,6 +19,7 @@ void InitSupportedInstructionSet (int32_t configSetting)
 {
 }
 
+#if defined(TARGET_AMD64)
 void do_vxsort_avx2 (uint8_t** low, uint8_t** high, uint8_t *range_low, uint8_t *range_high)
 {
     assert(false);
@@ -28,3 +29,9 @@ void do_vxsort_avx512 (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_
 {
     assert(false);
 }
+#elif defined(TARGET_ARM64)
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high)
+{
+    assert(false);
+}
+#endif
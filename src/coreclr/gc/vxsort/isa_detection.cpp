@@ -6,6 +6,8 @@
 
 #include <minipal/cpufeatures.h>
 
+#if defined(TARGET_AMD64)
+
 enum class SupportedISA
 {
     None = 0,
@@ -29,22 +31,44 @@ SupportedISA DetermineSupportedISA()
     }
 }
 
+#elif defined(TARGET_ARM64)
+
+enum class SupportedISA
+{
+    None = 0,
+    NEON = 1 << (int)InstructionSet::NEON
+};
+
+SupportedISA DetermineSupportedISA()
+{
+    // AdvSimd is part of the Arm64 baseline, so it is always available
+    return SupportedISA::NEON;
+}
+
+#endif
+
 static bool s_initialized;
 static SupportedISA s_supportedISA;
 
 bool IsSupportedInstructionSet (InstructionSet instructionSet)
 {
     assert(s_initialized);
+#if defined(TARGET_AMD64)
     assert(instructionSet == InstructionSet::AVX2 || instructionSet == InstructionSet::AVX512F);
+#elif defined(TARGET_ARM64)
+    assert(instructionSet == InstructionSet::NEON);
+#endif
     return ((int)s_supportedISA & (1 << (int)instructionSet)) != 0;
 }
 
 void InitSupportedInstructionSet (int32_t configSetting)
 {
     s_supportedISA = (SupportedISA)((int)DetermineSupportedISA() & configSetting);
+#if defined(TARGET_AMD64)
     // we are assuming that AVX2 can be used if AVX512F can,
     // so if AVX2 is disabled, we need to disable AVX512F as well
     if (!((int)s_supportedISA & (int)SupportedISA::AVX2))
         s_supportedISA = SupportedISA::None;
+#endif
     s_initialized = true;
 }
@@ -8,7 +8,9 @@
 #include "alignment.h"
 #include "machine_traits.h"
 
+#ifdef ARCH_X64
 #include <immintrin.h>
+#endif
 
 namespace vxsort {
 
@@ -0,0 +1,15 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.NEON.h"
+
+using namespace vxsort;
+
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON >::sort(int64_t *ptr, size_t length) {
+    bitonic_neon<neon_ops_int64>::sort(ptr, length);
+}
+
+void vxsort::smallsort::bitonic<int32_t, vector_machine::NEON >::sort(int32_t *ptr, size_t length) {
+    bitonic_neon<neon_ops_int32>::sort(ptr, length);
+}
@@ -0,0 +1,158 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef BITONIC_SORT_NEON_H
+#define BITONIC_SORT_NEON_H
+
+#include <arm_neon.h>
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+// Unlike the AVX2/AVX512 small sorts these are not generated: with only 2 (int64_t)
+// or 4 (int32_t) lanes per vector the network is driven by a loop over the vectors
+// held in registers, with the in-vector stages done by lane swaps plus a select.
+
+struct neon_ops_int64 {
+    typedef int64_t T;
+    typedef int64x2_t TV;
+    static const int N = 2;
+
+    static INLINE TV load(const T* p) { return vld1q_s64(p); }
+    static INLINE void store(T* p, TV v) { vst1q_s64(p, v); }
+    static INLINE TV min(TV a, TV b) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+    static INLINE TV max(TV a, TV b) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+
+    // exchange lanes i and i ^ j; only j == 1 exists for two lanes
+    static INLINE TV swap_lanes(TV v, int j) { assert(j == 1); return vextq_s64(v, v, 1); }
+
+    // keep 'a' in the lanes i where (i & j) == 0, 'b' elsewhere
+    static INLINE TV select_low_lanes(TV a, TV b, int j) {
+        assert(j == 1);
+        static const uint64_t low_lanes[2] = { UINT64_MAX, 0 };
+        return vbslq_s64(vld1q_u64(low_lanes), a, b);
+    }
+};
+
+struct neon_ops_int32 {
+    typedef int32_t T;
+    typedef int32x4_t TV;
+    static const int N = 4;
+
+    static INLINE TV load(const T* p) { return vld1q_s32(p); }
+    static INLINE void store(T* p, TV v) { vst1q_s32(p, v); }
+    static INLINE TV min(TV a, TV b) { return vminq_s32(a, b); }
+    static INLINE TV max(TV a, TV b) { return vmaxq_s32(a, b); }
+
+    static INLINE TV swap_lanes(TV v, int j) {
+        assert((j == 1) || (j == 2));
+        return (j == 1) ? vrev64q_s32(v) : vextq_s32(v, v, 2);
+    }
+
+    static INLINE TV select_low_lanes(TV a, TV b, int j) {
+        assert((j == 1) || (j == 2));
+        static const uint32_t low_lanes_1[4] = { UINT32_MAX, 0, UINT32_MAX, 0 };
+        static const uint32_t low_lanes_2[4] = { UINT32_MAX, UINT32_MAX, 0, 0 };
+        return vbslq_s32(vld1q_u32((j == 1) ? low_lanes_1 : low_lanes_2), a, b);
+    }
+};
+
+template <typename Ops>
+struct bitonic_neon {
+    typedef typename Ops::T T;
+    typedef typename Ops::TV TV;
+    static const int N = Ops::N;
+    static const int MAX_VECTORS = 16;
+    static const int MAX_ELEMENTS = MAX_VECTORS * N;
+
+    static void sort(T* ptr, size_t length) {
+        assert(length <= (size_t)MAX_ELEMENTS);
+        if (length < 2)
+            return;
+
+        // Pad to a power of two number of elements (at least two vectors) with the
+        // largest value so the padding sorts to the end and can be dropped.
+        size_t n = 2 * N;
+        while (n < length)
+            n *= 2;
+
+        alignas(16) T buf[MAX_ELEMENTS];
+        memcpy(buf, ptr, length * sizeof(T));
+        for (size_t i = length; i < n; i++)
+            buf[i] = std::numeric_limits<T>::max();
+
+        // Stages with a block size smaller than a vector would need a different
+        // direction per lane pair; there are only a handful, so do them scalar.
+        for (size_t k = 2; k < (size_t)N; k *= 2) {
+            for (size_t j = k / 2; j > 0; j /= 2) {
+                for (size_t i = 0; i < n; i++) {
+                    size_t l = i ^ j;
+                    if (l > i) {
+                        bool asc = (i & k) == 0;
+                        if ((buf[i] > buf[l]) == asc) {
+                            T tmp = buf[i];
+                            buf[i] = buf[l];
+                            buf[l] = tmp;
+                        }
+                    }
+                }
+            }
+        }
+
+        const size_t nv = n / N;
+        TV v[MAX_VECTORS];
+        for (size_t i = 0; i < nv; i++)
+            v[i] = Ops::load(buf + i * N);
+
+        for (size_t k = N; k <= n; k *= 2) {
+            for (size_t j = k / 2; j > 0; j /= 2) {
+                if (j >= (size_t)N) {
+                    // compare-exchange whole vectors
+                    const size_t jv = j / N;
+                    for (size_t i = 0; i < nv; i++) {
+                        size_t l = i ^ jv;
+                        if (l > i) {
+                            TV lo = Ops::min(v[i], v[l]);
+                            TV hi = Ops::max(v[i], v[l]);
+                            bool asc = ((i * N) & k) == 0;
+                            v[i] = asc ? lo : hi;
+                            v[l] = asc ? hi : lo;
+                        }
+                    }
+                } else {
+                    // compare-exchange lanes within each vector, k >= N so the
+                    // direction is the same for all lanes of a vector
+                    for (size_t i = 0; i < nv; i++) {
+                        TV s = Ops::swap_lanes(v[i], (int)j);
+                        TV lo = Ops::min(v[i], s);
+                        TV hi = Ops::max(v[i], s);
+                        bool asc = ((i * N) & k) == 0;
+                        v[i] = asc ? Ops::select_low_lanes(lo, hi, (int)j) : Ops::select_low_lanes(hi, lo, (int)j);
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < nv; i++)
+            Ops::store(buf + i * N, v[i]);
+        memcpy(ptr, buf, length * sizeof(T));
+    }
+};
+
+template<> struct bitonic<int64_t, NEON> {
+    static const int N = neon_ops_int64::N;
+public:
+    static void sort(int64_t *ptr, size_t length);
+};
+
+template<> struct bitonic<int32_t, NEON> {
+    static const int N = neon_ops_int32::N;
+public:
+    static void sort(int32_t *ptr, size_t length);
+};
+
+}
+}
+
+#endif // BITONIC_SORT_NEON_H
@@ -4,6 +4,9 @@
 #ifndef VXSORT_VXSORT_H
 #define VXSORT_VXSORT_H
 
+#include "defs.h"
+
+#ifdef ARCH_X64
 #ifdef __GNUC__
 #ifdef __clang__
 #pragma clang attribute push (__attribute__((target("popcnt"))), apply_to = any(function))
@@ -12,13 +15,17 @@
 #pragma GCC target("popcnt")
 #endif
 #endif
+#endif // ARCH_X64
 
 #include <assert.h>
+#ifdef ARCH_X64
 #include <immintrin.h>
+#elif defined(ARCH_ARM64)
+#include <arm_neon.h>
+#endif
 
 #include <minipal/utils.h>
 
-#include "defs.h"
 #include "alignment.h"
 #include "machine_traits.h"
 #ifdef VXSORT_STATS
@@ -30,6 +37,17 @@
 namespace vxsort {
 using vxsort::smallsort::bitonic;
 
+// Population count of a comparison mask returned by the machine traits
+static inline int popcount_mask(uint64_t mask) {
+#if defined(ARCH_X64)
+    return (int)_mm_popcnt_u64(mask);
+#elif defined(_MSC_VER)
+    return (int)_CountOneBits64(mask);
+#else
+    return __builtin_popcountll(mask);
+#endif
+}
+
 /**
  * sort primitives, quickly
  * @tparam T The primitive type being sorted
@@ -310,7 +328,7 @@ private:
         dataVec = MT::partition_vector(dataVec, mask);
         MT::store_vec(reinterpret_cast<TV*>(left), dataVec);
         MT::store_vec(reinterpret_cast<TV*>(right), dataVec);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcount_mask(mask);
         right += popCount;
         left += popCount + N;
     }
@@ -320,7 +338,7 @@ private:
                                                      T*& left,
                                                      T*& right) {
         auto mask = MT::get_cmpgt_mask(dataVec, P);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -popcount_mask(mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(left), dataVec, ~mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(right + N + popCount), dataVec, mask);
         right += popCount;
@@ -581,8 +599,8 @@ private:
         TV LT0 = MT::load_vec(preAlignedLeft);
         auto rtMask = MT::get_cmpgt_mask(RT0, P);
         auto ltMask = MT::get_cmpgt_mask(LT0, P);
-        const auto rtPopCountRightPart = max(_mm_popcnt_u32(rtMask), rightAlign);
-        const auto ltPopCountRightPart = _mm_popcnt_u32(ltMask);
+        const auto rtPopCountRightPart = max(popcount_mask(rtMask), rightAlign);
+        const auto ltPopCountRightPart = popcount_mask(ltMask);
         const auto rtPopCountLeftPart  = N - rtPopCountRightPart;
         const auto ltPopCountLeftPart  = N - ltPopCountRightPart;
 
@@ -656,6 +674,8 @@ private:
 
 }  // namespace gcsort
 
+#ifdef ARCH_X64
 #include "vxsort_targets_disable.h"
+#endif // ARCH_X64
 
 #endif
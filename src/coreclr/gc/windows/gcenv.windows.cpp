@@ -794,6 +794,21 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
     return success;
 }
 
+// Advise the OS to back a committed virtual memory range with transparent huge pages.
+// Parameters:
+//  address - starting virtual address
+//  size    - size of the virtual memory range
+// Return:
+//  true if it has succeeded, false if it has failed or is not supported
+bool GCToOSInterface::VirtualAdviseHugePages(void* address, size_t size)
+{
+    UNREFERENCED_PARAMETER(address);
+    UNREFERENCED_PARAMETER(size);
+
+    // Windows has no transparent huge pages, large pages need to be reserved up front.
+    return false;
+}
+
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
@@ -1064,6 +1079,19 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
     }
 }
 
+// Get the memory pressure of the container the process runs in
+// Parameters:
+//  pressure - A number between 0 and 100 that specifies the percentage of recent time in which
+//      tasks were stalled waiting on memory.
+// Return:
+//  true if the pressure could be obtained, false otherwise
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    // There is no pressure stall information on Windows, we rely on the memory load instead.
+    UNREFERENCED_PARAMETER(pressure);
+    return false;
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
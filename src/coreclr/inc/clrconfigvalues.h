@@ -252,6 +252,8 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_gcServer, W("gcServer"), 0, "Enables server
 CONFIG_STRING_INFO(INTERNAL_GcCoverage, W("GcCoverage"), "Specify a method or regular expression of method names to run with GCStress")
 CONFIG_STRING_INFO(INTERNAL_SkipGCCoverage, W("SkipGcCoverage"), "Specify a list of assembly names to skip with GC Coverage")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StatsUpdatePeriod, W("StatsUpdatePeriod"), 60, "Specifies the interval, in seconds, at which to update the statistics")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCSuspendStragglerThresholdUSec, W("GCSuspendStragglerThresholdUSec"), 1000, "Runtime suspensions that take at least this many microseconds report the last thread to reach a safe point through the GCSuspendEEStraggler event and the stress log")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCStackScanStealing, W("GCStackScanStealing"), 1, "When set, server GC threads that finish scanning the stacks of their own heap's threads steal the remaining unscanned threads from other heaps")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCRetainVM, W("GCRetainVM"), 0, "When set we put the segments that should be deleted on a standby list (instead of releasing them back to the OS) which will be considered to satisfy new segment requests (note that the same thing can be specified via API which is the supported way)")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_gcAllowVeryLargeObjects, W("gcAllowVeryLargeObjects"), 1, "Allow allocation of 2GB+ objects on GC heap")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_CheckDoubleReporting, W("CheckDoubleReporting"), 0, "Enable checks to proactively watch for possible GC holes")
@@ -261,6 +263,8 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set v
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCPath, W("GCPath"), "")
+RETAIL_CONFIG_DWORD_INFO_EX(EXTERNAL_FinalizerThreadCount, W("FinalizerThreadCount"), 1, "Number of threads that run finalizers, capped by the processor count. With more than one, finalizers run concurrently and in no particular order, and critical finalizers may run while other finalizers are still running.", CLRConfig::LookupOptions::ParseIntegerAsBase10)
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCPretenureSampledTypes, W("GCPretenureSampledTypes"), 0, "Allocate types whose sampled allocations mostly survive gen0 directly into the large object heap, which is only collected with gen2")
 /**
  * This flag allows us to force the runtime to use global allocation context on Windows x86/amd64 instead of thread allocation context just for testing purpose.
  * The flag is unsafe for a subtle reason. Although the access to the g_global_alloc_context is protected under a lock. The implementation of
@@ -304,6 +308,10 @@ RETAIL_CONFIG_STRING_INFO(EXTERNAL_AltJitExcludeAssemblies, W("AltJitExcludeAsse
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_InterpreterName, W("InterpreterName"), "Primary interpreter to use")
 CONFIG_STRING_INFO(INTERNAL_InterpreterPath, W("InterpreterPath"), "Full path to the interpreter to use")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_Interpreter, W("Interpreter"), "Enables Interpreter and selectively limits it to the specified methods.")
+#if defined(FEATURE_TIERED_COMPILATION) && defined(FEATURE_JIT)
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_InterpreterTierUp, W("TC_InterpreterTierUp"), 0, "When both the interpreter and the JIT are available, use the interpreter for tier 0 code only and promote hot interpreted methods to JIT-compiled code.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_InterpreterTierUpThreshold, W("TC_InterpreterTierUpThreshold"), 1000, "Number of method entries and loop iterations of interpreted tier 0 code after which the method is promoted to the next tier. Only used with TC_InterpreterTierUp.")
+#endif // FEATURE_TIERED_COMPILATION && FEATURE_JIT
 #endif // FEATURE_INTERPRETER
 
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_JitHostMaxSlabCache, W("JitHostMaxSlabCache"), 0x1000000, "Sets jit host max slab cache size, 16MB default")
@@ -340,6 +348,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitMinNumCpus, W("MultiCoreJitMinNumCpus"), 2, "Minimum number of cpus that must be present to allow MultiCoreJit usage.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitNoProfileGather, W("MultiCoreJitNoProfileGather"), 0, "Set to 1 to disable profile gathering (but leave possibly enabled profile usage).")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitTypePreload, W("MultiCoreJitTypePreload"), 1, "Set to 0 to disable loading the types of profiled methods on a second background thread ahead of the multi-core JIT thread.")
 
 #endif
 
@@ -393,6 +402,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitProcFactor, W("SpinLimitProcFactor"),
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinLimitConstant, W("SpinLimitConstant"), 0x0, "Hex value specifying the constant to add when calculating the maximum spin duration")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinRetryCount, W("SpinRetryCount"), 0xA, "Hex value specifying the number of times the entire spin process is repeated (when applicable)")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_Monitor_SpinCount, W("Monitor_SpinCount"), 0x1e, "Hex value specifying the maximum number of spin iterations Monitor may perform upon contention on acquiring the lock before waiting.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_SpinWaitOnAddress, W("SpinWaitOnAddress"), 1, "Allows spin-waits on a memory location to use the processor's wait-on-address instructions (UMWAIT on x86/x64, WFET on arm64) instead of pause/yield")
 
 ///
 /// Profiling API / ETW
@@ -414,6 +424,9 @@ RETAIL_CONFIG_STRING_INFO_EX(EXTERNAL_ProfAPI_ProfilerCompatibilitySetting, W("P
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_DetachMinSleepMs, W("ProfAPI_DetachMinSleepMs"), 0, "The minimum time, in milliseconds, the CLR will wait before checking whether a profiler that is in the process of detaching is ready to be unloaded.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_DetachMaxSleepMs, W("ProfAPI_DetachMaxSleepMs"), 0, "The maximum time, in milliseconds, the CLR will wait before checking whether a profiler that is in the process of detaching is ready to be unloaded.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_RejitOnAttach, W("ProfApi_RejitOnAttach"), 1, "Enables the ability for profilers to rejit methods on attach.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_ReJitBatchWindowMs, W("ProfAPI_ReJitBatchWindowMs"), 0, "If nonzero, RequestReJIT queues the requested methods and returns, and a background thread applies the requests made within this many milliseconds of each other together.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_EnterLeaveSamplingPeriodMs, W("ProfAPI_EnterLeaveSamplingPeriodMs"), 0, "If nonzero, the enter/leave/tailcall hooks of a profiler are only called during the first ProfAPI_EnterLeaveSamplingWindowMs of every period of this many milliseconds. Profilers must then tolerate unmatched enter and leave callbacks.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_EnterLeaveSamplingWindowMs, W("ProfAPI_EnterLeaveSamplingWindowMs"), 1, "The time, in milliseconds, at the start of every ProfAPI_EnterLeaveSamplingPeriodMs during which the enter/leave/tailcall hooks of a profiler are called.")
 CONFIG_DWORD_INFO(INTERNAL_ProfAPIFault, W("ProfAPIFault"), 0, "Test-only bitmask to inject various types of faults in the profapi code")
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyAllowedEventMask, W("TestOnlyAllowedEventMask"), 0, "Test-only bitmask to allow profiler tests to override CLR enforcement of COR_PRF_ALLOWABLE_AFTER_ATTACH and COR_PRF_MONITOR_IMMUTABLE")
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableICorProfilerInfo, W("ProfAPI_TestOnlyEnableICorProfilerInfo"), 0, "Test-only flag to allow attaching profiler tests to call ICorProfilerInfo interface, which would otherwise be disallowed for attaching profilers")
@@ -421,11 +434,14 @@ CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableObjectAllocatedHook, W("TestOnlyEnableO
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableSlowELTHooks, W("TestOnlyEnableSlowELTHooks"), 0, "Test-only flag that forces CLR to initialize on startup as if slow-ELT were requested, to enable post-attach ELT functionality.")
 
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W("ETW_ObjectAllocationEventsPerTypePerSec"), "Desired number of GCSampledObjectAllocation ETW events to be logged per type per second.  If 0, then the default built in to the implementation for the enabled event (e.g., High, Low), will be used.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ETW_CompactSurvivalAndMovement, W("ETW_CompactSurvivalAndMovement"), 0, "If set, GC heap survival and movement tracking sends delta encoded ranges in SurvivalAndMovement GCDynamicEvent events instead of GCBulkSurvivingObjectRanges and GCBulkMovedObjectRanges events.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ETW_CompactSurvivalAndMovementBudget, W("ETW_CompactSurvivalAndMovementBudget"), 0x100000, "Maximum number of bytes of range data sent per GC by compact survival and movement tracking. Ranges past the budget are counted but not sent. 0 means no limit.")
 
 #ifdef FEATURE_PERFMAP
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux and macOS to enable writing /tmp/perf-$pid.map. It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapAsyncWrites, W("PerfMapAsyncWrites"), 0, "When set, jitdump records are written by a background thread and perf map lines are written in batches, instead of synchronously on the thread that generated the code.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapStubGranularity, W("PerfMapStubGranularity"), 0, "Report stubs with varying amounts of granularity (low bit being zero indicates attempt to group all stubs of a type together) (second lowest bit being non-zero records stubs at individual allocation sites, which is more expensive, but also more accurate).")
 #endif
 
@@ -438,6 +454,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StressLog, W("StressLog"), 0, "Turns on the
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ForceEnc, W("ForceEnc"), 0, "Forces Edit and Continue to be on for all eligible modules.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StressLogSize, W("StressLogSize"), 0, "Stress log size in bytes per thread.")
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_StressLogFilename, W("StressLogFilename"), "Stress log filename for memory mapped stress log.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StressLogLowOverhead, W("StressLogLowOverhead"), 0, "Stamps stress log messages with the CPU cycle counter and preallocates each thread's log so that logging never allocates.")
 CONFIG_DWORD_INFO(INTERNAL_stressSynchronized, W("stressSynchronized"), 0, "Unknown if or where this is used; unless a test is specifically depending on this, it can be removed.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TotalStressLogSize, W("TotalStressLogSize"), 0, "Total stress log size in bytes.")
 
@@ -487,10 +504,15 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountThreshold, W("TC_CallCountThreshol
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountingDelayMs, W("TC_CallCountingDelayMs"), TC_CallCountingDelayMs, "A perpetual delay in milliseconds that is applied to call counting in tier 0 and jitting at higher tiers, while there is startup-like activity.")
 
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerTimeoutMs, W("TC_BackgroundWorkerTimeoutMs"), TC_BackgroundWorkerTimeoutMs, "How long in milliseconds the background worker thread may remain idle before exiting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerCount, W("TC_BackgroundWorkerCount"), 1, "Maximum number of background threads that may concurrently jit methods at higher tiers. Additional threads are only used when there is a backlog and the system is not oversubscribed.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DelaySingleProcMultiplier, W("TC_DelaySingleProcMultiplier"), TC_DelaySingleProcMultiplier, "Multiplier for TC_CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCounting, W("TC_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any promotion to higher tiers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_UseCallCountingStubs, W("TC_UseCallCountingStubs"), 1, "Uses call counting stubs for faster call counting.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteCallCountingStubsAfter"), 0, "Deletes call counting stubs after this many have completed. Zero to disable deleting.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_SeparateOptimizedCodeHeap, W("TC_SeparateOptimizedCodeHeap"), 1, "Allocate fully optimized tier 1 code in code heaps separate from tier 0 and instrumented code, so that hot code is packed densely.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_FoldIdenticalCode, W("TC_FoldIdenticalCode"), 0, "Methods whose tier 1 code is identical to that of an already jitted method in the same module share its code instead of keeping their own copy. Frames of such methods are reported as the method that owns the code. Only supported on x64.")
+RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_TC_WarmStartPath, W("TC_WarmStartPath"), "Path of a file recording the methods that were promoted to tier 1. The methods recorded by a previous run of the same runtime version are jitted optimized on their first call, the file is then updated at shutdown.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TC_HotCodeCallCountingMs, W("TC_HotCodeCallCountingMs"), 100, "Tier 1 code of methods that reached the call count threshold within this many milliseconds of call counting starting is clustered in separate hot code heaps. Zero to disable. Only used with TC_SeparateOptimizedCodeHeap.")
 #undef TC_BackgroundWorkerTimeoutMs
 #undef TC_CallCountThreshold
 #undef TC_CallCountingDelayMs
@@ -504,6 +526,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #ifdef FEATURE_ON_STACK_REPLACEMENT
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_CounterBump, W("OSR_CounterBump"), 1000, "Counter reload value when a patchpoint is hit")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_HitLimit, W("OSR_HitLimit"), 10, "Number of times a patchpoint must call back to trigger an OSR transition")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_Tier1PromotionThreshold, W("OSR_Tier1PromotionThreshold"), 1, "Number of OSR variants a tier 0 method may have before it is promoted to tier 1 without waiting for call counting (0 to disable)")
 CONFIG_DWORD_INFO(INTERNAL_OSR_LowId, W("OSR_LowId"), (DWORD)-1, "Low end of enabled patchpoint range (inclusive)");
 CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of enabled patchpoint range (inclusive)");
 #endif
@@ -515,6 +538,7 @@ CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of e
 RETAIL_CONFIG_STRING_INFO(INTERNAL_PGODataPath, W("PGODataPath"), "Read/Write PGO data from/to the indicated file.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadPGOData, W("ReadPGOData"), 0, "Read PGO data")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_WritePGOData, W("WritePGOData"), 0, "Write PGO data")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_PGODataFormat, W("PGODataFormat"), 0, "Format of the written PGO data: 0 for text, 1 for a memory mappable binary format. Both formats are detected when reading.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredPGO, W("TieredPGO"), 1, "Instrument Tier0 code and make counts available to Tier1")
 
 // TieredPGO_InstrumentOnlyHotCode values:
@@ -598,6 +622,9 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"),
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeProcNumbers, W("EventPipeProcNumbers"), 0, "Enable/disable capturing processor numbers in EventPipe event headers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeOutputStreaming, W("EventPipeOutputStreaming"), 1, "Enable/disable streaming for trace file set in DOTNET_EventPipeOutputPath.  Non-zero values enable streaming.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeEnableStackwalk, W("EventPipeEnableStackwalk"), 1, "Set to 0 to disable collecting stacks for EventPipe events.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeSharedStreamingThread, W("EventPipeSharedStreamingThread"), 0, "Set to 1 to have all streaming EventPipe sessions serviced by a single streaming thread.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeWaitEventThresholdMs, W("EventPipeWaitEventThresholdMs"), 0, "Waits that complete within this many milliseconds do not send WaitHandleWait events. 0 only filters out waits that do not block.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeSampleRunningThreadsOnly, W("EventPipeSampleRunningThreadsOnly"), 0, "Set to 1 to have the sample profiler only sample threads running managed code. The runtime is not suspended for samples where no thread is.")
 
 //
 // UserEvents
@@ -641,6 +668,8 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableWriteXorExecute, W("EnableWriteXorExecut
 #else
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableWriteXorExecute, W("EnableWriteXorExecute"), 1, "Enable W^X for executable memory.");
 #endif // TARGET_RISCV64
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_LoaderHeapCommitBatchSize, W("LoaderHeapCommitBatchSize"), 0x10000, "Minimum size in bytes of the commits loader heaps make when W^X double mapping is enabled. 0 disables batching.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ExecutableAllocatorRWCacheSize, W("ExecutableAllocatorRWCacheSize"), 8, "Number of RW mappings of executable memory kept alive for reuse when W^X is enabled (1-16).")
 
 #ifdef FEATURE_GDBJIT
 ///
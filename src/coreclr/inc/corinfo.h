@@ -1592,6 +1592,10 @@ struct CORINFO_FIELD_INFO
 //----------------------------------------------------------------------------
 // getThreadLocalStaticBlocksInfo and CORINFO_THREAD_STATIC_BLOCKS_INFO: The EE instructs the JIT about how to access a thread local field
 
+// Set in the index returned by getThreadLocalFieldInfo when the thread statics of the type live in the
+// collectible thread static blocks. The remaining bits are the index into those blocks.
+#define CORINFO_THREAD_STATIC_INDEX_COLLECTIBLE 0x01000000
+
 struct CORINFO_THREAD_STATIC_BLOCKS_INFO
 {
     CORINFO_CONST_LOOKUP tlsIndex;              // windows specific
@@ -1602,6 +1606,8 @@ struct CORINFO_THREAD_STATIC_BLOCKS_INFO
     uint32_t offsetOfMaxThreadStaticBlocks;
     uint32_t offsetOfThreadStaticBlocks;
     uint32_t offsetOfBaseOfThreadLocalData;
+    uint32_t offsetOfMaxCollectibleThreadStaticBlocks;
+    uint32_t offsetOfCollectibleThreadStaticBlocks;
 };
 
 //----------------------------------------------------------------------------
@@ -1696,6 +1702,10 @@ struct CORINFO_EE_INFO
     CORINFO_RUNTIME_ABI targetAbi;
 
     CORINFO_OS  osType;
+
+    // Address of a byte that is nonzero while the profiler enter/leave/tailcall hooks should be
+    // called, or NULL if the hooks are not sampled and must always be called.
+    void*       profilerEnterLeaveSamplingFlag;
 };
 
 enum CorInfoContinuationFlags
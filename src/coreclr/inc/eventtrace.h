@@ -283,11 +283,13 @@ namespace ETW
         static VOID BeginMovedReferences(size_t * pProfilingContext);
         static VOID MovedReference(BYTE * pbMemBlockStart, BYTE * pbMemBlockEnd, ptrdiff_t cbRelocDistance, size_t profilingContext, BOOL fCompacting, BOOL fAllowProfApiNotification = TRUE);
         static VOID EndMovedReferences(size_t profilingContext, BOOL fAllowProfApiNotification = TRUE);
+        static VOID ResetMovementEventBudget();
 #else
         // TODO: Need to be implemented for PROFILING_SUPPORTED.
         static VOID BeginMovedReferences(size_t * pProfilingContext) {};
         static VOID MovedReference(BYTE * pbMemBlockStart, BYTE * pbMemBlockEnd, ptrdiff_t cbRelocDistance, size_t profilingContext, BOOL fCompacting, BOOL fAllowProfApiNotification = TRUE) {};
         static VOID EndMovedReferences(size_t profilingContext, BOOL fAllowProfApiNotification = TRUE) {};
+        static VOID ResetMovementEventBudget() {};
 #endif // FEATURE_EVENT_TRACE
         static VOID SendFinalizeObjectEvent(MethodTable * pMT, Object * pObj);
     };
@@ -98,6 +98,9 @@ private:
     // Caches the DOTNET_EnableWXORX setting
     static bool g_isWXorXEnabled;
 
+    // Minimum size of the commits loader heaps make in their reserved ranges
+    static size_t g_commitBatchSize;
+
     // Head of the linked list of all RX blocks that were allocated by this allocator
     BlockRX* m_pFirstBlockRX = NULL;
 
@@ -117,19 +120,14 @@ private:
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-// Uncomment these to gather information to better choose caching parameters
-//#define VARIABLE_SIZED_CACHEDMAPPING_SIZE
-
     // Last RW mappings cached so that it can be reused for the next mapping
-    // request if it goes into the same range.
-    // This is handled as a 3 element cache with an LRU replacement policy
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    // If variable sized mappings enabled, make the cache physically big enough to cover all interesting sizes
-    static int g_cachedMappingSize;
+    // request if it goes into the same range. A cached mapping holds a reference
+    // on its block, so unmapping is deferred until the mapping is evicted.
+    // This is handled as an LRU cache. The array is physically big enough to cover
+    // all interesting sizes, g_cachedMappingSize (DOTNET_ExecutableAllocatorRWCacheSize)
+    // is the number of entries in use.
+    static size_t g_cachedMappingSize;
     BlockRW* m_cachedMapping[16] = { 0 };
-#else
-    BlockRW* m_cachedMapping[3] = { 0 };
-#endif
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
@@ -223,6 +221,12 @@ public:
     // Return true if W^X is enabled
     static bool IsWXORXEnabled();
 
+    // Return the minimum size of a commit loader heaps should make when they grow
+    // into their reserved ranges. Double mapped memory is committed by changing the
+    // protection of the shared memory view, so each commit is a syscall and may split
+    // the mapping. Committing in larger batches keeps both counts down.
+    static size_t CommitBatchSize();
+
     // Use this function to initialize g_lazyPreferredRangeHint during startup.
     // base is runtime .dll base address, size is runtime .dll virtual size.
     static void InitLazyPreferredRange(size_t base, size_t size, int randomPageOffset);
@@ -14,6 +14,8 @@ public:
 
     static bool HasExternalProbe();
     static bool ExternalAssemblyProbe(_In_ const SString& path, _Out_ void** data, _Out_ int64_t* size);
+
+    static bool GetTrustedPlatformAssemblies(_Out_ const host_runtime_tpa_entry** entries, _Out_ size_t* count);
 };
 
 #endif // _HOSTINFORMATION_H_
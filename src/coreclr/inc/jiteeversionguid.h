@@ -37,11 +37,11 @@
 
 #include <minipal/guid.h>
 
-constexpr GUID JITEEVersionIdentifier = { /* ce8cef5e-261f-469a-b599-9f3f3e8b2448 */
-    0xce8cef5e,
-    0x261f,
-    0x469a,
-    {0xb5, 0x99, 0x9f, 0x3f, 0x3e, 0x8b, 0x24, 0x48}
+constexpr GUID JITEEVersionIdentifier = { /* 8c3e91d4-27b6-4f0a-b5d3-6a1e04c7f298 */
+    0x8c3e91d4,
+    0x27b6,
+    0x4f0a,
+    {0xb5, 0xd3, 0x6a, 0x1e, 0x04, 0xc7, 0xf2, 0x98}
   };
 
 #endif // JIT_EE_VERSIONING_GUID_H
@@ -266,6 +266,13 @@ public:
     BOOL                    fTestOnlyEnableICorProfilerInfo;
 #endif // _DEBUG
 
+    // #EnterLeaveSampling When ProfAPI_EnterLeaveSamplingPeriodMs is set, the JIT guards the
+    // enter/leave/tailcall hooks with a check of enterLeaveSamplingActive, which is set for a
+    // window at the start of every sampling period by a dedicated thread. See
+    // code:ProfilingAPIUtility::StartEnterLeaveSampling.
+    BOOL fEnterLeaveSamplingEnabled;
+    BYTE enterLeaveSamplingActive;
+
     // Whether we've turned off concurrent GC during attach
     Volatile<BOOL> fConcurrentGCDisabledForAttach;
 
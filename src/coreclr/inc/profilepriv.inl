@@ -147,6 +147,9 @@ inline void ProfControlBlock::Init()
     fTestOnlyEnableICorProfilerInfo = FALSE;
 #endif // _DEBUG
 
+    fEnterLeaveSamplingEnabled = FALSE;
+    enterLeaveSamplingActive = 0;
+
     fConcurrentGCDisabledForAttach = FALSE;
 
     mainProfilerInfo.ResetPerSessionStatus();
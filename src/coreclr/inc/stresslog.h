@@ -182,7 +182,7 @@ class StressLog {
     template<typename T> friend struct ::cdac_offsets;
 public:
     static void Initialize(unsigned facilities, unsigned level, unsigned maxBytesPerThread,
-        unsigned maxBytesTotal, void* moduleBase, LPWSTR logFilename = nullptr);
+        unsigned maxBytesTotal, void* moduleBase, LPWSTR logFilename = nullptr, bool lowOverhead = false);
     static void Terminate(BOOL fProcessDetach=FALSE);
     static void ThreadDetach();         // call at DllMain  THREAD_DETACH if you want to recycle thread logs
     static int NewChunk ()
@@ -280,6 +280,12 @@ public:
 
     static thread_local ThreadStressLog* t_pCurrentThreadLog;
 
+#if !defined(STRESS_LOG_READONLY)
+    // Set by the low overhead mode: every thread log gets its full ring of chunks when it is
+    // created, and wrapping around never grows it.
+    static bool s_fixedChunkRings;
+#endif //!STRESS_LOG_READONLY
+
 // private:
     static void Enter(CRITSEC_COOKIE dummy = NULL);
     static void Leave(CRITSEC_COOKIE dummy = NULL);
@@ -852,7 +858,7 @@ inline StressMsg* ThreadStressLog::AdvWritePastBoundary(int cArgs) {
     memset (curWriteChunk->StartPtr (), 0, (BYTE *)curPtr - (BYTE *)curWriteChunk->StartPtr ());
 
     //if we are already at head of the list, try to grow the list
-    if (curWriteChunk == chunkListHead)
+    if (curWriteChunk == chunkListHead && !StressLog::s_fixedChunkRings)
     {
         GrowChunkList ();
     }
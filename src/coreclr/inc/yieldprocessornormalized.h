@@ -9,6 +9,13 @@ FORCEINLINE void System_YieldProcessor() { PalYieldProcessor(); }
 FORCEINLINE void System_YieldProcessor() { YieldProcessor(); }
 #endif
 
+// Spin-waits on a memory location may use the processor's wait-on-address instructions where they are usable from user mode:
+// UMONITOR/UMWAIT (WAITPKG) on x86/x64 and WFET (FEAT_WFxT) on arm64
+#if !defined(FEATURE_NATIVEAOT) && !defined(DACCESS_COMPILE) && \
+    (defined(HOST_X86) || defined(HOST_AMD64) || (defined(HOST_ARM64) && defined(HOST_UNIX)))
+#define FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+#endif
+
 #define DISABLE_COPY(T) \
     T(const T &) = delete; \
     T &operator =(const T &) = delete
@@ -17,6 +24,8 @@ FORCEINLINE void System_YieldProcessor() { YieldProcessor(); }
     T() = delete; \
     DISABLE_COPY(T)
 
+class YieldProcessorNormalizationInfo;
+
 class YieldProcessorNormalization
 {
 public:
@@ -34,6 +43,12 @@ private:
     static unsigned int s_yieldsPerNormalizedYield;
     static unsigned int s_optimalMaxNormalizedYieldsPerSpinIteration;
 
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+    // Number of ticks of the clock used for wait-on-address deadlines (TSC on x86/x64, CNTVCT on arm64) that span the duration
+    // of a normalized yield, or 0 if spin-waits on a memory location should use System_YieldProcessor() instead
+    static unsigned int s_waitOnAddressTicksPerNormalizedYield;
+#endif
+
 public:
     static bool IsMeasurementScheduled()
     {
@@ -45,6 +60,14 @@ public:
 private:
     static void ScheduleMeasurementIfNecessary();
 
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+    static void InitializeWaitOnAddress();
+
+    // Waits until the value at 'address' is written or is different from 'value', or until 'ticks' ticks have elapsed,
+    // whichever happens first. The wait may also end early for other reasons.
+    static void WaitOnAddress(const volatile uint32_t *address, uint32_t value, uint64_t ticks);
+#endif
+
 public:
     static unsigned int GetOptimalMaxNormalizedYieldsPerSpinIteration()
     {
@@ -61,6 +84,12 @@ private:
 
     friend class YieldProcessorNormalizationInfo;
     friend void YieldProcessorNormalizedForPreSkylakeCount(unsigned int);
+    friend void YieldProcessorNormalized(const YieldProcessorNormalizationInfo &, const volatile uint32_t *, uint32_t);
+    friend void YieldProcessorWithBackOffNormalized(
+        const YieldProcessorNormalizationInfo &,
+        unsigned int,
+        const volatile uint32_t *,
+        uint32_t);
 };
 
 class YieldProcessorNormalizationInfo
@@ -69,12 +98,19 @@ private:
     unsigned int yieldsPerNormalizedYield;
     unsigned int optimalMaxNormalizedYieldsPerSpinIteration;
     unsigned int optimalMaxYieldsPerSpinIteration;
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+    unsigned int waitOnAddressTicksPerNormalizedYield;
+#endif
 
 public:
     YieldProcessorNormalizationInfo()
         : yieldsPerNormalizedYield(YieldProcessorNormalization::s_yieldsPerNormalizedYield),
         optimalMaxNormalizedYieldsPerSpinIteration(YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIteration),
         optimalMaxYieldsPerSpinIteration(yieldsPerNormalizedYield * optimalMaxNormalizedYieldsPerSpinIteration)
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+        , waitOnAddressTicksPerNormalizedYield(
+            VolatileLoadWithoutBarrier(&YieldProcessorNormalization::s_waitOnAddressTicksPerNormalizedYield))
+#endif
     {
         YieldProcessorNormalization::ScheduleMeasurementIfNecessary();
     }
@@ -85,6 +121,12 @@ public:
     friend void YieldProcessorNormalized(const YieldProcessorNormalizationInfo &, unsigned int);
     friend void YieldProcessorNormalizedForPreSkylakeCount(const YieldProcessorNormalizationInfo &, unsigned int);
     friend void YieldProcessorWithBackOffNormalized(const YieldProcessorNormalizationInfo &, unsigned int);
+    friend void YieldProcessorNormalized(const YieldProcessorNormalizationInfo &, const volatile uint32_t *, uint32_t);
+    friend void YieldProcessorWithBackOffNormalized(
+        const YieldProcessorNormalizationInfo &,
+        unsigned int,
+        const volatile uint32_t *,
+        uint32_t);
 };
 
 // See YieldProcessorNormalized() for preliminary info. Typical usage:
@@ -288,5 +330,65 @@ FORCEINLINE void YieldProcessorWithBackOffNormalized(
     } while (--n != 0);
 }
 
+// See YieldProcessorNormalized() for preliminary info. This overload is to be used by spin-waits that are waiting for the value at
+// 'address' to change from 'value'. Where the processor supports it, the delay is issued as a low-power wait on the address that
+// also ends as soon as the location is written, instead of repeated System_YieldProcessor(). Typical usage:
+//     if (VolatileLoad(&m_lock) != 0)
+//     {
+//         YieldProcessorNormalizationInfo normalizationInfo;
+//         do
+//         {
+//             YieldProcessorNormalized(normalizationInfo, (const volatile uint32_t *)&m_lock, 1);
+//         } while (VolatileLoad(&m_lock) != 0);
+//     }
+FORCEINLINE void YieldProcessorNormalized(
+    const YieldProcessorNormalizationInfo &normalizationInfo,
+    const volatile uint32_t *address,
+    uint32_t value)
+{
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+    if (normalizationInfo.waitOnAddressTicksPerNormalizedYield != 0)
+    {
+        YieldProcessorNormalization::WaitOnAddress(address, value, normalizationInfo.waitOnAddressTicksPerNormalizedYield);
+        return;
+    }
+#endif
+
+    YieldProcessorNormalized(normalizationInfo);
+}
+
+// See YieldProcessorWithBackOffNormalized() and the overload of YieldProcessorNormalized() above that takes an address. The delay
+// progresses in the same way as YieldProcessorWithBackOffNormalized(), and ends early when the value at 'address' is written.
+FORCEINLINE void YieldProcessorWithBackOffNormalized(
+    const YieldProcessorNormalizationInfo &normalizationInfo,
+    unsigned int spinIteration,
+    const volatile uint32_t *address,
+    uint32_t value)
+{
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+    if (normalizationInfo.waitOnAddressTicksPerNormalizedYield != 0)
+    {
+        const uint8_t MaxShift = 3;
+        unsigned int n;
+        if (spinIteration <= MaxShift &&
+            ((unsigned int)1 << spinIteration) < normalizationInfo.optimalMaxNormalizedYieldsPerSpinIteration)
+        {
+            n = (unsigned int)1 << spinIteration;
+        }
+        else
+        {
+            n = normalizationInfo.optimalMaxNormalizedYieldsPerSpinIteration;
+        }
+        YieldProcessorNormalization::WaitOnAddress(
+            address,
+            value,
+            (uint64_t)n * normalizationInfo.waitOnAddressTicksPerNormalizedYield);
+        return;
+    }
+#endif
+
+    YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
+}
+
 #undef DISABLE_CONSTRUCT_COPY
 #undef DISABLE_COPY
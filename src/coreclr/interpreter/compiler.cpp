@@ -743,6 +743,13 @@ int32_t* InterpCompiler::EmitCodeIns(int32_t *ip, InterpInst *ins, TArray<Reloc*
             relocs->Add(reloc);
             *ip++ = (int32_t)0xdeadbeef;
         }
+
+        // Any additional data follows the branch offset, which is the first data slot
+        if (!isReverted)
+        {
+            for (int i = 1; i < GetDataLen(opcode); i++)
+                *ip++ = ins->data[i];
+        }
     }
     else if (opcode == INTOP_MOV_SRC_OFF)
     {
@@ -1065,6 +1072,11 @@ void InterpCompiler::BuildGCInfo(InterpMethod *pInterpMethod)
         for (int i = 0; i < m_varsSize; i++)
         {
             InterpVar *pVar = &m_pVars[i];
+            // Vars that are no longer referenced by any instruction, because their definitions
+            // were removed by the IR optimizations, don't have a stack location.
+            if (!pVar->global && pVar->liveStart == NULL)
+                continue;
+
             GcSlotFlags flags = pVar->global
                 ? (GcSlotFlags)GC_SLOT_UNTRACKED
                 : (GcSlotFlags)0;
@@ -1278,6 +1290,18 @@ InterpMethod* InterpCompiler::CompileMethod()
     }
 #endif
 
+    if (InterpConfig.InterpOptimizations())
+    {
+        OptimizeCode();
+#ifdef DEBUG
+        if (m_verbose)
+        {
+            printf("\nOptimized IR:\n");
+            PrintCode();
+        }
+#endif
+    }
+
     AllocOffsets();
     PatchInitLocals(m_methodInfo);
 
@@ -5958,6 +5982,13 @@ void InterpCompiler::PrintInsData(InterpInst *ins, int32_t insOffset, const int3
             else
                 printf(" IR_%04x", insOffset + *pData);
             break;
+        case InterpOpBranchInt:
+            printf(" %d", pData[1]);
+            if (ins)
+                printf(" BB%d", ins->info.pTargetBB->index);
+            else
+                printf(" IR_%04x", insOffset + *pData);
+            break;
         case InterpOpLdPtr:
             {
                 PrintPointer((void*)GetDataItemAtIndex(pData[0]));
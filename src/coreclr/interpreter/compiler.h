@@ -405,12 +405,19 @@ struct InterpVar
     // If var is callArgs, this is the call instruction using it.
     // Only used by the var offset allocator
     InterpInst *call;
+    // Defining instruction, only valid if defCount is 1. The def and use
+    // counts are only used by the IR optimizations.
+    InterpInst *def;
+    int defCount;
+    int useCount;
 
     unsigned int callArgs : 1; // Var used as argument to a call
     unsigned int noCallArgs : 1; // Var can't be used as argument to a call, needs to be copied to temp
     unsigned int global : 1; // Dedicated stack offset throughout method execution
     unsigned int ILGlobal : 1; // Args and IL locals
     unsigned int alive : 1; // Used internally by the var offset allocator
+    unsigned int indirect : 1; // Address of the var is taken, it can be accessed through pointers
+    unsigned int inCallArgs : 1; // Var is passed as argument to a call, set by the IR optimizations
 
     InterpVar(InterpType interpType, CORINFO_CLASS_HANDLE clsHnd, int size)
     {
@@ -420,12 +427,17 @@ struct InterpVar
         offset = -1;
         liveStart = NULL;
         bbIndex = -1;
+        def = NULL;
+        defCount = 0;
+        useCount = 0;
 
         callArgs = false;
         noCallArgs = false;
         global = false;
         ILGlobal = false;
         alive = false;
+        indirect = false;
+        inCallArgs = false;
     }
 };
 
@@ -777,10 +789,22 @@ private:
     void    EndActiveCall(InterpInst *call);
     void    CompactActiveVars(int32_t *current_offset);
 
+    // IR optimizations
+    bool    GetInt32ConstantValue(int32_t var, int32_t *pValue);
+    void    AddVarUseCB(int32_t *pVar, void *pData);
+    void    RemoveVarUseCB(int32_t *pVar, void *pData);
+    void    ComputeVarDefsAndUses();
+    void    PropagateCopies();
+    void    FoldConstantOperands();
+    void    FoldConstantBranch(InterpBasicBlock *pBB, InterpInst **ppIns);
+    void    FoldMovesIntoDefs();
+    void    RemoveUnusedDefs();
+
     // Passes
     int32_t* m_pMethodCode;
     int32_t m_methodCodeSize; // code size measured in int32_t slots, instead of bytes
 
+    void OptimizeCode();
     void AllocOffsets();
     int32_t ComputeCodeSize();
     uint32_t ConvertOffset(int32_t offset);
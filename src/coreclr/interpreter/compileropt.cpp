@@ -435,3 +435,377 @@ void InterpCompiler::AllocOffsets()
     m_globalVarsWithRefsStackTop = globalVarsWithRefsStackTop;
     m_totalVarsStackSize = ALIGN_UP_TO(finalVarsStackSize, INTERP_STACK_ALIGNMENT);
 }
+
+// The IR is generated straight from IL, with a separate var for every IL stack slot. Loading and
+// storing IL locals translates to moves between these temporaries and the IL local vars, which the
+// passes below get rid of. They run before var offset allocation, so they only need to keep the
+// def and use counts of vars up to date.
+void InterpCompiler::OptimizeCode()
+{
+    ComputeVarDefsAndUses();
+    PropagateCopies();
+    FoldConstantOperands();
+    FoldMovesIntoDefs();
+    RemoveUnusedDefs();
+}
+
+static bool InterpOpIsScalarMov(int32_t opcode)
+{
+    return opcode == INTOP_MOV_4 || opcode == INTOP_MOV_8;
+}
+
+// Opcodes without side effects, whose result depends only on the source vars and the data
+static bool InterpOpIsPure(int32_t opcode)
+{
+    switch (opcode)
+    {
+        case INTOP_LDC_I4:
+        case INTOP_LDC_I4_0:
+        case INTOP_LDC_I8_0:
+        case INTOP_LDC_I8:
+        case INTOP_LDC_R4:
+        case INTOP_LDC_R8:
+        case INTOP_MOV_I4_I1:
+        case INTOP_MOV_I4_U1:
+        case INTOP_MOV_I4_I2:
+        case INTOP_MOV_I4_U2:
+        case INTOP_MOV_4:
+        case INTOP_MOV_8:
+        case INTOP_MOV_VT:
+        case INTOP_ADD_I4_IMM:
+        case INTOP_ADD_I8_IMM:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Opcodes that read all their source vars before storing the result into the dVar, so the dVar
+// can be changed to any var of the same type, including one of the source vars.
+static bool InterpOpCanRetargetDVar(int32_t opcode)
+{
+    if (InterpOpIsPure(opcode))
+        return true;
+    if (opcode == INTOP_UNBOX_ANY || opcode == INTOP_UNBOX_ANY_GENERIC)
+        return false;
+    // Unary and binary arithmetic operations
+    return opcode >= INTOP_NEG_I4 && opcode <= INTOP_CLT_UN_R8;
+}
+
+void InterpCompiler::AddVarUseCB(int32_t *pVar, void *pData)
+{
+    m_pVars[*pVar].useCount++;
+}
+
+void InterpCompiler::RemoveVarUseCB(int32_t *pVar, void *pData)
+{
+    assert(m_pVars[*pVar].useCount > 0);
+    m_pVars[*pVar].useCount--;
+}
+
+void InterpCompiler::ComputeVarDefsAndUses()
+{
+    for (int32_t i = 0; i < m_varsSize; i++)
+    {
+        InterpVar *pVar = &m_pVars[i];
+        pVar->def = NULL;
+        pVar->defCount = 0;
+        pVar->useCount = 0;
+        pVar->indirect = false;
+        pVar->inCallArgs = false;
+    }
+
+    for (InterpBasicBlock *pBB = m_pEntryBB; pBB != NULL; pBB = pBB->pNextBB)
+    {
+        for (InterpInst *pIns = pBB->pFirstIns; pIns != NULL; pIns = pIns->pNext)
+        {
+            int32_t opcode = pIns->opcode;
+            if (opcode == INTOP_NOP)
+                continue;
+
+            // LDLOCA references the var in sVars[0], but it is not registered as a source var
+            if (opcode == INTOP_LDLOCA)
+                m_pVars[pIns->sVars[0]].indirect = true;
+
+            if ((pIns->flags & INTERP_INST_FLAG_CALL) && pIns->info.pCallInfo && pIns->info.pCallInfo->pCallArgs)
+            {
+                for (int32_t *callArgs = pIns->info.pCallInfo->pCallArgs; *callArgs != CALL_ARGS_TERMINATOR; callArgs++)
+                    m_pVars[*callArgs].inCallArgs = true;
+            }
+
+            ForEachInsSVar(pIns, NULL, &InterpCompiler::AddVarUseCB);
+
+            if (g_interpOpDVars[opcode])
+            {
+                InterpVar *pVar = &m_pVars[pIns->dVar];
+                pVar->def = pIns;
+                pVar->defCount++;
+            }
+        }
+    }
+}
+
+// For a temporary var that is a copy of another var, replace its uses in the rest of the basic block
+// with the original var, as long as the original var is not redefined. Vars whose address is taken
+// and vars passed as call arguments are left alone, call arguments have special storage constraints.
+void InterpCompiler::PropagateCopies()
+{
+    for (InterpBasicBlock *pBB = m_pEntryBB; pBB != NULL; pBB = pBB->pNextBB)
+    {
+        for (InterpInst *pIns = pBB->pFirstIns; pIns != NULL; pIns = pIns->pNext)
+        {
+            if (!InterpOpIsScalarMov(pIns->opcode))
+                continue;
+
+            int32_t dVar = pIns->dVar;
+            int32_t sVar = pIns->sVars[0];
+            InterpVar *pDVar = &m_pVars[dVar];
+            InterpVar *pSVar = &m_pVars[sVar];
+
+            if (dVar == sVar || pDVar->ILGlobal || pDVar->defCount != 1 || pDVar->indirect)
+                continue;
+            if (pSVar->indirect || pSVar->inCallArgs || pDVar->interpType != pSVar->interpType)
+                continue;
+
+            for (InterpInst *pUse = pIns->pNext; pUse != NULL && pDVar->useCount > 0; pUse = pUse->pNext)
+            {
+                int32_t opcode = pUse->opcode;
+                if (opcode == INTOP_NOP)
+                    continue;
+
+                bool redefinesSVar = g_interpOpDVars[opcode] && pUse->dVar == sVar;
+                if (redefinesSVar && !InterpOpCanRetargetDVar(opcode))
+                    break;
+
+                for (int i = 0; i < g_interpOpSVars[opcode]; i++)
+                {
+                    if (pUse->sVars[i] == dVar)
+                    {
+                        INTERP_DUMP("cprop: replace var %d with var %d\n", dVar, sVar);
+                        pUse->sVars[i] = sVar;
+                        pDVar->useCount--;
+                        pSVar->useCount++;
+                    }
+                }
+
+                if (redefinesSVar)
+                    break;
+            }
+        }
+    }
+}
+
+// Returns true if var has a single definition which loads a constant that fits in 32 bits
+bool InterpCompiler::GetInt32ConstantValue(int32_t var, int32_t *pValue)
+{
+    InterpVar *pVar = &m_pVars[var];
+    if (pVar->defCount != 1 || pVar->ILGlobal || pVar->indirect)
+        return false;
+
+    InterpInst *pDef = pVar->def;
+    switch (pDef->opcode)
+    {
+        case INTOP_LDC_I4_0:
+        case INTOP_LDC_I8_0:
+            *pValue = 0;
+            return true;
+        case INTOP_LDC_I4:
+            *pValue = pDef->data[0];
+            return true;
+        case INTOP_LDC_I8:
+        {
+            int64_t value = (int64_t)(uint32_t)pDef->data[0] + ((int64_t)pDef->data[1] << 32);
+            if (value != (int32_t)value)
+                return false;
+            *pValue = (int32_t)value;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// Returns the opcode comparing a var against a constant for a conditional branch on two I4 vars.
+// If swapOperands is true, the constant is the first operand of the original comparison.
+static int32_t GetBranchImmOpcode(int32_t opcode, bool swapOperands)
+{
+    switch (opcode)
+    {
+        case INTOP_BEQ_I4: return INTOP_BEQ_I4_IMM;
+        case INTOP_BNE_UN_I4: return INTOP_BNE_UN_I4_IMM;
+        case INTOP_BGE_I4: return swapOperands ? INTOP_BLE_I4_IMM : INTOP_BGE_I4_IMM;
+        case INTOP_BGT_I4: return swapOperands ? INTOP_BLT_I4_IMM : INTOP_BGT_I4_IMM;
+        case INTOP_BLE_I4: return swapOperands ? INTOP_BGE_I4_IMM : INTOP_BLE_I4_IMM;
+        case INTOP_BLT_I4: return swapOperands ? INTOP_BGT_I4_IMM : INTOP_BLT_I4_IMM;
+        default: return INTOP_NOP;
+    }
+}
+
+// Replace a conditional branch comparing a var with a constant by the superinstruction that
+// has the constant embedded, saving the dispatch of the ldc that loads the constant.
+void InterpCompiler::FoldConstantBranch(InterpBasicBlock *pBB, InterpInst **ppIns)
+{
+    InterpInst *pIns = *ppIns;
+    if (GetBranchImmOpcode(pIns->opcode, false) == INTOP_NOP)
+        return;
+
+    int32_t value;
+    int constIndex;
+    if (GetInt32ConstantValue(pIns->sVars[1], &value))
+        constIndex = 1;
+    else if (GetInt32ConstantValue(pIns->sVars[0], &value))
+        constIndex = 0;
+    else
+        return;
+
+    int32_t constVar = pIns->sVars[constIndex];
+    InterpInst *pNewIns = InsertInsBB(pBB, pIns, GetBranchImmOpcode(pIns->opcode, constIndex == 0));
+    pNewIns->ilOffset = pIns->ilOffset;
+    pNewIns->info.pTargetBB = pIns->info.pTargetBB;
+    pNewIns->SetSVar(pIns->sVars[1 - constIndex]);
+    // data[0] is the slot of the branch offset
+    pNewIns->data[1] = value;
+    INTERP_DUMP("cfold: var %d is constant %d\n", constVar, value);
+
+    m_pVars[constVar].useCount--;
+    ClearIns(pIns);
+    *ppIns = pNewIns;
+}
+
+// Replace integer additions, subtractions and conditional branches with a constant operand
+// by the opcodes with the constant embedded in the instruction
+void InterpCompiler::FoldConstantOperands()
+{
+    for (InterpBasicBlock *pBB = m_pEntryBB; pBB != NULL; pBB = pBB->pNextBB)
+    {
+        for (InterpInst *pIns = pBB->pFirstIns; pIns != NULL; pIns = pIns->pNext)
+        {
+            if (InterpOpIsCondBranch(pIns->opcode))
+            {
+                FoldConstantBranch(pBB, &pIns);
+                continue;
+            }
+
+            int32_t immOpcode;
+            bool isSub = false;
+            switch (pIns->opcode)
+            {
+                case INTOP_ADD_I4:
+                    immOpcode = INTOP_ADD_I4_IMM;
+                    break;
+                case INTOP_SUB_I4:
+                    immOpcode = INTOP_ADD_I4_IMM;
+                    isSub = true;
+                    break;
+                case INTOP_ADD_I8:
+                    immOpcode = INTOP_ADD_I8_IMM;
+                    break;
+                case INTOP_SUB_I8:
+                    immOpcode = INTOP_ADD_I8_IMM;
+                    isSub = true;
+                    break;
+                default:
+                    continue;
+            }
+
+            int32_t value;
+            int constIndex;
+            if (GetInt32ConstantValue(pIns->sVars[1], &value))
+                constIndex = 1;
+            else if (!isSub && GetInt32ConstantValue(pIns->sVars[0], &value))
+                constIndex = 0;
+            else
+                continue;
+
+            if (isSub)
+            {
+                if (value == INT32_MIN)
+                    continue;
+                value = -value;
+            }
+
+            int32_t constVar = pIns->sVars[constIndex];
+            InterpInst *pNewIns = InsertInsBB(pBB, pIns, immOpcode);
+            pNewIns->ilOffset = pIns->ilOffset;
+            pNewIns->SetDVar(pIns->dVar);
+            pNewIns->SetSVar(pIns->sVars[1 - constIndex]);
+            pNewIns->data[0] = value;
+            INTERP_DUMP("cfold: var %d is constant %d\n", constVar, value);
+
+            m_pVars[constVar].useCount--;
+            if (m_pVars[pIns->dVar].def == pIns)
+                m_pVars[pIns->dVar].def = pNewIns;
+            ClearIns(pIns);
+            pIns = pNewIns;
+        }
+    }
+}
+
+// A temporary that is computed and then immediately moved to another var, typically when storing
+// into an IL local, is replaced by the destination of the move. Since the move directly follows the
+// definition, nothing can observe the destination var being written one instruction earlier.
+void InterpCompiler::FoldMovesIntoDefs()
+{
+    for (InterpBasicBlock *pBB = m_pEntryBB; pBB != NULL; pBB = pBB->pNextBB)
+    {
+        for (InterpInst *pIns = pBB->pFirstIns; pIns != NULL; pIns = pIns->pNext)
+        {
+            if (!InterpOpIsScalarMov(pIns->opcode))
+                continue;
+
+            int32_t dVar = pIns->dVar;
+            int32_t sVar = pIns->sVars[0];
+            InterpVar *pDVar = &m_pVars[dVar];
+            InterpVar *pSVar = &m_pVars[sVar];
+
+            if (dVar == sVar || pSVar->ILGlobal || pSVar->indirect || pSVar->defCount != 1 || pSVar->useCount != 1)
+                continue;
+            if (pDVar->interpType != pSVar->interpType)
+                continue;
+
+            InterpInst *pDef = pSVar->def;
+            if (pDef != PrevRealIns(pIns) || !InterpOpCanRetargetDVar(pDef->opcode))
+                continue;
+
+            INTERP_DUMP("fold mov: var %d is stored directly into var %d\n", sVar, dVar);
+            pDef->SetDVar(dVar);
+            pSVar->def = NULL;
+            pSVar->defCount = 0;
+            pSVar->useCount = 0;
+            if (pDVar->def == pIns)
+                pDVar->def = pDef;
+            ClearIns(pIns);
+        }
+    }
+}
+
+// Remove side effect free instructions whose result is not used, along with moves of a var to itself
+void InterpCompiler::RemoveUnusedDefs()
+{
+    bool changed;
+    do
+    {
+        changed = false;
+        for (InterpBasicBlock *pBB = m_pEntryBB; pBB != NULL; pBB = pBB->pNextBB)
+        {
+            for (InterpInst *pIns = pBB->pFirstIns; pIns != NULL; pIns = pIns->pNext)
+            {
+                if (!InterpOpIsPure(pIns->opcode))
+                    continue;
+
+                InterpVar *pDVar = &m_pVars[pIns->dVar];
+                bool isSelfMove = InterpOpIsScalarMov(pIns->opcode) && pIns->dVar == pIns->sVars[0];
+                if (!isSelfMove && (pDVar->useCount != 0 || pDVar->ILGlobal || pDVar->indirect))
+                    continue;
+
+                INTERP_DUMP("remove unused def of var %d\n", pIns->dVar);
+                ForEachInsSVar(pIns, NULL, &InterpCompiler::RemoveVarUseCB);
+                pDVar->defCount--;
+                if (pDVar->def == pIns)
+                    pDVar->def = NULL;
+                ClearIns(pIns);
+                changed = true;
+            }
+        }
+    } while (changed);
+}
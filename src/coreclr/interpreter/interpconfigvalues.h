@@ -20,6 +20,7 @@
 #endif
 
 RELEASE_CONFIG_METHODSET(Interpreter, "Interpreter")
+RELEASE_CONFIG_INTEGER(InterpOptimizations, "InterpOptimizations", 1); // Optimize the IR before var offset allocation
 CONFIG_METHODSET(InterpHalt, "InterpHalt");
 CONFIG_METHODSET(InterpDump, "InterpDump");
 CONFIG_INTEGER(InterpList, "InterpList", 0); // List the methods which are compiled by the interpreter JIT
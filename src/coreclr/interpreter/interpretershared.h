@@ -31,6 +31,9 @@ struct InterpMethod
     void** pDataItems;
     // This stub is used for calling the interpreted method from JITted/AOTed code
     CallStubHeader *pCallStub;
+    // Remaining number of method entries and loop iterations before tier 0 code is promoted
+    // to the next tier. Set by the VM when tiering up from the interpreter, zero if disabled.
+    int32_t tierUpCountdown;
     bool initLocals;
 
     InterpMethod(CORINFO_METHOD_HANDLE methodHnd, int32_t allocaSize, void** pDataItems, bool initLocals)
@@ -43,6 +46,7 @@ struct InterpMethod
         this->pDataItems = pDataItems;
         this->initLocals = initLocals;
         pCallStub = NULL;
+        tierUpCountdown = 0;
     }
 
     bool CheckIntegrity()
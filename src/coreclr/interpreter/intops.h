@@ -19,6 +19,7 @@ typedef enum
     InterpOpTwoInts,
     InterpOpThreeInts,
     InterpOpBranch,
+    InterpOpBranchInt,
     InterpOpSwitch,
     InterpOpMethodHandle,
     InterpOpClassHandle,
@@ -80,7 +81,7 @@ static inline bool InterpOpIsUncondBranch(int32_t opcode)
 
 static inline bool InterpOpIsCondBranch(int32_t opcode)
 {
-    return opcode >= INTOP_BRFALSE_I4 && opcode <= INTOP_BLT_UN_R8;
+    return opcode >= INTOP_BRFALSE_I4 && opcode <= INTOP_BLT_I4_IMM;
 }
 
 // Helpers for reading data from uint8_t code stream
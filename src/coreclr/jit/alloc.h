@@ -126,6 +126,11 @@ private:
 public:
     MemStatsAllocator* getMemStatsAllocator(CompMemKind kind);
     void               finishMemStats();
+
+    UINT64 getBytesAllocatedByKind(CompMemKind kind) const
+    {
+        return m_stats.allocSzByKind[kind];
+    }
     void               dumpMemStats(FILE* file);
 
     static void dumpMaxMemStats(FILE* file);
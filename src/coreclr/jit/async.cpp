@@ -1150,6 +1150,20 @@ CallDefinitionInfo AsyncTransformation::CanonicalizeCallDefinition(BasicBlock*
 // Returns:
 //   The new basic block that was created.
 //
+// Remarks:
+//   The suspension block is only reached when the callee returned a
+//   continuation, so awaits that complete synchronously never allocate a
+//   continuation or store live locals; they only pay for the null check
+//   emitted by CreateCheckAndSuspendAfterCall. The block is given zero weight
+//   to keep it out of line.
+//
+//   A new continuation is allocated on every suspension, including after a
+//   resumption. Once the dispatcher resumes a continuation it may still be
+//   referenced by it (e.g. for exception or result propagation), and its
+//   layout is specific to the suspension point that created it. Reusing it
+//   for a later suspension would therefore need a layout shared by all
+//   suspension points and an ownership contract with the dispatcher.
+//
 BasicBlock* AsyncTransformation::CreateSuspension(
     BasicBlock* block, GenTreeCall* call, unsigned stateNum, AsyncLiveness& life, const ContinuationLayout& layout)
 {
@@ -540,6 +540,9 @@ protected:
 #ifdef PROFILING_SUPPORTED
     void genProfilingEnterCallback(regNumber initReg, bool* pInitRegZeroed);
     void genProfilingLeaveCallback(unsigned helper);
+#ifdef TARGET_AMD64
+    bool genProfilingSamplingCheck(regNumber reg, BasicBlock** pSkipLabel);
+#endif // TARGET_AMD64
 #endif // PROFILING_SUPPORTED
 
     //
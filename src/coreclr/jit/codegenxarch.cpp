@@ -3397,7 +3397,9 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
 
         size -= bytesWritten;
 
-        // Handle the remainder by overlapping with previously processed data
+        // Handle the remainder by overlapping with previously processed data. This is preferred over
+        // AVX-512 masked moves: the size is a constant, so a single unaligned move covers the tail without
+        // materializing a kmask, and masked stores that touch a page boundary can be much slower.
         if ((size > 0) && (size < regSize) && (regSize >= XMM_REGSIZE_BYTES))
         {
             // Get optimal register size to cover the whole remainder (with overlapping)
@@ -3729,7 +3731,7 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
 
         assert((size >= 0) && (size < regSize));
 
-        // Handle the remainder by overlapping with previously processed data
+        // Handle the remainder by overlapping with previously processed data (see genCodeForInitBlkUnroll)
         if ((size > 0) && (size < regSize))
         {
             assert(regSize >= XMM_REGSIZE_BYTES);
@@ -9843,6 +9845,48 @@ void CodeGen::genProfilingLeaveCallback(unsigned helper)
 
 #ifdef TARGET_AMD64
 
+//-----------------------------------------------------------------------------------
+// genProfilingSamplingCheck: If the EE samples the profiler enter/leave/tailcall hooks,
+// emit a check of the sampling flag that skips the hook while the flag is clear.
+//
+// Arguments:
+//     reg        - register to use as scratch register
+//     pSkipLabel - OUT parameter, set to the label the caller must define after the hook.
+//                  In the prolog, this is nullptr and the jump is by instruction count,
+//                  which the caller must set once the hook has been emitted.
+//
+// Return Value:
+//     true if the check was emitted.
+//
+bool CodeGen::genProfilingSamplingCheck(regNumber reg, BasicBlock** pSkipLabel)
+{
+    void* samplingFlag = compiler->eeGetEEInfo()->profilerEnterLeaveSamplingFlag;
+
+    // The flag is only given out by the runtime, the address is not known during AOT.
+    if ((samplingFlag == nullptr) || compiler->compProfilerMethHndIndirected)
+    {
+        return false;
+    }
+
+    // mov reg, samplingFlag
+    // cmp byte ptr [reg], 0
+    // je  skip
+    instGen_Set_Reg_To_Imm(EA_PTRSIZE, reg, (ssize_t)samplingFlag);
+    GetEmitter()->emitIns_I_AR(INS_cmp, EA_1BYTE, 0, reg, 0);
+
+    if (pSkipLabel != nullptr)
+    {
+        *pSkipLabel = genCreateTempLabel();
+        inst_JMP(EJ_je, *pSkipLabel);
+    }
+    else
+    {
+        GetEmitter()->emitIns_J(INS_je, nullptr, 1);
+    }
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------------
 // genProfilingEnterCallback: Generate the profiling function enter callback.
 //
@@ -9909,6 +9953,16 @@ void CodeGen::genProfilingEnterCallback(regNumber initReg, bool* pInitRegZeroed)
         }
     }
 
+    // The prolog is a single instruction group, so the sampling check skips the callback
+    // with an instruction count jump, fixed up below once the callback has been emitted.
+    emitter::instrDesc* skipCallbackJmp      = nullptr;
+    unsigned            skipCallbackInsCount = 0;
+    if (genProfilingSamplingCheck(REG_ARG_0, nullptr))
+    {
+        skipCallbackJmp      = GetEmitter()->emitLastIns;
+        skipCallbackInsCount = GetEmitter()->emitCurIGinsCnt;
+    }
+
     // Emit profiler EnterCallback(ProfilerMethHnd, caller's SP)
     // RCX = ProfilerMethHnd
     if (compiler->compProfilerMethHndIndirected)
@@ -9936,6 +9990,11 @@ void CodeGen::genProfilingEnterCallback(regNumber initReg, bool* pInitRegZeroed)
     // "mov rax, helper addr; call rax"
     genEmitHelperCall(CORINFO_HELP_PROF_FCN_ENTER, 0, EA_UNKNOWN);
 
+    if (skipCallbackJmp != nullptr)
+    {
+        skipCallbackJmp->idAddr()->iiaSetInstrCount((int)(GetEmitter()->emitCurIGinsCnt - skipCallbackInsCount));
+    }
+
     // TODO-AMD64-CQ: Rather than reloading, see if this could be optimized by combining with prolog
     // generation logic that moves args around as required by first BB entry point conditions
     // computed by LSRA.  Code pointers for investigating this further: genFnPrologCalleeRegArgs()
@@ -9988,6 +10047,15 @@ void CodeGen::genProfilingEnterCallback(regNumber initReg, bool* pInitRegZeroed)
 
 #else // !defined(UNIX_AMD64_ABI)
 
+    // See the comment on the sampling check above.
+    emitter::instrDesc* skipCallbackJmp      = nullptr;
+    unsigned            skipCallbackInsCount = 0;
+    if (genProfilingSamplingCheck(REG_PROFILER_ENTER_ARG_0, nullptr))
+    {
+        skipCallbackJmp      = GetEmitter()->emitLastIns;
+        skipCallbackInsCount = GetEmitter()->emitCurIGinsCnt;
+    }
+
     // Emit profiler EnterCallback(ProfilerMethHnd, caller's SP)
     // R14 = ProfilerMethHnd
     if (compiler->compProfilerMethHndIndirected)
@@ -10017,6 +10085,11 @@ void CodeGen::genProfilingEnterCallback(regNumber initReg, bool* pInitRegZeroed)
     // "mov r11, helper addr; call r11"
     genEmitHelperCall(CORINFO_HELP_PROF_FCN_ENTER, 0, EA_UNKNOWN, REG_DEFAULT_PROFILER_CALL_TARGET);
 
+    if (skipCallbackJmp != nullptr)
+    {
+        skipCallbackJmp->idAddr()->iiaSetInstrCount((int)(GetEmitter()->emitCurIGinsCnt - skipCallbackInsCount));
+    }
+
     // If initReg is trashed, either because it was an arg to the enter
     // callback, or because the enter callback itself trashes it, then it needs
     // to be zero'ed again before using.
@@ -10071,6 +10144,9 @@ void CodeGen::genProfilingLeaveCallback(unsigned helper)
     // which is a requirement of profiler as well since it needs to examine
     // return value which could be an obj ref.
 
+    BasicBlock* skipCallbackLabel = nullptr;
+    genProfilingSamplingCheck(REG_ARG_0, &skipCallbackLabel);
+
     // RCX = ProfilerMethHnd
     if (compiler->compProfilerMethHndIndirected)
     {
@@ -10114,6 +10190,9 @@ void CodeGen::genProfilingLeaveCallback(unsigned helper)
 
 #else // !defined(UNIX_AMD64_ABI)
 
+    BasicBlock* skipCallbackLabel = nullptr;
+    genProfilingSamplingCheck(REG_ARG_0, &skipCallbackLabel);
+
     // RDI = ProfilerMethHnd
     if (compiler->compProfilerMethHndIndirected)
     {
@@ -10146,6 +10225,11 @@ void CodeGen::genProfilingLeaveCallback(unsigned helper)
     genEmitHelperCall(helper, 0, EA_UNKNOWN, REG_DEFAULT_PROFILER_CALL_TARGET);
 
 #endif // !defined(UNIX_AMD64_ABI)
+
+    if (skipCallbackLabel != nullptr)
+    {
+        genDefineTempLabel(skipCallbackLabel);
+    }
 }
 
 #endif // TARGET_AMD64
@@ -4279,6 +4279,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 {
     compFunctionTraceStart();
 
+    m_compTicksAtStart = minipal_hires_ticks();
+
     // Enable flow graph checks
     activePhaseChecks |= PhaseChecks::CHECK_FG;
 
@@ -4565,6 +4567,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
     };
     DoPhase(this, PHASE_POST_MORPH, postMorphPhase);
 
+    m_compTicksAtEndOfFrontEnd = minipal_hires_ticks();
+
     // GS security checks for unsafe buffers
     //
     DoPhase(this, PHASE_GS_COOKIE, &Compiler::gsPhase);
@@ -4701,6 +4705,49 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         doVNBasedIntrinExpansion  = doValueNum;
 #endif // defined(OPT_CONFIG)
 
+        // The phases below scale superlinearly with method size, and very large methods can spend
+        // most of their compile time in them. Rather than switching the whole method to MinOpts
+        // (see compSetOptimizationLevel), scale back phase by phase once the method exceeds the
+        // compile-time budget. AOT compiles are not time constrained.
+        if (!IsAot())
+        {
+            const uint64_t budgetCost = (uint64_t)info.compILCodeSize * fgBBcount;
+
+            auto skipPhase = [this](bool& doPhase DEBUGARG(Phases phase)) {
+                if (doPhase)
+                {
+                    JITDUMP("Skipping %s: method exceeds the optimization budget\n", PhaseNames[phase]);
+                    Metrics.PhasesSkippedForOptBudget++;
+                    doPhase = false;
+                }
+            };
+
+            if (budgetCost > (uint64_t)JitConfig.JitOptBudgetLoopOpts())
+            {
+                skipPhase(doLoopHoisting DEBUGARG(PHASE_HOIST_LOOP_CODE));
+                skipPhase(doBranchOpt DEBUGARG(PHASE_OPTIMIZE_BRANCHES));
+                skipPhase(doRangeAnalysis DEBUGARG(PHASE_OPTIMIZE_INDEX_CHECKS));
+                skipPhase(doRangeCheckCloning DEBUGARG(PHASE_RANGE_CHECK_CLONING));
+                skipPhase(doOptimizeIVs DEBUGARG(PHASE_OPTIMIZE_INDUCTION_VARIABLES));
+            }
+
+            if (budgetCost > (uint64_t)JitConfig.JitOptBudgetGlobalOpts())
+            {
+                skipPhase(doValueNum DEBUGARG(PHASE_VALUE_NUMBER));
+                skipPhase(doCopyProp DEBUGARG(PHASE_VN_COPY_PROP));
+                skipPhase(doCse DEBUGARG(PHASE_OPTIMIZE_VALNUM_CSES));
+                skipPhase(doAssertionProp DEBUGARG(PHASE_ASSERTION_PROP_MAIN));
+                skipPhase(doVNBasedDeadStoreRemoval DEBUGARG(PHASE_VN_BASED_DEAD_STORE_REMOVAL));
+                skipPhase(doVNBasedIntrinExpansion DEBUGARG(PHASE_VN_BASED_INTRINSIC_EXPAND));
+            }
+
+            if (Metrics.PhasesSkippedForOptBudget != 0)
+            {
+                JITLOG((LL_INFO100, "Optimization budget exceeded (cost %llu), skipped %d phases for method %s\n",
+                        (unsigned long long)budgetCost, Metrics.PhasesSkippedForOptBudget, info.compFullName));
+            }
+        }
+
         if (opts.optRepeat)
         {
             opts.optRepeatActive = true;
@@ -4794,9 +4841,17 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 
             if (doOptimizeIVs)
             {
+                // Vectorize simple counted reduction loops
+                //
+                DoPhase(this, PHASE_VECTORIZE_LOOPS, &Compiler::optVectorizeLoops);
+
                 // Simplify and optimize induction variables used in natural loops
                 //
                 DoPhase(this, PHASE_OPTIMIZE_INDUCTION_VARIABLES, &Compiler::optInductionVariables);
+
+                // Promote fields loaded and stored in loops to locals
+                //
+                DoPhase(this, PHASE_PROMOTE_LOOP_MEMORY, &Compiler::optPromoteLoopMemory);
             }
 
             fgInvalidateDfsTree();
@@ -4971,6 +5026,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         DoPhase(this, PHASE_ASYNC, &Compiler::TransformAsync);
     }
 
+    m_compTicksAtStartOfBackEnd = minipal_hires_ticks();
+
     // Assign registers to variables, etc.
 
     // Create LinearScan before Lowering, so that Lowering can call LinearScan methods
@@ -5060,6 +5117,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 
     RecordStateAtEndOfCompilation();
 
+    compReportCompileStatistics();
+
     unsigned methodsCompiled = (unsigned)InterlockedIncrement((LONG*)&Compiler::jitTotalMethodCompiled);
 
     if (JitConfig.JitDisasmSummary() && !compIsForInlining())
@@ -8344,6 +8403,7 @@ CompTimeInfo::CompTimeInfo(unsigned byteCodeBytes)
     , m_totalCycles(0)
     , m_parentPhaseEndSlop(0)
     , m_timerFailure(false)
+    , m_arenaBytesAllocated(0)
 #if MEASURE_CLRAPI_CALLS
     , m_allClrAPIcalls(0)
     , m_allClrAPIcycles(0)
@@ -8409,6 +8469,12 @@ void CompTimeSummaryInfo::AddInfo(CompTimeInfo& info, bool includePhases)
         m_maximum.m_byteCodeBytes = max(m_maximum.m_byteCodeBytes, info.m_byteCodeBytes);
         m_total.m_totalCycles += info.m_totalCycles;
         m_maximum.m_totalCycles = max(m_maximum.m_totalCycles, info.m_totalCycles);
+        m_total.m_arenaBytesAllocated += info.m_arenaBytesAllocated;
+        m_maximum.m_arenaBytesAllocated = max(m_maximum.m_arenaBytesAllocated, info.m_arenaBytesAllocated);
+        if (info.m_arenaBytesAllocated > ArenaAllocator::getDefaultPageSize())
+        {
+            m_numMethodsOverDefaultArenaPage++;
+        }
 
 #if MEASURE_CLRAPI_CALLS
         // Update the CLR-API values.
@@ -8519,6 +8585,13 @@ void CompTimeSummaryInfo::Print(FILE* f)
                 ((double)m_maximum.m_totalCycles / countsPerSec) * 1000.0);
         fprintf(f, "          avg: %10.3f Mcycles/%10.3f ms\n",
                 ((double)m_total.m_totalCycles) / 1000000.0 / (double)m_numMethods, totTime_ms / (double)m_numMethods);
+        fprintf(f, "  Arena memory: total: %10.3f MB, max: %10.3f KB, avg: %10.3f KB\n",
+                (double)m_total.m_arenaBytesAllocated / (1024.0 * 1024.0),
+                (double)m_maximum.m_arenaBytesAllocated / 1024.0,
+                (double)m_total.m_arenaBytesAllocated / 1024.0 / (double)m_numMethods);
+        fprintf(f, "                %d methods (%5.2f%%) needed more than one %zu KB arena page\n",
+                m_numMethodsOverDefaultArenaPage, 100.0 * m_numMethodsOverDefaultArenaPage / (double)m_numMethods,
+                ArenaAllocator::getDefaultPageSize() / 1024);
 
         const char* extraHdr1 = "";
         const char* extraHdr2 = "";
@@ -9061,6 +9134,7 @@ void JitTimer::Terminate(Compiler* comp, CompTimeSummaryInfo& sum, bool includeP
         PrintCsvMethodStats(comp);
     }
 
+    m_info.m_arenaBytesAllocated = comp->compGetArenaAllocator()->getTotalBytesAllocated();
     sum.AddInfo(m_info, includePhases);
 }
 #endif // FEATURE_JIT_METHOD_PERF
@@ -9161,6 +9235,52 @@ void Compiler::RecordStateAtEndOfCompilation()
 #endif // defined(DEBUG)
 }
 
+//------------------------------------------------------------------------
+// compReportCompileStatistics: report per-method compile statistics to the EE.
+//
+// Notes:
+//   Unlike the JitMetrics these are reported in all builds, so that the EE can
+//   surface them in its JIT events. Times are wall clock microseconds for the
+//   front end (import through morph), the optimizer (up to lowering) and the
+//   back end (lowering through emit). Arena memory is reported both as the bytes
+//   handed out (BytesAllocated) and as the pages backing them (ArenaBytesAllocated),
+//   which is the peak footprint since the arena only grows during a compile.
+//
+void Compiler::compReportCompileStatistics()
+{
+    assert(!compIsForInlining());
+
+    int64_t const endTicks  = minipal_hires_ticks();
+    int64_t const frequency = minipal_hires_tick_frequency();
+
+    auto reportInt = [this](const char* key, int value) {
+        JitMetadata::report(this, key, &value, sizeof(value));
+    };
+    auto reportTime = [=](const char* key, int64_t startTicks, int64_t stopTicks) {
+        int64_t const microseconds = ((stopTicks - startTicks) * 1000000) / frequency;
+        reportInt(key, (int)min(max(microseconds, (int64_t)0), (int64_t)INT_MAX));
+    };
+
+    reportInt(JitMetadata::InlineCount, (int)m_inlineStrategy->GetInlineCount());
+    reportTime(JitMetadata::FrontEndMicroseconds, m_compTicksAtStart, m_compTicksAtEndOfFrontEnd);
+    reportTime(JitMetadata::OptimizerMicroseconds, m_compTicksAtEndOfFrontEnd, m_compTicksAtStartOfBackEnd);
+    reportTime(JitMetadata::BackEndMicroseconds, m_compTicksAtStartOfBackEnd, endTicks);
+
+    Metrics.BytesAllocated      = (int64_t)compArenaAllocator->getTotalBytesUsed();
+    Metrics.ArenaBytesAllocated = (int64_t)compArenaAllocator->getTotalBytesAllocated();
+    JitMetadata::report(this, JitMetadata::BytesAllocated, &Metrics.BytesAllocated, sizeof(int64_t));
+    JitMetadata::report(this, JitMetadata::ArenaBytesAllocated, &Metrics.ArenaBytesAllocated, sizeof(int64_t));
+
+#if MEASURE_MEM_ALLOC
+    int64_t bytesByKind[CMK_Count];
+    for (int cmk = 0; cmk < CMK_Count; cmk++)
+    {
+        bytesByKind[cmk] = (int64_t)compArenaAllocator->getBytesAllocatedByKind((CompMemKind)cmk);
+    }
+    JitMetadata::report(this, JitMetadata::BytesAllocatedByKind, bytesByKind, sizeof(bytesByKind));
+#endif // MEASURE_MEM_ALLOC
+}
+
 #if FUNC_INFO_LOGGING
 // static
 const char* Compiler::compJitFuncInfoFilename = nullptr;
@@ -1550,6 +1550,9 @@ struct CompTimeInfo
     uint64_t m_parentPhaseEndSlop;
     bool             m_timerFailure;
 
+    // Bytes of arena pages the compilation obtained from the host.
+    size_t m_arenaBytesAllocated;
+
 #if MEASURE_CLRAPI_CALLS
     // The following measures the time spent inside each individual CLR API call.
     unsigned         m_allClrAPIcalls;
@@ -1587,6 +1590,9 @@ class CompTimeSummaryInfo
     int          m_numFilteredMethods;
     CompTimeInfo m_filtered;
 
+    // Number of compilations whose arena outgrew a single default-sized page.
+    int m_numMethodsOverDefaultArenaPage;
+
     // This can use what ever data you want to determine if the value to be added
     // belongs in the filtered section (it's always included in the unfiltered section)
     bool IncludedInFilteredData(CompTimeInfo& info);
@@ -1596,7 +1602,13 @@ public:
     static CompTimeSummaryInfo s_compTimeSummary;
 
     CompTimeSummaryInfo()
-        : m_numMethods(0), m_totMethods(0), m_total(0), m_maximum(0), m_numFilteredMethods(0), m_filtered(0)
+        : m_numMethods(0)
+        , m_totMethods(0)
+        , m_total(0)
+        , m_maximum(0)
+        , m_numFilteredMethods(0)
+        , m_filtered(0)
+        , m_numMethodsOverDefaultArenaPage(0)
     {
     }
 
@@ -4505,6 +4517,22 @@ protected:
         return compiler->impEnumeratorGdvLocalMap;
     }
 
+    // Integer divisions whose divisor is value-profiled, mapped to the IL offset
+    // of the division. Only set on the root instance.
+    //
+    NodeToUnsignedMap* impDivisorProfileMap = nullptr;
+    NodeToUnsignedMap* getImpDivisorProfileMap()
+    {
+        Compiler* compiler = impInlineRoot();
+        if (compiler->impDivisorProfileMap == nullptr)
+        {
+            CompAllocator alloc(compiler->getAllocator(CMK_Generic));
+            compiler->impDivisorProfileMap = new (alloc) NodeToUnsignedMap(alloc);
+        }
+
+        return compiler->impDivisorProfileMap;
+    }
+
     bool hasUpdatedTypeLocals = false;
 
 #define SMALL_STACK_SIZE 16 // number of elements in impSmallStack
@@ -4585,6 +4613,8 @@ protected:
 
     GenTree* impDuplicateWithProfiledArg(GenTreeCall* call, IL_OFFSET ilOffset);
 
+    GenTree* impDuplicateWithProfiledDivisor(GenTreeOp* divMod, IL_OFFSET ilOffset);
+
     GenTree* impThrowIfNull(GenTreeCall* call);
 
 #ifdef DEBUG
@@ -5098,6 +5128,8 @@ private:
 
     void impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, InlineResult* inlineResult);
 
+    unsigned impInlineCountConstantArgs(GenTreeCall* call);
+
     // STATIC inlining decision based on the IL code.
     void impCanInlineIL(CORINFO_METHOD_HANDLE fncHandle,
                         CORINFO_METHOD_INFO*  methInfo,
@@ -7059,6 +7091,7 @@ public:
     void optCloneLoop(FlowGraphNaturalLoop* loop, LoopCloneContext* context);
     PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
     bool optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
+    bool optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
     void optRedirectPrevUnrollIteration(FlowGraphNaturalLoop* loop, BasicBlock* prevTestBlock, BasicBlock* target);
     void optReplaceScalarUsesWithConst(BasicBlock* block, unsigned lclNum, ssize_t cnsVal);
     void        optRemoveRedundantZeroInits();
@@ -7655,6 +7688,8 @@ public:
 #endif
 
     PhaseStatus optInductionVariables();
+    PhaseStatus optVectorizeLoops();
+    PhaseStatus optPromoteLoopMemory();
 
     template <typename TFunctor>
     void optVisitBoundingExitingCondBlocks(FlowGraphNaturalLoop* loop, TFunctor func);
@@ -9446,7 +9481,8 @@ public:
         Memmove,
         MemcmpU16,
         ProfiledMemmove,
-        ProfiledMemcmp
+        ProfiledMemcmp,
+        ProfiledMemset
     };
 
     //------------------------------------------------------------------------
@@ -9529,9 +9565,10 @@ public:
 #endif
         }
 
-        // For profiled memcmp/memmove we don't want to unroll too much as it's just a guess,
+        // For profiled memcmp/memmove/memset we don't want to unroll too much as it's just a guess,
         // and it works better for small sizes.
-        if ((type == UnrollKind::ProfiledMemcmp) || (type == UnrollKind::ProfiledMemmove))
+        if ((type == UnrollKind::ProfiledMemcmp) || (type == UnrollKind::ProfiledMemmove) ||
+            (type == UnrollKind::ProfiledMemset))
         {
             threshold = maxRegSize * 2;
         }
@@ -9924,6 +9961,9 @@ public:
 #define DEFAULT_MIN_OPTS_LV_NUM_COUNT 2000
 #define DEFAULT_MIN_OPTS_LV_REF_COUNT 8000
 
+#define DEFAULT_OPT_BUDGET_LOOP_OPTS   (10000 * 1000)
+#define DEFAULT_OPT_BUDGET_GLOBAL_OPTS (30000 * 1500)
+
 // Maximum number of locals before turning off the inlining
 #define MAX_LV_NUM_COUNT_FOR_INLINING 512
 
@@ -11308,6 +11348,14 @@ private:
     // Assumes being called at the end of compilation.  Update the SQM state.
     void RecordStateAtEndOfCompilation();
 
+    // Raw timer counts at the phase group boundaries of the current (root) compilation. Kept in
+    // all builds and reported to the EE by compReportCompileStatistics.
+    int64_t m_compTicksAtStart;
+    int64_t m_compTicksAtEndOfFrontEnd;
+    int64_t m_compTicksAtStartOfBackEnd;
+
+    void compReportCompileStatistics();
+
 public:
 #if FUNC_INFO_LOGGING
     static const char* compJitFuncInfoFilename; // If a log file for per-function information is required, this is the
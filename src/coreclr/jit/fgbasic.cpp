@@ -924,6 +924,11 @@ void Compiler::fgFindJumpTargets(const BYTE* codeAddr, IL_OFFSET codeSize, Fixed
         compInlineResult->NoteDouble(InlineObservation::CALLSITE_PROFILE_FREQUENCY, 1.0);
         // Observe force inline state and code size.
         compInlineResult->NoteBool(InlineObservation::CALLEE_IS_FORCE_INLINE, isForceInline);
+        if (isInlining)
+        {
+            compInlineResult->NoteInt(InlineObservation::CALLSITE_CONSTANT_ARGS,
+                                      (int)impInlineCountConstantArgs(impInlineInfo->iciCall));
+        }
         compInlineResult->NoteInt(InlineObservation::CALLEE_IL_CODE_SIZE, codeSize);
 
         // Determine if call site is within a try.
@@ -1910,6 +1910,56 @@ public:
     }
 };
 
+//------------------------------------------------------------------------
+// IsDivisorProbeCandidate: check if a node is an integer division whose divisor
+//   was marked for value profiling by the importer
+//
+// Arguments:
+//   compiler  - compiler instance
+//   node      - node to check
+//   pILOffset - [out] IL offset of the division, if it's a candidate
+//
+// Return Value:
+//   true if the divisor of the node should be probed
+//
+static bool IsDivisorProbeCandidate(Compiler* compiler, GenTree* node, IL_OFFSET* pILOffset = nullptr)
+{
+    if (!node->OperIs(GT_DIV, GT_UDIV, GT_MOD, GT_UMOD) || (compiler->impDivisorProfileMap == nullptr))
+    {
+        return false;
+    }
+
+    unsigned ilOffset = BAD_IL_OFFSET;
+    if (!compiler->impDivisorProfileMap->Lookup(node, &ilOffset))
+    {
+        return false;
+    }
+
+    if (pILOffset != nullptr)
+    {
+        *pILOffset = ilOffset;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------
+// GetValueProbeILOffset: get the IL offset a generic value probe is keyed on
+//
+static IL_OFFSET GetValueProbeILOffset(Compiler* compiler, GenTree* node)
+{
+    IL_OFFSET ilOffset = BAD_IL_OFFSET;
+    if (node->IsCall())
+    {
+        ilOffset = node->AsCall()->gtHandleHistogramProfileCandidateInfo->ilOffset;
+    }
+    else
+    {
+        bool isCandidate = IsDivisorProbeCandidate(compiler, node, &ilOffset);
+        assert(isCandidate);
+    }
+    return ilOffset;
+}
+
 //------------------------------------------------------------------------
 // ValueHistogramProbeVisitor: invoke functor on each node requiring a generic value probe
 //
@@ -1938,11 +1988,16 @@ public:
         if (node->IsCall() && node->AsCall()->IsSpecialIntrinsic())
         {
             const NamedIntrinsic ni = m_compiler->lookupNamedIntrinsic(node->AsCall()->gtCallMethHnd);
-            if ((ni == NI_System_SpanHelpers_Memmove) || (ni == NI_System_SpanHelpers_SequenceEqual))
+            if ((ni == NI_System_SpanHelpers_Memmove) || (ni == NI_System_SpanHelpers_SequenceEqual) ||
+                (ni == NI_System_SpanHelpers_Fill) || (ni == NI_System_SpanHelpers_ClearWithoutReferences))
             {
                 m_functor(m_compiler, node);
             }
         }
+        else if (IsDivisorProbeCandidate(m_compiler, node))
+        {
+            m_functor(m_compiler, node);
+        }
         return Compiler::WALK_CONTINUE;
     }
 };
@@ -2026,14 +2081,14 @@ public:
     {
     }
 
-    void operator()(Compiler* compiler, GenTree* call)
+    void operator()(Compiler* compiler, GenTree* node)
     {
         ICorJitInfo::PgoInstrumentationSchema schemaElem = {};
         schemaElem.Count                                 = 1;
         schemaElem.InstrumentationKind                   = compiler->opts.compCollect64BitCounts
                                                                ? ICorJitInfo::PgoInstrumentationKind::ValueHistogramLongCount
                                                                : ICorJitInfo::PgoInstrumentationKind::ValueHistogramIntCount;
-        schemaElem.ILOffset = (int32_t)call->AsCall()->gtHandleHistogramProfileCandidateInfo->ilOffset;
+        schemaElem.ILOffset = (int32_t)GetValueProbeILOffset(compiler, node);
         m_schema.push_back(schemaElem);
         m_schemaCount++;
 
@@ -2267,12 +2322,14 @@ public:
             return;
         }
 
-        assert(node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_Memmove) ||
-               node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_SequenceEqual));
+        assert(node->OperIs(GT_DIV, GT_UDIV, GT_MOD, GT_UMOD) ||
+               node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_Memmove) ||
+               node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_SequenceEqual) ||
+               node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_Fill) ||
+               node->AsCall()->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_ClearWithoutReferences));
 
         const ICorJitInfo::PgoInstrumentationSchema& countEntry = m_schema[*m_currentSchemaIndex];
-        if (countEntry.ILOffset !=
-            static_cast<int32_t>(node->AsCall()->gtHandleHistogramProfileCandidateInfo->ilOffset))
+        if (countEntry.ILOffset != static_cast<int32_t>(GetValueProbeILOffset(compiler, node)))
         {
             return;
         }
@@ -2292,7 +2349,24 @@ public:
 
         *m_currentSchemaIndex += 2;
 
-        GenTree** lenArgRef = &node->AsCall()->gtArgs.GetUserArgByIndex(2)->EarlyNodeRef();
+        // For Memmove(dst, src, len) and SequenceEqual(a, b, len) we probe the len, for Fill(dst, len, value)
+        // and ClearWithoutReferences(dst, len) the len as well, for divisions the divisor.
+        GenTree** lenArgRef = nullptr;
+        if (node->IsCall())
+        {
+            GenTreeCall* const call   = node->AsCall();
+            unsigned           argNum = 2;
+            if (call->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_Fill) ||
+                call->IsSpecialIntrinsic(compiler, NI_System_SpanHelpers_ClearWithoutReferences))
+            {
+                argNum = 1;
+            }
+            lenArgRef = &call->gtArgs.GetUserArgByIndex(argNum)->EarlyNodeRef();
+        }
+        else
+        {
+            lenArgRef = &node->AsOp()->gtOp2;
+        }
 
         // We have Memmove(dst, src, len) and we want to insert a call to CORINFO_HELP_VALUEPROFILE for the len:
         //
@@ -2311,8 +2385,14 @@ public:
         GenTree*       lengthLocal    = compiler->gtNewLclvNode(lenTmpNum, genActualType(*lenArgRef));
         GenTreeOp* lengthNode = compiler->gtNewOperNode(GT_COMMA, lengthLocal->TypeGet(), storeLenToTemp, lengthLocal);
         GenTree*   histNode   = compiler->gtNewIconNode(reinterpret_cast<ssize_t>(hist), TYP_I_IMPL);
+        GenTree*   valueNode  = lengthNode;
+        if (genActualType(lengthNode) != TYP_I_IMPL)
+        {
+            // The helpers take a native-sized value (e.g. an int divisor on a 64-bit target).
+            valueNode = compiler->gtNewCastNode(TYP_I_IMPL, lengthNode, /* fromUnsigned */ false, TYP_I_IMPL);
+        }
         unsigned   helper     = is32 ? CORINFO_HELP_VALUEPROFILE32 : CORINFO_HELP_VALUEPROFILE64;
-        GenTreeCall* helperCallNode = compiler->gtNewHelperCallNode(helper, TYP_VOID, lengthNode, histNode);
+        GenTreeCall* helperCallNode = compiler->gtNewHelperCallNode(helper, TYP_VOID, valueNode, histNode);
 
         *lenArgRef = compiler->gtNewOperNode(GT_COMMA, lengthLocal->TypeGet(), helperCallNode,
                                              compiler->gtCloneExpr(lengthLocal));
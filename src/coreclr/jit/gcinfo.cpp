@@ -253,6 +253,12 @@ GCInfo::WriteBarrierForm GCInfo::gcIsWriteBarrierCandidate(GenTreeStoreInd* stor
         return WBF_NoBarrier;
     }
 
+    if ((store->gtFlags & GTF_IND_TGT_YOUNG) != 0)
+    {
+        // This indirection stores into an object that cannot have left gen0 yet.
+        return WBF_NoBarrier;
+    }
+
     if ((store->gtFlags & GTF_IND_TGT_HEAP) != 0)
     {
         // This indirection is known to store to the heap.
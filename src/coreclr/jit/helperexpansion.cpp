@@ -1045,9 +1045,30 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
     }
     else
     {
+        // Types from collectible assemblies keep their thread statics in a separate array of handles, which
+        // the EE signals by setting CORINFO_THREAD_STATIC_INDEX_COLLECTIBLE in the index.
+        bool isCollectible = typeThreadStaticBlockIndexValue->IsIntegralConst() &&
+                             ((typeThreadStaticBlockIndexValue->AsIntConCommon()->IconValue() &
+                               CORINFO_THREAD_STATIC_INDEX_COLLECTIBLE) != 0);
+
         size_t offsetOfThreadStaticBlocksVal    = threadStaticBlocksInfo.offsetOfThreadStaticBlocks;
         size_t offsetOfMaxThreadStaticBlocksVal = threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks;
 
+        if (isCollectible)
+        {
+            offsetOfThreadStaticBlocksVal    = threadStaticBlocksInfo.offsetOfCollectibleThreadStaticBlocks;
+            offsetOfMaxThreadStaticBlocksVal = threadStaticBlocksInfo.offsetOfMaxCollectibleThreadStaticBlocks;
+
+            // The helper in fallbackBb still gets the original index
+            ssize_t indexVal = typeThreadStaticBlockIndexValue->AsIntConCommon()->IconValue();
+            typeThreadStaticBlockIndexValue =
+                gtNewIconNode((ssize_t)(indexVal & ~(ssize_t)CORINFO_THREAD_STATIC_INDEX_COLLECTIBLE), TYP_INT);
+        }
+
+        // The collectible blocks are a native array of handles rather than a managed array
+        var_types blocksType = isCollectible ? TYP_I_IMPL : TYP_REF;
+        var_types blockType  = isCollectible ? TYP_I_IMPL : TYP_BYREF;
+
         // Create tree for "maxThreadStaticBlocks = tls[offsetOfMaxThreadStaticBlocks]"
         GenTree* offsetOfMaxThreadStaticBlocks = gtNewIconNode(offsetOfMaxThreadStaticBlocksVal, TYP_I_IMPL);
         GenTree* maxThreadStaticBlocksRef =
@@ -1057,7 +1078,7 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
 
         GenTree* threadStaticBlocksRef = gtNewOperNode(GT_ADD, TYP_I_IMPL, gtCloneExpr(tlsLclValueUse),
                                                        gtNewIconNode(offsetOfThreadStaticBlocksVal, TYP_I_IMPL));
-        threadStaticBlocksValue = gtNewIndir(TYP_REF, threadStaticBlocksRef, GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
+        threadStaticBlocksValue = gtNewIndir(blocksType, threadStaticBlocksRef, GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
 
         // Create tree for "if (maxThreadStaticBlocks < typeIndex)"
         GenTree* maxThreadStaticBlocksCond =
@@ -1076,12 +1097,12 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         typeThreadStaticBlockIndexValue = gtFoldExpr(typeThreadStaticBlockIndexValue);
 #endif
         GenTree* typeThreadStaticBlockRef =
-            gtNewOperNode(GT_ADD, TYP_BYREF, threadStaticBlocksValue, typeThreadStaticBlockIndexValue);
-        GenTree* typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+            gtNewOperNode(GT_ADD, blockType, threadStaticBlocksValue, typeThreadStaticBlockIndexValue);
+        GenTree* typeThreadStaticBlockValue = gtNewIndir(blockType, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
 
         // Cache the threadStaticBlock value
         unsigned threadStaticBlockBaseLclNum         = lvaGrabTemp(true DEBUGARG("ThreadStaticBlockBase access"));
-        lvaTable[threadStaticBlockBaseLclNum].lvType = TYP_BYREF;
+        lvaTable[threadStaticBlockBaseLclNum].lvType = blockType;
         GenTree* threadStaticBlockBaseDef =
             gtNewStoreLclVarNode(threadStaticBlockBaseLclNum, typeThreadStaticBlockValue);
         GenTree* threadStaticBlockBaseLclValueUse = gtNewLclVarNode(threadStaticBlockBaseLclNum);
@@ -1091,6 +1112,26 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
             gtNewOperNode(GT_NE, TYP_INT, threadStaticBlockBaseLclValueUse, gtNewIconNode(0, TYP_I_IMPL));
         threadStaticBlockNullCond = gtNewOperNode(GT_JTRUE, TYP_VOID, threadStaticBlockNullCond);
 
+        // For collectible blocks, the handle has to be dereferenced and its target checked as well:
+        // "if ((threadStaticBlockObject = *threadStaticBlockValue) != nullptr)"
+        GenTree* threadStaticBlockObjectDef      = nullptr;
+        GenTree* threadStaticBlockObjectNullCond = nullptr;
+        GenTree* fastPathValue                   = threadStaticBlockBaseLclValueUse;
+        if (isCollectible)
+        {
+            unsigned threadStaticBlockObjectLclNum = lvaGrabTemp(true DEBUGARG("ThreadStaticBlockObject access"));
+            lvaTable[threadStaticBlockObjectLclNum].lvType = TYP_BYREF;
+            threadStaticBlockObjectDef =
+                gtNewStoreLclVarNode(threadStaticBlockObjectLclNum,
+                                     gtNewIndir(TYP_BYREF, gtCloneExpr(threadStaticBlockBaseLclValueUse),
+                                                GTF_IND_NONFAULTING));
+            fastPathValue = gtNewLclVarNode(threadStaticBlockObjectLclNum);
+
+            threadStaticBlockObjectNullCond =
+                gtNewOperNode(GT_NE, TYP_INT, gtCloneExpr(fastPathValue), gtNewIconNode(0, TYP_I_IMPL));
+            threadStaticBlockObjectNullCond = gtNewOperNode(GT_JTRUE, TYP_VOID, threadStaticBlockObjectNullCond);
+        }
+
         // prevBb (BBJ_ALWAYS):                                             [weight: 1.0]
         //      ...
         //
@@ -1102,6 +1143,11 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         // threadStaticBlockNullCondBB (BBJ_COND):                          [weight: 1.0]
         //      fastPathValue = t_threadStaticBlocks[typeIndex]
         //      if (fastPathValue != nullptr)
+        //          goto fastPathBb;        // goto threadStaticBlockObjectNullCondBB for collectible types
+        //
+        // threadStaticBlockObjectNullCondBB (BBJ_COND), collectible only:  [weight: 1.0]
+        //      fastPathObject = *fastPathValue
+        //      if (fastPathObject != nullptr)
         //          goto fastPathBb;
         //
         // fallbackBb (BBJ_ALWAYS):                                         [weight: 0]
@@ -1109,7 +1155,7 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         //      goto block;
         //
         // fastPathBb(BBJ_ALWAYS):                                          [weight: 1.0]
-        //      threadStaticBlockBase = fastPathValue;
+        //      threadStaticBlockBase = fastPathValue;   // fastPathObject for collectible types
         //
         // block (...):                                                     [weight: 1.0]
         //      use(threadStaticBlockBase);
@@ -1129,13 +1175,22 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         fgInsertStmtAfter(threadStaticBlockNullCondBB, threadStaticBlockNullCondBB->firstStmt(),
                           fgNewStmtFromTree(threadStaticBlockNullCond));
 
+        BasicBlock* threadStaticBlockObjectNullCondBB = nullptr;
+        BasicBlock* lastCondBB                        = threadStaticBlockNullCondBB;
+        if (isCollectible)
+        {
+            threadStaticBlockObjectNullCondBB =
+                fgNewBBFromTreeAfter(BBJ_COND, threadStaticBlockNullCondBB, threadStaticBlockObjectDef, debugInfo);
+            fgInsertStmtAfter(threadStaticBlockObjectNullCondBB, threadStaticBlockObjectNullCondBB->firstStmt(),
+                              fgNewStmtFromTree(threadStaticBlockObjectNullCond));
+            lastCondBB = threadStaticBlockObjectNullCondBB;
+        }
+
         // fallbackBb
         GenTree*    fallbackValueDef = gtNewStoreLclVarNode(threadStaticBlockLclNum, call);
-        BasicBlock* fallbackBb =
-            fgNewBBFromTreeAfter(BBJ_ALWAYS, threadStaticBlockNullCondBB, fallbackValueDef, debugInfo, true);
+        BasicBlock* fallbackBb = fgNewBBFromTreeAfter(BBJ_ALWAYS, lastCondBB, fallbackValueDef, debugInfo, true);
 
-        GenTree* fastPathValueDef =
-            gtNewStoreLclVarNode(threadStaticBlockLclNum, gtCloneExpr(threadStaticBlockBaseLclValueUse));
+        GenTree* fastPathValueDef = gtNewStoreLclVarNode(threadStaticBlockLclNum, gtCloneExpr(fastPathValue));
         BasicBlock* fastPathBb = fgNewBBFromTreeAfter(BBJ_ALWAYS, fallbackBb, fastPathValueDef, debugInfo, true);
 
         //
@@ -1154,14 +1209,25 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         }
 
         {
-            FlowEdge* const trueEdge  = fgAddRefPred(fastPathBb, threadStaticBlockNullCondBB);
-            FlowEdge* const falseEdge = fgAddRefPred(fallbackBb, threadStaticBlockNullCondBB);
+            BasicBlock* const nextBb    = isCollectible ? threadStaticBlockObjectNullCondBB : fastPathBb;
+            FlowEdge* const   trueEdge  = fgAddRefPred(nextBb, threadStaticBlockNullCondBB);
+            FlowEdge* const   falseEdge = fgAddRefPred(fallbackBb, threadStaticBlockNullCondBB);
             threadStaticBlockNullCondBB->SetTrueEdge(trueEdge);
             threadStaticBlockNullCondBB->SetFalseEdge(falseEdge);
             trueEdge->setLikelihood(1.0);
             falseEdge->setLikelihood(0.0);
         }
 
+        if (isCollectible)
+        {
+            FlowEdge* const trueEdge  = fgAddRefPred(fastPathBb, threadStaticBlockObjectNullCondBB);
+            FlowEdge* const falseEdge = fgAddRefPred(fallbackBb, threadStaticBlockObjectNullCondBB);
+            threadStaticBlockObjectNullCondBB->SetTrueEdge(trueEdge);
+            threadStaticBlockObjectNullCondBB->SetFalseEdge(falseEdge);
+            trueEdge->setLikelihood(1.0);
+            falseEdge->setLikelihood(0.0);
+        }
+
         {
             FlowEdge* const newEdge = fgAddRefPred(block, fastPathBb);
             fastPathBb->SetTargetEdge(newEdge);
@@ -1176,6 +1242,10 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         block->inheritWeight(prevBb);
         maxThreadStaticBlocksCondBB->inheritWeight(prevBb);
         threadStaticBlockNullCondBB->inheritWeight(prevBb);
+        if (isCollectible)
+        {
+            threadStaticBlockObjectNullCondBB->inheritWeight(prevBb);
+        }
         fastPathBb->inheritWeight(prevBb);
 
         // fallback will just execute first time
@@ -1185,6 +1255,7 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         assert(BasicBlock::sameEHRegion(prevBb, block));
         assert(BasicBlock::sameEHRegion(prevBb, maxThreadStaticBlocksCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, threadStaticBlockNullCondBB));
+        assert(!isCollectible || BasicBlock::sameEHRegion(prevBb, threadStaticBlockObjectNullCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, fastPathBb));
     }
 
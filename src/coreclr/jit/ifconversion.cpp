@@ -41,9 +41,23 @@ private:
         GenTree*    node  = nullptr;
     };
 
-    GenTree*           m_cond;          // The condition in the conversion
-    IfConvertOperation m_thenOperation; // The single operation in the Then case.
-    IfConvertOperation m_elseOperation; // The single operation in the Else case.
+    // A SELECT to be created, and the operations it originates from. Local stores that
+    // only happen in one of the cases keep the existing value in the other case.
+    struct IfConvertSelect
+    {
+        IfConvertOperation* thenOperation = nullptr; // The operation in the Then case, if any.
+        IfConvertOperation* elseOperation = nullptr; // The operation in the Else case, if any.
+    };
+
+    static const int MaxOperations = 3; // Max number of operations to allow in both the True and Else cases.
+
+    GenTree*           m_cond;                          // The condition in the conversion
+    IfConvertOperation m_thenOperations[MaxOperations]; // The operations in the Then case.
+    IfConvertOperation m_elseOperations[MaxOperations]; // The operations in the Else case.
+    IfConvertSelect    m_selects[2 * MaxOperations];    // The SELECTs to create, in execution order.
+    int                m_thenOperationCount = 0;
+    int                m_elseOperationCount = 0;
+    int                m_selectCount        = 0;
 
     int m_checkLimit = 4; // Max number of chained blocks to allow in both the True and Else cases.
 
@@ -54,7 +68,9 @@ private:
     bool IfConvertCheckInnerBlockFlow(BasicBlock* block);
     bool IfConvertCheckThenFlow();
     void IfConvertFindFlow();
-    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation);
+    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperations, int* foundCount);
+    bool IfConvertPairOperations();
+    bool IfConvertCheckSelectsIndependent();
     void IfConvertJoinStmts(BasicBlock* fromBlock);
 
 #ifdef DEBUG
@@ -208,20 +224,23 @@ void OptIfConversionDsc::IfConvertFindFlow()
 // IfConvertCheckStmts
 //
 // From the given block to the final block, check all the statements and nodes are
-// valid for an If conversion. Chain of blocks must contain only a single local
-// store and no other operations.
+// valid for an If conversion. Chain of blocks must contain either a single return, or
+// up to MaxOperations stores to distinct locals, and no other operations.
 //
 // Arguments:
-//   fromBlock      - Block inside the if statement to start from (Either Then or Else path).
-//   foundOperation - Returns the found operation.
+//   fromBlock       - Block inside the if statement to start from (Either Then or Else path).
+//   foundOperations - Returns the found operations, in execution order.
+//   foundCount      - Returns the number of found operations.
 //
 // Returns:
-//   If everything is valid, then set foundOperation to the store and return true.
+//   If everything is valid, then set foundOperations and foundCount and return true.
 //   Otherwise return false.
 //
-bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation)
+bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock*         fromBlock,
+                                             IfConvertOperation* foundOperations,
+                                             int*                foundCount)
 {
-    bool found = false;
+    *foundCount = 0;
 
     for (BasicBlock* block = fromBlock; block != m_finalBlock; block = block->GetUniqueSucc())
     {
@@ -235,12 +254,21 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             {
                 case GT_STORE_LCL_VAR:
                 {
-                    // Only one per operation per block can be conditionally executed.
-                    if (found)
+                    // Only a limited number of stores to distinct locals can be conditionally executed.
+                    if (*foundCount == MaxOperations)
                     {
                         return false;
                     }
 
+                    for (int i = 0; i < *foundCount; i++)
+                    {
+                        if (!foundOperations[i].node->OperIs(GT_STORE_LCL_VAR) ||
+                            (foundOperations[i].node->AsLclVar()->GetLclNum() == tree->AsLclVar()->GetLclNum()))
+                        {
+                            return false;
+                        }
+                    }
+
                     // Ensure the local has integer type.
                     if (!varTypeIsIntegralOrI(tree))
                     {
@@ -278,10 +306,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    IfConvertOperation* foundOperation = &foundOperations[(*foundCount)++];
+                    foundOperation->block              = block;
+                    foundOperation->stmt               = stmt;
+                    foundOperation->node               = tree;
                     break;
                 }
 
@@ -297,7 +325,7 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                     }
 
                     // Only one per operation per block can be conditionally executed.
-                    if (found || retVal == nullptr)
+                    if ((*foundCount != 0) || retVal == nullptr)
                     {
                         return false;
                     }
@@ -333,10 +361,10 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    IfConvertOperation* foundOperation = &foundOperations[(*foundCount)++];
+                    foundOperation->block              = block;
+                    foundOperation->stmt               = stmt;
+                    foundOperation->node               = tree;
                     break;
                 }
 
@@ -350,7 +378,149 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             }
         }
     }
-    return found;
+    return *foundCount != 0;
+}
+
+//-----------------------------------------------------------------------------
+// IfConvertPairOperations
+//
+// Pair up the operations of the Then and Else cases into the SELECTs to create.
+// Stores to the same local in both cases become a single SELECT; the remaining
+// stores keep the existing value of the local in the other case.
+//
+// Assumptions:
+//   The Then and Else operations have been found.
+//
+// Returns:
+//   True if the operations can be paired up, else false.
+//
+// Notes:
+//   Sets m_selects and m_selectCount. The SELECTs of the Then case come first, in
+//   the order of the Then operations, followed by the SELECTs for the remaining Else
+//   operations in their order.
+//
+bool OptIfConversionDsc::IfConvertPairOperations()
+{
+    m_selectCount = 0;
+
+    if (m_mainOper == GT_RETURN)
+    {
+        assert(m_doElseConversion);
+        assert((m_thenOperationCount == 1) && (m_elseOperationCount == 1));
+        m_selects[0].thenOperation = &m_thenOperations[0];
+        m_selects[0].elseOperation = &m_elseOperations[0];
+        m_selectCount              = 1;
+        return true;
+    }
+
+    for (int i = 0; i < m_thenOperationCount; i++)
+    {
+        IfConvertSelect& select = m_selects[m_selectCount++];
+        select.thenOperation    = &m_thenOperations[i];
+        select.elseOperation    = nullptr;
+    }
+
+    for (int i = 0; i < m_elseOperationCount; i++)
+    {
+        IfConvertOperation* elseOperation = &m_elseOperations[i];
+        if (!elseOperation->node->OperIs(GT_STORE_LCL_VAR))
+        {
+            return false;
+        }
+
+        unsigned lclNum = elseOperation->node->AsLclVar()->GetLclNum();
+        bool     paired = false;
+        for (int j = 0; j < m_thenOperationCount; j++)
+        {
+            if (m_selects[j].thenOperation->node->AsLclVar()->GetLclNum() == lclNum)
+            {
+                // Local stores of both cases must agree on the type of the local.
+                if (m_selects[j].thenOperation->node->TypeGet() != elseOperation->node->TypeGet())
+                {
+                    return false;
+                }
+
+                m_selects[j].elseOperation = elseOperation;
+                paired                     = true;
+                break;
+            }
+        }
+
+        if (!paired)
+        {
+            IfConvertSelect& select = m_selects[m_selectCount++];
+            select.thenOperation    = nullptr;
+            select.elseOperation    = elseOperation;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// IfConvertCheckSelectsIndependent
+//
+// When more than one SELECT is created, check that they can be executed one after
+// another without changing the values they compute.
+//
+// Returns:
+//   True if the SELECTs are independent, else false.
+//
+// Notes:
+//   Every SELECT evaluates its own copy of the condition, and the stores are no longer
+//   executed in the order of either case. Thus neither the condition nor any of the
+//   stored values may read a local stored by another SELECT. Reading the local that is
+//   stored by the same SELECT is fine, as that happens before the store both before and
+//   after the conversion.
+//
+bool OptIfConversionDsc::IfConvertCheckSelectsIndependent()
+{
+    assert(m_selectCount > 1);
+
+    // The condition is duplicated, so it must be cheap and free of side effects.
+    if (((m_cond->gtFlags & (GTF_SIDE_EFFECT | GTF_ORDER_SIDEEFF)) != 0) ||
+        !(m_cond->gtGetOp1()->OperIsLocal() || m_cond->gtGetOp1()->IsInvariant()) ||
+        !(m_cond->gtGetOp2()->OperIsLocal() || m_cond->gtGetOp2()->IsInvariant()))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < m_selectCount; i++)
+    {
+        IfConvertOperation* operation =
+            (m_selects[i].thenOperation != nullptr) ? m_selects[i].thenOperation : m_selects[i].elseOperation;
+        unsigned   lclNum = operation->node->AsLclVar()->GetLclNum();
+        LclVarDsc* varDsc = m_comp->lvaGetDesc(lclNum);
+
+        // Uses through addresses or of the parent struct would not be visible below.
+        if (varDsc->IsAddressExposed() || varDsc->lvIsStructField)
+        {
+            return false;
+        }
+
+        if (Compiler::gtHasRef(m_cond, lclNum))
+        {
+            return false;
+        }
+
+        for (int j = 0; j < m_selectCount; j++)
+        {
+            if (i == j)
+            {
+                continue;
+            }
+
+            IfConvertOperation* thenOperation = m_selects[j].thenOperation;
+            IfConvertOperation* elseOperation = m_selects[j].elseOperation;
+            if (((thenOperation != nullptr) && Compiler::gtHasRef(thenOperation->node->AsLclVar()->Data(), lclNum)) ||
+                ((elseOperation != nullptr) && Compiler::gtHasRef(elseOperation->node->AsLclVar()->Data(), lclNum)))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -548,6 +718,15 @@ void OptIfConversionDsc::IfConvertDump()
 // ------------ BB04 [00D..010), preds={} succs={BB06}
 // ------------ BB05 [00D..010), preds={} succs={BB06}
 //
+// The Then and Else cases may also contain up to MaxOperations stores to distinct
+// locals each, for example:
+// if (x < y) { min = x; max = y; } else { min = y; max = x; }
+//
+// Every local stored in either case gets its own SELECT with a copy of the condition.
+// This requires the condition and the stored values to not read any of the locals
+// stored by the other SELECTs, and when there is profile data, for the branch to not
+// be predictable.
+//
 bool OptIfConversionDsc::optIfConvert()
 {
     // Does the block end by branching via a JTRUE after a compare?
@@ -572,44 +751,44 @@ bool OptIfConversionDsc::optIfConvert()
         return false;
     }
 
-    // Check the Then and Else blocks have a single operation each.
-    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), &m_thenOperation))
+    // Check the Then and Else blocks only have operations that can be conditionally executed.
+    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), m_thenOperations, &m_thenOperationCount))
     {
         return false;
     }
-    assert(m_thenOperation.node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
+    assert(m_thenOperations[0].node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
     if (m_doElseConversion)
     {
-        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), &m_elseOperation))
+        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), m_elseOperations, &m_elseOperationCount))
         {
             return false;
         }
 
         // Both operations must be the same node type.
-        if (m_thenOperation.node->OperGet() != m_elseOperation.node->OperGet())
+        if (m_thenOperations[0].node->OperGet() != m_elseOperations[0].node->OperGet())
         {
             return false;
         }
+    }
 
-        // Currently can only support Else Store Blocks that have the same destination as the Then block.
-        if (m_thenOperation.node->OperIs(GT_STORE_LCL_VAR))
-        {
-            unsigned lclNumThen = m_thenOperation.node->AsLclVarCommon()->GetLclNum();
-            unsigned lclNumElse = m_elseOperation.node->AsLclVarCommon()->GetLclNum();
-            if (lclNumThen != lclNumElse)
-            {
-                return false;
-            }
-        }
+    if (!IfConvertPairOperations())
+    {
+        return false;
+    }
+
+    if ((m_selectCount > 1) && !IfConvertCheckSelectsIndependent())
+    {
+        JITDUMP("Skipping if-conversion of dependent operations\n");
+        return false;
     }
 
 #ifdef DEBUG
     if (m_comp->verbose)
     {
-        JITDUMP("\nConditionally executing " FMT_BB, m_thenOperation.block->bbNum);
+        JITDUMP("\nConditionally executing " FMT_BB, m_thenOperations[0].block->bbNum);
         if (m_doElseConversion)
         {
-            JITDUMP(" and " FMT_BB, m_elseOperation.block->bbNum);
+            JITDUMP(" and " FMT_BB, m_elseOperations[0].block->bbNum);
         }
         JITDUMP(" inside " FMT_BB "\n", m_startBlock->bbNum);
         IfConvertDump();
@@ -620,35 +799,47 @@ bool OptIfConversionDsc::optIfConvert()
     // Put a limit on the original source and destinations.
     if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_COST, 25))
     {
-        int thenCost = 0;
-        int elseCost = 0;
+        auto operationCost = [=](IfConvertOperation* operation) {
+            if (operation == nullptr)
+            {
+                return 0;
+            }
 
-        if (m_mainOper == GT_STORE_LCL_VAR)
-        {
-            thenCost = m_thenOperation.node->AsLclVar()->Data()->GetCostEx() +
-                       (m_comp->gtIsLikelyRegVar(m_thenOperation.node) ? 0 : 2);
-            if (m_doElseConversion)
+            if (m_mainOper == GT_STORE_LCL_VAR)
             {
-                elseCost = m_elseOperation.node->AsLclVar()->Data()->GetCostEx() +
-                           (m_comp->gtIsLikelyRegVar(m_elseOperation.node) ? 0 : 2);
+                return operation->node->AsLclVar()->Data()->GetCostEx() +
+                       (m_comp->gtIsLikelyRegVar(operation->node) ? 0 : 2);
             }
-        }
-        else
-        {
+
             assert(m_mainOper == GT_RETURN);
-            thenCost = m_thenOperation.node->AsOp()->GetReturnValue()->GetCostEx();
-            if (m_doElseConversion)
+            return operation->node->AsOp()->GetReturnValue()->GetCostEx();
+        };
+
+        for (int i = 0; i < m_selectCount; i++)
+        {
+            int thenCost = operationCost(m_selects[i].thenOperation);
+            int elseCost = operationCost(m_selects[i].elseOperation);
+
+            // Cost to allow for "x = cond ? a + b : c + d".
+            if (thenCost > 7 || elseCost > 7)
             {
-                elseCost = m_elseOperation.node->AsOp()->GetReturnValue()->GetCostEx();
+                JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
+                        elseCost);
+                return false;
             }
         }
 
-        // Cost to allow for "x = cond ? a + b : c + d".
-        if (thenCost > 7 || elseCost > 7)
+        // Unconditionally evaluating several operations only pays off when the branch is hard
+        // to predict. If the profile shows the branch is biased, keep it.
+        if ((m_selectCount > 1) && m_comp->fgHaveProfileWeights())
         {
-            JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
-                    elseCost);
-            return false;
+            weight_t likelihood = m_startBlock->GetTrueEdge()->getLikelihood();
+            if ((likelihood < 0.2) || (likelihood > 0.8))
+            {
+                JITDUMP("Skipping if-conversion of %d operations with predictable branch (likelihood " FMT_WT ")\n",
+                        m_selectCount, likelihood);
+                return false;
+            }
         }
     }
 
@@ -672,89 +863,117 @@ bool OptIfConversionDsc::optIfConvert()
         }
     }
 
-    // Get the select node inputs.
-    var_types selectType;
-    GenTree*  selectTrueInput;
-    GenTree*  selectFalseInput;
-    if (m_mainOper == GT_STORE_LCL_VAR)
+    // Every SELECT after the first one needs its own copy of the condition. Make the
+    // copies before the condition may get reversed below.
+    GenTree* conds[2 * MaxOperations];
+    conds[0] = m_cond;
+    for (int i = 1; i < m_selectCount; i++)
     {
-        if (m_doElseConversion)
+        conds[i] = m_comp->gtCloneExpr(m_cond);
+    }
+
+    for (int i = 0; i < m_selectCount; i++)
+    {
+        IfConvertOperation* thenOperation = m_selects[i].thenOperation;
+        IfConvertOperation* elseOperation = m_selects[i].elseOperation;
+        GenTree*            cond          = conds[i];
+
+        // The SELECT replaces the source of the first of the two operations.
+        IfConvertOperation* operation = (thenOperation != nullptr) ? thenOperation : elseOperation;
+
+        // Get the select node inputs.
+        var_types selectType;
+        GenTree*  selectTrueInput;
+        GenTree*  selectFalseInput;
+        if (m_mainOper == GT_STORE_LCL_VAR)
         {
-            selectTrueInput  = m_elseOperation.node->AsLclVar()->Data();
-            selectFalseInput = m_thenOperation.node->AsLclVar()->Data();
+            // Duplicate the destination of the store for a case without an operation.
+            GenTreeLclVar* store = operation->node->AsLclVar();
+            selectTrueInput      = (elseOperation != nullptr)
+                                       ? elseOperation->node->AsLclVar()->Data()
+                                       : m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
+            selectFalseInput     = (thenOperation != nullptr)
+                                       ? thenOperation->node->AsLclVar()->Data()
+                                       : m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
+
+            // Pick the type as the type of the local, which should always be compatible even for implicit
+            // coercions.
+            selectType = genActualType(store);
         }
-        else // Duplicate the destination of the Then store.
+        else
         {
-            GenTreeLclVar* store = m_thenOperation.node->AsLclVar();
-            selectTrueInput      = m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
-            selectFalseInput     = m_thenOperation.node->AsLclVar()->Data();
-        }
-
-        // Pick the type as the type of the local, which should always be compatible even for implicit coercions.
-        selectType = genActualType(m_thenOperation.node);
-    }
-    else
-    {
-        assert(m_mainOper == GT_RETURN);
-        assert(m_doElseConversion);
-        assert(m_thenOperation.node->TypeGet() == m_elseOperation.node->TypeGet());
+            assert(m_mainOper == GT_RETURN);
+            assert(m_doElseConversion);
+            assert(thenOperation->node->TypeGet() == elseOperation->node->TypeGet());
 
-        selectTrueInput  = m_elseOperation.node->AsOp()->GetReturnValue();
-        selectFalseInput = m_thenOperation.node->AsOp()->GetReturnValue();
-        selectType       = genActualType(m_thenOperation.node);
-    }
+            selectTrueInput  = elseOperation->node->AsOp()->GetReturnValue();
+            selectFalseInput = thenOperation->node->AsOp()->GetReturnValue();
+            selectType       = genActualType(thenOperation->node);
+        }
 
-    GenTree* select = nullptr;
-    if (selectTrueInput->TypeIs(TYP_INT) && selectFalseInput->TypeIs(TYP_INT))
-    {
-        if (selectTrueInput->IsIntegralConst(1) && selectFalseInput->IsIntegralConst(0))
+        GenTree* select = nullptr;
+        if (selectTrueInput->TypeIs(TYP_INT) && selectFalseInput->TypeIs(TYP_INT))
         {
-            // compare ? true : false  -->  compare
-            select = m_cond;
+            if (selectTrueInput->IsIntegralConst(1) && selectFalseInput->IsIntegralConst(0))
+            {
+                // compare ? true : false  -->  compare
+                select = cond;
+            }
+            else if (selectTrueInput->IsIntegralConst(0) && selectFalseInput->IsIntegralConst(1))
+            {
+                // compare ? false : true  -->  reversed_compare
+                select = m_comp->gtReverseCond(cond);
+            }
         }
-        else if (selectTrueInput->IsIntegralConst(0) && selectFalseInput->IsIntegralConst(1))
+
+        if (select == nullptr)
         {
-            // compare ? false : true  -->  reversed_compare
-            select = m_comp->gtReverseCond(m_cond);
+            // Create a select node
+            select = m_comp->gtNewConditionalNode(GT_SELECT, cond, selectTrueInput, selectFalseInput, selectType);
         }
-    }
 
-    if (select == nullptr)
-    {
-        // Create a select node
-        select = m_comp->gtNewConditionalNode(GT_SELECT, m_cond, selectTrueInput, selectFalseInput, selectType);
-    }
+        operation->node->AddAllEffectsFlags(select);
 
-    m_thenOperation.node->AddAllEffectsFlags(select);
+        // Use the select as the source of the operation.
+        if (m_mainOper == GT_STORE_LCL_VAR)
+        {
+            operation->node->AsLclVar()->Data() = select;
+        }
+        else
+        {
+            operation->node->AsOp()->SetReturnValue(select);
+        }
+        m_comp->gtSetEvalOrder(operation->node);
+        m_comp->fgSetStmtSeq(operation->stmt);
 
-    // Use the select as the source of the Then operation.
-    if (m_mainOper == GT_STORE_LCL_VAR)
-    {
-        m_thenOperation.node->AsLclVar()->Data() = select;
-    }
-    else
-    {
-        m_thenOperation.node->AsOp()->SetReturnValue(select);
+        // The other operation is now part of the select.
+        if ((thenOperation != nullptr) && (elseOperation != nullptr))
+        {
+            elseOperation->node->gtBashToNOP();
+            m_comp->gtSetEvalOrder(elseOperation->node);
+            m_comp->fgSetStmtSeq(elseOperation->stmt);
+        }
     }
-    m_comp->gtSetEvalOrder(m_thenOperation.node);
-    m_comp->fgSetStmtSeq(m_thenOperation.stmt);
 
     // Remove statements.
     last->gtBashToNOP();
     m_comp->gtSetEvalOrder(last);
     m_comp->fgSetStmtSeq(m_startBlock->lastStmt());
-    if (m_doElseConversion)
+
+    // Merge all the blocks with operations.
+    for (int i = 0; i < m_thenOperationCount; i++)
     {
-        m_elseOperation.node->gtBashToNOP();
-        m_comp->gtSetEvalOrder(m_elseOperation.node);
-        m_comp->fgSetStmtSeq(m_elseOperation.stmt);
+        if ((i == 0) || (m_thenOperations[i].block != m_thenOperations[i - 1].block))
+        {
+            IfConvertJoinStmts(m_thenOperations[i].block);
+        }
     }
-
-    // Merge all the blocks.
-    IfConvertJoinStmts(m_thenOperation.block);
-    if (m_doElseConversion)
+    for (int i = 0; i < m_elseOperationCount; i++)
     {
-        IfConvertJoinStmts(m_elseOperation.block);
+        if ((i == 0) || (m_elseOperations[i].block != m_elseOperations[i - 1].block))
+        {
+            IfConvertJoinStmts(m_elseOperations[i].block);
+        }
     }
 
     // Update the flow from the original block.
@@ -7647,6 +7647,31 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 // Fold result, if possible.
                 op1 = gtFoldExpr(op1);
 
+                if (op1->OperIs(GT_DIV, GT_UDIV, GT_MOD, GT_UMOD) && varTypeIsIntegral(op1) &&
+                    !op1->gtGetOp2()->IsIntegralConst() && JitConfig.JitProfileValues() &&
+                    JitConfig.JitProfileDivisors())
+                {
+                    if (opts.IsOptimizedWithProfile())
+                    {
+                        op1 = impDuplicateWithProfiledDivisor(op1->AsOp(), opcodeOffs);
+                        if (op1->OperIs(GT_QMARK))
+                        {
+                            // QMARK has to be a root node
+                            unsigned tmp = lvaGrabTemp(true DEBUGARG("Grabbing temp for Qmark"));
+                            impStoreToTemp(tmp, op1, CHECK_SPILL_ALL);
+                            op1 = gtNewLclvNode(tmp, genActualType(op1));
+                        }
+                    }
+                    else if (opts.IsInstrumented() && !compIsForInlining() &&
+                             (genTypeSize(op1) <= genTypeSize(TYP_I_IMPL)))
+                    {
+                        // The value probe helpers take a native-sized value, so long divisors
+                        // are only profiled on 64-bit targets.
+                        getImpDivisorProfileMap()->Set(op1, opcodeOffs);
+                        compCurBB->SetFlags(BBF_HAS_VALUE_PROFILE);
+                    }
+                }
+
                 impPushOnStack(op1, tiRetVal);
                 break;
 
@@ -9913,11 +9938,15 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 // If we're jitting a static constructor and detect the following code pattern:
                 //
                 //  newarr
+                //  [dup, ldtoken, call RuntimeHelpers.InitializeArray]
                 //  stsfld
                 //  ret
                 //
                 // we emit a "frozen" allocator for newarr to, hopefully, allocate that array on a frozen segment.
-                // This is a very simple and conservative implementation targeting Array.Empty<T>()'s shape
+                // This is a very simple and conservative implementation targeting Array.Empty<T>()'s shape and
+                // static readonly lookup tables of primitives initialized from RVA data. The "ret" is not required
+                // when the method has no backward jumps, since then the newarr executes at most once and a cctor
+                // that stores several tables can have all of them frozen.
                 // Ideally, we want to be able to use frozen allocators more broadly, but such an analysis is
                 // not trivial.
                 //
@@ -9925,12 +9954,29 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                     // Does VM allow us to use frozen allocators?
                     opts.jitFlags->IsSet(JitFlags::JIT_FLAG_FROZEN_ALLOC_ALLOWED))
                 {
-                    // Check next two opcodes (have to be STSFLD and RET)
                     const BYTE* nextOpcode1 = codeAddr + sizeof(mdToken);
+
+                    // Skip over the array initialization from RVA data, if present
+                    const BYTE* initArrCall = nextOpcode1 + 1 + 1 + sizeof(mdToken);
+                    if ((initArrCall + 1 + sizeof(mdToken) < codeEndp) &&
+                        (getU1LittleEndian(nextOpcode1) == CEE_DUP) &&
+                        (getU1LittleEndian(nextOpcode1 + 1) == CEE_LDTOKEN) &&
+                        (getU1LittleEndian(initArrCall) == CEE_CALL))
+                    {
+                        CORINFO_RESOLVED_TOKEN initArrToken;
+                        impResolveToken(initArrCall + 1, &initArrToken, CORINFO_TOKENKIND_Method);
+                        if (lookupNamedIntrinsic(initArrToken.hMethod) ==
+                            NI_System_Runtime_CompilerServices_RuntimeHelpers_InitializeArray)
+                        {
+                            nextOpcode1 = initArrCall + 1 + sizeof(mdToken);
+                        }
+                    }
+
+                    // Check next two opcodes (have to be STSFLD and RET, unless there are no backward jumps)
                     const BYTE* nextOpcode2 = nextOpcode1 + sizeof(mdToken) + 1;
                     if ((nextOpcode2 < codeEndp) && (getU1LittleEndian(nextOpcode1) == CEE_STSFLD))
                     {
-                        if (getU1LittleEndian(nextOpcode2) == CEE_RET)
+                        if ((getU1LittleEndian(nextOpcode2) == CEE_RET) || !compHasBackwardJump)
                         {
                             // Check that the field is "static readonly", we don't want to waste memory
                             // for potentially mutable fields.
@@ -13171,6 +13217,30 @@ void Compiler::impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, I
     inlineResult->NoteDouble(InlineObservation::CALLSITE_PROFILE_FREQUENCY, profileFreq);
 }
 
+//------------------------------------------------------------------------
+// impInlineCountConstantArgs: count the user args of an inline candidate
+//   that are constants at the call site
+//
+// Arguments:
+//   call -- the inline candidate call
+//
+// Return Value:
+//   Number of constant args
+
+unsigned Compiler::impInlineCountConstantArgs(GenTreeCall* call)
+{
+    unsigned count = 0;
+    for (CallArg& arg : call->gtArgs.Args())
+    {
+        if (arg.IsUserArg() && arg.GetNode()->OperIsConst())
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
 //------------------------------------------------------------------------
 // impCanInlineIL: screen inline candate based on info from the method header
 //
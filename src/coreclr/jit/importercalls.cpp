@@ -1386,7 +1386,9 @@ DONE_CALL:
             impAppendTree(call, stackState.esStackDepth - 1, impCurStmtDI);
         }
         else if (JitConfig.JitProfileValues() && call->IsCall() &&
-                 call->AsCall()->IsSpecialIntrinsic(this, NI_System_SpanHelpers_Memmove))
+                 (call->AsCall()->IsSpecialIntrinsic(this, NI_System_SpanHelpers_Memmove) ||
+                  call->AsCall()->IsSpecialIntrinsic(this, NI_System_SpanHelpers_Fill) ||
+                  call->AsCall()->IsSpecialIntrinsic(this, NI_System_SpanHelpers_ClearWithoutReferences)))
         {
             if (opts.IsOptimizedWithProfile())
             {
@@ -1724,7 +1726,8 @@ GenTree* Compiler::impThrowIfNull(GenTreeCall* call)
 //    else
 //        Buffer.Memmove(dst, src, len); // fallback
 //
-//    if we can obtain the popular size from PGO data.
+//    if we can obtain the popular size from PGO data. SequenceEqual, Fill and
+//    ClearWithoutReferences are handled the same way.
 //
 // Arguments:
 //    call     -- call to optimize with profiled argument
@@ -1794,10 +1797,37 @@ GenTree* Compiler::impDuplicateWithProfiledArg(GenTreeCall* call, IL_OFFSET ilOf
             minValue = 1; // TODO: enable for 0 as well.
             maxValue = (ssize_t)getUnrollThreshold(ProfiledMemcmp);
         }
+        else if (call->IsSpecialIntrinsic(this, NI_System_SpanHelpers_ClearWithoutReferences))
+        {
+            // dst(0), byteLength(1)
+            argNum = 1;
+
+            minValue = 1;
+            maxValue = (ssize_t)getUnrollThreshold(ProfiledMemset);
+        }
+        else if (call->IsSpecialIntrinsic(this, NI_System_SpanHelpers_Fill))
+        {
+            // dst(0), numElements(1), value(2)
+            argNum = 1;
+
+            // Lowering only unrolls Fill<T> for a constant value that is either zero
+            // or a single byte, see Lowering::LowerCallMemset.
+            CallArg* const valueArg  = call->gtArgs.GetUserArgByIndex(2);
+            GenTree* const valueNode = valueArg->GetNode();
+            const unsigned elemSize  = genTypeSize(valueArg->GetSignatureType());
+            if (!valueNode->IsCnsIntOrI() || (elemSize == 0) || (!valueNode->IsIntegralConst(0) && (elemSize != 1)))
+            {
+                JITDUMP("Fill value is not unroll-friendly - bail out.\n")
+                return call;
+            }
+
+            minValue = 1;
+            maxValue = (ssize_t)(getUnrollThreshold(ProfiledMemset) / elemSize);
+        }
         else
         {
-            // only Memmove is expected at the moment.
-            // Possible future extensions: Memset, Memcpy
+            // only Memmove, SequenceEqual, Fill and ClearWithoutReferences are expected at the moment.
+            // Possible future extensions: Memcpy
             unreached();
         }
 
@@ -1846,6 +1876,96 @@ GenTree* Compiler::impDuplicateWithProfiledArg(GenTreeCall* call, IL_OFFSET ilOf
     return call;
 }
 
+//------------------------------------------------------------------------
+// impDuplicateWithProfiledDivisor: duplicates an integer division with a profiled divisor, e.g.:
+//    Given `x / d`, optimize it to:
+//
+//    (d == popularDivisor) ? (x / popularDivisor) : (x / d)
+//
+//    if we can obtain the popular divisor from PGO data. The division by a constant
+//    is later lowered to a multiply by a magic number (or a shift for powers of 2).
+//
+// Arguments:
+//    divMod   -- GT_DIV, GT_UDIV, GT_MOD or GT_UMOD node to optimize
+//    ilOffset -- Raw IL offset of the division
+//
+// Return Value:
+//    Optimized tree (or the original division if we can't optimize it).
+//
+GenTree* Compiler::impDuplicateWithProfiledDivisor(GenTreeOp* divMod, IL_OFFSET ilOffset)
+{
+    assert(divMod->OperIs(GT_DIV, GT_UDIV, GT_MOD, GT_UMOD));
+    assert(opts.IsOptimizedWithProfile());
+
+    const unsigned    MaxLikelyValues = 8;
+    LikelyValueRecord likelyValues[MaxLikelyValues];
+    UINT32            valuesCount =
+        getLikelyValues(likelyValues, MaxLikelyValues, fgPgoSchema, fgPgoSchemaCount, fgPgoData, ilOffset);
+
+    JITDUMP("%u likely divisors:\n", valuesCount)
+    for (UINT32 i = 0; i < valuesCount; i++)
+    {
+        JITDUMP("  %u) %zd - %u%%\n", i, likelyValues[i].value, likelyValues[i].likelihood)
+    }
+
+    // TODO: Tune the likelihood threshold, for now it's 50% as for the profiled Memmove.
+    if ((valuesCount == 0) || (likelyValues[0].likelihood < 50))
+    {
+        return divMod;
+    }
+
+    // The probe records the divisor sign-extended to native int; bring it back to the
+    // type of the division.
+    ssize_t profiledValue = likelyValues[0].value;
+    if (genActualType(divMod) == TYP_INT)
+    {
+        profiledValue = (ssize_t)(int32_t)profiledValue;
+    }
+
+    // Division by 0 has to throw and division by -1 may overflow, leave those to the
+    // general path. Division by 1 is not worth the extra compare.
+    const bool isUnsigned = divMod->OperIs(GT_UDIV, GT_UMOD);
+    if ((profiledValue == 0) || (profiledValue == 1) || (!isUnsigned && (profiledValue == -1)))
+    {
+        JITDUMP("Profiled divisor %zd is not interesting - bail out.\n", profiledValue)
+        return divMod;
+    }
+
+    JITDUMP("Duplicating for popular divisor = %zd\n", profiledValue)
+    DISPTREE(divMod)
+
+    GenTree* dividend = divMod->gtGetOp1();
+    GenTree* divisor  = divMod->gtGetOp2();
+
+    // The condition evaluates the divisor first, make sure it can't change the dividend.
+    if (((divisor->gtFlags & GTF_SIDE_EFFECT) != 0) && !dividend->IsInvariant())
+    {
+        unsigned tmp = lvaGrabTemp(true DEBUGARG("spilling dividend"));
+        impStoreToTemp(tmp, dividend, CHECK_SPILL_ALL);
+        dividend = gtNewLclvNode(tmp, genActualType(dividend));
+    }
+
+    // Spill the operands to temp locals to preserve the execution order
+    GenTree* dividendClone = impCloneExpr(dividend, &dividend, CHECK_SPILL_ALL, nullptr DEBUGARG("spilling dividend"));
+    GenTree* divisorClone  = impCloneExpr(divisor, &divisor, CHECK_SPILL_ALL, nullptr DEBUGARG("spilling divisor"));
+    divMod->gtOp1          = dividend;
+    divMod->gtOp2          = divisor;
+
+    GenTree* profiledValueNode = gtNewIconNode(profiledValue, genActualType(divisorClone));
+    GenTree* profiledDivMod    = gtNewOperNode(divMod->OperGet(), divMod->TypeGet(), dividendClone, profiledValueNode);
+    profiledDivMod->gtFlags |= (divMod->gtFlags & GTF_UNSIGNED);
+
+    // TODO: Specify weights for the branches in the Qmark node.
+    GenTreeColon* colon = new (this, GT_COLON) GenTreeColon(divMod->TypeGet(), profiledDivMod, divMod);
+    GenTreeOp*    cond  = gtNewOperNode(GT_EQ, TYP_INT, divisorClone, gtCloneExpr(profiledValueNode));
+    GenTreeQmark* qmark = gtNewQmarkNode(divMod->TypeGet(), cond, colon);
+
+    JITDUMP("\n\nResulting tree:\n")
+    DISPTREE(qmark)
+
+    return qmark;
+}
+
 #ifdef DEBUG
 //
 var_types Compiler::impImportJitTestLabelMark(int numArgs)
@@ -2883,8 +3003,7 @@ GenTree* Compiler::impInitializeArrayIntrinsic(CORINFO_SIG_INFO* sig)
         GenTree* arrayLengthNode;
 
 #ifdef FEATURE_READYTORUN
-        if (newArrayCall->AsCall()->gtCallMethHnd == eeFindHelper(CORINFO_HELP_READYTORUN_NEWARR_1) ||
-            newArrayCall->AsCall()->gtCallMethHnd == eeFindHelper(CORINFO_HELP_NEWARR_1_MAYBEFROZEN))
+        if (newArrayCall->AsCall()->gtCallMethHnd == eeFindHelper(CORINFO_HELP_READYTORUN_NEWARR_1))
         {
             // Array length is 1st argument for readytorun helper
             arrayLengthNode = newArrayCall->AsCall()->gtArgs.GetArgByIndex(0)->GetNode();
@@ -9497,6 +9616,11 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
                                compiler->fgHaveSufficientProfileWeights());
         inlineResult->NoteBool(InlineObservation::CALLSITE_INSIDE_THROW_BLOCK, compiler->compCurBB->KindIs(BBJ_THROW));
 
+        // Constant args may allow specializing a callee that would otherwise be too large.
+        //
+        inlineResult->NoteInt(InlineObservation::CALLSITE_CONSTANT_ARGS,
+                              (int)compiler->impInlineCountConstantArgs(pParam->call));
+
         bool const forceInline = (pParam->methAttr & CORINFO_FLG_FORCEINLINE) != 0;
 
         compiler->impCanInlineIL(ftn, &methInfo, forceInline, inlineResult);
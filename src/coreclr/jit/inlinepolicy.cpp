@@ -1385,13 +1385,24 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
                 JITDUMP("Callee has %s profile\n", m_HasProfileWeights ? "untrusted" : "no");
             }
 
+            // A larger callee may still be worth inlining as a copy specialized on the constant args
+            // passed at this call site, DetermineProfitability checks that the constants fold some of it.
+            const unsigned maxConstArgCodeSize = static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxILConstArg());
+            if ((m_ConstantArgs > 0) && (m_CodeSize > maxCodeSize) && (m_CodeSize <= maxConstArgCodeSize))
+            {
+                JITDUMP("Call site has %u constant args, callee may be specialized on them\n", m_ConstantArgs);
+                maxCodeSize                   = maxConstArgCodeSize;
+                m_IsConstantArgSpecialization = true;
+            }
+
             unsigned alwaysInlineSize = InlineStrategy::ALWAYS_INLINE_SIZE;
             if (m_InsideThrowBlock)
             {
                 // Inline only small code in BBJ_THROW blocks, e.g. <= 8 bytes of IL
                 JITDUMP("Call site in throw block\n");
                 alwaysInlineSize /= 2;
-                maxCodeSize = min(alwaysInlineSize + 1, maxCodeSize);
+                maxCodeSize                   = min(alwaysInlineSize + 1, maxCodeSize);
+                m_IsConstantArgSpecialization = false;
             }
 
             if (m_IsForceInline)
@@ -1417,6 +1428,10 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             }
             break;
         }
+        case InlineObservation::CALLSITE_CONSTANT_ARGS:
+            m_ConstantArgs = static_cast<unsigned>(value);
+            break;
+
         case InlineObservation::CALLEE_NUMBER_OF_BASIC_BLOCKS:
         {
             if (!m_IsForceInline && m_IsNoReturn && (value == 1))
@@ -1498,6 +1513,51 @@ unsigned ExtendedDefaultPolicy::EstimatedTotalILSize() const
     return (unsigned)codeSize;
 }
 
+//------------------------------------------------------------------------
+// PropagateNeverToRuntime: determine if a never result should cause the
+// method to be marked as un-inlinable.
+//
+// Notes:
+//    A callee that is too large for this call site may still be a candidate
+//    at call sites that pass constant args.
+
+bool ExtendedDefaultPolicy::PropagateNeverToRuntime() const
+{
+    if ((m_Observation == InlineObservation::CALLEE_TOO_MUCH_IL) &&
+        (m_CodeSize <= static_cast<unsigned>(JitConfig.JitExtDefaultPolicyMaxILConstArg())))
+    {
+        return false;
+    }
+
+    return DefaultPolicy::PropagateNeverToRuntime();
+}
+
+//------------------------------------------------------------------------
+// DetermineProfitability: determine if this inline is profitable
+//
+// Arguments:
+//    methodInfo -- method info for the callee
+//
+// Notes:
+//    Callees that are only candidates because of the constant args at the
+//    call site (see CALLSITE_CONSTANT_ARGS) must have branches or switches
+//    that fold on them, otherwise inlining would just duplicate a large
+//    method. The usual size/benefit evaluation applies to the rest, which
+//    accounts for the folded code in EstimatedTotalILSize.
+
+void ExtendedDefaultPolicy::DetermineProfitability(CORINFO_METHOD_INFO* methodInfo)
+{
+    if (m_IsConstantArgSpecialization && (m_FoldableBranch == 0) && (m_FoldableSwitch == 0))
+    {
+        JITDUMP("\nCallee IL size %u is only allowed for specialization, but nothing folds on the constant args\n",
+                m_CodeSize);
+        SetFailure(InlineObservation::CALLSITE_NOT_PROFITABLE_INLINE);
+        return;
+    }
+
+    DefaultPolicy::DetermineProfitability(methodInfo);
+}
+
 //------------------------------------------------------------------------
 // DetermineMultiplier: determine benefit multiplier for this inline
 //
@@ -1897,6 +1957,7 @@ void ExtendedDefaultPolicy::OnDumpXml(FILE* file, unsigned indent) const
     XATTR_I4(m_ArgIsExactCls)
     XATTR_I4(m_ArgIsExactClsSigIsNot)
     XATTR_I4(m_ArgIsConst)
+    XATTR_I4(m_ConstantArgs)
     XATTR_I4(m_ArgIsBoxedAtCallsite)
     XATTR_I4(m_FoldableIntrinsic)
     XATTR_I4(m_FoldableExpr)
@@ -221,12 +221,14 @@ public:
         , m_DivByCns(0)
         , m_ArgUnbox(0)
         , m_ArgUnboxExact(0)
+        , m_ConstantArgs(0)
         , m_ReturnsStructByValue(false)
         , m_IsFromValueClass(false)
         , m_NonGenericCallsGeneric(false)
         , m_IsCallsiteInNoReturnRegion(false)
         , m_HasProfileWeights(false)
         , m_MayReturnSmallArray(false)
+        , m_IsConstantArgSpecialization(false)
     {
         // Empty
     }
@@ -235,6 +237,11 @@ public:
     void NoteInt(InlineObservation obs, int value) override;
     void NoteDouble(InlineObservation obs, double value) override;
 
+    // Policy policies
+    bool PropagateNeverToRuntime() const override;
+
+    // Policy determinations
+    void   DetermineProfitability(CORINFO_METHOD_INFO* methodInfo) override;
     double DetermineMultiplier() override;
 
     unsigned EstimatedTotalILSize() const override;
@@ -277,12 +284,14 @@ protected:
     unsigned m_DivByCns;
     unsigned m_ArgUnbox;
     unsigned m_ArgUnboxExact;
+    unsigned m_ConstantArgs;
     bool     m_ReturnsStructByValue       : 1;
     bool     m_IsFromValueClass           : 1;
     bool     m_NonGenericCallsGeneric     : 1;
     bool     m_IsCallsiteInNoReturnRegion : 1;
     bool     m_HasProfileWeights          : 1;
     bool     m_MayReturnSmallArray        : 1;
+    bool     m_IsConstantArgSpecialization : 1;
 };
 
 // DiscretionaryPolicy is a variant of the default policy.  It
@@ -140,6 +140,11 @@ CONFIG_INTEGER(JitMinOptsInstrCount, "JITMinOptsInstrCount", DEFAULT_MIN_OPTS_IN
 CONFIG_INTEGER(JitMinOptsLvNumCount, "JITMinOptsLvNumcount", DEFAULT_MIN_OPTS_LV_NUM_COUNT)
 CONFIG_INTEGER(JitMinOptsLvRefCount, "JITMinOptsLvRefcount", DEFAULT_MIN_OPTS_LV_REF_COUNT)
 
+// Compile-time budget, as IL size x block count, above which optimized methods scale back global optimizations
+// rather than switching to MinOpts. Loop/branch opts are dropped first, then all value number based phases.
+RELEASE_CONFIG_INTEGER(JitOptBudgetLoopOpts, "JitOptBudgetLoopOpts", DEFAULT_OPT_BUDGET_LOOP_OPTS)
+RELEASE_CONFIG_INTEGER(JitOptBudgetGlobalOpts, "JitOptBudgetGlobalOpts", DEFAULT_OPT_BUDGET_GLOBAL_OPTS)
+
 CONFIG_INTEGER(JitNoCSE, "JitNoCSE", 0)
 CONFIG_INTEGER(JitNoCSE2, "JitNoCSE2", 0)
 CONFIG_INTEGER(JitNoForceFallback, "JitNoForceFallback", 0) // Set to non-zero to prevent NOWAY assert testing.
@@ -572,6 +577,8 @@ OPT_CONFIG_STRING(JitOnlyOptimizeRange,
 OPT_CONFIG_STRING(JitEnablePhysicalPromotionRange, "JitEnablePhysicalPromotionRange")
 OPT_CONFIG_STRING(JitEnableCrossBlockLocalAssertionPropRange, "JitEnableCrossBlockLocalAssertionPropRange")
 OPT_CONFIG_STRING(JitEnableInductionVariableOptsRange, "JitEnableInductionVariableOptsRange")
+OPT_CONFIG_STRING(JitEnableLoopVectorizationRange, "JitEnableLoopVectorizationRange")
+OPT_CONFIG_STRING(JitEnableLoopMemoryPromotionRange, "JitEnableLoopMemoryPromotionRange")
 OPT_CONFIG_STRING(JitEnableLocalAddrPropagationRange, "JitEnableLocalAddrPropagationRange")
 
 OPT_CONFIG_INTEGER(JitDoSsa, "JitDoSsa", 1) // Perform Static Single Assignment (SSA) numbering on the variables
@@ -648,6 +655,8 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicy, "JitExtDefaultPolicy", 1)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxIL, "JitExtDefaultPolicyMaxIL", 0x80)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxILRoot, "JitExtDefaultPolicyMaxILRoot", 0x100)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxILProf, "JitExtDefaultPolicyMaxILProf", 0x400)
+// Max IL size of callees that are only inlined to specialize them on constant args, 0 to disable
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxILConstArg, "JitExtDefaultPolicyMaxILConstArg", 0x100)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, "JitExtDefaultPolicyMaxBB", 7)
 
 // Inliner uses the following formula for PGO-driven decisions:
@@ -670,12 +679,17 @@ RELEASE_CONFIG_INTEGER(JitObjectStackAllocationRefClass, "JitObjectStackAllocati
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationBoxedValueClass, "JitObjectStackAllocationBoxedValueClass", 1)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationConditionalEscape, "JitObjectStackAllocationConditionalEscape", 1)
 CONFIG_STRING(JitObjectStackAllocationConditionalEscapeRange, "JitObjectStackAllocationConditionalEscapeRange")
+RELEASE_CONFIG_INTEGER(JitObjectStackAllocationPartialEscape, "JitObjectStackAllocationPartialEscape", 1)
+CONFIG_STRING(JitObjectStackAllocationPartialEscapeRange, "JitObjectStackAllocationPartialEscapeRange")
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationArray, "JitObjectStackAllocationArray", 1)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationSize, "JitObjectStackAllocationSize", 528)
 RELEASE_CONFIG_INTEGER(JitObjectStackAllocationTrackFields, "JitObjectStackAllocationTrackFields", 1)
 CONFIG_STRING(JitObjectStackAllocationTrackFieldsRange, "JitObjectStackAllocationTrackFieldsRange")
 CONFIG_INTEGER(JitObjectStackAllocationDumpConnGraph, "JitObjectStackAllocationDumpConnGraph", 0)
 
+// If zero, always use a write barrier for stores into objects the method just allocated
+RELEASE_CONFIG_INTEGER(JitElideYoungTargetBarriers, "JitElideYoungTargetBarriers", 1)
+
 RELEASE_CONFIG_INTEGER(JitEECallTimingInfo, "JitEECallTimingInfo", 0)
 
 CONFIG_INTEGER(JitEnableFinallyCloning, "JitEnableFinallyCloning", 1)
@@ -743,6 +757,7 @@ RELEASE_CONFIG_INTEGER(JitMinimalJitProfiling, "JitMinimalJitProfiling", 1)
 RELEASE_CONFIG_INTEGER(JitMinimalPrejitProfiling, "JitMinimalPrejitProfiling", 0)
 
 RELEASE_CONFIG_INTEGER(JitProfileValues, "JitProfileValues", 1) // Value profiling, e.g. Buffer.Memmove's size
+RELEASE_CONFIG_INTEGER(JitProfileDivisors, "JitProfileDivisors", 1) // Value profiling of integer divisors
 RELEASE_CONFIG_INTEGER(JitProfileCasts, "JitProfileCasts", 1)   // Profile castclass/isinst
 RELEASE_CONFIG_INTEGER(JitConsumeProfileForCasts, "JitConsumeProfileForCasts", 1) // Consume profile data (if any)
                                                                                   // for castclass/isinst
@@ -807,6 +822,15 @@ RELEASE_CONFIG_INTEGER(JitEnableStrengthReduction, "JitEnableStrengthReduction",
 // Enable IV optimizations
 RELEASE_CONFIG_INTEGER(JitEnableInductionVariableOpts, "JitEnableInductionVariableOpts", 1)
 
+// Enable vectorization of simple counted reduction loops
+RELEASE_CONFIG_INTEGER(JitEnableLoopVectorization, "JitEnableLoopVectorization", 0)
+
+// Enable promotion of fields loaded and stored in loops to locals
+RELEASE_CONFIG_INTEGER(JitEnableLoopMemoryPromotion, "JitEnableLoopMemoryPromotion", 1)
+
+// Enable profile-guided partial unrolling of hot loops with unknown trip counts
+RELEASE_CONFIG_INTEGER(JitEnablePartialLoopUnrolling, "JitEnablePartialLoopUnrolling", 0)
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
@@ -847,6 +871,9 @@ CONFIG_INTEGER(JitDispIns, "JitDispIns", 0)
 // Allow to enregister locals with struct type.
 RELEASE_CONFIG_INTEGER(JitEnregStructLocals, "JitEnregStructLocals", 1)
 
+// Split live ranges around calls in blocks colder than the method entry instead of preferring callee-saved registers.
+RELEASE_CONFIG_INTEGER(JitLsraSplitAtColdCalls, "JitLsraSplitAtColdCalls", 1)
+
 #undef CONFIG_INTEGER
 #undef CONFIG_STRING
 #undef CONFIG_METHODSET
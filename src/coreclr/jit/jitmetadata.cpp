@@ -4,8 +4,6 @@
 #include "jitpch.h"
 #include "jitmetadata.h"
 
-#ifdef DEBUG
-
 //------------------------------------------------------------------------
 // JitMetadata::report: Report metadata back to the EE.
 //
@@ -19,6 +17,8 @@ void JitMetadata::report(Compiler* comp, const char* key, const void* data, size
     comp->info.compCompHnd->reportMetadata(key, data, length);
 }
 
+#ifdef DEBUG
+
 //------------------------------------------------------------------------
 // reportValue: Report a specific value back to the EE.
 //
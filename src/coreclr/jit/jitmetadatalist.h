@@ -27,6 +27,13 @@
 //              Name,                                    type              flags
 JITMETADATAINFO(MethodFullName,                          const char*,      0)
 JITMETADATAINFO(TieringName,                             const char*,      0)
+// Reported in all builds, see Compiler::compReportCompileStatistics. So are the
+// InlineCount, BytesAllocated and ArenaBytesAllocated metrics.
+JITMETADATAINFO(FrontEndMicroseconds,                    int,              0)
+JITMETADATAINFO(OptimizerMicroseconds,                   int,              0)
+JITMETADATAINFO(BackEndMicroseconds,                     int,              0)
+// Arena bytes requested per CompMemKind, an array of CMK_Count int64_t. Only with MEASURE_MEM_ALLOC.
+JITMETADATAINFO(BytesAllocatedByKind,                    const int64_t*,   0)
 JITMETADATAMETRIC(ActualCodeBytes,                       int,              JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(AllocatedHotCodeBytes,                 int,              JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(AllocatedColdCodeBytes,                int,              JIT_METADATA_LOWER_IS_BETTER)
@@ -38,6 +45,7 @@ JITMETADATAMETRIC(LoopsFoundDuringOpts,                  int,              0)
 JITMETADATAMETRIC(LoopsInverted,                         int,              0)
 JITMETADATAMETRIC(LoopsCloned,                           int,              0)
 JITMETADATAMETRIC(LoopsUnrolled,                         int,              0)
+JITMETADATAMETRIC(LoopsPartiallyUnrolled,                int,              0)
 JITMETADATAMETRIC(LoopAlignmentCandidates,               int,              0)
 JITMETADATAMETRIC(LoopsAligned,                          int,              0)
 JITMETADATAMETRIC(LoopsIVWidened,                        int,              0)
@@ -45,14 +53,18 @@ JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(UnusedIVsRemoved,                      int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
 JITMETADATAMETRIC(LoopsStrengthReduced,                  int,              0)
+JITMETADATAMETRIC(LoopsVectorized,                       int,              0)
+JITMETADATAMETRIC(LoopMemoryLocationsPromoted,           int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(JumpThreadingsPerformed,               int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(CseCount,                              int,              0)
 JITMETADATAMETRIC(BasicBlocksAtCodegen,                  int,              0)
+JITMETADATAMETRIC(PhasesSkippedForOptBudget,             int,              0)
 JITMETADATAMETRIC(PerfScore,                             double,           JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(BytesAllocated,                        int64_t,          JIT_METADATA_LOWER_IS_BETTER)
+JITMETADATAMETRIC(ArenaBytesAllocated,                   int64_t,          JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(ImporterBranchFold,                    int,              0)
 JITMETADATAMETRIC(ImporterSwitchFold,                    int,              0)
 JITMETADATAMETRIC(DevirtualizedCall,                     int,              0)
@@ -89,6 +101,9 @@ JITMETADATAMETRIC(NewBoxedValueClassHelperCalls,         int,              0)
 JITMETADATAMETRIC(StackAllocatedBoxedValueClasses,       int,              0)
 JITMETADATAMETRIC(NewArrayHelperCalls,                   int,              0)
 JITMETADATAMETRIC(StackAllocatedArrays,                  int,              0)
+JITMETADATAMETRIC(StackAllocatedObjectsCopiedToHeap,     int,              0)
+JITMETADATAMETRIC(WriteBarrierStores,                    int,              0)
+JITMETADATAMETRIC(YoungTargetBarriersElided,             int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(LocalAssertionCount,                   int,              0)
 JITMETADATAMETRIC(LocalAssertionOverflow,                int,              0)
 JITMETADATAMETRIC(MorphTrackedLocals,                    int,              0)
@@ -26,7 +26,14 @@ void ArrIndex::Print(unsigned dim /* = -1 */)
     printf("V%02d", arrLcl);
     for (unsigned i = 0; i < ((dim == (unsigned)-1) ? rank : dim); ++i)
     {
-        printf("[V%02d]", indLcls.Get(i));
+        if ((i == rank - 1) && (indOffset != 0))
+        {
+            printf("[V%02d + %d]", indLcls.Get(i), indOffset);
+        }
+        else
+        {
+            printf("[V%02d]", indLcls.Get(i));
+        }
     }
 }
 
@@ -224,6 +231,8 @@ GenTree* LC_Expr::ToGenTree(Compiler* comp, BasicBlock* bb)
     {
         case Ident:
             return ident.ToGenTree(comp, bb);
+        case IdentPlusConst:
+            return comp->gtNewOperNode(GT_ADD, TYP_INT, ident.ToGenTree(comp, bb), comp->gtNewIconNode(constant));
         default:
             assert(!"Could not convert LC_Expr to GenTree");
             unreached();
@@ -1360,7 +1369,19 @@ bool Compiler::optDeriveLoopCloningConditions(FlowGraphNaturalLoop* loop, LoopCl
                 LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
                 LC_Array     arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
                 LC_Ident     arrLenIdent = LC_Ident::CreateArrAccess(arrLen);
-                LC_Condition cond(opLimitCondition, LC_Expr(ident), LC_Expr(arrLenIdent));
+                LC_Condition cond;
+                if ((arrIndexInfo->dim == arrIndexInfo->arrIndex.rank - 1) && (arrIndexInfo->arrIndex.indOffset != 0))
+                {
+                    // a[i + k] in an increasing loop: (end + k <= arrLen) or (end + k < arrLen). The limit is known
+                    // to be non-negative here, so compare unsigned to stay correct if "end + k" overflows int.
+                    assert(isIncreasingLoop);
+                    cond = LC_Condition(opLimitCondition, LC_Expr(ident, arrIndexInfo->arrIndex.indOffset),
+                                        LC_Expr(arrLenIdent), /*unsigned*/ true);
+                }
+                else
+                {
+                    cond = LC_Condition(opLimitCondition, LC_Expr(ident), LC_Expr(arrLenIdent));
+                }
                 context->EnsureConditions(loop->GetIndex())->Push(cond);
 
                 // Ensure that this array must be dereference-able, before executing the actual condition.
@@ -2219,7 +2240,9 @@ bool Compiler::optIsStackLocalInvariant(FlowGraphNaturalLoop* loop, unsigned lcl
 //      but it isn't necessary.
 //
 //  Assumption:
-//      The method extracts only if the array base and indices are GT_LCL_VAR.
+//      The method extracts only if the array base and indices are GT_LCL_VAR. The index of the
+//      innermost (non-TYP_REF element type) dimension may also be "GT_LCL_VAR + positive constant",
+//      which is recorded in ArrIndex::indOffset.
 //
 //  TODO-CQ: CLONE: After morph make sure this method extracts values before morph.
 //
@@ -2273,7 +2296,23 @@ bool Compiler::optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsN
         return false;
     }
     GenTreeBoundsChk* arrBndsChk = before->AsBoundsChk();
-    if (arrBndsChk->GetIndex()->gtOper != GT_LCL_VAR)
+    GenTree*          index      = arrBndsChk->GetIndex();
+    int               indOffset  = 0;
+    if (index->OperIs(GT_ADD) && (arrBndsChk->gtInxType != TYP_REF) && index->TypeIs(TYP_INT) &&
+        index->gtGetOp2()->IsCnsIntOrI() && !index->gtOverflow())
+    {
+        // Only the innermost dimension may carry an offset; outer dimensions are re-materialized
+        // from their index locals when building the cloning conditions.
+        ssize_t offset = index->gtGetOp2()->AsIntCon()->IconValue();
+        if ((offset <= 0) || (offset > INT32_MAX))
+        {
+            return false;
+        }
+        indOffset = (int)offset;
+        index     = index->gtGetOp1();
+    }
+
+    if (index->gtOper != GT_LCL_VAR)
     {
         return false;
     }
@@ -2294,13 +2333,14 @@ bool Compiler::optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsN
         return false;
     }
 
-    unsigned indLcl = arrBndsChk->GetIndex()->AsLclVarCommon()->GetLclNum();
+    unsigned indLcl = index->AsLclVarCommon()->GetLclNum();
 
     if (lhsNum == BAD_VAR_NUM)
     {
         result->arrLcl = arrLcl;
     }
     result->indLcls.Push(indLcl);
+    result->indOffset = indOffset;
     result->bndsChks.Push(tree);
     result->useBlock = compCurBB;
     result->rank++;
@@ -2585,6 +2625,14 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTree* tree, Loop
             // Is index variable also used as the loop iter var?
             if (arrIndex.indLcls[dim] == iterInfo->IterVar)
             {
+                // An offset index (a[i + k]) is only handled for increasing loops, where the largest
+                // index is derived from the loop limit.
+                if ((dim == arrIndex.rank - 1) && (arrIndex.indOffset != 0) && !iterInfo->IsIncreasingLoop())
+                {
+                    JITDUMP("Offset index on dim %d is only supported for increasing loops\n", dim);
+                    continue;
+                }
+
                 // Check the previous indices are all loop invariant.
                 for (unsigned dim2 = 0; dim2 < dim; ++dim2)
                 {
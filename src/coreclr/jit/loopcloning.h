@@ -190,11 +190,12 @@ class Compiler;
  */
 struct ArrIndex
 {
-    unsigned                      arrLcl;   // The array base local num
-    JitExpandArrayStack<unsigned> indLcls;  // The indices local nums
-    JitExpandArrayStack<GenTree*> bndsChks; // The bounds checks nodes along each dimension.
-    unsigned                      rank;     // Rank of the array
-    BasicBlock*                   useBlock; // Block where the [] occurs
+    unsigned                      arrLcl;    // The array base local num
+    JitExpandArrayStack<unsigned> indLcls;   // The indices local nums
+    JitExpandArrayStack<GenTree*> bndsChks;  // The bounds checks nodes along each dimension.
+    unsigned                      rank;      // Rank of the array
+    BasicBlock*                   useBlock;  // Block where the [] occurs
+    int                           indOffset; // Constant added to the innermost index, e.g. 2 for a[i + 2]
 
     ArrIndex(CompAllocator alloc)
         : arrLcl(BAD_VAR_NUM)
@@ -202,6 +203,7 @@ struct ArrIndex
         , bndsChks(alloc)
         , rank(0)
         , useBlock(nullptr)
+        , indOffset(0)
     {
     }
 
@@ -768,9 +770,11 @@ struct LC_Expr
     {
         Invalid,
         Ident,
+        IdentPlusConst,
     };
 
     LC_Ident ident;
+    int      constant;
     ExprType type;
 
     // Equality operator
@@ -784,6 +788,11 @@ struct LC_Expr
             return false;
         }
 
+        if ((type == IdentPlusConst) && (constant != that.constant))
+        {
+            return false;
+        }
+
         // Check if the ident match.
         return (ident == that.ident);
     }
@@ -795,6 +804,11 @@ struct LC_Expr
         {
             ident.Print();
         }
+        else if (type == IdentPlusConst)
+        {
+            ident.Print();
+            printf(" + %d", constant);
+        }
         else
         {
             printf("INVALID");
@@ -803,14 +817,22 @@ struct LC_Expr
 #endif
 
     LC_Expr()
-        : type(Invalid)
+        : constant(0)
+        , type(Invalid)
     {
     }
     explicit LC_Expr(const LC_Ident& ident)
         : ident(ident)
+        , constant(0)
         , type(Ident)
     {
     }
+    LC_Expr(const LC_Ident& ident, int constant)
+        : ident(ident)
+        , constant(constant)
+        , type(IdentPlusConst)
+    {
+    }
 
     // Convert LC_Expr into a tree node.
     GenTree* ToGenTree(Compiler* comp, BasicBlock* bb);
@@ -0,0 +1,719 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// This file contains an optimization that promotes class fields that are
+// repeatedly loaded and stored inside of a loop to locals ("scalar
+// replacement" of heap memory). A candidate is a location "obj.f" accessed
+// with IND/STOREIND, where "obj" is a TYP_REF local that is not redefined
+// inside of the loop. For example,
+//
+//   loop:
+//     this._count = this._count + x
+//     ...
+//
+// is transformed into
+//
+//   preheader:
+//     tmp = this._count
+//   loop:
+//     tmp = tmp + x
+//     ...
+//   exits:
+//     this._count = tmp
+//
+// which subsequently allows the local to be enregistered for the duration of
+// the loop. The transformation is only done when it cannot be observed:
+//
+// - The loop contains no calls, atomics, memory barriers, volatile accesses
+//   or other nodes with ordering side effects, and no stores to memory other
+//   than the candidate stores. Nothing but the current thread can then
+//   observe the promoted locations while the loop runs.
+//
+// - Every other indirection in the loop provably accesses different memory
+//   than the candidates: a different field, an array element, a local or
+//   invariant memory.
+//
+// - Apart from the indirections off of the promoted objects no node in the
+//   loop may throw, and the loop is not part of any EH region. Each candidate
+//   is stored to in the loop header, which is executed first on every entry
+//   to the loop, so if the object is null then both the original loop and
+//   the initialization in the preheader throw before any other side effect
+//   happens. It also means the stores back in the exits never write a value
+//   that the original loop would not have written.
+//
+// - All predecessors of the loop exits are inside of the loop, so the stores
+//   back can be placed at the beginning of the exits.
+//
+// Array elements are not handled. Their accesses are usually dominated by
+// bounds checks that may throw, which would require reasoning about the
+// order of exceptions relative to the deferred stores.
+//
+
+#include "jitpch.h"
+
+// Maximal number of locations promoted per loop, to bound the additional
+// register pressure.
+static const int MAX_PROMOTED_LOCATIONS_PER_LOOP = 4;
+
+// Describes a "obj.f" location accessed by a loop.
+struct LoopMemoryLocation
+{
+    unsigned             ObjLclNum;
+    CORINFO_FIELD_HANDLE FieldHnd;
+    var_types            Type;
+    // Some access of the location, whose address is cloned for the load in the
+    // preheader and the stores in the exits.
+    GenTreeIndir* Access;
+    bool          StoredInHeader = false;
+    bool          MayFault       = false;
+    bool          Disqualified   = false;
+    unsigned      NewLclNum      = BAD_VAR_NUM;
+
+    LoopMemoryLocation(unsigned objLclNum, CORINFO_FIELD_HANDLE fieldHnd, GenTreeIndir* access)
+        : ObjLclNum(objLclNum)
+        , FieldHnd(fieldHnd)
+        , Type(access->TypeGet())
+        , Access(access)
+    {
+    }
+
+    bool IsPromoted() const
+    {
+        return !Disqualified;
+    }
+};
+
+class LoopMemoryPromotionContext
+{
+    Compiler*                        m_comp;
+    FlowGraphNaturalLoop*            m_loop;
+    ArrayStack<LoopMemoryLocation>   m_locations;
+    ArrayStack<CORINFO_FIELD_HANDLE> m_aliasedFields;
+    ArrayStack<unsigned>             m_storedLocals;
+    ArrayStack<unsigned>             m_faultingObjs;
+    bool                             m_mayAliasAnyField = false;
+
+    bool                IsCandidateShape();
+    bool                AnalyzeNode(BasicBlock* block, GenTree* node);
+    bool                AnalyzeIndir(BasicBlock* block, GenTreeIndir* indir);
+    bool                GetCandidateLocation(GenTreeIndir* indir, unsigned* objLclNum, CORINFO_FIELD_HANDLE* fieldHnd);
+    LoopMemoryLocation* FindLocation(unsigned objLclNum, CORINFO_FIELD_HANDLE fieldHnd);
+    bool                SelectLocations();
+    void                Transform();
+
+    template <typename T>
+    static bool Contains(ArrayStack<T>& stack, T value)
+    {
+        for (int i = 0; i < stack.Height(); i++)
+        {
+            if (stack.Bottom(i) == value)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+public:
+    LoopMemoryPromotionContext(Compiler* comp, FlowGraphNaturalLoop* loop)
+        : m_comp(comp)
+        , m_loop(loop)
+        , m_locations(comp->getAllocator(CMK_LoopOpt))
+        , m_aliasedFields(comp->getAllocator(CMK_LoopOpt))
+        , m_storedLocals(comp->getAllocator(CMK_LoopOpt))
+        , m_faultingObjs(comp->getAllocator(CMK_LoopOpt))
+    {
+    }
+
+    int TryPromote();
+};
+
+//------------------------------------------------------------------------
+// TryPromote: Find the memory locations of the loop that can be promoted
+// and, if there are any, promote them.
+//
+// Returns:
+//   The number of promoted locations.
+//
+int LoopMemoryPromotionContext::TryPromote()
+{
+    if (!IsCandidateShape())
+    {
+        return 0;
+    }
+
+    BasicBlockVisit result = m_loop->VisitLoopBlocks([=](BasicBlock* block) {
+        for (Statement* stmt : block->Statements())
+        {
+            for (GenTree* node : stmt->TreeList())
+            {
+                if (!AnalyzeNode(block, node))
+                {
+                    return BasicBlockVisit::Abort;
+                }
+            }
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    if ((result == BasicBlockVisit::Abort) || !SelectLocations())
+    {
+        return 0;
+    }
+
+    Transform();
+
+    int numPromoted = 0;
+    for (int i = 0; i < m_locations.Height(); i++)
+    {
+        numPromoted += m_locations.BottomRef(i).IsPromoted() ? 1 : 0;
+    }
+
+    return numPromoted;
+}
+
+//------------------------------------------------------------------------
+// IsCandidateShape: Check that the loop has a flow graph shape that allows
+// placing loads in its preheader and stores in its exits.
+//
+// Returns:
+//   True if so.
+//
+bool LoopMemoryPromotionContext::IsCandidateShape()
+{
+    BasicBlock* preheader = m_loop->GetPreheader();
+
+    if (preheader == nullptr)
+    {
+        JITDUMP("  Skipping: no preheader\n");
+        return false;
+    }
+
+    if (m_loop->ExitEdges().size() == 0)
+    {
+        JITDUMP("  Skipping: loop has no exits\n");
+        return false;
+    }
+
+    if (preheader->hasTryIndex() || preheader->hasHndIndex())
+    {
+        JITDUMP("  Skipping: loop is inside of an EH region\n");
+        return false;
+    }
+
+    BasicBlockVisit result = m_loop->VisitLoopBlocks([=](BasicBlock* block) {
+        if (block->hasTryIndex() || block->hasHndIndex())
+        {
+            JITDUMP("  Skipping: " FMT_BB " is inside of an EH region\n", block->bbNum);
+            return BasicBlockVisit::Abort;
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    if (result == BasicBlockVisit::Abort)
+    {
+        return false;
+    }
+
+    result = m_loop->VisitRegularExitBlocks([=](BasicBlock* exit) {
+        for (BasicBlock* pred : exit->PredBlocks())
+        {
+            if (!m_loop->ContainsBlock(pred))
+            {
+                JITDUMP("  Skipping: exit " FMT_BB " has a non-loop pred " FMT_BB "\n", exit->bbNum, pred->bbNum);
+                return BasicBlockVisit::Abort;
+            }
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    return result != BasicBlockVisit::Abort;
+}
+
+//------------------------------------------------------------------------
+// AnalyzeNode: Record the memory accesses and local stores of a node in the
+// loop, and check that it has no effects that prevent promotion.
+//
+// Parameters:
+//   block - The block containing the node
+//   node  - The node
+//
+// Returns:
+//   False if no location can be promoted in the loop.
+//
+bool LoopMemoryPromotionContext::AnalyzeNode(BasicBlock* block, GenTree* node)
+{
+    if (node->IsCall() || node->OperIsAtomicOp() || node->OperIs(GT_MEMORYBARRIER) ||
+        ((node->gtFlags & GTF_ORDER_SIDEEFF) != 0))
+    {
+        JITDUMP("  Skipping: [%06u] is a call or has ordering side effects\n", Compiler::dspTreeID(node));
+        return false;
+    }
+
+#ifdef FEATURE_HW_INTRINSICS
+    if (node->OperIsHWIntrinsic() && node->AsHWIntrinsic()->OperIsMemoryLoadOrStore())
+    {
+        JITDUMP("  Skipping: [%06u] is a memory accessing HW intrinsic\n", Compiler::dspTreeID(node));
+        return false;
+    }
+#endif
+
+    if (node->OperIsLocalStore())
+    {
+        m_storedLocals.Push(node->AsLclVarCommon()->GetLclNum());
+        return true;
+    }
+
+    if (node->OperIsIndir())
+    {
+        return AnalyzeIndir(block, node->AsIndir());
+    }
+
+    if (node->OperMayThrow(m_comp))
+    {
+        JITDUMP("  Skipping: [%06u] may throw\n", Compiler::dspTreeID(node));
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// AnalyzeIndir: Record an indirection in the loop, either as an access of a
+// candidate location, or as an access that may alias candidate locations.
+//
+// Parameters:
+//   block - The block containing the indirection
+//   indir - The indirection
+//
+// Returns:
+//   False if no location can be promoted in the loop.
+//
+bool LoopMemoryPromotionContext::AnalyzeIndir(BasicBlock* block, GenTreeIndir* indir)
+{
+    unsigned             objLclNum;
+    CORINFO_FIELD_HANDLE fieldHnd;
+    if (GetCandidateLocation(indir, &objLclNum, &fieldHnd))
+    {
+        LoopMemoryLocation* location = FindLocation(objLclNum, fieldHnd);
+        if (location == nullptr)
+        {
+            m_locations.Emplace(objLclNum, fieldHnd, indir);
+            location = &m_locations.TopRef();
+        }
+
+        if (indir->TypeGet() != location->Type)
+        {
+            JITDUMP("  V%02u field accessed by [%06u] is accessed with different types\n", objLclNum,
+                    Compiler::dspTreeID(indir));
+            location->Disqualified = true;
+        }
+
+        if (indir->OperIs(GT_STOREIND) && (block == m_loop->GetHeader()))
+        {
+            location->StoredInHeader = true;
+        }
+
+        location->MayFault |= indir->OperMayThrow(m_comp);
+        return true;
+    }
+
+    if (indir->OperIsStore())
+    {
+        JITDUMP("  Skipping: [%06u] is a store to memory that is not a candidate\n", Compiler::dspTreeID(indir));
+        return false;
+    }
+
+    GenTree*  addr   = indir->Addr();
+    GenTree*  base   = nullptr;
+    FieldSeq* fldSeq = nullptr;
+    ssize_t   offset = 0;
+    if (addr->IsFieldAddr(m_comp, &base, &fldSeq, &offset))
+    {
+        // Static fields never alias instance fields.
+        if (!fldSeq->IsStaticField())
+        {
+            m_aliasedFields.Push(fldSeq->GetFieldHandle());
+        }
+    }
+    else
+    {
+        base = addr;
+
+        if (!addr->OperIs(GT_ARR_ADDR, GT_LCL_ADDR) && !indir->IsInvariantLoad())
+        {
+            JITDUMP("  [%06u] may access any field\n", Compiler::dspTreeID(indir));
+            m_mayAliasAnyField = true;
+        }
+    }
+
+    if (indir->OperMayThrow(m_comp))
+    {
+        // Only faults off of promoted objects are tolerated; these are
+        // checked once it is known which locations are promoted.
+        if ((base == nullptr) || !base->OperIs(GT_LCL_VAR) || !base->TypeIs(TYP_REF))
+        {
+            JITDUMP("  Skipping: [%06u] may throw\n", Compiler::dspTreeID(indir));
+            return false;
+        }
+
+        m_faultingObjs.Push(base->AsLclVar()->GetLclNum());
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// GetCandidateLocation: Check if an indirection is a load or store of a
+// location that may be promoted.
+//
+// Parameters:
+//   indir     - The indirection
+//   objLclNum - [out] The local holding the object
+//   fieldHnd  - [out] The field of the object
+//
+// Returns:
+//   True if so.
+//
+bool LoopMemoryPromotionContext::GetCandidateLocation(GenTreeIndir*         indir,
+                                                      unsigned*             objLclNum,
+                                                      CORINFO_FIELD_HANDLE* fieldHnd)
+{
+    if (!indir->OperIs(GT_IND, GT_STOREIND) || !indir->TypeIs(TYP_INT, TYP_LONG, TYP_FLOAT, TYP_DOUBLE) ||
+        indir->IsVolatile() || indir->IsUnaligned())
+    {
+        return false;
+    }
+
+    GenTree*  base;
+    FieldSeq* fldSeq;
+    ssize_t   offset;
+    if (!indir->Addr()->IsFieldAddr(m_comp, &base, &fldSeq, &offset) || fldSeq->IsStaticField() || (offset != 0) ||
+        !base->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    assert(base->TypeIs(TYP_REF));
+    *objLclNum = base->AsLclVar()->GetLclNum();
+    *fieldHnd  = fldSeq->GetFieldHandle();
+    return true;
+}
+
+//------------------------------------------------------------------------
+// FindLocation: Find a previously recorded location.
+//
+// Parameters:
+//   objLclNum - The local holding the object
+//   fieldHnd  - The field of the object
+//
+// Returns:
+//   The location, or nullptr if it has not been recorded.
+//
+LoopMemoryLocation* LoopMemoryPromotionContext::FindLocation(unsigned objLclNum, CORINFO_FIELD_HANDLE fieldHnd)
+{
+    for (int i = 0; i < m_locations.Height(); i++)
+    {
+        LoopMemoryLocation& location = m_locations.BottomRef(i);
+        if ((location.ObjLclNum == objLclNum) && (location.FieldHnd == fieldHnd))
+        {
+            return &location;
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------
+// SelectLocations: Decide which of the recorded locations to promote.
+//
+// Returns:
+//   True if at least one location is promoted.
+//
+bool LoopMemoryPromotionContext::SelectLocations()
+{
+    for (int i = 0; i < m_locations.Height(); i++)
+    {
+        LoopMemoryLocation& location = m_locations.BottomRef(i);
+
+        // Accesses of the same field off of different locals may access the
+        // same object.
+        for (int j = 0; j < m_locations.Height(); j++)
+        {
+            if ((i != j) && (m_locations.BottomRef(j).FieldHnd == location.FieldHnd))
+            {
+                JITDUMP("  V%02u field is also accessed off of V%02u\n", location.ObjLclNum,
+                        m_locations.BottomRef(j).ObjLclNum);
+                location.Disqualified = true;
+            }
+        }
+
+        if (m_mayAliasAnyField || Contains(m_aliasedFields, location.FieldHnd))
+        {
+            JITDUMP("  V%02u field may be aliased by other accesses\n", location.ObjLclNum);
+            location.Disqualified = true;
+        }
+
+        if (Contains(m_storedLocals, location.ObjLclNum) || m_comp->lvaGetDesc(location.ObjLclNum)->IsAddressExposed())
+        {
+            JITDUMP("  V%02u is not invariant in the loop\n", location.ObjLclNum);
+            location.Disqualified = true;
+        }
+
+        if (!location.StoredInHeader)
+        {
+            JITDUMP("  V%02u field is not stored to in the loop header\n", location.ObjLclNum);
+            location.Disqualified = true;
+        }
+    }
+
+    int numPromoted = 0;
+    for (int i = 0; i < m_locations.Height(); i++)
+    {
+        LoopMemoryLocation& location = m_locations.BottomRef(i);
+        if (location.IsPromoted() && (numPromoted >= MAX_PROMOTED_LOCATIONS_PER_LOOP))
+        {
+            location.Disqualified = true;
+        }
+
+        if (location.IsPromoted())
+        {
+            numPromoted++;
+        }
+        else if (location.MayFault)
+        {
+            m_faultingObjs.Push(location.ObjLclNum);
+        }
+    }
+
+    if (numPromoted == 0)
+    {
+        JITDUMP("  Skipping: no locations to promote\n");
+        return false;
+    }
+
+    // Faults off of the objects of promoted locations happen before any other
+    // side effect of the loop: if the object is null, the load in the
+    // preheader throws. Any other fault would happen after the original loop
+    // may have already stored to the promoted locations.
+    for (int i = 0; i < m_faultingObjs.Height(); i++)
+    {
+        unsigned objLclNum = m_faultingObjs.Bottom(i);
+        bool     promoted  = false;
+        for (int j = 0; j < m_locations.Height(); j++)
+        {
+            LoopMemoryLocation& location = m_locations.BottomRef(j);
+            promoted |= location.IsPromoted() && (location.ObjLclNum == objLclNum);
+        }
+
+        if (!promoted)
+        {
+            JITDUMP("  Skipping: accesses off of V%02u may throw\n", objLclNum);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// Transform: Replace the accesses of the promoted locations by accesses of
+// new locals, initialize the locals in the preheader and store them back in
+// the exits.
+//
+void LoopMemoryPromotionContext::Transform()
+{
+    BasicBlock* preheader = m_loop->GetPreheader();
+
+    for (int i = 0; i < m_locations.Height(); i++)
+    {
+        LoopMemoryLocation& location = m_locations.BottomRef(i);
+        if (!location.IsPromoted())
+        {
+            continue;
+        }
+
+        location.NewLclNum = m_comp->lvaGrabTemp(
+            false DEBUGARG(m_comp->printfAlloc("Loop promoted field of V%02u", location.ObjLclNum)));
+
+        GenTree*   load  = m_comp->gtNewIndir(location.Type, m_comp->gtCloneExpr(location.Access->Addr()));
+        GenTree*   store = m_comp->gtNewTempStore(location.NewLclNum, load);
+        Statement* stmt  = m_comp->fgNewStmtFromTree(store);
+        m_comp->fgInsertStmtAtEnd(preheader, stmt);
+
+        JITDUMP("  Promoting V%02u field to V%02u; initialized in preheader " FMT_BB "\n", location.ObjLclNum,
+                location.NewLclNum, preheader->bbNum);
+        DISPSTMT(stmt);
+    }
+
+    class ReplaceVisitor final : public GenTreeVisitor<ReplaceVisitor>
+    {
+        LoopMemoryPromotionContext* m_context;
+
+    public:
+        enum
+        {
+            DoPreOrder = true,
+        };
+
+        bool Changed = false;
+
+        ReplaceVisitor(Compiler* comp, LoopMemoryPromotionContext* context)
+            : GenTreeVisitor(comp)
+            , m_context(context)
+        {
+        }
+
+        fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree*             node = *use;
+            unsigned             objLclNum;
+            CORINFO_FIELD_HANDLE fieldHnd;
+            if (!node->OperIsIndir() || !m_context->GetCandidateLocation(node->AsIndir(), &objLclNum, &fieldHnd))
+            {
+                return fgWalkResult::WALK_CONTINUE;
+            }
+
+            LoopMemoryLocation* location = m_context->FindLocation(objLclNum, fieldHnd);
+            if ((location == nullptr) || !location->IsPromoted())
+            {
+                return fgWalkResult::WALK_CONTINUE;
+            }
+
+            if (node->OperIs(GT_STOREIND))
+            {
+                *use = m_compiler->gtNewStoreLclVarNode(location->NewLclNum, node->AsIndir()->Data());
+            }
+            else
+            {
+                *use = m_compiler->gtNewLclvNode(location->NewLclNum, location->Type);
+            }
+
+            Changed = true;
+            return fgWalkResult::WALK_CONTINUE;
+        }
+    };
+
+    m_loop->VisitLoopBlocks([=](BasicBlock* block) {
+        for (Statement* stmt : block->Statements())
+        {
+            ReplaceVisitor visitor(m_comp, this);
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+
+            if (visitor.Changed)
+            {
+                m_comp->gtUpdateStmtSideEffects(stmt);
+                m_comp->gtSetStmtInfo(stmt);
+                m_comp->fgSetStmtSeq(stmt);
+                JITDUMP("  Replaced accesses in " FMT_BB "\n", block->bbNum);
+                DISPSTMT(stmt);
+            }
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    m_loop->VisitRegularExitBlocks([=](BasicBlock* exit) {
+        for (int i = 0; i < m_locations.Height(); i++)
+        {
+            LoopMemoryLocation& location = m_locations.BottomRef(i);
+            if (!location.IsPromoted())
+            {
+                continue;
+            }
+
+            // The object was already dereferenced in the preheader.
+            GenTree*   value = m_comp->gtNewLclvNode(location.NewLclNum, location.Type);
+            GenTree*   store = m_comp->gtNewStoreIndNode(location.Type, m_comp->gtCloneExpr(location.Access->Addr()),
+                                                         value, GTF_IND_NONFAULTING);
+            Statement* stmt  = m_comp->fgNewStmtFromTree(store);
+            m_comp->fgInsertStmtAtBeg(exit, stmt);
+
+            JITDUMP("  Storing back V%02u in exit " FMT_BB "\n", location.NewLclNum, exit->bbNum);
+            DISPSTMT(stmt);
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+}
+
+//------------------------------------------------------------------------
+// optPromoteLoopMemory: Promote fields of loop invariant objects that are
+// loaded and stored inside of loops to locals for the duration of the loops.
+//
+// Returns:
+//   Suitable phase status.
+//
+PhaseStatus Compiler::optPromoteLoopMemory()
+{
+    JITDUMP("*************** In optPromoteLoopMemory()\n");
+
+#ifdef DEBUG
+    static ConfigMethodRange s_range;
+    s_range.EnsureInit(JitConfig.JitEnableLoopMemoryPromotionRange());
+
+    if (!s_range.Contains(info.compMethodHash()))
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+#endif
+
+    if (!fgMightHaveNaturalLoops)
+    {
+        JITDUMP("  Skipping since this method has no natural loops\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (JitConfig.JitEnableLoopMemoryPromotion() == 0)
+    {
+        JITDUMP("  Skipping since it is disabled due to JitEnableLoopMemoryPromotion\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (compCodeOpt() == SMALL_CODE)
+    {
+        JITDUMP("  Skipping since we are optimizing for size\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (m_dfsTree == nullptr)
+    {
+        m_dfsTree = fgComputeDfs();
+    }
+
+    if (m_loops == nullptr)
+    {
+        m_loops = FlowGraphNaturalLoops::Find(m_dfsTree);
+    }
+
+    bool changed = false;
+    JITDUMP("Promoting loop memory:\n");
+
+    // Parents are visited before their children. Accesses promoted in a parent
+    // are no longer indirections when the child loop is processed.
+    for (FlowGraphNaturalLoop* loop : m_loops->InReversePostOrder())
+    {
+        JITDUMP("Processing ");
+        DBEXEC(verbose, FlowGraphNaturalLoop::Dump(loop));
+
+        LoopMemoryPromotionContext context(this, loop);
+        int                        numPromoted = context.TryPromote();
+        if (numPromoted > 0)
+        {
+            Metrics.LoopMemoryLocationsPromoted += numPromoted;
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        fgInvalidateDfsTree();
+    }
+
+    return changed ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
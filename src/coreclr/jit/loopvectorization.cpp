@@ -0,0 +1,846 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// This file contains a loop vectorizer that is based on the scalar evolution
+// analysis (see scev.h and scev.cpp).
+//
+// Currently only integer reductions are vectorized. A candidate loop consists
+// of a single block whose only statements (apart from the PHIs and the exit
+// test) are updates of primary induction variables and reductions of the form
+//
+//   sum = sum + *addr
+//
+// where "addr" is an add recurrence stepping by the size of the loaded
+// element, and the load is known not to fault. Such a loop is transformed
+// into
+//
+//   count = <backedge taken count> & ~(lanes - 1)
+//   vsum = 0
+//   if (count != 0)
+//   {
+//     base = <addr at iteration 0>
+//     offset = 0
+//     do
+//     {
+//       vsum = vsum + Vector.Load(base + offset)
+//       offset = offset + <vector size>
+//     } while (offset < count * <element size>)
+//   }
+//   sum = sum + Vector.Sum(vsum)
+//   iv = iv + count * step
+//   <original loop>
+//
+// where the original loop now serves as the scalar epilogue. Using the
+// backedge taken count (instead of the trip count) for the vector part
+// ensures the original bottom-tested loop still runs at least once, which
+// means the values of the locals after the loop keep coming from their
+// existing SSA definitions.
+//
+// Since the candidate loops do not store to memory there is no need to prove
+// absence of aliasing. Floating point reductions are not vectorized since
+// reassociating the additions could change the result.
+//
+
+#include "jitpch.h"
+#include "scev.h"
+
+#if defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
+
+// Describes a header PHI of a vectorization candidate: either a primary
+// induction variable or a reduction.
+struct VectorizationLocal
+{
+    GenTreeLclVarCommon* PhiDef;
+    GenTreePhiArg*       EntryArg;
+    // For primary IVs: the add recurrence describing the IV, and its step.
+    ScevAddRec* IV   = nullptr;
+    int64_t     Step = 0;
+    // For reductions: the add recurrence describing the address that is
+    // loaded every iteration, and the IR computing its initial value.
+    ScevAddRec* Address      = nullptr;
+    GenTree*    AddressStart = nullptr;
+    // For reductions: temps used by the vectorized loop for the base address,
+    // the vector accumulator and the horizontally summed result.
+    unsigned BaseLcl   = BAD_VAR_NUM;
+    unsigned VectorLcl = BAD_VAR_NUM;
+    unsigned SumLcl    = BAD_VAR_NUM;
+
+    VectorizationLocal(GenTreeLclVarCommon* phiDef, GenTreePhiArg* entryArg)
+        : PhiDef(phiDef)
+        , EntryArg(entryArg)
+    {
+    }
+
+    bool IsReduction() const
+    {
+        return Address != nullptr;
+    }
+};
+
+class LoopVectorizationContext
+{
+    Compiler*                      m_comp;
+    ScalarEvolutionContext&        m_scevContext;
+    FlowGraphNaturalLoop*          m_loop;
+    ArrayStack<VectorizationLocal> m_locals;
+    Scev*                          m_backEdgeCount     = nullptr;
+    GenTree*                       m_backEdgeCountTree = nullptr;
+    SimplificationAssumptions      m_simplAssumptions;
+    var_types                      m_elemType = TYP_UNDEF;
+    unsigned                       m_simdSize = 0;
+
+    bool                IsCandidateShape();
+    bool                AnalyzeHeaderPhis();
+    bool                AnalyzeStores();
+    bool                AnalyzeReduction(VectorizationLocal* local, GenTreeLclVarCommon* store);
+    VectorizationLocal* FindLocal(unsigned lclNum);
+    void                CountOccurrences(unsigned lclNum, unsigned* reads, unsigned* stores);
+    BasicBlock*         NewBlock(BBKinds kind, BasicBlock* after, BasicBlock* weightSource);
+    void                InsertStmt(BasicBlock* block, GenTree* tree);
+    void                InsertEntryDef(BasicBlock* block, VectorizationLocal* local, GenTree* increment);
+    void                Transform();
+
+public:
+    LoopVectorizationContext(Compiler* comp, ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop)
+        : m_comp(comp)
+        , m_scevContext(scevContext)
+        , m_loop(loop)
+        , m_locals(comp->getAllocator(CMK_LoopOpt))
+    {
+    }
+
+    bool TryVectorize();
+};
+
+//------------------------------------------------------------------------
+// TryVectorize: Check if the loop is a vectorization candidate and, if so,
+// insert the vectorized version in front of it.
+//
+// Returns:
+//   True if the loop was vectorized.
+//
+bool LoopVectorizationContext::TryVectorize()
+{
+    if (!IsCandidateShape() || !AnalyzeHeaderPhis() || !AnalyzeStores())
+    {
+        return false;
+    }
+
+    unsigned elemSize = genTypeSize(m_elemType);
+    m_simdSize        = m_comp->getPreferredVectorByteLength();
+
+#if defined(TARGET_XARCH)
+    // 256-bit integer arithmetic needs AVX2.
+    if ((m_simdSize > XMM_REGSIZE_BYTES) && !m_comp->compOpportunisticallyDependsOn(InstructionSet_AVX2))
+    {
+        m_simdSize = XMM_REGSIZE_BYTES;
+    }
+#endif
+
+    unsigned lanes = m_simdSize / elemSize;
+
+    int64_t backEdgeCount;
+    if (m_backEdgeCount->GetConstantValue(m_comp, &backEdgeCount) && (backEdgeCount < (int64_t)lanes))
+    {
+        JITDUMP("  Skipping: loop is known to run less than a full vector of iterations\n");
+        return false;
+    }
+
+    // Materialize everything that may fail before we start changing the IR.
+    m_backEdgeCountTree = m_scevContext.Materialize(m_backEdgeCount);
+    if (m_backEdgeCountTree == nullptr)
+    {
+        JITDUMP("  Skipping: could not materialize backedge count\n");
+        return false;
+    }
+
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if (!local.IsReduction())
+        {
+            continue;
+        }
+
+        local.AddressStart = m_scevContext.Materialize(local.Address->Start);
+        if (local.AddressStart == nullptr)
+        {
+            JITDUMP("  Skipping: could not materialize start address of V%02u's reduction\n",
+                    local.PhiDef->GetLclNum());
+            return false;
+        }
+    }
+
+    JITDUMP("  Vectorizing " FMT_LP " with %u byte vectors\n", m_loop->GetIndex(), m_simdSize);
+    Transform();
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsCandidateShape: Check that the loop has the flow graph shape expected by
+// the vectorizer, and that we know how many times it iterates.
+//
+// Returns:
+//   True if so.
+//
+bool LoopVectorizationContext::IsCandidateShape()
+{
+    BasicBlock* header    = m_loop->GetHeader();
+    BasicBlock* preheader = m_loop->GetPreheader();
+
+    if (preheader == nullptr)
+    {
+        JITDUMP("  Skipping: no preheader\n");
+        return false;
+    }
+
+    if ((m_loop->NumLoopBlocks() != 1) || !header->KindIs(BBJ_COND) || (m_loop->ExitEdges().size() != 1))
+    {
+        JITDUMP("  Skipping: not a single block loop with a single exit\n");
+        return false;
+    }
+
+    if (!preheader->KindIs(BBJ_ALWAYS) || !BasicBlock::sameEHRegion(preheader, header))
+    {
+        JITDUMP("  Skipping: unexpected preheader " FMT_BB "\n", preheader->bbNum);
+        return false;
+    }
+
+    if (header->isRunRarely())
+    {
+        JITDUMP("  Skipping: loop is rarely run\n");
+        return false;
+    }
+
+    m_backEdgeCount = m_scevContext.ComputeExitNotTakenCount(header);
+    if (m_backEdgeCount == nullptr)
+    {
+        JITDUMP("  Skipping: could not compute backedge count -- not a counted loop\n");
+        return false;
+    }
+
+    m_simplAssumptions.BackEdgeTakenBound    = &m_backEdgeCount;
+    m_simplAssumptions.NumBackEdgeTakenBound = 1;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// AnalyzeHeaderPhis: Record all locals that have PHIs in the header, and
+// classify the primary IVs among them.
+//
+// Returns:
+//   True if all PHIs are in the expected form.
+//
+bool LoopVectorizationContext::AnalyzeHeaderPhis()
+{
+    BasicBlock* header = m_loop->GetHeader();
+
+    for (Statement* stmt : header->Statements())
+    {
+        if (!stmt->IsPhiDefnStmt())
+        {
+            break;
+        }
+
+        GenTreeLclVarCommon* phiDef = stmt->GetRootNode()->AsLclVarCommon();
+        LclVarDsc*           dsc    = m_comp->lvaGetDesc(phiDef);
+
+        if (dsc->lvIsStructField)
+        {
+            JITDUMP("  Skipping: V%02u is a struct field\n", phiDef->GetLclNum());
+            return false;
+        }
+
+        GenTreePhiArg* entryArg = nullptr;
+        for (GenTreePhi::Use& use : phiDef->Data()->AsPhi()->Uses())
+        {
+            GenTreePhiArg* phiArg = use.GetNode()->AsPhiArg();
+            if (phiArg->gtPredBB == header)
+            {
+                continue;
+            }
+
+            // We checked the loop has a preheader, so it is the only entry.
+            assert(phiArg->gtPredBB == m_loop->GetPreheader());
+            assert(entryArg == nullptr);
+            entryArg = phiArg;
+        }
+
+        assert(entryArg != nullptr);
+        VectorizationLocal local(phiDef, entryArg);
+
+        Scev* scev = m_scevContext.Analyze(header, phiDef->Data());
+        if ((scev != nullptr) && scev->OperIs(ScevOper::AddRec))
+        {
+            ScevAddRec* addRec = (ScevAddRec*)scev;
+            int64_t     step;
+            if (addRec->Step->GetConstantValue(m_comp, &step))
+            {
+                JITDUMP("  V%02u is a primary IV with step %lld\n", phiDef->GetLclNum(), (long long)step);
+                local.IV   = addRec;
+                local.Step = step;
+            }
+        }
+
+        m_locals.Push(local);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// AnalyzeStores: Check that all non-PHI statements of the loop are either
+// IV updates, reductions, or the exit test.
+//
+// Returns:
+//   True if so, and at least one reduction was found.
+//
+bool LoopVectorizationContext::AnalyzeStores()
+{
+    BasicBlock* header    = m_loop->GetHeader();
+    Statement*  jtrueStmt = header->lastStmt();
+    assert(jtrueStmt->GetRootNode()->OperIs(GT_JTRUE));
+
+    unsigned numReductions = 0;
+
+    for (Statement* stmt : header->NonPhiStatements())
+    {
+        GenTree* root = stmt->GetRootNode();
+        if (stmt == jtrueStmt)
+        {
+            if ((root->gtGetOp1()->gtFlags & GTF_SIDE_EFFECT) != 0)
+            {
+                JITDUMP("  Skipping: exit test has side effects\n");
+                return false;
+            }
+
+            break;
+        }
+
+        VectorizationLocal* local = root->OperIs(GT_STORE_LCL_VAR) ? FindLocal(root->AsLclVar()->GetLclNum()) : nullptr;
+        if (local == nullptr)
+        {
+            JITDUMP("  Skipping: [%06u] is not an update of a loop-carried local\n", Compiler::dspTreeID(root));
+            return false;
+        }
+
+        if (local->IV != nullptr)
+        {
+            if ((root->AsLclVar()->Data()->gtFlags & GTF_SIDE_EFFECT) != 0)
+            {
+                JITDUMP("  Skipping: IV update [%06u] has side effects\n", Compiler::dspTreeID(root));
+                return false;
+            }
+
+            continue;
+        }
+
+        if (!AnalyzeReduction(local, root->AsLclVar()))
+        {
+            return false;
+        }
+
+        numReductions++;
+    }
+
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if ((local.IV == nullptr) && !local.IsReduction())
+        {
+            JITDUMP("  Skipping: V%02u is neither a primary IV nor a reduction\n", local.PhiDef->GetLclNum());
+            return false;
+        }
+    }
+
+    if (numReductions == 0)
+    {
+        JITDUMP("  Skipping: no reductions\n");
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// AnalyzeReduction: Check if a store is a vectorizable reduction.
+//
+// Parameters:
+//   local - The local with a PHI in the header
+//   store - The store to the local inside the loop
+//
+// Returns:
+//   True if the store is a reduction "sum = sum + *addr" that we know how to
+//   vectorize. In that case local->Address is populated.
+//
+bool LoopVectorizationContext::AnalyzeReduction(VectorizationLocal* local, GenTreeLclVarCommon* store)
+{
+    unsigned   lclNum = store->GetLclNum();
+    LclVarDsc* dsc    = m_comp->lvaGetDesc(lclNum);
+    GenTree*   data   = store->Data();
+
+    if (local->IsReduction() || !dsc->TypeIs(TYP_INT, TYP_LONG) || !data->OperIs(GT_ADD) ||
+        !data->TypeIs(dsc->TypeGet()) || data->gtOverflow())
+    {
+        JITDUMP("  Skipping: [%06u] is not an integer add reduction\n", Compiler::dspTreeID(store));
+        return false;
+    }
+
+    GenTree* sumUse = data->gtGetOp1();
+    GenTree* load   = data->gtGetOp2();
+    if (!sumUse->OperIs(GT_LCL_VAR))
+    {
+        std::swap(sumUse, load);
+    }
+
+    if (!sumUse->OperIs(GT_LCL_VAR) || (sumUse->AsLclVar()->GetLclNum() != lclNum) ||
+        (sumUse->AsLclVar()->GetSsaNum() != local->PhiDef->GetSsaNum()))
+    {
+        JITDUMP("  Skipping: [%06u] does not accumulate into the previous value\n", Compiler::dspTreeID(store));
+        return false;
+    }
+
+    // The previous value must not be used anywhere else in the loop, and the
+    // new value must only be used by the next iteration (and after the loop).
+    unsigned reads;
+    unsigned stores;
+    CountOccurrences(lclNum, &reads, &stores);
+    if ((reads != 1) || (stores != 1) || (dsc->GetPerSsaData(local->PhiDef->GetSsaNum())->GetNumUses() != 1))
+    {
+        JITDUMP("  Skipping: V%02u has other occurrences inside the loop\n", lclNum);
+        return false;
+    }
+
+    if (!load->OperIs(GT_IND) || !load->TypeIs(dsc->TypeGet()) || load->AsIndir()->IsVolatile() ||
+        load->OperMayThrow(m_comp) || ((load->AsIndir()->Addr()->gtFlags & GTF_SIDE_EFFECT) != 0))
+    {
+        JITDUMP("  Skipping: [%06u] is not a non-faulting load\n", Compiler::dspTreeID(load));
+        return false;
+    }
+
+    if ((m_elemType != TYP_UNDEF) && (m_elemType != load->TypeGet()))
+    {
+        JITDUMP("  Skipping: reductions over different element types\n");
+        return false;
+    }
+
+    Scev* addr = m_scevContext.Analyze(m_loop->GetHeader(), load->AsIndir()->Addr());
+    if (addr != nullptr)
+    {
+        addr = m_scevContext.Simplify(addr, m_simplAssumptions);
+    }
+
+    int64_t step;
+    if ((addr == nullptr) || !addr->OperIs(ScevOper::AddRec) ||
+        !(addr->TypeIs(TYP_BYREF) || addr->TypeIs(TYP_I_IMPL)) ||
+        !((ScevAddRec*)addr)->Step->GetConstantValue(m_comp, &step) || (step != (int64_t)genTypeSize(load->TypeGet())))
+    {
+        JITDUMP("  Skipping: address of [%06u] is not a contiguous add recurrence\n", Compiler::dspTreeID(load));
+        return false;
+    }
+
+    JITDUMP("  V%02u is a reduction over ", lclNum);
+    DBEXEC(m_comp->verbose, addr->Dump(m_comp));
+    JITDUMP("\n");
+
+    m_elemType     = load->TypeGet();
+    local->Address = (ScevAddRec*)addr;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// FindLocal: Find the header PHI information for a local.
+//
+// Parameters:
+//   lclNum - The local
+//
+// Returns:
+//   The information, or nullptr if the local has no PHI in the header.
+//
+VectorizationLocal* LoopVectorizationContext::FindLocal(unsigned lclNum)
+{
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        if (m_locals.BottomRef(i).PhiDef->GetLclNum() == lclNum)
+        {
+            return &m_locals.BottomRef(i);
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------
+// CountOccurrences: Count the occurrences of a local in the non-PHI
+// statements of the loop.
+//
+// Parameters:
+//   lclNum - The local
+//   reads  - [out] Number of reads of the local (including address-taking)
+//   stores - [out] Number of stores to the local
+//
+void LoopVectorizationContext::CountOccurrences(unsigned lclNum, unsigned* reads, unsigned* stores)
+{
+    *reads  = 0;
+    *stores = 0;
+
+    for (Statement* stmt : m_loop->GetHeader()->NonPhiStatements())
+    {
+        for (GenTree* node : stmt->TreeList())
+        {
+            if (!node->OperIsAnyLocal() || (node->AsLclVarCommon()->GetLclNum() != lclNum))
+            {
+                continue;
+            }
+
+            if (node->OperIsLocalStore())
+            {
+                (*stores)++;
+            }
+            else
+            {
+                (*reads)++;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// NewBlock: Create a new internal block for the vectorized loop.
+//
+// Parameters:
+//   kind         - Kind of the block
+//   after        - Block to insert the new block after
+//   weightSource - Block to inherit the weight from
+//
+// Returns:
+//   The new block.
+//
+BasicBlock* LoopVectorizationContext::NewBlock(BBKinds kind, BasicBlock* after, BasicBlock* weightSource)
+{
+    BasicBlock* block = m_comp->fgNewBBafter(kind, after, /* extendRegion */ true);
+    block->SetFlags(BBF_INTERNAL);
+    block->inheritWeight(weightSource);
+    block->bbCodeOffs    = after->bbCodeOffsEnd;
+    block->bbCodeOffsEnd = after->bbCodeOffsEnd;
+    return block;
+}
+
+//------------------------------------------------------------------------
+// InsertStmt: Insert a new statement at the end of a block.
+//
+// Parameters:
+//   block - The block
+//   tree  - Root of the new statement
+//
+void LoopVectorizationContext::InsertStmt(BasicBlock* block, GenTree* tree)
+{
+    Statement* stmt = m_comp->fgNewStmtFromTree(tree);
+    m_comp->fgInsertStmtAtEnd(block, stmt);
+
+    JITDUMP("  Inserted in " FMT_BB ":\n", block->bbNum);
+    DISPSTMT(stmt);
+}
+
+//------------------------------------------------------------------------
+// InsertEntryDef: Insert a new SSA definition "lcl = lcl + increment" of a
+// loop-carried local in the block that now enters the loop, and make the
+// header PHI refer to it.
+//
+// Parameters:
+//   block     - The new entry block of the loop
+//   local     - The loop-carried local
+//   increment - The value to add
+//
+void LoopVectorizationContext::InsertEntryDef(BasicBlock* block, VectorizationLocal* local, GenTree* increment)
+{
+    unsigned      lclNum      = local->PhiDef->GetLclNum();
+    LclVarDsc*    dsc         = m_comp->lvaGetDesc(lclNum);
+    var_types     type        = dsc->TypeGet();
+    unsigned      entrySsaNum = local->EntryArg->GetSsaNum();
+    LclSsaVarDsc* entryDsc    = dsc->GetPerSsaData(entrySsaNum);
+
+    GenTreeLclVar* use = m_comp->gtNewLclvNode(lclNum, type);
+    use->SetSsaNum(entrySsaNum);
+    use->SetVNs(entryDsc->m_vnPair);
+    entryDsc->AddUse(block);
+
+    GenTree*       value  = m_comp->gtNewOperNode(GT_ADD, type, use, increment);
+    GenTreeLclVar* store  = m_comp->gtNewStoreLclVarNode(lclNum, value);
+    unsigned       ssaNum = dsc->lvPerSsaData.AllocSsaNum(m_comp->getAllocator(CMK_SSA), block, store);
+    store->SetSsaNum(ssaNum);
+
+    LclSsaVarDsc* ssaDsc = dsc->GetPerSsaData(ssaNum);
+    ssaDsc->m_vnPair     = m_comp->vnStore->VNPairForExpr(block, type);
+    ssaDsc->AddPhiUse(m_loop->GetHeader());
+    value->SetVNs(ssaDsc->m_vnPair);
+
+    local->EntryArg->SetSsaNum(ssaNum);
+    local->EntryArg->SetVNs(ssaDsc->m_vnPair);
+    local->EntryArg->gtPredBB = block;
+
+    InsertStmt(block, store);
+}
+
+//------------------------------------------------------------------------
+// Transform: Insert the vectorized loop in front of the candidate loop.
+//
+void LoopVectorizationContext::Transform()
+{
+    BasicBlock* header    = m_loop->GetHeader();
+    BasicBlock* preheader = m_loop->GetPreheader();
+
+    var_types   simdType     = Compiler::getSIMDTypeForSize(m_simdSize);
+    CorInfoType baseJitType  = (m_elemType == TYP_INT) ? CORINFO_TYPE_INT : CORINFO_TYPE_LONG;
+    unsigned    elemSize     = genTypeSize(m_elemType);
+    unsigned    lanes        = m_simdSize / elemSize;
+    FlowEdge*   backEdge     = header->TrueTargetIs(header) ? header->GetTrueEdge() : header->GetFalseEdge();
+    weight_t    backEdgeProb = backEdge->getLikelihood();
+
+    m_comp->setUsesSIMDTypes(true);
+
+    BasicBlock* checkBlock  = NewBlock(BBJ_COND, preheader, preheader);
+    BasicBlock* initBlock   = NewBlock(BBJ_ALWAYS, checkBlock, preheader);
+    BasicBlock* vectorLoop  = NewBlock(BBJ_COND, initBlock, header);
+    BasicBlock* reduceBlock = NewBlock(BBJ_ALWAYS, vectorLoop, preheader);
+    BasicBlock* entryBlock  = NewBlock(BBJ_ALWAYS, reduceBlock, preheader);
+
+    // checkBlock: compute the number of iterations to do with vectors, and
+    // skip the vector loop if there are none.
+    GenTree* count = m_backEdgeCountTree;
+    if (!count->TypeIs(TYP_I_IMPL))
+    {
+        // The backedge count is an unsigned quantity.
+        count = m_comp->gtNewCastNode(TYP_I_IMPL, count, /* unsigned */ true, TYP_I_IMPL);
+    }
+
+    GenTree* mask        = m_comp->gtNewIconNode(~(ssize_t)(lanes - 1), TYP_I_IMPL);
+    GenTree* vectorCount = m_comp->gtNewOperNode(GT_AND, TYP_I_IMPL, count, mask);
+
+    unsigned vectorCountLcl = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized iteration count"));
+    InsertStmt(checkBlock, m_comp->gtNewTempStore(vectorCountLcl, vectorCount));
+
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if (local.IsReduction())
+        {
+            local.SumLcl = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized reduction sum"));
+            InsertStmt(checkBlock, m_comp->gtNewTempStore(local.SumLcl, m_comp->gtNewZeroConNode(m_elemType)));
+        }
+    }
+
+    GenTree* skipCond = m_comp->gtNewOperNode(GT_EQ, TYP_INT, m_comp->gtNewLclvNode(vectorCountLcl, TYP_I_IMPL),
+                                              m_comp->gtNewIconNode(0, TYP_I_IMPL));
+    InsertStmt(checkBlock, m_comp->gtNewOperNode(GT_JTRUE, TYP_VOID, skipCond));
+
+    // initBlock: set up the base addresses, the vector accumulators and the
+    // byte offset shared by all loads.
+    unsigned offsetLcl = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized loop offset"));
+    unsigned limitLcl  = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized loop limit"));
+    GenTree* limit     = m_comp->gtNewOperNode(GT_LSH, TYP_I_IMPL, m_comp->gtNewLclvNode(vectorCountLcl, TYP_I_IMPL),
+                                               m_comp->gtNewIconNode(genLog2(elemSize)));
+    InsertStmt(initBlock, m_comp->gtNewTempStore(offsetLcl, m_comp->gtNewIconNode(0, TYP_I_IMPL)));
+    InsertStmt(initBlock, m_comp->gtNewTempStore(limitLcl, limit));
+
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if (!local.IsReduction())
+        {
+            continue;
+        }
+
+        local.BaseLcl   = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized reduction base"));
+        local.VectorLcl = m_comp->lvaGrabTemp(false DEBUGARG("Vectorized reduction accumulator"));
+        InsertStmt(initBlock, m_comp->gtNewTempStore(local.BaseLcl, local.AddressStart));
+        InsertStmt(initBlock, m_comp->gtNewTempStore(local.VectorLcl, m_comp->gtNewZeroConNode(simdType)));
+    }
+
+    // vectorLoop: accumulate a vector of elements per iteration.
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if (!local.IsReduction())
+        {
+            continue;
+        }
+
+        var_types baseType = local.Address->Type;
+        GenTree*  addr     = m_comp->gtNewOperNode(GT_ADD, baseType, m_comp->gtNewLclvNode(local.BaseLcl, baseType),
+                                                   m_comp->gtNewLclvNode(offsetLcl, TYP_I_IMPL));
+        GenTree*  load     = m_comp->gtNewIndir(simdType, addr, GTF_IND_NONFAULTING);
+        GenTree*  acc      = m_comp->gtNewLclvNode(local.VectorLcl, simdType);
+        GenTree*  sum      = m_comp->gtNewSimdBinOpNode(GT_ADD, simdType, acc, load, baseJitType, m_simdSize);
+        InsertStmt(vectorLoop, m_comp->gtNewTempStore(local.VectorLcl, sum));
+    }
+
+    GenTree* nextOffset = m_comp->gtNewOperNode(GT_ADD, TYP_I_IMPL, m_comp->gtNewLclvNode(offsetLcl, TYP_I_IMPL),
+                                                m_comp->gtNewIconNode(m_simdSize, TYP_I_IMPL));
+    InsertStmt(vectorLoop, m_comp->gtNewTempStore(offsetLcl, nextOffset));
+
+    GenTree* loopCond = m_comp->gtNewOperNode(GT_LT, TYP_INT, m_comp->gtNewLclvNode(offsetLcl, TYP_I_IMPL),
+                                              m_comp->gtNewLclvNode(limitLcl, TYP_I_IMPL));
+    loopCond->SetUnsigned();
+    InsertStmt(vectorLoop, m_comp->gtNewOperNode(GT_JTRUE, TYP_VOID, loopCond));
+
+    // reduceBlock: horizontally sum the accumulators.
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        if (local.IsReduction())
+        {
+            GenTree* sum = m_comp->gtNewSimdSumNode(m_elemType, m_comp->gtNewLclvNode(local.VectorLcl, simdType),
+                                                    baseJitType, m_simdSize);
+            InsertStmt(reduceBlock, m_comp->gtNewTempStore(local.SumLcl, sum));
+        }
+    }
+
+    // entryBlock: advance the loop-carried locals past the iterations done
+    // by the vector loop. These are new SSA definitions that the header PHIs
+    // now refer to.
+    for (int i = 0; i < m_locals.Height(); i++)
+    {
+        VectorizationLocal& local = m_locals.BottomRef(i);
+        GenTree*            increment;
+        if (local.IsReduction())
+        {
+            increment = m_comp->gtNewLclvNode(local.SumLcl, m_elemType);
+        }
+        else
+        {
+            var_types countType = local.PhiDef->TypeIs(TYP_INT) ? TYP_INT : TYP_I_IMPL;
+            increment           = m_comp->gtNewLclvNode(vectorCountLcl, TYP_I_IMPL);
+            if (countType == TYP_INT)
+            {
+                increment = m_comp->gtNewCastNode(TYP_INT, increment, /* unsigned */ false, TYP_INT);
+            }
+
+            if (local.Step != 1)
+            {
+                GenTree* stepNode = m_comp->gtNewIconNode((ssize_t)local.Step, countType);
+                increment         = m_comp->gtNewOperNode(GT_MUL, countType, increment, stepNode);
+            }
+        }
+
+        InsertEntryDef(entryBlock, &local, increment);
+    }
+
+    // Wire up the flow graph:
+    //
+    //   preheader -> checkBlock -> (initBlock -> vectorLoop -> reduceBlock ->) entryBlock -> header
+    //
+    m_comp->fgRedirectEdge(preheader->TargetEdgeRef(), checkBlock);
+
+    FlowEdge* const skipEdge  = m_comp->fgAddRefPred(entryBlock, checkBlock);
+    FlowEdge* const enterEdge = m_comp->fgAddRefPred(initBlock, checkBlock);
+    checkBlock->SetTrueEdge(skipEdge);
+    checkBlock->SetFalseEdge(enterEdge);
+    skipEdge->setLikelihood(0.1);
+    enterEdge->setLikelihood(0.9);
+
+    initBlock->SetTargetEdge(m_comp->fgAddRefPred(vectorLoop, initBlock));
+
+    FlowEdge* const vectorBackEdge = m_comp->fgAddRefPred(vectorLoop, vectorLoop);
+    FlowEdge* const vectorExitEdge = m_comp->fgAddRefPred(reduceBlock, vectorLoop);
+    vectorLoop->SetTrueEdge(vectorBackEdge);
+    vectorLoop->SetFalseEdge(vectorExitEdge);
+    vectorBackEdge->setLikelihood(backEdgeProb);
+    vectorExitEdge->setLikelihood(1.0 - backEdgeProb);
+
+    reduceBlock->SetTargetEdge(m_comp->fgAddRefPred(entryBlock, reduceBlock));
+    entryBlock->SetTargetEdge(m_comp->fgAddRefPred(header, entryBlock));
+}
+
+#endif // defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
+
+//------------------------------------------------------------------------
+// optVectorizeLoops: Vectorize simple counted reduction loops.
+//
+// Returns:
+//   Suitable phase status.
+//
+PhaseStatus Compiler::optVectorizeLoops()
+{
+    JITDUMP("*************** In optVectorizeLoops()\n");
+
+#if defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
+#ifdef DEBUG
+    static ConfigMethodRange s_range;
+    s_range.EnsureInit(JitConfig.JitEnableLoopVectorizationRange());
+
+    if (!s_range.Contains(info.compMethodHash()))
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+#endif
+
+    if (!fgMightHaveNaturalLoops)
+    {
+        JITDUMP("  Skipping since this method has no natural loops\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (JitConfig.JitEnableLoopVectorization() == 0)
+    {
+        JITDUMP("  Skipping since it is disabled due to JitEnableLoopVectorization\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    if (compCodeOpt() == SMALL_CODE)
+    {
+        JITDUMP("  Skipping since we are optimizing for size\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    // The vector loops we create do not have GC safe points; the cycles they
+    // replace already required the method to be fully interruptible.
+    if (!GetInterruptible())
+    {
+        JITDUMP("  Skipping since the method is not fully interruptible\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+    bool changed = false;
+
+    if (m_dfsTree == nullptr)
+    {
+        m_dfsTree = fgComputeDfs();
+    }
+
+    if (m_loops == nullptr)
+    {
+        m_loops = FlowGraphNaturalLoops::Find(m_dfsTree);
+    }
+
+    ScalarEvolutionContext scevContext(this);
+    JITDUMP("Vectorizing loops:\n");
+
+    // Candidates are single block loops without child loops, and parents are
+    // visited before their children, so the blocks added when vectorizing a
+    // loop are never part of a loop that is processed afterwards.
+    for (FlowGraphNaturalLoop* loop : m_loops->InReversePostOrder())
+    {
+        JITDUMP("Processing ");
+        DBEXEC(verbose, FlowGraphNaturalLoop::Dump(loop));
+        scevContext.ResetForLoop(loop);
+
+        LoopVectorizationContext vectorizationContext(this, scevContext, loop);
+        if (vectorizationContext.TryVectorize())
+        {
+            Metrics.LoopsVectorized++;
+            changed = true;
+        }
+    }
+
+    if (changed)
+    {
+        fgInvalidateDfsTree();
+    }
+
+    return changed ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+#else
+    return PhaseStatus::MODIFIED_NOTHING;
+#endif // defined(FEATURE_HW_INTRINSICS) && defined(TARGET_64BIT)
+}
@@ -9147,9 +9147,137 @@ void Lowering::LowerBlock(BasicBlock* block)
         node = LowerNode(node);
     }
 
+    MarkYoungTargetStores(block);
+
     assert(CheckBlock(comp, block));
 }
 
+//------------------------------------------------------------------------
+// MarkYoungTargetStores: Mark the GC ref stores into objects this block just
+//    allocated as not needing a write barrier.
+//
+// Arguments:
+//    block - the lowered block
+//
+// Notes:
+//    An object returned by an allocation marked GTF_CALL_M_ALLOC_YOUNG is in
+//    gen0 until the next GC, and cards only need to be marked for references
+//    stored into older objects. When the GC promotes the object it marks the
+//    cards for whatever it still references, so the barrier can be omitted as
+//    long as no GC can happen between the allocation and the store.
+//
+//    In partially interruptible code a GC can only happen at calls, so the
+//    allocated objects are tracked through the locals they are stored to from
+//    the allocation to the next call in the same block. Fully interruptible
+//    methods are left alone.
+//
+void Lowering::MarkYoungTargetStores(BasicBlock* block)
+{
+    if (comp->opts.OptimizationDisabled() || comp->GetInterruptible() ||
+        (JitConfig.JitElideYoungTargetBarriers() == 0))
+    {
+        return;
+    }
+
+    const unsigned MaxYoungLocals = 4;
+    unsigned       youngLocals[MaxYoungLocals];
+    unsigned       youngLocalCount = 0;
+
+    auto isYoungLocal = [&](unsigned lclNum) {
+        for (unsigned i = 0; i < youngLocalCount; i++)
+        {
+            if (youngLocals[i] == lclNum)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (GenTree* node : BlockRange())
+    {
+        if (node->OperRequiresCallFlag(comp) || node->OperIs(GT_RETURNTRAP, GT_PROF_HOOK))
+        {
+            // A GC may happen here and promote any of the objects.
+            youngLocalCount = 0;
+            continue;
+        }
+
+        if (node->OperIs(GT_STORE_LCL_VAR))
+        {
+            const unsigned   lclNum = node->AsLclVar()->GetLclNum();
+            GenTree* const   data   = node->AsLclVar()->Data();
+            LclVarDsc* const varDsc = comp->lvaGetDesc(lclNum);
+
+            for (unsigned i = 0; i < youngLocalCount; i++)
+            {
+                if (youngLocals[i] == lclNum)
+                {
+                    youngLocals[i] = youngLocals[--youngLocalCount];
+                    break;
+                }
+            }
+
+            if (data->IsCall() && ((data->AsCall()->gtCallMoreFlags & GTF_CALL_M_ALLOC_YOUNG) != 0) &&
+                varDsc->TypeIs(TYP_REF) && !varDsc->IsAddressExposed() && (youngLocalCount < MaxYoungLocals))
+            {
+                youngLocals[youngLocalCount++] = lclNum;
+            }
+            continue;
+        }
+
+        if (!node->OperIs(GT_STOREIND) || !node->TypeIs(TYP_REF))
+        {
+            continue;
+        }
+
+        GenTreeStoreInd* const store = node->AsStoreInd();
+        if (comp->codeGen->gcInfo.gcIsWriteBarrierCandidate(store) == GCInfo::WBF_NoBarrier)
+        {
+            continue;
+        }
+
+        comp->Metrics.WriteBarrierStores++;
+
+        if (youngLocalCount == 0)
+        {
+            continue;
+        }
+
+        // Find the object the address is based on, like gcWriteBarrierFormFromTargetAddress does.
+        GenTree* base = store->Addr();
+        while (true)
+        {
+            if (base->OperIs(GT_LEA) && base->AsAddrMode()->HasBase())
+            {
+                base = base->AsAddrMode()->Base();
+            }
+            else if (base->OperIs(GT_ADD) && base->gtGetOp1()->TypeIs(TYP_REF, TYP_BYREF) &&
+                     !base->gtGetOp2()->TypeIs(TYP_REF, TYP_BYREF))
+            {
+                base = base->gtGetOp1();
+            }
+            else if (base->OperIs(GT_ADD) && base->gtGetOp2()->TypeIs(TYP_REF, TYP_BYREF) &&
+                     !base->gtGetOp1()->TypeIs(TYP_REF, TYP_BYREF))
+            {
+                base = base->gtGetOp2();
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (base->OperIs(GT_LCL_VAR) && base->TypeIs(TYP_REF) && isYoungLocal(base->AsLclVar()->GetLclNum()))
+        {
+            JITDUMP("Store [%06u] targets V%02u which is still in gen0, removing its write barrier\n",
+                    Compiler::dspTreeID(store), base->AsLclVar()->GetLclNum());
+            store->gtFlags |= GTF_IND_TGT_YOUNG;
+            comp->Metrics.YoungTargetBarriersElided++;
+        }
+    }
+}
+
 /** Verifies if both of these trees represent the same indirection.
  * Used by Lower to annotate if CodeGen generate an instruction of the
  * form *addrMode BinOp= expr
@@ -26,6 +26,13 @@ LSRA_STAT_DEF(STAT_RESOLUTION_MOV,       "ResolutionMovs")
 // Number of critical edges from this block that are split.
 LSRA_STAT_DEF(STAT_SPLIT_EDGE,           "SplitEdges")
 
+// Number of local var intervals steered towards callee-saved registers by a call in this block.
+LSRA_STAT_DEF(STAT_CALLEE_SAVE_PREF,     "CalleeSavePrefs")
+
+// Number of local var intervals left to be split (spilled and reloaded) around a cold call in this
+// block instead of being steered towards callee-saved registers.
+LSRA_STAT_DEF(STAT_COLD_CALL_SPLIT,      "ColdCallSplits")
+
 #endif // TRACK_LSRA_STATS
 
 // clang-format on
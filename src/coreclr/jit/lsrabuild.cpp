@@ -1159,14 +1159,18 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
     {
         addKillForRegs(killMask, currentLoc);
 
-        // TODO-CQ: It appears to be valuable for both fp and int registers to avoid killing the callee
-        // save regs on infrequently executed paths.  However, it results in a large number of asmDiffs,
-        // many of which appear to be regressions (because there is more spill on the infrequently path),
-        // but are not really because the frequent path becomes smaller.  Validating these diffs will need
-        // to be done before making this change.
+        const bool isCallKill = ((killMask.getLow() == RBM_INT_CALLEE_TRASH) || (killMask == RBM_CALLEE_TRASH));
+
+        // Keeping a value live across a call in a callee-saved register costs a save and restore in the
+        // prolog and epilog, while splitting its interval at the call costs a spill before the call and
+        // a reload (into any free register) after it. When the call is in a block that runs less often
+        // than the method entry, the split is the cheaper of the two, so this call doesn't steer the live
+        // intervals towards callee-saved registers. Calls on more frequent paths still do.
         // Also note that we avoid setting callee-save preferences for floating point. This may need
         // revisiting, and note that it doesn't currently apply to SIMD types, only float or double.
-        // if (!blockSequence[curBBSeqNum]->isRunRarely())
+        const bool splitAtCall = isCallKill && (JitConfig.JitLsraSplitAtColdCalls() != 0) &&
+                                 (blockInfo[curBBNum].weight < compiler->fgFirstBB->getBBWeight(compiler));
+
         if (enregisterLocalVars)
         {
             VarSetOps::Iter iter(compiler, currentLiveVars);
@@ -1189,13 +1193,19 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
                     {
                         continue;
                     }
-                Interval*  interval   = getIntervalForLocalVar(varIndex);
-                const bool isCallKill = ((killMask.getLow() == RBM_INT_CALLEE_TRASH) || (killMask == RBM_CALLEE_TRASH));
+                Interval*        interval     = getIntervalForLocalVar(varIndex);
                 SingleTypeRegSet regsKillMask = killMask.GetRegSetForType(interval->registerType);
 
                 if (isCallKill)
                 {
+                    if (splitAtCall)
+                    {
+                        INTRACK_STATS(updateLsraStat(STAT_COLD_CALL_SPLIT, curBBNum));
+                        continue;
+                    }
+
                     interval->preferCalleeSave = true;
+                    INTRACK_STATS(updateLsraStat(STAT_CALLEE_SAVE_PREF, curBBNum));
                 }
 
                 // We are more conservative about allocating callee-saves registers to write-thru vars, since
@@ -54,6 +54,10 @@ ObjectAllocator::ObjectAllocator(Compiler* comp)
     , m_numPseudos(0)
     , m_maxPseudos(0)
     , m_regionsToClone(0)
+    , m_enablePartialEscape(false)
+    , m_ColdEscapes(nullptr)
+    , m_ColdBlockLocals(comp->getAllocator(CMK_ObjectAllocator))
+    , m_LocalDefs(nullptr)
     , m_trackFields(false)
     , m_StoreAddressToIndexMap(comp->getAllocator(CMK_ObjectAllocator))
 {
@@ -236,6 +240,7 @@ PhaseStatus ObjectAllocator::DoPhase()
     if (didStackAllocate)
     {
         assert(enabled);
+        MaterializeColdEscapes();
         ComputeStackObjectPointers(&m_bitVecTraits);
         RewriteUses();
     }
@@ -460,6 +465,25 @@ void ObjectAllocator::PrepareAnalysis()
         }
     }
 
+    // Partial escape analysis lets objects that only escape in blocks that
+    // throw out of the method be stack allocated, by copying them to the heap
+    // in those blocks. Like conditional escape analysis, it needs dominance,
+    // so disable it with OSR. It also relies on the flow graph not changing
+    // after analysis, so do not combine it with cloning for conditional escapes.
+    //
+    if ((JitConfig.JitObjectStackAllocationPartialEscape() > 0) && !comp->opts.IsOSR() && !CanHavePseudos())
+    {
+#ifdef DEBUG
+        static ConfigMethodRange JitObjectStackAllocationPartialEscapeRange;
+        JitObjectStackAllocationPartialEscapeRange.EnsureInit(JitConfig.JitObjectStackAllocationPartialEscapeRange());
+        const unsigned hash   = comp->info.compMethodHash();
+        m_enablePartialEscape = JitObjectStackAllocationPartialEscapeRange.Contains(hash);
+#else
+        m_enablePartialEscape = true;
+#endif
+        JITDUMP("Partial escape analysis is %s\n", m_enablePartialEscape ? "enabled" : "disabled by range config");
+    }
+
 #ifdef DEBUG
     if (m_trackFields)
     {
@@ -551,21 +575,29 @@ void ObjectAllocator::DoAnalysis()
         m_EscapingPointers         = BitVecOps::MakeEmpty(&m_bitVecTraits);
         m_ConnGraphAdjacencyMatrix = new (comp->getAllocator(CMK_ObjectAllocator)) BitSetShortLongRep[m_bvCount];
 
-        // If we are doing conditional escape analysis, we also need to compute dominance.
+        // If we are doing conditional or partial escape analysis, we also need to compute dominance.
         //
-        if (CanHavePseudos())
+        if (CanHavePseudos() || m_enablePartialEscape)
         {
             assert(comp->m_dfsTree != nullptr);
             assert(comp->m_domTree == nullptr);
             comp->m_domTree = FlowGraphDominatorTree::Build(comp->m_dfsTree);
         }
 
+        if (m_enablePartialEscape)
+        {
+            CompAllocator alloc(comp->getAllocator(CMK_ObjectAllocator));
+            m_ColdEscapes = new (alloc) jitstd::vector<ColdEscapeInfo>(alloc);
+            m_LocalDefs   = new (alloc) LocalDefInfo[m_bvCount];
+        }
+
         for (unsigned int i = 0; i < m_bvCount; i++)
         {
             m_ConnGraphAdjacencyMatrix[i] = BitVecOps::MakeEmpty(&m_bitVecTraits);
         }
 
         MarkEscapingVarsAndBuildConnGraph();
+        AnalyzeColdEscapes();
         ComputeEscapingNodes(&m_bitVecTraits, m_EscapingPointers);
     }
 
@@ -656,6 +688,10 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
 
             const unsigned lclIndex = m_allocator->LocalToIndex(lclNum);
 
+            // Note appearances in cold blocks for partial escape analysis.
+            //
+            m_allocator->RecordColdBlockAppearance(lclIndex, m_block);
+
             // If this local already escapes, no need to look further.
             //
             if (m_allocator->CanIndexEscape(lclIndex))
@@ -709,6 +745,12 @@ void ObjectAllocator::MarkEscapingVarsAndBuildConnGraph()
             {
                 GenTreeLclVarCommon* const lclTree = tree->AsLclVarCommon();
                 unsigned const             lclNum  = lclTree->GetLclNum();
+
+                if (m_allocator->IsTrackedLocal(lclNum))
+                {
+                    m_allocator->RecordLocalDef(lclTree, m_stmt, m_block);
+                }
+
                 if (m_allocator->IsTrackedLocal(lclNum) && !m_allocator->CanLclVarEscape(lclNum))
                 {
                     // See if we connected it to a source.
@@ -1560,13 +1602,19 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
     }
 #endif
 
-    const bool morphArgs  = false;
-    GenTree*   helperCall = comp->fgMorphIntoHelperCall(allocObj, allocObj->gtNewHelper, morphArgs, arg);
+    const bool alwaysYoung = IsAllocationAlwaysYoung(allocObj);
+    const bool morphArgs   = false;
+    GenTree*   helperCall  = comp->fgMorphIntoHelperCall(allocObj, allocObj->gtNewHelper, morphArgs, arg);
     if (helperHasSideEffects)
     {
         helperCall->AsCall()->gtCallMoreFlags |= GTF_CALL_M_ALLOC_SIDE_EFFECTS;
     }
 
+    if (alwaysYoung)
+    {
+        helperCall->AsCall()->gtCallMoreFlags |= GTF_CALL_M_ALLOC_YOUNG;
+    }
+
 #ifdef FEATURE_READYTORUN
     if (entryPoint.addr != nullptr)
     {
@@ -1583,6 +1631,72 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
     return helperCall;
 }
 
+//------------------------------------------------------------------------
+// IsAllocationAlwaysYoung: Check whether a heap allocation always returns
+//    an object in gen0.
+//
+// Arguments:
+//    allocObj - GT_ALLOCOBJ node that is about to be morphed into a helper call
+//
+// Return Value:
+//    true if the object comes from the small object allocator, and so stays
+//    in gen0 until the next GC.
+//
+// Notes:
+//    Lowering uses this to drop the write barrier of stores into the object
+//    that cannot be separated from the allocation by a GC (see
+//    Lowering::MarkYoungTargetStores).
+//
+bool ObjectAllocator::IsAllocationAlwaysYoung(GenTreeAllocObj* allocObj)
+{
+    switch (allocObj->gtNewHelper)
+    {
+        case CORINFO_HELP_NEWSFAST:
+        case CORINFO_HELP_NEWSFAST_FINALIZE:
+        case CORINFO_HELP_NEWSFAST_ALIGN8:
+        case CORINFO_HELP_NEWSFAST_ALIGN8_VC:
+        case CORINFO_HELP_NEWSFAST_ALIGN8_FINALIZE:
+#ifdef FEATURE_READYTORUN
+        case CORINFO_HELP_READYTORUN_NEW:
+#endif
+            break;
+
+        default:
+            return false;
+    }
+
+    if (!comp->IsAot())
+    {
+        // The runtime only hands out the NEWSFAST helpers for objects below the
+        // large object threshold.
+        return true;
+    }
+
+    if (!comp->IsNativeAot())
+    {
+        // ReadyToRun code must not depend on the size of the class, which can
+        // change when the code is used with a newer version of its assembly.
+        return false;
+    }
+
+    // NativeAOT uses the same allocators for objects of any size, so check
+    // that this one stays out of the large object heap.
+    const unsigned             largeObjectHeapThreshold = 85000;
+    CORINFO_CLASS_HANDLE const clsHnd                   = allocObj->gtAllocObjClsHnd;
+    unsigned                   size;
+
+    if (comp->info.compCompHnd->isValueClass(clsHnd))
+    {
+        size = comp->info.compCompHnd->getClassSize(clsHnd) + 2 * TARGET_POINTER_SIZE;
+    }
+    else
+    {
+        size = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+    }
+
+    return size < largeObjectHeapThreshold;
+}
+
 //------------------------------------------------------------------------
 // MorphNewArrNodeIntoStackAlloc: Morph a newarray helper call node into stack allocation.
 //
@@ -2162,10 +2276,8 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
                 // We have it this way because we currently don't expect to see other escaping references on failed
                 // GDV paths, though perhaps with multi-guess GDV that might change?
                 //
-                // In particular it might be tempting to look for references in uncatchable BBJ_THROWs or similar
-                // and enable a kind of "partial escape analysis" where we copy from stack to heap just before the
-                // point of escape. We would have to add pseudos for this like we do for GDV, but we wouldn't
-                // necessarily need to do the predicate analysis or cloning.
+                // Escapes in uncatchable BBJ_THROWs are handled by partial escape analysis below, where we
+                // copy from stack to heap at the start of the throwing block.
                 //
                 if (isEnumeratorLocal)
                 {
@@ -2182,6 +2294,16 @@ void ObjectAllocator::AnalyzeParentStack(ArrayStack<GenTree*>* parentStack, unsi
 
     if (canLclVarEscapeViaParentStack && !CanIndexEscape(lclIndex))
     {
+        // If this is an escape out of a block that leaves the method via an exception,
+        // we may be able to copy the object to the heap instead. Decide after the
+        // connection graph is built.
+        //
+        if (lclDsc->TypeIs(TYP_REF) && !isAddress && IsColdEscapeBlock(block))
+        {
+            RecordColdEscape(lclNum, block);
+            return;
+        }
+
         JITDUMPEXEC(DumpIndex(lclIndex));
         JITDUMP(" first escapes via [%06u]...[%06u]\n", comp->dspTreeID(parentStack->Top()),
                 comp->dspTreeID(parentStack->Top(parentIndex)));
@@ -4569,6 +4691,433 @@ void ObjectAllocator::CloneAndSpecialize()
     assert(numberOfClonedRegions == m_regionsToClone);
 }
 
+//------------------------------------------------------------------------------
+// IsColdEscapeBlock: can an object that escapes in this block instead be
+//   copied to the heap just before it escapes?
+//
+// Arguments:
+//   block -- block in question
+//
+// Returns:
+//   true if partial escape analysis is enabled and control cannot return
+//   to the method from this block.
+//
+// Notes:
+//   Once such a block is entered the method will exit via an exception, so
+//   no code that can observe the stack allocated object runs after it. It is
+//   thus safe for the block to use a heap copy of the object instead.
+//
+bool ObjectAllocator::IsColdEscapeBlock(BasicBlock* block)
+{
+    return m_enablePartialEscape && block->KindIs(BBJ_THROW) && !block->hasTryIndex() && !block->hasHndIndex();
+}
+
+//------------------------------------------------------------------------------
+// RecordColdEscape: note that a local escapes in a cold block
+//
+// Arguments:
+//   lclNum -- escaping local
+//   block  -- cold block where it escapes
+//
+void ObjectAllocator::RecordColdEscape(unsigned lclNum, BasicBlock* block)
+{
+    assert(IsColdEscapeBlock(block));
+
+    for (ColdEscapeInfo& info : *m_ColdEscapes)
+    {
+        if ((info.m_local == lclNum) && (info.m_block == block))
+        {
+            return;
+        }
+    }
+
+    JITDUMP("V%02u escapes in cold " FMT_BB ", deferring\n", lclNum, block->bbNum);
+    m_ColdEscapes->push_back(ColdEscapeInfo(lclNum, block));
+}
+
+//------------------------------------------------------------------------------
+// RecordColdBlockAppearance: note that a local appears in a cold block
+//
+// Arguments:
+//   lclIndex -- bv index of the local
+//   block    -- block with the appearance
+//
+void ObjectAllocator::RecordColdBlockAppearance(unsigned lclIndex, BasicBlock* block)
+{
+    if (!IsColdEscapeBlock(block))
+    {
+        return;
+    }
+
+    BitVec locals = BitVecOps::UninitVal();
+    if (!m_ColdBlockLocals.Lookup(block, &locals))
+    {
+        locals = BitVecOps::MakeEmpty(&m_bitVecTraits);
+    }
+
+    BitVecOps::AddElemD(&m_bitVecTraits, locals, lclIndex);
+    m_ColdBlockLocals.Set(block, locals, BlockToLocalSetMap::Overwrite);
+}
+
+//------------------------------------------------------------------------------
+// RecordLocalDef: note a definition of a tracked local
+//
+// Arguments:
+//   store -- the local store
+//   stmt  -- statement containing the store
+//   block -- block containing the statement
+//
+void ObjectAllocator::RecordLocalDef(GenTreeLclVarCommon* store, Statement* stmt, BasicBlock* block)
+{
+    if (m_LocalDefs == nullptr)
+    {
+        return;
+    }
+
+    LocalDefInfo& info = m_LocalDefs[LocalToIndex(store->GetLclNum())];
+    info.m_count++;
+    info.m_stmt  = stmt;
+    info.m_block = block;
+
+    // Partial definitions do not tell us what the local refers to.
+    //
+    info.m_store = store->OperIs(GT_STORE_LCL_VAR) ? store : nullptr;
+}
+
+//------------------------------------------------------------------------------
+// CanIndexReach: see if a resource may point to the objects another one
+//   points to.
+//
+// Arguments:
+//   fromIndex -- bv index of the pointing resource
+//   toIndex   -- bv index of the resource being pointed to
+//
+// Returns:
+//   true if there is a path from fromIndex to toIndex in the connection graph.
+//
+bool ObjectAllocator::CanIndexReach(unsigned fromIndex, unsigned toIndex)
+{
+    BitVec               visited = BitVecOps::MakeSingleton(&m_bitVecTraits, fromIndex);
+    ArrayStack<unsigned> worklist(comp->getAllocator(CMK_ObjectAllocator));
+    worklist.Push(fromIndex);
+
+    while (!worklist.Empty())
+    {
+        unsigned const index = worklist.Pop();
+
+        if (index == toIndex)
+        {
+            return true;
+        }
+
+        BitVecOps::Iter iterator(&m_bitVecTraits, m_ConnGraphAdjacencyMatrix[index]);
+        unsigned        nextIndex;
+        while (iterator.NextElem(&nextIndex))
+        {
+            if (BitVecOps::TryAddElemD(&m_bitVecTraits, visited, nextIndex))
+            {
+                worklist.Push(nextIndex);
+            }
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// CanMaterializeColdEscape: see if we can copy the object referred to by a
+//   local that escapes in a cold block to the heap at the start of that block.
+//
+// Arguments:
+//   info -- [in/out] cold escape info; on success the allocation is filled in
+//
+// Returns:
+//   true if so.
+//
+// Notes:
+//   We require that the local always refers to one particular allocation
+//   when the block is entered, i.e. it is defined once, and that definition
+//   (or a chain of single definition copies) leads to the allocation, with
+//   each definition happening before the next. We also require that no other
+//   local that may refer to the same allocation appears in the block, so all
+//   appearances of the object in the block can be switched to the heap copy.
+//
+bool ObjectAllocator::CanMaterializeColdEscape(ColdEscapeInfo* info)
+{
+    BasicBlock* const coldBlock = info->m_block;
+    LclVarDsc* const  lclDsc    = comp->lvaGetDesc(info->m_local);
+
+    if (!lclDsc->TypeIs(TYP_REF) || lclDsc->lvIsParam || lclDsc->lvIsOSRLocal || lclDsc->lvIsEnumerator)
+    {
+        JITDUMP("V%02u: not a candidate local\n", info->m_local);
+        return false;
+    }
+
+    unsigned    lclNum   = info->m_local;
+    BasicBlock* useBlock = coldBlock;
+    Statement*  useStmt  = nullptr;
+
+    // Follow copies back to the allocation. Typically there is just one, from
+    // the allocation temp to the IL local.
+    //
+    const unsigned maxChainLength = 4;
+    for (unsigned i = 0; i < maxChainLength; i++)
+    {
+        LocalDefInfo& def = m_LocalDefs[LocalToIndex(lclNum)];
+
+        if ((def.m_count != 1) || (def.m_store == nullptr))
+        {
+            JITDUMP("V%02u: V%02u has %u defs\n", info->m_local, lclNum, def.m_count);
+            return false;
+        }
+
+        if (def.m_block == useBlock)
+        {
+            // The use must be in a later statement.
+            //
+            Statement* stmt = def.m_stmt->GetNextStmt();
+            while ((useStmt != nullptr) && (stmt != nullptr) && (stmt != useStmt))
+            {
+                stmt = stmt->GetNextStmt();
+            }
+
+            if ((useStmt == nullptr) || (stmt == nullptr))
+            {
+                JITDUMP("V%02u: def of V%02u does not precede its use\n", info->m_local, lclNum);
+                return false;
+            }
+        }
+        else if (!comp->m_domTree->Dominates(def.m_block, useBlock))
+        {
+            JITDUMP("V%02u: def of V%02u does not dominate its use\n", info->m_local, lclNum);
+            return false;
+        }
+
+        GenTree* const data = def.m_store->Data();
+
+        if (data->OperIs(GT_ALLOCOBJ))
+        {
+            CORINFO_CLASS_HANDLE const clsHnd = data->AsAllocObj()->gtAllocObjClsHnd;
+
+            if ((AllocationKind(data) != OAT_NEWOBJ) || comp->info.compCompHnd->isValueClass(clsHnd) ||
+                ((data->gtFlags & GTF_ALLOCOBJ_EMPTY_STATIC) != 0))
+            {
+                JITDUMP("V%02u: unsupported allocation [%06u]\n", info->m_local, comp->dspTreeID(data));
+                return false;
+            }
+
+            info->m_allocLocal = lclNum;
+            break;
+        }
+
+        if (!data->OperIs(GT_LCL_VAR) || !IsTrackedLocal(data->AsLclVar()->GetLclNum()))
+        {
+            JITDUMP("V%02u: def of V%02u is not a copy or allocation\n", info->m_local, lclNum);
+            return false;
+        }
+
+        lclNum   = data->AsLclVar()->GetLclNum();
+        useBlock = def.m_block;
+        useStmt  = def.m_stmt;
+    }
+
+    if (info->m_allocLocal == BAD_VAR_NUM)
+    {
+        JITDUMP("V%02u: no allocation found\n", info->m_local);
+        return false;
+    }
+
+    unsigned const allocIndex  = LocalToIndex(info->m_allocLocal);
+    unsigned const lclIndex    = LocalToIndex(info->m_local);
+    BitVec         blockLocals = BitVecOps::UninitVal();
+
+    if (m_ColdBlockLocals.Lookup(coldBlock, &blockLocals))
+    {
+        BitVecOps::Iter iterator(&m_bitVecTraits, blockLocals);
+        unsigned        index;
+        while (iterator.NextElem(&index))
+        {
+            if ((index != lclIndex) && CanIndexReach(index, allocIndex))
+            {
+                JITDUMP("V%02u: ", info->m_local);
+                JITDUMPEXEC(DumpIndex(index));
+                JITDUMP(" may also refer to V%02u in " FMT_BB "\n", info->m_allocLocal, coldBlock->bbNum);
+                info->m_allocLocal = BAD_VAR_NUM;
+                return false;
+            }
+        }
+    }
+
+    GenTree* const allocTree = m_LocalDefs[allocIndex].m_store->Data();
+    info->m_allocTree        = comp->gtCloneExpr(allocTree);
+
+    if (info->m_allocTree == nullptr)
+    {
+        JITDUMP("V%02u: cannot clone allocation [%06u]\n", info->m_local, comp->dspTreeID(allocTree));
+        info->m_allocLocal = BAD_VAR_NUM;
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// AnalyzeColdEscapes: decide which of the escapes deferred during the
+//   connection graph build can be handled by copying to the heap.
+//
+// Notes:
+//   Escapes that cannot be handled are marked as escaping now, before we
+//   compute the escape closure. For the ones that can, anything the object
+//   refers to will be reachable from the heap copy and so must escape.
+//
+void ObjectAllocator::AnalyzeColdEscapes()
+{
+    if ((m_ColdEscapes == nullptr) || m_ColdEscapes->empty())
+    {
+        return;
+    }
+
+    JITDUMP("\nAnalyzing %u cold escapes\n", (unsigned)m_ColdEscapes->size());
+
+    for (ColdEscapeInfo& info : *m_ColdEscapes)
+    {
+        unsigned const lclIndex = LocalToIndex(info.m_local);
+
+        if (CanIndexEscape(lclIndex))
+        {
+            JITDUMP("V%02u escapes elsewhere\n", info.m_local);
+            continue;
+        }
+
+        if (!CanMaterializeColdEscape(&info))
+        {
+            JITDUMP("V%02u escapes in " FMT_BB "\n", info.m_local, info.m_block->bbNum);
+            MarkIndexAsEscaping(lclIndex);
+            continue;
+        }
+
+        JITDUMP("V%02u escapes only in cold " FMT_BB "; V%02u will be copied to the heap there\n", info.m_local,
+                info.m_block->bbNum, info.m_allocLocal);
+
+        BitVecOps::Iter iterator(&m_bitVecTraits, m_ConnGraphAdjacencyMatrix[LocalToIndex(info.m_allocLocal)]);
+        unsigned        index;
+        while (iterator.NextElem(&index))
+        {
+            MarkIndexAsEscaping(index);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// MaterializeColdEscapes: copy stack allocated objects to the heap in the
+//   cold blocks where they escape.
+//
+// Returns:
+//   true if any object was copied.
+//
+// Notes:
+//   Runs after allocations have been morphed, but before uses are rewritten.
+//   At the start of the cold block we allocate a heap object of the same
+//   class, copy the stack object into it, and switch all appearances of the
+//   escaping local in the block to the heap object.
+//
+bool ObjectAllocator::MaterializeColdEscapes()
+{
+    if (m_ColdEscapes == nullptr)
+    {
+        return false;
+    }
+
+    class ReplaceLocalVisitor final : public GenTreeVisitor<ReplaceLocalVisitor>
+    {
+        unsigned m_fromLclNum;
+        unsigned m_toLclNum;
+
+    public:
+        enum
+        {
+            DoPreOrder    = true,
+            DoLclVarsOnly = true,
+        };
+
+        ReplaceLocalVisitor(Compiler* comp, unsigned fromLclNum, unsigned toLclNum)
+            : GenTreeVisitor<ReplaceLocalVisitor>(comp)
+            , m_fromLclNum(fromLclNum)
+            , m_toLclNum(toLclNum)
+        {
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTreeLclVarCommon* const lcl = (*use)->AsLclVarCommon();
+
+            if (lcl->OperIs(GT_LCL_VAR) && (lcl->GetLclNum() == m_fromLclNum))
+            {
+                lcl->SetLclNum(m_toLclNum);
+            }
+
+            return Compiler::fgWalkResult::WALK_CONTINUE;
+        }
+    };
+
+    bool materialized = false;
+
+    for (ColdEscapeInfo& info : *m_ColdEscapes)
+    {
+        unsigned stackLclNum = BAD_VAR_NUM;
+
+        if ((info.m_allocLocal == BAD_VAR_NUM) ||
+            !m_HeapLocalToStackObjLocalMap.TryGetValue(info.m_allocLocal, &stackLclNum))
+        {
+            continue;
+        }
+
+        BasicBlock* const          block    = info.m_block;
+        GenTreeAllocObj* const     allocObj = info.m_allocTree->AsAllocObj();
+        CORINFO_CLASS_HANDLE const clsHnd   = allocObj->gtAllocObjClsHnd;
+        ClassLayout* const         layout   = comp->lvaGetDesc(stackLclNum)->GetLayout();
+
+        unsigned const heapLclNum = comp->lvaGrabTemp(/* shortLifetime */ false DEBUGARG("heap copy of stack object"));
+        LclVarDsc* const heapLclDsc = comp->lvaGetDesc(heapLclNum);
+        heapLclDsc->lvType          = TYP_REF;
+        heapLclDsc->lvSingleDef     = 1;
+        comp->lvaSetClass(heapLclNum, clsHnd, /* isExact */ true);
+
+        JITDUMP("Copying stack allocated V%02u (V%02u) to heap V%02u in " FMT_BB "\n", stackLclNum, info.m_local,
+                heapLclNum, block->bbNum);
+
+        //------------------------------------------------------------------------
+        //   * STORE_LCL_VAR   ref    heapLcl
+        //   \--*  CALL help  ref
+        //
+        //   * STORE_BLK       struct
+        //   +--*  LCL_VAR     ref    heapLcl
+        //   \--*  LCL_VAR     struct stackLcl
+        //------------------------------------------------------------------------
+
+        GenTree* const   alloc     = MorphAllocObjNodeIntoHelperCall(allocObj);
+        Statement* const allocStmt = comp->gtNewStmt(comp->gtNewStoreLclVarNode(heapLclNum, alloc));
+        GenTree* const   copy      = comp->gtNewStoreBlkNode(layout, comp->gtNewLclvNode(heapLclNum, TYP_REF),
+                                                             comp->gtNewLclvNode(stackLclNum, TYP_STRUCT),
+                                                             GTF_IND_NONFAULTING | GTF_IND_TGT_HEAP);
+        Statement* const copyStmt  = comp->gtNewStmt(copy);
+
+        for (Statement* const stmt : block->Statements())
+        {
+            ReplaceLocalVisitor visitor(comp, info.m_local, heapLclNum);
+            visitor.WalkTree(stmt->GetRootNodePointer(), nullptr);
+        }
+
+        comp->fgInsertStmtAtBeg(block, copyStmt);
+        comp->fgInsertStmtAtBeg(block, allocStmt);
+
+        comp->Metrics.StackAllocatedObjectsCopiedToHeap++;
+        materialized = true;
+    }
+
+    return materialized;
+}
+
 //------------------------------------------------------------------------------
 // GetBoxedLayout: get a layout for a boxed version of a struct
 //
@@ -119,8 +119,41 @@ struct StoreInfo
     bool     m_connected;
 };
 
+// Describes the definitions of a tracked local
+//
+struct LocalDefInfo
+{
+    unsigned             m_count = 0;
+    GenTreeLclVarCommon* m_store = nullptr;
+    Statement*           m_stmt  = nullptr;
+    BasicBlock*          m_block = nullptr;
+};
+
+// Describes a local that escapes only in a cold block (one that throws
+// out of the method), where we can copy the object it refers to from
+// the stack to the heap.
+//
+struct ColdEscapeInfo
+{
+    ColdEscapeInfo(unsigned lclNum, BasicBlock* block)
+        : m_local(lclNum)
+        , m_block(block)
+    {
+    }
+
+    // The escaping local, and the block where it escapes
+    unsigned    m_local;
+    BasicBlock* m_block;
+
+    // The local that holds the allocation, and a copy of the allocation
+    // to use when creating the heap object
+    unsigned m_allocLocal = BAD_VAR_NUM;
+    GenTree* m_allocTree  = nullptr;
+};
+
 typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, CloneInfo*> CloneMap;
 typedef JitHashTable<GenTree*, JitPtrKeyFuncs<GenTree>, StoreInfo>              NodeToIndexMap;
+typedef JitHashTable<BasicBlock*, JitPtrKeyFuncs<BasicBlock>, BitVec>           BlockToLocalSetMap;
 
 class ObjectAllocator final : public Phase
 {
@@ -185,6 +218,12 @@ class ObjectAllocator final : public Phase
     unsigned        m_maxPseudos;
     unsigned        m_regionsToClone;
 
+    // Info for locals that only escape in cold blocks
+    bool                            m_enablePartialEscape;
+    jitstd::vector<ColdEscapeInfo>* m_ColdEscapes;
+    BlockToLocalSetMap              m_ColdBlockLocals;
+    LocalDefInfo*                   m_LocalDefs;
+
     // Struct fields
     bool           m_trackFields;
     NodeToIndexMap m_StoreAddressToIndexMap;
@@ -239,6 +278,7 @@ private:
     bool         MorphAllocObjNodeHelperObj(AllocationCandidate& candidate);
     void         RewriteUses();
     GenTree*     MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
+    bool         IsAllocationAlwaysYoung(GenTreeAllocObj* allocObj);
     unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj,
                                                  ClassLayout*     layout,
                                                  BasicBlock*      block,
@@ -279,6 +319,17 @@ private:
     void CloneAndSpecialize(CloneInfo* info);
     void CloneAndSpecialize();
 
+    // Partial escape support
+    //
+    bool IsColdEscapeBlock(BasicBlock* block);
+    void RecordColdEscape(unsigned lclNum, BasicBlock* block);
+    void RecordColdBlockAppearance(unsigned lclIndex, BasicBlock* block);
+    void RecordLocalDef(GenTreeLclVarCommon* store, Statement* stmt, BasicBlock* block);
+    bool CanIndexReach(unsigned fromIndex, unsigned toIndex);
+    bool CanMaterializeColdEscape(ColdEscapeInfo* info);
+    void AnalyzeColdEscapes();
+    bool MaterializeColdEscapes();
+
     static const unsigned int s_StackAllocMaxSize = 0x2000U;
 
     ClassLayout* GetBoxedLayout(ClassLayout* structLayout);
@@ -1150,7 +1150,8 @@ bool Compiler::optComputeLoopRep(int        constInit,
 // Loops must be of the form:
 //   for (i=icon; i<icon; i++) { ... }
 //
-// Loops handled are fully unrolled; there is no partial unrolling.
+// Loops handled are fully unrolled. Hot loops with an unknown trip count can
+// instead be partially unrolled, see optTryPartiallyUnrollLoop.
 //
 // Limitations: only the following loop types are handled:
 // 1. constant initializer, constant bound
@@ -1193,8 +1194,9 @@ PhaseStatus Compiler::optUnrollLoops()
 
     // Look for loop unrolling candidates
 
-    int  unrollCount = 0;
-    bool anyIRchange = false;
+    int  unrollCount        = 0;
+    int  partialUnrollCount = 0;
+    bool anyIRchange        = false;
 
     int passes = 0;
 
@@ -1214,13 +1216,22 @@ PhaseStatus Compiler::optUnrollLoops()
                 continue;
             }
 
-            if (!optTryUnrollLoop(loop, &anyIRchange))
+            if (optTryUnrollLoop(loop, &anyIRchange))
+            {
+                unrollCount++;
+            }
+            else if ((passes == 0) && optTryPartiallyUnrollLoop(loop, &anyIRchange))
+            {
+                // Partial unrolling keeps the original loop around, so it is
+                // only tried on the first pass to avoid unrolling the
+                // remainder loops.
+                partialUnrollCount++;
+            }
+            else
             {
                 continue;
             }
 
-            unrollCount++;
-
             // Mark in all ancestors now that one of their descendant loops was
             // unrolled to indicate that the set of loop blocks changed.
             for (FlowGraphNaturalLoop* ancestor = loop->GetParent(); ancestor != nullptr;
@@ -1230,7 +1241,8 @@ PhaseStatus Compiler::optUnrollLoops()
             }
         }
 
-        if ((unrollCount == 0) || BitVecOps::IsEmpty(&loopTraits, loopsWithUnrolledDescendant) || (passes >= 10))
+        if (((unrollCount + partialUnrollCount) == 0) ||
+            BitVecOps::IsEmpty(&loopTraits, loopsWithUnrolledDescendant) || (passes >= 10))
         {
             break;
         }
@@ -1242,11 +1254,12 @@ PhaseStatus Compiler::optUnrollLoops()
         passes++;
     }
 
-    if (unrollCount > 0)
+    if ((unrollCount + partialUnrollCount) > 0)
     {
         assert(anyIRchange);
 
         Metrics.LoopsUnrolled += unrollCount;
+        Metrics.LoopsPartiallyUnrolled += partialUnrollCount;
 
 #ifdef DEBUG
         if (verbose)
@@ -1645,6 +1658,326 @@ bool Compiler::optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// optTryPartiallyUnrollLoop: Do legality and profitability checks and try to
+// partially unroll a single hot loop whose trip count is not known.
+//
+// Parameters:
+//   loop      - The loop to try unrolling
+//   changedIR - [out] Whether or not the IR was changed. Can be true even if
+//               the function returns false.
+//
+// Returns:
+//   True if the loop was unrolled, in which case the flow graph was changed.
+//
+// Remarks:
+//   Handles innermost loops whose only backedge comes from the block that
+//   increments and tests the IV, i.e. loops of the form
+//
+//     do { <body>; i += c; } while (i < limit);
+//
+//   with c > 0 and an invariant limit. The loop is transformed into
+//
+//     if (i + (F-1)*c < limit)
+//     {
+//       do { <body>; i += c; ... F times ...; } while (i + (F-1)*c < limit);
+//       if (!(i < limit)) goto exit;
+//     }
+//     do { <body>; i += c; } while (i < limit);
+//
+//   where "i + (F-1)*c" is computed in 64 bits so that it cannot overflow, and
+//   the original loop is left in place to run the remaining iterations. The
+//   unroll factor F is picked based on the average trip count implied by the
+//   profile data and on the size of the loop body.
+//
+bool Compiler::optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
+{
+    static const int UNROLL_LIMIT_SZ[COUNT_OPT_CODE + 1] = {
+        150, // BLENDED_CODE
+        0,   // SMALL_CODE
+        300, // FAST_CODE
+        0    // COUNT_OPT_CODE
+    };
+
+    assert(UNROLL_LIMIT_SZ[SMALL_CODE] == 0);
+    assert(UNROLL_LIMIT_SZ[COUNT_OPT_CODE] == 0);
+
+    bool stress = INDEBUG(compStressCompile(STRESS_UNROLL_LOOPS, 50) ||) false;
+
+    if ((JitConfig.JitEnablePartialLoopUnrolling() == 0) && !stress)
+    {
+        return false;
+    }
+
+    if (!fgHaveProfileWeights() && !stress)
+    {
+        return false;
+    }
+
+    if ((loop->GetChild() != nullptr) || loop->GetHeader()->isRunRarely())
+    {
+        return false;
+    }
+
+    BasicBlock* preheader = loop->GetPreheader();
+    if ((preheader == nullptr) || !BasicBlock::sameEHRegion(preheader, loop->GetHeader()))
+    {
+        return false;
+    }
+
+    NaturalLoopIterInfo iterInfo;
+    if (!loop->AnalyzeIteration(&iterInfo))
+    {
+        return false;
+    }
+
+    if (!iterInfo.HasConstLimit && !iterInfo.HasInvariantLocalLimit && !iterInfo.HasArrayLengthLimit)
+    {
+        return false;
+    }
+
+    JITDUMP("Analyzing candidate for partial loop unrolling:\n");
+    DBEXEC(verbose, FlowGraphNaturalLoop::Dump(loop));
+
+    genTreeOps testOper = iterInfo.TestOper();
+    unsigned   lvar     = iterInfo.IterVar;
+    bool       unsTest  = (iterInfo.TestTree->gtFlags & GTF_UNSIGNED) != 0;
+
+    if (!iterInfo.IsIncreasingLoop() || (iterInfo.IterOper() != GT_ADD))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": not an increasing loop with an upper bound\n",
+                loop->GetIndex());
+        return false;
+    }
+
+    if ((iterInfo.IterOperType() != TYP_INT) || !lvaGetDesc(lvar)->TypeIs(TYP_INT) ||
+        !genActualTypeIsInt(iterInfo.Limit()->TypeGet()))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": IV is not an int\n", loop->GetIndex());
+        return false;
+    }
+
+    ArrIndex arrIndex(getAllocator(CMK_LoopUnroll));
+    if (iterInfo.HasArrayLengthLimit && (!iterInfo.ArrLenLimit(this, &arrIndex) || (arrIndex.rank != 0)))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": unsupported array length limit\n", loop->GetIndex());
+        return false;
+    }
+
+    // Each iteration must go through the IV update and the test exactly once,
+    // so that every copy of the body sees the IV advanced by the step.
+    BasicBlock* testBlock = iterInfo.TestBlock;
+    if ((loop->BackEdges().size() != 1) || (loop->BackEdge(0)->getSourceBlock() != testBlock))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": test block is not the only backedge\n", loop->GetIndex());
+        return false;
+    }
+
+    bool incrInTestBlock = false;
+    for (Statement* const stmt : testBlock->Statements())
+    {
+        if (stmt->GetRootNode() == iterInfo.IterTree)
+        {
+            incrInTestBlock = true;
+            break;
+        }
+    }
+
+    if (!incrInTestBlock)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": IV is not updated in the test block\n",
+                loop->GetIndex());
+        return false;
+    }
+
+    assert(testBlock->KindIs(BBJ_COND) && (testBlock->lastStmt()->GetRootNode()->gtGetOp1() == iterInfo.TestTree));
+
+    INDEBUG(const char* reason);
+    if (!loop->CanDuplicate(INDEBUG(&reason)))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": %s\n", loop->GetIndex(), reason);
+        return false;
+    }
+
+    // The trip count is not known, but the profile tells us how many times we
+    // iterate per entry on average. Only unroll if the unrolled loop is
+    // expected to run a few times.
+    weight_t entryWeight  = preheader->bbWeight;
+    weight_t tripEstimate = (entryWeight > BB_ZERO_WEIGHT) ? (loop->GetHeader()->bbWeight / entryWeight) : 0;
+
+    if (stress)
+    {
+        tripEstimate = max(tripEstimate, (weight_t)32);
+    }
+
+    // After this point, assume we've changed the IR. In particular, we call
+    // gtSetStmtInfo() which can modify the IR.
+    *changedIR = true;
+
+    ClrSafeInt<unsigned> loopCostSz; // Cost is size of one iteration
+
+    loop->VisitLoopBlocksReversePostOrder([=, &loopCostSz](BasicBlock* block) {
+        for (Statement* const stmt : block->Statements())
+        {
+            gtSetStmtInfo(stmt);
+            loopCostSz += stmt->GetCostSz();
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    int unrollLimitSz = UNROLL_LIMIT_SZ[compCodeOpt()];
+    if (stress)
+    {
+        unrollLimitSz *= 4;
+    }
+
+    unsigned factor = 0;
+    for (unsigned candidate = 8; candidate >= 2; candidate /= 2)
+    {
+        ClrSafeInt<int> unrollCostSz = ClrSafeInt<int>(loopCostSz * ClrSafeInt<unsigned>(candidate));
+
+        if ((tripEstimate >= 4 * candidate) && !unrollCostSz.IsOverflow() && (unrollCostSz.Value() <= unrollLimitSz))
+        {
+            factor = candidate;
+            break;
+        }
+    }
+
+    if (factor == 0)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": estimated trip count " FMT_WT
+                ", iteration size %u (heuristic)\n",
+                loop->GetIndex(), tripEstimate, loopCostSz.Value());
+        return false;
+    }
+
+    JITDUMP("\nPartially unrolling loop " FMT_LP " by %u, estimated trip count " FMT_WT "\n", loop->GetIndex(), factor,
+            tripEstimate);
+
+    BasicBlock* header   = loop->GetHeader();
+    bool        exitTrue = !loop->ContainsBlock(testBlock->GetTrueTarget());
+    BasicBlock* exit     = exitTrue ? testBlock->GetTrueTarget() : testBlock->GetFalseTarget();
+    int         iterInc  = iterInfo.IterConst();
+    GenTree*    testStmt = testBlock->lastStmt()->GetRootNode();
+
+    // Create "JTRUE(i + (factor - 1) * c OP limit)" in 64 bits.
+    auto newUnrolledTest = [=]() {
+        GenTree* iter   = gtNewCastNode(TYP_LONG, gtNewLclvNode(lvar, TYP_INT), unsTest, TYP_LONG);
+        GenTree* offset = gtNewLconNode((int64_t)(factor - 1) * iterInc);
+        GenTree* limit  = gtNewCastNode(TYP_LONG, gtCloneExpr(iterInfo.Limit()), unsTest, TYP_LONG);
+        GenTree* cond   = gtNewOperNode(testOper, TYP_INT, gtNewOperNode(GT_ADD, TYP_LONG, iter, offset), limit);
+        if (unsTest)
+        {
+            cond->SetUnsigned();
+        }
+
+        return gtNewOperNode(GT_JTRUE, TYP_VOID, cond);
+    };
+
+    BlockToBlockMap blockMap(getAllocator(CMK_LoopUnroll));
+
+    BasicBlock* insertAfter    = loop->GetLexicallyBottomMostBlock();
+    BasicBlock* firstHeader    = nullptr;
+    BasicBlock* prevTestBlock  = nullptr;
+    weight_t    remainderScale = min((weight_t)1, (weight_t)factor / tripEstimate);
+
+    for (unsigned iter = 0; iter < factor; iter++)
+    {
+        loop->Duplicate(&insertAfter, &blockMap, 1.0 / factor);
+
+        if (prevTestBlock == nullptr)
+        {
+            firstHeader = blockMap[header];
+        }
+        else
+        {
+            optRedirectPrevUnrollIteration(loop, prevTestBlock, blockMap[header]);
+        }
+
+        prevTestBlock = blockMap[testBlock];
+    }
+
+    // The remainder check: run the original loop for the last few iterations,
+    // if there are any.
+    BasicBlock* remainderCheck = fgNewBBafter(BBJ_COND, insertAfter, /* extendRegion */ true);
+    remainderCheck->inheritWeight(preheader);
+    fgInsertStmtAtEnd(remainderCheck, fgNewStmtFromTree(gtCloneExpr(testStmt)));
+
+    FlowEdge* remainderEdge     = fgAddRefPred(header, remainderCheck);
+    FlowEdge* remainderExitEdge = fgAddRefPred(exit, remainderCheck);
+    remainderCheck->SetCond(exitTrue ? remainderExitEdge : remainderEdge,
+                            exitTrue ? remainderEdge : remainderExitEdge);
+    remainderEdge->setLikelihood((weight_t)(factor - 1) / factor);
+    remainderExitEdge->setLikelihood((weight_t)1 / factor);
+
+    // The last copy tests whether there are enough iterations left for
+    // another round of the unrolled body.
+    Statement* lastTestStmt = prevTestBlock->lastStmt();
+    lastTestStmt->SetRootNode(newUnrolledTest());
+    gtSetStmtInfo(lastTestStmt);
+    fgSetStmtSeq(lastTestStmt);
+
+    fgRemoveRefPred(prevTestBlock->GetTrueEdge());
+    fgRemoveRefPred(prevTestBlock->GetFalseEdge());
+    FlowEdge* backEdge = fgAddRefPred(firstHeader, prevTestBlock);
+    FlowEdge* doneEdge = fgAddRefPred(remainderCheck, prevTestBlock);
+    prevTestBlock->SetCond(backEdge, doneEdge);
+    backEdge->setLikelihood(max((weight_t)0, (weight_t)1 - (weight_t)factor / tripEstimate));
+    doneEdge->setLikelihood((weight_t)1 - backEdge->getLikelihood());
+
+    // Finally, guard entry into the unrolled loop on the same condition.
+    BasicBlock* guard = fgNewBBafter(BBJ_COND, preheader, /* extendRegion */ true);
+    guard->inheritWeight(preheader);
+    fgInsertStmtAtEnd(guard, fgNewStmtFromTree(newUnrolledTest()));
+
+    FlowEdge* enterEdge = fgAddRefPred(firstHeader, guard);
+    FlowEdge* skipEdge  = fgAddRefPred(header, guard);
+    guard->SetCond(enterEdge, skipEdge);
+    enterEdge->setLikelihood(0.9);
+    skipEdge->setLikelihood(0.1);
+
+    // The array length in the guard is evaluated before the first iteration,
+    // so handle a null array by running the original loop.
+    BasicBlock* guardEntry = guard;
+    if (iterInfo.HasArrayLengthLimit)
+    {
+        guardEntry = fgNewBBafter(BBJ_COND, preheader, /* extendRegion */ true);
+        guardEntry->inheritWeight(preheader);
+
+        GenTree* isNull = gtNewOperNode(GT_EQ, TYP_INT, gtNewLclvNode(arrIndex.arrLcl, TYP_REF), gtNewNull());
+        fgInsertStmtAtEnd(guardEntry, fgNewStmtFromTree(gtNewOperNode(GT_JTRUE, TYP_VOID, isNull)));
+
+        FlowEdge* nullEdge    = fgAddRefPred(header, guardEntry);
+        FlowEdge* nonNullEdge = fgAddRefPred(guard, guardEntry);
+        guardEntry->SetCond(nullEdge, nonNullEdge);
+        nullEdge->setLikelihood(0);
+        nonNullEdge->setLikelihood(1);
+    }
+
+    fgReplaceJumpTarget(preheader, header, guardEntry);
+
+    // The original loop now only runs the remaining iterations.
+    loop->VisitLoopBlocks([=](BasicBlock* block) {
+        block->scaleBBWeight(remainderScale);
+        return BasicBlockVisit::Continue;
+    });
+
+    JITDUMP("Partial unrolling of " FMT_LP " made profile data inconsistent. Data %s inconsistent.\n",
+            loop->GetIndex(), fgPgoConsistent ? "is now" : "was already");
+    fgPgoConsistent = false;
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("Partially unrolled loop:\n");
+        fgDumpTrees(guardEntry, insertAfter->Next());
+    }
+#endif // DEBUG
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // optRedirectPrevUnrollIteration:
 //   Redirect the previous unrolled loop iteration (or entry) to a new target.
@@ -36,6 +36,9 @@ public:
     friend class CMiniMdRW;
     friend class MDInternalRO;
 
+    CMiniMd();
+    ~CMiniMd();
+
     __checkReturn
     HRESULT InitOnMem(void *pBuf, ULONG ulBufLen);
     __checkReturn
@@ -74,6 +77,25 @@ protected:
     __checkReturn
     virtual HRESULT vSearchTableNotGreater(ULONG ixTbl, CMiniColDef sColumn, ULONG ulTarget, RID *pRid);
 
+    // A dense copy of one column of a table, decoded to ULONGs. Built on first search
+    //  of a large enough table, so the binary searches do not have to locate the row
+    //  and decode a 2 or 4 byte value on every probe.
+    struct SearchColumnCache
+    {
+        ULONG m_oColumn;        // Offset of the cached column in the record.
+        ULONG m_rgValues[1];    // Column value of row N is at index N-1.
+    };
+    // Tables with fewer rows than this are searched directly.
+    static const ULONG c_cMinRowsForSearchColumnCache = 64;
+    // Number of distinct columns of a table that can be cached (TypeDef is searched by
+    //  both FieldList and MethodList).
+    static const ULONG c_cSearchColumnCacheSlots = 2;
+
+    const SearchColumnCache *GetSearchColumnCache(ULONG ixTbl, CMiniColDef &sColumn);
+    void FreeSearchColumnCaches();
+
+    SearchColumnCache *m_rgpSearchColumnCache[TBL_COUNT][c_cSearchColumnCacheSlots];
+
     // Heaps
     MetaData::StringHeapRO m_StringHeap;
     MetaData::BlobHeapRO   m_BlobHeap;
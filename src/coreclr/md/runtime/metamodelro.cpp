@@ -12,6 +12,16 @@
 #include <posterror.h>
 #include <corerror.h>
 
+CMiniMd::CMiniMd()
+{
+    memset(m_rgpSearchColumnCache, 0, sizeof(m_rgpSearchColumnCache));
+}
+
+CMiniMd::~CMiniMd()
+{
+    FreeSearchColumnCaches();
+}
+
 //*****************************************************************************
 // Set the pointers to consecutive areas of a large buffer.
 //*****************************************************************************
@@ -63,6 +73,9 @@ CMiniMd::InitOnMem(
     ULONG   cbData;
     BYTE   *pBuf = reinterpret_cast<BYTE*>(pvBuf);
 
+    // Any cached columns describe the previous tables.
+    FreeSearchColumnCaches();
+
     // Uncompress the schema from the buffer into our structures.
     IfFailGo(SchemaPopulate(pvBuf, ulBufLen, &cbData));
     _ASSERTE(cbData <= ulBufLen);
@@ -238,6 +251,92 @@ ErrExit:
 } // CMiniMd::CommonEnumCustomAttributeByName
 
 
+//*****************************************************************************
+// Get the decoded copy of a column used by the table searches, building it if
+//  needed.  Returns NULL if the table is too small to bother, all the slots of
+//  the table hold other columns, or the copy could not be built.  The tables are
+//  read-only, so a copy never goes stale; racing builders keep the first one
+//  published.
+//*****************************************************************************
+const CMiniMd::SearchColumnCache *
+CMiniMd::GetSearchColumnCache(
+    ULONG        ixTbl,     // Table to search.
+    CMiniColDef &sColumn)   // Column to cache.
+{
+#ifdef DACCESS_COMPILE
+    // The target's caches can't be used, and the DAC doesn't keep its own.
+    return NULL;
+#else
+    _ASSERTE(ixTbl < TBL_COUNT);
+
+    ULONG cRecs = GetCountRecs(ixTbl);
+    if (cRecs < c_cMinRowsForSearchColumnCache)
+        return NULL;
+
+    SearchColumnCache **rgpSlots = m_rgpSearchColumnCache[ixTbl];
+    ULONG iSlot;
+    for (iSlot = 0; iSlot < c_cSearchColumnCacheSlots; iSlot++)
+    {
+        SearchColumnCache *pCache = rgpSlots[iSlot];
+        if (pCache == NULL)
+            break;
+        if (pCache->m_oColumn == sColumn.m_oColumn)
+            return pCache;
+    }
+    if (iSlot == c_cSearchColumnCacheSlots)
+        return NULL;
+
+    S_SIZE_T cbCache = S_SIZE_T(offsetof(SearchColumnCache, m_rgValues)) + S_SIZE_T(cRecs) * S_SIZE_T(sizeof(ULONG));
+    if (cbCache.IsOverflow())
+        return NULL;
+    NewArrayHolder<BYTE> pBuffer = new (nothrow) BYTE[cbCache.Value()];
+    if (pBuffer == NULL)
+        return NULL;
+
+    SearchColumnCache *pNewCache = reinterpret_cast<SearchColumnCache *>((BYTE *)pBuffer);
+    pNewCache->m_oColumn = sColumn.m_oColumn;
+    for (ULONG rid = 1; rid <= cRecs; rid++)
+    {
+        void *pRow;
+        if (FAILED(getRow(ixTbl, rid, &pRow)))
+            return NULL;
+        pNewCache->m_rgValues[rid - 1] = getIX(pRow, sColumn);
+    }
+
+    // Publish into the first free slot, unless another thread got this column there first.
+    for (; iSlot < c_cSearchColumnCacheSlots; iSlot++)
+    {
+        SearchColumnCache *pCache = InterlockedCompareExchangeT<SearchColumnCache *>(&rgpSlots[iSlot], pNewCache, NULL);
+        if (pCache == NULL)
+        {
+            pBuffer.SuppressRelease();
+            return pNewCache;
+        }
+        if (pCache->m_oColumn == sColumn.m_oColumn)
+            return pCache;
+    }
+    return NULL;
+#endif // DACCESS_COMPILE
+} // CMiniMd::GetSearchColumnCache
+
+//*****************************************************************************
+// Free the decoded column copies.  Only called when no search can be running.
+//*****************************************************************************
+void
+CMiniMd::FreeSearchColumnCaches()
+{
+#ifndef DACCESS_COMPILE
+    for (ULONG ixTbl = 0; ixTbl < TBL_COUNT; ixTbl++)
+    {
+        for (ULONG iSlot = 0; iSlot < c_cSearchColumnCacheSlots; iSlot++)
+        {
+            delete [] reinterpret_cast<BYTE *>(m_rgpSearchColumnCache[ixTbl][iSlot]);
+            m_rgpSearchColumnCache[ixTbl][iSlot] = NULL;
+        }
+    }
+#endif // DACCESS_COMPILE
+} // CMiniMd::FreeSearchColumnCaches
+
 //*****************************************************************************
 // Search a table for the row containing the given key value.
 //  EG. Constant table has pointer back to Param or Field.
@@ -256,6 +355,8 @@ CMiniMd::vSearchTable(
     ULONG   val;            // Value from a row.
     int     lo, mid, hi;    // binary search indices.
 
+    const SearchColumnCache *pCache = GetSearchColumnCache(ixTbl, sColumn);
+
     // Start with entire table.
     lo = 1;
     hi = GetCountRecs(ixTbl);
@@ -263,8 +364,15 @@ CMiniMd::vSearchTable(
     while (lo <= hi)
     {   // Look at the one in the middle.
         mid = (lo + hi) / 2;
-        IfFailRet(getRow(ixTbl, mid, &pRow));
-        val = getIX(pRow, sColumn);
+        if (pCache != NULL)
+        {
+            val = pCache->m_rgValues[mid - 1];
+        }
+        else
+        {
+            IfFailRet(getRow(ixTbl, mid, &pRow));
+            val = getIX(pRow, sColumn);
+        }
         // If equal to the target, done.
         if (val == ulTarget)
         {
@@ -313,6 +421,39 @@ CMiniMd::vSearchTableNotGreater(
         *pRid = 0;
         return S_OK;
     }
+    const SearchColumnCache *pCache = GetSearchColumnCache(ixTbl, sColumn);
+    if (pCache != NULL)
+    {
+        // Same search as below, on the decoded copy of the column.
+        while (lo <= hi)
+        {
+            mid = (lo + hi) / 2;
+            val = pCache->m_rgValues[mid - 1];
+            if (val == ulTarget)
+                break;
+            if (val < ulTarget)
+                lo = mid + 1;
+            else
+                hi = mid - 1;
+        }
+        if (val > ulTarget)
+        {
+            while (val > ulTarget)
+            {
+                if (--mid < 1)
+                    break;
+                val = pCache->m_rgValues[mid - 1];
+            }
+        }
+        else
+        {
+            while ((mid < cRecs) && (pCache->m_rgValues[mid] <= ulTarget))
+                mid++;
+        }
+        *pRid = mid;
+        return S_OK;
+    }
+
     // While there are rows in the range...
     while (lo <= hi)
     {   // Look at the one in the middle.
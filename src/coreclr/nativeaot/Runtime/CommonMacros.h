@@ -326,7 +326,12 @@ enum STARTUP_TIMELINE_EVENT_ID
 
 #ifdef PROFILE_STARTUP
 extern uint64_t g_startupTimelineEvents[NUM_STARTUP_TIMELINE_EVENTS];
-#define STARTUP_TIMELINE_EVENT(eventid) g_startupTimelineEvents[eventid] = (uint64_t)minipal_hires_ticks();
+extern uint64_t g_startupTimelinePageFaults[NUM_STARTUP_TIMELINE_EVENTS];
+uint64_t GetProcessPageFaultCount();
+#define STARTUP_TIMELINE_EVENT(eventid) do { \
+    g_startupTimelineEvents[eventid] = (uint64_t)minipal_hires_ticks(); \
+    g_startupTimelinePageFaults[eventid] = GetProcessPageFaultCount(); \
+} while (0)
 #else // PROFILE_STARTUP
 #define STARTUP_TIMELINE_EVENT(eventid)
 #endif // PROFILE_STARTUP
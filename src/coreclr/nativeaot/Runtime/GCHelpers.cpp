@@ -46,6 +46,70 @@ bool RhInitializeFinalization();
 bool RhWaitForFinalizerThreadStart();
 #endif
 
+// Per-CPU allocation contexts, enabled with the gcPerCpuAllocContexts config value.
+//
+// Every thread that allocated since the last GC holds a partially used allocation quantum, which
+// wastes gen0 budget in apps with thousands of threads that mostly sit idle. In this mode small
+// object allocations are served from an allocation context owned by the current processor instead,
+// so the budget is handed out per core. The threads' own contexts stay empty, which sends all their
+// allocations here through the allocation slow path. A processor context that is busy is never
+// waited for, as its user may be preempted or blocked in a GC. The allocation then falls back to
+// the thread's own context.
+struct PerCpuAllocContext
+{
+    gc_alloc_context    m_context;
+    int32_t             m_lock;
+    // Keep contexts of different processors mostly on different cache lines
+    uint8_t             m_padding[64 - (sizeof(gc_alloc_context) + sizeof(int32_t)) % 64];
+};
+
+static PerCpuAllocContext * g_pPerCpuAllocContexts = NULL;
+static uint32_t g_cPerCpuAllocContexts = 0;
+
+static void InitializePerCpuAllocContexts()
+{
+    if (!GCToOSInterface::CanGetCurrentProcessorNumber())
+        return;
+
+    uint32_t count = GCToOSInterface::GetTotalProcessorCount();
+    PerCpuAllocContext * pContexts = new (nothrow) PerCpuAllocContext[count];
+    if (pContexts == NULL)
+        return;
+
+    memset(pContexts, 0, sizeof(PerCpuAllocContext) * count);
+    g_cPerCpuAllocContexts = count;
+    g_pPerCpuAllocContexts = pContexts;
+}
+
+// Allocates from the context of the current processor. Returns false if the context is in use,
+// in which case the caller has to allocate from the thread's own context.
+static bool TryAllocFromPerCpuAllocContext(size_t cbSize, uint32_t uFlags, Object ** ppObject)
+{
+    uint32_t index = GCToOSInterface::GetCurrentProcessorNumber() % g_cPerCpuAllocContexts;
+    PerCpuAllocContext * pCpuContext = &g_pPerCpuAllocContexts[index];
+
+    if ((VolatileLoad(&pCpuContext->m_lock) != 0) ||
+        (PalInterlockedCompareExchange(&pCpuContext->m_lock, 1, 0) != 0))
+    {
+        return false;
+    }
+
+    // This may trigger a GC while the context is held, which is fine since other threads do not
+    // wait for it and the GC enumerates it with the rest of the allocation contexts.
+    *ppObject = GCHeapUtilities::GetGCHeap()->Alloc(&pCpuContext->m_context, cbSize, uFlags);
+
+    VolatileStore(&pCpuContext->m_lock, 0);
+    return true;
+}
+
+void EnumPerCpuAllocContexts(enum_alloc_context_func * fn, void * param)
+{
+    for (uint32_t i = 0; i < g_cPerCpuAllocContexts; i++)
+    {
+        (*fn) (&g_pPerCpuAllocContexts[i].m_context, param);
+    }
+}
+
 // Perform any runtime-startup initialization needed by the GC, HandleTable or environmental code in gcenv.ee.
 // Returns true on success or false if a subsystem failed to initialize.
 bool InitializeGC()
@@ -84,6 +148,11 @@ bool InitializeGC()
     if (FAILED(hr))
         return false;
 
+    if (g_pRhConfig->GetgcPerCpuAllocContexts())
+    {
+        InitializePerCpuAllocContexts();
+    }
+
     // Initialize HandleTable.
     if (!GCHandleUtilities::GetGCHandleManager()->Initialize())
         return false;
@@ -482,6 +551,12 @@ EXTERN_C int64_t QCALLTYPE RhGetTotalAllocatedBytesPrecise()
     }
     END_FOREACH_THREAD
 
+    for (uint32_t i = 0; i < g_cPerCpuAllocContexts; i++)
+    {
+        gc_alloc_context* ac = &g_pPerCpuAllocContexts[i].m_context;
+        allocated -= ac->alloc_limit - ac->alloc_ptr;
+    }
+
     GCToEEInterface::RestartEE(true);
 
     return allocated;
@@ -613,9 +688,22 @@ static Object* GcAllocInternal(MethodTable* pEEType, uint32_t uFlags, uintptr_t
         }
     }
 
-    Object* pObject = GCHeapUtilities::GetGCHeap()->Alloc(pAllocContext, cbSize, uFlags);
-    if (pObject == NULL)
-        return NULL;
+    Object* pObject;
+    if ((g_pPerCpuAllocContexts != NULL) && !(uFlags & GC_ALLOC_USER_OLD_HEAP) && !isRandomizedSamplingEnabled &&
+        TryAllocFromPerCpuAllocContext(cbSize, uFlags, &pObject))
+    {
+        if (pObject == NULL)
+            return NULL;
+
+        // Keep RhGetAllocatedBytesForCurrentThread accurate
+        pAllocContext->alloc_bytes += cbSize;
+    }
+    else
+    {
+        pObject = GCHeapUtilities::GetGCHeap()->Alloc(pAllocContext, cbSize, uFlags);
+        if (pObject == NULL)
+            return NULL;
+    }
 
     pObject->set_EEType(pEEType);
     if (pEEType->HasComponentSize())
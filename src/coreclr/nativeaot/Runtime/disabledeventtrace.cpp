@@ -19,6 +19,7 @@ bool IsRuntimeProviderEnabled(uint8_t level, uint64_t keyword)
 }
 
 void ETW::GCLog::FireGcStart(ETW_GC_INFO * pGcInfo) { }
+void ETW::GCLog::RecordSuspendDuration(uint64_t durationUSec) { }
 void ETW::LoaderLog::ModuleLoad(HANDLE pModule) { }
 BOOL ETW::GCLog::ShouldTrackMovementForEtw() { return FALSE; }
 void ETW::GCLog::BeginMovedReferences(size_t * pProfilingContext) { }
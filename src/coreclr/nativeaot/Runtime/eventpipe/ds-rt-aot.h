@@ -303,6 +303,29 @@ ds_rt_apply_startup_hook (const ep_char16_t *startup_hook_path)
 	return DS_IPC_E_NOTSUPPORTED;
 }
 
+static
+uint32_t
+ds_rt_get_runtime_metrics (
+	uint64_t *generation_sizes,
+	uint64_t *gc_counts,
+	uint64_t *gc_total_pause_duration,
+	uint64_t *jit_method_count,
+	uint64_t *jit_time,
+	uint64_t *lock_contention_count)
+{
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
+static
+uint32_t
+ds_rt_get_startup_phases (
+	uint64_t *phase_durations,
+	uint32_t max_count,
+	uint32_t *phase_count)
+{
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
 /*
 * DiagnosticServer.
 */
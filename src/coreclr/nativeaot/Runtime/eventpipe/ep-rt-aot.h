@@ -497,6 +497,20 @@ ep_rt_config_value_get_enable_stackwalk (void)
     return false;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_shared_streaming_thread (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    bool value;
+    if (RhConfig::Environment::TryGetBooleanValue("EventPipeSharedStreamingThread", &value))
+        return value;
+
+    return false;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -91,6 +91,59 @@ void ETW::GCLog::FireGcStart(ETW_GC_INFO* pGcInfo)
     }
 }
 
+// Runtime suspension latencies are accumulated into log2 microsecond buckets and published as
+// one GCSuspendEEHistogram event every SUSPEND_HISTOGRAM_BATCH_SIZE suspensions. Bucket 0 counts
+// suspensions shorter than 1 usec, bucket N those in [2^(N-1), 2^N) usec and the last bucket
+// everything longer.
+#define SUSPEND_HISTOGRAM_BUCKETS 16
+#define SUSPEND_HISTOGRAM_BATCH_SIZE 64
+
+static uint32_t s_rgSuspendHistogram[SUSPEND_HISTOGRAM_BUCKETS];
+static uint32_t s_cSuspensions;
+static uint32_t s_maxSuspendUSec;
+static uint64_t s_totalSuspendUSec;
+
+//---------------------------------------------------------------------------------------
+//
+// Adds one runtime suspension to the suspension latency histogram, and fires the
+// GCSuspendEEHistogram event once a batch is complete. Only called by the thread
+// suspending the runtime, so the histogram needs no synchronization.
+//
+// Arguments:
+//      durationUSec - time it took for all threads to reach a safe point
+//
+
+// static
+void ETW::GCLog::RecordSuspendDuration(uint64_t durationUSec)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!RUNTIME_PROVIDER_CATEGORY_ENABLED(TRACE_LEVEL_INFORMATION, CLR_GC_KEYWORD))
+        return;
+
+    uint32_t bucket = 0;
+    while ((bucket < SUSPEND_HISTOGRAM_BUCKETS - 1) && ((durationUSec >> bucket) != 0))
+        bucket++;
+
+    uint32_t durationUSec32 = (durationUSec > UINT32_MAX) ? UINT32_MAX : (uint32_t)durationUSec;
+
+    s_rgSuspendHistogram[bucket]++;
+    s_totalSuspendUSec += durationUSec;
+    if (durationUSec32 > s_maxSuspendUSec)
+        s_maxSuspendUSec = durationUSec32;
+
+    if (++s_cSuspensions < SUSPEND_HISTOGRAM_BATCH_SIZE)
+        return;
+
+    FireEtwGCSuspendEEHistogram(s_cSuspensions, s_maxSuspendUSec, s_totalSuspendUSec,
+        SUSPEND_HISTOGRAM_BUCKETS, s_rgSuspendHistogram, GetClrInstanceId());
+
+    memset(s_rgSuspendHistogram, 0, sizeof(s_rgSuspendHistogram));
+    s_cSuspensions = 0;
+    s_maxSuspendUSec = 0;
+    s_totalSuspendUSec = 0;
+}
+
 void EventTracing_Initialize()
 {
 #ifdef FEATURE_ETW
@@ -175,6 +175,7 @@ namespace ETW
         static HRESULT ForceGCForDiagnostics();
         static void ForceGC(LONGLONG l64ClientSequenceNumber);
         static void FireGcStart(ETW_GC_INFO * pGcInfo);
+        static void RecordSuspendDuration(uint64_t durationUSec);
         static void RootReference(
             LPVOID pvHandle,
             Object * pRootedNode,
@@ -200,6 +201,7 @@ namespace ETW
 
 #ifndef FEATURE_EVENT_TRACE
 inline void ETW::GCLog::FireGcStart(ETW_GC_INFO * pGcInfo) { }
+inline void ETW::GCLog::RecordSuspendDuration(uint64_t durationUSec) { }
 #endif
 
 #endif //_VMEVENTTRACE_H_
@@ -33,6 +33,7 @@ GPTR_IMPL(MethodTable, g_pFreeObjectEEType);
 #ifndef DACCESS_COMPILE
 
 void RhEnableFinalization();
+void EnumPerCpuAllocContexts(enum_alloc_context_func* fn, void* param);
 
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
@@ -149,6 +150,8 @@ void GCToEEInterface::GcEnumAllocContexts(enum_alloc_context_func* fn, void* par
         }
     }
     END_FOREACH_THREAD
+
+    EnumPerCpuAllocContexts(fn, param);
 }
 
 // EE can perform post stack scanning action, while the user threads are still suspended
@@ -30,10 +30,38 @@
 #include "EventPipeInterface.h"
 #endif
 
+#ifdef PROFILE_STARTUP
+#ifdef HOST_WINDOWS
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+#endif // PROFILE_STARTUP
+
 #ifndef DACCESS_COMPILE
 
 #ifdef PROFILE_STARTUP
 uint64_t g_startupTimelineEvents[NUM_STARTUP_TIMELINE_EVENTS] = { 0 };
+uint64_t g_startupTimelinePageFaults[NUM_STARTUP_TIMELINE_EVENTS] = { 0 };
+
+// Page faults (soft and hard) the process has taken so far. Recorded with each startup
+// timeline event, so the timeline shows how many pages every startup phase touched.
+uint64_t GetProcessPageFaultCount()
+{
+#ifdef HOST_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+
+    return counters.PageFaultCount;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    return (uint64_t)usage.ru_minflt + (uint64_t)usage.ru_majflt;
+#endif
+}
 #endif // PROFILE_STARTUP
 
 #ifdef HOST_WINDOWS
@@ -245,7 +273,7 @@ static void AppendInt64(char * pBuffer, uint32_t* pLen, uint64_t value)
 }
 #endif // PROFILE_STARTUP
 
-static void UninitDLL()
+static void __cdecl UninitDLL()
 {
 #ifdef PROFILE_STARTUP
     char buffer[1024];
@@ -259,6 +287,14 @@ static void UninitDLL()
 
     buffer[len++] = '\n';
 
+    // Page fault counts at the same points of the timeline
+    for (int i = 0; i < NUM_STARTUP_TIMELINE_EVENTS; i++)
+    {
+        AppendInt64(buffer, &len, g_startupTimelinePageFaults[i]);
+    }
+
+    buffer[len++] = '\n';
+
     fwrite(buffer, len, 1, stdout);
 #endif // PROFILE_STARTUP
 }
@@ -338,6 +374,8 @@ void RuntimeThreadShutdown(void* thread)
 
 extern "C" bool RhInitialize(bool isDll)
 {
+    STARTUP_TIMELINE_EVENT(PROCESS_ATTACH_BEGIN);
+
     if (!PalInit())
         return false;
 
@@ -363,6 +401,12 @@ extern "C" bool RhInitialize(bool isDll)
     // Populate the values needed for debugging
     PopulateDebugHeaders();
 
+    STARTUP_TIMELINE_EVENT(PROCESS_ATTACH_COMPLETE);
+
+#ifdef PROFILE_STARTUP
+    atexit(&UninitDLL);
+#endif
+
     return true;
 }
 
@@ -232,6 +232,10 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
         GCHeapUtilities::GetGCHeap()->ResetWaitForGCEvent();
     }
 
+#ifdef FEATURE_EVENT_TRACE
+    uint64_t startTicks = (uint64_t)minipal_hires_ticks();
+#endif // FEATURE_EVENT_TRACE
+
     // set the global trap for pinvoke leave and return
     RhpTrapThreads |= (uint32_t)TrapThreadsFlags::TrapThreads;
 
@@ -239,8 +243,14 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
     // reason for this is that we essentially implement Dekker's algorithm, which requires write ordering.
     PalFlushProcessWriteBuffers();
 
+    // A thread acknowledges the suspension by publishing its transition frame, which
+    // CacheTransitionFrameForSuspend latches, so every pass after the first only has to
+    // look at the stragglers. Hijack all threads still running managed code on the first
+    // pass rather than giving them a chance to reach a safe point on their own first:
+    // with many threads, the signals then go out back to back and the threads stop in
+    // parallel instead of one observe/hijack round after another.
     int prevRemaining = INT32_MAX;
-    bool observeOnly = true;
+    bool observeOnly = false;
     uint32_t rehijackDelay = 8;
     uint32_t usecsSinceYield = 0;
 
@@ -312,6 +322,11 @@ void ThreadStore::SuspendAllThreads(bool waitForGCEvent)
     // preemptive mode.
     PalFlushProcessWriteBuffers();
 #endif //TARGET_ARM || TARGET_ARM64 || TARGET_LOONGARCH64
+
+#ifdef FEATURE_EVENT_TRACE
+    uint64_t elapsedTicks = (uint64_t)minipal_hires_ticks() - startTicks;
+    ETW::GCLog::RecordSuspendDuration(elapsedTicks * 1000000 / (uint64_t)minipal_hires_tick_frequency());
+#endif // FEATURE_EVENT_TRACE
 }
 
 void ThreadStore::ResumeAllThreads(bool waitForGCEvent)
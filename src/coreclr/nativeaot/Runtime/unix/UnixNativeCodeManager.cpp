@@ -48,6 +48,29 @@ struct UnixNativeMethodInfo
 // Ensure that UnixNativeMethodInfo fits into the space reserved by MethodInfo
 static_assert(sizeof(UnixNativeMethodInfo) <= sizeof(MethodInfo), "UnixNativeMethodInfo too big");
 
+// Looking up the unwind info of a method means a binary search of the unwind table followed by decoding the
+// CIE and FDE, and stack walks over deep recursion look up the same return addresses over and over. The
+// results of recent lookups are remembered per thread, indexed by the control PC. Code is never unloaded, so
+// entries never go stale.
+#define UNWIND_INFO_CACHE_SIZE 32
+
+struct UnwindInfoCacheEntry
+{
+    TADDR pc;
+    unw_word_t start_ip;
+    unw_word_t end_ip;
+    unw_word_t lsda;
+    unw_word_t unwind_info;
+    uint32_t format;
+};
+
+static PLATFORM_THREAD_LOCAL UnwindInfoCacheEntry t_unwindInfoCache[UNWIND_INFO_CACHE_SIZE];
+
+static UnwindInfoCacheEntry * GetUnwindInfoCacheEntry(TADDR pc)
+{
+    return &t_unwindInfoCache[((pc >> 2) ^ (pc >> 11)) & (UNWIND_INFO_CACHE_SIZE - 1)];
+}
+
 UnixNativeCodeManager::UnixNativeCodeManager(TADDR moduleBase,
                                              PTR_VOID pvManagedCodeStartRange, uint32_t cbManagedCodeRange,
                                              PTR_PTR_VOID pClasslibFunctions, uint32_t nClasslibFunctions)
@@ -87,20 +110,34 @@ bool UnixNativeCodeManager::FindMethodInfo(PTR_VOID        ControlPC,
 
     // Find LSDA and start address for a function at address controlPC
 
-    unw_proc_info_t procInfo;
-
-    if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+    UnwindInfoCacheEntry * pCacheEntry = GetUnwindInfoCacheEntry((TADDR)ControlPC);
+    if (pCacheEntry->pc != (TADDR)ControlPC)
     {
-        return false;
+        unw_proc_info_t procInfo;
+
+        if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+        {
+            return false;
+        }
+
+        // Invalidate the entry while it is being updated, a signal handler running on this thread
+        // (e.g. for GC suspension) may look into the cache as well.
+        VolatileStore(&pCacheEntry->pc, (TADDR)0);
+        pCacheEntry->start_ip = procInfo.start_ip;
+        pCacheEntry->end_ip = procInfo.end_ip;
+        pCacheEntry->lsda = procInfo.lsda;
+        pCacheEntry->unwind_info = procInfo.unwind_info;
+        pCacheEntry->format = procInfo.format;
+        VolatileStore(&pCacheEntry->pc, (TADDR)ControlPC);
     }
 
-    assert((procInfo.start_ip <= (TADDR)ControlPC) && ((TADDR)ControlPC < procInfo.end_ip));
+    assert((pCacheEntry->start_ip <= (TADDR)ControlPC) && ((TADDR)ControlPC < pCacheEntry->end_ip));
 
-    pMethodInfo->start_ip = procInfo.start_ip;
-    pMethodInfo->format = procInfo.format;
-    pMethodInfo->unwind_info = procInfo.unwind_info;
+    pMethodInfo->start_ip = pCacheEntry->start_ip;
+    pMethodInfo->format = pCacheEntry->format;
+    pMethodInfo->unwind_info = pCacheEntry->unwind_info;
 
-    uintptr_t lsda = procInfo.lsda;
+    uintptr_t lsda = pCacheEntry->lsda;
 
     PTR_uint8_t p = dac_cast<PTR_uint8_t>(lsda);
 
@@ -391,8 +391,8 @@ PAL_ProbeMemory(
 PALIMPORT
 int
 PALAPI
-// Start the jitdump file
-PAL_PerfJitDump_Start(const char* path);
+// Start the jitdump file. If useAsyncWrites is true, the records are written by a background thread.
+PAL_PerfJitDump_Start(const char* path, bool useAsyncWrites);
 
 PALIMPORT
 bool
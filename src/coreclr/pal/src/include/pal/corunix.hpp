@@ -1000,6 +1000,23 @@ namespace CorUnix
             ISynchStateController *rgControllers[]
             ) = 0;
 
+        //
+        // This routine lets WaitForSingleObject[Ex] skip the wait controllers
+        // and the synchronization lock. It returns true if a wait on pObject
+        // has no side effects (e.g. the object is a manual reset event), in
+        // which case *pfSignaled receives whether the object is currently
+        // signaled. It returns false if the caller must go through the
+        // wait controllers.
+        //
+
+        virtual
+        bool
+        GetObjectSignaledStateWithoutLocking(
+            CPalThread *pThread,
+            IPalObject *pObject,
+            bool *pfSignaled                    // OUT
+            ) = 0;
+
         //
         // These following routines are meant for use only by IPalObject
         // implementations. The first two routines are used to
@@ -2173,6 +2173,42 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
         forceOveralign = true;
     }
 
+    // If PAL_MAP_PE_AT_PREFERRED_BASE is set to 1, try to place the image at its preferred base first. An image
+    // loaded there needs no base relocations, so its read-only and executable pages stay clean and are shared
+    // with every other process mapping the same file.
+    {
+        char *mapAtPreferredBase = EnvironGetenv("PAL_MAP_PE_AT_PREFERRED_BASE");
+        if (mapAtPreferredBase != NULL)
+        {
+            if (strcmp(mapAtPreferredBase, "1") == 0)
+            {
+                int mapFlags = MAP_ANON|MAP_PRIVATE;
+#ifdef __APPLE__
+                if (IsRunningOnMojaveHardenedRuntime())
+                {
+                    mapFlags |= MAP_JIT;
+                }
+#endif // __APPLE__
+                // Pass the preferred base as a hint only so an existing mapping there is never replaced
+                void *preferredReservation = mmap((void*)preferredBase, reserveSize, PROT_NONE, mapFlags, -1, 0);
+                if (preferredReservation == (void*)preferredBase)
+                {
+                    loadedBase = preferredReservation;
+                }
+                else
+                {
+                    TRACE_(LOADER)("Preferred base %p is not available for image\n", (void*)preferredBase);
+                    if (preferredReservation != MAP_FAILED)
+                    {
+                        munmap(preferredReservation, reserveSize);
+                    }
+                }
+            }
+
+            free(mapAtPreferredBase);
+        }
+    }
+
 #ifdef HOST_64BIT
     // First try to reserve virtual memory using ExecutableAllocator. This allows all PE images to be
     // near each other and close to the coreclr library which also allows the runtime to generate
@@ -2180,11 +2216,14 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
     // not be necessary (alignment to page size should be sufficient), but see
     // ExecutableMemoryAllocator::AllocateMemory() for the reason why it is done.
 
+    if (loadedBase == NULL)
+    {
 #ifdef FEATURE_ENABLE_NO_ADDRESS_SPACE_RANDOMIZATION
-    if (!g_useDefaultBaseAddr)
+        if (!g_useDefaultBaseAddr)
 #endif // FEATURE_ENABLE_NO_ADDRESS_SPACE_RANDOMIZATION
-    {
-        loadedBase = ReserveMemoryFromExecutableAllocator(pThread, ALIGN_UP(reserveSize, VIRTUAL_64KB));
+        {
+            loadedBase = ReserveMemoryFromExecutableAllocator(pThread, ALIGN_UP(reserveSize, VIRTUAL_64KB));
+        }
     }
 #endif // HOST_64BIT
 
@@ -52,6 +52,77 @@ minipal_mutex virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entries of the pVirtualMemory list, sorted by start address, so that looking up
+// the region containing an address and finding the insertion point of a new region are
+// binary searches instead of list walks. Protected by virtual_critsec, like the list.
+static PCMI *s_virtualMemoryIndex;
+static SIZE_T s_virtualMemoryIndexCount;
+static SIZE_T s_virtualMemoryIndexCapacity;
+
+// Uncomment to count the calls to, and the time spent in, the virtual memory APIs.
+// The totals are printed to stderr when the PAL is shut down.
+// #define VIRTUAL_STATISTICS
+
+#ifdef VIRTUAL_STATISTICS
+#include <minipal/time.h>
+
+enum VirtualStatisticsApi
+{
+    VirtualStatisticsAlloc,
+    VirtualStatisticsFree,
+    VirtualStatisticsProtect,
+    VirtualStatisticsQuery,
+    VirtualStatisticsApiCount
+};
+
+static const char * const s_virtualStatisticsApiNames[VirtualStatisticsApiCount] =
+{
+    "VirtualAlloc",
+    "VirtualFree",
+    "VirtualProtect",
+    "VirtualQuery",
+};
+
+static LONGLONG s_virtualStatisticsCalls[VirtualStatisticsApiCount];
+static LONGLONG s_virtualStatisticsTicks[VirtualStatisticsApiCount];
+
+class VirtualStatisticsScope
+{
+    VirtualStatisticsApi m_api;
+    int64_t m_start;
+
+public:
+    VirtualStatisticsScope(VirtualStatisticsApi api)
+        : m_api(api), m_start(minipal_hires_ticks())
+    {
+    }
+
+    ~VirtualStatisticsScope()
+    {
+        InterlockedIncrement64(&s_virtualStatisticsCalls[m_api]);
+        InterlockedAdd64(&s_virtualStatisticsTicks[m_api], minipal_hires_ticks() - m_start);
+    }
+};
+
+#define VIRTUAL_STATISTICS_SCOPE(api) VirtualStatisticsScope virtualStatisticsScope(api)
+
+static void VIRTUALDisplayStatistics()
+{
+    double ticksPerMicrosecond = (double)minipal_hires_tick_frequency() / 1000000;
+    for (int i = 0; i < VirtualStatisticsApiCount; i++)
+    {
+        LONGLONG calls = s_virtualStatisticsCalls[i];
+        double totalMicroseconds = (double)s_virtualStatisticsTicks[i] / ticksPerMicrosecond;
+        fprintf(stderr, "%-16s %12lld calls %14.0f us total %10.3f us/call\n",
+            s_virtualStatisticsApiNames[i], (long long)calls, totalMicroseconds,
+            calls != 0 ? totalMicroseconds / calls : 0.0);
+    }
+    fprintf(stderr, "%-16s %12llu regions\n", "Reserved", (unsigned long long)s_virtualMemoryIndexCount);
+}
+#else // VIRTUAL_STATISTICS
+#define VIRTUAL_STATISTICS_SCOPE(api)
+#endif // VIRTUAL_STATISTICS
+
 static size_t s_virtualPageSize = 0;
 
 #if defined(HOST_APPLE) && defined(HOST_ARM64) && !defined(HOST_OSX)
@@ -208,6 +279,10 @@ void VIRTUALCleanup()
     PCMI pTempEntry;
     minipal_mutex_enter(&virtual_critsec);
 
+#ifdef VIRTUAL_STATISTICS
+    VIRTUALDisplayStatistics();
+#endif // VIRTUAL_STATISTICS
+
     // Clean up the allocated memory.
     pEntry = pVirtualMemory;
     while ( pEntry )
@@ -220,6 +295,11 @@ void VIRTUALCleanup()
     }
     pVirtualMemory = NULL;
 
+    free(s_virtualMemoryIndex);
+    s_virtualMemoryIndex = NULL;
+    s_virtualMemoryIndexCount = 0;
+    s_virtualMemoryIndexCapacity = 0;
+
     minipal_mutex_leave(&virtual_critsec);
 
     TRACE( "Deleting the Virtual Critical Sections. \n" );
@@ -248,36 +328,65 @@ static BOOL VIRTUALContainsInvalidProtectionFlags( IN DWORD flProtect )
 
 /****
  *
- * VIRTUALFindRegionInformation( )
+ * VIRTUALIndexLowerBound( )
  *
  *          IN UINT_PTR address - The address to look for.
  *
- *          Returns the PCMI if found, NULL otherwise.
+ *          Returns the position in s_virtualMemoryIndex of the first entry
+ *          starting at or after address.
+ *          NOTE: The caller must own the critical section.
  */
-static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
+static SIZE_T VIRTUALIndexLowerBound( IN UINT_PTR address )
 {
-    PCMI pEntry = NULL;
-
-    TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
-
-    pEntry = pVirtualMemory;
+    SIZE_T low = 0;
+    SIZE_T high = s_virtualMemoryIndexCount;
 
-    while( pEntry )
+    while ( low < high )
     {
-        if ( pEntry->startBoundary > address )
+        SIZE_T middle = low + (high - low) / 2;
+        if ( s_virtualMemoryIndex[middle]->startBoundary < address )
         {
-            /* Gone past the possible location in the list. */
-            pEntry = NULL;
-            break;
+            low = middle + 1;
         }
-        if ( pEntry->startBoundary + pEntry->memSize > address )
+        else
         {
-            break;
+            high = middle;
         }
+    }
+    return low;
+}
 
-        pEntry = pEntry->pNext;
+/****
+ *
+ * VIRTUALFindRegionInformation( )
+ *
+ *          IN UINT_PTR address - The address to look for.
+ *
+ *          Returns the PCMI if found, NULL otherwise.
+ */
+static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
+{
+    TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
+
+    // The candidate is the last region starting at or before address. The regions
+    // don't overlap, so no other region can contain it.
+    SIZE_T position = VIRTUALIndexLowerBound( address );
+    if ( position < s_virtualMemoryIndexCount &&
+         s_virtualMemoryIndex[position]->startBoundary == address )
+    {
+        return s_virtualMemoryIndex[position];
     }
-    return pEntry;
+    if ( position == 0 )
+    {
+        return NULL;
+    }
+
+    PCMI pEntry = s_virtualMemoryIndex[position - 1];
+    if ( pEntry->startBoundary + pEntry->memSize > address )
+    {
+        return pEntry;
+    }
+    return NULL;
 }
 
 /*++
@@ -299,6 +408,21 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    SIZE_T position = VIRTUALIndexLowerBound( pMemoryToBeReleased->startBoundary );
+    while ( position < s_virtualMemoryIndexCount &&
+            s_virtualMemoryIndex[position] != pMemoryToBeReleased )
+    {
+        position++;
+    }
+    if ( position == s_virtualMemoryIndexCount )
+    {
+        ASSERT( "Entry is missing from the index.\n" );
+        return FALSE;
+    }
+    memmove( &s_virtualMemoryIndex[position], &s_virtualMemoryIndex[position + 1],
+             (s_virtualMemoryIndexCount - position - 1) * sizeof(PCMI) );
+    s_virtualMemoryIndexCount--;
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -402,7 +526,7 @@ static BOOL VIRTUALStoreAllocationInfo(
 {
     PCMI pNewEntry       = nullptr;
     PCMI pMemInfo        = nullptr;
-    SIZE_T nBufferSize   = 0;
+    SIZE_T position      = 0;
 
     if (!IS_ALIGNED(memSize, GetVirtualPageSize()))
     {
@@ -410,6 +534,19 @@ static BOOL VIRTUALStoreAllocationInfo(
         return FALSE;
     }
 
+    if (s_virtualMemoryIndexCount == s_virtualMemoryIndexCapacity)
+    {
+        SIZE_T newCapacity = s_virtualMemoryIndexCapacity == 0 ? 64 : s_virtualMemoryIndexCapacity * 2;
+        PCMI *newIndex = (PCMI *)realloc(s_virtualMemoryIndex, newCapacity * sizeof(PCMI));
+        if (newIndex == nullptr)
+        {
+            ERROR( "Unable to grow the region index.\n");
+            return FALSE;
+        }
+        s_virtualMemoryIndex = newIndex;
+        s_virtualMemoryIndexCapacity = newCapacity;
+    }
+
     if (!(pNewEntry = (PCMI)malloc(sizeof(*pNewEntry))))
     {
         ERROR( "Unable to allocate memory for the structure.\n");
@@ -421,17 +558,17 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
 
-    pMemInfo = pVirtualMemory;
+    /* The entry goes before the first one that doesn't start below it */
+    position = VIRTUALIndexLowerBound(startBoundary);
+    memmove(&s_virtualMemoryIndex[position + 1], &s_virtualMemoryIndex[position],
+            (s_virtualMemoryIndexCount - position) * sizeof(PCMI));
+    s_virtualMemoryIndex[position] = pNewEntry;
+    s_virtualMemoryIndexCount++;
 
-    if (pMemInfo && pMemInfo->startBoundary < startBoundary)
-    {
-        /* Look for the correct insert point */
-        TRACE("Looking for the correct insert location.\n");
-        while (pMemInfo->pNext && (pMemInfo->pNext->startBoundary < startBoundary))
-        {
-            pMemInfo = pMemInfo->pNext;
-        }
+    pMemInfo = position > 0 ? s_virtualMemoryIndex[position - 1] : nullptr;
 
+    if (pMemInfo)
+    {
         pNewEntry->pNext = pMemInfo->pNext;
         pNewEntry->pPrevious = pMemInfo;
 
@@ -445,7 +582,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     else
     {
         /* This is the first entry in the list. */
-        pNewEntry->pNext = pMemInfo;
+        pNewEntry->pNext = pVirtualMemory;
         pNewEntry->pPrevious = nullptr;
 
         if (pNewEntry->pNext)
@@ -888,6 +1025,7 @@ VirtualAlloc(
 {
     LPVOID  pRetVal       = NULL;
     CPalThread *pthrCurrent;
+    VIRTUAL_STATISTICS_SCOPE(VirtualStatisticsAlloc);
 
     PERF_ENTRY(VirtualAlloc);
     ENTRY("VirtualAlloc(lpAddress=%p, dwSize=%u, flAllocationType=%#x, \
@@ -931,22 +1069,23 @@ VirtualAlloc(
         NULL,
         TRUE);
 
+    // Reserving and committing in one call holds the lock across both steps
+    minipal_mutex_enter(&virtual_critsec);
+
     if ( flAllocationType & MEM_RESERVE )
     {
-        minipal_mutex_enter(&virtual_critsec);
         pRetVal = VIRTUALReserveMemory( pthrCurrent, lpAddress, dwSize, flAllocationType, flProtect );
-        minipal_mutex_leave(&virtual_critsec);
 
         if ( !pRetVal )
         {
             /* Error messages are already displayed, just leave. */
+            minipal_mutex_leave(&virtual_critsec);
             goto done;
         }
     }
 
     if ( flAllocationType & MEM_COMMIT )
     {
-        minipal_mutex_enter(&virtual_critsec);
         if ( pRetVal != NULL )
         {
             /* We are reserving and committing. */
@@ -959,9 +1098,10 @@ VirtualAlloc(
             pRetVal = VIRTUALCommitMemory( pthrCurrent, lpAddress, dwSize,
                                     flAllocationType, flProtect );
         }
-        minipal_mutex_leave(&virtual_critsec);
     }
 
+    minipal_mutex_leave(&virtual_critsec);
+
 done:
 #if defined _DEBUG
     VIRTUALDisplayList();
@@ -986,6 +1126,7 @@ VirtualFree(
 {
     BOOL bRetVal = TRUE;
     CPalThread *pthrCurrent;
+    VIRTUAL_STATISTICS_SCOPE(VirtualStatisticsFree);
 
     PERF_ENTRY(VirtualFree);
     ENTRY("VirtualFree(lpAddress=%p, dwSize=%u, dwFreeType=%#x)\n",
@@ -1173,19 +1314,20 @@ VirtualProtect(
            OUT PDWORD lpflOldProtect)
 {
     BOOL     bRetVal = FALSE;
-    PCMI     pEntry = NULL;
     SIZE_T   MemSize = 0;
     UINT_PTR StartBoundary = 0;
     SIZE_T   Index = 0;
     SIZE_T   NumberOfPagesToChange = 0;
     SIZE_T   OffSet = 0;
+    VIRTUAL_STATISTICS_SCOPE(VirtualStatisticsProtect);
 
     PERF_ENTRY(VirtualProtect);
     ENTRY("VirtualProtect(lpAddress=%p, dwSize=%u, flNewProtect=%#x, "
           "flOldProtect=%p)\n",
           lpAddress, dwSize, flNewProtect, lpflOldProtect);
 
-    minipal_mutex_enter(&virtual_critsec);
+    // The reserved region list is neither read nor updated here and mprotect is
+    // atomic with respect to other threads, so virtual_critsec isn't needed.
 
     StartBoundary = (UINT_PTR) ALIGN_DOWN(lpAddress, GetVirtualPageSize());
     MemSize = ALIGN_UP((UINT_PTR)lpAddress + dwSize, GetVirtualPageSize()) - StartBoundary;
@@ -1206,7 +1348,6 @@ VirtualProtect(
         goto ExitVirtualProtect;
     }
 
-    pEntry = VIRTUALFindRegionInformation( StartBoundary );
     if ( 0 == mprotect( (LPVOID)StartBoundary, MemSize,
                    W32toUnixAccessControl( flNewProtect ) ) )
     {
@@ -1241,7 +1382,6 @@ VirtualProtect(
         }
     }
 ExitVirtualProtect:
-    minipal_mutex_leave(&virtual_critsec);
 
 #if defined _DEBUG
     VIRTUALDisplayList();
@@ -1430,6 +1570,7 @@ VirtualQuery(
     PCMI     pEntry = NULL;
     UINT_PTR StartBoundary = 0;
     CPalThread * pthrCurrent;
+    VIRTUAL_STATISTICS_SCOPE(VirtualStatisticsQuery);
 
     PERF_ENTRY(VirtualQuery);
     ENTRY("VirtualQuery(lpAddress=%p, lpBuffer=%p, dwLength=%u)\n",
@@ -65,6 +65,13 @@ namespace
 #endif
 
         JIT_CODE_LOAD = 0,
+
+        // Asynchronous writes: records are copied into a bounded set of buffers that are
+        // written by a background thread. Partially filled buffers are written after at most
+        // ASYNC_FLUSH_INTERVAL_MS.
+        ASYNC_BUFFER_SIZE = 256 * 1024,
+        ASYNC_BUFFER_COUNT = 8,
+        ASYNC_FLUSH_INTERVAL_MS = 100,
     };
 
     static bool UseArchTimeStamp()
@@ -153,17 +160,49 @@ struct PerfJitDumpState
         enabled(false),
         fd(-1),
         mmapAddr(MAP_FAILED),
-        codeIndex(0)
-    {}
+        codeIndex(0),
+        async(false),
+        asyncStopping(false),
+        fillIndex(0),
+        writeIndex(0),
+        pendingCount(0)
+    {
+        pthread_mutex_init(&writeLock, nullptr);
+        pthread_mutex_init(&queueLock, nullptr);
+        pthread_cond_init(&queueCond, nullptr);
+
+        for (size_t i = 0; i < ASYNC_BUFFER_COUNT; i++)
+        {
+            buffers[i] = nullptr;
+            bufferSizes[i] = 0;
+        }
+    }
 
     volatile bool enabled;
     int fd;
     void *mmapAddr;
     volatile uint64_t codeIndex;
 
+    // Serializes the writes to fd between the writer thread and the synchronous fallback.
+    pthread_mutex_t writeLock;
+
+    // Buffers [writeIndex, writeIndex + pendingCount) are waiting for the writer thread. The
+    // buffer at fillIndex is being filled by the logging threads. Protected by queueLock.
+    bool async;
+    bool asyncStopping;
+    pthread_t writerThread;
+    pthread_mutex_t queueLock;
+    pthread_cond_t queueCond;
+    char* buffers[ASYNC_BUFFER_COUNT];
+    size_t bufferSizes[ASYNC_BUFFER_COUNT];
+    size_t fillIndex;
+    size_t writeIndex;
+    size_t pendingCount;
+
     int FatalError()
     {
         enabled = false;
+        StopAsyncWriter();
 
         if (mmapAddr != MAP_FAILED)
         {
@@ -180,7 +219,7 @@ struct PerfJitDumpState
         return -1;
     }
 
-    int Start(const char* path)
+    int Start(const char* path, bool useAsyncWrites)
     {
         int result = 0;
 
@@ -240,12 +279,213 @@ struct PerfJitDumpState
         mmapAddr = NULL;
 #endif
 
+        if (useAsyncWrites)
+        {
+            StartAsyncWriter();
+        }
+
         enabled = true;
 
 exit:
         return 0;
     }
 
+    // Writes all the items to fd handling partial writes. Returns -1 on failure.
+    int WriteItems(iovec* items, size_t itemsCount, size_t bytesRemaining)
+    {
+        size_t itemsWritten = 0;
+
+        do
+        {
+            int result = writev(fd, items + itemsWritten, itemsCount - itemsWritten);
+
+            if ((size_t)result == bytesRemaining)
+                break;
+
+            if (result == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return -1;
+            }
+
+            // Detect unexpected failure cases.
+            _ASSERTE(bytesRemaining > (size_t)result);
+            _ASSERTE(result > 0);
+
+            // Handle partial write case
+
+            bytesRemaining -= result;
+
+            do
+            {
+                if ((size_t)result < items[itemsWritten].iov_len)
+                {
+                    items[itemsWritten].iov_len -= result;
+                    items[itemsWritten].iov_base = (void*)((size_t) items[itemsWritten].iov_base + result);
+                    break;
+                }
+                else
+                {
+                    result -= items[itemsWritten].iov_len;
+                    itemsWritten++;
+
+                    // Detect unexpected failure case.
+                    _ASSERTE(itemsWritten < itemsCount);
+                }
+            } while (result > 0);
+        } while (true);
+
+        return 0;
+    }
+
+    void StartAsyncWriter()
+    {
+        for (size_t i = 0; i < ASYNC_BUFFER_COUNT; i++)
+        {
+            buffers[i] = (char*)malloc(ASYNC_BUFFER_SIZE);
+            bufferSizes[i] = 0;
+            if (buffers[i] == nullptr)
+            {
+                FreeAsyncBuffers();
+                return;
+            }
+        }
+
+        fillIndex = 0;
+        writeIndex = 0;
+        pendingCount = 0;
+        asyncStopping = false;
+
+        if (pthread_create(&writerThread, nullptr, AsyncWriterThread, this) != 0)
+        {
+            FreeAsyncBuffers();
+            return;
+        }
+
+        async = true;
+    }
+
+    void StopAsyncWriter()
+    {
+        if (!async)
+            return;
+
+        pthread_mutex_lock(&queueLock);
+        asyncStopping = true;
+        pthread_cond_signal(&queueCond);
+        pthread_mutex_unlock(&queueLock);
+
+        // The writer thread writes all the remaining buffers before exiting
+        pthread_join(writerThread, nullptr);
+
+        async = false;
+        FreeAsyncBuffers();
+    }
+
+    void FreeAsyncBuffers()
+    {
+        for (size_t i = 0; i < ASYNC_BUFFER_COUNT; i++)
+        {
+            free(buffers[i]);
+            buffers[i] = nullptr;
+        }
+    }
+
+    static void* AsyncWriterThread(void* arg)
+    {
+        PerfJitDumpState* state = (PerfJitDumpState*)arg;
+        state->AsyncWriter();
+        return nullptr;
+    }
+
+    void AsyncWriter()
+    {
+        pthread_mutex_lock(&queueLock);
+
+        while (true)
+        {
+            if (pendingCount == 0)
+            {
+                if (bufferSizes[fillIndex] == 0)
+                {
+                    if (asyncStopping)
+                        break;
+
+                    struct timespec timeout;
+                    clock_gettime(CLOCK_REALTIME, &timeout);
+                    timeout.tv_nsec += ASYNC_FLUSH_INTERVAL_MS * 1000000L;
+                    if (timeout.tv_nsec >= 1000000000L)
+                    {
+                        timeout.tv_sec++;
+                        timeout.tv_nsec -= 1000000000L;
+                    }
+                    pthread_cond_timedwait(&queueCond, &queueLock, &timeout);
+                    continue;
+                }
+
+                // Write the partially filled buffer so the records don't stay queued indefinitely
+                fillIndex = (fillIndex + 1) % ASYNC_BUFFER_COUNT;
+                pendingCount++;
+            }
+
+            size_t index = writeIndex;
+            pthread_mutex_unlock(&queueLock);
+
+            pthread_mutex_lock(&writeLock);
+            iovec item = { buffers[index], bufferSizes[index] };
+            int result = WriteItems(&item, 1, bufferSizes[index]);
+            pthread_mutex_unlock(&writeLock);
+
+            if (result == -1)
+            {
+                // Stop logging; the file is closed by Finish
+                enabled = false;
+            }
+
+            pthread_mutex_lock(&queueLock);
+            bufferSizes[index] = 0;
+            writeIndex = (writeIndex + 1) % ASYNC_BUFFER_COUNT;
+            pendingCount--;
+        }
+
+        pthread_mutex_unlock(&queueLock);
+    }
+
+    // Copies the record into the async buffers. Returns false if the buffers are full or the
+    // record doesn't fit in a buffer and it needs to be written synchronously.
+    bool TryQueueItems(const iovec* items, size_t itemsCount, size_t totalSize)
+    {
+        if (totalSize > ASYNC_BUFFER_SIZE)
+            return false;
+
+        bool queued = false;
+        pthread_mutex_lock(&queueLock);
+
+        if (bufferSizes[fillIndex] + totalSize > ASYNC_BUFFER_SIZE && pendingCount < ASYNC_BUFFER_COUNT - 1)
+        {
+            fillIndex = (fillIndex + 1) % ASYNC_BUFFER_COUNT;
+            pendingCount++;
+            pthread_cond_signal(&queueCond);
+        }
+
+        if (bufferSizes[fillIndex] + totalSize <= ASYNC_BUFFER_SIZE)
+        {
+            char* dest = buffers[fillIndex] + bufferSizes[fillIndex];
+            for (size_t i = 0; i < itemsCount; i++)
+            {
+                memcpy(dest, items[i].iov_base, items[i].iov_len);
+                dest += items[i].iov_len;
+            }
+            bufferSizes[fillIndex] += totalSize;
+            queued = true;
+        }
+
+        pthread_mutex_unlock(&queueLock);
+        return queued;
+    }
+
     int LogMethod(void* pCode, size_t codeSize, const char* symbol, void* debugInfo, void* unwindInfo)
     {
         int result = 0;
@@ -272,8 +512,6 @@ exit:
             };
             size_t itemsCount = sizeof(items) / sizeof(items[0]);
 
-            size_t itemsWritten = 0;
-
             if (result != 0)
                 return FatalError();
 
@@ -283,48 +521,16 @@ exit:
             // Increment codeIndex while locked
             record.code_index = ++codeIndex;
 
-            do
-            {
-                result = writev(fd, items + itemsWritten, itemsCount - itemsWritten);
-
-                if ((size_t)result == bytesRemaining)
-                    break;
-
-                if (result == -1)
-                {
-                    if (errno == EINTR)
-                        continue;
-
-                    return FatalError();
-                }
-
-                // Detect unexpected failure cases.
-                _ASSERTE(bytesRemaining > (size_t)result);
-                _ASSERTE(result > 0);
-
-                // Handle partial write case
-
-                bytesRemaining -= result;
-
-                do
-                {
-                    if ((size_t)result < items[itemsWritten].iov_len)
-                    {
-                        items[itemsWritten].iov_len -= result;
-                        items[itemsWritten].iov_base = (void*)((size_t) items[itemsWritten].iov_base + result);
-                        break;
-                    }
-                    else
-                    {
-                        result -= items[itemsWritten].iov_len;
-                        itemsWritten++;
+            if (async && TryQueueItems(items, itemsCount, bytesRemaining))
+                goto exit;
 
-                        // Detect unexpected failure case.
-                        _ASSERTE(itemsWritten < itemsCount);
-                    }
-                } while (result > 0);
-            } while (true);
+            // Synchronous write when not async or the async buffers are full
+            pthread_mutex_lock(&writeLock);
+            result = WriteItems(items, itemsCount, bytesRemaining);
+            pthread_mutex_unlock(&writeLock);
 
+            if (result == -1)
+                return FatalError();
         }
 exit:
         return 0;
@@ -334,6 +540,9 @@ exit:
     {
         int result = 0;
 
+        // Write any queued records before closing the file
+        StopAsyncWriter();
+
         if (enabled)
         {
             enabled = false;
@@ -375,9 +584,9 @@ PerfJitDumpState& GetState()
 
 int
 PALAPI
-PAL_PerfJitDump_Start(const char* path)
+PAL_PerfJitDump_Start(const char* path, bool useAsyncWrites)
 {
-    return GetState().Start(path);
+    return GetState().Start(path, useAsyncWrites);
 }
 
 bool
@@ -405,7 +614,7 @@ PAL_PerfJitDump_Finish()
 
 int
 PALAPI
-PAL_PerfJitDump_Start(const char* path)
+PAL_PerfJitDump_Start(const char* path, bool useAsyncWrites)
 {
     return 0;
 }
@@ -940,7 +940,7 @@ namespace CorUnix
 
         // Preset the signal count to the new value, so that it can be used
         // by ReleaseFirstWaiter when delegating signaling to another process
-        m_lSignalCount = lSignalCount;
+        VolatileStore(&m_lSignalCount, lSignalCount);
 
         while (m_lSignalCount > 0)
         {
@@ -695,6 +695,58 @@ namespace CorUnix
                                              CSynchControllerBase::StateController);
     }
 
+    /*++
+    Method:
+      CPalSynchronizationManager::GetObjectSignaledStateWithoutLocking
+
+    Reads the signaled state of an object without acquiring the local synch
+    lock, for objects that a waiter can acquire without altering their state
+    (i.e. objects with no owner whose thread release has no side effects,
+    such as manual reset events). Once such an object is seen as signaled,
+    a wait on it is satisfied; if it is seen as unsignaled, a zero timeout
+    wait can time out right away. Either answer is a valid linearization of
+    the wait against a concurrent SetEvent/ResetEvent.
+
+    Returns false if the object is not eligible, in which case the caller
+    must go through the wait controllers.
+    --*/
+    bool CPalSynchronizationManager::GetObjectSignaledStateWithoutLocking(
+        CPalThread *pthrCurrent,
+        IPalObject *pObject,
+        bool *pfSignaled)
+    {
+        CObjectType * potObjectType = pObject->GetObjectType();
+        void * pvSData;
+
+        _ASSERTE(NULL != pfSignaled);
+
+        if (CObjectType::ThreadReleaseHasNoSideEffects !=
+                potObjectType->GetThreadReleaseSemantics() ||
+            CObjectType::NoOwner != potObjectType->GetOwnershipSemantics())
+        {
+            return false;
+        }
+
+        if (NO_ERROR != pObject->GetObjectSynchData(&pvSData))
+        {
+            return false;
+        }
+
+        CSynchData * psdSynchData = static_cast<CSynchData *>(pvSData);
+        VALIDATEOBJECT(psdSynchData);
+
+        bool fSignaled = 0 < psdSynchData->GetSignalCountWithoutLocking();
+        if (!fSignaled && otiProcess == potObjectType->GetId())
+        {
+            // An exited process is only signaled once somebody checks on it,
+            // which CSynchWaitController::CanThreadWaitWithoutBlocking does
+            return false;
+        }
+
+        *pfSignaled = fSignaled;
+        return true;
+    }
+
     /*++
     Method:
       CPalSynchronizationManager::GetSynchControllersForObjects
@@ -240,7 +240,13 @@ namespace CorUnix
         {
             _ASSERTE(m_lSignalCount >= 0);
             _ASSERTE(lSignalCount >= 0);
-            m_lSignalCount = lSignalCount;
+            // Release semantics, the count can be read without holding the
+            // synch lock (see GetSignalCountWithoutLocking)
+            VolatileStore(&m_lSignalCount, lSignalCount);
+        }
+        LONG GetSignalCountWithoutLocking(void)
+        {
+            return VolatileLoad(&m_lSignalCount);
         }
         LONG DecrementSignalCount(void)
         {
@@ -755,6 +761,11 @@ namespace CorUnix
             DWORD dwObjectCount,
             ISynchStateController *rgControllers[]);
 
+        virtual bool GetObjectSignaledStateWithoutLocking(
+            CPalThread *pthrCurrent,
+            IPalObject *pObject,
+            bool *pfSignaled);
+
         virtual PAL_ERROR AllocateObjectSynchData(
             CObjectType *potObjectType,
             VOID **ppvSynchData);
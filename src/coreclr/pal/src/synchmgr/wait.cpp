@@ -465,6 +465,26 @@ DWORD CorUnix::InternalWaitForMultipleObjectsEx(
         }
         goto WFMOExIntCleanup;
     }
+    else if (!bAlertable)
+    {
+        // Most runtime waits are on a single event that tends to be signaled already. When
+        // acquiring the object has no side effects, its state can be checked without taking
+        // the synch lock and setting up a wait controller.
+        bool fSignaled;
+        if (g_pSynchronizationManager->GetObjectSignaledStateWithoutLocking(pThread, ppIPalObjs[0], &fSignaled))
+        {
+            if (fSignaled)
+            {
+                dwRet = WAIT_OBJECT_0;
+                goto WFMOExIntCleanup;
+            }
+            if (0 == dwMilliseconds)
+            {
+                dwRet = WAIT_TIMEOUT;
+                goto WFMOExIntCleanup;
+            }
+        }
+    }
 
     if (fWAll)
     {
@@ -2266,6 +2266,56 @@ CPalThread::WaitForStartStatus(
 }
 
 #if !HAVE_MACH_EXCEPTIONS && HAVE_SIGALTSTACK
+
+// Alternate stacks of exited threads, kept for new threads to save the mmap, mprotect
+// and munmap calls for each thread. All of them have the size GetSignalAlternateStackSize returns.
+#define RECYCLED_ALTERNATE_STACK_COUNT 16
+static void* volatile s_recycledAlternateStacks[RECYCLED_ALTERNATE_STACK_COUNT];
+
+static int GetSignalAlternateStackSize()
+{
+    // We include the size of the SignalHandlerWorkerReturnPoint in the alternate stack size since the
+    // context contained in it is large and the SIGSTKSZ was not sufficient on ARM64 during testing.
+    int altStackSize = SIGSTKSZ + ALIGN_UP(sizeof(SignalHandlerWorkerReturnPoint), 16) + GetVirtualPageSize();
+#ifdef HAS_ADDRESS_SANITIZER
+    // Asan also uses alternate stack so we increase its size on the SIGSTKSZ * 4 that enough for asan
+    // (see kAltStackSize in compiler-rt/lib/sanitizer_common/sanitizer_posix_libcdep.cc)
+    altStackSize += SIGSTKSZ * 4;
+#endif
+    return ALIGN_UP(altStackSize, GetVirtualPageSize());
+}
+
+static void* TakeRecycledSignalAlternateStack()
+{
+    for (int i = 0; i < RECYCLED_ALTERNATE_STACK_COUNT; i++)
+    {
+        if (s_recycledAlternateStacks[i] != NULL)
+        {
+            void* altStack = InterlockedExchangePointer(&s_recycledAlternateStacks[i], NULL);
+            if (altStack != NULL)
+            {
+                return altStack;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static bool RecycleSignalAlternateStack(void* altStack)
+{
+    for (int i = 0; i < RECYCLED_ALTERNATE_STACK_COUNT; i++)
+    {
+        if (s_recycledAlternateStacks[i] == NULL &&
+            InterlockedCompareExchangePointer(&s_recycledAlternateStacks[i], altStack, NULL) == NULL)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /*++
 Function :
     EnsureSignalAlternateStack
@@ -2291,26 +2341,26 @@ CPalThread::EnsureSignalAlternateStack()
         st = sigaltstack(NULL, &oss);
         if ((st == 0) && (oss.ss_flags == SS_DISABLE))
         {
-            // There is no alternate stack for SIGSEGV handling installed yet so allocate one
-
-            // We include the size of the SignalHandlerWorkerReturnPoint in the alternate stack size since the
-            // context contained in it is large and the SIGSTKSZ was not sufficient on ARM64 during testing.
-            int altStackSize = SIGSTKSZ + ALIGN_UP(sizeof(SignalHandlerWorkerReturnPoint), 16) + GetVirtualPageSize();
-#ifdef HAS_ADDRESS_SANITIZER
-            // Asan also uses alternate stack so we increase its size on the SIGSTKSZ * 4 that enough for asan
-            // (see kAltStackSize in compiler-rt/lib/sanitizer_common/sanitizer_posix_libcdep.cc)
-            altStackSize += SIGSTKSZ * 4;
-#endif
-            altStackSize = ALIGN_UP(altStackSize, GetVirtualPageSize());
-            int flags = MAP_ANONYMOUS | MAP_PRIVATE;
+            // There is no alternate stack for SIGSEGV handling installed yet so allocate one,
+            // or reuse one of an exited thread, which already has its guard page
+            int altStackSize = GetSignalAlternateStackSize();
+            void* altStack = TakeRecycledSignalAlternateStack();
+            if (altStack == NULL)
+            {
+                int flags = MAP_ANONYMOUS | MAP_PRIVATE;
 #ifdef MAP_STACK
-            flags |= MAP_STACK;
+                flags |= MAP_STACK;
 #endif
-            void* altStack = mmap(NULL, altStackSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+                altStack = mmap(NULL, altStackSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if (altStack != MAP_FAILED)
+                {
+                    // create a guard page for the alternate stack
+                    st = mprotect(altStack, GetVirtualPageSize(), PROT_NONE);
+                }
+            }
+
             if (altStack != MAP_FAILED)
             {
-                // create a guard page for the alternate stack
-                st = mprotect(altStack, GetVirtualPageSize(), PROT_NONE);
                 if (st == 0)
                 {
                     stack_t ss;
@@ -2367,7 +2417,8 @@ CPalThread::FreeSignalAlternateStack()
         if ((st == 0) && (oss.ss_flags != SS_DISABLE))
         {
             // Make sure this altstack is this PAL's before freeing.
-            if (oss.ss_sp == altstack)
+            if (oss.ss_sp == altstack &&
+                ((oss.ss_size != (size_t)GetSignalAlternateStackSize()) || !RecycleSignalAlternateStack(oss.ss_sp)))
             {
                 int st = munmap(oss.ss_sp, oss.ss_size);
                 _ASSERTE(st == 0);
@@ -13,11 +13,6 @@
 #include "CachedInterfaceDispatchPal.h"
 #include "CachedInterfaceDispatch.h"
 
-// We always allocate cache sizes with a power of 2 number of entries. We have a maximum size we support,
-// defined below.
-#define CID_MAX_CACHE_SIZE_LOG2 6
-#define CID_MAX_CACHE_SIZE      (1 << CID_MAX_CACHE_SIZE_LOG2)
-
 //#define FEATURE_CID_STATS 1
 
 #ifdef FEATURE_CID_STATS
@@ -45,6 +40,20 @@ extern "C"
 
 #endif // FEATURE_CID_STATS
 
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+
+// Unlike the counters above these are always maintained: they are only updated on the cache miss path and
+// tell whether any call sites have outgrown the per-cell caches.
+extern "C"
+{
+    uint32_t CID_g_cMegamorphicCells = 0;       // Cells that reached the megamorphic cache (up to CID_MEGAMORPHIC_MAX_TRACKED_CELLS)
+    uint32_t CID_g_cMegamorphicHits = 0;        // Cache misses resolved by the megamorphic cache
+    uint32_t CID_g_cMegamorphicInserts = 0;     // Entries added to the megamorphic cache
+    uint32_t CID_g_cMegamorphicEvictions = 0;   // Entries replaced because all of their probe buckets were in use
+};
+
+#endif // FEATURE_CID_MEGAMORPHIC_CACHE
+
 // Helper function for updating two adjacent pointers (which are aligned on a double pointer-sized boundary)
 // atomically.
 //
@@ -404,8 +413,181 @@ void InterfaceDispatch_ReclaimUnusedInterfaceDispatchCaches()
 
     // We processed all the discarded entries, so we can simply NULL the list head.
     g_pDiscardedCacheList = NULL;
+
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+    ReclaimDiscardedMegamorphicEntries();
+#endif
+}
+
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+
+//
+// Megamorphic cache.
+//
+// The table is an array of pointers to immutable entries, so readers never see a partially written entry.
+// Entries replaced by newer ones may still be read by a thread searching the table, so just like discarded
+// cache blocks they are only re-used after the next GC. The table is allocated on first use and protected by
+// g_sListLock for writers; readers (InterfaceDispatch_SearchMegamorphicCache) take no locks and rely on not
+// being interrupted by a GC.
+//
+
+#define CID_MEGAMORPHIC_CACHE_SIZE_LOG2     12
+#define CID_MEGAMORPHIC_CACHE_SIZE          (1 << CID_MEGAMORPHIC_CACHE_SIZE_LOG2)
+#define CID_MEGAMORPHIC_CACHE_PROBES        4
+#define CID_MEGAMORPHIC_MAX_TRACKED_CELLS   256
+
+struct MegamorphicCacheEntry
+{
+    InterfaceDispatchCell *     m_pCell;
+    MethodTable *               m_pInstanceType;
+    PCODE                       m_pTargetCode;
+    MegamorphicCacheEntry *     m_pNextFree;    // next in the discarded or free list
+};
+
+static MegamorphicCacheEntry ** g_rgMegamorphicCache = NULL;
+
+// Entries that were replaced and may still be in use until the next GC, and entries that can be re-used.
+static MegamorphicCacheEntry * g_pDiscardedMegamorphicEntries = NULL;
+static MegamorphicCacheEntry * g_pFreeMegamorphicEntries = NULL;
+
+// Open addressed set of the cells that reached the megamorphic cache, used for CID_g_cMegamorphicCells.
+static InterfaceDispatchCell ** g_rgMegamorphicCells = NULL;
+
+static uint32_t MegamorphicCacheHash(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    uintptr_t hash = ((uintptr_t)pCell >> 3) ^ (((uintptr_t)pInstanceType >> 3) * 0x9E3779B1u);
+    return (uint32_t)(hash ^ (hash >> CID_MEGAMORPHIC_CACHE_SIZE_LOG2)) & (CID_MEGAMORPHIC_CACHE_SIZE - 1);
+}
+
+PCODE InterfaceDispatch_SearchMegamorphicCache(InterfaceDispatchCell * pCell, MethodTable* pInstanceType)
+{
+    MegamorphicCacheEntry ** rgCache = VolatileLoad(&g_rgMegamorphicCache);
+    if (rgCache == NULL)
+        return (PCODE)nullptr;
+
+    uint32_t idx = MegamorphicCacheHash(pCell, pInstanceType);
+    for (uint32_t i = 0; i < CID_MEGAMORPHIC_CACHE_PROBES; i++)
+    {
+        MegamorphicCacheEntry * pEntry = VolatileLoad(&rgCache[(idx + i) & (CID_MEGAMORPHIC_CACHE_SIZE - 1)]);
+        if (pEntry == NULL)
+            break;
+
+        if (pEntry->m_pCell == pCell && pEntry->m_pInstanceType == pInstanceType)
+        {
+            CID_g_cMegamorphicHits++;
+            return pEntry->m_pTargetCode;
+        }
+    }
+
+    return (PCODE)nullptr;
+}
+
+// Record that pCell uses the megamorphic cache. Called with g_sListLock held.
+static void TrackMegamorphicCell(InterfaceDispatchCell * pCell)
+{
+    uint32_t idx = (uint32_t)((uintptr_t)pCell >> 3) & (CID_MEGAMORPHIC_MAX_TRACKED_CELLS - 1);
+    for (uint32_t i = 0; i < CID_MEGAMORPHIC_MAX_TRACKED_CELLS; i++)
+    {
+        InterfaceDispatchCell ** ppCell = &g_rgMegamorphicCells[(idx + i) & (CID_MEGAMORPHIC_MAX_TRACKED_CELLS - 1)];
+        if (*ppCell == pCell)
+            return;
+
+        if (*ppCell == NULL)
+        {
+            *ppCell = pCell;
+            CID_g_cMegamorphicCells++;
+            return;
+        }
+    }
 }
 
+static void AddMegamorphicCacheEntry(InterfaceDispatchCell * pCell, PCODE pTargetCode, MethodTable* pInstanceType)
+{
+    CrstHolder lh(&g_sListLock);
+
+    if (g_rgMegamorphicCache == NULL)
+    {
+        MegamorphicCacheEntry ** rgCache = (MegamorphicCacheEntry **)InterfaceDispatch_AllocPointerAligned(sizeof(MegamorphicCacheEntry *) * CID_MEGAMORPHIC_CACHE_SIZE);
+        InterfaceDispatchCell ** rgCells = (InterfaceDispatchCell **)InterfaceDispatch_AllocPointerAligned(sizeof(InterfaceDispatchCell *) * CID_MEGAMORPHIC_MAX_TRACKED_CELLS);
+        if (rgCache == NULL || rgCells == NULL)
+        {
+            CID_COUNTER_INC(CacheOutOfMemory);
+            return;
+        }
+
+        memset(rgCache, 0, sizeof(MegamorphicCacheEntry *) * CID_MEGAMORPHIC_CACHE_SIZE);
+        memset(rgCells, 0, sizeof(InterfaceDispatchCell *) * CID_MEGAMORPHIC_MAX_TRACKED_CELLS);
+        g_rgMegamorphicCells = rgCells;
+        VolatileStore(&g_rgMegamorphicCache, rgCache);
+    }
+
+    TrackMegamorphicCell(pCell);
+
+    // Use the first empty bucket in the probe sequence, or replace the entry in the first bucket if they are
+    // all in use. The lookup stops at the first empty bucket, so entries are never removed otherwise.
+    uint32_t idx = MegamorphicCacheHash(pCell, pInstanceType);
+    MegamorphicCacheEntry ** pBucket = &g_rgMegamorphicCache[idx];
+    for (uint32_t i = 0; i < CID_MEGAMORPHIC_CACHE_PROBES; i++)
+    {
+        MegamorphicCacheEntry ** pProbe = &g_rgMegamorphicCache[(idx + i) & (CID_MEGAMORPHIC_CACHE_SIZE - 1)];
+        MegamorphicCacheEntry * pExisting = *pProbe;
+        if (pExisting == NULL)
+        {
+            pBucket = pProbe;
+            break;
+        }
+
+        // Another thread resolved the same pair first.
+        if (pExisting->m_pCell == pCell && pExisting->m_pInstanceType == pInstanceType)
+            return;
+    }
+
+    MegamorphicCacheEntry * pEntry = g_pFreeMegamorphicEntries;
+    if (pEntry != NULL)
+        g_pFreeMegamorphicEntries = pEntry->m_pNextFree;
+    else
+        pEntry = (MegamorphicCacheEntry *)InterfaceDispatch_AllocPointerAligned(sizeof(MegamorphicCacheEntry));
+
+    if (pEntry == NULL)
+    {
+        CID_COUNTER_INC(CacheOutOfMemory);
+        return;
+    }
+
+    pEntry->m_pCell = pCell;
+    pEntry->m_pInstanceType = pInstanceType;
+    pEntry->m_pTargetCode = pTargetCode;
+    pEntry->m_pNextFree = NULL;
+
+    MegamorphicCacheEntry * pReplaced = *pBucket;
+    VolatileStore(pBucket, pEntry);
+    CID_g_cMegamorphicInserts++;
+
+    if (pReplaced != NULL)
+    {
+        CID_g_cMegamorphicEvictions++;
+        pReplaced->m_pNextFree = g_pDiscardedMegamorphicEntries;
+        g_pDiscardedMegamorphicEntries = pReplaced;
+    }
+}
+
+// Called during a GC, once no thread can still be reading the discarded entries.
+static void ReclaimDiscardedMegamorphicEntries()
+{
+    MegamorphicCacheEntry * pEntry = g_pDiscardedMegamorphicEntries;
+    while (pEntry)
+    {
+        MegamorphicCacheEntry * pNextEntry = pEntry->m_pNextFree;
+        pEntry->m_pNextFree = g_pFreeMegamorphicEntries;
+        g_pFreeMegamorphicEntries = pEntry;
+        pEntry = pNextEntry;
+    }
+
+    g_pDiscardedMegamorphicEntries = NULL;
+}
+
+#endif // FEATURE_CID_MEGAMORPHIC_CACHE
+
 // One time initialization of interface dispatch.
 bool InterfaceDispatch_Initialize()
 {
@@ -445,12 +627,14 @@ PCODE InterfaceDispatch_UpdateDispatchCellCache(InterfaceDispatchCell * pCell, P
 
     if (cOldCacheEntries == CID_MAX_CACHE_SIZE)
     {
-        // We already reached the maximum cache size we wish to allocate. For now don't attempt to cache
-        // the mapping we just did: there's no safe way to update the existing cache right now if it
-        // doesn't have an empty entries. There are schemes that would let us do this at the next GC point
-        // but it's not clear whether we should do this or re-tune the cache max size, we need to measure
-        // this.
+        // We already reached the maximum cache size we wish to allocate. There's no safe way to update the
+        // existing cache right now if it doesn't have empty entries, so the stub keeps missing for new
+        // types. Where available, cache the mapping in the megamorphic cache so the miss path at least
+        // avoids calling the resolver again.
         CID_COUNTER_INC(CacheSizeOverflows);
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+        AddMegamorphicCacheEntry(pCell, pTargetCode, pInstanceType);
+#endif
         return (PCODE)pTargetCode;
     }
 
@@ -12,6 +12,18 @@
 
 #ifdef FEATURE_CACHED_INTERFACE_DISPATCH
 
+// We always allocate cache sizes with a power of 2 number of entries. We have a maximum size we support,
+// defined below.
+#define CID_MAX_CACHE_SIZE_LOG2 6
+#define CID_MAX_CACHE_SIZE      (1 << CID_MAX_CACHE_SIZE_LOG2)
+
+#ifdef FEATURE_NATIVEAOT
+// Cells that outgrow the largest cache size keep caching their resolved targets in a global hash table keyed
+// by cell and instance type, that the cache miss path consults before calling the resolver. This relies on
+// cells and types never being unloaded, which only holds for NativeAOT.
+#define FEATURE_CID_MEGAMORPHIC_CACHE 1
+#endif
+
 // Interface dispatch caches contain an array of these entries. An instance of a cache is paired with a stub
 // that implicitly knows how many entries are contained. These entries must be aligned to twice the alignment
 // of a pointer due to the synchonization mechanism used to update them at runtime.
@@ -55,6 +67,10 @@ inline void InterfaceDispatch_DiscardCacheHeader(InterfaceDispatchCacheHeader *
     return InterfaceDispatch_DiscardCache((InterfaceDispatchCache*)pCache);
 }
 
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+PCODE InterfaceDispatch_SearchMegamorphicCache(InterfaceDispatchCell * pCell, MethodTable* pInstanceType);
+#endif
+
 inline PCODE InterfaceDispatch_SearchDispatchCellCache(InterfaceDispatchCell * pCell, MethodTable* pInstanceType)
 {
     // This function must be implemented in native code so that we do not take a GC while walking the cache
@@ -65,6 +81,11 @@ inline PCODE InterfaceDispatch_SearchDispatchCellCache(InterfaceDispatchCell * p
         for (uint32_t i = 0; i < pCache->m_cEntries; i++, pCacheEntry++)
             if (pCacheEntry->m_pInstanceType == pInstanceType)
                 return pCacheEntry->m_pTargetCode;
+
+#ifdef FEATURE_CID_MEGAMORPHIC_CACHE
+        if (pCache->m_cEntries == CID_MAX_CACHE_SIZE)
+            return InterfaceDispatch_SearchMegamorphicCache(pCell, pInstanceType);
+#endif
     }
 
     return (PCODE)nullptr;
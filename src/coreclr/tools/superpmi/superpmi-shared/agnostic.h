@@ -191,6 +191,7 @@ struct Agnostic_CORINFO_EE_INFO
     DWORD maxUncheckedOffsetForNullObject;
     DWORD targetAbi;
     DWORD osType;
+    DWORDLONG profilerEnterLeaveSamplingFlag;
 };
 
 struct Agnostic_CORINFO_ASYNC_INFO
@@ -560,6 +561,8 @@ struct Agnostic_GetThreadLocalStaticBlocksInfo
     DWORD                         offsetOfMaxThreadStaticBlocks;
     DWORD                         offsetOfThreadStaticBlocks;
     DWORD                         offsetOfBaseOfThreadLocalData;
+    DWORD                         offsetOfMaxCollectibleThreadStaticBlocks;
+    DWORD                         offsetOfCollectibleThreadStaticBlocks;
 };
 
 struct Agnostic_GetThreadStaticInfo_NativeAOT
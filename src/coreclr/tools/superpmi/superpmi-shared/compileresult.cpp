@@ -34,6 +34,8 @@ CompileResult::CompileResult()
 
     MethodFullName = nullptr;
     TieringName = nullptr;
+    BytesAllocatedByKind = nullptr;
+    BytesAllocatedByKindCount = 0;
     memoryTracker = nullptr;
 
 #define JITMETADATAINFO(name, type, flags)
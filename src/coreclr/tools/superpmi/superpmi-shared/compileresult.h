@@ -225,6 +225,9 @@ public:
     const char* MethodFullName;
     // Reported compilation tier from JIT
     const char* TieringName;
+    // Reported arena bytes per CompMemKind (only with a MEASURE_MEM_ALLOC JIT)
+    const int64_t* BytesAllocatedByKind;
+    unsigned       BytesAllocatedByKindCount;
 
     // not persisted to disk.
 public:
@@ -3732,6 +3732,8 @@ void MethodContext::recGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     value.offsetOfMaxThreadStaticBlocks         = pInfo->offsetOfMaxThreadStaticBlocks;
     value.offsetOfThreadStaticBlocks            = pInfo->offsetOfThreadStaticBlocks;
     value.offsetOfBaseOfThreadLocalData         = pInfo->offsetOfBaseOfThreadLocalData;
+    value.offsetOfMaxCollectibleThreadStaticBlocks = pInfo->offsetOfMaxCollectibleThreadStaticBlocks;
+    value.offsetOfCollectibleThreadStaticBlocks = pInfo->offsetOfCollectibleThreadStaticBlocks;
 
     // This data is same for entire process, so just add it against key '0'.
     DWORD key = 0;
@@ -3747,10 +3749,13 @@ void MethodContext::dmpGetThreadLocalStaticBlocksInfo(DWORD key, const Agnostic_
            ", offsetOfThreadLocalStoragePointer-%u"
            ", offsetOfMaxThreadStaticBlocks-%u"
            ", offsetOfThreadStaticBlocks-%u"
-           ", offsetOfBaseOfThreadLocalData-%u",
+           ", offsetOfBaseOfThreadLocalData-%u"
+           ", offsetOfMaxCollectibleThreadStaticBlocks-%u"
+           ", offsetOfCollectibleThreadStaticBlocks-%u",
            key, SpmiDumpHelper::DumpAgnostic_CORINFO_CONST_LOOKUP(value.tlsIndex).c_str(), value.tlsGetAddrFtnPtr,
            value.tlsIndexObject, value.threadVarsSection, value.offsetOfThreadLocalStoragePointer,
-           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData);
+           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData,
+           value.offsetOfMaxCollectibleThreadStaticBlocks, value.offsetOfCollectibleThreadStaticBlocks);
 }
 
 void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOCKS_INFO* pInfo)
@@ -3768,6 +3773,8 @@ void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     pInfo->offsetOfMaxThreadStaticBlocks        = value.offsetOfMaxThreadStaticBlocks;
     pInfo->offsetOfThreadStaticBlocks           = value.offsetOfThreadStaticBlocks;
     pInfo->offsetOfBaseOfThreadLocalData        = value.offsetOfBaseOfThreadLocalData;
+    pInfo->offsetOfMaxCollectibleThreadStaticBlocks = value.offsetOfMaxCollectibleThreadStaticBlocks;
+    pInfo->offsetOfCollectibleThreadStaticBlocks = value.offsetOfCollectibleThreadStaticBlocks;
 }
 
 void MethodContext::recGetThreadLocalStaticInfo_NativeAOT(CORINFO_THREAD_STATIC_INFO_NATIVEAOT* pInfo)
@@ -4421,6 +4428,7 @@ void MethodContext::recGetEEInfo(CORINFO_EE_INFO* pEEInfoOut)
     value.maxUncheckedOffsetForNullObject            = (DWORD)pEEInfoOut->maxUncheckedOffsetForNullObject;
     value.targetAbi                                  = (DWORD)pEEInfoOut->targetAbi;
     value.osType                                     = (DWORD)pEEInfoOut->osType;
+    value.profilerEnterLeaveSamplingFlag             = CastPointer(pEEInfoOut->profilerEnterLeaveSamplingFlag);
 
     GetEEInfo->Add(0, value);
     DEBUG_REC(dmpGetEEInfo(0, value));
@@ -4428,7 +4436,7 @@ void MethodContext::recGetEEInfo(CORINFO_EE_INFO* pEEInfoOut)
 void MethodContext::dmpGetEEInfo(DWORD key, const Agnostic_CORINFO_EE_INFO& value)
 {
     printf("GetEEInfo key %u, value icfi{sz-%u sz-witharg-%u ofl-%u ocsp-%u ocsfp-%u oct-%u ora-%u ossa-%u osap-%u} "
-           "otf-%u ogcs-%u odi-%u odft-%u osdic-%u srpf-%u osps-%u muono-%u tabi-%u osType-%u",
+           "otf-%u ogcs-%u odi-%u odft-%u osdic-%u srpf-%u osps-%u muono-%u tabi-%u osType-%u pelsf-%016" PRIX64,
            key, value.inlinedCallFrameInfo.size, value.inlinedCallFrameInfo.sizeWithSecretStubArg,
            value.inlinedCallFrameInfo.offsetOfFrameLink,
            value.inlinedCallFrameInfo.offsetOfCallSiteSP, value.inlinedCallFrameInfo.offsetOfCalleeSavedFP,
@@ -4437,7 +4445,7 @@ void MethodContext::dmpGetEEInfo(DWORD key, const Agnostic_CORINFO_EE_INFO& valu
            value.offsetOfThreadFrame, value.offsetOfGCState, value.offsetOfDelegateInstance,
            value.offsetOfDelegateFirstTarget, value.offsetOfWrapperDelegateIndirectCell,
            value.sizeOfReversePInvokeFrame, value.osPageSize, value.maxUncheckedOffsetForNullObject, value.targetAbi,
-           value.osType);
+           value.osType, value.profilerEnterLeaveSamplingFlag);
 }
 void MethodContext::repGetEEInfo(CORINFO_EE_INFO* pEEInfoOut)
 {
@@ -4466,6 +4474,7 @@ void MethodContext::repGetEEInfo(CORINFO_EE_INFO* pEEInfoOut)
     pEEInfoOut->maxUncheckedOffsetForNullObject    = (size_t)value.maxUncheckedOffsetForNullObject;
     pEEInfoOut->targetAbi                          = (CORINFO_RUNTIME_ABI)value.targetAbi;
     pEEInfoOut->osType                             = (CORINFO_OS)value.osType;
+    pEEInfoOut->profilerEnterLeaveSamplingFlag     = (void*)value.profilerEnterLeaveSamplingFlag;
 }
 
 void MethodContext::recGetAsyncInfo(const CORINFO_ASYNC_INFO* pAsyncInfo)
@@ -126,6 +126,29 @@ void CommandLine::DumpHelp(const char* program)
     printf("     Number of times compilation should repeat for each method context. Usually used when\n");
     printf("     trying to measure JIT throughput for a specific set of methods. Default=1.\n");
     printf("\n");
+    printf(" -memStats <file name.csv>\n");
+    printf("     Emit the JIT arena memory used by each method in CSV format, and log a summary.\n");
+    printf("     With two JITs, both are recorded and the summary shows the deltas. JITs built with\n");
+    printf("     MEASURE_MEM_ALLOC (e.g. Checked) also report the bytes per CompMemKind.\n");
+    printf("\n");
+    printf(" -tpDiff <file name.csv>\n");
+    printf("     Throughput diff mode. Requires two JITs. Each method is compiled 'tpSamples' times by each\n");
+    printf("     JIT (plus 'repeatCount' replays), and the cycle counts are compared per method with a\n");
+    printf("     Mann-Whitney U test. Per-method results are written to the CSV file, and the total delta\n");
+    printf("     and the largest statistically significant (99%%) regressions are logged.\n");
+    printf("     For a per-phase breakdown, also pass -jitoption JitTimeLogCsv=base.csv and\n");
+    printf("     -jit2option JitTimeLogCsv=diff.csv to JITs built with FEATURE_JIT_METHOD_PERF;\n");
+    printf("     their 'SPMI Index' column matches the 'Context' column of the tpDiff CSV.\n");
+    printf("\n");
+    printf(" -tpSamples <count>\n");
+    printf("     Number of timed compiles per method and JIT in throughput diff mode. Default=10.\n");
+    printf("\n");
+    printf(" -tpTop <count>\n");
+    printf("     Number of regressed methods to list in throughput diff mode. Default=20.\n");
+    printf("\n");
+    printf(" -tpPinCpu <processor>\n");
+    printf("     Pin the replay to the given processor to reduce timing noise.\n");
+    printf("\n");
     printf(" -target <target>\n");
     printf("     Specifies the target architecture if doing cross-compilation.\n");
     printf("     Allowed <target> values: x64, x86, arm, arm64, loongarch64, riscv64\n");
@@ -582,6 +605,77 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
                     return false;
                 }
             }
+            else if ((_stricmp(&argv[i][1], "memStats") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->memoryStatsFile = argv[i];
+            }
+            else if ((_stricmp(&argv[i][1], "tpDiff") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->throughputDiffFile = argv[i];
+            }
+            else if ((_stricmp(&argv[i][1], "tpSamples") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->throughputSamples = atoi(argv[i]);
+
+                if (o->throughputSamples < 1)
+                {
+                    LogError("Incorrect count specified for -tpSamples. Count must be > 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
+            else if ((_stricmp(&argv[i][1], "tpTop") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->throughputTopCount = atoi(argv[i]);
+
+                if (o->throughputTopCount < 0)
+                {
+                    LogError("Incorrect count specified for -tpTop. Count must be >= 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
+            else if ((_stricmp(&argv[i][1], "tpPinCpu") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->pinCpu = atoi(argv[i]);
+
+                if (o->pinCpu < 0)
+                {
+                    LogError("Incorrect processor specified for -tpPinCpu. Processor must be >= 0.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_strnicmp(&argv[i][1], "stride", argLen) == 0))
             {
                 // "-stride" is an internal switch used by -parallel. Usage is:
@@ -875,6 +969,28 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
         }
     }
 
+    if ((o->memoryStatsFile != nullptr) && (o->parallel || (o->streamFile != nullptr)))
+    {
+        LogError("-memStats is incompatible with parallel and streaming modes.");
+        return false;
+    }
+
+    if (o->throughputDiffFile != nullptr)
+    {
+        if (o->nameOfJit2 == nullptr)
+        {
+            LogError("-tpDiff requires two JITs.");
+            DumpHelp(argv[0]);
+            return false;
+        }
+
+        if (o->parallel || (o->streamFile != nullptr))
+        {
+            LogError("-tpDiff is incompatible with parallel and streaming modes.");
+            return false;
+        }
+    }
+
     if (o->skipCleanup && !o->parallel)
     {
         LogError("-skipCleanup requires -parallel.");
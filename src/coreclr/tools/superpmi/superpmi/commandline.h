@@ -26,6 +26,11 @@ public:
         bool  applyDiff = false;
         bool  parallel = false;        // User specified to use /parallel mode.
         char* streamFile = nullptr;
+        char* memoryStatsFile = nullptr;    // Write per-method JIT arena memory usage to this CSV.
+        char* throughputDiffFile = nullptr; // Compare per-method compile time of the two JITs, writing this CSV.
+        int   throughputSamples = 10;       // Number of timed compiles per method and JIT.
+        int   throughputTopCount = 20;      // Number of regressed methods to list in the summary.
+        int   pinCpu = -1;                  // Processor to pin the replay to, or -1.
 #if !defined(USE_MSVCDIS) && defined(USE_COREDISTOOLS)
         bool  useCoreDisTools = true; // Use CoreDisTools library instead of Msvcdis
 #else
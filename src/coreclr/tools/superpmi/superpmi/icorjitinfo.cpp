@@ -1077,6 +1077,15 @@ void MyICJI::reportMetadata(const char* key, const void* value, size_t length)
         return;
     }
 
+    if ((strcmp(key, "BytesAllocatedByKind") == 0) && (length % sizeof(int64_t) == 0))
+    {
+        int64_t* buf = static_cast<int64_t*>(jitInstance->mc->cr->allocateMemory(length));
+        memcpy(buf, value, length);
+        jitInstance->mc->cr->BytesAllocatedByKind = buf;
+        jitInstance->mc->cr->BytesAllocatedByKindCount = (unsigned)(length / sizeof(int64_t));
+        return;
+    }
+
 #define JITMETADATAINFO(name, type, flags)
 #define JITMETADATAMETRIC(name, type, flags) \
     if ((strcmp(key, #name) == 0) && (length == sizeof(type)))   \
@@ -230,6 +230,7 @@ ReplayResults JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcI
 
     times[0] = 0;
     times[1] = 0;
+    timeSamples.clear();
 
     stj.Start();
 
@@ -400,10 +401,12 @@ void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
     uint8_t* NEntryBlock    = nullptr;
     uint32_t NCodeSizeBlock = 0;
 
-    int sampleSize = 10;
+    int sampleSize = timeSampleCount;
     // Save 2 smallest times. To help reduce noise, we will look at the closest pair of these.
     uint64_t time;
 
+    timeSamples.reserve(sampleSize);
+
     for (int i = 0; i < sampleSize; i++)
     {
         delete mc->cr;
@@ -412,6 +415,7 @@ void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
         pJitInstance->compileMethod(icji, &info, flags, &NEntryBlock, &NCodeSizeBlock);
         lt.Stop();
         time = lt.GetCycles();
+        timeSamples.push_back(time);
         if (times[1] == 0)
         {
             if (time < times[0])
@@ -50,6 +50,9 @@ public:
     CycleTimer       lt;
     MethodContext*   mc;
     ULONGLONG        times[2];
+    // Cycle counts of every timed compile of the last method, when collecting throughput.
+    std::vector<uint64_t> timeSamples;
+    int              timeSampleCount = 10;
     ICorJitCompiler* pJitInstance;
 
     // Allocate and initialize the jit provided
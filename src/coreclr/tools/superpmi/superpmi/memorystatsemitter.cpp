@@ -0,0 +1,165 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// MemoryStatsEmitter.cpp - Emits per-method JIT arena memory usage for analysis
+//
+// The JIT reports the bytes it handed out of its arena (BytesAllocated) and the
+// size of the arena pages backing them (ArenaBytesAllocated, the peak footprint
+// of the compile) in all builds. JITs built with MEASURE_MEM_ALLOC also report
+// the bytes handed out per CompMemKind.
+//-----------------------------------------------------------------------------
+
+#include "standardpch.h"
+#include "memorystatsemitter.h"
+#include "logging.h"
+
+static const char* const s_compMemKindNames[] = {
+#define CompMemKindMacro(kind) #kind,
+#include "../../../jit/compmemkind.h"
+};
+
+static const unsigned s_compMemKindCount = ARRAY_SIZE(s_compMemKindNames);
+
+bool MemoryStatsEmitter::Initialize(const char* csvFileName, bool withDiff)
+{
+    hasDiff = withDiff;
+
+    if (!FileWriter::CreateNew(csvFileName, &csv))
+    {
+        LogError("Could not create file %s", csvFileName);
+        return false;
+    }
+
+    return true;
+}
+
+void MemoryStatsEmitter::WriteHeader(const CompileResult* baseResult)
+{
+    // Only break down by kind when the JIT's kinds match the ones we were built with.
+    hasKinds = baseResult->BytesAllocatedByKindCount == s_compMemKindCount;
+    if ((baseResult->BytesAllocatedByKindCount != 0) && !hasKinds)
+    {
+        LogWarning("JIT reported %u memory kinds, expected %u; not emitting per-kind stats.",
+                   baseResult->BytesAllocatedByKindCount, s_compMemKindCount);
+    }
+
+    base.bytesByKind.resize(s_compMemKindCount);
+    diff.bytesByKind.resize(s_compMemKindCount);
+
+    csv.Print("Context,Method full name");
+    for (int i = 0; i < (hasDiff ? 2 : 1); i++)
+    {
+        const char* prefix = (i == 0) ? (hasDiff ? "Base " : "") : "Diff ";
+        csv.Printf(",%sArenaBytesAllocated,%sBytesAllocated", prefix, prefix);
+        if (hasKinds)
+        {
+            for (unsigned cmk = 0; cmk < s_compMemKindCount; cmk++)
+            {
+                csv.Printf(",%s%s", prefix, s_compMemKindNames[cmk]);
+            }
+        }
+    }
+    csv.Print("\n");
+
+    headerWritten = true;
+}
+
+void MemoryStatsEmitter::WriteResult(Totals& totals, int mcIndex, const CompileResult* result)
+{
+    totals.arenaBytes += result->ArenaBytesAllocated;
+    totals.bytesUsed += result->BytesAllocated;
+    if (result->ArenaBytesAllocated > totals.maxArenaBytes)
+    {
+        totals.maxArenaBytes  = result->ArenaBytesAllocated;
+        totals.maxArenaMethod = mcIndex;
+    }
+
+    csv.Printf(",%lld,%lld", (long long)result->ArenaBytesAllocated, (long long)result->BytesAllocated);
+
+    if (hasKinds)
+    {
+        bool kindsReported = result->BytesAllocatedByKindCount == s_compMemKindCount;
+        for (unsigned cmk = 0; cmk < s_compMemKindCount; cmk++)
+        {
+            int64_t bytes = kindsReported ? result->BytesAllocatedByKind[cmk] : 0;
+            totals.bytesByKind[cmk] += bytes;
+            csv.Printf(",%lld", (long long)bytes);
+        }
+    }
+}
+
+void MemoryStatsEmitter::Emit(int mcIndex, const CompileResult* baseResult, const CompileResult* diffResult)
+{
+    assert((diffResult != nullptr) == hasDiff);
+
+    if (!headerWritten)
+    {
+        WriteHeader(baseResult);
+    }
+
+    methodCount++;
+
+    csv.Printf("%d,", mcIndex);
+    csv.PrintQuotedCsvField(baseResult->MethodFullName == nullptr ? "" : baseResult->MethodFullName);
+    WriteResult(base, mcIndex, baseResult);
+    if (hasDiff)
+    {
+        WriteResult(diff, mcIndex, diffResult);
+    }
+    csv.Print("\n");
+}
+
+static void LogMemoryRow(const char* name, int64_t baseValue, int64_t diffValue, bool hasDiff)
+{
+    if (!hasDiff)
+    {
+        LogInfo("  %-24s %14lld", name, (long long)baseValue);
+        return;
+    }
+
+    double percent = (baseValue == 0) ? 0 : 100.0 * ((double)diffValue - (double)baseValue) / (double)baseValue;
+    LogInfo("  %-24s %14lld %14lld %+8.2f%%", name, (long long)baseValue, (long long)diffValue, percent);
+}
+
+void MemoryStatsEmitter::Report()
+{
+    csv.Flush();
+
+    LogInfo("Memory stats for %d methods:", methodCount);
+    if (methodCount == 0)
+    {
+        return;
+    }
+
+    if (hasDiff)
+    {
+        LogInfo("  %-24s %14s %14s %9s", "", "Base", "Diff", "Delta");
+    }
+    LogMemoryRow("Arena bytes", base.arenaBytes, diff.arenaBytes, hasDiff);
+    LogMemoryRow("Arena bytes per method", base.arenaBytes / methodCount, diff.arenaBytes / methodCount, hasDiff);
+    LogMemoryRow("Max arena bytes", base.maxArenaBytes, diff.maxArenaBytes, hasDiff);
+    LogMemoryRow("Bytes allocated", base.bytesUsed, diff.bytesUsed, hasDiff);
+    LogMemoryRow("Bytes per method", base.bytesUsed / methodCount, diff.bytesUsed / methodCount, hasDiff);
+
+    if (hasDiff)
+    {
+        LogInfo("  Largest arena: base method %d, diff method %d", base.maxArenaMethod, diff.maxArenaMethod);
+    }
+    else
+    {
+        LogInfo("  Largest arena: method %d", base.maxArenaMethod);
+    }
+
+    if (hasKinds)
+    {
+        LogInfo("  Bytes allocated by kind:");
+        for (unsigned cmk = 0; cmk < s_compMemKindCount; cmk++)
+        {
+            if ((base.bytesByKind[cmk] != 0) || (diff.bytesByKind[cmk] != 0))
+            {
+                LogMemoryRow(s_compMemKindNames[cmk], base.bytesByKind[cmk], diff.bytesByKind[cmk], hasDiff);
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// MemoryStatsEmitter.h - Emits per-method JIT arena memory usage for analysis
+//-----------------------------------------------------------------------------
+#ifndef _MemoryStatsEmitter
+#define _MemoryStatsEmitter
+
+#include "fileio.h"
+#include "compileresult.h"
+
+class MemoryStatsEmitter
+{
+    struct Totals
+    {
+        int64_t              arenaBytes     = 0;
+        int64_t              bytesUsed      = 0;
+        int64_t              maxArenaBytes  = 0;
+        int                  maxArenaMethod = -1;
+        std::vector<int64_t> bytesByKind;
+    };
+
+    FileWriter csv;
+    bool       hasDiff;
+    bool       headerWritten = false;
+    bool       hasKinds      = false;
+    int        methodCount   = 0;
+    Totals     base;
+    Totals     diff;
+
+    void WriteHeader(const CompileResult* baseResult);
+    void WriteResult(Totals& totals, int mcIndex, const CompileResult* result);
+
+public:
+    bool Initialize(const char* csvFileName, bool withDiff);
+
+    // Record the memory usage of one successful compile. 'diffResult' is the second
+    // JIT's result, and must be non-null exactly when initialized 'withDiff'.
+    void Emit(int mcIndex, const CompileResult* baseResult, const CompileResult* diffResult);
+
+    // Log totals, averages, maxima and the per-CompMemKind breakdown.
+    void Report();
+};
+
+#endif
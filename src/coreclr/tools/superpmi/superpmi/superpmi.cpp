@@ -17,6 +17,8 @@
 #include "methodcontextreader.h"
 #include "mclist.h"
 #include "methodstatsemitter.h"
+#include "throughputdiffer.h"
+#include "memorystatsemitter.h"
 #include "spmiutil.h"
 #include "fileio.h"
 
@@ -244,6 +246,8 @@ int __cdecl main(int argc, char* argv[])
     JitInstance* jit = nullptr;
     JitInstance* jit2 = nullptr;
     MethodStatsEmitter* methodStatsEmitter = nullptr;
+    ThroughputDiffer*   throughputDiffer   = nullptr;
+    MemoryStatsEmitter* memoryStatsEmitter = nullptr;
 
 #ifdef SuperPMI_ChewMemory
     // Chew up the base 2gb of memory on x86... helpful in finding any places where classhandles etc are de-ref'd
@@ -287,6 +291,30 @@ int __cdecl main(int argc, char* argv[])
         collectThroughput = true;
     }
 
+    if (o.throughputDiffFile != nullptr)
+    {
+        collectThroughput = true;
+        throughputDiffer  = new ThroughputDiffer();
+        if (!throughputDiffer->Initialize(o.throughputDiffFile))
+        {
+            return (int)SpmiResult::GeneralFailure;
+        }
+    }
+
+    if (o.memoryStatsFile != nullptr)
+    {
+        memoryStatsEmitter = new MemoryStatsEmitter();
+        if (!memoryStatsEmitter->Initialize(o.memoryStatsFile, o.nameOfJit2 != nullptr))
+        {
+            return (int)SpmiResult::GeneralFailure;
+        }
+    }
+
+    if ((o.pinCpu >= 0) && !PinCurrentThreadToCpu(o.pinCpu))
+    {
+        return (int)SpmiResult::GeneralFailure;
+    }
+
     LogVerbose("Using jit(%s) with input (%s)", o.nameOfJit, o.nameOfInputMethodContextFile);
     std::string indexesStr = " indexCount=";
     indexesStr += std::to_string(o.indexCount);
@@ -433,6 +461,7 @@ int __cdecl main(int argc, char* argv[])
                     // InitJit already printed a failure message
                     return (int)SpmiResult::JitFailedToInit;
                 }
+                jit->timeSampleCount = o.throughputSamples;
 
                 if (o.nameOfJit2 != nullptr)
                 {
@@ -443,6 +472,7 @@ int __cdecl main(int argc, char* argv[])
                         // InitJit already printed a failure message
                         return (int)SpmiResult::JitFailedToInit;
                     }
+                    jit2->timeSampleCount = o.throughputSamples;
                 }
             }
 
@@ -555,6 +585,12 @@ int __cdecl main(int argc, char* argv[])
 
             if ((res.Result == ReplayResult::Success) && (res2.Result == ReplayResult::Success))
             {
+                if (memoryStatsEmitter != nullptr)
+                {
+                    memoryStatsEmitter->Emit(reader->GetMethodContextIndex(), res.CompileResults,
+                                             (o.nameOfJit2 != nullptr) ? res2.CompileResults : nullptr);
+                }
+
                 if (collectThroughput)
                 {
                     if ((o.nameOfJit2 != nullptr) && (res2.Result == ReplayResult::Success))
@@ -630,6 +666,13 @@ int __cdecl main(int argc, char* argv[])
                             methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
                                                      mc->cr->clockCyclesToCompile);
                         }
+
+                        if (throughputDiffer != nullptr)
+                        {
+                            throughputDiffer->AddSamples(reader->GetMethodContextIndex(),
+                                                         res2.CompileResults->MethodFullName, jit->timeSamples,
+                                                         jit2->timeSamples);
+                        }
                     }
                     else
                     {
@@ -784,6 +827,18 @@ int __cdecl main(int argc, char* argv[])
 doneRepeatCount:
     delete reader;
 
+    if (throughputDiffer != nullptr)
+    {
+        throughputDiffer->Report(o.throughputTopCount);
+        delete throughputDiffer;
+    }
+
+    if (memoryStatsEmitter != nullptr)
+    {
+        memoryStatsEmitter->Report();
+        delete memoryStatsEmitter;
+    }
+
     // NOTE: these output status strings are parsed by parallelsuperpmi.cpp::ProcessChildStdOut().
     if (o.applyDiff)
     {
@@ -0,0 +1,197 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// ThroughputDiffer.cpp - Compares per-method compile time of two JITs
+//
+// Each method is compiled repeatedly by both JITs (see JitInstance::timeResult)
+// and the two sets of cycle counts are compared with a Mann-Whitney U test, so
+// a method is only reported as regressed when the difference is larger than
+// what the timing noise on this machine explains.
+//-----------------------------------------------------------------------------
+
+#include "standardpch.h"
+#include "throughputdiffer.h"
+#include "logging.h"
+
+#if defined(HOST_LINUX)
+#include <sched.h>
+#endif
+
+// Two-sided 99% confidence.
+static const double SignificantZScore = 2.576;
+
+bool ThroughputDiffer::Initialize(const char* csvFileName)
+{
+    if (!FileWriter::CreateNew(csvFileName, &csv))
+    {
+        LogError("Could not create file %s", csvFileName);
+        return false;
+    }
+
+    csv.Print("Context,Method full name,Samples,Base cycles,Diff cycles,Delta cycles,Delta %,Z score,Significant\n");
+    return true;
+}
+
+void ThroughputDiffer::AddSamples(int                          mcIndex,
+                                  const char*                  methodName,
+                                  const std::vector<uint64_t>& baseSamples,
+                                  const std::vector<uint64_t>& diffSamples)
+{
+    if (baseSamples.empty() || diffSamples.empty())
+    {
+        return;
+    }
+
+    if (methods.empty() || (methods.back().mcIndex != mcIndex))
+    {
+        MethodSamples method;
+        method.mcIndex    = mcIndex;
+        method.methodName = (methodName == nullptr) ? "" : methodName;
+        method.baseMin    = 0;
+        method.diffMin    = 0;
+        method.zScore     = 0;
+        methods.push_back(std::move(method));
+    }
+
+    MethodSamples& method = methods.back();
+    method.baseSamples.insert(method.baseSamples.end(), baseSamples.begin(), baseSamples.end());
+    method.diffSamples.insert(method.diffSamples.end(), diffSamples.begin(), diffSamples.end());
+}
+
+//------------------------------------------------------------------------
+// MannWhitneyZ: Normal approximation of the Mann-Whitney U statistic.
+//
+// Returns:
+//    A positive value when the diff samples tend to be larger (slower) than
+//    the base samples. Ties count as half.
+//
+double ThroughputDiffer::MannWhitneyZ(const std::vector<uint64_t>& base, const std::vector<uint64_t>& diff)
+{
+    double n1 = (double)base.size();
+    double n2 = (double)diff.size();
+    double u  = 0;
+
+    for (uint64_t d : diff)
+    {
+        for (uint64_t b : base)
+        {
+            if (d > b)
+                u += 1;
+            else if (d == b)
+                u += 0.5;
+        }
+    }
+
+    double mean   = n1 * n2 / 2;
+    double stdDev = sqrt(n1 * n2 * (n1 + n2 + 1) / 12);
+    return (stdDev == 0) ? 0 : (u - mean) / stdDev;
+}
+
+void ThroughputDiffer::Summarize(MethodSamples& method)
+{
+    // Timing noise only ever adds cycles, so the fastest compile is the best estimate of the cost.
+    method.baseMin = *std::min_element(method.baseSamples.begin(), method.baseSamples.end());
+    method.diffMin = *std::min_element(method.diffSamples.begin(), method.diffSamples.end());
+    method.zScore  = MannWhitneyZ(method.baseSamples, method.diffSamples);
+}
+
+void ThroughputDiffer::Report(int topCount)
+{
+    uint64_t totalBase         = 0;
+    uint64_t totalDiff         = 0;
+    int      significantSlower = 0;
+    int      significantFaster = 0;
+
+    for (MethodSamples& method : methods)
+    {
+        Summarize(method);
+
+        int64_t delta        = (int64_t)method.diffMin - (int64_t)method.baseMin;
+        double  deltaPercent = (method.baseMin == 0) ? 0 : 100.0 * delta / method.baseMin;
+        bool    significant  = fabs(method.zScore) >= SignificantZScore;
+
+        totalBase += method.baseMin;
+        totalDiff += method.diffMin;
+        if (significant)
+        {
+            if (method.zScore > 0)
+                significantSlower++;
+            else
+                significantFaster++;
+        }
+
+        csv.Printf("%d,", method.mcIndex);
+        csv.PrintQuotedCsvField(method.methodName.c_str());
+        csv.Printf(",%u,%llu,%llu,%lld,%.2f,%.2f,%s\n", (unsigned)method.diffSamples.size(),
+                   (unsigned long long)method.baseMin, (unsigned long long)method.diffMin, (long long)delta,
+                   deltaPercent, method.zScore, significant ? "True" : "False");
+    }
+    csv.Flush();
+
+    double totalPercent = (totalBase == 0) ? 0 : 100.0 * ((double)totalDiff - (double)totalBase) / totalBase;
+    LogInfo("Throughput diff: %d methods, base %llu cycles, diff %llu cycles (%+.2f%%)", (int)methods.size(),
+            (unsigned long long)totalBase, (unsigned long long)totalDiff, totalPercent);
+    LogInfo("Throughput diff: %d methods significantly slower, %d significantly faster", significantSlower,
+            significantFaster);
+
+    std::vector<const MethodSamples*> regressions;
+    for (const MethodSamples& method : methods)
+    {
+        if ((method.zScore >= SignificantZScore) && (method.diffMin > method.baseMin))
+        {
+            regressions.push_back(&method);
+        }
+    }
+
+    std::sort(regressions.begin(), regressions.end(), [](const MethodSamples* a, const MethodSamples* b) {
+        return (a->diffMin - a->baseMin) > (b->diffMin - b->baseMin);
+    });
+
+    if (regressions.size() > (size_t)topCount)
+    {
+        regressions.resize(topCount);
+    }
+
+    for (const MethodSamples* method : regressions)
+    {
+        LogInfo("  +%llu cycles (%+.2f%%) method %d %s", (unsigned long long)(method->diffMin - method->baseMin),
+                100.0 * (method->diffMin - method->baseMin) / method->baseMin, method->mcIndex,
+                method->methodName.c_str());
+    }
+}
+
+//------------------------------------------------------------------------
+// PinCurrentThreadToCpu: Keep the replay on one processor, so timings don't
+// pick up migrations and frequency differences between cores.
+//
+bool PinCurrentThreadToCpu(int cpu)
+{
+#if defined(TARGET_WINDOWS)
+    if ((cpu < 0) || (cpu >= (int)(sizeof(DWORD_PTR) * 8)) ||
+        (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) == 0))
+    {
+        LogError("Failed to pin to processor %d. GetLastError()=%u", cpu, GetLastError());
+        return false;
+    }
+    return true;
+#elif defined(HOST_LINUX)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE))
+    {
+        LogError("Failed to pin to processor %d.", cpu);
+        return false;
+    }
+    CPU_SET(cpu, &cpuSet);
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        LogError("Failed to pin to processor %d.", cpu);
+        return false;
+    }
+    return true;
+#else
+    LogWarning("Pinning to a processor is not supported on this platform; -tpPinCpu %d ignored.", cpu);
+    return true;
+#endif
+}
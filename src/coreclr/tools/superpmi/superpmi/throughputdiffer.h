@@ -0,0 +1,47 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//-----------------------------------------------------------------------------
+// ThroughputDiffer.h - Compares per-method compile time of two JITs
+//-----------------------------------------------------------------------------
+#ifndef _ThroughputDiffer
+#define _ThroughputDiffer
+
+#include "fileio.h"
+
+class ThroughputDiffer
+{
+    struct MethodSamples
+    {
+        int                   mcIndex;
+        std::string           methodName;
+        std::vector<uint64_t> baseSamples;
+        std::vector<uint64_t> diffSamples;
+        uint64_t              baseMin;
+        uint64_t              diffMin;
+        double                zScore;
+    };
+
+    std::vector<MethodSamples> methods;
+    FileWriter                 csv;
+
+    static void   Summarize(MethodSamples& method);
+    static double MannWhitneyZ(const std::vector<uint64_t>& base, const std::vector<uint64_t>& diff);
+
+public:
+    bool Initialize(const char* csvFileName);
+
+    // Add the timed compiles of one method by both JITs. Samples of consecutive calls for the
+    // same method context (e.g. with -repeatCount) are pooled.
+    void AddSamples(int                          mcIndex,
+                    const char*                  methodName,
+                    const std::vector<uint64_t>& baseSamples,
+                    const std::vector<uint64_t>& diffSamples);
+
+    // Write the per-method CSV and log the totals and the 'topCount' largest significant regressions.
+    void Report(int topCount);
+};
+
+extern bool PinCurrentThreadToCpu(int cpu);
+
+#endif
@@ -17,16 +17,14 @@ BYTE * ExecutableAllocator::g_preferredRangeMax;
 
 bool ExecutableAllocator::g_isWXorXEnabled = false;
 
+size_t ExecutableAllocator::g_commitBatchSize = 0;
+
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
 
-#ifndef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-#define EXECUTABLE_ALLOCATOR_CACHE_SIZE ARRAY_SIZE(m_cachedMapping)
-#else
-int ExecutableAllocator::g_cachedMappingSize = 0;
+size_t ExecutableAllocator::g_cachedMappingSize = 0;
 
 #define EXECUTABLE_ALLOCATOR_CACHE_SIZE ExecutableAllocator::g_cachedMappingSize
-#endif
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
 int64_t ExecutableAllocator::g_mapTimeSum = 0;
@@ -142,6 +140,13 @@ bool ExecutableAllocator::IsWXORXEnabled()
 #endif
 }
 
+size_t ExecutableAllocator::CommitBatchSize()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return g_commitBatchSize;
+}
+
 extern SYSTEM_INFO g_SystemInfo;
 
 size_t ExecutableAllocator::Granularity()
@@ -241,24 +246,15 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
 {
     LIMITED_METHOD_CONTRACT;
 
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    g_cachedMappingSize = ARRAY_SIZE(m_cachedMapping);
-    auto envString = getenv("EXECUTABLE_ALLOCATOR_CACHE_SIZE");
-    if (envString != NULL)
+    g_cachedMappingSize = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ExecutableAllocatorRWCacheSize);
+    if (g_cachedMappingSize == 0)
     {
-        int customCacheSize = atoi(envString);
-        if (customCacheSize != 0)
-        {
-            if ((customCacheSize > ARRAY_SIZE(m_cachedMapping)) || (customCacheSize <= 0))
-            {
-                minipal_log_print_error("Invalid value in 'EXECUTABLE_ALLOCATOR_CACHE_SIZE' environment variable'\n");
-                return E_FAIL;
-            }
-            
-            g_cachedMappingSize = customCacheSize;
-        }
+        g_cachedMappingSize = 1;
+    }
+    else if (g_cachedMappingSize > ARRAY_SIZE(m_cachedMapping))
+    {
+        g_cachedMappingSize = ARRAY_SIZE(m_cachedMapping);
     }
-#endif
 
     g_fatalErrorHandler = fatalErrorHandler;
     g_isWXorXEnabled = Configuration::GetKnobBooleanValue(W("System.Runtime.EnableWriteXorExecute"), CLRConfig::EXTERNAL_EnableWriteXorExecute);
@@ -273,6 +269,13 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
         return E_FAIL;
     }
 
+    // Batching only pays off when commits go through the double mapped views. Otherwise
+    // it would just increase the commit charge of lightly used heaps.
+    if (IsDoubleMappingEnabled())
+    {
+        g_commitBatchSize = ALIGN_UP((size_t)CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_LoaderHeapCommitBatchSize), GetOsPageSize());
+    }
+
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
     s_LoggerCriticalSection = ClrCreateCriticalSection(CrstExecutableAllocatorLock, CrstFlags(CRST_UNSAFE_ANYMODE | CRST_DEBUGGER_THREAD));
 #endif
@@ -304,8 +304,10 @@ BOOL UnlockedLoaderHeap::GetMoreCommittedPages(size_t dwMinSize)
         size_t unusedRemainder = (size_t)((BYTE*)m_pPtrToEndOfCommittedRegion - m_pAllocPtr);
 
         PTR_BYTE pCommitBaseAddress = m_pPtrToEndOfCommittedRegion;
-        if (dwSizeToCommit < m_dwCommitBlockSize)
-            dwSizeToCommit = min((SIZE_T)(m_pEndReservedRegion - m_pPtrToEndOfCommittedRegion), (SIZE_T)m_dwCommitBlockSize);
+        // Batch small commits so that double mapped heaps don't pay for a protection change per page
+        SIZE_T dwCommitBlockSize = max<SIZE_T>(m_dwCommitBlockSize, ExecutableAllocator::CommitBatchSize());
+        if (dwSizeToCommit < dwCommitBlockSize)
+            dwSizeToCommit = min((SIZE_T)(m_pEndReservedRegion - m_pPtrToEndOfCommittedRegion), dwCommitBlockSize);
 
         // Round to page size
         dwSizeToCommit = ALIGN_UP(dwSizeToCommit, GetOsPageSize());
@@ -26,6 +26,7 @@ bool StressLogChunk::s_memoryMapped = false;
 #endif
 thread_local ThreadStressLog* StressLog::t_pCurrentThreadLog;
 thread_local bool t_triedToCreateThreadStressLog;
+bool StressLog::s_fixedChunkRings = false;
 #endif // !STRESS_LOG_READONLY
 
 /*********************************************************************************/
@@ -59,10 +60,56 @@ uint64_t getTimeStamp() {
 }
 
 #else // HOST_X86
+
+#if defined(HOST_AMD64) || defined(HOST_ARM64)
+#define STRESS_LOG_CYCLE_COUNTER
+
+/* When the low overhead mode is on, messages are stamped with the raw CPU cycle
+   counter instead of going through the OS clock. The matching frequency is
+   calibrated against minipal_hires_ticks and stored in the log, so dump tools
+   convert the stamps exactly as they do for the default time source.
+*/
+static bool s_useCycleCounter = false;
+
+#if defined(HOST_AMD64) && defined(_MSC_VER)
+extern "C" uint64_t __rdtsc();
+#pragma intrinsic(__rdtsc)
+#endif // HOST_AMD64 && _MSC_VER
+
+static FORCEINLINE uint64_t getCycleCounter()
+{
+#if defined(HOST_AMD64)
+#ifdef _MSC_VER
+    return __rdtsc();
+#else // _MSC_VER
+    uint32_t lo;
+    uint32_t hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t)hi << 32) | lo;
+#endif // _MSC_VER
+#else // HOST_AMD64
+#ifdef _MSC_VER
+    return (uint64_t)_ReadStatusReg(ARM64_CNTVCT);
+#else // _MSC_VER
+    uint64_t ticks;
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (ticks));
+    return ticks;
+#endif // _MSC_VER
+#endif // HOST_AMD64
+}
+#endif // HOST_AMD64 || HOST_ARM64
+
 uint64_t getTimeStamp()
 {
     STATIC_CONTRACT_LEAF;
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+    if (s_useCycleCounter)
+    {
+        return getCycleCounter();
+    }
+#endif // STRESS_LOG_CYCLE_COUNTER
+
     return (uint64_t)minipal_hires_ticks();
 }
 
@@ -129,11 +176,77 @@ uint64_t getTickFrequency()
 
 #endif // HOST_X86
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+
+// Cycle counter and OS clock readings taken when the log was initialized; the
+// cycle counter frequency is derived from how far both have moved since.
+static uint64_t s_calibrationCycles;
+static int64_t s_calibrationTicks;
+
+/*********************************************************************************/
+/* Get the frequency of the cycle counter. On Linux ARM64 the architectural
+   counter frequency is read directly; everywhere else it is measured against
+   the OS clock, which gets more precise the longer the process runs.
+*/
+static uint64_t getCycleCounterFrequency()
+{
+#if defined(HOST_ARM64) && !defined(_MSC_VER)
+    uint64_t freq;
+    __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (freq));
+    if (freq != 0)
+    {
+        return freq;
+    }
+#endif // HOST_ARM64 && !_MSC_VER
+
+    int64_t elapsedTicks = minipal_hires_ticks() - s_calibrationTicks;
+    uint64_t elapsedCycles = getCycleCounter() - s_calibrationCycles;
+    if (elapsedTicks <= 0)
+    {
+        return 0;
+    }
+
+    // Go through double so the product doesn't overflow for long running processes.
+    return (uint64_t)((double)elapsedCycles * (double)minipal_hires_tick_frequency() / (double)elapsedTicks);
+}
+
+#endif // STRESS_LOG_CYCLE_COUNTER
+
 #ifdef STRESS_LOG
 
 StressLog StressLog::theLog = { 0, 0, 0, 0, 0, 0, TLS_OUT_OF_INDEXES, 0, 0, 0 };
 const static uint64_t RECYCLE_AGE = 0x40000000L;        // after a billion cycles, we can discard old threads
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+/*********************************************************************************/
+/* Store the latest cycle counter frequency in the log, and in the memory mapped
+   file header, so a dump taken at any point converts the time stamps with the
+   best estimate available. Only called on the slow paths (thread log creation
+   and shutdown), never while logging a message.
+*/
+static void refineCycleCounterFrequency()
+{
+    if (!s_useCycleCounter)
+    {
+        return;
+    }
+
+    uint64_t frequency = getCycleCounterFrequency();
+    if (frequency == 0)
+    {
+        return;
+    }
+
+    StressLog::theLog.tickFrequency = frequency;
+#ifdef MEMORY_MAPPED_STRESSLOG
+    if (StressLog::theLog.stressLogHeader != nullptr)
+    {
+        StressLog::theLog.stressLogHeader->tickFrequency = frequency;
+    }
+#endif //MEMORY_MAPPED_STRESSLOG
+}
+#endif // STRESS_LOG_CYCLE_COUNTER
+
 /*********************************************************************************/
 void StressLog::Enter(CRITSEC_COOKIE) {
     STATIC_CONTRACT_LEAF;
@@ -217,7 +330,7 @@ static LPVOID CreateMemoryMappedFile(LPWSTR logFilename, size_t maxBytesTotal)
 
 /*********************************************************************************/
 void StressLog::Initialize(unsigned facilities, unsigned level, unsigned maxBytesPerThreadArg,
-    unsigned maxBytesTotalArg, void* moduleBase, LPWSTR logFilename)
+    unsigned maxBytesTotalArg, void* moduleBase, LPWSTR logFilename, bool lowOverhead)
 {
     STATIC_CONTRACT_LEAF;
 
@@ -251,6 +364,27 @@ void StressLog::Initialize(unsigned facilities, unsigned level, unsigned maxByte
 
     theLog.tickFrequency = getTickFrequency();
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+    if (lowOverhead)
+    {
+        s_calibrationTicks = minipal_hires_ticks();
+        s_calibrationCycles = getCycleCounter();
+        s_useCycleCounter = true;
+
+        // Measure for a millisecond so that the frequency is usable right away;
+        // it is refined every time a thread log gets created.
+        int64_t calibrationEnd = s_calibrationTicks + minipal_hires_tick_frequency() / 1000;
+        while (minipal_hires_ticks() < calibrationEnd)
+        {
+        }
+        refineCycleCounterFrequency();
+    }
+#endif // STRESS_LOG_CYCLE_COUNTER
+
+#if !defined(STRESS_LOG_READONLY)
+    s_fixedChunkRings = lowOverhead;
+#endif //!STRESS_LOG_READONLY
+
     GetSystemTimeAsFileTime(&theLog.startTime);
     theLog.startTimeStamp = getTimeStamp();
     theLog.moduleOffset = (SIZE_T)moduleBase;
@@ -378,6 +512,10 @@ void StressLog::Terminate(BOOL fProcessDetach) {
 
     theLog.facilitiesToLog = 0;
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+    refineCycleCounterFrequency();
+#endif // STRESS_LOG_CYCLE_COUNTER
+
     StressLogLockHolder lockh(theLog.lock, FALSE);
     if (!fProcessDetach) {
         lockh.Acquire(); lockh.Release();       // The Enter() Leave() forces a memory barrier on weak memory model systems
@@ -590,6 +728,22 @@ ThreadStressLog* StressLog::CreateThreadStressLogHelper() {
 #endif //MEMORY_MAPPED_STRESSLOG
             goto LEAVE;
         }
+
+        if (s_fixedChunkRings)
+        {
+            // Allocate the whole ring up front, wrapping then just reuses the oldest chunk
+            // and AdvWritePastBoundary never has to allocate while a message is being logged.
+            DWORD perThreadLimit = theLog.MaxSizePerThread;
+#ifndef DACCESS_COMPILE
+            if (IsGCSpecialThread())
+            {
+                perThreadLimit *= GC_STRESSLOG_MULTIPLY;
+            }
+#endif //!DACCESS_COMPILE
+            while ((DWORD)msgs->chunkListLength * STRESSLOG_CHUNK_SIZE < perThreadLimit && msgs->GrowChunkList())
+            {
+            }
+        }
     }
     else
     {
@@ -608,6 +762,10 @@ ThreadStressLog* StressLog::CreateThreadStressLogHelper() {
 
     t_pCurrentThreadLog = msgs;
 
+#ifdef STRESS_LOG_CYCLE_COUNTER
+    refineCycleCounterFrequency();
+#endif // STRESS_LOG_CYCLE_COUNTER
+
     if (!skipInsert) {
 #ifdef _DEBUG
         ThreadStressLog* walk = theLog.logs;
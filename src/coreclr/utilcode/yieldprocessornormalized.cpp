@@ -14,3 +14,7 @@ unsigned int YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIte
         YieldProcessorNormalization::TargetNsPerNormalizedYield +
         0.5
     );
+
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+unsigned int YieldProcessorNormalization::s_waitOnAddressTicksPerNormalizedYield = 0;
+#endif
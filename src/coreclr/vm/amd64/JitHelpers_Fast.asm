@@ -155,24 +155,25 @@ endif
         jnb     Exit
 
 ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-        mov     rax, rcx
-
         mov     cl, [g_region_shr]
         test    cl, cl
         je      SkipCheck
 
-        ; check if the source is in gen 2 - then it's not an ephemeral pointer
-        shr     rax, cl
-        add     rax, [g_region_to_generation_table]
-        cmp     byte ptr [rax], 82h
-        je      Exit
-
         ; check if the destination happens to be in gen 0
         mov     rax, rdi
         shr     rax, cl
         add     rax, [g_region_to_generation_table]
-        cmp     byte ptr [rax], 0
+        mov     al, byte ptr [rax]
+        test    al, al
         je      Exit
+
+        ; check if the source is at least as old as the destination - then it's not an old to young pointer.
+        ; The low byte of rcx now holds the shift instead of the source, but regions are much larger
+        ; than 256 bytes so it is shifted out by the region index computation
+        shr     rcx, cl
+        add     rcx, [g_region_to_generation_table]
+        cmp     byte ptr [rcx], al
+        jae     Exit
     SkipCheck:
 
         cmp     [g_region_use_bitwise_write_barrier], 0
@@ -28,7 +28,8 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(0),
-    m_stage(Stage::Disabled)
+    m_stage(Stage::Disabled),
+    m_callCountingStartTickCount(0)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -52,7 +53,8 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(callCountThreshold),
-    m_stage(Stage::StubIsNotActive)
+    m_stage(Stage::StubIsNotActive),
+    m_callCountingStartTickCount(GetTickCount())
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -84,6 +86,18 @@ NativeCodeVersion CallCountingManager::CallCountingInfo::GetCodeVersion() const
 
 #ifndef DACCESS_COMPILE
 
+bool CallCountingManager::CallCountingInfo::IsHotCode() const
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_stage != Stage::Disabled);
+
+    // A method that reaches the call count threshold soon after call counting started for it is considered hot. The tier 1
+    // code of hot methods is clustered in separate code heaps, so that hot callers and callees that are promoted around the
+    // same time share pages.
+    DWORD hotCodeCallCountingMs = g_pConfig->TieredCompilation_HotCodeCallCountingMs();
+    return hotCodeCallCountingMs != 0 && GetTickCount() - m_callCountingStartTickCount <= hotCodeCallCountingMs;
+}
+
 const CallCountingStub *CallCountingManager::CallCountingInfo::GetCallCountingStub() const
 {
     WRAPPER_NO_CONTRACT;
@@ -648,7 +662,10 @@ bool CallCountingManager::SetCodeEntryPoint(
                 {
                     GetAppDomain()
                         ->GetTieredCompilationManager()
-                        ->AsyncPromoteToTier1(activeCodeVersion, createTieringBackgroundWorkerRef);
+                        ->AsyncPromoteToTier1(
+                            activeCodeVersion,
+                            callCountingInfo->IsHotCode(),
+                            createTieringBackgroundWorkerRef);
                 }
                 methodDesc->SetCodeEntryPoint(codeEntryPoint);
                 callCountingInfo->SetStage(CallCountingInfo::Stage::Complete);
@@ -842,6 +859,54 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
     return codeEntryPoint;
 }
 
+#ifdef FEATURE_INTERPRETER
+// Interpreted tier 0 code counts method entries and loop iterations itself, since calls between interpreted methods don't go
+// through the call counting stubs. When the count is reached, call counting is completed the same way as when the threshold of
+// a call counting stub is reached. Returns false if call counting has not started yet for the active code version, for instance
+// when the tiering delay is active, in which case the interpreter should count again.
+bool CallCountingManager::OnInterpreterTierUpThresholdReached(MethodDesc *methodDesc)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        PRECONDITION(CheckPointer(methodDesc));
+    }
+    CONTRACTL_END;
+
+    {
+        CallCountingManager *callCountingManager = methodDesc->GetLoaderAllocator()->GetCallCountingManager();
+
+        CodeVersionManager::LockHolder codeVersioningLockHolder;
+
+        NativeCodeVersion codeVersion =
+            methodDesc->GetCodeVersionManager()->GetActiveILCodeVersion(methodDesc).GetActiveNativeCodeVersion(methodDesc);
+        if (codeVersion.IsNull() || codeVersion.IsFinalTier())
+        {
+            return true;
+        }
+
+        CallCountingInfo *callCountingInfo = callCountingManager->m_callCountingInfoByCodeVersionHash.Lookup(codeVersion);
+        if (callCountingInfo == nullptr)
+        {
+            return false;
+        }
+
+        if (callCountingInfo->GetStage() >= CallCountingInfo::Stage::PendingCompletion)
+        {
+            return true;
+        }
+
+        callCountingManager->m_callCountingInfosPendingCompletion.Append(callCountingInfo);
+        callCountingInfo->SetStage(CallCountingInfo::Stage::PendingCompletion);
+    }
+
+    GetAppDomain()->GetTieredCompilationManager()->AsyncCompleteCallCounting();
+    return true;
+}
+#endif // FEATURE_INTERPRETER
+
 COUNT_T CallCountingManager::GetCountOfCodeVersionsPendingCompletion()
 {
     CONTRACTL
@@ -913,7 +978,10 @@ void CallCountingManager::CompleteCallCounting()
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        callCountingInfo->IsHotCode(),
+                        &createTieringBackgroundWorker);
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
@@ -1075,7 +1143,10 @@ void CallCountingManager::StopAllCallCounting(TieredCompilationManager *tieredCo
                 if (!codeVersion.GetILCodeVersion().HasAnyOptimizedNativeCodeVersion(codeVersion))
                 {
                     bool createTieringBackgroundWorker = false;
-                    tieredCompilationManager->AsyncPromoteToTier1(codeVersion, &createTieringBackgroundWorker);
+                    tieredCompilationManager->AsyncPromoteToTier1(
+                        codeVersion,
+                        callCountingInfo->IsHotCode(),
+                        &createTieringBackgroundWorker);
                     _ASSERTE(!createTieringBackgroundWorker); // the current thread is the background worker thread
                 }
 
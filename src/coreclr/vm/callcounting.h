@@ -58,6 +58,17 @@ Miscellaneous
   a fair bit of additional overhead to stop counting. On the other hand, it may at times be beneficial to rejit some methods
   during startup. So for now, only newly called methods during the current tiering delay would not be counted, any that already
   started counting will continue (their delay already expired).
+- Calls are counted by stubs rather than by the tier 0 code itself. JIT-emitted counting (a decrement of a cell in a shared
+  counter table in the prolog of tier 0 code, similar to how patchpoint counters are emitted for OSR) would avoid allocating
+  stubs, the extra indirection per call, and the runtime suspension to delete stubs. However, it would require:
+  - A way for the JIT to get the counter cell and a helper to call when the count reaches zero, that is, new JIT-EE interface
+    surface. There is no free CORJIT flag to request the behavior.
+  - Counting per code version rather than per method, since the same IL may have several tier 0 code versions (for instance
+    after a profiler rejit). The cell would need to be known before the code is generated.
+  - A different scheme for R2R code, which is not generated for counting and would still need stubs. R2R code is the
+    majority of the code counted in a typical app.
+  So for now, stub-based counting is used for all code versions. TieredCompilation_DeleteCallCountingStubsAfter controls how
+  often the stubs are deleted, and thus how often the runtime is suspended for it.
 
 *******************************************************************************************************************************/
 
@@ -201,6 +212,7 @@ private:
         const CallCountingStub *m_callCountingStub;
         CallCount m_remainingCallCount;
         Stage m_stage;
+        DWORD m_callCountingStartTickCount;
 
     #ifndef DACCESS_COMPILE
     private:
@@ -217,6 +229,7 @@ private:
 
     #ifndef DACCESS_COMPILE
     public:
+        bool IsHotCode() const;
         const CallCountingStub *GetCallCountingStub() const;
         void SetCallCountingStub(const CallCountingStub *callCountingStub);
         void ClearCallCountingStub();
@@ -367,6 +380,9 @@ public:
         bool wasMethodCalled,
         bool *createTieringBackgroundWorker);
     static PCODE OnCallCountThresholdReached(TransitionBlock *transitionBlock, TADDR stubIdentifyingToken);
+#ifdef FEATURE_INTERPRETER
+    static bool OnInterpreterTierUpThresholdReached(MethodDesc *methodDesc);
+#endif
     static COUNT_T GetCountOfCodeVersionsPendingCompletion();
     static void CompleteCallCounting();
 
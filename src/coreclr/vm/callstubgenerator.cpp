@@ -1209,46 +1209,6 @@ PCODE CallStubGenerator::GetInterpreterReturnTypeHandler(CallStubGenerator::Retu
     }
 }
 
-// Generate the call stub for the given method.
-// The returned call stub header must be freed by the caller using FreeCallStub.
-CallStubHeader *CallStubGenerator::GenerateCallStub(MethodDesc *pMD, AllocMemTracker *pamTracker, bool interpreterToNative)
-{
-    STANDARD_VM_CONTRACT;
-
-    // String constructors are special cases, and have a special calling convention that is associated with the actual function executed (which is a static function with no this parameter)
-    if (pMD->GetMethodTable()->IsString() && pMD->IsCtor())
-    {
-        _ASSERTE(pMD->IsFCall());
-        MethodDesc *pMDActualImplementation = NonVirtualEntry2MethodDesc(ECall::GetFCallImpl(pMD));
-        _ASSERTE(pMDActualImplementation != pMD);
-        pMD = pMDActualImplementation;
-    }
-
-    _ASSERTE(pMD != NULL);
-
-#if LOG_COMPUTE_CALL_STUB
-    printf("GenerateCallStub interpreterToNative=%d\n", interpreterToNative ? 1 : 0);
-#endif // LOG_COMPUTE_CALL_STUB
-    m_interpreterToNative = interpreterToNative;
-
-    MetaSig sig(pMD);
-    // Allocate space for the routines. The size of the array is conservatively set to twice the number of arguments
-    // plus one slot for the target pointer and reallocated to the real size at the end.
-    size_t tempStorageSize = ComputeTempStorageSize(sig);
-    PCODE *pRoutines = (PCODE*)alloca(tempStorageSize);
-    memset(pRoutines, 0, tempStorageSize);
-
-    ComputeCallStub(sig, pRoutines);
-
-    LoaderAllocator *pLoaderAllocator = pMD->GetLoaderAllocator();
-    S_SIZE_T finalStubSize(sizeof(CallStubHeader) + m_routineIndex * sizeof(PCODE));
-    void *pHeaderStorage = pamTracker->Track(pLoaderAllocator->GetHighFrequencyHeap()->AllocMem(finalStubSize));
-
-    CallStubHeader *pHeader = new (pHeaderStorage) CallStubHeader(m_routineIndex, pRoutines, ALIGN_UP(m_totalStackSize, STACK_ALIGN_SIZE), m_pInvokeFunction);
-
-    return pHeader;
-}
-
 struct CachedCallStubKey
 {
     CachedCallStubKey(int32_t hashCode, int numRoutines, PCODE *pRoutines, int totalStackSize, CallStubHeader::InvokeFunctionPtr pInvokeFunction)
@@ -1313,25 +1273,165 @@ typedef  PtrSHashTraits<CachedCallStub, CachedCallStubKey> CallStubCacheTraits;
 typedef SHash<CallStubCacheTraits> CallStubCacheHash;
 static CallStubCacheHash* s_callStubCache;
 
+// Signatures that have only primitive arguments and return values are mapped to the call stubs by their shape,
+// which allows finding the stub without computing the argument locations using the ArgIterator.
+struct CallStubShapeEntry
+{
+    CallStubShapeEntry(uint64_t shape, CallStubHeader *pHeader) : Shape(shape), Header(pHeader)
+    {
+    }
+
+    uint64_t Shape;
+    CallStubHeader *Header;
+
+    uint64_t GetKey()
+    {
+        return Shape;
+    }
+
+    static COUNT_T Hash(uint64_t shape)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (COUNT_T)(shape ^ (shape >> 32));
+    }
+};
+
+typedef SHash<PtrSHashTraits<CallStubShapeEntry, uint64_t>> CallStubShapeHash;
+static CallStubShapeHash* s_callStubShapeCache;
+
 void InitCallStubGenerator()
 {
     STANDARD_VM_CONTRACT;
 
     s_callStubCrst.Init(CrstCallStubCache);
     s_callStubCache = new CallStubCacheHash;
+    s_callStubShapeCache = new CallStubShapeHash;
 }
 
-CallStubHeader *CallStubGenerator::GenerateCallStubForSig(MetaSig &sig)
+// Compute the shape of the signature. The shape encodes the direction of the call, the presence of the "this" argument,
+// the kind of the return value and the kind and size of each of the arguments. Signatures with the same shape have the
+// same call stubs. Returns false for signatures with arguments or return values that are not primitive types or
+// object references and for signatures with hidden arguments, in which case the stub needs to be computed.
+bool CallStubGenerator::GetSignatureShape(MetaSig &sig, bool interpreterToNative, uint64_t *pShape)
+{
+    STANDARD_VM_CONTRACT;
+
+    if ((sig.GetCallingConvention() != IMAGE_CEE_CS_CALLCONV_DEFAULT) || sig.HasExplicitThis() ||
+        sig.HasGenericContextArg() || sig.IsAsyncCall() || (sig.NumFixedArgs() > MaxShapeArgs))
+    {
+        return false;
+    }
+
+    uint64_t shape;
+    CorElementType returnType = sig.GetReturnTypeNormalized();
+    switch (returnType)
+    {
+        case ELEMENT_TYPE_VOID:
+            shape = ShapeReturnVoid;
+            break;
+        case ELEMENT_TYPE_R4:
+        case ELEMENT_TYPE_R8:
+            shape = ShapeReturnFloat;
+            break;
+        default:
+            if (GetShapeArgKind(returnType) == ShapeArgNone)
+            {
+                return false;
+            }
+            shape = ShapeReturnInt;
+            break;
+    }
+
+    shape = (shape << 1) | (sig.HasThis() ? 1 : 0);
+    shape = (shape << 1) | (interpreterToNative ? 1 : 0);
+
+    int shift = ShapeHeaderBits;
+    CorElementType argType;
+    sig.Reset();
+    while ((argType = sig.NextArgNormalized()) != ELEMENT_TYPE_END)
+    {
+        ShapeArgKind argKind = GetShapeArgKind(argType);
+        if (argKind == ShapeArgNone)
+        {
+            sig.Reset();
+            return false;
+        }
+
+        shape |= (uint64_t)argKind << shift;
+        shift += ShapeArgBits;
+    }
+    sig.Reset();
+
+    *pShape = shape;
+    return true;
+}
+
+CallStubGenerator::ShapeArgKind CallStubGenerator::GetShapeArgKind(CorElementType type)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    switch (type)
+    {
+        case ELEMENT_TYPE_BOOLEAN:
+        case ELEMENT_TYPE_I1:
+        case ELEMENT_TYPE_U1:
+            return ShapeArgInt1;
+        case ELEMENT_TYPE_CHAR:
+        case ELEMENT_TYPE_I2:
+        case ELEMENT_TYPE_U2:
+            return ShapeArgInt2;
+        case ELEMENT_TYPE_I4:
+        case ELEMENT_TYPE_U4:
+            return ShapeArgInt4;
+        case ELEMENT_TYPE_I8:
+        case ELEMENT_TYPE_U8:
+            return ShapeArgInt8;
+        case ELEMENT_TYPE_I:
+        case ELEMENT_TYPE_U:
+        case ELEMENT_TYPE_CLASS:
+        case ELEMENT_TYPE_OBJECT:
+        case ELEMENT_TYPE_STRING:
+        case ELEMENT_TYPE_PTR:
+        case ELEMENT_TYPE_BYREF:
+        case ELEMENT_TYPE_ARRAY:
+        case ELEMENT_TYPE_SZARRAY:
+        case ELEMENT_TYPE_FNPTR:
+            return ShapeArgPointer;
+        case ELEMENT_TYPE_R4:
+            return ShapeArgFloat;
+        case ELEMENT_TYPE_R8:
+            return ShapeArgDouble;
+        default:
+            return ShapeArgNone;
+    }
+}
+
+// Get the call stub for the given signature from the cache or compute it and add it to the cache. The cached stubs are
+// shared by all methods with the same signature shape. For the interpreter to native direction, the slot for the target
+// method is left empty, so the stub needs to be copied before setting the target.
+CallStubHeader *CallStubGenerator::GetCachedCallStub(MetaSig &sig, bool interpreterToNative)
 {
     STANDARD_VM_CONTRACT;
 
+    uint64_t shape = 0;
+    bool hasShape = GetSignatureShape(sig, interpreterToNative, &shape);
+    if (hasShape)
+    {
+        CrstHolder lockHolder(&s_callStubCrst);
+        CallStubShapeEntry *pShapeEntry = s_callStubShapeCache->Lookup(shape);
+        if (pShapeEntry != NULL)
+        {
+            return pShapeEntry->Header;
+        }
+    }
+
     // Allocate space for the routines. The size of the array is conservatively set to twice the number of arguments
     // plus one slot for the target pointer and reallocated to the real size at the end.
     size_t tempStorageSize = ComputeTempStorageSize(sig);
-    PCODE *pRoutines = (PCODE*)alloca(ComputeTempStorageSize(sig));
+    PCODE *pRoutines = (PCODE*)alloca(tempStorageSize);
     memset(pRoutines, 0, tempStorageSize);
 
-    m_interpreterToNative = true; // We always generate the interpreter to native call stub here
+    m_interpreterToNative = interpreterToNative;
 
     ComputeCallStub(sig, pRoutines);
 
@@ -1352,32 +1452,78 @@ CallStubHeader *CallStubGenerator::GenerateCallStubForSig(MetaSig &sig)
 
     CrstHolder lockHolder(&s_callStubCrst);
     CachedCallStub *pCachedHeader = s_callStubCache->Lookup(cachedHeaderKey);
-    if (pCachedHeader != NULL)
-    {
-        // The stub is already cached, return the cached header
-#if LOG_COMPUTE_CALL_STUB
-        printf("CallStubHeader at %p\n", &pCachedHeader->Header);
-#endif // LOG_COMPUTE_CALL_STUB
-        return &pCachedHeader->Header;
-    }
-    else
+    if (pCachedHeader == NULL)
     {
         AllocMemTracker amTracker;
         // The stub is not cached, create a new header and add it to the cache
         // We only need to allocate the actual pRoutines array, and then we can just use the cachedHeader we already constructed
         size_t finalCachedCallStubSize = sizeof(CachedCallStub) + m_routineIndex * sizeof(PCODE);
         void* pHeaderStorage = amTracker.Track(SystemDomain::GetGlobalLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(finalCachedCallStubSize)));
-        CachedCallStub *pHeader = new (pHeaderStorage) CachedCallStub(cachedHeaderKey.HashCode, m_routineIndex, pRoutines, ALIGN_UP(m_totalStackSize, STACK_ALIGN_SIZE), m_pInvokeFunction);
-        s_callStubCache->Add(pHeader);
+        pCachedHeader = new (pHeaderStorage) CachedCallStub(cachedHeaderKey.HashCode, m_routineIndex, pRoutines, ALIGN_UP(m_totalStackSize, STACK_ALIGN_SIZE), m_pInvokeFunction);
+        s_callStubCache->Add(pCachedHeader);
         amTracker.SuppressRelease();
 
-        _ASSERTE(s_callStubCache->Lookup(cachedHeaderKey) == pHeader);
+        _ASSERTE(s_callStubCache->Lookup(cachedHeaderKey) == pCachedHeader);
+    }
+
+    if (hasShape && (s_callStubShapeCache->Lookup(shape) == NULL))
+    {
+        AllocMemTracker amTracker;
+        void* pShapeEntryStorage = amTracker.Track(SystemDomain::GetGlobalLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(sizeof(CallStubShapeEntry))));
+        s_callStubShapeCache->Add(new (pShapeEntryStorage) CallStubShapeEntry(shape, &pCachedHeader->Header));
+        amTracker.SuppressRelease();
+    }
+
+#if LOG_COMPUTE_CALL_STUB
+    printf("CallStubHeader at %p\n", &pCachedHeader->Header);
+#endif // LOG_COMPUTE_CALL_STUB
+    return &pCachedHeader->Header;
+}
+
+// Generate the call stub for the given method.
+// The native to interpreter stubs are shared by all methods with the same signature shape. The interpreter to native
+// stubs store the target method, so each method gets its own copy of the shared stub allocated using the pamTracker.
+CallStubHeader *CallStubGenerator::GenerateCallStub(MethodDesc *pMD, AllocMemTracker *pamTracker, bool interpreterToNative)
+{
+    STANDARD_VM_CONTRACT;
+
+    // String constructors are special cases, and have a special calling convention that is associated with the actual function executed (which is a static function with no this parameter)
+    if (pMD->GetMethodTable()->IsString() && pMD->IsCtor())
+    {
+        _ASSERTE(pMD->IsFCall());
+        MethodDesc *pMDActualImplementation = NonVirtualEntry2MethodDesc(ECall::GetFCallImpl(pMD));
+        _ASSERTE(pMDActualImplementation != pMD);
+        pMD = pMDActualImplementation;
+    }
+
+    _ASSERTE(pMD != NULL);
+
 #if LOG_COMPUTE_CALL_STUB
-        printf("CallStubHeader at %p\n", &pHeader->Header);
+    printf("GenerateCallStub interpreterToNative=%d\n", interpreterToNative ? 1 : 0);
 #endif // LOG_COMPUTE_CALL_STUB
-        return &pHeader->Header;
+
+    MetaSig sig(pMD);
+    CallStubHeader *pCachedHeader = GetCachedCallStub(sig, interpreterToNative);
+    if (!interpreterToNative)
+    {
+        return pCachedHeader;
     }
-};
+
+    LoaderAllocator *pLoaderAllocator = pMD->GetLoaderAllocator();
+    size_t stubSize = pCachedHeader->GetSize();
+    void *pHeaderStorage = pamTracker->Track(pLoaderAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(stubSize)));
+    memcpy(pHeaderStorage, pCachedHeader, stubSize);
+
+    return (CallStubHeader*)pHeaderStorage;
+}
+
+CallStubHeader *CallStubGenerator::GenerateCallStubForSig(MetaSig &sig)
+{
+    STANDARD_VM_CONTRACT;
+
+    // We always generate the interpreter to native call stub here
+    return GetCachedCallStub(sig, true /* interpreterToNative */);
+}
 
 void CallStubGenerator::ComputeCallStub(MetaSig &sig, PCODE *pRoutines)
 {
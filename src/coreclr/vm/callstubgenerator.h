@@ -124,6 +124,35 @@ class CallStubGenerator
 
     // Process the argument described by argLocDesc. This function is called for each argument in the method signature.
     void ProcessArgument(ArgIterator *pArgIt, ArgLocDesc& argLocDesc, PCODE *pRoutines);
+
+    // Kinds of the return value and arguments encoded in the signature shape
+    enum ShapeReturnKind
+    {
+        ShapeReturnVoid,
+        ShapeReturnInt,
+        ShapeReturnFloat,
+    };
+
+    enum ShapeArgKind
+    {
+        ShapeArgNone,
+        ShapeArgInt1,
+        ShapeArgInt2,
+        ShapeArgInt4,
+        ShapeArgInt8,
+        ShapeArgPointer,
+        ShapeArgFloat,
+        ShapeArgDouble,
+    };
+
+    // Number of bits used for the direction, "this" and return kind, and for each of the arguments in the shape
+    static const int ShapeHeaderBits = 4;
+    static const int ShapeArgBits = 3;
+    static const int MaxShapeArgs = (64 - ShapeHeaderBits) / ShapeArgBits;
+
+    static ShapeArgKind GetShapeArgKind(CorElementType type);
+    static bool GetSignatureShape(MetaSig &sig, bool interpreterToNative, uint64_t *pShape);
+    CallStubHeader *GetCachedCallStub(MetaSig &sig, bool interpreterToNative);
 public:
     // Generate the call stub for the given method.
     CallStubHeader *GenerateCallStub(MethodDesc *pMD, AllocMemTracker *pamTracker, bool interpreterToNative);
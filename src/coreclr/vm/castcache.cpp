@@ -12,6 +12,10 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_flushCount        = 0;
+LONG64 CastCache::s_lookupCount      = 0;
+LONG64 CastCache::s_missCount        = 0;
+thread_local CastCache::ThreadCastCache CastCache::t_threadCache;
 const DWORD CastCache::INITIAL_CACHE_SIZE;
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
@@ -89,7 +93,20 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    DWORD oldSize = CacheElementCount(TableData(*s_pTableRef));
+    DWORD newSize = CacheElementCount(TableData(newTable));
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
+
+    // the miss rate is observed separately for every table size.
+    // NB: this is racy with threads publishing statistics. We are ok with losing some counts.
+    LONG64 lookups = InterlockedExchange64(&s_lookupCount, 0);
+    LONG64 misses = InterlockedExchange64(&s_missCount, 0);
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, CastCacheResize))
+    {
+        FireEtwCastCacheResize(oldSize, newSize, (ULONGLONG)(lookups - misses), (ULONGLONG)misses, GetClrInstanceId());
+    }
+
     return TRUE;
 }
 
@@ -107,6 +124,10 @@ void CastCache::FlushCurrentCache()
     s_lastFlushSize = max(INITIAL_CACHE_SIZE, CacheElementCount(tableData));
 
     SetObjectReference((OBJECTREF *)s_pTableRef, ObjectFromHandle(s_sentinelTable));
+
+    // invalidate the per-thread caches. When flushing for an unload the EE is suspended,
+    // so all threads will observe the new value before they look up anything again.
+    InterlockedIncrement((LONG*)&s_flushCount);
 }
 
 void CastCache::Initialize()
@@ -199,6 +220,63 @@ TypeHandle::CastResult CastCache::TryGet(TADDR source, TADDR target)
     return TypeHandle::MaybeCast;
 }
 
+TypeHandle::CastResult CastCache::TryGetAndCacheOnThread(TADDR source, TADDR target)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    ThreadCastCache& threadCache = t_threadCache;
+    if (threadCache.flushCount != s_flushCount)
+    {
+        ResetThreadCache(&threadCache);
+    }
+
+    TypeHandle::CastResult result = TryGet(source, target);
+
+    threadCache.lookups++;
+    if (result == TypeHandle::MaybeCast)
+    {
+        threadCache.misses++;
+    }
+    else
+    {
+        ThreadCastCache::Entry* pEntry = &threadCache.entries[ThreadCacheIndex(source, target)];
+        pEntry->source = source;
+        pEntry->targetAndResult = target | (TADDR)result;
+    }
+
+    // NB: hits in the per-thread cache are only published when the thread next misses it.
+    if (threadCache.lookups >= STATISTICS_BATCH_SIZE)
+    {
+        PublishStatistics(&threadCache);
+    }
+
+    return result;
+}
+
+void CastCache::ResetThreadCache(ThreadCastCache* pThreadCache)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    memset(pThreadCache->entries, 0, sizeof(pThreadCache->entries));
+    pThreadCache->flushCount = s_flushCount;
+}
+
+void CastCache::PublishStatistics(ThreadCastCache* pThreadCache)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedExchangeAdd64(&s_lookupCount, pThreadCache->lookups);
+    InterlockedExchangeAdd64(&s_missCount, pThreadCache->misses);
+    pThreadCache->lookups = 0;
+    pThreadCache->misses = 0;
+}
+
 void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
 {
     CONTRACTL
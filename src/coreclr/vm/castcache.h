@@ -45,6 +45,10 @@
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
 //
+// In front of the shared table every thread has a small direct-mapped cache of its recent lookups.
+// It is not shared, so it needs no versioning. It is invalidated whenever the shared table is flushed,
+// which a thread notices by comparing the flush count it has last seen with the current one.
+//
 class CastCache
 {
 #if !defined(DACCESS_COMPILE)
@@ -94,6 +98,27 @@ class CastCache
         }
     };
 
+    struct ThreadCastCache
+    {
+        static const DWORD SIZE = 32; // MUST BE A POWER OF TWO
+
+        struct Entry
+        {
+            TADDR source;
+            // same encoding as in CastCacheEntry
+            TADDR targetAndResult;
+        };
+
+        // value of s_flushCount when the entries were last valid
+        DWORD flushCount;
+
+        // lookups and misses since the statistics were last published to the shared counters
+        DWORD lookups;
+        DWORD misses;
+
+        Entry entries[SIZE];
+    };
+
 public:
 
     FORCEINLINE static void TryAddToCache(TypeHandle source, TypeHandle target, BOOL result)
@@ -176,6 +201,11 @@ private:
 // Considering that typically the cache size is small and that hit rates are high with good locality,
 // just keeping the cache around seems a simple and viable strategy.
 //
+// Applications with very many types can still thrash a table of that size. Past MAXIMUM_CACHE_SIZE
+// we keep growing up to MAXIMUM_GROWN_CACHE_SIZE, but only while the observed miss rate since the
+// last resize is at least 1 / MISS_RATE_GROWTH_DIVISOR. The rate is computed from the lookups done
+// by the runtime, which publishes the per-thread counts every STATISTICS_BATCH_SIZE lookups.
+//
 // Additional behaviors that could be considered, if there are scenarios that could be improved:
 //     - flush the cache based on some heuristics
 //     - shrink the cache based on some heuristics
@@ -183,10 +213,16 @@ private:
 #if DEBUG
     static const DWORD INITIAL_CACHE_SIZE = 8;    // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 512;  // make this lower than release to make it easier to reach this in tests.
+    static const DWORD MAXIMUM_GROWN_CACHE_SIZE = 2048;
+    static const DWORD MIN_LOOKUPS_FOR_GROWTH = 256;
 #else
     static const DWORD INITIAL_CACHE_SIZE = 128;  // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
+    static const DWORD MAXIMUM_GROWN_CACHE_SIZE = 65536; // 1.5MB on 64bit, only reached when the smaller tables keep missing.
+    static const DWORD MIN_LOOKUPS_FOR_GROWTH = 16384;
 #endif
+    static const DWORD MISS_RATE_GROWTH_DIVISOR = 8;
+    static const DWORD STATISTICS_BATCH_SIZE = 1024;
 
 // Lower bucket size will cause the table to resize earlier
 // Higher bucket size will increase upper bound cost of Get
@@ -206,6 +242,15 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // incremented every time the table is flushed, invalidates the per-thread caches
+    static DWORD          s_flushCount;
+
+    // lookups and misses since the last resize, as published by the threads
+    static LONG64         s_lookupCount;
+    static LONG64         s_missCount;
+
+    static thread_local ThreadCastCache t_threadCache;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -221,7 +266,18 @@ private:
             return TypeHandle::CanCast;
         }
 
-        return TryGet(source, target);
+        ThreadCastCache& threadCache = t_threadCache;
+        ThreadCastCache::Entry* pEntry = &threadCache.entries[ThreadCacheIndex(source, target)];
+
+        // a matching entry has the same target bits, except for the lowest one, which is the result.
+        TADDR entryTargetAndResult = pEntry->targetAndResult ^ target;
+        if (pEntry->source == source && entryTargetAndResult <= 1 && threadCache.flushCount == s_flushCount)
+        {
+            threadCache.lookups++;
+            return TypeHandle::CastResult(entryTargetAndResult);
+        }
+
+        return TryGetAndCacheOnThread(source, target);
     }
 
     FORCEINLINE static void TryAddToCache(TADDR source, TADDR target, BOOL result)
@@ -238,6 +294,7 @@ private:
             return;
 
         TrySet(source, target, result);
+        AddToThreadCache(source, target, result);
     }
 
     FORCEINLINE static bool TryGrow(DWORD* tableData)
@@ -251,7 +308,7 @@ private:
         CONTRACTL_END;
 
         DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
+        if (newSize <= MAXIMUM_CACHE_SIZE || (newSize <= MAXIMUM_GROWN_CACHE_SIZE && IsMissRateHigh()))
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
@@ -259,6 +316,39 @@ private:
         return false;
     }
 
+    FORCEINLINE static bool IsMissRateHigh()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        LONG64 lookups = VolatileLoadWithoutBarrier(&s_lookupCount);
+        LONG64 misses = VolatileLoadWithoutBarrier(&s_missCount);
+        return lookups >= MIN_LOOKUPS_FOR_GROWTH && misses * MISS_RATE_GROWTH_DIVISOR >= lookups;
+    }
+
+    FORCEINLINE static DWORD ThreadCacheIndex(TADDR source, TADDR target)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // the low bits of type handles are mostly zero due to alignment.
+        // shift source and target differently so that {A, B} and {B, A} do not collide.
+        return (DWORD)(((source >> 3) ^ (target >> 4)) & (ThreadCastCache::SIZE - 1));
+    }
+
+    FORCEINLINE static void AddToThreadCache(TADDR source, TADDR target, BOOL result)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        ThreadCastCache& threadCache = t_threadCache;
+        if (threadCache.flushCount != s_flushCount)
+        {
+            ResetThreadCache(&threadCache);
+        }
+
+        ThreadCastCache::Entry* pEntry = &threadCache.entries[ThreadCacheIndex(source, target)];
+        pEntry->source = source;
+        pEntry->targetAndResult = target | (result & 1);
+    }
+
     FORCEINLINE static DWORD KeyToBucket(DWORD* tableData, TADDR source, TADDR target)
     {
         // upper bits of addresses do not vary much, so to reduce loss due to cancelling out,
@@ -319,7 +409,10 @@ private:
     static BASEARRAYREF CreateCastCache(DWORD size);
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
+    static TypeHandle::CastResult TryGetAndCacheOnThread(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
+    static void ResetThreadCache(ThreadCastCache* pThreadCache);
+    static void PublishStatistics(ThreadCastCache* pThreadCache);
 
 #else // !DACCESS_COMPILE
 public:
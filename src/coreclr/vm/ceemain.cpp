@@ -166,6 +166,7 @@
 
 #ifdef FEATURE_INTERPRETER
 #include "callstubgenerator.h"
+#include "interpexec.h"
 #endif
 
 #ifndef TARGET_UNIX
@@ -592,6 +593,84 @@ void FatalErrorHandler(UINT errorCode, LPCWSTR pszMessage)
     EEPOLICY_HANDLE_FATAL_ERROR_WITH_MESSAGE(errorCode, pszMessage);
 }
 
+// Names reported in the EEStartupPhase event, indexed by EEStartupPhase
+static const LPCWSTR s_startupPhaseNames[] =
+{
+    W("Config"),
+    W("ThreadManager"),
+    W("DiagnosticServer"),
+    W("DiagnosticsPause"),
+    W("EventTracing"),
+    W("Binder"),
+    W("GCInitialize"),
+    W("SystemDomain"),
+    W("Debugger"),
+    W("Profiler"),
+    W("JitHelpers"),
+    W("GCHeap"),
+    W("ThreadSetup"),
+    W("SystemAssemblies"),
+};
+static_assert(ARRAY_SIZE(s_startupPhaseNames) == EEStartupPhase_Count, "Every startup phase needs a name");
+
+// Written only by the thread running EEStartupHelper, and read once g_fEEStarted is set
+static int64_t s_startupPhaseTicks[EEStartupPhase_Count];
+static int64_t s_startupPhaseStartTicks;
+
+// Charges the time since the end of the previous phase to the given phase. Phases
+// are contiguous, so every step of EEStartupHelper is attributed to exactly one.
+static void EndStartupPhase(EEStartupPhase phase)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    int64_t now = minipal_hires_ticks();
+    s_startupPhaseTicks[phase] = now - s_startupPhaseStartTicks;
+    s_startupPhaseStartTicks = now;
+}
+
+static uint64_t StartupPhaseTicksToUs(int64_t ticks)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return (uint64_t)(ticks * 1000000 / minipal_hires_tick_frequency());
+}
+
+uint32_t GetEEStartupPhaseDurations(uint64_t* durationsUs, uint32_t count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!g_fEEStarted)
+        return 0;
+
+    uint32_t written = min(count, (uint32_t)EEStartupPhase_Count);
+    for (uint32_t i = 0; i < written; i++)
+    {
+        durationsUs[i] = StartupPhaseTicksToUs(s_startupPhaseTicks[i]);
+    }
+
+    return written;
+}
+
+#ifdef FEATURE_EVENT_TRACE
+static void FireStartupPhaseEvents()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    if (!EventEnabledEEStartupPhase())
+        return;
+
+    for (int i = 0; i < EEStartupPhase_Count; i++)
+    {
+        FireEtwEEStartupPhase(GetClrInstanceId(), s_startupPhaseNames[i], StartupPhaseTicksToUs(s_startupPhaseTicks[i]));
+    }
+}
+#endif // FEATURE_EVENT_TRACE
+
 void EEStartupHelper()
 {
     CONTRACTL
@@ -613,7 +692,7 @@ void EEStartupHelper()
     EX_TRY
     {
         g_fEEInit = true;
-
+        s_startupPhaseStartTicks = minipal_hires_ticks();
 
         // We cache the SystemInfo for anyone to use throughout the life of the EE.
         GetSystemInfo(&g_SystemInfo);
@@ -687,9 +766,11 @@ void EEStartupHelper()
             ExecutableAllocator::InitLazyPreferredRange(g_runtimeLoadedBaseAddress, g_runtimeVirtualSize, GetRandomInt(64));
         }
 #endif // !TARGET_UNIX
+        EndStartupPhase(EEStartupPhase_Config);
 
         InitThreadManager();
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "Returned successfully from InitThreadManager");
+        EndStartupPhase(EEStartupPhase_ThreadManager);
 
 #ifdef FEATURE_PERFTRACING
         // Initialize the event pipe.
@@ -710,14 +791,20 @@ void EEStartupHelper()
             unsigned bytesPerThread = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLogSize, STRESSLOG_CHUNK_SIZE * 4);
             unsigned totalBytes = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TotalStressLogSize, STRESSLOG_CHUNK_SIZE * 1024);
             CLRConfigStringHolder logFilename = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLogFilename);
-            StressLog::Initialize(facilities, level, bytesPerThread, totalBytes, GetClrModuleBase(), logFilename);
+            bool lowOverhead = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLogLowOverhead) != 0;
+            StressLog::Initialize(facilities, level, bytesPerThread, totalBytes, GetClrModuleBase(), logFilename, lowOverhead);
             g_pStressLog = &StressLog::theLog;
         }
 #endif
 
 #ifdef FEATURE_PERFTRACING
         DiagnosticServerAdapter::Initialize();
+        EndStartupPhase(EEStartupPhase_DiagnosticServer);
+
         DiagnosticServerAdapter::PauseForDiagnosticsMonitor();
+        EndStartupPhase(EEStartupPhase_DiagnosticsPause);
+#else
+        EndStartupPhase(EEStartupPhase_DiagnosticServer);
 #endif // FEATURE_PERFTRACING
 
 #ifdef FEATURE_GDBJIT
@@ -748,6 +835,10 @@ void EEStartupHelper()
         PgoManager::Initialize();
 #endif
 
+#ifdef FEATURE_TIERED_COMPILATION
+        TieredCompilationManager::InitializeWarmStart();
+#endif
+
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "===================EEStartup Starting===================");
 
 #ifndef TARGET_UNIX
@@ -790,6 +881,7 @@ void EEStartupHelper()
         // Monitors, Crsts, and SimpleRWLocks all use the same spin heuristics
         // Cache the (potentially user-overridden) values now so they are accessible from asm routines
         InitializeSpinConstants();
+        EndStartupPhase(EEStartupPhase_EventTracing);
 
         StubManager::InitializeStubManagers();
 
@@ -804,6 +896,7 @@ void EEStartupHelper()
         StubLinkerCPU::Init();
         StubPrecode::StaticInitialize();
         FixupPrecode::StaticInitialize();
+        EndStartupPhase(EEStartupPhase_Binder);
 
         InitializeGarbageCollector();
 
@@ -811,6 +904,7 @@ void EEStartupHelper()
         {
             IfFailGo(E_OUTOFMEMORY);
         }
+        EndStartupPhase(EEStartupPhase_GCInitialize);
 
         g_pEEShutDownEvent = new CLREvent();
         g_pEEShutDownEvent->CreateManualEvent(FALSE);
@@ -837,6 +931,7 @@ void EEStartupHelper()
             IfFailGo(E_FAIL);
         }
 #endif // !TARGET_UNIX
+        EndStartupPhase(EEStartupPhase_SystemDomain);
 
 #ifdef DEBUGGING_SUPPORTED
         // Initialize the debugging services. This must be done before any
@@ -844,6 +939,7 @@ void EEStartupHelper()
         // modules are loaded.
         InitializeDebugger(); // throws on error
 #endif // DEBUGGING_SUPPORTED
+        EndStartupPhase(EEStartupPhase_Debugger);
 
 #ifdef PROFILING_SUPPORTED
         // Initialize the profiling services.
@@ -860,6 +956,7 @@ void EEStartupHelper()
         // before the first Thread is attached. Thus we want to give the thread a bit more time.
         FinalizerThread::FinalizerThreadCreate();
 #endif
+        EndStartupPhase(EEStartupPhase_Profiler);
 
         InitPreStubManager();
 
@@ -876,6 +973,7 @@ void EEStartupHelper()
 
         // Set up the sync block
         SyncBlockCache::Start();
+        EndStartupPhase(EEStartupPhase_JitHelpers);
 
         // This isn't done as part of InitializeGarbageCollector() above because it
         // requires write barriers to have been set up on x86, which happens as part
@@ -887,6 +985,7 @@ void EEStartupHelper()
         }
 
         IfFailGo(hr);
+        EndStartupPhase(EEStartupPhase_GCHeap);
 
         InitializeExceptionHandling();
 
@@ -940,6 +1039,7 @@ void EEStartupHelper()
 
         // Now we really have fully initialized the garbage collector
         SetGarbageCollectorFullyInitialized();
+        EndStartupPhase(EEStartupPhase_ThreadSetup);
 
 #ifdef DEBUGGING_SUPPORTED
         // Make a call to publish the DefaultDomain for the debugger
@@ -975,6 +1075,7 @@ void EEStartupHelper()
         SystemDomain::System()->DefaultDomain()->SetupSharedStatics();
 
         InitializeThreadStaticData();
+        EndStartupPhase(EEStartupPhase_SystemAssemblies);
 
 #ifdef FEATURE_MINIMETADATA_IN_TRIAGEDUMPS
         // retrieve configured max size for the mini-metadata buffer (defaults to 64KB)
@@ -994,6 +1095,10 @@ void EEStartupHelper()
         hr = S_OK;
         STRESS_LOG0(LF_STARTUP, LL_ALWAYS, "===================EEStartup Completed===================");
 
+#ifdef FEATURE_EVENT_TRACE
+        FireStartupPhaseEvents();
+#endif // FEATURE_EVENT_TRACE
+
 
 #ifdef _DEBUG
 
@@ -1179,6 +1284,17 @@ void STDMETHODCALLTYPE EEShutDownHelper(BOOL fIsDllUnloading)
     EX_END_CATCH
 #endif
 
+#ifdef FEATURE_TIERED_COMPILATION
+    EX_TRY
+    {
+        TieredCompilationManager::ShutdownWarmStart();
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH
+#endif
+
     if (!fIsDllUnloading)
     {
         ETW::EnumerationLog::ProcessShutdown();
@@ -1280,6 +1396,10 @@ void STDMETHODCALLTYPE EEShutDownHelper(BOOL fIsDllUnloading)
 
         VirtualCallStubManager::LogFinalStats();
 
+#if defined(FEATURE_INTERPRETER) && defined(INTERP_OPCODE_STATS)
+        InterpDumpOpcodeStats();
+#endif
+
 #ifdef PROFILING_SUPPORTED
         // If profiling is enabled, then notify of shutdown first so that the
         // profiler can make any last calls it needs to.  Do this only if we
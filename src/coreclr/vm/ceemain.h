@@ -58,6 +58,32 @@ INT32 GetLatchedExitCode (void);
 // Stronger than IsGCHeapInitialized
 BOOL IsGarbageCollectorFullyInitialized();
 
+// Groups of EEStartupHelper steps whose durations are recorded during startup.
+// The values are reported over the diagnostics IPC, so phases are only ever appended.
+enum EEStartupPhase
+{
+    EEStartupPhase_Config,              // SString, EEConfig, startup flags and static initializers
+    EEStartupPhase_ThreadManager,       // InitThreadManager
+    EEStartupPhase_DiagnosticServer,    // EventPipe, stress log and diagnostic server initialization
+    EEStartupPhase_DiagnosticsPause,    // Waiting for a diagnostics monitor to resume startup
+    EEStartupPhase_EventTracing,        // Event tracing, perf map, PGO and tiering warm start
+    EEStartupPhase_Binder,              // Stub managers, PEImage, CoreLib binder and precode setup
+    EEStartupPhase_GCInitialize,        // Loading and initializing the GC and the handle manager
+    EEStartupPhase_SystemDomain,        // SystemDomain::Attach, ECall, delegates, execution manager and JIT host
+    EEStartupPhase_Debugger,            // InitializeDebugger
+    EEStartupPhase_Profiler,            // InitializeProfiling
+    EEStartupPhase_JitHelpers,          // Prestub manager, interop stubs, JIT helpers and sync block cache
+    EEStartupPhase_GCHeap,              // g_pGCHeap->Initialize
+    EEStartupPhase_ThreadSetup,         // Exception handling, first Thread, finalizer thread and EventPipe completion
+    EEStartupPhase_SystemAssemblies,    // SystemDomain::Init and loading CoreLib
+    EEStartupPhase_Count
+};
+
+// Copies the duration of each startup phase, in microseconds, into durationsUs, which
+// holds count entries. Returns the number of entries written, or 0 if the EE has not
+// finished starting up.
+uint32_t GetEEStartupPhaseDurations(uint64_t* durationsUs, uint32_t count);
+
 // Specifies whether coreclr is embedded or standalone
 extern bool g_coreclr_embedded;
 
@@ -54,6 +54,10 @@ struct StackTraceElement
     }
 };
 
+#ifdef FEATURE_EH_FUNCLETS
+struct ExInfo;
+#endif // FEATURE_EH_FUNCLETS
+
 class StackTraceInfo
 {
     struct StackTraceArrayProtect
@@ -66,11 +70,20 @@ class StackTraceInfo
         // This allows atomic replacement of the original array with the newly sized array.
         StackTraceArray m_pStackTraceArrayNew;
     };
+    // Capacity of the first stack trace array allocated for an exception. Exceptions that are caught
+    // within a few frames then never reallocate the array.
+    static const size_t c_initialStackTraceCapacity = 8;
     static OBJECTREF GetKeepAliveObject(MethodDesc* pMethod);
     static void EnsureStackTraceArray(StackTraceArrayProtect *pStackTraceArrayProtected, size_t neededSize);
     static void EnsureKeepAliveArray(PTRARRAYREF *ppKeepAliveArray, size_t neededSize);
+    static bool InitializeElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf, StackTraceElement* pStackTraceElem);
+    static void AppendElementsToThrowable(OBJECTHANDLE hThrowable, StackTraceElement const * pStackTraceElems, size_t count, BOOL fRaisingForeignException);
 public:
     static void AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf);
+#ifdef FEATURE_EH_FUNCLETS
+    static void AppendElement(ExInfo* pExInfo, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf);
+    static void FlushPendingElements(ExInfo* pExInfo);
+#endif // FEATURE_EH_FUNCLETS
 };
 
 
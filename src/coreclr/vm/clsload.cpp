@@ -3055,6 +3055,19 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(const TypeKey *pTypeKey,
 
     PushFinalLevels(typeHnd, targetLevel, pInstContext);
 
+#ifdef FEATURE_MULTICOREJIT
+    // Record type definitions loaded for the first time, so that a multi-core JIT player can load them ahead of time
+    if ((targetLevel == CLASS_LOADED) && (currentLevel < CLASS_LOADED) && !typeHnd.IsTypeDesc() &&
+        typeHnd.AsMethodTable()->IsTypicalTypeDefinition())
+    {
+        MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+        if (mcJitManager.IsRecorderActive())
+        {
+            mcJitManager.RecordTypeLoad(typeHnd.AsMethodTable());
+        }
+    }
+#endif // FEATURE_MULTICOREJIT
+
 #if defined(FEATURE_EVENT_TRACE)
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TypeLoadStop))
     {
@@ -3189,6 +3202,19 @@ ClassLoader::LoadTypeHandleForTypeKey_Body(
     CrstHolderWithState unresolvedClassLockHolder(pPendingTypeLoadShard->GetCrst(), false);
 
 retry:
+    // The type lookups are lock-free, so check whether the type got loaded to the target level by another thread
+    // before taking the pending type load lock. This is the common case for threads that race to load the same
+    // new instantiation, and on the retries after waiting for the load on another thread.
+    if (typeHnd.IsNull())
+    {
+        typeHnd = LookupTypeHandleForTypeKey(pTypeKey);
+    }
+
+    if (!typeHnd.IsNull() && typeHnd.GetLoadLevel() >= targetLevel)
+    {
+        RETURN typeHnd;
+    }
+
     unresolvedClassLockHolder.Acquire();
 
     // Is it in the hash of classes currently being loaded?
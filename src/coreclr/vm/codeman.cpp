@@ -65,6 +65,8 @@ VOLATILE_SVAL_IMPL_INIT(LONG, ExecutionManager, m_dwWriterLock, 0);
 
 CrstStatic ExecutionManager::m_JumpStubCrst;
 
+LONG       ExecutionManager::m_codeLookupGeneration = 1;
+
 unsigned   ExecutionManager::m_normal_JumpStubLookup;
 unsigned   ExecutionManager::m_normal_JumpStubUnique;
 unsigned   ExecutionManager::m_normal_JumpStubBlockAllocCount;
@@ -1194,6 +1196,9 @@ EEJitManager::EEJitManager()
     :
     m_CPUCompileFlags(),
     m_JitLoadCritSec( CrstSingleUseLock )
+#ifdef TARGET_AMD64
+    , m_IdenticalCodeCritSec( CrstLeafLock )
+#endif
 {
     CONTRACTL {
         THROWS;
@@ -1204,6 +1209,7 @@ EEJitManager::EEJitManager()
     m_JITCompiler      = NULL;
 #ifdef TARGET_AMD64
     m_pEmergencyJumpStubReserveList = NULL;
+    m_pIdenticalCodeMap = NULL;
 #endif
 #if defined(TARGET_X86) || defined(TARGET_AMD64)
     m_JITCompilerOther = NULL;
@@ -1435,6 +1441,13 @@ void EEJitManager::SetCpuInfo()
                 CPUCompileFlags.Set(InstructionSet_Sve2);
             }
         }
+        else
+        {
+            // The JIT only models 128-bit scalable vectors (and Vector<T> stays 128-bit), so SVE is not
+            // used on wider implementations, e.g. 256-bit Neoverse V1.
+            LOG((LF_JIT, LL_INFO10, "SVE disabled: system vector length is %u bytes, only 16 is supported\n",
+                (unsigned)sveLengthFromOS));
+        }
     }
 
     // DCZID_EL0<4> (DZP) indicates whether use of DC ZVA instructions is permitted (0) or prohibited (1).
@@ -2291,6 +2304,67 @@ VOID EEJitManager::EnsureJumpStubReserve(BYTE * pImageBase, SIZE_T imageSize, SI
         m_pEmergencyJumpStubReserveList = pNewReserve.Extract();
     }
 }
+
+static bool IsIdenticalCode(const IdenticalCodeEntry& entry1, const IdenticalCodeEntry& entry2)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return entry1.m_pModule == entry2.m_pModule &&
+        entry1.m_codeSize == entry2.m_codeSize &&
+        entry1.m_unwindSize == entry2.m_unwindSize &&
+        entry1.m_GCInfoSize == entry2.m_GCInfoSize &&
+        memcmp(entry1.m_pCode, entry2.m_pCode, entry1.m_codeSize) == 0 &&
+        memcmp(entry1.m_pUnwindBlock, entry2.m_pUnwindBlock, entry1.m_unwindSize) == 0 &&
+        memcmp(entry1.m_pGCInfo, entry2.m_pGCInfo, entry1.m_GCInfoSize) == 0;
+}
+
+// Returns the entry point of a published method body that is identical to the described one, or NULL
+PCODE EEJitManager::FindIdenticalCode(const IdenticalCodeEntry& entry)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    CrstHolder ch(&m_IdenticalCodeCritSec);
+
+    if (m_pIdenticalCodeMap == NULL)
+        return (PCODE)NULL;
+
+    for (SHash<IdenticalCodeTraits>::KeyIterator it = m_pIdenticalCodeMap->Begin(entry.m_hash), end = m_pIdenticalCodeMap->End(entry.m_hash);
+         it != end;
+         ++it)
+    {
+        if (IsIdenticalCode(*it, entry))
+            return (PCODE)it->m_pCode;
+    }
+
+    return (PCODE)NULL;
+}
+
+// Records a published method body that methods compiled later with identical code can share
+void EEJitManager::AddIdenticalCode(const IdenticalCodeEntry& entry)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    CrstHolder ch(&m_IdenticalCodeCritSec);
+
+    // Failing to record the body only means that it is not shared
+    EX_TRY
+    {
+        if (m_pIdenticalCodeMap == NULL)
+            m_pIdenticalCodeMap = new SHash<IdenticalCodeTraits>();
+
+        m_pIdenticalCodeMap->Add(entry);
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH
+}
 #endif // TARGET_AMD64
 
 static size_t GetDefaultReserveForJumpStubs(size_t codeHeapSize)
@@ -2460,6 +2534,8 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 #endif // TARGET_64BIT
 
     pHp->pLoaderAllocator = pInfo->m_pAllocator;
+    pHp->fOptimizedCode = pInfo->IsOptimizedCode();
+    pHp->fHotCode = pInfo->IsHotCode();
 
     LOG((LF_JIT, LL_INFO100,
          "Created new CodeHeap(" FMT_ADDR ".." FMT_ADDR ")\n",
@@ -2719,6 +2795,17 @@ void* EECodeGenManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         }
         else
 #endif // FEATURE_INTERPRETER
+        if (pInfo->IsHotCode())
+        {
+            pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedHotCodeHeap;
+            pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = NULL;
+        }
+        else if (pInfo->IsOptimizedCode())
+        {
+            pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap;
+            pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap = NULL;
+        }
+        else
         {
             pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
             pInfo->m_pAllocator->m_pLastUsedCodeHeap = NULL;
@@ -2797,6 +2884,15 @@ void* EECodeGenManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         }
         else
 #endif // FEATURE_INTERPRETER
+        if (pInfo->IsHotCode())
+        {
+            pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = pCodeHeap;
+        }
+        else if (pInfo->IsOptimizedCode())
+        {
+            pInfo->m_pAllocator->m_pLastUsedOptimizedCodeHeap = pCodeHeap;
+        }
+        else
         {
             pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
         }
@@ -2817,7 +2913,8 @@ void* EECodeGenManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
 }
 
 template<typename TCodeHeader>
-void EECodeGenManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, void** ppCodeHeader, void** ppCodeHeaderRW,
+void EECodeGenManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isOptimizedCode, bool isHotCode,
+                                 void** ppCodeHeader, void** ppCodeHeaderRW,
                                  size_t* pAllocatedSize, HeapList** ppCodeHeap
                                , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2880,6 +2977,21 @@ void EECodeGenManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reser
     {
         requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+        // Keep optimized code apart from the short-lived tier 0 and instrumented bodies it replaces, so the
+        // code that stays live is packed densely and is friendlier to the i-cache and iTLB. LCG methods
+        // use their own free-list heaps and are not affected.
+        if (isOptimizedCode && !requestInfo.IsDynamicDomain())
+        {
+            requestInfo.SetOptimizedCode();
+
+            // Within optimized code, methods that became hot quickly are clustered again, so that callers and
+            // callees that were promoted together end up next to each other.
+            if (isHotCode)
+            {
+                requestInfo.SetHotCode();
+            }
+        }
+
 #ifdef FEATURE_EH_FUNCLETS
         realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 #else
@@ -2967,7 +3079,8 @@ void EECodeGenManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reser
     *ppCodeHeaderRW = pCodeHdrRW;
 }
 
-template void EECodeGenManager::allocCode<CodeHeader>(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, void** ppCodeHeader, void** ppCodeHeaderRW,
+template void EECodeGenManager::allocCode<CodeHeader>(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isOptimizedCode, bool isHotCode,
+                                                      void** ppCodeHeader, void** ppCodeHeaderRW,
                                                       size_t* pAllocatedSize, HeapList** ppCodeHeap
                                                     , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -2976,7 +3089,8 @@ template void EECodeGenManager::allocCode<CodeHeader>(MethodDesc* pMD, size_t bl
                                                      );
 
 #ifdef FEATURE_INTERPRETER
-template void EECodeGenManager::allocCode<InterpreterCodeHeader>(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, void** ppCodeHeader, void** ppCodeHeaderRW,
+template void EECodeGenManager::allocCode<InterpreterCodeHeader>(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isOptimizedCode, bool isHotCode,
+                                                                 void** ppCodeHeader, void** ppCodeHeaderRW,
                                                                  size_t* pAllocatedSize, HeapList** ppCodeHeap
                                                                , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
@@ -3036,6 +3150,12 @@ bool EECodeGenManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCod
 
     bool retVal = false;
 
+    // Optimized code and tier 0 code never share a heap, neither do hot and other optimized code
+    if (pInfo->IsOptimizedCode() != pCodeHeap->fOptimizedCode || pInfo->IsHotCode() != pCodeHeap->fHotCode)
+    {
+        return false;
+    }
+
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
     {
         // We have no constraint so this non empty heap will be able to satisfy our request
@@ -4587,6 +4707,8 @@ void EECodeGenManager::NibbleMapDeleteUnlocked(HeapList* pHp, TADDR pCode)
 
     _ASSERTE(pCode >= pHp->mapBase);
 
+    ExecutionManager::InvalidateCodeLookupCaches();
+
     // remove bottom two bits to ensure alignment math
     // on ARM32 Thumb, the low bits indicate the thumb instruction set
     pCode = ALIGN_DOWN(pCode, CODE_ALIGN);
@@ -5339,6 +5461,7 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
 
     RangeSection *pCurr = FindCodeRangeWithLock(pStartRange);
     GetCodeRangeMap()->RemoveRangeSection(pCurr);
+    InvalidateCodeLookupCaches();
 
 
 #if defined(TARGET_AMD64)
@@ -419,6 +419,8 @@ struct CodeHeapRequestInfo
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
     bool         m_isInterpreted;
+    bool         m_isOptimizedCode;   // fully optimized (tier 1) code, kept apart from tier 0 and instrumented code
+    bool         m_isHotCode;         // optimized code of hot methods, clustered apart from other optimized code
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
@@ -429,6 +431,12 @@ struct CodeHeapRequestInfo
     bool   IsInterpreted()                      { return m_isInterpreted;       }
     void   SetInterpreted()                     { m_isInterpreted = true;      }
 
+    bool   IsOptimizedCode()                    { return m_isOptimizedCode;    }
+    void   SetOptimizedCode()                   { m_isOptimizedCode = true;    }
+
+    bool   IsHotCode()                          { return m_isHotCode;          }
+    void   SetHotCode()                         { m_isHotCode = true;          }
+
     size_t getRequestSize()                     { return m_requestSize;        }
     void   setRequestSize(size_t requestSize)   { m_requestSize = requestSize; }
 
@@ -447,7 +455,7 @@ struct CodeHeapRequestInfo
         : m_pMD(pMD), m_pAllocator(0),
           m_loAddr(0), m_hiAddr(0),
           m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0)
-        , m_isInterpreted(false)
+        , m_isInterpreted(false), m_isOptimizedCode(false), m_isHotCode(false)
     { WRAPPER_NO_CONTRACT;   Init(); }
 
     CodeHeapRequestInfo(MethodDesc *pMD, LoaderAllocator* pAllocator,
@@ -455,7 +463,7 @@ struct CodeHeapRequestInfo
         : m_pMD(pMD), m_pAllocator(pAllocator),
           m_loAddr(loAddr), m_hiAddr(hiAddr),
           m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0)
-        , m_isInterpreted(false)
+        , m_isInterpreted(false), m_isOptimizedCode(false), m_isHotCode(false)
     { WRAPPER_NO_CONTRACT;   Init(); }
 };
 
@@ -534,6 +542,8 @@ struct HeapList
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
 
     PTR_LoaderAllocator pLoaderAllocator; // LoaderAllocator of HeapList
+    bool                fOptimizedCode; // Heap only holds fully optimized (tier 1) code
+    bool                fHotCode;       // Heap only holds optimized code of hot methods
 #if defined(TARGET_64BIT)
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine, NULL if there is no personality routine (e.g. interpreter code heap)
 #endif
@@ -1882,7 +1892,8 @@ public:
     void CleanupCodeHeaps();
 
     template<typename TCodeHeader>
-    void allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, void** ppCodeHeader, void** ppCodeHeaderRW,
+    void allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isOptimizedCode, bool isHotCode,
+                   void** ppCodeHeader, void** ppCodeHeaderRW,
                    size_t* pAllocatedSize, HeapList** ppCodeHeap , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
                  , UINT nUnwindInfos
@@ -1988,6 +1999,21 @@ private:
 
 /*****************************************************************************/
 
+#ifdef TARGET_AMD64
+// A published method body, see code:EEJitManager::FindIdenticalCode
+struct IdenticalCodeEntry
+{
+    DWORD        m_hash;
+    const BYTE * m_pCode;
+    DWORD        m_codeSize;
+    const BYTE * m_pUnwindBlock;
+    DWORD        m_unwindSize;
+    const BYTE * m_pGCInfo;
+    size_t       m_GCInfoSize;
+    Module *     m_pModule;
+};
+#endif // TARGET_AMD64
+
 class EEJitManager final : public EECodeGenManager
 {
 #ifdef DACCESS_COMPILE
@@ -2189,6 +2215,29 @@ private:
 public:
     BYTE * AllocateFromEmergencyJumpStubReserve(const BYTE * loAddr, const BYTE * hiAddr, SIZE_T * pReserveSize);
     VOID EnsureJumpStubReserve(BYTE * pImageBase, SIZE_T imageSize, SIZE_T reserveSize);
+
+#ifndef DACCESS_COMPILE
+    // Method bodies that methods compiled later with identical code may share instead of keeping their own copy,
+    // see code:CEEJitInfo::FindIdenticalCode
+    PCODE FindIdenticalCode(const IdenticalCodeEntry& entry);
+    void AddIdenticalCode(const IdenticalCodeEntry& entry);
+#endif // !DACCESS_COMPILE
+
+private:
+    class IdenticalCodeTraits : public NoRemoveSHashTraits<DefaultSHashTraits<IdenticalCodeEntry>>
+    {
+    public:
+        typedef DWORD key_t;
+
+        static key_t GetKey(const element_t& e) { LIMITED_METHOD_CONTRACT; return e.m_hash; }
+        static BOOL Equals(key_t k1, key_t k2) { LIMITED_METHOD_CONTRACT; return k1 == k2; }
+        static count_t Hash(key_t k) { LIMITED_METHOD_CONTRACT; return (count_t)k; }
+        static element_t Null() { LIMITED_METHOD_CONTRACT; element_t e = {}; return e; }
+        static bool IsNull(const element_t& e) { LIMITED_METHOD_CONTRACT; return e.m_pCode == NULL; }
+    };
+
+    SHash<IdenticalCodeTraits> * m_pIdenticalCodeMap;
+    Crst                m_IdenticalCodeCritSec;
 #endif
 
 public:
@@ -2248,6 +2297,22 @@ public:
     // Returns true if currentPC is ready to run codegen
     static BOOL IsReadyToRunCode(PCODE currentPC);
 
+#ifndef DACCESS_COMPILE
+    // Lookups cached by code:EECodeInfo::Init are valid for as long as this generation does not change
+    static LONG GetCodeLookupGeneration()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoad(&m_codeLookupGeneration);
+    }
+
+    // Must be called whenever code is removed from the code map so that stale cached lookups are discarded
+    static void InvalidateCodeLookupCaches()
+    {
+        LIMITED_METHOD_CONTRACT;
+        InterlockedIncrement(&m_codeLookupGeneration);
+    }
+#endif // !DACCESS_COMPILE
+
     // Returns method's start address for a given PC
     static PCODE GetCodeStartAddress(PCODE currentPC);
 
@@ -2390,6 +2455,10 @@ private:
     static CrstStatic       m_JumpStubCrst;
     static CrstStatic       m_RangeCrst;        // Acquire before writing into m_CodeRangeList and m_DataRangeList
 
+#ifndef DACCESS_COMPILE
+    static LONG             m_codeLookupGeneration;
+#endif
+
     // Make the CodeRangeMap a global, initialized as the process starts up.
     // The odd formulation of a BYTE array is used to avoid an extra memory indirection
     // that would be needed if the memory for the CodeRangeMap was dynamically allocated.
@@ -2978,6 +3047,45 @@ private:
     UNWIND_INFO * GetUnwindInfoHelper(ULONG unwindInfoOffset);
 #endif // TARGET_AMD64
 
+#ifndef DACCESS_COMPILE
+    // Stack walks, exception dispatch and GC stack scans resolve the same return addresses over and over
+    // again. A small direct mapped per-thread cache of recent results lets them skip the range section
+    // map and the nibble map. The cache is flushed when code is removed, see
+    // code:ExecutionManager::InvalidateCodeLookupCaches.
+    struct LookupCacheEntry
+    {
+        PCODE                codeAddress;
+        RangeSection        *pRangeSection;
+        TADDR                pCodeHeader;
+        MethodDesc          *pMD;
+        IJitManager         *pJM;
+        DWORD                relOffset;
+#ifdef FEATURE_EH_FUNCLETS
+        IsFuncletCache       isFuncletCache;
+        PTR_RUNTIME_FUNCTION pFunctionEntry;
+#endif // FEATURE_EH_FUNCLETS
+    };
+
+    static const DWORD LOOKUP_CACHE_SIZE = 64;
+
+    struct LookupCache
+    {
+        LONG             generation;
+        LookupCacheEntry entries[LOOKUP_CACHE_SIZE];
+    };
+
+    static thread_local LookupCache t_lookupCache;
+
+    static DWORD LookupCacheIndex(PCODE codeAddress)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (DWORD)((codeAddress >> 2) ^ (codeAddress >> 10)) & (LOOKUP_CACHE_SIZE - 1);
+    }
+
+    bool TryInitFromLookupCache(PCODE codeAddress, LONG generation);
+    void AddToLookupCache(LONG generation);
+#endif // !DACCESS_COMPILE
+
 };
 
 #ifdef FEATURE_INTERPRETER
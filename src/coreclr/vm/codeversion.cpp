@@ -159,6 +159,21 @@ void NativeCodeVersionNode::SetOptimizationTier(NativeCodeVersion::OptimizationT
 }
 #endif
 
+BOOL NativeCodeVersionNode::IsHotCode() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    return (m_flags & IsHotCodeFlag) != 0;
+}
+
+#ifndef DACCESS_COMPILE
+void NativeCodeVersionNode::SetHotCodeFlag()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
+    m_flags |= IsHotCodeFlag;
+}
+#endif
+
 #endif // FEATURE_TIERED_COMPILATION
 
 #ifdef FEATURE_ON_STACK_REPLACEMENT
@@ -342,6 +357,12 @@ bool NativeCodeVersion::IsFinalTier() const
     return tier == OptimizationTier1 || tier == OptimizationTierOptimized;
 }
 
+bool NativeCodeVersion::IsHotCode() const
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    return m_storageKind == StorageKind::Explicit && AsNode()->IsHotCode();
+}
+
 #ifndef DACCESS_COMPILE
 void NativeCodeVersion::SetOptimizationTier(OptimizationTier tier)
 {
@@ -356,6 +377,17 @@ void NativeCodeVersion::SetOptimizationTier(OptimizationTier tier)
         _ASSERTE(TieredCompilationManager::GetInitialOptimizationTier(GetMethodDesc()) == tier);
     }
 }
+
+void NativeCodeVersion::SetHotCode()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Only versions created by tier promotion are explicit, the default version is never marked
+    if (m_storageKind == StorageKind::Explicit)
+    {
+        AsNode()->SetHotCodeFlag();
+    }
+}
 #endif
 
 #endif
@@ -849,6 +881,26 @@ bool ILCodeVersion::HasAnyOptimizedNativeCodeVersion(NativeCodeVersion tier0Nati
 }
 #endif
 
+#if defined(FEATURE_ON_STACK_REPLACEMENT) && !defined(DACCESS_COMPILE)
+DWORD ILCodeVersion::GetOsrNativeCodeVersionCount(PTR_MethodDesc pClosedMethodDesc) const
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
+
+    DWORD count = 0;
+    NativeCodeVersionCollection nativeCodeVersions = GetNativeCodeVersions(pClosedMethodDesc);
+    for (auto itEnd = nativeCodeVersions.End(), it = nativeCodeVersions.Begin(); it != itEnd; ++it)
+    {
+        if ((*it).GetOptimizationTier() == NativeCodeVersion::OptimizationTier1OSR)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+#endif
+
 RejitFlags ILCodeVersion::GetRejitState() const
 {
     LIMITED_METHOD_DAC_CONTRACT;
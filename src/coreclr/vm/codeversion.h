@@ -84,8 +84,10 @@ public:
 #ifdef FEATURE_TIERED_COMPILATION
     OptimizationTier GetOptimizationTier() const;
     bool IsFinalTier() const;
+    bool IsHotCode() const;
 #ifndef DACCESS_COMPILE
     void SetOptimizationTier(OptimizationTier tier);
+    void SetHotCode();
 #endif
 #endif // FEATURE_TIERED_COMPILATION
 
@@ -196,6 +198,9 @@ public:
     NativeCodeVersion GetActiveNativeCodeVersion(PTR_MethodDesc pClosedMethodDesc) const;
 #if defined(FEATURE_TIERED_COMPILATION) && !defined(DACCESS_COMPILE)
     bool HasAnyOptimizedNativeCodeVersion(NativeCodeVersion tier0NativeCodeVersion) const;
+#endif
+#if defined(FEATURE_ON_STACK_REPLACEMENT) && !defined(DACCESS_COMPILE)
+    DWORD GetOsrNativeCodeVersionCount(PTR_MethodDesc pClosedMethodDesc) const;
 #endif
     PTR_COR_ILMETHOD GetIL() const;
     DWORD GetJitFlags() const;
@@ -278,8 +283,10 @@ public:
 
 #ifdef FEATURE_TIERED_COMPILATION
     NativeCodeVersion::OptimizationTier GetOptimizationTier() const;
+    BOOL IsHotCode() const; // Can be called without any locks
 #ifndef DACCESS_COMPILE
     void SetOptimizationTier(NativeCodeVersion::OptimizationTier tier);
+    void SetHotCodeFlag();
 #endif
 #endif // FEATURE_TIERED_COMPILATION
 
@@ -315,7 +322,8 @@ private:
 
     enum NativeCodeVersionNodeFlags
     {
-        IsActiveChildFlag = 1
+        IsActiveChildFlag = 1,
+        IsHotCodeFlag = 2 // Call counting completed quickly, see TieredCompilation_HotCodeCallCountingMs
     };
     DWORD m_flags;
 
@@ -2187,6 +2187,8 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
         ILCodeStream *pCode = sl.NewCodeStream(ILStubLinker::kDispatch);
 
         DWORD dwLoopCounterNum = pCode->NewLocal(ELEMENT_TYPE_I4);
+        DWORD dwInvocationListNum = pCode->NewLocal(ELEMENT_TYPE_OBJECT);
+        DWORD dwInvocationCountNum = pCode->NewLocal(ELEMENT_TYPE_I);
 
         DWORD dwReturnValNum = -1;
         if (fReturnVal)
@@ -2194,10 +2196,30 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         ILCodeLabel *nextDelegate = pCode->NewCodeLabel();
 
+        // The invocation list of a multicast delegate never changes, so load it and its count once
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitSTLOC(dwInvocationListNum);
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitSTLOC(dwInvocationCountNum);
+
         // initialize counter
         pCode->EmitLDC(0);
         pCode->EmitSTLOC(dwLoopCounterNum);
 
+        // Small invocation lists, the common case for events, are invoked by straight-line code
+        // without the loop counter bookkeeping. Lists of other sizes take the loop below.
+        const UINT MaxUnrolledInvocationCount = 4;
+        ILCodeLabel *unrolledInvoke[MaxUnrolledInvocationCount + 1] = {};
+        for (UINT count = 2; count <= MaxUnrolledInvocationCount; count++)
+        {
+            unrolledInvoke[count] = pCode->NewCodeLabel();
+            pCode->EmitLDLOC(dwInvocationCountNum);
+            pCode->EmitLDC(count);
+            pCode->EmitBEQ(unrolledInvoke[count]);
+        }
+
         //Label_nextDelegate:
         pCode->EmitLabel(nextDelegate);
 
@@ -2218,8 +2240,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 #endif // DEBUGGING_SUPPORTED
 
         // Load next delegate from array using LoopCounter as index
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDLOC(dwInvocationListNum);
         pCode->EmitLDLOC(dwLoopCounterNum);
         pCode->EmitLDELEM_REF();
 
@@ -2242,8 +2263,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         // compare LoopCounter with InvocationCount. If less then branch to nextDelegate
         pCode->EmitLDLOC(dwLoopCounterNum);
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitLDLOC(dwInvocationCountNum);
         pCode->EmitBLT(nextDelegate);
 
         // load the return value. return value from the last delegate call is returned
@@ -2254,6 +2274,52 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
         pCode->EmitRET();
 
 #ifdef DEBUGGING_SUPPORTED
+        // When a controller starts tracing, an unrolled invoke continues in the loop from the
+        // delegate it was about to call, so every remaining call goes through the trace helper.
+        ILCodeLabel *traceFromDelegate[MaxUnrolledInvocationCount] = {};
+        for (UINT index = 0; index < MaxUnrolledInvocationCount; index++)
+            traceFromDelegate[index] = pCode->NewCodeLabel();
+#endif // DEBUGGING_SUPPORTED
+
+        for (UINT count = 2; count <= MaxUnrolledInvocationCount; count++)
+        {
+            pCode->EmitLabel(unrolledInvoke[count]);
+
+            for (UINT index = 0; index < count; index++)
+            {
+#ifdef DEBUGGING_SUPPORTED
+                pCode->EmitLDC((DWORD_PTR)&g_multicastDelegateTraceActiveCount);
+                pCode->EmitCONV_I();
+                pCode->EmitLDIND_I4();
+                pCode->EmitBRTRUE(traceFromDelegate[index]);
+#endif // DEBUGGING_SUPPORTED
+
+                pCode->EmitLDLOC(dwInvocationListNum);
+                pCode->EmitLDC(index);
+                pCode->EmitLDELEM_REF();
+
+                for (UINT paramCount = 0; paramCount < sig.NumFixedArgs(); paramCount++)
+                    pCode->EmitLDARG(paramCount);
+
+                pCode->EmitCALL(pCode->GetToken(pMD), sig.NumFixedArgs(), fReturnVal);
+
+                // Only the return value of the last delegate is returned
+                if (fReturnVal && index != count - 1)
+                    pCode->EmitPOP();
+            }
+
+            pCode->EmitRET();
+        }
+
+#ifdef DEBUGGING_SUPPORTED
+        for (UINT index = 0; index < MaxUnrolledInvocationCount; index++)
+        {
+            pCode->EmitLabel(traceFromDelegate[index]);
+            pCode->EmitLDC(index);
+            pCode->EmitSTLOC(dwLoopCounterNum);
+            pCode->EmitBR(nextDelegate);
+        }
+
         // Emit debugging support at the end of the method for better perf
         pCode->EmitLabel(invokeTraceHelper);
 
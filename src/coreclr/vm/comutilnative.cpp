@@ -895,6 +895,24 @@ extern "C" void QCALLTYPE GCInterface_WaitForPendingFinalizers()
     END_QCALL;
 }
 
+/*=========================GetFinalizationStatistics============================
+**Action: Returns the number of objects waiting for their finalizer to run and the
+**        number of finalizers that have run, for the runtime counters
+**Arguments: None
+**Exceptions: None
+==============================================================================*/
+extern "C" void QCALLTYPE GCInterface_GetFinalizationStatistics(UINT64* pQueueLength, UINT64* pFinalizedCount)
+{
+    QCALL_CONTRACT;
+
+    BEGIN_QCALL;
+
+    *pQueueLength = FinalizerThread::GetFinalizationQueueLength();
+    *pFinalizedCount = FinalizerThread::GetFinalizedObjectCount();
+
+    END_QCALL;
+}
+
 
 /*===============================GetMaxGeneration===============================
 **Action: Returns the largest GC generation
@@ -5674,6 +5674,27 @@ PCODE JitILStub(MethodDesc* pStubMD)
     return pCode;
 }
 
+void NDirect::PregenerateILStub(NDirectMethodDesc* pNMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    // varargs go through the shared vararg NDirect stub
+    if (pNMD->IsVarArgs())
+        return;
+
+    PInvokeStaticSigInfo sigInfo;
+    NDirect::InitializeSigInfoAndPopulateNDirectMethodDesc(pNMD, &sigInfo);
+
+    MethodDesc* pStubMD = GetILStubMethodDesc(pNMD, &sigInfo, 0);
+    if (pStubMD != NULL)
+    {
+        JitILStub(pStubMD);
+    }
+
+    // Binding the target is left to the first call: it may load native libraries and
+    // run DllImport resolvers, which must happen on the calling thread and in call order.
+}
+
 PCODE GetStubForInteropMethod(MethodDesc* pMD, DWORD dwStubFlags)
 {
     CONTRACT(PCODE)
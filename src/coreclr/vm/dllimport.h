@@ -136,6 +136,10 @@ public:
     static PCODE            GetStubForILStub(NDirectMethodDesc* pNMD, MethodDesc** ppStubMD, DWORD dwStubFlags);
     static PCODE            GetStubForILStub(MethodDesc* pMD, MethodDesc** ppStubMD, DWORD dwStubFlags);
 
+    // Generate and JIT the IL stub of a P/Invoke ahead of its first call, without binding the native target.
+    // The stub lands in the IL stub cache, where GetStubForILStub finds it on the first call.
+    static void             PregenerateILStub(NDirectMethodDesc* pNMD);
+
 private:
     NDirect() {LIMITED_METHOD_CONTRACT;};     // prevent "new"'s on this class
 };
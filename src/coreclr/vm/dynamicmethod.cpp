@@ -473,6 +473,8 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
 
     pHp->maxCodeHeapSize = m_TotalBytesAvailable - (pTracker ? pTracker->size : 0);
     pHp->reserveForJumpStubs = 0;
+    pHp->fOptimizedCode = false;
+    pHp->fHotCode = false;
 
 #if defined(TARGET_64BIT)
     if (pHp->CLRPersonalityRoutine != NULL)
@@ -206,10 +206,16 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     fTieredCompilation_UseCallCountingStubs = false;
+    fTieredCompilation_SeparateOptimizedCodeHeap = false;
+    fTieredCompilation_FoldIdenticalCode = false;
+    fTieredCompilation_InterpreterTierUp = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
+    tieredCompilation_HotCodeCallCountingMs = 0;
+    tieredCompilation_InterpreterTierUpThreshold = 0;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -225,6 +231,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    dwOSR_Tier1PromotionThreshold = 1;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -650,6 +657,9 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerCount =
+            max((DWORD)1, CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount));
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -696,6 +706,32 @@ HRESULT EEConfig::sync()
             }
         }
 
+        fTieredCompilation_SeparateOptimizedCodeHeap =
+            CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_SeparateOptimizedCodeHeap) != 0;
+        if (fTieredCompilation_SeparateOptimizedCodeHeap)
+        {
+            tieredCompilation_HotCodeCallCountingMs =
+                CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_HotCodeCallCountingMs);
+        }
+
+#ifdef TARGET_AMD64
+        fTieredCompilation_FoldIdenticalCode =
+            CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_FoldIdenticalCode) != 0;
+#endif
+
+#if defined(FEATURE_INTERPRETER) && defined(FEATURE_JIT)
+        if (fTieredCompilation_CallCounting)
+        {
+            fTieredCompilation_InterpreterTierUp =
+                CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_InterpreterTierUp) != 0;
+            if (fTieredCompilation_InterpreterTierUp)
+            {
+                DWORD threshold = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_InterpreterTierUpThreshold);
+                tieredCompilation_InterpreterTierUpThreshold = (INT32)min<DWORD>(max<DWORD>(threshold, 1), INT32_MAX);
+            }
+        }
+#endif // FEATURE_INTERPRETER && FEATURE_JIT
+
         if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_AggressiveTiering) != 0)
         {
             // TC_AggressiveTiering may be used in some benchmarks to have methods be tiered up more quickly, for example when
@@ -738,6 +774,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    dwOSR_Tier1PromotionThreshold = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_Tier1PromotionThreshold);
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -82,11 +82,17 @@ public:
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     DWORD         TieredCompilation_BackgroundWorkerTimeoutMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerTimeoutMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
+    bool          TieredCompilation_SeparateOptimizedCodeHeap() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_SeparateOptimizedCodeHeap; }
+    DWORD         TieredCompilation_HotCodeCallCountingMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_HotCodeCallCountingMs; }
+    bool          TieredCompilation_FoldIdenticalCode() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_FoldIdenticalCode; }
+    bool          TieredCompilation_InterpreterTierUp() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_InterpreterTierUp; }
+    INT32         TieredCompilation_InterpreterTierUpThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_InterpreterTierUpThreshold; }
 #endif
 
 #if defined(FEATURE_PGO)
@@ -103,6 +109,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    DWORD         OSR_Tier1PromotionThreshold() const { LIMITED_METHOD_CONTRACT; return dwOSR_Tier1PromotionThreshold; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -594,10 +601,16 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_QuickJitForLoops;
     bool fTieredCompilation_CallCounting;
     bool fTieredCompilation_UseCallCountingStubs;
+    bool fTieredCompilation_SeparateOptimizedCodeHeap;
+    bool fTieredCompilation_FoldIdenticalCode;
+    bool fTieredCompilation_InterpreterTierUp;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
     DWORD tieredCompilation_CallCountingDelayMs;
     DWORD tieredCompilation_DeleteCallCountingStubsAfter;
+    DWORD tieredCompilation_HotCodeCallCountingMs;
+    INT32 tieredCompilation_InterpreterTierUpThreshold;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -613,6 +626,7 @@ private: //----------------------------------------------------------------
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
     DWORD dwOSR_CounterBump;
+    DWORD dwOSR_Tier1PromotionThreshold;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -335,6 +335,66 @@ ds_rt_disable_perfmap (void)
 #endif // FEATURE_PERFMAP
 }
 
+static
+uint32_t
+ds_rt_get_runtime_metrics (
+	uint64_t *generation_sizes,
+	uint64_t *gc_counts,
+	uint64_t *gc_total_pause_duration,
+	uint64_t *jit_method_count,
+	uint64_t *jit_time,
+	uint64_t *lock_contention_count)
+{
+	CONTRACTL
+	{
+		NOTHROW;
+		GC_TRIGGERS;
+		MODE_PREEMPTIVE;
+	}
+	CONTRACTL_END;
+
+	// The GC heap does not exist yet while the runtime is paused at the diagnostic startup suspension point.
+	if (!g_fEEStarted)
+		return DS_IPC_E_RUNTIME_UNINITIALIZED;
+
+	IGCHeap *gc_heap = GCHeapUtilities::GetGCHeap ();
+
+	// Sizes are the ones recorded at the end of the last GC, the same values GC.GetGCMemoryInfo reports.
+	for (int gen = 0; gen < DS_RUNTIME_METRICS_HEAP_GENERATION_COUNT; gen++)
+		generation_sizes [gen] = (uint64_t)gc_heap->GetLastGCGenerationSize (gen);
+
+	for (int gen = 0; gen < DS_RUNTIME_METRICS_GC_GENERATION_COUNT; gen++)
+		gc_counts [gen] = (uint64_t)gc_heap->CollectionCount (gen);
+
+	*gc_total_pause_duration = (uint64_t)gc_heap->GetTotalPauseDuration ();
+	*jit_method_count = (uint64_t)InterlockedCompareExchange64 ((LONGLONG *)g_cMethodsJitted.GetPointer (), 0, 0);
+	*jit_time = (uint64_t)InterlockedCompareExchange64 ((LONGLONG *)g_c100nsTicksInJit.GetPointer (), 0, 0);
+
+	// Takes the thread store lock to sum the per-thread counts.
+	*lock_contention_count = Thread::GetTotalMonitorLockContentionCount ();
+
+	return DS_IPC_S_OK;
+}
+
+static
+uint32_t
+ds_rt_get_startup_phases (
+	uint64_t *phase_durations,
+	uint32_t max_count,
+	uint32_t *phase_count)
+{
+	LIMITED_METHOD_CONTRACT;
+
+	static_assert (EEStartupPhase_Count <= DS_STARTUP_PHASES_MAX_COUNT, "The payload cannot hold every startup phase");
+
+	// Durations are published when EEStartupHelper completes, the last phases are still running before that.
+	*phase_count = GetEEStartupPhaseDurations (phase_durations, max_count);
+	if (*phase_count == 0)
+		return DS_IPC_E_RUNTIME_UNINITIALIZED;
+
+	return DS_IPC_S_OK;
+}
+
 static ep_char16_t * _ds_rt_coreclr_diagnostic_startup_hook_paths = NULL;
 
 static
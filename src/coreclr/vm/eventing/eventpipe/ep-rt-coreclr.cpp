@@ -94,7 +94,8 @@ static
 void
 walk_managed_stack_for_threads (
 	ep_rt_thread_handle_t sampling_thread,
-	EventPipeEvent *sampling_event)
+	EventPipeEvent *sampling_event,
+	bool running_threads_only)
 {
 	STATIC_CONTRACT_NOTHROW;
 	EP_ASSERT (sampling_thread != NULL);
@@ -110,6 +111,12 @@ walk_managed_stack_for_threads (
 	// Iterate over all managed threads.
 	// Assumes that the ThreadStoreLock is held because we've suspended all threads.
 	while ((target_thread = ThreadStore::GetThreadList (target_thread)) != NULL) {
+		// Threads in preemptive mode are blocked or running native code, skip them if only running threads are sampled.
+		if (running_threads_only && !target_thread->GetGCModeOnSuspension ()) {
+			target_thread->ClearGCModeOnSuspension ();
+			continue;
+		}
+
 		ep_stack_contents_reset (current_stack_contents);
 
 		// Walk the stack and write it out as an event.
@@ -136,6 +143,23 @@ walk_managed_stack_for_threads (
 	ep_stack_contents_fini (current_stack_contents);
 }
 
+static
+bool
+any_thread_running_managed_code (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+	ThreadStoreLockHolder thread_store_lock;
+
+	Thread *thread = NULL;
+	while ((thread = ThreadStore::GetThreadList (thread)) != NULL) {
+		if (thread->PreemptiveGCDisabledOther ())
+			return true;
+	}
+
+	return false;
+}
+
 void
 ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	ep_rt_thread_handle_t sampling_thread,
@@ -148,11 +172,18 @@ ep_rt_coreclr_sample_profiler_write_sampling_event_for_threads (
 	if (ThreadSuspend::SysIsSuspendInProgress () || (ThreadSuspend::GetSuspensionThread () != 0))
 		return;
 
+	bool running_threads_only = CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeSampleRunningThreadsOnly) != 0;
+
+	// Suspending the runtime is the expensive part of a sample, don't do it when no thread would be sampled.
+	// A thread switching to cooperative mode right after the check only means a missed sample.
+	if (running_threads_only && !any_thread_running_managed_code ())
+		return;
+
 	// Actually suspend managed execution.
 	ThreadSuspend::SuspendEE (ThreadSuspend::SUSPEND_REASON::SUSPEND_OTHER);
 
 	// Walk all managed threads and capture stacks.
-	walk_managed_stack_for_threads (sampling_thread, sampling_event);
+	walk_managed_stack_for_threads (sampling_thread, sampling_event, running_threads_only);
 
 	// Resume managed execution.
 	ThreadSuspend::RestartEE (FALSE /* bFinishedGC */, TRUE /* SuspendSucceeded */);
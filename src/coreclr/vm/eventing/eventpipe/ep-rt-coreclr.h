@@ -551,6 +551,15 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeEnableStackwalk) != 0;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_shared_streaming_thread (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeSharedStreamingThread) != 0;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -149,6 +149,229 @@ public:
         (cbMaxEtwEvent - 0x100) / sizeof(EventStructGCBulkMovedObjectRangesValue)];
 };
 
+//---------------------------------------------------------------------------------------
+// Compact survival and movement tracking
+//
+// When DOTNET_ETW_CompactSurvivalAndMovement is set, the ranges are sent in
+// "SurvivalAndMovement" GCDynamicEvent events rather than GCBulkSurvivingObjectRanges /
+// GCBulkMovedObjectRanges events. The payload of each event is
+//
+//      UINT8   Version (1)
+//      UINT8   Kind (0 = surviving ranges, 1 = moved ranges)
+//      UINT32  GC index
+//      UINT32  Sequence number of the event within this heap walk
+//      UINT32  Number of ranges in the event
+//      UINT32  Number of ranges this heap walk dropped so far because the budget ran out
+//
+// followed by the ranges, each as unsigned LEB128 values:
+//
+//      zigzag(RangeBase - end of the previous range in the event, 0 for the first one)
+//      RangeLength
+//      zigzag(RelocDistance - RelocDistance of the previous range)     (moved ranges only)
+//
+// The GC reports the plugs of a heap in address order, so the deltas are small and most
+// ranges take a few bytes instead of 16 or 24. The range data sent per GC is capped by
+// DOTNET_ETW_CompactSurvivalAndMovementBudget, so tracking can stay on in production.
+//---------------------------------------------------------------------------------------
+
+static bool s_fCompactMovementConfigRead = false;
+static bool s_fCompactMovement = false;
+static DWORD s_cbCompactMovementBudget = 0;
+
+// Range data bytes that may still be sent in the current GC, shared by the heap walks
+static LONG64 s_cbCompactMovementBudgetLeft = 0;
+
+class EtwGcCompactMovementContext
+{
+public:
+    static EtwGcCompactMovementContext* GetOrCreateInGCContext(EtwGcCompactMovementContext** ppContext)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(ppContext != NULL);
+
+        EtwGcCompactMovementContext* pContext = *ppContext;
+        if (pContext == NULL)
+        {
+            pContext = new (nothrow) EtwGcCompactMovementContext;
+            *ppContext = pContext;
+        }
+        return pContext;
+    }
+
+    EtwGcCompactMovementContext() :
+        iCurEvent(0),
+        cDroppedRanges(0),
+        cbReserved(0),
+        fCompacting(FALSE)
+    {
+        LIMITED_METHOD_CONTRACT;
+        gcIndex = GCHeapUtilities::GetGCHeap()->GetGcCount();
+        Clear();
+    }
+
+    void AddRange(BYTE* pbMemBlockStart, BYTE* pbMemBlockEnd, ptrdiff_t cbRelocDistance, BOOL fCompactingRange)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Each event holds a single kind of range
+        if ((cRanges > 0) && (fCompactingRange != fCompacting))
+            Flush();
+
+        // Flush first if a range might not fit, since it is encoded relative to the previous one
+        if ((cbData + cbMaxRange) > sizeof(rgbData))
+            Flush();
+
+        fCompacting = fCompactingRange;
+
+        BYTE* pbRange = &rgbData[cbData];
+        UINT cbRange = 0;
+        cbRange += WriteVarUInt(pbRange + cbRange, ZigZag(pbMemBlockStart - pbPrevEnd));
+        cbRange += WriteVarUInt(pbRange + cbRange, (UINT64)(pbMemBlockEnd - pbMemBlockStart));
+        if (fCompacting)
+            cbRange += WriteVarUInt(pbRange + cbRange, ZigZag(cbRelocDistance - cbPrevRelocDistance));
+
+        if (!ReserveBudget(cbRange))
+        {
+            cDroppedRanges++;
+            return;
+        }
+
+        cbData += cbRange;
+        cRanges++;
+        pbPrevEnd = pbMemBlockEnd;
+        cbPrevRelocDistance = cbRelocDistance;
+    }
+
+    // Sends the pending ranges. At the end of a walk an event is also sent without ranges
+    // if any were dropped, so the consumer can tell the data is incomplete.
+    void Flush(bool fEndOfWalk = false)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if ((cRanges == 0) && !(fEndOfWalk && (cDroppedRanges > 0)))
+            return;
+
+        BYTE* pbHeader = &rgbData[0];
+        *pbHeader++ = kVersion;
+        *pbHeader++ = fCompacting ? 1 : 0;
+        pbHeader = WriteUInt32(pbHeader, gcIndex);
+        pbHeader = WriteUInt32(pbHeader, iCurEvent);
+        pbHeader = WriteUInt32(pbHeader, cRanges);
+        pbHeader = WriteUInt32(pbHeader, cDroppedRanges);
+        _ASSERTE(pbHeader == &rgbData[cbHeader]);
+
+        FireEtwGCDynamicEvent(W("SurvivalAndMovement"), cbData, &rgbData[0], GetClrInstanceId());
+
+        iCurEvent++;
+        Clear();
+    }
+
+private:
+    static const BYTE kVersion = 1;
+    static const UINT cbHeader = 2 + 4 * sizeof(UINT32);
+    // Three 64-bit values take at most 10 bytes each
+    static const UINT cbMaxRange = 3 * 10;
+    // Walks take the budget from the shared pool in chunks to keep the heaps from contending on it
+    static const LONG64 cbBudgetChunk = 4096;
+
+    void Clear()
+    {
+        LIMITED_METHOD_CONTRACT;
+        cRanges = 0;
+        cbData = cbHeader;
+        pbPrevEnd = NULL;
+        cbPrevRelocDistance = 0;
+    }
+
+    bool ReserveBudget(UINT cbRange)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (s_cbCompactMovementBudget == 0)
+            return true;
+
+        if (cbReserved < cbRange)
+        {
+            LONG64 cbLeft = InterlockedExchangeAdd64(&s_cbCompactMovementBudgetLeft, -cbBudgetChunk);
+            if (cbLeft <= 0)
+                return false;
+
+            cbReserved += min(cbLeft, cbBudgetChunk);
+            if (cbReserved < cbRange)
+                return false;
+        }
+
+        cbReserved -= cbRange;
+        return true;
+    }
+
+    static UINT64 ZigZag(INT64 value)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return ((UINT64)value << 1) ^ (UINT64)(value >> 63);
+    }
+
+    static UINT WriteVarUInt(BYTE* pb, UINT64 value)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        UINT cb = 0;
+        while (value >= 0x80)
+        {
+            pb[cb++] = (BYTE)(value | 0x80);
+            value >>= 7;
+        }
+        pb[cb++] = (BYTE)value;
+        return cb;
+    }
+
+    static BYTE* WriteUInt32(BYTE* pb, UINT32 value)
+    {
+        LIMITED_METHOD_CONTRACT;
+        memcpy(pb, &value, sizeof(value));
+        return pb + sizeof(value);
+    }
+
+    UINT32 gcIndex;
+    UINT32 iCurEvent;
+    UINT32 cRanges;
+    UINT32 cDroppedRanges;
+    LONG64 cbReserved;
+    BOOL fCompacting;
+
+    BYTE* pbPrevEnd;
+    ptrdiff_t cbPrevRelocDistance;
+
+    UINT cbData;
+    // Fix the size so the total event stays well below the 64K limit
+    BYTE rgbData[cbMaxEtwEvent - 0x100];
+};
+
+//---------------------------------------------------------------------------------------
+//
+// Called at the start of each GC to hand out a new budget to compact survival and
+// movement tracking
+//
+
+// static
+VOID ETW::GCLog::ResetMovementEventBudget()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!s_fCompactMovementConfigRead)
+    {
+        s_fCompactMovement = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_CompactSurvivalAndMovement) != 0;
+        s_cbCompactMovementBudget = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_CompactSurvivalAndMovementBudget);
+        s_fCompactMovementConfigRead = true;
+    }
+
+    if (s_fCompactMovement)
+    {
+        s_cbCompactMovementBudgetLeft = s_cbCompactMovementBudget;
+    }
+}
+
 // Contains above struct for ETW, plus extra info (opaque to us) used by the profiling
 // API to track its own information.
 struct MovedReferenceContextForEtwAndProfapi
@@ -183,7 +406,8 @@ struct MovedReferenceContextForEtwAndProfapi
 
     MovedReferenceContextForEtwAndProfapi() :
         pctxProfAPI(NULL),
-        pctxEtw(NULL)
+        pctxEtw(NULL),
+        pctxEtwCompact(NULL)
 
     {
         LIMITED_METHOD_CONTRACT;
@@ -191,6 +415,7 @@ struct MovedReferenceContextForEtwAndProfapi
 
     LPVOID pctxProfAPI;
     EtwGcMovementContext* pctxEtw;
+    EtwGcCompactMovementContext* pctxEtwCompact;
 };
 
 
@@ -255,6 +480,15 @@ void ETW::GCLog::MovedReference(
     if (!ShouldTrackMovementForEtw())
         return;
 
+    if (s_fCompactMovement)
+    {
+        EtwGcCompactMovementContext* pCompactContext =
+            EtwGcCompactMovementContext::GetOrCreateInGCContext(&pCtxForEtwAndProfapi->pctxEtwCompact);
+        if (pCompactContext != NULL)
+            pCompactContext->AddRange(pbMemBlockStart, pbMemBlockEnd, cbRelocDistance, fCompacting);
+        return;
+    }
+
     EtwGcMovementContext* pContext =
         EtwGcMovementContext::GetOrCreateInGCContext(&pCtxForEtwAndProfapi->pctxEtw);
     if (pContext == NULL)
@@ -377,6 +611,14 @@ VOID ETW::GCLog::EndMovedReferences(size_t profilingContext, BOOL fAllowProfApiN
     if (!ShouldTrackMovementForEtw())
         return;
 
+    EtwGcCompactMovementContext* pCompactContext = pCtxForEtwAndProfapi->pctxEtwCompact;
+    if (pCompactContext != NULL)
+    {
+        pCompactContext->Flush(true /* fEndOfWalk */);
+        pCtxForEtwAndProfapi->pctxEtwCompact = NULL;
+        delete pCompactContext;
+    }
+
     // If context isn't already set up for us, then we haven't been collecting any data
     // for ETW events.
     EtwGcMovementContext* pContext = pCtxForEtwAndProfapi->pctxEtw;
@@ -2888,7 +2888,7 @@ void StackTraceInfo::EnsureStackTraceArray(StackTraceArrayProtect *pStackTracePr
     size_t stackTraceCapacity = pStackTraceProtected->m_pStackTraceArray.Capacity();
     if (neededSize > stackTraceCapacity)
     {
-        S_SIZE_T newCapacity = S_SIZE_T(stackTraceCapacity) * S_SIZE_T(2);
+        S_SIZE_T newCapacity = (stackTraceCapacity == 0) ? S_SIZE_T(c_initialStackTraceCapacity) : S_SIZE_T(stackTraceCapacity) * S_SIZE_T(2);
         if (newCapacity.IsOverflow() || (neededSize > newCapacity.Value()))
         {
             newCapacity = S_SIZE_T(neededSize);
@@ -2906,7 +2906,7 @@ void StackTraceInfo::EnsureStackTraceArray(StackTraceArrayProtect *pStackTracePr
         {
             // Copy the original array to the new one
             pStackTraceProtected->m_pStackTraceArrayNew.CopyDataFrom(pStackTraceProtected->m_pStackTraceArray);
-            _ASSERTE(pStackTraceProtected->m_pStackTraceArrayNew.Size() == (neededSize - 1));
+            _ASSERTE(pStackTraceProtected->m_pStackTraceArrayNew.Size() == pStackTraceProtected->m_pStackTraceArray.Size());
         }
         // Update the stack trace array
         pStackTraceProtected->m_pStackTraceArray.Set(pStackTraceProtected->m_pStackTraceArrayNew.Get());
@@ -2993,9 +2993,9 @@ OBJECTREF StackTraceInfo::GetKeepAliveObject(MethodDesc* pMethod)
 }
 
 //
-// Append stack frame to an exception stack trace.
+// Fill in a stack trace element for a frame. Returns false if the frame should not be part of the stack trace.
 //
-void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf)
+bool StackTraceInfo::InitializeElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf, StackTraceElement* pStackTraceElem)
 {
     CONTRACTL
     {
@@ -3005,21 +3005,13 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
     }
     CONTRACTL_END
 
-    Thread *pThread = GetThread();
     MethodTable* pMT = ObjectFromHandle(hThrowable)->GetMethodTable();
     _ASSERTE(IsException(pMT));
 
-    PTR_ThreadExceptionState pCurTES = pThread->GetExceptionState();
-    // Check if the flag indicating foreign exception raise has been setup or not,
-    // and then reset it so that subsequent processing of managed frames proceeds
-    // normally.
-    BOOL fRaisingForeignException = pCurTES->IsRaisingForeignException();
-    pCurTES->ResetRaisingForeignException();
-
     LOG((LF_EH, LL_INFO10000, "StackTraceInfo::AppendElement IP = %p, SP = %p, %s::%s\n", currentIP, currentSP, pFunc ? pFunc->m_pszDebugClassName : "", pFunc ? pFunc->m_pszDebugMethodName : "" ));
 
     if (pFunc != NULL && pFunc->IsILStub())
-        return;
+        return false;
 
     // Do not save stacktrace to preallocated exception.  These are shared.
     if (CLRException::IsPreallocatedExceptionHandle(hThrowable))
@@ -3029,20 +3021,18 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
         // exception like a RudeThreadAbort, which will replace the exception
         // containing the restored stack trace.
 
-        return;
+        return false;
     }
 
-    StackTraceElement stackTraceElem;
-
-    stackTraceElem.pFunc = pFunc;
+    pStackTraceElem->pFunc = pFunc;
 
-    stackTraceElem.ip = currentIP;
-    stackTraceElem.sp = currentSP;
+    pStackTraceElem->ip = currentIP;
+    pStackTraceElem->sp = currentSP;
 
     // When we are building stack trace as we encounter managed frames during exception dispatch,
     // then none of those frames represent a stack trace from a foreign exception (as they represent
     // the current exception). Hence, set the corresponding flag to FALSE.
-    stackTraceElem.flags = 0;
+    pStackTraceElem->flags = 0;
 
     // This is a workaround to fix the generation of stack traces from exception objects so that
     // they point to the line that actually generated the exception instead of the line
@@ -3051,12 +3041,12 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
     {
         if (pCf->IsIPadjusted())
         {
-            stackTraceElem.flags |= STEF_IP_ADJUSTED;
+            pStackTraceElem->flags |= STEF_IP_ADJUSTED;
         }
-        else if (!pCf->HasFaulted() && stackTraceElem.ip != 0)
+        else if (!pCf->HasFaulted() && pStackTraceElem->ip != 0)
         {
-            stackTraceElem.ip -= STACKWALK_CONTROLPC_ADJUST_OFFSET;
-            stackTraceElem.flags |= STEF_IP_ADJUSTED;
+            pStackTraceElem->ip -= STACKWALK_CONTROLPC_ADJUST_OFFSET;
+            pStackTraceElem->flags |= STEF_IP_ADJUSTED;
         }
     }
 
@@ -3064,6 +3054,26 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
     SetupWatsonBucket(currentIP, pCf);
 #endif // !TARGET_UNIX
 
+    return true;
+}
+
+//
+// Append stack trace elements to the stack trace stored in an exception object.
+//
+void StackTraceInfo::AppendElementsToThrowable(OBJECTHANDLE hThrowable, StackTraceElement const * pStackTraceElems, size_t count, BOOL fRaisingForeignException)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    _ASSERTE(count > 0);
+
+    Thread *pThread = GetThread();
+
     EX_TRY
     {
         struct
@@ -3082,7 +3092,7 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
         // The stack trace returned by the GetStackTrace has to be created by the current thread or be NULL.
         _ASSERTE((gc.stackTrace.m_pStackTraceArray.Get() == NULL) || (gc.stackTrace.m_pStackTraceArray.GetObjectThread() == pThread));
 
-        EnsureStackTraceArray(&gc.stackTrace, gc.stackTrace.m_pStackTraceArray.Size() + 1);
+        EnsureStackTraceArray(&gc.stackTrace, gc.stackTrace.m_pStackTraceArray.Size() + count);
 
         if (fRaisingForeignException)
         {
@@ -3102,23 +3112,34 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
         uint32_t keepAliveItemsCount = gc.stackTrace.m_pStackTraceArray.GetKeepAliveItemsCount();
         _ASSERTE(keepAliveItemsCount == gc.stackTrace.m_pStackTraceArray.ComputeKeepAliveItemsCount());
 
-        gc.keepAliveObject = GetKeepAliveObject(pFunc);
-        if (gc.keepAliveObject != NULL)
+        for (size_t i = 0; i < count; i++)
         {
-            // The new frame to be added is a method that can be collected, so we need to update the keepAlive items count.
-            keepAliveItemsCount++;
-            stackTraceElem.flags |= STEF_KEEPALIVE;
-        }
+            StackTraceElement stackTraceElem = pStackTraceElems[i];
 
-        if (keepAliveItemsCount != 0)
-        {
-            // One extra slot is added for the stack trace array
-            EnsureKeepAliveArray(&gc.pKeepAliveArray, keepAliveItemsCount + 1);
+            gc.keepAliveObject = GetKeepAliveObject(stackTraceElem.pFunc);
             if (gc.keepAliveObject != NULL)
             {
+                // The new frame to be added is a method that can be collected, so we need to update the keepAlive items count.
+                keepAliveItemsCount++;
+                stackTraceElem.flags |= STEF_KEEPALIVE;
+
+                // One extra slot is added for the stack trace array
+                EnsureKeepAliveArray(&gc.pKeepAliveArray, keepAliveItemsCount + 1);
+
                 // Add the method to the keepAlive array
                 gc.pKeepAliveArray->SetAt(keepAliveItemsCount, gc.keepAliveObject);
             }
+
+            gc.stackTrace.m_pStackTraceArray.SetKeepAliveItemsCount(keepAliveItemsCount);
+            gc.stackTrace.m_pStackTraceArray.Append(&stackTraceElem);
+        }
+
+        _ASSERTE(gc.stackTrace.m_pStackTraceArray.ComputeKeepAliveItemsCount() == keepAliveItemsCount);
+
+        if (keepAliveItemsCount != 0)
+        {
+            // One extra slot is added for the stack trace array
+            EnsureKeepAliveArray(&gc.pKeepAliveArray, keepAliveItemsCount + 1);
         }
         else
         {
@@ -3126,11 +3147,6 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
             gc.pKeepAliveArray = NULL;
         }
 
-        gc.stackTrace.m_pStackTraceArray.SetKeepAliveItemsCount(keepAliveItemsCount);
-
-        gc.stackTrace.m_pStackTraceArray.Append(&stackTraceElem);
-       _ASSERTE(gc.stackTrace.m_pStackTraceArray.ComputeKeepAliveItemsCount() == keepAliveItemsCount);
-
         if (gc.pKeepAliveArray != NULL)
         {
             _ASSERTE(keepAliveItemsCount > 0);
@@ -3154,6 +3170,105 @@ void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP,
     EX_END_CATCH
 }
 
+//
+// Append stack frame to an exception stack trace.
+//
+void StackTraceInfo::AppendElement(OBJECTHANDLE hThrowable, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    PTR_ThreadExceptionState pCurTES = GetThread()->GetExceptionState();
+    // Check if the flag indicating foreign exception raise has been setup or not,
+    // and then reset it so that subsequent processing of managed frames proceeds
+    // normally.
+    BOOL fRaisingForeignException = pCurTES->IsRaisingForeignException();
+    pCurTES->ResetRaisingForeignException();
+
+    StackTraceElement stackTraceElem;
+    if (InitializeElement(hThrowable, currentIP, currentSP, pFunc, pCf, &stackTraceElem))
+    {
+        AppendElementsToThrowable(hThrowable, &stackTraceElem, 1, fRaisingForeignException);
+    }
+}
+
+#ifdef FEATURE_EH_FUNCLETS
+//
+// Append stack frame to the stack trace of the exception being dispatched by the ExInfo. The frames are
+// collected in the ExInfo and stored to the exception object in batches, see FlushPendingElements.
+//
+void StackTraceInfo::AppendElement(ExInfo* pExInfo, UINT_PTR currentIP, UINT_PTR currentSP, MethodDesc* pFunc, CrawlFrame* pCf)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    // The debugger inspects the stack trace of the exception at every frame, so it has to be up to date
+    if (CORDebuggerAttached())
+    {
+        FlushPendingElements(pExInfo);
+        AppendElement(pExInfo->m_hThrowable, currentIP, currentSP, pFunc, pCf);
+        return;
+    }
+
+    PTR_ThreadExceptionState pCurTES = GetThread()->GetExceptionState();
+    if (pCurTES->IsRaisingForeignException())
+    {
+        // The foreign stack trace is marked when the elements collected after this point are stored
+        FlushPendingElements(pExInfo);
+        pExInfo->m_fPendingStackTraceFromForeignException = TRUE;
+        pCurTES->ResetRaisingForeignException();
+    }
+
+    StackTraceElement stackTraceElem;
+    if (!InitializeElement(pExInfo->m_hThrowable, currentIP, currentSP, pFunc, pCf, &stackTraceElem))
+    {
+        return;
+    }
+
+    if (pExInfo->m_pendingStackTraceCount == ARRAY_SIZE(pExInfo->m_pendingStackTrace))
+    {
+        FlushPendingElements(pExInfo);
+    }
+
+    pExInfo->m_pendingStackTrace[pExInfo->m_pendingStackTraceCount++] = stackTraceElem;
+}
+
+//
+// Store the stack trace elements collected in the ExInfo to the exception object. This needs to happen
+// before any code that can observe the stack trace of the exception runs.
+//
+void StackTraceInfo::FlushPendingElements(ExInfo* pExInfo)
+{
+    CONTRACTL
+    {
+        GC_TRIGGERS;
+        NOTHROW;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    if (pExInfo->m_pendingStackTraceCount == 0)
+    {
+        return;
+    }
+
+    AppendElementsToThrowable(pExInfo->m_hThrowable, pExInfo->m_pendingStackTrace, pExInfo->m_pendingStackTraceCount, pExInfo->m_fPendingStackTraceFromForeignException);
+
+    pExInfo->m_pendingStackTraceCount = 0;
+    pExInfo->m_fPendingStackTraceFromForeignException = FALSE;
+}
+#endif // FEATURE_EH_FUNCLETS
+
 void UnwindFrameChain(Thread* pThread, LPVOID pvLimitSP)
 {
     CONTRACTL
@@ -10455,6 +10570,11 @@ void ExceptionNotifications::DeliverFirstChanceNotification()
         GCX_COOP();
         if (ExceptionNotifications::CanDeliverNotificationToCurrentAppDomain(FirstChanceExceptionHandler))
         {
+#ifdef FEATURE_EH_FUNCLETS
+            // The handlers can observe the stack trace
+            StackTraceInfo::FlushPendingElements(pCurTES->GetCurrentExceptionTracker());
+#endif // FEATURE_EH_FUNCLETS
+
             OBJECTREF oThrowable = NULL;
             GCPROTECT_BEGIN(oThrowable);
 
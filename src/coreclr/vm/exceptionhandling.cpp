@@ -3033,7 +3033,7 @@ extern "C" void QCALLTYPE AppendExceptionStackFrame(QCall::ObjectHandleOnStack e
             _ASSERTE(pMD == codeInfo.GetMethodDesc());
 #endif // _DEBUG
 
-            StackTraceInfo::AppendElement(pExInfo->m_hThrowable, ip, sp, pMD, &pExInfo->m_frameIter.m_crawl);
+            StackTraceInfo::AppendElement(pExInfo, ip, sp, pMD, &pExInfo->m_frameIter.m_crawl);
         }
     }
 
@@ -3145,6 +3145,8 @@ extern "C" void * QCALLTYPE CallCatchFunclet(QCall::ObjectHandleOnStack exceptio
     Frame* pFrame = pThread->GetFrame();
     MarkInlinedCallFrameAsFuncletCall(pFrame);
     exInfo->m_ScannedStackRange.ExtendUpperBound(exInfo->m_frameIter.m_crawl.GetRegisterSet()->SP);
+    // This is normally a no-op, the pending stack trace elements are stored when the second pass starts
+    StackTraceInfo::FlushPendingElements(exInfo);
     DWORD_PTR dwResumePC = 0;
     UINT_PTR callerTargetSp = 0;
 #if defined(HOST_AMD64) && defined(HOST_WINDOWS)
@@ -3418,6 +3420,10 @@ extern "C" CLR_BOOL QCALLTYPE CallFilterFunclet(QCall::ObjectHandleOnStack excep
     MarkInlinedCallFrameAsEHHelperCall(pFrame);
 
     ExInfo* pExInfo = (ExInfo*)pThread->GetExceptionState()->GetCurrentExceptionTracker();
+
+    // The filter can observe the stack trace
+    StackTraceInfo::FlushPendingElements(pExInfo);
+
     OBJECTREF throwable = exceptionObj.Get();
     throwable = PossiblyUnwrapThrowable(throwable, pExInfo->m_frameIter.m_crawl.GetAssembly());
 
@@ -3771,6 +3777,13 @@ extern "C" CLR_BOOL QCALLTYPE SfiInit(StackFrameIterator* pThis, CONTEXT* pStack
 
     pFrame = pExInfo->m_pInitialFrame;
 
+    if (pExInfo->m_passNumber == 2)
+    {
+        // Handlers run in the second pass and can observe the stack trace, so it has to be complete
+        GCX_COOP();
+        StackTraceInfo::FlushPendingElements(pExInfo);
+    }
+
     NotifyExceptionPassStarted(pThis, pThread, pExInfo);
 
     REGDISPLAY* pRD = &pExInfo->m_regDisplay;
@@ -3800,7 +3813,7 @@ extern "C" CLR_BOOL QCALLTYPE SfiInit(StackFrameIterator* pThis, CONTEXT* pStack
                 if (pMD != NULL)
                 {
                     GCX_COOP();
-                    StackTraceInfo::AppendElement(pExInfo->m_hThrowable, 0, GetRegdisplaySP(pExInfo->m_frameIter.m_crawl.GetRegisterSet()), pMD, &pExInfo->m_frameIter.m_crawl);
+                    StackTraceInfo::AppendElement(pExInfo, 0, GetRegdisplaySP(pExInfo->m_frameIter.m_crawl.GetRegisterSet()), pMD, &pExInfo->m_frameIter.m_crawl);
 
 #if defined(DEBUGGING_SUPPORTED)
                     if (NotifyDebuggerOfStub(pThread, pFrame))
@@ -3874,6 +3887,10 @@ extern "C" CLR_BOOL QCALLTYPE SfiInit(StackFrameIterator* pThis, CONTEXT* pStack
     else
     {
         EH_LOG((LL_INFO100, "SfiInit: No more managed frames found on stack\n"));
+        {
+            GCX_COOP();
+            StackTraceInfo::FlushPendingElements(pExInfo);
+        }
         // There are no managed frames on the stack, fail fast and report unhandled exception
         LONG disposition = InternalUnhandledExceptionFilter_Worker((EXCEPTION_POINTERS *)&pExInfo->m_ptrs);
 #ifdef HOST_WINDOWS
@@ -4009,6 +4026,12 @@ extern "C" CLR_BOOL QCALLTYPE SfiNext(StackFrameIterator* pThis, uint* uExCollid
 
         if (isPropagatingToNativeCode)
         {
+            // The exception is either unhandled or leaves managed code, the stack trace has to be complete in both cases
+            {
+                GCX_COOP();
+                StackTraceInfo::FlushPendingElements(pTopExInfo);
+            }
+
             pFrame = pThis->m_crawl.GetFrame();
 
             // Check if there are any further managed frames on the stack or a catch for all exceptions in native code (marked by
@@ -4118,7 +4141,7 @@ extern "C" CLR_BOOL QCALLTYPE SfiNext(StackFrameIterator* pThis, uint* uExCollid
                     if (pMD != NULL)
                     {
                         GCX_COOP();
-                        StackTraceInfo::AppendElement(pTopExInfo->m_hThrowable, 0, GetRegdisplaySP(pTopExInfo->m_frameIter.m_crawl.GetRegisterSet()), pMD, &pTopExInfo->m_frameIter.m_crawl);
+                        StackTraceInfo::AppendElement(pTopExInfo, 0, GetRegdisplaySP(pTopExInfo->m_frameIter.m_crawl.GetRegisterSet()), pMD, &pTopExInfo->m_frameIter.m_crawl);
 
 #if defined(DEBUGGING_SUPPORTED)
                         if (NotifyDebuggerOfStub(pThread, pFrame))
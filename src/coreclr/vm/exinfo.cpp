@@ -330,6 +330,8 @@ ExInfo::ExInfo(Thread *pThread, EXCEPTION_RECORD *pExceptionRecord, CONTEXT *pEx
     , m_pLongJmpBuf(NULL),
     m_longJmpReturnValue(0)
 #endif // HOST_WINDOWS
+    , m_pendingStackTraceCount(0),
+    m_fPendingStackTraceFromForeignException(FALSE)
 {
     pThread->GetExceptionState()->m_pCurrentTracker = this;
     m_pInitialFrame = pThread->GetFrame();
@@ -344,6 +344,14 @@ struct ExInfo
     int            m_longJmpReturnValue;
 #endif
 
+    // Stack trace elements collected during the first pass that were not stored to the exception
+    // object yet. Storing them in batches avoids growing the stack trace array frame by frame.
+    // See StackTraceInfo::FlushPendingElements for where they are stored.
+    StackTraceElement m_pendingStackTrace[16];
+    uint32_t       m_pendingStackTraceCount;
+    // Set when the pending elements continue the stack trace of a foreign (rethrown via EDI) exception
+    BOOL           m_fPendingStackTraceFromForeignException;
+
 #if defined(TARGET_UNIX)
     void TakeExceptionPointersOwnership(PAL_SEHException* ex);
 #endif // TARGET_UNIX
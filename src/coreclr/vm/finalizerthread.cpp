@@ -32,11 +32,20 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+FinalizerThread::FinalizerWorker * FinalizerThread::FinalizerWorkers = NULL;
+DWORD FinalizerThread::cFinalizerWorkers = 0;
+CLREvent * FinalizerThread::hEventFinalizerWorkersDone = NULL;
+LONG FinalizerThread::cPendingFinalizerWorkers = 0;
+
+UINT64 FinalizerThread::cFinalizedObjects = 0;
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    // Finalizer worker threads count as the finalizer thread, a finalizer waiting for the
+    // pass it is running in to complete would never return
+    return GetThreadNULLOk() == g_pFinalizerThread || IsFinalizerThread();
 }
 
 void FinalizerThread::EnableFinalization()
@@ -107,6 +116,15 @@ Again:
     return obj;
 }
 
+UINT64 FinalizerThread::GetFinalizationQueueLength()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // This is read without taking the finalization lock, so it is only approximate while finalizers
+    // are running
+    return GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+}
+
 void FinalizerThread::FinalizeAllObjects()
 {
     STATIC_CONTRACT_THROWS;
@@ -121,9 +139,146 @@ void FinalizerThread::FinalizeAllObjects()
     uint32_t count;
     CALL_MANAGED_METHOD(count, uint32_t, args);
 
+    InterlockedExchangeAdd64((LONG64 *)&cFinalizedObjects, count);
+
     FireEtwGCFinalizersEnd_V1(count, GetClrInstanceId());
 }
 
+void FinalizerThread::CreateFinalizerWorkers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsCurrentThreadFinalizer());
+    _ASSERTE(FinalizerWorkers == NULL);
+
+    DWORD threadCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_FinalizerThreadCount);
+    if (threadCount > MaxFinalizerThreadCount)
+    {
+        threadCount = MaxFinalizerThreadCount;
+    }
+    if (threadCount > (DWORD)GetCurrentProcessCpuCount())
+    {
+        threadCount = (DWORD)GetCurrentProcessCpuCount();
+    }
+    if (threadCount <= 1)
+    {
+        return;
+    }
+
+    DWORD workerCount = threadCount - 1;
+
+    // Workers that could not be created are simply not used, the finalizer thread still drains the
+    // queue on its own
+    EX_TRY
+    {
+        hEventFinalizerWorkersDone = new CLREvent();
+        hEventFinalizerWorkersDone->CreateAutoEvent(FALSE);
+
+        FinalizerWorkers = new FinalizerWorker[workerCount];
+        for (DWORD i = 0; i < workerCount; i++)
+        {
+            FinalizerWorkers[i].pThread = NULL;
+            FinalizerWorkers[i].hEventStart.CreateAutoEvent(FALSE);
+            FinalizerWorkers[i].fInPass = false;
+        }
+
+        for (DWORD i = 0; i < workerCount; i++)
+        {
+            Thread *newThread = SetupUnstartedThread();
+            _ASSERTE(newThread != NULL);
+#ifdef FEATURE_COMINTEROP
+            newThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+#endif
+            newThread->SetBackground(true);
+            FinalizerWorkers[i].pThread = newThread;
+
+            if (!newThread->CreateNewThread(0, &FinalizerWorkerThreadStart, (void *)(size_t)i, W(".NET Finalizer Worker")))
+            {
+                FinalizerWorkers[i].pThread = NULL;
+                newThread->DecExternalCount(false);
+                ThrowOutOfMemory();
+            }
+
+            newThread->StartThread();
+            cFinalizerWorkers++;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions)
+
+    LOG((LF_GC, LL_INFO10, "Finalizer thread started %u finalizer worker threads\n", cFinalizerWorkers));
+}
+
+void FinalizerThread::StartFinalizerWorkers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (cFinalizerWorkers == 0)
+    {
+        return;
+    }
+
+    // The previous pass may have been interrupted by an exception on the finalizer thread
+    WaitForFinalizerWorkers();
+
+    cPendingFinalizerWorkers = (LONG)cFinalizerWorkers;
+    for (DWORD i = 0; i < cFinalizerWorkers; i++)
+    {
+        FinalizerWorkers[i].hEventStart.Set();
+    }
+}
+
+void FinalizerThread::WaitForFinalizerWorkers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (cFinalizerWorkers == 0)
+    {
+        return;
+    }
+
+    // The finalizer thread ran out of objects, the workers are finishing the finalizers they have
+    // already taken
+    GCX_PREEMP();
+    while (VolatileLoad(&cPendingFinalizerWorkers) != 0)
+    {
+        hEventFinalizerWorkersDone->Wait(INFINITE, FALSE);
+    }
+}
+
+void FinalizerThread::FinalizerWorkerDone(DWORD index)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(FinalizerWorkers[index].fInPass);
+    FinalizerWorkers[index].fInPass = false;
+
+    if (InterlockedDecrement(&cPendingFinalizerWorkers) == 0)
+    {
+        hEventFinalizerWorkersDone->Set();
+    }
+}
+
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 {
     // We don't want kLowMemoryNotification to starve out kFinalizer
@@ -313,6 +468,8 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             s_InitializedFinalizerThreadForPlatform = TRUE;
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
+
+            CreateFinalizerWorkers();
         }
 
         JitHost::Reclaim();
@@ -350,7 +507,9 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
 
         int observedFullGcCount =
             GCHeapUtilities::GetGCHeap()->CollectionCount(GCHeapUtilities::GetGCHeap()->GetMaxGeneration());
+        StartFinalizerWorkers();
         FinalizeAllObjects();
+        WaitForFinalizerWorkers();
 
         // Anyone waiting to drain the Q can now wake up.  Note that there is a
         // race in that another thread starting a drain, as we leave a drain, may
@@ -439,6 +598,79 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
     return 0;
 }
 
+VOID FinalizerThread::FinalizerWorkerThreadWorker(void *args)
+{
+    DWORD index = (DWORD)(size_t)args;
+    FinalizerWorker *pWorker = &FinalizerWorkers[index];
+    Thread *pThread = GetThread();
+
+    // A previous pass was interrupted by an exception
+    if (pWorker->fInPass)
+    {
+        FinalizerWorkerDone(index);
+    }
+
+    while (!fQuitFinalizer)
+    {
+        _ASSERTE(pThread->PreemptiveGCDisabled());
+        pThread->EnablePreemptiveGC();
+        pWorker->hEventStart.Wait(INFINITE, FALSE);
+        pThread->DisablePreemptiveGC();
+
+        pWorker->fInPass = true;
+
+        // Finalizers run in no particular order relative to the ones run by the finalizer thread and
+        // the other workers, and critical finalizers may start while other finalizers are still
+        // running. GetNextFinalizableObject() returns NULL once shutdown has started.
+        FinalizeAllObjects();
+
+        FinalizerWorkerDone(index);
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerWorkerThreadStart(void *args)
+{
+    ClrFlsSetThreadType (ThreadType_Finalizer);
+
+    DWORD index = (DWORD)(size_t)args;
+    _ASSERTE(index < MaxFinalizerThreadCount);
+    Thread *pThread = FinalizerWorkers[index].pThread;
+
+    if (!pThread->HasStarted())
+    {
+        // The worker is already counted in cFinalizerWorkers, keep completing passes right away so
+        // that the finalizer thread does not wait for it
+        while (1)
+        {
+            FinalizerWorkers[index].hEventStart.Wait(INFINITE, FALSE);
+            FinalizerWorkers[index].fInPass = true;
+            FinalizerWorkerDone(index);
+        }
+    }
+
+    _ASSERTE(GetThread() == pThread);
+
+    INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    {
+        pThread->SetThreadPriority(THREAD_PRIORITY_HIGHEST);
+
+        while (!fQuitFinalizer)
+        {
+            ManagedThreadBase::KickOff(FinalizerWorkerThreadWorker, args);
+        }
+    }
+    UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+    // Like the finalizer thread, workers are not torn down at shutdown
+    pThread->EnablePreemptiveGC();
+    while (1)
+    {
+        __SwitchToThread(INFINITE, CALLER_LIMITS_SPINNING);
+    }
+
+    return 0;
+}
+
 void FinalizerThread::FinalizerThreadCreate()
 {
     CONTRACTL{
@@ -34,6 +34,35 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // Additional threads that drain the finalization queue along with the finalizer thread, see
+    // code:CLRConfig::EXTERNAL_FinalizerThreadCount. The finalizer thread starts them at the beginning
+    // of each pass and waits for them before it reports the pass as done.
+    struct FinalizerWorker
+    {
+        Thread *pThread;
+        CLREvent hEventStart;
+        // Set while the worker takes part in a pass, so that a worker coming back from an
+        // exception can still report its part of the pass as done
+        bool fInPass;
+    };
+
+    static const DWORD MaxFinalizerThreadCount = 64;
+
+    static FinalizerWorker *FinalizerWorkers;
+    static DWORD cFinalizerWorkers;
+    static CLREvent *hEventFinalizerWorkersDone;
+    static LONG cPendingFinalizerWorkers;
+
+    static UINT64 cFinalizedObjects;
+
+    static void CreateFinalizerWorkers();
+    static void StartFinalizerWorkers();
+    static void WaitForFinalizerWorkers();
+    static void FinalizerWorkerDone(DWORD index);
+
+    static VOID FinalizerWorkerThreadWorker(void *args);
+    static DWORD WINAPI FinalizerWorkerThreadStart(void *args);
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -50,6 +79,16 @@ public:
 
     static OBJECTREF GetNextFinalizableObject();
 
+    // Number of objects whose finalizers are waiting to run, for the runtime counters
+    static UINT64 GetFinalizationQueueLength();
+
+    // Number of finalizers that have run since the start of the process, for the runtime counters
+    static UINT64 GetFinalizedObjectCount()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoadWithoutBarrier(&cFinalizedObjects);
+    }
+
     static void RaiseShutdownEvents()
     {
         WRAPPER_NO_CONTRACT;
@@ -2127,6 +2127,16 @@ struct ReversePInvokeFrame
 // This frame is pushed by any JIT'ted method that contains one or more
 // inlined N/Direct calls. Note that the JIT'ted method keeps it pushed
 // the whole time to amortize the pushing cost across the entire method.
+//
+// What remains per call is recording the return address and SP in the
+// frame, the store that flips the thread to preemptive mode and, on
+// return, the flip back plus a check of g_TrapReturningThreads. The mode
+// cannot stay preemptive across a sequence of calls: any managed code
+// that runs between them may touch object references, and the GC only
+// leaves threads alone while they are preemptive because they promise
+// not to. Callers that need fewer transitions should move the loop into
+// native code (one P/Invoke per batch), or use SuppressGCTransition for
+// calls that are short and never block.
 //------------------------------------------------------------------------
 
 typedef DPTR(class InlinedCallFrame) PTR_InlinedCallFrame;
@@ -72,6 +72,23 @@ VOID GCToEEInterface::SyncBlockCacheWeakPtrScan(HANDLESCANPROC scanProc, uintptr
     SyncBlockCache::GetSyncBlockCache()->GCWeakPtrScan(scanProc, lp1, lp2);
 }
 
+// Stack scan claiming for server GC. Each GC thread first scans the threads whose
+// allocation context belongs to its heap and then steals any thread that no other
+// GC thread has claimed yet, so a heap with a few deep stacks no longer holds up
+// the rest of the mark phase. Threads are claimed with a key that is unique to each
+// root scanning pass: the epoch is advanced by BeforeGcScanRoots, which the GC calls
+// from a single thread before every blocking mark and BGC final mark, and the low
+// bits tell apart the passes that share an epoch (mark, relocate, and the initial
+// concurrent mark of a BGC, which runs before its own BeforeGcScanRoots call).
+static LONG s_stackScanEpoch = 0;
+static int s_stackScanStealing = -1;
+
+static LONG GetStackScanClaimKey(ScanContext* sc)
+{
+    LIMITED_METHOD_CONTRACT;
+    return (VolatileLoad(&s_stackScanEpoch) << 2) | (sc->promotion ? 1 : 0) | (sc->concurrent ? 2 : 0);
+}
+
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
 {
     CONTRACTL
@@ -81,6 +98,16 @@ void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_conc
     }
     CONTRACTL_END;
 
+    if (s_stackScanStealing == -1)
+    {
+        s_stackScanStealing = GCHeapUtilities::IsServerHeap()
+            && (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCStackScanStealing) != 0);
+    }
+
+    // Keep the epoch within 30 bits so the shifted key stays positive; any stale key left
+    // on a thread is at most a couple of passes old, so wrapping around is harmless.
+    VolatileStore(&s_stackScanEpoch, (LONG)((s_stackScanEpoch + 1) & 0x3FFFFFFF));
+
 #ifdef VERIFY_HEAP
     if (is_bgc)
     {
@@ -201,6 +228,12 @@ static void ScanStackRoots(Thread * pThread, promote_func* fn, ScanContext* sc)
 #if defined(FEATURE_EH_FUNCLETS)
         flagsStackWalk |= GC_FUNCLET_REFERENCE_REPORTING;
 #endif // defined(FEATURE_EH_FUNCLETS)
+        if (!sc->promotion)
+        {
+            // The relocation phase walks the same frames as the mark phase of this GC, and the threads have been
+            // suspended in between. GS cookies have been validated by the mark phase walk already.
+            flagsStackWalk |= SKIP_GSCOOKIE_CHECK;
+        }
         gcctx.pScannedSlots = NULL;
         pThread->StackWalkFrames( GcStackCrawlCallBack, &gcctx, flagsStackWalk);
         delete gcctx.pScannedSlots;
@@ -286,33 +319,61 @@ static void ScanTailCallArgBufferRoots(Thread* pThread, promote_func* fn, ScanCo
     }
 }
 
+static void ScanThreadRoots(Thread* pThread, promote_func* fn, ScanContext* sc)
+{
+    STRESS_LOG2(LF_GC | LF_GCROOTS, LL_INFO100, "{ Starting scan of Thread %p ID = %x\n", pThread, pThread->GetThreadId());
+
+    sc->thread_under_crawl = pThread;
+#ifdef FEATURE_EVENT_TRACE
+    sc->dwEtwRootKind = kEtwGCRootKindStack;
+#endif // FEATURE_EVENT_TRACE
+    ScanStackRoots(pThread, fn, sc);
+    ScanTailCallArgBufferRoots(pThread, fn, sc);
+    ScanThreadStaticRoots(pThread, fn, sc);
+#ifdef FEATURE_EVENT_TRACE
+    sc->dwEtwRootKind = kEtwGCRootKindOther;
+#endif // FEATURE_EVENT_TRACE
+
+    STRESS_LOG2(LF_GC | LF_GCROOTS, LL_INFO100, "Ending scan of Thread %p ID = 0x%x }\n", pThread, pThread->GetThreadId());
+}
+
 void GCToEEInterface::GcScanRoots(promote_func* fn, int condemned, int max_gen, ScanContext* sc)
 {
     STRESS_LOG1(LF_GCROOTS, LL_INFO10, "GCScan: Promotion Phase = %d\n", sc->promotion);
 
+    bool stealing = (s_stackScanStealing == 1);
+    LONG claimKey = stealing ? GetStackScanClaimKey(sc) : 0;
+
+    // Scan the threads allocating on this GC thread's heap first; their objects are
+    // the most likely to be local to this heap.
     Thread* pThread = NULL;
     while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
     {
         gc_alloc_context* palloc_context = pThread->GetAllocContext();
         if (palloc_context != nullptr
             && GCHeapUtilities::GetGCHeap()->IsThreadUsingAllocationContextHeap(
-                palloc_context, sc->thread_number))
+                palloc_context, sc->thread_number)
+            && (!stealing || pThread->TryClaimForStackScan(claimKey)))
         {
-            STRESS_LOG2(LF_GC | LF_GCROOTS, LL_INFO100, "{ Starting scan of Thread %p ID = %x\n", pThread, pThread->GetThreadId());
-
-            sc->thread_under_crawl = pThread;
-#ifdef FEATURE_EVENT_TRACE
-            sc->dwEtwRootKind = kEtwGCRootKindStack;
-#endif // FEATURE_EVENT_TRACE
-            ScanStackRoots(pThread, fn, sc);
-            ScanTailCallArgBufferRoots(pThread, fn, sc);
-            ScanThreadStaticRoots(pThread, fn, sc);
-#ifdef FEATURE_EVENT_TRACE
-            sc->dwEtwRootKind = kEtwGCRootKindOther;
-#endif // FEATURE_EVENT_TRACE
+            ScanThreadRoots(pThread, fn, sc);
+        }
+    }
 
-            STRESS_LOG2(LF_GC | LF_GCROOTS, LL_INFO100, "Ending scan of Thread %p ID = 0x%x }\n", pThread, pThread->GetThreadId());
+    // Then help the other GC threads with whatever they have not claimed yet.
+    if (stealing)
+    {
+        int stolen = 0;
+        pThread = NULL;
+        while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
+        {
+            if (pThread->GetAllocContext() != nullptr && pThread->TryClaimForStackScan(claimKey))
+            {
+                ScanThreadRoots(pThread, fn, sc);
+                stolen++;
+            }
         }
+
+        STRESS_LOG2(LF_GCROOTS, LL_INFO100, "GCScan: heap %d stole %d thread(s)\n", sc->thread_number, stolen);
     }
 
     // In server GC, we should be competing for marking the statics
@@ -837,6 +898,8 @@ static fq_walk_fn g_FQWalkFn = &WalkFReachableObjects;
 
 void GCToEEInterface::DiagGCStart(int gen, bool isInduced)
 {
+    ETW::GCLog::ResetMovementEventBudget();
+
 #ifdef GC_PROFILING
     DiagUpdateGenerationBounds();
     GarbageCollectionStartedCallback(gen, isInduced);
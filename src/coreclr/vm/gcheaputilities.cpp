@@ -45,6 +45,8 @@ GVAL_IMPL_INIT(ee_alloc_context, g_global_alloc_context, {});
 
 thread_local ee_alloc_context::PerThreadRandom ee_alloc_context::t_random = PerThreadRandom();
 
+bool ee_alloc_context::s_pretenuringEnabled = false;
+
 enum GC_LOAD_STATUS {
     GC_LOAD_STATUS_BEFORE_START,
     GC_LOAD_STATUS_START,
@@ -379,6 +381,8 @@ HRESULT GCHeapUtilities::LoadAndInitialize()
     s_useThreadAllocationContexts = true;
 #endif
 
+    ee_alloc_context::s_pretenuringEnabled = Configuration::GetKnobBooleanValue(W("System.GC.PretenureSampledTypes"), CLRConfig::EXTERNAL_GCPretenureSampledTypes);
+
     // we should only call this once on startup. Attempting to load a GC
     // twice is an error.
     assert(g_pGCHeap == nullptr);
@@ -414,4 +418,23 @@ void GCHeapUtilities::RecordEventStateChange(bool isPublicProvider, GCEventKeywo
     StashKeywordAndLevel(isPublicProvider, keywords, level);
 }
 
+size_t GCHeapUtilities::GetHeapShape(gc_region_shape* regions, size_t count)
+{
+    CONTRACTL {
+      MODE_ANY;
+      NOTHROW;
+      GC_NOTRIGGER;
+      CAN_TAKE_LOCK;
+    } CONTRACTL_END;
+
+    // A standalone GC built before GetHeapShape was added to the interface doesn't have it.
+    if ((g_gc_version_info.MajorVersion == GC_INTERFACE_MAJOR_VERSION) &&
+        (g_gc_version_info.MinorVersion < 7))
+    {
+        return 0;
+    }
+
+    return GetGCHeap()->GetHeapShape(regions, count);
+}
+
 #endif // DACCESS_COMPILE
@@ -79,7 +79,11 @@ struct ee_alloc_context
         m_CombinedLimit = m_GCAllocContext.alloc_limit;
     }
 
-    static inline bool IsRandomizedSamplingEnabled()
+    // Set on startup when sampled allocations also drive pretenuring (see code:RecordPretenuringSample).
+    // Sampling then stays on whether or not anyone listens to the AllocationSampled event.
+    static bool s_pretenuringEnabled;
+
+    static inline bool IsAllocationSampledEventEnabled()
     {
 #ifdef FEATURE_EVENT_TRACE
         return ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context,
@@ -90,6 +94,11 @@ struct ee_alloc_context
 #endif // FEATURE_EVENT_TRACE
     }
 
+    static inline bool IsRandomizedSamplingEnabled()
+    {
+        return s_pretenuringEnabled || IsAllocationSampledEventEnabled();
+    }
+
     inline void UpdateCombinedLimit(bool samplingEnabled)
     {
         if (!samplingEnabled)
@@ -333,6 +342,10 @@ public:
     // Records a change in eventing state. This ultimately will inform the GC that it needs to be aware
     // of new events being enabled.
     static void RecordEventStateChange(bool isPublicProvider, GCEventKeyword keywords, GCEventLevel level);
+
+    // Takes a snapshot of the metadata of up to count regions of the GC heap without suspending the EE, see
+    // IGCHeap::GetHeapShape. Returns the total number of regions, or 0 if the GC doesn't support it.
+    static size_t GetHeapShape(gc_region_shape* regions, size_t count);
 #endif // DACCESS_COMPILE
 
 private:
@@ -361,6 +361,10 @@ void FireAllocationSampled(GC_ALLOC_FLAGS flags, size_t size, size_t samplingBud
 #endif //FEATURE_EVENT_TRACE
 }
 
+// The last sampled object allocated by this thread, picked up by code:AllocateObject once its MethodTable
+// is set so that it can be tracked for pretenuring.
+static thread_local Object* t_pretenureSampledObject = nullptr;
+
 inline Object* Alloc(ee_alloc_context* pEEAllocContext, size_t size, GC_ALLOC_FLAGS flags)
 {
     CONTRACTL {
@@ -424,7 +428,15 @@ inline Object* Alloc(ee_alloc_context* pEEAllocContext, size_t size, GC_ALLOC_FL
         // just emitting an ETW/EventPipe event. If we want this event to be more useful from ICorProfiler
         // in the future we probably want to pass the isSampled flag back to callers so that the event
         // can be raised after the MethodTable is initialized.
-        FireAllocationSampled(flags, aligned_size, samplingBudget, retVal);
+        if (ee_alloc_context::IsAllocationSampledEventEnabled())
+        {
+            FireAllocationSampled(flags, aligned_size, samplingBudget, retVal);
+        }
+
+        if (ee_alloc_context::s_pretenuringEnabled)
+        {
+            t_pretenureSampledObject = retVal;
+        }
     }
 
     // There are a variety of conditions that may have invalidated the previous combined_limit value
@@ -1204,6 +1216,134 @@ void AllocateComClassObject(ComClassFactory* pComClsFac, OBJECTREF* ppRefClass)
 }
 #endif // FEATURE_COMINTEROP_UNMANAGED_ACTIVATION
 
+//========================================================================
+//
+//      SAMPLED ALLOCATION PRETENURING
+//
+//========================================================================
+
+// When GCPretenureSampledTypes is enabled, sampled object allocations are tracked with short weak handles.
+// A sample that is still alive after a couple of GCs counts as a survivor for its type, and types whose
+// samples mostly survive are marked as pretenured. There is no gen1/gen2 allocation context for small
+// objects, so code:AllocateObject places pretenured types on the LOH, which is only collected with gen2.
+// This saves copying long lived objects (caches, session state) through gen0 and gen1.
+static const size_t   PretenureSurvivalGCs          = 2;
+static const uint32_t PretenureMinSamples           = 16;
+static const uint32_t PretenureSurvivalPercent      = 90;
+static const int      PretenureMaxPendingSamples    = 64;
+static const int      PretenureMaxTrackedTypes      = 256;
+static const int      PretenureMaxProbes            = 8;
+
+struct PretenureSample
+{
+    OBJECTHANDLE    handle;
+    MethodTable*    pMT;
+    size_t          gcCount;
+};
+
+struct PretenureTypeStats
+{
+    MethodTable*    pMT;
+    uint32_t        samples;
+    uint32_t        survivors;
+};
+
+static PretenureSample      s_pretenureSamples[PretenureMaxPendingSamples];
+static PretenureTypeStats   s_pretenureTypes[PretenureMaxTrackedTypes];
+static LONG                 s_pretenureLock = 0;
+
+static void UpdatePretenureTypeStats(MethodTable* pMT, bool survived)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    size_t hash = ((size_t)pMT >> 3);
+    for (int probe = 0; probe < PretenureMaxProbes; probe++)
+    {
+        PretenureTypeStats* pStats = &s_pretenureTypes[(hash + probe) & (PretenureMaxTrackedTypes - 1)];
+        if (pStats->pMT == nullptr)
+        {
+            pStats->pMT = pMT;
+        }
+        else if (pStats->pMT != pMT)
+        {
+            continue;
+        }
+
+        pStats->samples++;
+        if (survived)
+        {
+            pStats->survivors++;
+        }
+
+        if (pStats->samples >= PretenureMinSamples)
+        {
+            if (pStats->survivors * 100 >= pStats->samples * PretenureSurvivalPercent)
+            {
+                LOG((LF_GC, LL_INFO100, "Pretenuring MethodTable %p: %u of %u sampled objects survived\n",
+                    pMT, pStats->survivors, pStats->samples));
+                pMT->GetAuxiliaryData()->SetPretenured();
+            }
+            else
+            {
+                // Decay so the decision follows what the type does now rather than since startup.
+                pStats->samples /= 2;
+                pStats->survivors /= 2;
+            }
+        }
+        return;
+    }
+
+    // The neighborhood of this type is full; it simply isn't considered for pretenuring.
+}
+
+static void RecordPretenuringSample(MethodTable* pMT, Object* pObj)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    } CONTRACTL_END;
+
+    // Pretenuring is one way, and the tables hold on to MethodTables that a collectible type could free.
+    if (pMT->GetAuxiliaryData()->IsPretenured() || pMT->Collectible())
+        return;
+
+    // Rather than wait for another allocating thread, drop the sample; the decision is statistical anyway.
+    if (InterlockedCompareExchange(&s_pretenureLock, 1, 0) != 0)
+        return;
+
+    size_t gcCount = (size_t)GCHeapUtilities::GetGCHeap()->CollectionCount(0);
+    int freeSlot = -1;
+    for (int i = 0; i < PretenureMaxPendingSamples; i++)
+    {
+        PretenureSample* pSample = &s_pretenureSamples[i];
+        if ((pSample->handle != NULL) && (gcCount >= pSample->gcCount + PretenureSurvivalGCs))
+        {
+            UpdatePretenureTypeStats(pSample->pMT, ObjectFromHandle(pSample->handle) != NULL);
+            DestroyGlobalShortWeakHandle(pSample->handle);
+            pSample->handle = NULL;
+        }
+
+        if ((pSample->handle == NULL) && (freeSlot == -1))
+        {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot != -1)
+    {
+        OBJECTHANDLE handle = GCHandleUtilities::GetGCHandleManager()->CreateGlobalHandleOfType(pObj, HNDTYPE_WEAK_SHORT);
+        if (handle != NULL)
+        {
+            s_pretenureSamples[freeSlot].handle = handle;
+            s_pretenureSamples[freeSlot].pMT = pMT;
+            s_pretenureSamples[freeSlot].gcCount = gcCount;
+        }
+    }
+
+    VolatileStore(&s_pretenureLock, (LONG)0);
+}
+
 // AllocateObject will throw OutOfMemoryException so don't need to check
 // for NULL return value from it.
 OBJECTREF AllocateObject(MethodTable *pMT
@@ -1278,6 +1418,14 @@ OBJECTREF AllocateObject(MethodTable *pMT
         }
 #endif // FEATURE_64BIT_ALIGNMENT
 
+        // The LOH cannot give out biased headers, see GCHeap::Alloc.
+        if (ee_alloc_context::s_pretenuringEnabled &&
+            pMT->GetAuxiliaryData()->IsPretenured() &&
+            ((flags & GC_ALLOC_ALIGN8_BIAS) == 0))
+        {
+            flags |= GC_ALLOC_LARGE_OBJECT_HEAP;
+        }
+
         Object* orObject = (Object*)Alloc(totalSize, flags);
 
         if (flags & GC_ALLOC_USER_OLD_HEAP)
@@ -1289,6 +1437,12 @@ OBJECTREF AllocateObject(MethodTable *pMT
             orObject->SetMethodTable(pMT);
         }
 
+        if (ee_alloc_context::s_pretenuringEnabled && (t_pretenureSampledObject == orObject))
+        {
+            t_pretenureSampledObject = nullptr;
+            RecordPretenuringSample(pMT, orObject);
+        }
+
         PublishObjectAndNotify(orObject, flags);
         oref = OBJECTREF_TO_UNCHECKED_OBJECTREF(orObject);
     }
@@ -913,19 +913,29 @@ template <typename GcInfoEncoding> bool TGcInfoDecoder<GcInfoEncoding>::Enumerat
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Fetch the live state half a word at a time and stop scanning each chunk at its
+            // last live slot, instead of going through the bit stream once per slot.
+            // (Read cannot fetch a full BITS_PER_SIZE_T bits from a word aligned position.)
+            const UINT32 slotsPerRead = (UINT32)BITS_PER_SIZE_T / 2;
+            for(UINT32 slotBase = 0; slotBase < numSlots; slotBase += slotsPerRead)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 numBits = (numSlots - slotBase < slotsPerRead) ? (numSlots - slotBase) : slotsPerRead;
+                size_t liveBits = m_Reader.Read((int)numBits);
+
+                for(UINT32 slotIndex = slotBase; liveBits != 0; slotIndex++, liveBits >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveBits & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                slotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                    }
                 }
             }
             goto ReportUntracked;
@@ -376,3 +376,8 @@ void GCToCLREventSink::FirePrvDestroyGCHandle(void *handleID)
 {
     FireEtwPrvDestroyGCHandle(handleID, GetClrInstanceId());
 }
+
+void GCToCLREventSink::FireGCPerHeapPhaseTimes(uint16_t count, uint32_t valuesLen, void *values)
+{
+    FireEtwGCPerHeapPhaseTimes(GetClrInstanceId(), count, valuesLen, values);
+}
@@ -93,6 +93,7 @@ public:
     void FirePrvSetGCHandle(void *handleID, void *objectID, uint32_t kind, uint32_t generation);
     void FireDestroyGCHandle(void *handleID);
     void FirePrvDestroyGCHandle(void *handleID);
+    void FireGCPerHeapPhaseTimes(uint16_t count, uint32_t valuesLen, void *values);
 };
 
 extern GCToCLREventSink g_gcToClrEventSink;
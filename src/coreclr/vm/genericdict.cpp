@@ -33,6 +33,10 @@
 
 #ifndef DACCESS_COMPILE
 
+LONG Dictionary::s_numSlowPathLookups = 0;
+LONG Dictionary::s_numDictionaryExpansions = 0;
+LONG Dictionary::s_numDictionaryExpansionRaces = 0;
+
 //---------------------------------------------------------------------------------------
 //
 //static
@@ -351,6 +355,8 @@ BOOL DictionaryLayout::FindToken(MethodTable*                       pMT,
 
         // Update the dictionary layout pointer. Note that the expansion of the dictionaries of all instantiated types using this layout
         // is done lazily, whenever we attempt to access a slot that is beyond the size of the existing dictionary on that type.
+        // Dictionaries are expanded without taking the lock, so make the new layout visible only once it is initialized.
+        MemoryBarrier();
         pMT->GetClass()->SetDictionaryLayout(pNewLayout);
 
         return TRUE;
@@ -398,6 +404,8 @@ BOOL DictionaryLayout::FindToken(MethodDesc*                        pMD,
 
         // Update the dictionary layout pointer. Note that the expansion of the dictionaries of all instantiated methods using this layout
         // is done lazily, whenever we attempt to access a slot that is beyond the size of the existing dictionary on that method.
+        // Dictionaries are expanded without taking the lock, so make the new layout visible only once it is initialized.
+        MemoryBarrier();
         pMD->AsInstantiatedMethodDesc()->IMD_SetDictionaryLayout(pNewLayout);
 
         return TRUE;
@@ -495,44 +503,36 @@ Dictionary* Dictionary::GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG
     Dictionary* pDictionary = pMD->GetMethodDictionary();
     DWORD currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
 
-    if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+    // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary. The
+    // expanded dictionary is published with a compare exchange, a thread that loses the race gives its copy back
+    // and retries with the dictionary of the winner (which may itself be too small if the layout grew meanwhile).
+    while (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
     {
-        // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
+        DictionaryLayout* pDictLayout = pMD->GetDictionaryLayout();
+        InstantiatedMethodDesc* pIMD = pMD->AsInstantiatedMethodDesc();
+        _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
 
-        // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(GetAppDomain()->GetGenericDictionaryExpansionLock());
+        DWORD expectedDictionarySlotSize;
+        DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
+        _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
 
-        pDictionary = pMD->GetMethodDictionary();
-        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+        Dictionary* pNewDictionary = AllocateExpandedDictionary(pIMD->GetLoaderAllocator(), pDictionary, numGenericArgs,
+                                                                currentDictionarySize, expectedDictionarySlotSize, expectedDictionaryAllocSize);
 
-        if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+        // Publish the new dictionary slots to the method.
+        Dictionary* pPublishedDictionary = InterlockedCompareExchangeT(&pIMD->m_pPerInstInfo, pNewDictionary, pDictionary);
+        if (pPublishedDictionary == pDictionary)
         {
-            DictionaryLayout* pDictLayout = pMD->GetDictionaryLayout();
-            InstantiatedMethodDesc* pIMD = pMD->AsInstantiatedMethodDesc();
-            _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
-
-            DWORD expectedDictionarySlotSize;
-            DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
-            _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
-
-            Dictionary* pNewDictionary = (Dictionary*)(void*)pIMD->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize));
-
-            // Copy old dictionary entry contents
-            for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
-            {
-                // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
-                *((DictionaryEntry*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
-            }
-
-            DWORD* pSizeSlot = (DWORD*)(pNewDictionary + numGenericArgs);
-            *pSizeSlot = expectedDictionarySlotSize;
-            *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
-
-            // Publish the new dictionary slots to the type.
-            InterlockedExchangeT(&pIMD->m_pPerInstInfo, pNewDictionary);
-
+            InterlockedIncrement(&s_numDictionaryExpansions);
             pDictionary = pNewDictionary;
+            break;
         }
+
+        InterlockedIncrement(&s_numDictionaryExpansionRaces);
+        pIMD->GetLoaderAllocator()->GetHighFrequencyHeap()->BackoutMem(pNewDictionary, expectedDictionaryAllocSize);
+
+        pDictionary = pPublishedDictionary;
+        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
     }
 
     RETURN pDictionary;
@@ -553,49 +553,75 @@ Dictionary* Dictionary::GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG s
     Dictionary* pDictionary = pMT->GetDictionary();
     DWORD currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
 
-    if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+    // See GetMethodDictionaryWithSizeCheck
+    while (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
     {
-        // Only expand the dictionary if the current slot we're trying to use is beyond the size of the dictionary
-
-        // Take lock and check for size again, just in case another thread already resized the dictionary
-        CrstHolder ch(GetAppDomain()->GetGenericDictionaryExpansionLock());
-
-        pDictionary = pMT->GetDictionary();
-        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
-
-        if (currentDictionarySize <= (slotIndex * sizeof(DictionaryEntry)))
+        DictionaryLayout* pDictLayout = pMT->GetClass()->GetDictionaryLayout();
+        _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
+
+        DWORD expectedDictionarySlotSize;
+        DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
+        _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
+
+        // Expand type dictionary
+        Dictionary* pNewDictionary = AllocateExpandedDictionary(pMT->GetLoaderAllocator(), pDictionary, numGenericArgs,
+                                                                currentDictionarySize, expectedDictionarySlotSize, expectedDictionaryAllocSize);
+
+        // Publish the new dictionary slots to the type.
+        ULONG dictionaryIndex = pMT->GetNumDicts() - 1;
+        Dictionary** pPerInstInfo = pMT->GetPerInstInfo();
+        Dictionary* pPublishedDictionary = InterlockedCompareExchangeT(pPerInstInfo + dictionaryIndex, pNewDictionary, pDictionary);
+        if (pPublishedDictionary == pDictionary)
         {
-            DictionaryLayout* pDictLayout = pMT->GetClass()->GetDictionaryLayout();
-            _ASSERTE(pDictLayout != NULL && pDictLayout->GetMaxSlots() > 0);
+            InterlockedIncrement(&s_numDictionaryExpansions);
+            pDictionary = pNewDictionary;
+            break;
+        }
 
-            DWORD expectedDictionarySlotSize;
-            DWORD expectedDictionaryAllocSize = DictionaryLayout::GetDictionarySizeFromLayout(numGenericArgs, pDictLayout, &expectedDictionarySlotSize);
-            _ASSERT(currentDictionarySize < expectedDictionarySlotSize);
+        InterlockedIncrement(&s_numDictionaryExpansionRaces);
+        pMT->GetLoaderAllocator()->GetHighFrequencyHeap()->BackoutMem(pNewDictionary, expectedDictionaryAllocSize);
 
-            // Expand type dictionary
-            Dictionary* pNewDictionary = (Dictionary*)(void*)pMT->GetLoaderAllocator()->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(expectedDictionaryAllocSize));
+        pDictionary = pPublishedDictionary;
+        currentDictionarySize = pDictionary->GetDictionarySlotsSize(numGenericArgs);
+    }
 
-            // Copy old dictionary entry contents
-            for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
-            {
-                // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
-                *((DictionaryEntry*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
-            }
+    RETURN pDictionary;
+}
 
-            DWORD* pSizeSlot = (DWORD*)(pNewDictionary + numGenericArgs);
-            *pSizeSlot = expectedDictionarySlotSize;
-            *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
+//---------------------------------------------------------------------------------------
+//
+// Allocates a copy of pDictionary with room for the slots of the current layout. The copy is not published.
+//
+Dictionary* Dictionary::AllocateExpandedDictionary(LoaderAllocator* pAllocator,
+                                                   Dictionary*      pDictionary,
+                                                   DWORD            numGenericArgs,
+                                                   DWORD            currentDictionarySize,
+                                                   DWORD            newDictionarySlotSize,
+                                                   DWORD            newDictionaryAllocSize)
+{
+    CONTRACT(Dictionary*)
+    {
+        THROWS;
+        GC_NOTRIGGER;
+        INJECT_FAULT(COMPlusThrowOM(););
+        POSTCONDITION(CheckPointer(RETVAL));
+    }
+    CONTRACT_END;
 
-            // Publish the new dictionary slots to the type.
-            ULONG dictionaryIndex = pMT->GetNumDicts() - 1;
-            Dictionary** pPerInstInfo = pMT->GetPerInstInfo();
-            InterlockedExchangeT(pPerInstInfo + dictionaryIndex, pNewDictionary);
+    Dictionary* pNewDictionary = (Dictionary*)(void*)pAllocator->GetHighFrequencyHeap()->AllocMem(S_SIZE_T(newDictionaryAllocSize));
 
-            pDictionary = pNewDictionary;
-        }
+    // Copy old dictionary entry contents
+    for (DWORD i = 0; i < currentDictionarySize / sizeof(DictionaryEntry); i++)
+    {
+        // Use VolatileLoadWithoutBarrier to ensure that the compiler won't turn this into memcpy that is not guaranteed to copy pointers atomically
+        *((DictionaryEntry*)pNewDictionary + i) = VolatileLoadWithoutBarrier((DictionaryEntry*)pDictionary + i);
     }
 
-    RETURN pDictionary;
+    DWORD* pSizeSlot = (DWORD*)(pNewDictionary + numGenericArgs);
+    *pSizeSlot = newDictionarySlotSize;
+    *pNewDictionary->GetBackPointerSlot(numGenericArgs) = pDictionary;
+
+    RETURN pNewDictionary;
 }
 
 struct StaticVirtualDispatchHashBlob : public ILStubHashBlobBase
@@ -682,6 +708,11 @@ Dictionary::PopulateEntry(
     CORINFO_GENERIC_HANDLE result = NULL;
     *ppSlot = NULL;
 
+    LONG numSlowPathLookups = InterlockedIncrement(&s_numSlowPathLookups);
+    LOG((LF_JIT, LL_INFO10000, "GENERICS: Dictionary slow path lookup #%d (%d expansions, %d lost races) for %s\n",
+         numSlowPathLookups, s_numDictionaryExpansions, s_numDictionaryExpansionRaces,
+         pMD != NULL ? pMD->m_pszDebugMethodName : pMT->GetDebugClassName()));
+
     bool isReadyToRunModule = (pModule != NULL && pModule->IsReadyToRun());
 
     ZapSig::Context zapSigContext(NULL, NULL, ZapSig::NormalTokens);
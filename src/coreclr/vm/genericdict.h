@@ -284,6 +284,17 @@ public:
 private:
     static Dictionary* GetTypeDictionaryWithSizeCheck(MethodTable* pMT, ULONG slotIndex);
     static Dictionary* GetMethodDictionaryWithSizeCheck(MethodDesc* pMD, ULONG slotIndex);
+    static Dictionary* AllocateExpandedDictionary(LoaderAllocator* pAllocator,
+                                                  Dictionary*      pDictionary,
+                                                  DWORD            numGenericArgs,
+                                                  DWORD            currentDictionarySize,
+                                                  DWORD            newDictionarySlotSize,
+                                                  DWORD            newDictionaryAllocSize);
+
+    // Lookups that missed the dictionary and went through PopulateEntry, for diagnostics
+    static LONG s_numSlowPathLookups;
+    static LONG s_numDictionaryExpansions;
+    static LONG s_numDictionaryExpansionRaces;
 
 #endif // #ifndef DACCESS_COMPILE
 };
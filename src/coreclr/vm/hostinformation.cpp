@@ -13,8 +13,9 @@ void HostInformation::SetContract(_In_ host_runtime_contract* hostContract)
 {
     _ASSERTE(s_hostContract.size == 0 && hostContract != nullptr);
 
-    // Copy the contract values
-    s_hostContract = *hostContract;
+    // Copy the contract values. Older hosts pass a smaller contract, so only copy what they provided.
+    size_t size = min(hostContract->size, sizeof(host_runtime_contract));
+    memcpy(&s_hostContract, hostContract, size);
 }
 
 bool HostInformation::GetProperty(_In_z_ const char* name, SString& value)
@@ -57,3 +58,13 @@ bool HostInformation::ExternalAssemblyProbe(_In_ const SString& path, _Out_ void
     utf8Path.SetAndConvertToUTF8(path.GetUnicode());
     return s_hostContract.external_assembly_probe(utf8Path.GetUTF8(), data, size);
 }
+
+bool HostInformation::GetTrustedPlatformAssemblies(_Out_ const host_runtime_tpa_entry** entries, _Out_ size_t* count)
+{
+    *entries = nullptr;
+    *count = 0;
+    if (s_hostContract.get_trusted_platform_assemblies == nullptr)
+        return false;
+
+    return s_hostContract.get_trusted_platform_assemblies(entries, count, s_hostContract.context);
+}
@@ -160,6 +160,33 @@ static OBJECTREF CreateMultiDimArray(MethodTable* arrayClass, int8_t* stack, int
 #define LOCAL_VAR(offset,type) (*LOCAL_VAR_ADDR(offset, type))
 #define NULL_CHECK(o) do { if ((o) == NULL) { COMPlusThrow(kNullReferenceException); } } while (0)
 
+// With compilers that support computed goto, the opcodes are dispatched by an indirect jump at the end
+// of each opcode handler rather than by the single indirect jump of the switch. That gives the branch
+// predictor a separate history per opcode handler. Define INTERP_USE_SWITCH_DISPATCH to use the switch
+// only. Handlers that leave the switch with a plain break go through the dispatch at the top of the loop.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(INTERP_USE_SWITCH_DISPATCH)
+#define INTERP_THREADED_DISPATCH
+#endif
+
+// Define INTERP_OPCODE_STATS to count the executed opcodes and opcode pairs. The counts are printed at
+// shutdown and are meant for finding sequences of opcodes worth fusing into superinstructions.
+#ifdef INTERP_OPCODE_STATS
+#define INTERP_COUNT_OPCODE() InterpCountOpcode(&prevOpcode, *ip)
+#else
+#define INTERP_COUNT_OPCODE()
+#endif // INTERP_OPCODE_STATS
+
+#ifdef INTERP_THREADED_DISPATCH
+#define INTERP_LABEL(op) LABEL_##op:
+#define INTERP_CASE(op) case op: INTERP_LABEL(op)
+#define INTERP_DISPATCH() do { INTERP_COUNT_OPCODE(); goto *s_interpDispatchTable[*ip]; } while (0)
+#define INTERP_BREAK do { pFrame->ip = (int32_t*)ip; INTERP_DISPATCH(); } while (0)
+#else // INTERP_THREADED_DISPATCH
+#define INTERP_LABEL(op)
+#define INTERP_CASE(op) case op:
+#define INTERP_BREAK break
+#endif // INTERP_THREADED_DISPATCH
+
 template <typename THelper> static THelper GetPossiblyIndirectHelper(void* dataItem)
 {
     size_t helperDirectOrIndirect = (size_t)dataItem;
@@ -362,6 +389,108 @@ void* DoGenericLookup(void* genericVarAsPtr, InterpGenericLookup* pLookup)
     return result;
 }
 
+#ifdef FEATURE_TIERED_COMPILATION
+static void InterpOnTierUpCountdownExpired(InterpMethod *pMethod)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    if (!CallCountingManager::OnInterpreterTierUpThresholdReached((MethodDesc*)pMethod->methodHnd))
+    {
+        // Call counting has not started yet, count again
+        pMethod->tierUpCountdown = g_pConfig->TieredCompilation_InterpreterTierUpThreshold();
+    }
+}
+#endif // FEATURE_TIERED_COMPILATION
+
+#ifdef INTERP_OPCODE_STATS
+// The counters are updated without synchronization, so with multiple threads the numbers are approximate
+static uint64_t s_interpOpcodeCounts[INTOP_LAST];
+static uint64_t s_interpOpcodePairCounts[INTOP_LAST][INTOP_LAST];
+
+static const char* const s_interpOpcodeNames[] =
+{
+#define OPDEF(a,b,c,d,e,f) b,
+#include "../interpreter/intops.def"
+#undef OPDEF
+};
+
+static FORCEINLINE void InterpCountOpcode(int32_t *pPrevOpcode, int32_t opcode)
+{
+    s_interpOpcodeCounts[opcode]++;
+    if (*pPrevOpcode != INTOP_LAST)
+        s_interpOpcodePairCounts[*pPrevOpcode][opcode]++;
+    *pPrevOpcode = opcode;
+}
+
+struct InterpOpcodeCount
+{
+    int32_t first;
+    int32_t second;
+    uint64_t count;
+};
+
+static const int c_interpOpcodeStatsEntries = 64;
+
+// Keeps the entries with the highest counts, sorted in descending order
+static void AddOpcodeCountEntry(InterpOpcodeCount *pEntries, int *pNumEntries, int32_t first, int32_t second, uint64_t count)
+{
+    if (count == 0 || (*pNumEntries == c_interpOpcodeStatsEntries && count <= pEntries[c_interpOpcodeStatsEntries - 1].count))
+        return;
+
+    int pos = (*pNumEntries < c_interpOpcodeStatsEntries) ? (*pNumEntries)++ : c_interpOpcodeStatsEntries - 1;
+    while (pos > 0 && pEntries[pos - 1].count < count)
+    {
+        pEntries[pos] = pEntries[pos - 1];
+        pos--;
+    }
+    pEntries[pos] = { first, second, count };
+}
+
+void InterpDumpOpcodeStats()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterpOpcodeCount topOpcodes[c_interpOpcodeStatsEntries];
+    InterpOpcodeCount topPairs[c_interpOpcodeStatsEntries];
+    int numTopOpcodes = 0;
+    int numTopPairs = 0;
+    uint64_t total = 0;
+
+    for (int32_t i = 0; i < INTOP_LAST; i++)
+    {
+        total += s_interpOpcodeCounts[i];
+        AddOpcodeCountEntry(topOpcodes, &numTopOpcodes, i, INTOP_LAST, s_interpOpcodeCounts[i]);
+        for (int32_t j = 0; j < INTOP_LAST; j++)
+            AddOpcodeCountEntry(topPairs, &numTopPairs, i, j, s_interpOpcodePairCounts[i][j]);
+    }
+
+    if (total == 0)
+        return;
+
+    minipal_log_print_info("Interpreter executed %" PRIu64 " opcodes\n\nTop opcodes:\n", total);
+    for (int i = 0; i < numTopOpcodes; i++)
+    {
+        minipal_log_print_info("%12" PRIu64 " %6.2f%% %s\n", topOpcodes[i].count,
+            topOpcodes[i].count * 100.0 / total, s_interpOpcodeNames[topOpcodes[i].first]);
+    }
+
+    minipal_log_print_info("\nTop opcode pairs:\n");
+    for (int i = 0; i < numTopPairs; i++)
+    {
+        minipal_log_print_info("%12" PRIu64 " %6.2f%% %s, %s\n", topPairs[i].count,
+            topPairs[i].count * 100.0 / total, s_interpOpcodeNames[topPairs[i].first],
+            s_interpOpcodeNames[topPairs[i].second]);
+    }
+}
+#endif // INTERP_OPCODE_STATS
+
 void InterpExecMethod(InterpreterFrame *pInterpreterFrame, InterpMethodContextFrame *pFrame, InterpThreadContext *pThreadContext, ExceptionClauseArgs *pExceptionClauseArgs)
 {
     CONTRACTL
@@ -410,6 +539,19 @@ void InterpExecMethod(InterpreterFrame *pInterpreterFrame, InterpMethodContextFr
 
     int32_t returnOffset, callArgsOffset, methodSlot;
     MethodDesc* targetMethod;
+#ifdef INTERP_OPCODE_STATS
+    int32_t prevOpcode = INTOP_LAST;
+#endif // INTERP_OPCODE_STATS
+
+#ifdef INTERP_THREADED_DISPATCH
+    static const void* const s_interpDispatchTable[] =
+    {
+#define OPDEF(a,b,c,d,e,f) &&LABEL_##a,
+#include "../interpreter/intops.def"
+#undef OPDEF
+    };
+    static_assert(ARRAY_SIZE(s_interpDispatchTable) == INTOP_LAST, "Every opcode needs a dispatch table entry");
+#endif // INTERP_THREADED_DISPATCH
 
 MAIN_LOOP:
     try
@@ -425,73 +567,78 @@ MAIN_LOOP:
             // keep it for such purposes until we don't need it anymore.
             pFrame->ip = (int32_t*)ip;
 
+#ifdef INTERP_THREADED_DISPATCH
+            INTERP_DISPATCH();
+#else
+            INTERP_COUNT_OPCODE();
+#endif // INTERP_THREADED_DISPATCH
             switch (*ip)
             {
 #ifdef DEBUG
-                case INTOP_BREAKPOINT:
+                INTERP_CASE(INTOP_BREAKPOINT)
                     InterpBreakpoint();
                     ip++;
-                    break;
+                    INTERP_BREAK;
 #endif
-                case INTOP_INITLOCALS:
+                INTERP_CASE(INTOP_INITLOCALS)
                     memset(stack + ip[1], 0, ip[2]);
                     ip += 3;
-                    break;
-                case INTOP_MEMBAR:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_MEMBAR)
                     MemoryBarrier();
                     ip++;
-                    break;
-                case INTOP_LDC_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_I4)
                     LOCAL_VAR(ip[1], int32_t) = ip[2];
                     ip += 3;
-                    break;
-                case INTOP_LDC_I4_0:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_I4_0)
                     LOCAL_VAR(ip[1], int32_t) = 0;
                     ip += 2;
-                    break;
-                case INTOP_LDC_I8_0:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_I8_0)
                     LOCAL_VAR(ip[1], int64_t) = 0;
                     ip += 2;
-                    break;
-                case INTOP_LDC_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_I8)
                     LOCAL_VAR(ip[1], int64_t) = (int64_t)(uint32_t)ip[2] + ((int64_t)ip[3] << 32);
                     ip += 4;
-                    break;
-                case INTOP_LDC_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_R4)
                     LOCAL_VAR(ip[1], int32_t) = ip[2];
                     ip += 3;
-                    break;
-                case INTOP_LDC_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDC_R8)
                     LOCAL_VAR(ip[1], int64_t) = (int64_t)(uint32_t)ip[2] + ((int64_t)ip[3] << 32);
                     ip += 4;
-                    break;
-                case INTOP_LDPTR:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDPTR)
                     LOCAL_VAR(ip[1], void*) = pMethod->pDataItems[ip[2]];
                     ip += 3;
-                    break;
-                case INTOP_LDPTR_DEREF:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDPTR_DEREF)
                     LOCAL_VAR(ip[1], void*) = *(void**)pMethod->pDataItems[ip[2]];
                     ip += 3;
-                    break;
-                case INTOP_RET:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_RET)
                     // Return stack slot sized value
                     *(int64_t*)pFrame->pRetVal = LOCAL_VAR(ip[1], int64_t);
                     goto EXIT_FRAME;
-                case INTOP_RET_VT:
+                INTERP_CASE(INTOP_RET_VT)
                     memmove(pFrame->pRetVal, stack + ip[1], ip[2]);
                     goto EXIT_FRAME;
-                case INTOP_RET_VOID:
+                INTERP_CASE(INTOP_RET_VOID)
                     goto EXIT_FRAME;
 
-                case INTOP_LDLOCA:
+                INTERP_CASE(INTOP_LDLOCA)
                     LOCAL_VAR(ip[1], void*) = stack + ip[2];
                     ip += 3;
-                    break;
-                case INTOP_LOAD_FRAMEVAR:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LOAD_FRAMEVAR)
                     _ASSERTE((pExceptionClauseArgs != NULL) && (pExceptionClauseArgs->isFilter));
                     LOCAL_VAR(ip[1], void*) = pExceptionClauseArgs->pFrame->pStack;
                     ip += 2;
-                    break;
+                    INTERP_BREAK;
 
 #define MOV(argtype1,argtype2) \
     LOCAL_VAR(ip [1], argtype1) = LOCAL_VAR(ip [2], argtype2); \
@@ -500,269 +647,269 @@ MAIN_LOOP:
                 // which is our minimum "register" size in interp. They are only needed when
                 // the address of the local is taken and we should try to optimize them out
                 // because the local can't be propagated.
-                case INTOP_MOV_I4_I1: MOV(int32_t, int8_t); break;
-                case INTOP_MOV_I4_U1: MOV(int32_t, uint8_t); break;
-                case INTOP_MOV_I4_I2: MOV(int32_t, int16_t); break;
-                case INTOP_MOV_I4_U2: MOV(int32_t, uint16_t); break;
+                INTERP_CASE(INTOP_MOV_I4_I1) MOV(int32_t, int8_t); INTERP_BREAK;
+                INTERP_CASE(INTOP_MOV_I4_U1) MOV(int32_t, uint8_t); INTERP_BREAK;
+                INTERP_CASE(INTOP_MOV_I4_I2) MOV(int32_t, int16_t); INTERP_BREAK;
+                INTERP_CASE(INTOP_MOV_I4_U2) MOV(int32_t, uint16_t); INTERP_BREAK;
                 // Normal moves between vars
-                case INTOP_MOV_4: MOV(int32_t, int32_t); break;
-                case INTOP_MOV_8: MOV(int64_t, int64_t); break;
+                INTERP_CASE(INTOP_MOV_4) MOV(int32_t, int32_t); INTERP_BREAK;
+                INTERP_CASE(INTOP_MOV_8) MOV(int64_t, int64_t); INTERP_BREAK;
 
-                case INTOP_MOV_VT:
+                INTERP_CASE(INTOP_MOV_VT)
                     memmove(stack + ip[1], stack + ip[2], ip[3]);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_R_UN_I4:
+                INTERP_CASE(INTOP_CONV_R_UN_I4)
                     LOCAL_VAR(ip[1], double) = (double)LOCAL_VAR(ip[2], uint32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R_UN_I8)
                     LOCAL_VAR(ip[1], double) = (double)LOCAL_VAR(ip[2], uint64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I1_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I1_I4)
                     LOCAL_VAR(ip[1], int32_t) = (int8_t)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I1_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I1_I8)
                     LOCAL_VAR(ip[1], int32_t) = (int8_t)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I1_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I1_R4)
                     ConvFpHelper<int8_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I1_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I1_R8)
                     ConvFpHelper<int8_t, double>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U1_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U1_I4)
                     LOCAL_VAR(ip[1], int32_t) = (uint8_t)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U1_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U1_I8)
                     LOCAL_VAR(ip[1], int32_t) = (uint8_t)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U1_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U1_R4)
                     ConvFpHelper<uint8_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U1_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U1_R8)
                     ConvFpHelper<uint8_t, double>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I2_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I2_I4)
                     LOCAL_VAR(ip[1], int32_t) = (int16_t)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I2_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I2_I8)
                     LOCAL_VAR(ip[1], int32_t) = (int16_t)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I2_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I2_R4)
                     ConvFpHelper<int16_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I2_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I2_R8)
                     ConvFpHelper<int16_t, double>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U2_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U2_I4)
                     LOCAL_VAR(ip[1], int32_t) = (uint16_t)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U2_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U2_I8)
                     LOCAL_VAR(ip[1], int32_t) = (uint16_t)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U2_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U2_R4)
                     ConvFpHelper<uint16_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U2_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U2_R8)
                     ConvFpHelper<uint16_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I4_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I4_R4)
                     ConvFpHelper<int32_t, float>(stack, ip);
                     ip += 3;
-                    break;;
-                case INTOP_CONV_I4_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I4_R8)
                     ConvFpHelper<int32_t, double>(stack, ip);
                     ip += 3;
-                    break;;
-                case INTOP_CONV_U4_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U4_R4)
                     ConvFpHelper<uint32_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U4_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U4_R8)
                     ConvFpHelper<uint32_t, double>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I8_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I8_I4)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I8_U4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I8_U4)
                     LOCAL_VAR(ip[1], int64_t) = (uint32_t)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;;
-                case INTOP_CONV_I8_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I8_R4)
                     ConvFpHelper<int64_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_I8_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_I8_R8)
                     ConvFpHelper<int64_t, double>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R4_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R4_I4)
                     LOCAL_VAR(ip[1], float) = (float)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R4_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R4_I8)
                     LOCAL_VAR(ip[1], float) = (float)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R4_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R4_R8)
                     LOCAL_VAR(ip[1], float) = (float)LOCAL_VAR(ip[2], double);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R8_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R8_I4)
                     LOCAL_VAR(ip[1], double) = (double)LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R8_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R8_I8)
                     LOCAL_VAR(ip[1], double) = (double)LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_CONV_R8_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_R8_R4)
                     LOCAL_VAR(ip[1], double) = (double)LOCAL_VAR(ip[2], float);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U8_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U8_R4)
                     ConvFpHelper<uint64_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_U8_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_U8_R8)
                     ConvFpHelper<uint64_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_I1_I4:
+                INTERP_CASE(INTOP_CONV_OVF_I1_I4)
                     ConvOvfHelper<int8_t, int32_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I1_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I1_I8)
                     ConvOvfHelper<int8_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I1_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I1_R4)
                     ConvOvfFpHelper<int8_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I1_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I1_R8)
                     ConvOvfFpHelper<int8_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_U1_I4:
+                INTERP_CASE(INTOP_CONV_OVF_U1_I4)
                     ConvOvfHelper<uint8_t, int32_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U1_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U1_I8)
                     ConvOvfHelper<uint8_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U1_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U1_R4)
                     ConvOvfFpHelper<uint8_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U1_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U1_R8)
                     ConvOvfFpHelper<uint8_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_I2_I4:
+                INTERP_CASE(INTOP_CONV_OVF_I2_I4)
                     ConvOvfHelper<int16_t, int32_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I2_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I2_I8)
                     ConvOvfHelper<int16_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I2_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I2_R4)
                     ConvOvfFpHelper<int16_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I2_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I2_R8)
                     ConvOvfFpHelper<int16_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_U2_I4:
+                INTERP_CASE(INTOP_CONV_OVF_U2_I4)
                     ConvOvfHelper<uint16_t, int32_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U2_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U2_I8)
                     ConvOvfHelper<uint16_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U2_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U2_R4)
                     ConvOvfFpHelper<uint16_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U2_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U2_R8)
                     ConvOvfFpHelper<uint16_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_I4_I8:
+                INTERP_CASE(INTOP_CONV_OVF_I4_I8)
                     ConvOvfHelper<int32_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I4_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I4_R4)
                     ConvOvfFpHelper<int32_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I4_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I4_R8)
                     ConvOvfFpHelper<int32_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_U4_I8:
+                INTERP_CASE(INTOP_CONV_OVF_U4_I8)
                     ConvOvfHelper<uint32_t, int64_t>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U4_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U4_R4)
                     ConvOvfFpHelper<uint32_t, float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U4_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U4_R8)
                     ConvOvfFpHelper<uint32_t, double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_I8_R4:
+                INTERP_CASE(INTOP_CONV_OVF_I8_R4)
                     ConvOvfFpHelperI64<float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_I8_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_I8_R8)
                     ConvOvfFpHelperI64<double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CONV_OVF_U8_R4:
+                INTERP_CASE(INTOP_CONV_OVF_U8_R4)
                     ConvOvfFpHelperU64<float>(stack, ip);
                     ip += 3;
-                    break;
-                case INTOP_CONV_OVF_U8_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CONV_OVF_U8_R8)
                     ConvOvfFpHelperU64<double>(stack, ip);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_SWITCH:
+                INTERP_CASE(INTOP_SWITCH)
                 {
                     uint32_t val = LOCAL_VAR(ip[1], uint32_t);
                     uint32_t n = ip[2];
@@ -776,18 +923,27 @@ MAIN_LOOP:
                     {
                         ip += n;
                     }
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_SAFEPOINT:
+                INTERP_CASE(INTOP_SAFEPOINT)
                     if (g_TrapReturningThreads)
                         JIT_PollGC();
+#ifdef FEATURE_TIERED_COMPILATION
+                    // Safepoints are emitted at method entry and at backward branches, so this counts
+                    // both calls and loop iterations of tier 0 code.
+                    if (pMethod->tierUpCountdown > 0 && --pMethod->tierUpCountdown == 0)
+                    {
+                        pInterpreterFrame->SetTopInterpMethodContextFrame(pFrame);
+                        InterpOnTierUpCountdownExpired(pMethod);
+                    }
+#endif // FEATURE_TIERED_COMPILATION
                     ip++;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_BR:
+                INTERP_CASE(INTOP_BR)
                     ip += ip[1];
-                    break;
+                    INTERP_BREAK;
 
 #define BR_UNOP(datatype, op)           \
     if (LOCAL_VAR(ip[1], datatype) op)  \
@@ -795,18 +951,18 @@ MAIN_LOOP:
     else \
         ip += 3;
 
-                case INTOP_BRFALSE_I4:
+                INTERP_CASE(INTOP_BRFALSE_I4)
                     BR_UNOP(int32_t, == 0);
-                    break;
-                case INTOP_BRFALSE_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BRFALSE_I8)
                     BR_UNOP(int64_t, == 0);
-                    break;
-                case INTOP_BRTRUE_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BRTRUE_I4)
                     BR_UNOP(int32_t, != 0);
-                    break;
-                case INTOP_BRTRUE_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BRTRUE_I8)
                     BR_UNOP(int64_t, != 0);
-                    break;
+                    INTERP_BREAK;
 
 #define BR_BINOP_COND(cond) \
     if (cond)               \
@@ -817,232 +973,257 @@ MAIN_LOOP:
 #define BR_BINOP(datatype, op) \
     BR_BINOP_COND(LOCAL_VAR(ip[1], datatype) op LOCAL_VAR(ip[2], datatype))
 
-                case INTOP_BEQ_I4:
+                INTERP_CASE(INTOP_BEQ_I4)
                     BR_BINOP(int32_t, ==);
-                    break;
-                case INTOP_BEQ_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BEQ_I8)
                     BR_BINOP(int64_t, ==);
-                    break;
-                case INTOP_BEQ_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BEQ_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(!isunordered(f1, f2) && f1 == f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BEQ_R8:
+                INTERP_CASE(INTOP_BEQ_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(!isunordered(d1, d2) && d1 == d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGE_I4:
+                INTERP_CASE(INTOP_BGE_I4)
                     BR_BINOP(int32_t, >=);
-                    break;
-                case INTOP_BGE_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGE_I8)
                     BR_BINOP(int64_t, >=);
-                    break;
-                case INTOP_BGE_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGE_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(!isunordered(f1, f2) && f1 >= f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGE_R8:
+                INTERP_CASE(INTOP_BGE_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(!isunordered(d1, d2) && d1 >= d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGT_I4:
+                INTERP_CASE(INTOP_BGT_I4)
                     BR_BINOP(int32_t, >);
-                    break;
-                case INTOP_BGT_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGT_I8)
                     BR_BINOP(int64_t, >);
-                    break;
-                case INTOP_BGT_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGT_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(!isunordered(f1, f2) && f1 > f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGT_R8:
+                INTERP_CASE(INTOP_BGT_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(!isunordered(d1, d2) && d1 > d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLT_I4:
+                INTERP_CASE(INTOP_BLT_I4)
                     BR_BINOP(int32_t, <);
-                    break;
-                case INTOP_BLT_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLT_I8)
                     BR_BINOP(int64_t, <);
-                    break;
-                case INTOP_BLT_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLT_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(!isunordered(f1, f2) && f1 < f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLT_R8:
+                INTERP_CASE(INTOP_BLT_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(!isunordered(d1, d2) && d1 < d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLE_I4:
+                INTERP_CASE(INTOP_BLE_I4)
                     BR_BINOP(int32_t, <=);
-                    break;
-                case INTOP_BLE_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLE_I8)
                     BR_BINOP(int64_t, <=);
-                    break;
-                case INTOP_BLE_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLE_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(!isunordered(f1, f2) && f1 <= f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLE_R8:
+                INTERP_CASE(INTOP_BLE_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(!isunordered(d1, d2) && d1 <= d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BNE_UN_I4:
+                INTERP_CASE(INTOP_BNE_UN_I4)
                     BR_BINOP(uint32_t, !=);
-                    break;
-                case INTOP_BNE_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BNE_UN_I8)
                     BR_BINOP(uint64_t, !=);
-                    break;
-                case INTOP_BNE_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BNE_UN_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(isunordered(f1, f2) || f1 != f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BNE_UN_R8:
+                INTERP_CASE(INTOP_BNE_UN_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(isunordered(d1, d2) || d1 != d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGE_UN_I4:
+                INTERP_CASE(INTOP_BGE_UN_I4)
                     BR_BINOP(uint32_t, >=);
-                    break;
-                case INTOP_BGE_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGE_UN_I8)
                     BR_BINOP(uint64_t, >=);
-                    break;
-                case INTOP_BGE_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGE_UN_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(isunordered(f1, f2) || f1 >= f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGE_UN_R8:
+                INTERP_CASE(INTOP_BGE_UN_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(isunordered(d1, d2) || d1 >= d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGT_UN_I4:
+                INTERP_CASE(INTOP_BGT_UN_I4)
                     BR_BINOP(uint32_t, >);
-                    break;
-                case INTOP_BGT_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGT_UN_I8)
                     BR_BINOP(uint64_t, >);
-                    break;
-                case INTOP_BGT_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGT_UN_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(isunordered(f1, f2) || f1 > f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BGT_UN_R8:
+                INTERP_CASE(INTOP_BGT_UN_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(isunordered(d1, d2) || d1 > d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLE_UN_I4:
+                INTERP_CASE(INTOP_BLE_UN_I4)
                     BR_BINOP(uint32_t, <=);
-                    break;
-                case INTOP_BLE_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLE_UN_I8)
                     BR_BINOP(uint64_t, <=);
-                    break;
-                case INTOP_BLE_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLE_UN_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(isunordered(f1, f2) || f1 <= f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLE_UN_R8:
+                INTERP_CASE(INTOP_BLE_UN_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(isunordered(d1, d2) || d1 <= d2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLT_UN_I4:
+                INTERP_CASE(INTOP_BLT_UN_I4)
                     BR_BINOP(uint32_t, <);
-                    break;
-                case INTOP_BLT_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLT_UN_I8)
                     BR_BINOP(uint64_t, <);
-                    break;
-                case INTOP_BLT_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLT_UN_R4)
                 {
                     float f1 = LOCAL_VAR(ip[1], float);
                     float f2 = LOCAL_VAR(ip[2], float);
                     BR_BINOP_COND(isunordered(f1, f2) || f1 < f2);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_BLT_UN_R8:
+                INTERP_CASE(INTOP_BLT_UN_R8)
                 {
                     double d1 = LOCAL_VAR(ip[1], double);
                     double d2 = LOCAL_VAR(ip[2], double);
                     BR_BINOP_COND(isunordered(d1, d2) || d1 < d2);
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_ADD_I4:
+#define BR_BINOP_IMM(datatype, op)                  \
+    if (LOCAL_VAR(ip[1], datatype) op ip[3])        \
+        ip += ip[2];                                \
+    else                                            \
+        ip += 4;
+
+                INTERP_CASE(INTOP_BEQ_I4_IMM)
+                    BR_BINOP_IMM(int32_t, ==);
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BNE_UN_I4_IMM)
+                    BR_BINOP_IMM(int32_t, !=);
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGE_I4_IMM)
+                    BR_BINOP_IMM(int32_t, >=);
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BGT_I4_IMM)
+                    BR_BINOP_IMM(int32_t, >);
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLE_I4_IMM)
+                    BR_BINOP_IMM(int32_t, <=);
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_BLT_I4_IMM)
+                    BR_BINOP_IMM(int32_t, <);
+                    INTERP_BREAK;
+
+                INTERP_CASE(INTOP_ADD_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) + LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_ADD_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) + LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_ADD_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_R4)
                     LOCAL_VAR(ip[1], float) = LOCAL_VAR(ip[2], float) + LOCAL_VAR(ip[3], float);
                     ip += 4;
-                    break;
-                case INTOP_ADD_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_R8)
                     LOCAL_VAR(ip[1], double) = LOCAL_VAR(ip[2], double) + LOCAL_VAR(ip[3], double);
                     ip += 4;
-                    break;
-                case INTOP_ADD_I4_IMM:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_I4_IMM)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) + ip[3];
                     ip += 4;
-                    break;
-                case INTOP_ADD_I8_IMM:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_I8_IMM)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) + ip[3];
                     ip += 4;
-                    break;
-                case INTOP_ADD_OVF_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_ADD_OVF_I4)
                 {
                     int32_t i1 = LOCAL_VAR(ip[2], int32_t);
                     int32_t i2 = LOCAL_VAR(ip[3], int32_t);
@@ -1051,9 +1232,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_ADD_OVF_I8:
+                INTERP_CASE(INTOP_ADD_OVF_I8)
                 {
                     int64_t i1 = LOCAL_VAR(ip[2], int64_t);
                     int64_t i2 = LOCAL_VAR(ip[3], int64_t);
@@ -1062,9 +1243,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_ADD_OVF_UN_I4:
+                INTERP_CASE(INTOP_ADD_OVF_UN_I4)
                 {
                     uint32_t i1 = LOCAL_VAR(ip[2], uint32_t);
                     uint32_t i2 = LOCAL_VAR(ip[3], uint32_t);
@@ -1073,9 +1254,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_ADD_OVF_UN_I8:
+                INTERP_CASE(INTOP_ADD_OVF_UN_I8)
                 {
                     uint64_t i1 = LOCAL_VAR(ip[2], uint64_t);
                     uint64_t i2 = LOCAL_VAR(ip[3], uint64_t);
@@ -1084,26 +1265,26 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_SUB_I4:
+                INTERP_CASE(INTOP_SUB_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) - LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SUB_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SUB_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) - LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_SUB_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SUB_R4)
                     LOCAL_VAR(ip[1], float) = LOCAL_VAR(ip[2], float) - LOCAL_VAR(ip[3], float);
                     ip += 4;
-                    break;
-                case INTOP_SUB_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SUB_R8)
                     LOCAL_VAR(ip[1], double) = LOCAL_VAR(ip[2], double) - LOCAL_VAR(ip[3], double);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_SUB_OVF_I4:
+                INTERP_CASE(INTOP_SUB_OVF_I4)
                 {
                     int32_t i1 = LOCAL_VAR(ip[2], int32_t);
                     int32_t i2 = LOCAL_VAR(ip[3], int32_t);
@@ -1112,9 +1293,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_SUB_OVF_I8:
+                INTERP_CASE(INTOP_SUB_OVF_I8)
                 {
                     int64_t i1 = LOCAL_VAR(ip[2], int64_t);
                     int64_t i2 = LOCAL_VAR(ip[3], int64_t);
@@ -1123,9 +1304,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_SUB_OVF_UN_I4:
+                INTERP_CASE(INTOP_SUB_OVF_UN_I4)
                 {
                     uint32_t i1 = LOCAL_VAR(ip[2], uint32_t);
                     uint32_t i2 = LOCAL_VAR(ip[3], uint32_t);
@@ -1134,9 +1315,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_SUB_OVF_UN_I8:
+                INTERP_CASE(INTOP_SUB_OVF_UN_I8)
                 {
                     uint64_t i1 = LOCAL_VAR(ip[2], uint64_t);
                     uint64_t i2 = LOCAL_VAR(ip[3], uint64_t);
@@ -1145,26 +1326,26 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_MUL_I4:
+                INTERP_CASE(INTOP_MUL_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) * LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_MUL_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_MUL_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) * LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_MUL_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_MUL_R4)
                     LOCAL_VAR(ip[1], float) = LOCAL_VAR(ip[2], float) * LOCAL_VAR(ip[3], float);
                     ip += 4;
-                    break;
-                case INTOP_MUL_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_MUL_R8)
                     LOCAL_VAR(ip[1], double) = LOCAL_VAR(ip[2], double) * LOCAL_VAR(ip[3], double);
                     ip += 4;
-                    break;
-                case INTOP_MUL_OVF_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_MUL_OVF_I4)
                 {
                     int32_t i1 = LOCAL_VAR(ip[2], int32_t);
                     int32_t i2 = LOCAL_VAR(ip[3], int32_t);
@@ -1173,10 +1354,10 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_MUL_OVF_I8:
+                INTERP_CASE(INTOP_MUL_OVF_I8)
                 {
                     int64_t i1 = LOCAL_VAR(ip[2], int64_t);
                     int64_t i2 = LOCAL_VAR(ip[3], int64_t);
@@ -1185,10 +1366,10 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_MUL_OVF_UN_I4:
+                INTERP_CASE(INTOP_MUL_OVF_UN_I4)
                 {
                     uint32_t i1 = LOCAL_VAR(ip[2], uint32_t);
                     uint32_t i2 = LOCAL_VAR(ip[3], uint32_t);
@@ -1197,10 +1378,10 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint32_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_MUL_OVF_UN_I8:
+                INTERP_CASE(INTOP_MUL_OVF_UN_I8)
                 {
                     uint64_t i1 = LOCAL_VAR(ip[2], uint64_t);
                     uint64_t i2 = LOCAL_VAR(ip[3], uint64_t);
@@ -1209,9 +1390,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], uint64_t) = i3;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_DIV_I4:
+                INTERP_CASE(INTOP_DIV_I4)
                 {
                     int32_t i1 = LOCAL_VAR(ip[2], int32_t);
                     int32_t i2 = LOCAL_VAR(ip[3], int32_t);
@@ -1221,9 +1402,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int32_t) = i1 / i2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_DIV_I8:
+                INTERP_CASE(INTOP_DIV_I8)
                 {
                     int64_t l1 = LOCAL_VAR(ip[2], int64_t);
                     int64_t l2 = LOCAL_VAR(ip[3], int64_t);
@@ -1233,36 +1414,36 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int64_t) = l1 / l2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_DIV_R4:
+                INTERP_CASE(INTOP_DIV_R4)
                     LOCAL_VAR(ip[1], float) = LOCAL_VAR(ip[2], float) / LOCAL_VAR(ip[3], float);
                     ip += 4;
-                    break;
-                case INTOP_DIV_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_DIV_R8)
                     LOCAL_VAR(ip[1], double) = LOCAL_VAR(ip[2], double) / LOCAL_VAR(ip[3], double);
                     ip += 4;
-                    break;
-                case INTOP_DIV_UN_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_DIV_UN_I4)
                 {
                     uint32_t i2 = LOCAL_VAR(ip[3], uint32_t);
                     if (i2 == 0)
                         COMPlusThrow(kDivideByZeroException);
                     LOCAL_VAR(ip[1], uint32_t) = LOCAL_VAR(ip[2], uint32_t) / i2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_DIV_UN_I8:
+                INTERP_CASE(INTOP_DIV_UN_I8)
                 {
                     uint64_t l2 = LOCAL_VAR(ip[3], uint64_t);
                     if (l2 == 0)
                         COMPlusThrow(kDivideByZeroException);
                     LOCAL_VAR(ip[1], uint64_t) = LOCAL_VAR(ip[2], uint64_t) / l2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_REM_I4:
+                INTERP_CASE(INTOP_REM_I4)
                 {
                     int32_t i1 = LOCAL_VAR(ip[2], int32_t);
                     int32_t i2 = LOCAL_VAR(ip[3], int32_t);
@@ -1272,9 +1453,9 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int32_t) = i1 % i2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_REM_I8:
+                INTERP_CASE(INTOP_REM_I8)
                 {
                     int64_t l1 = LOCAL_VAR(ip[2], int64_t);
                     int64_t l2 = LOCAL_VAR(ip[3], int64_t);
@@ -1284,109 +1465,109 @@ MAIN_LOOP:
                         COMPlusThrow(kOverflowException);
                     LOCAL_VAR(ip[1], int64_t) = l1 % l2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_REM_R4:
+                INTERP_CASE(INTOP_REM_R4)
                     LOCAL_VAR(ip[1], float) = fmodf(LOCAL_VAR(ip[2], float), LOCAL_VAR(ip[3], float));
                     ip += 4;
-                    break;
-                case INTOP_REM_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_REM_R8)
                     LOCAL_VAR(ip[1], double) = fmod(LOCAL_VAR(ip[2], double), LOCAL_VAR(ip[3], double));
                     ip += 4;
-                    break;
-                case INTOP_REM_UN_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_REM_UN_I4)
                 {
                     uint32_t i2 = LOCAL_VAR(ip[3], uint32_t);
                     if (i2 == 0)
                         COMPlusThrow(kDivideByZeroException);
                     LOCAL_VAR(ip[1], uint32_t) = LOCAL_VAR(ip[2], uint32_t) % i2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_REM_UN_I8:
+                INTERP_CASE(INTOP_REM_UN_I8)
                 {
                     uint64_t l2 = LOCAL_VAR(ip[3], uint64_t);
                     if (l2 == 0)
                         COMPlusThrow(kDivideByZeroException);
                     LOCAL_VAR(ip[1], uint64_t) = LOCAL_VAR(ip[2], uint64_t) % l2;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_SHL_I4:
+                INTERP_CASE(INTOP_SHL_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) << LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SHL_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SHL_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) << LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SHR_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SHR_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) >> LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SHR_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SHR_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) >> LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SHR_UN_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SHR_UN_I4)
                     LOCAL_VAR(ip[1], uint32_t) = LOCAL_VAR(ip[2], uint32_t) >> LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_SHR_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_SHR_UN_I8)
                     LOCAL_VAR(ip[1], uint64_t) = LOCAL_VAR(ip[2], uint64_t) >> LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_NEG_I4:
+                INTERP_CASE(INTOP_NEG_I4)
                     LOCAL_VAR(ip[1], int32_t) = - LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_NEG_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_NEG_I8)
                     LOCAL_VAR(ip[1], int64_t) = - LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
-                case INTOP_NEG_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_NEG_R4)
                     LOCAL_VAR(ip[1], float) = - LOCAL_VAR(ip[2], float);
                     ip += 3;
-                    break;
-                case INTOP_NEG_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_NEG_R8)
                     LOCAL_VAR(ip[1], double) = - LOCAL_VAR(ip[2], double);
                     ip += 3;
-                    break;
-                case INTOP_NOT_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_NOT_I4)
                     LOCAL_VAR(ip[1], int32_t) = ~ LOCAL_VAR(ip[2], int32_t);
                     ip += 3;
-                    break;
-                case INTOP_NOT_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_NOT_I8)
                     LOCAL_VAR(ip[1], int64_t) = ~ LOCAL_VAR(ip[2], int64_t);
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_AND_I4:
+                INTERP_CASE(INTOP_AND_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) & LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_AND_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_AND_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) & LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_OR_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_OR_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) | LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_OR_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_OR_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) | LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_XOR_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_XOR_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) ^ LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_XOR_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_XOR_I8)
                     LOCAL_VAR(ip[1], int64_t) = LOCAL_VAR(ip[2], int64_t) ^ LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
 
 #define CMP_BINOP_FP(datatype, op, noOrderVal)      \
     do {                                            \
@@ -1399,80 +1580,80 @@ MAIN_LOOP:
         ip += 4;                                    \
     } while (0)
 
-                case INTOP_CEQ_I4:
+                INTERP_CASE(INTOP_CEQ_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) == LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_CEQ_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CEQ_I8)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int64_t) == LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_CEQ_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CEQ_R4)
                     CMP_BINOP_FP(float, ==, 0);
-                    break;
-                case INTOP_CEQ_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CEQ_R8)
                     CMP_BINOP_FP(double, ==, 0);
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CGT_I4:
+                INTERP_CASE(INTOP_CGT_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) > LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_CGT_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_I8)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int64_t) > LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_CGT_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_R4)
                     CMP_BINOP_FP(float, >, 0);
-                    break;
-                case INTOP_CGT_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_R8)
                     CMP_BINOP_FP(double, >, 0);
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CGT_UN_I4:
+                INTERP_CASE(INTOP_CGT_UN_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], uint32_t) > LOCAL_VAR(ip[3], uint32_t);
                     ip += 4;
-                    break;
-                case INTOP_CGT_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_UN_I8)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], uint32_t) > LOCAL_VAR(ip[3], uint32_t);
                     ip += 4;
-                    break;
-                case INTOP_CGT_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_UN_R4)
                     CMP_BINOP_FP(float, >, 1);
-                    break;
-                case INTOP_CGT_UN_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CGT_UN_R8)
                     CMP_BINOP_FP(double, >, 1);
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CLT_I4:
+                INTERP_CASE(INTOP_CLT_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int32_t) < LOCAL_VAR(ip[3], int32_t);
                     ip += 4;
-                    break;
-                case INTOP_CLT_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_I8)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], int64_t) < LOCAL_VAR(ip[3], int64_t);
                     ip += 4;
-                    break;
-                case INTOP_CLT_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_R4)
                     CMP_BINOP_FP(float, <, 0);
-                    break;
-                case INTOP_CLT_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_R8)
                     CMP_BINOP_FP(double, <, 0);
-                    break;
+                    INTERP_BREAK;
 
-                case INTOP_CLT_UN_I4:
+                INTERP_CASE(INTOP_CLT_UN_I4)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], uint32_t) < LOCAL_VAR(ip[3], uint32_t);
                     ip += 4;
-                    break;
-                case INTOP_CLT_UN_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_UN_I8)
                     LOCAL_VAR(ip[1], int32_t) = LOCAL_VAR(ip[2], uint64_t) < LOCAL_VAR(ip[3], uint64_t);
                     ip += 4;
-                    break;
-                case INTOP_CLT_UN_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_UN_R4)
                     CMP_BINOP_FP(float, <, 1);
-                    break;
-                case INTOP_CLT_UN_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_CLT_UN_R8)
                     CMP_BINOP_FP(double, <, 1);
-                    break;
+                    INTERP_BREAK;
 
 #define LDIND(dtype, ftype)                                 \
     do {                                                    \
@@ -1482,37 +1663,37 @@ MAIN_LOOP:
         ip += 4;                                            \
     } while (0)
 
-                case INTOP_LDIND_I1:
+                INTERP_CASE(INTOP_LDIND_I1)
                     LDIND(int32_t, int8_t);
-                    break;
-                case INTOP_LDIND_U1:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_U1)
                     LDIND(int32_t, uint8_t);
-                    break;
-                case INTOP_LDIND_I2:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_I2)
                     LDIND(int32_t, int16_t);
-                    break;
-                case INTOP_LDIND_U2:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_U2)
                     LDIND(int32_t, uint16_t);
-                    break;
-                case INTOP_LDIND_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_I4)
                     LDIND(int32_t, int32_t);
-                    break;
-                case INTOP_LDIND_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_I8)
                     LDIND(int64_t, int64_t);
-                    break;
-                case INTOP_LDIND_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_R4)
                     LDIND(float, float);
-                    break;
-                case INTOP_LDIND_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_R8)
                     LDIND(double, double);
-                    break;
-                case INTOP_LDIND_VT:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LDIND_VT)
                 {
                     char *src = LOCAL_VAR(ip[2], char*);
                     NULL_CHECK(src);
                     memcpy(stack + ip[1], (char*)src + ip[3], ip[4]);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
 #define STIND(dtype, ftype)                                         \
@@ -1524,106 +1705,106 @@ MAIN_LOOP:
         ip += 4;                                                    \
     } while (0)
 
-                case INTOP_STIND_I1:
+                INTERP_CASE(INTOP_STIND_I1)
                     STIND(int32_t, int8_t);
-                    break;
-                case INTOP_STIND_U1:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_U1)
                     STIND(int32_t, uint8_t);
-                    break;
-                case INTOP_STIND_I2:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_I2)
                     STIND(int32_t, int16_t);
-                    break;
-                case INTOP_STIND_U2:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_U2)
                     STIND(int32_t, uint16_t);
-                    break;
-                case INTOP_STIND_I4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_I4)
                     STIND(int32_t, int32_t);
-                    break;
-                case INTOP_STIND_I8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_I8)
                     STIND(int64_t, int64_t);
-                    break;
-                case INTOP_STIND_R4:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_R4)
                     STIND(float, float);
-                    break;
-                case INTOP_STIND_R8:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_R8)
                     STIND(double, double);
-                    break;
-                case INTOP_STIND_O:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_STIND_O)
                 {
                     char *dst = LOCAL_VAR(ip[1], char*);
                     OBJECTREF storeObj = LOCAL_VAR(ip[2], OBJECTREF);
                     NULL_CHECK(dst);
                     SetObjectReferenceUnchecked((OBJECTREF*)(dst + ip[3]), storeObj);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STIND_VT_NOREF:
+                INTERP_CASE(INTOP_STIND_VT_NOREF)
                 {
                     char *dest = LOCAL_VAR(ip[1], char*);
                     NULL_CHECK(dest);
                     memcpyNoGCRefs(dest + ip[3], stack + ip[2], ip[4]);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STIND_VT:
+                INTERP_CASE(INTOP_STIND_VT)
                 {
                     MethodTable *pMT = (MethodTable*)pMethod->pDataItems[ip[4]];
                     char *dest = LOCAL_VAR(ip[1], char*);
                     NULL_CHECK(dest);
                     CopyValueClassUnchecked(dest + ip[3], stack + ip[2], pMT);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDFLDA:
+                INTERP_CASE(INTOP_LDFLDA)
                 {
                     char *src = LOCAL_VAR(ip[2], char*);
                     NULL_CHECK(src);
                     LOCAL_VAR(ip[1], char*) = src + ip[3];
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_P:
+                INTERP_CASE(INTOP_CALL_HELPER_P_P)
                 {
                     HELPER_FTN_P_P helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_P>(pMethod->pDataItems[ip[2]]);
                     void* helperArg = pMethod->pDataItems[ip[3]];
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_S:
+                INTERP_CASE(INTOP_CALL_HELPER_P_S)
                 {
                     HELPER_FTN_P_P helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_P>(pMethod->pDataItems[ip[2]]);
                     void* helperArg = LOCAL_VAR(ip[3], void*);
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_PS:
+                INTERP_CASE(INTOP_CALL_HELPER_P_PS)
                 {
                     HELPER_FTN_P_PP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_PP>(pMethod->pDataItems[ip[3]]);
                     void* helperArg = pMethod->pDataItems[ip[4]];
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg, LOCAL_VAR(ip[2], void*));
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_SP:
+                INTERP_CASE(INTOP_CALL_HELPER_P_SP)
                 {
                     HELPER_FTN_P_PP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_PP>(pMethod->pDataItems[ip[3]]);
                     void* helperArg = pMethod->pDataItems[ip[4]];
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(LOCAL_VAR(ip[2], void*), helperArg);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_G:
+                INTERP_CASE(INTOP_CALL_HELPER_P_G)
                 {
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[4]];
                     void* helperArg = DoGenericLookup(LOCAL_VAR(ip[2], void*), pLookup);
@@ -1632,10 +1813,10 @@ MAIN_LOOP:
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_GS:
+                INTERP_CASE(INTOP_CALL_HELPER_P_GS)
                 {
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[5]];
                     void* helperArg = DoGenericLookup(LOCAL_VAR(ip[2], void*), pLookup);
@@ -1644,10 +1825,10 @@ MAIN_LOOP:
 
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg, LOCAL_VAR(ip[3], void*));
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_GA:
+                INTERP_CASE(INTOP_CALL_HELPER_P_GA)
                 {
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[5]];
                     void* helperArg = DoGenericLookup(LOCAL_VAR(ip[2], void*), pLookup);
@@ -1655,19 +1836,19 @@ MAIN_LOOP:
                     HELPER_FTN_P_PP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_PP>(pMethod->pDataItems[ip[4]]);
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg, LOCAL_VAR_ADDR(ip[3], void*));
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_P_PA:
+                INTERP_CASE(INTOP_CALL_HELPER_P_PA)
                 {
                     HELPER_FTN_P_PP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_P_PP>(pMethod->pDataItems[ip[3]]);
                     void* helperArg = pMethod->pDataItems[ip[4]];
                     LOCAL_VAR(ip[1], void*) = helperFtn(helperArg, LOCAL_VAR_ADDR(ip[2], void*));
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_V_AGS:
+                INTERP_CASE(INTOP_CALL_HELPER_V_AGS)
                 {
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[5]];
                     void* helperArg = DoGenericLookup(LOCAL_VAR(ip[2], void*), pLookup);
@@ -1675,19 +1856,19 @@ MAIN_LOOP:
                     HELPER_FTN_V_PPP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_V_PPP>(pMethod->pDataItems[ip[4]]);
                     helperFtn(LOCAL_VAR_ADDR(ip[1], void*), helperArg, LOCAL_VAR(ip[3], void*));
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_HELPER_V_APS:
+                INTERP_CASE(INTOP_CALL_HELPER_V_APS)
                 {
                     HELPER_FTN_V_PPP helperFtn = GetPossiblyIndirectHelper<HELPER_FTN_V_PPP>(pMethod->pDataItems[ip[3]]);
                     void* helperArg = pMethod->pDataItems[ip[4]];
                     helperFtn(LOCAL_VAR_ADDR(ip[1], void*), helperArg, LOCAL_VAR(ip[2], void*));
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALLVIRT:
+                INTERP_CASE(INTOP_CALLVIRT)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1706,7 +1887,7 @@ MAIN_LOOP:
                     goto CALL_INTERP_METHOD;
                 }
 
-                case INTOP_CALLI:
+                INTERP_CASE(INTOP_CALLI)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1717,10 +1898,10 @@ MAIN_LOOP:
                     ip += 5;
 
                     InvokeCalliStub(LOCAL_VAR(calliFunctionPointerVar, PCODE), pCallStub, stack + callArgsOffset, stack + returnOffset);
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL:
+                INTERP_CASE(INTOP_CALL)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1743,8 +1924,9 @@ CALL_INTERP_METHOD:
                             // small subset of frames high.
                             pInterpreterFrame->SetTopInterpMethodContextFrame(pFrame);
                             GCX_PREEMP();
-                            // Attempt to setup the interpreter code for the target method.
-                            if (targetMethod->IsIL() || targetMethod->IsNoMetadata())
+                            // Attempt to setup the interpreter code for the target method, unless it already has
+                            // code, for instance when it was promoted from interpreted code to a JIT-compiled tier.
+                            if ((targetMethod->IsIL() || targetMethod->IsNoMetadata()) && targetMethod->IsPointingToPrestub())
                             {
                                 targetMethod->PrepareInitialCode(CallerGCMode::Coop);
                             }
@@ -1781,9 +1963,9 @@ CALL_INTERP_METHOD:
                     stack = pFrame->pStack;
                     ip = pFrame->startIp->GetByteCodes();
                     pThreadContext->pStackPointer = stack + pMethod->allocaSize;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_NEWOBJ_GENERIC:
+                INTERP_CASE(INTOP_NEWOBJ_GENERIC)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1801,7 +1983,7 @@ CALL_INTERP_METHOD:
 
                     goto CALL_INTERP_SLOT;
                 }
-                case INTOP_NEWOBJ:
+                INTERP_CASE(INTOP_NEWOBJ)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1817,22 +1999,22 @@ CALL_INTERP_METHOD:
 
                     goto CALL_INTERP_SLOT;
                 }
-                case INTOP_NEWMDARR:
+                INTERP_CASE(INTOP_NEWMDARR)
                 {
                     LOCAL_VAR(ip[1], OBJECTREF) = CreateMultiDimArray((MethodTable*)pMethod->pDataItems[ip[3]], stack, ip[2], ip[4]);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_NEWMDARR_GENERIC:
+                INTERP_CASE(INTOP_NEWMDARR_GENERIC)
                 {
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[4]];
                     MethodTable *pMTArray = (MethodTable*)DoGenericLookup(LOCAL_VAR(ip[3], void*), pLookup);
 
                     LOCAL_VAR(ip[1], OBJECTREF) = CreateMultiDimArray(pMTArray, stack, ip[2], ip[5]);
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_NEWOBJ_VT:
+                INTERP_CASE(INTOP_NEWOBJ_VT)
                 {
                     returnOffset = ip[1];
                     callArgsOffset = ip[2];
@@ -1849,11 +2031,11 @@ CALL_INTERP_METHOD:
                     ip += 5;
                     goto CALL_INTERP_SLOT;
                 }
-                case INTOP_ZEROBLK_IMM:
+                INTERP_CASE(INTOP_ZEROBLK_IMM)
                     memset(LOCAL_VAR(ip[1], void*), 0, ip[2]);
                     ip += 3;
-                    break;
-                case INTOP_LOCALLOC:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_LOCALLOC)
                 {
                     size_t len = LOCAL_VAR(ip[2], size_t);
                     void* pMemory = NULL;
@@ -1873,9 +2055,9 @@ CALL_INTERP_METHOD:
 
                     LOCAL_VAR(ip[1], void*) = pMemory;
                     ip += 3;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_GC_COLLECT:
+                INTERP_CASE(INTOP_GC_COLLECT)
                 {
                     // HACK: blocking gc of all generations to enable early stackwalk testing
                     // Interpreter-TODO: Remove this
@@ -1885,9 +2067,9 @@ CALL_INTERP_METHOD:
                         GCHeapUtilities::GetGCHeap()->GarbageCollect(-1, false, collection_blocking | collection_aggressive);
                     }
                     ip++;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_THROW:
+                INTERP_CASE(INTOP_THROW)
                 {
                     OBJECTREF throwable;
                     if (LOCAL_VAR(ip[1], OBJECTREF) == nullptr)
@@ -1901,21 +2083,21 @@ CALL_INTERP_METHOD:
                     }
                     DispatchManagedException(throwable);
                     UNREACHABLE();
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_RETHROW:
+                INTERP_CASE(INTOP_RETHROW)
                 {
                     DispatchRethrownManagedException();
                     UNREACHABLE();
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LOAD_EXCEPTION:
+                INTERP_CASE(INTOP_LOAD_EXCEPTION)
                     // This opcode loads the exception object coming from a catch / filter funclet caller to a variable.
                     assert(pExceptionClauseArgs != NULL);
                     LOCAL_VAR(ip[1], OBJECTREF) = pExceptionClauseArgs->throwable;
                     ip += 2;
-                    break;
-                case INTOP_UNBOX_ANY:
+                    INTERP_BREAK;
+                INTERP_CASE(INTOP_UNBOX_ANY)
                 {
                     int opcode = *ip;
                     int dreg = ip[1];
@@ -1929,10 +2111,10 @@ CALL_INTERP_METHOD:
                     CopyValueClassUnchecked(LOCAL_VAR_ADDR(dreg, void), unboxedData, pMT);
 
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_UNBOX_ANY_GENERIC:
+                INTERP_CASE(INTOP_UNBOX_ANY_GENERIC)
                 {
                     int opcode = *ip;
                     int dreg = ip[1];
@@ -1948,9 +2130,9 @@ CALL_INTERP_METHOD:
                     CopyValueClassUnchecked(LOCAL_VAR_ADDR(dreg, void), unboxedData, pMTBoxedObj->IsNullable() ? pMTBoxedObj->GetInstantiation()[0].AsMethodTable() : pMTBoxedObj);
 
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_NEWARR:
+                INTERP_CASE(INTOP_NEWARR)
                 {
                     int32_t length = LOCAL_VAR(ip[2], int32_t);
                     if (length < 0)
@@ -1963,9 +2145,9 @@ CALL_INTERP_METHOD:
                     LOCAL_VAR(ip[1], OBJECTREF) = ObjectToOBJECTREF(arr);
 
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_NEWARR_GENERIC:
+                INTERP_CASE(INTOP_NEWARR_GENERIC)
                 {
                     int32_t length = LOCAL_VAR(ip[3], int32_t);
                     if (length < 0)
@@ -1980,7 +2162,7 @@ CALL_INTERP_METHOD:
                     LOCAL_VAR(ip[1], OBJECTREF) = ObjectToOBJECTREF(arr);
 
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
 #define LDELEM(dtype,etype)                                                    \
 do {                                                                           \
@@ -2000,47 +2182,47 @@ do {                                                                           \
     LOCAL_VAR(ip[1], dtype) = *pElem;                                          \
     ip += 4;                                                                   \
 } while (0)
-                case INTOP_LDELEM_I1:
+                INTERP_CASE(INTOP_LDELEM_I1)
                 {
                     LDELEM(int32_t, int8_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_U1:
+                INTERP_CASE(INTOP_LDELEM_U1)
                 {
                     LDELEM(int32_t, uint8_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_I2:
+                INTERP_CASE(INTOP_LDELEM_I2)
                 {
                     LDELEM(int32_t, int16_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_U2:
+                INTERP_CASE(INTOP_LDELEM_U2)
                 {
                     LDELEM(int32_t, uint16_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_I4:
+                INTERP_CASE(INTOP_LDELEM_I4)
                 {
                     LDELEM(int32_t, int32_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_I8:
+                INTERP_CASE(INTOP_LDELEM_I8)
                 {
                     LDELEM(int64_t, int64_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_R4:
+                INTERP_CASE(INTOP_LDELEM_R4)
                 {
                     LDELEM(float, float);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_R8:
+                INTERP_CASE(INTOP_LDELEM_R8)
                 {
                     LDELEM(double, double);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_REF:
+                INTERP_CASE(INTOP_LDELEM_REF)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[2], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2056,9 +2238,9 @@ do {                                                                           \
                     OBJECTREF elemRef = *(OBJECTREF*)(pData + idx * sizeof(OBJECTREF));
                     LOCAL_VAR(ip[1], OBJECTREF) = elemRef;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEM_VT:
+                INTERP_CASE(INTOP_LDELEM_VT)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[2], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2076,7 +2258,7 @@ do {                                                                           \
                     MethodTable* pElemMT = arr->GetArrayElementTypeHandle().AsMethodTable();
                     CopyValueClassUnchecked(stack + ip[1], elemAddr, pElemMT);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
 #define STELEM(dtype,etype)                                                    \
 do {                                                                           \
@@ -2096,37 +2278,37 @@ do {                                                                           \
     *pElem = (etype)LOCAL_VAR(ip[3], dtype);                                   \
     ip += 4;                                                                   \
 } while (0)
-                case INTOP_STELEM_I1:
+                INTERP_CASE(INTOP_STELEM_I1)
                 {
                     STELEM(int32_t, int8_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_I2:
+                INTERP_CASE(INTOP_STELEM_I2)
                 {
                     STELEM(int32_t, int16_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_I4:
+                INTERP_CASE(INTOP_STELEM_I4)
                 {
                     STELEM(int32_t, int32_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_I8:
+                INTERP_CASE(INTOP_STELEM_I8)
                 {
                     STELEM(int64_t, int64_t);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_R4:
+                INTERP_CASE(INTOP_STELEM_R4)
                 {
                     STELEM(float, float);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_R8:
+                INTERP_CASE(INTOP_STELEM_R8)
                 {
                     STELEM(double, double);
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_REF:
+                INTERP_CASE(INTOP_STELEM_REF)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[1], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2155,9 +2337,9 @@ do {                                                                           \
                     uint8_t* pData = arr->GetDataPtr();
                     SetObjectReferenceUnchecked((OBJECTREF*)(pData + idx * sizeof(OBJECTREF)), elemRef);
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_VT:
+                INTERP_CASE(INTOP_STELEM_VT)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[1], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2176,9 +2358,9 @@ do {                                                                           \
 
                     CopyValueClassUnchecked(elemAddr, stack + ip[3], pMT);
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_STELEM_VT_NOREF:
+                INTERP_CASE(INTOP_STELEM_VT_NOREF)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[1], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2196,9 +2378,9 @@ do {                                                                           \
 
                     memcpyNoGCRefs(elemAddr, stack + ip[3], elemSize);
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEMA:
+                INTERP_CASE(INTOP_LDELEMA)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[2], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2215,9 +2397,9 @@ do {                                                                           \
                     void* elemAddr = pData + idx * elemSize;
                     LOCAL_VAR(ip[1], void*) = elemAddr;
                     ip += 5;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LDELEMA_REF:
+                INTERP_CASE(INTOP_LDELEMA_REF)
                 {
                     BASEARRAYREF arrayRef = LOCAL_VAR(ip[2], BASEARRAYREF);
                     if (arrayRef == NULL)
@@ -2242,20 +2424,20 @@ do {                                                                           \
 
                     LOCAL_VAR(ip[1], void*) = elemAddr;
                     ip += 6;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_GENERICLOOKUP:
+                INTERP_CASE(INTOP_GENERICLOOKUP)
                 {
                     int dreg = ip[1];
                     InterpGenericLookup *pLookup = (InterpGenericLookup*)&pMethod->pDataItems[ip[3]];
                     void* result = DoGenericLookup(LOCAL_VAR(ip[2], void*), pLookup);
                     LOCAL_VAR(dreg, void*) = result;
                     ip += 4;
-                    break;
+                    INTERP_BREAK;
                 }
 
-                case INTOP_CALL_FINALLY:
+                INTERP_CASE(INTOP_CALL_FINALLY)
                 {
                     const int32_t* targetIp = ip + ip[1];
                     // Save current execution state for when we return from called method
@@ -2278,18 +2460,28 @@ do {                                                                           \
 
                     // Set execution state for the new frame
                     ip = targetIp;
-                    break;
+                    INTERP_BREAK;
                 }
-                case INTOP_LEAVE_FILTER:
+                INTERP_CASE(INTOP_LEAVE_FILTER)
                     *(int64_t*)pFrame->pRetVal = LOCAL_VAR(ip[1], int32_t);
                     goto EXIT_FRAME;
-                case INTOP_LEAVE_CATCH:
+                INTERP_CASE(INTOP_LEAVE_CATCH)
                     *(const int32_t**)pFrame->pRetVal = ip + ip[1];
                     goto EXIT_FRAME;
-                case INTOP_FAILFAST:
+                INTERP_CASE(INTOP_FAILFAST)
                     assert(0);
-                    break;
+                    INTERP_BREAK;
                 default:
+                // Opcodes that the interpreter loop doesn't handle still need a dispatch target
+                INTERP_LABEL(INTOP_NOP)
+                INTERP_LABEL(INTOP_DEF)
+                INTERP_LABEL(INTOP_MOV_SRC_OFF)
+                INTERP_LABEL(INTOP_LDIND_O)
+                INTERP_LABEL(INTOP_STELEM_U1)
+                INTERP_LABEL(INTOP_STELEM_U2)
+#ifndef DEBUG
+                INTERP_LABEL(INTOP_BREAKPOINT)
+#endif
                     assert(0);
                     break;
             }
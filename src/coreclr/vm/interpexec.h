@@ -8,7 +8,10 @@
 #include "interpframeallocator.h"
 
 #define INTERP_STACK_SIZE 1024*1024
-#define INTERP_STACK_FRAGMENT_SIZE 4096
+// Size of the region reserved per thread for the localloc memory of interpreter frames and the granularity
+// in which it is committed
+#define INTERP_FRAME_DATA_RESERVE_SIZE (16*1024*1024)
+#define INTERP_FRAME_DATA_COMMIT_SIZE (64*1024)
 
 struct StackVal
 {
@@ -81,4 +84,8 @@ void InterpExecMethod(InterpreterFrame *pInterpreterFrame, InterpMethodContextFr
 
 CallStubHeader *CreateNativeToInterpreterCallStub(InterpMethod* pInterpMethod);
 
+#ifdef INTERP_OPCODE_STATS
+void InterpDumpOpcodeStats();
+#endif // INTERP_OPCODE_STATS
+
 #endif
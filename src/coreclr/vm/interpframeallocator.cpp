@@ -6,143 +6,91 @@
 #include "interpexec.h"
 #include "interpframeallocator.h"
 
-FrameDataAllocator::FrameDataFragment::FrameDataFragment(size_t size)
+FrameDataAllocator::FrameDataAllocator()
 {
-    // Amortize allocation cost by allocating a larger chunk of memory
-    if (size < INTERP_STACK_FRAGMENT_SIZE)
-    {
-        size = INTERP_STACK_FRAGMENT_SIZE;
-    }
+    pFrameStart = pFrameCommitEnd = pFrameEnd = pFramePos = nullptr;
+    pTopInfo = nullptr;
+}
 
-    pFrameStart = (uint8_t*)malloc(size);
+FrameDataAllocator::~FrameDataAllocator()
+{
     if (pFrameStart != nullptr)
     {
-        pFrameEnd = pFrameStart + size;
-        pFramePos = pFrameStart;
+        assert(pTopInfo == nullptr && pFramePos == pFrameStart);
+        ClrVirtualFree(pFrameStart, 0, MEM_RELEASE);
     }
-    pNext = nullptr;
 }
 
-FrameDataAllocator::FrameDataFragment::~FrameDataFragment()
+// Make sure that size bytes starting at the current position are committed. The region is reserved on the first use.
+bool FrameDataAllocator::EnsureCommitted(size_t size)
 {
-    free(pFrameStart);
-}
+    if (pFrameStart == nullptr)
+    {
+        pFrameStart = (uint8_t*)ClrVirtualAlloc(nullptr, INTERP_FRAME_DATA_RESERVE_SIZE, MEM_RESERVE, PAGE_NOACCESS);
+        if (pFrameStart == nullptr)
+        {
+            return false;
+        }
+        pFrameCommitEnd = pFramePos = pFrameStart;
+        pFrameEnd = pFrameStart + INTERP_FRAME_DATA_RESERVE_SIZE;
+    }
 
-FrameDataAllocator::FrameDataAllocator()
-{
-    pFirst = pCurrent = nullptr;
-    pInfos = nullptr;
-    infosLen = 0;
-    infosCapacity = 0;
-}
+    if (size > (size_t)(pFrameEnd - pFramePos))
+    {
+        return false;
+    }
 
-FrameDataAllocator::~FrameDataAllocator()
-{
-    if (pFirst != nullptr)
+    if (size <= (size_t)(pFrameCommitEnd - pFramePos))
     {
-        assert(pCurrent == pFirst && pCurrent->pFramePos == pCurrent->pFrameStart);
-        FreeFragments(pFirst);
-        free(pInfos);
+        return true;
     }
-}
 
-void FrameDataAllocator::FreeFragments(FrameDataFragment *pFrag)
-{
-    while (pFrag)
+    size_t commitSize = ALIGN_UP((size_t)(pFramePos + size - pFrameCommitEnd), INTERP_FRAME_DATA_COMMIT_SIZE);
+    if (commitSize > (size_t)(pFrameEnd - pFrameCommitEnd))
     {
-        FrameDataFragment *pNext = pFrag->pNext;
-        delete pFrag;
-        pFrag = pNext;
+        commitSize = pFrameEnd - pFrameCommitEnd;
     }
-}
 
-bool FrameDataAllocator::PushInfo(InterpMethodContextFrame *pFrame)
-{
-    if (infosLen == infosCapacity)
+    if (ClrVirtualAlloc(pFrameCommitEnd, commitSize, MEM_COMMIT, PAGE_READWRITE) == nullptr)
     {
-        size_t newCapacity = infosCapacity == 0 ? 8 : infosCapacity * 2;
-        if (newCapacity > SIZE_MAX / sizeof(FrameDataInfo))
-        {
-            return false;
-        }
-        FrameDataInfo* newInfos = (FrameDataInfo*)realloc(pInfos, newCapacity * sizeof(FrameDataInfo));
-        if (newInfos == nullptr)
-        {
-            return false;
-        }
-        pInfos = newInfos;
-        infosCapacity = newCapacity;
+        return false;
     }
 
-    FrameDataInfo *pInfo = &pInfos[infosLen++];
-    pInfo->pFrame = pFrame;
-    pInfo->pFrag = pCurrent;
-    pInfo->pFramePos = pCurrent->pFramePos;
+    pFrameCommitEnd += commitSize;
     return true;
 }
 
 void *FrameDataAllocator::Alloc(InterpMethodContextFrame *pFrame, size_t size)
 {
-    size = ALIGN_UP(size, sizeof(void*));
-
-    if (pFirst == nullptr)
+    if (size > INTERP_FRAME_DATA_RESERVE_SIZE)
     {
-        pFirst = new (nothrow) FrameDataFragment(size);
-        if (pFirst == nullptr || pFirst->pFrameStart == nullptr)
-        {
-            return nullptr;
-        }
-        pCurrent = pFirst;
+        return nullptr;
     }
+    size = ALIGN_UP(size, sizeof(void*));
 
-    if (!infosLen || pInfos[infosLen - 1].pFrame != pFrame)
+    bool pushInfo = pTopInfo == nullptr || pTopInfo->pFrame != pFrame;
+    size_t allocSize = size + (pushInfo ? sizeof(FrameDataInfo) : 0);
+
+    if ((size_t)(pFrameCommitEnd - pFramePos) < allocSize)
     {
-        if (!PushInfo(pFrame))
+        if (!EnsureCommitted(allocSize))
         {
             return nullptr;
         }
     }
 
-    uint8_t *pFramePos = pCurrent->pFramePos;
-
-    if (pFramePos + size > pCurrent->pFrameEnd)
+    if (pushInfo)
     {
-        // Move to the next fragment or create a new one if necessary
-        if (pCurrent->pNext && ((pCurrent->pNext->pFrameStart + size) <= pCurrent->pNext->pFrameEnd))
-        {
-            pCurrent = pCurrent->pNext;
-            pFramePos = pCurrent->pFramePos = pCurrent->pFrameStart;
-        }
-        else
-        {
-            FreeFragments(pCurrent->pNext);
-            pCurrent->pNext = nullptr;
-
-            FrameDataFragment *pNewFrag = new (nothrow) FrameDataFragment(size);
-            if (pNewFrag == nullptr || pNewFrag->pFrameStart == nullptr)
-            {
-                return nullptr;
-            }
-
-            pCurrent->pNext = pNewFrag;
-            pCurrent = pNewFrag;
-            pFramePos = pNewFrag->pFramePos;
-        }
+        FrameDataInfo *pInfo = (FrameDataInfo*)pFramePos;
+        pInfo->pFrame = pFrame;
+        pInfo->pPrev = pTopInfo;
+        pTopInfo = pInfo;
+        pFramePos += sizeof(FrameDataInfo);
     }
 
     void *pMemory = (void*)pFramePos;
-    pCurrent->pFramePos = (uint8_t*)(pCurrent->pFramePos + size);
+    pFramePos += size;
     return pMemory;
 }
 
-void FrameDataAllocator::PopInfo(InterpMethodContextFrame *pFrame)
-{
-    if (infosLen > 0 && pInfos[infosLen - 1].pFrame == pFrame)
-    {
-        FrameDataInfo *pInfo = &pInfos[--infosLen];
-        pCurrent = pInfo->pFrag;
-        pCurrent->pFramePos = pInfo->pFramePos;
-    }
-}
-
 #endif // FEATURE_INTERPRETER
@@ -6,52 +6,50 @@
 
 struct InterpMethodContextFrame;
 
+// Allocator for the frame data (localloc memory) of interpreter frames. The memory is a single contiguous region reserved
+// per thread and committed on demand in INTERP_FRAME_DATA_COMMIT_SIZE chunks, so allocating is a pointer bump and
+// releasing the data of a frame on return resets the pointer.
 class FrameDataAllocator
 {
 private:
-    struct FrameDataFragment
-    {
-        // The start of the fragment
-        uint8_t *pFrameStart;
-        // The end of the fragment
-        uint8_t *pFrameEnd;
-        // The current position in the fragment
-        uint8_t *pFramePos;
-        // The next fragment in the list
-        FrameDataFragment *pNext;
-
-        FrameDataFragment(size_t size);
-        ~FrameDataFragment();
-    };
-
+    // Header placed in front of the data of each frame that allocates
     struct FrameDataInfo
     {
         // The frame that this data belongs to
         InterpMethodContextFrame *pFrame;
-        // Pointers for restoring the localloc memory:
-        // pFrag - the current allocation fragment at frame entry
-        // pos - the fragment pointer at frame entry
-        // When the frame returns, we use these to roll back any local allocations
-        FrameDataFragment *pFrag;
-        uint8_t *pFramePos;
-
-        FrameDataInfo(InterpMethodContextFrame *pFrame, FrameDataFragment *pFrag, uint8_t *pFramePos);
+        // The info of the previous frame that allocated data
+        FrameDataInfo *pPrev;
     };
 
-    FrameDataFragment *pFirst;
-    FrameDataFragment *pCurrent;
-    FrameDataInfo *pInfos;
-    size_t infosLen;
-    size_t infosCapacity;
-
-    bool PushInfo(InterpMethodContextFrame *pFrame);
-    void FreeFragments(FrameDataFragment *pFrag);
+    // The start of the reserved region
+    uint8_t *pFrameStart;
+    // The end of the committed part of the region
+    uint8_t *pFrameCommitEnd;
+    // The end of the reserved region
+    uint8_t *pFrameEnd;
+    // The current position in the region
+    uint8_t *pFramePos;
+    // The info of the most recent frame that allocated data
+    FrameDataInfo *pTopInfo;
+
+    bool EnsureCommitted(size_t size);
 public:
     FrameDataAllocator();
     ~FrameDataAllocator();
 
     void *Alloc(InterpMethodContextFrame *pFrame, size_t size);
-    void PopInfo(InterpMethodContextFrame *pFrame);
+
+    // Release the data allocated by the frame, called on every frame exit
+    void PopInfo(InterpMethodContextFrame *pFrame)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (pTopInfo != nullptr && pTopInfo->pFrame == pFrame)
+        {
+            pFramePos = (uint8_t*)pTopInfo;
+            pTopInfo = pTopInfo->pPrev;
+        }
+    }
 };
 
 #endif
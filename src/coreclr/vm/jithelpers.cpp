@@ -1317,11 +1317,44 @@ static PCODE JitPatchpointWorker(MethodDesc* pMD, const EECodeInfo& codeInfo, in
 
     // Set up a new native code version for the OSR variant of this method.
     NativeCodeVersion osrNativeCodeVersion;
+    bool createTieringBackgroundWorker = false;
     {
         CodeVersionManager::LockHolder codeVersioningLockHolder;
 
         NativeCodeVersion currentNativeCodeVersion = codeInfo.GetNativeCodeVersion();
         ILCodeVersion ilCodeVersion = currentNativeCodeVersion.GetILCodeVersion();
+
+        // OSR variants are specific to their patchpoint, so a method whose loops get hot at several
+        // patchpoints (or that keeps being called with long-running loops) produces one OSR variant
+        // per patchpoint while its tier 0 entry point waits on call counting. Once the method has
+        // enough OSR variants, promote it to tier 1 so that subsequent calls enter optimized code
+        // directly and no further variants are needed.
+        DWORD promotionThreshold = g_pConfig->OSR_Tier1PromotionThreshold();
+        if (promotionThreshold != 0 &&
+            pMD->IsEligibleForTieredCompilation() &&
+            !ilCodeVersion.IsDeoptimized() &&
+            !currentNativeCodeVersion.IsFinalTier() &&
+            !ilCodeVersion.HasAnyOptimizedNativeCodeVersion(currentNativeCodeVersion) &&
+            ilCodeVersion.GetOsrNativeCodeVersionCount(pMD) >= promotionThreshold)
+        {
+            EX_TRY
+            {
+                GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteToTier1(
+                    currentNativeCodeVersion,
+                    false,
+                    &createTieringBackgroundWorker);
+
+                LOG((LF_TIEREDCOMPILATION, LL_INFO10, "JitPatchpointWorker: promoting Method=0x%pM (%s::%s) to tier 1\n",
+                    pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName));
+            }
+            EX_CATCH
+            {
+                // Not fatal, call counting will promote the method later
+                STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "JitPatchpointWorker: failed to promote Method=0x%pM to tier 1\n", pMD);
+            }
+            EX_END_CATCH(RethrowTerminalExceptions);
+        }
+
         HRESULT hr = ilCodeVersion.AddNativeCodeVersion(pMD, NativeCodeVersion::OptimizationTier1OSR, &osrNativeCodeVersion, patchpointInfo, ilOffset);
         if (FAILED(hr))
         {
@@ -1331,6 +1364,11 @@ static PCODE JitPatchpointWorker(MethodDesc* pMD, const EECodeInfo& codeInfo, in
         }
     }
 
+    if (createTieringBackgroundWorker)
+    {
+        TieredCompilationManager::CreateBackgroundWorker(); // requires GC_TRIGGERS
+    }
+
     // Invoke the jit to compile the OSR version
     LOG((LF_TIEREDCOMPILATION, LL_INFO10, "JitPatchpointWorker: creating OSR version of Method=0x%pM (%s::%s) at offset %d\n",
         pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset));
@@ -1324,13 +1324,19 @@ uint32_t CEEInfo::getThreadLocalFieldInfo (CORINFO_FIELD_HANDLE  field, bool isG
     MethodTable *pMT = fieldDesc->GetEnclosingMethodTable();
     pMT->EnsureTlsIndexAllocated();
 
-    if (isGCType)
+    ThreadStaticsInfo* pThreadStaticsInfo = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData());
+    TLSIndex tlsIndex = isGCType ? pThreadStaticsInfo->GCTlsIndex : pThreadStaticsInfo->NonGCTlsIndex;
+
+    if (tlsIndex.GetTLSIndexType() == TLSIndexType::Collectible)
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->GCTlsIndex.GetIndexOffset();
+        // Collectible thread statics live in a separate array of handles. Hand the raw index to the JIT so
+        // that both the inline expansion and the helper fallback can tell the two arrays apart.
+        static_assert_no_msg(CORINFO_THREAD_STATIC_INDEX_COLLECTIBLE == ((uint32_t)TLSIndexType::Collectible << 24));
+        typeIndex = tlsIndex.TLSIndexRawIndex;
     }
     else
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->NonGCTlsIndex.GetIndexOffset();
+        typeIndex = tlsIndex.GetIndexOffset();
     }
 
     assert(typeIndex != TypeIDProvider::INVALID_TYPE_ID);
@@ -1442,10 +1448,11 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = intrinsicAccessor;
             }
             else
-            if (pFieldMT->Collectible())
+            if (pFieldMT->Collectible() && !pField->IsThreadStatic())
             {
                 // Static fields are not pinned in collectible types. We will always access
                 // them using a helper since the address cannot be embedded into the code.
+                // Thread statics never have an embeddable address, so they are handled below.
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
                 pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
@@ -5695,6 +5702,13 @@ CorInfoHelpFunc CEEInfo::getNewHelperStatic(MethodTable * pMT, bool * pHasSideEf
         _ASSERTE(helper == CORINFO_HELP_NEWFAST);
     }
     else
+    // Pretenured types are placed by AllocateObject
+    if (ee_alloc_context::s_pretenuringEnabled && pMT->GetAuxiliaryData()->IsPretenured())
+    {
+        // Use slow helper
+        _ASSERTE(helper == CORINFO_HELP_NEWFAST);
+    }
+    else
 #ifdef FEATURE_64BIT_ALIGNMENT
     if (pMT->RequiresAlign8())
     {
@@ -10233,6 +10247,14 @@ void CEEInfo::getEEInfo(CORINFO_EE_INFO *pEEInfoOut)
     pEEInfoOut->targetAbi = CORINFO_CORECLR_ABI;
     pEEInfoOut->osType = getClrVmOs();
 
+#ifdef PROFILING_SUPPORTED
+    pEEInfoOut->profilerEnterLeaveSamplingFlag = g_profControlBlock.fEnterLeaveSamplingEnabled
+        ? &g_profControlBlock.enterLeaveSamplingActive
+        : NULL;
+#else
+    pEEInfoOut->profilerEnterLeaveSamplingFlag = NULL;
+#endif // PROFILING_SUPPORTED
+
     EE_TO_JIT_TRANSITION();
 }
 
@@ -10731,6 +10753,7 @@ CEECodeGenInfo::CEECodeGenInfo(PrepareCodeConfig* config, MethodDesc* fd, COR_IL
     , m_numInlineTreeNodes(0)
     , m_richOffsetMappings(NULL)
     , m_numRichOffsetMappings(0)
+    , m_jitStatistics()
     , m_gphCache()
 {
     STANDARD_VM_CONTRACT;
@@ -11060,9 +11083,101 @@ void CEEJitInfo::WriteCode(EECodeGenManager * jitMgr)
     // Publish the new unwind information in a way that the ETW stack crawler can find
     _ASSERTE(m_usedUnwindInfos == m_totalUnwindInfos);
     UnwindInfoTable::PublishUnwindInfoForMethod(m_moduleBase, ((CodeHeader*)m_CodeHeader)->GetUnwindInfo(0), m_totalUnwindInfos);
+
+    if (m_identicalCodeSize != 0)
+    {
+        // Now that the code is published, methods compiled later with identical code may share it
+        ExecutionManager::GetEEJitManager()->AddIdenticalCode(GetIdenticalCodeEntry(0));
+    }
 #endif // defined(TARGET_AMD64)
 }
 
+#ifdef TARGET_AMD64
+IdenticalCodeEntry CEEJitInfo::GetIdenticalCodeEntry(size_t writeableOffset)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_identicalCodeSize != 0);
+
+    IdenticalCodeEntry entry;
+    entry.m_hash = m_identicalCodeHash;
+    entry.m_pCode = (BYTE *)((CodeHeader*)m_CodeHeader)->GetCodeStartAddress() + writeableOffset;
+    entry.m_codeSize = m_identicalCodeSize;
+    entry.m_pUnwindBlock = m_theUnwindBlock + writeableOffset;
+    entry.m_unwindSize = m_usedUnwindSize;
+    entry.m_pGCInfo = ((CodeHeader*)m_CodeHeaderRW)->GetGCInfo();
+    entry.m_GCInfoSize = m_GCinfo_len;
+    entry.m_pModule = m_pMethodBeingCompiled->GetModule();
+    return entry;
+}
+
+// Identical code folding: tier 1 code of methods such as instantiations over different value types of the same
+// size is often byte for byte identical, in which case the method can share the body of the method that was
+// jitted first and the new body is backed out. On this platform the only references from jitted code to
+// locations outside of the method body that are not absolute constants go through recordRelocation, so a body
+// without relocations executes the same way at any address.
+//
+// The code header of the shared body identifies the method that owns it, so frames of the other methods are
+// reported as that method in stack traces, to profilers and to the debugger. Methods whose identity matters beyond
+// that are not folded: generic code shared by instantiations reads the generic context using the method in the
+// code header, and methods whose entry point is not a precode could have their code address mapped back to the
+// owning method, for instance when creating a delegate. Bodies are only shared within a module, so that the
+// calling assembly found by a stack walk does not change.
+PCODE CEEJitInfo::FindIdenticalCode(uint32_t codeSize)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    _ASSERTE(m_identicalCodeSize == 0);
+
+    if (!g_pConfig->TieredCompilation_FoldIdenticalCode())
+        return (PCODE)NULL;
+
+    MethodDesc* pMD = m_pMethodBeingCompiled;
+    if (m_fHasRelocs ||
+        m_fJumpStubOverflow ||
+        m_EHinfo_len != 0 ||
+        m_totalUnwindInfos != 1 ||
+        codeSize == 0 ||
+        !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1) ||
+        m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR) ||
+        m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_OSR) ||
+        CORDebuggerAttached() ||
+        pMD->IsDynamicMethod() ||
+        pMD->IsSharedByGenericInstantiations() ||
+        !pMD->IsVersionableWithPrecode() ||
+        pMD->GetLoaderAllocator()->IsCollectible())
+    {
+        return (PCODE)NULL;
+    }
+
+    size_t writeableOffset = (BYTE *)m_CodeHeaderRW - (BYTE *)m_CodeHeader;
+    BYTE* pCode = (BYTE *)((CodeHeader*)m_CodeHeader)->GetCodeStartAddress() + writeableOffset;
+    BYTE* pGCInfo = ((CodeHeader*)m_CodeHeaderRW)->GetGCInfo();
+
+    DWORD hash = HashBytes(pCode, codeSize);
+    hash = ((hash << 5) + hash) ^ HashBytes(m_theUnwindBlock + writeableOffset, m_usedUnwindSize);
+    hash = ((hash << 5) + hash) ^ HashBytes(pGCInfo, m_GCinfo_len);
+
+    m_identicalCodeHash = hash;
+    m_identicalCodeSize = codeSize;
+
+    PCODE identicalCode = ExecutionManager::GetEEJitManager()->FindIdenticalCode(GetIdenticalCodeEntry(writeableOffset));
+    if (identicalCode != (PCODE)NULL)
+    {
+        // The body is backed out, so it must not be recorded by WriteCode
+        m_identicalCodeSize = 0;
+
+        LOG((LF_JIT, LL_INFO1000, "Method %s::%s shares the identical code at" FMT_ADDR "\n",
+            pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, DBG_ADDR(identicalCode)));
+    }
+
+    return identicalCode;
+}
+#endif // TARGET_AMD64
+
 /*********************************************************************/
 // Route jit information to the Jit Debug store.
 void CEECodeGenInfo::setBoundaries(CORINFO_METHOD_HANDLE ftn, uint32_t cMap,
@@ -11145,9 +11260,50 @@ void CEECodeGenInfo::reportMetadata(
 
     JIT_TO_EE_TRANSITION_LEAF();
 
+    // Keep the values that are surfaced through the MethodJitStatistics event, ignore everything else.
+    if (length == sizeof(int))
+    {
+        uint32_t* pStatistic = NULL;
+        if (strcmp(key, "InlineCount") == 0)
+            pStatistic = &m_jitStatistics.InlineCount;
+        else if (strcmp(key, "FrontEndMicroseconds") == 0)
+            pStatistic = &m_jitStatistics.FrontEndMicroseconds;
+        else if (strcmp(key, "OptimizerMicroseconds") == 0)
+            pStatistic = &m_jitStatistics.OptimizerMicroseconds;
+        else if (strcmp(key, "BackEndMicroseconds") == 0)
+            pStatistic = &m_jitStatistics.BackEndMicroseconds;
+
+        if (pStatistic != NULL)
+        {
+            int statistic;
+            memcpy(&statistic, value, sizeof(int));
+            *pStatistic = (uint32_t)statistic;
+        }
+    }
+
     EE_TO_JIT_TRANSITION_LEAF();
 }
 
+void CEECodeGenInfo::FireJitStatisticsEvent(PrepareCodeConfig* config)
+{
+    STANDARD_VM_CONTRACT;
+
+    MethodDesc* ftn = m_pMethodBeingCompiled;
+
+    FireEtwMethodJitStatistics(
+        (ULONGLONG)ftn,
+        (ULONGLONG)(TADDR)ftn->GetModule(),
+        ftn->GetMemberDef(),
+        m_MethodInfo.ILCodeSize,
+        m_jitStatistics.CodeSize,
+        (UINT8)PrepareCodeConfig::GetJitOptimizationTier(config, ftn),
+        m_jitStatistics.InlineCount,
+        m_jitStatistics.FrontEndMicroseconds,
+        m_jitStatistics.OptimizerMicroseconds,
+        m_jitStatistics.BackEndMicroseconds,
+        GetClrInstanceId());
+}
+
 void CEEJitInfo::setPatchpointInfo(PatchpointInfo* patchpointInfo)
 {
     CONTRACTL {
@@ -11262,7 +11418,7 @@ void CInterpreterJitInfo::allocMem(AllocMemArgs *pArgs)
             pArgs->hotCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode<InterpreterCodeHeader>(m_pMethodBeingCompiled, totalSize.Value(), 0, pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    m_jitManager->allocCode<InterpreterCodeHeader>(m_pMethodBeingCompiled, totalSize.Value(), 0, pArgs->flag, false, false, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
                                                  , &m_pRealCodeHeader
 #ifdef FEATURE_EH_FUNCLETS
                                                  , 0
@@ -11708,6 +11864,10 @@ void CEEJitInfo::recordRelocation(void * location,
 #ifdef HOST_64BIT
     JIT_TO_EE_TRANSITION();
 
+#ifdef TARGET_AMD64
+    m_fHasRelocs = TRUE;
+#endif
+
     INT64 delta;
 
     switch (fRelocType)
@@ -12597,7 +12757,24 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode<CodeHeader>(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    m_jitStatistics.CodeSize = pArgs->hotCodeSize + pArgs->coldCodeSize;
+
+    bool isOptimizedCode = false;
+    bool isHotCode = false;
+#ifdef FEATURE_TIERED_COMPILATION
+    isOptimizedCode = g_pConfig->TieredCompilation_SeparateOptimizedCodeHeap() &&
+                      m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1) &&
+                      !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+    if (isOptimizedCode)
+    {
+        // The code version is marked hot by call counting when it was promoted, see CallCountingInfo::IsHotCode
+        PrepareCodeConfig *config = GetThread()->GetCurrentPrepareCodeConfig();
+        isHotCode = config != nullptr && config->GetCodeVersion().IsHotCode();
+    }
+#endif
+
+    m_jitManager->allocCode<CodeHeader>(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, isOptimizedCode, isHotCode,
+                                        &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
                                       , &m_pRealCodeHeader
 #ifdef FEATURE_EH_FUNCLETS
                                       , m_totalUnwindInfos
@@ -13134,16 +13311,26 @@ static TADDR UnsafeJitFunctionWorker(
 
     if (SUCCEEDED(res))
     {
-        pJitInfo->WriteCode(pJitMgr);
-#if defined(DEBUGGING_SUPPORTED)
-        //
-        // Notify the debugger that we have successfully jitted the function
-        //
-        if (g_pDebugInterface)
+        PCODE identicalCode = pJitInfo->FindIdenticalCode(sizeOfCode);
+        if (identicalCode != (PCODE)NULL)
         {
-            g_pDebugInterface->JITComplete(nativeCodeVersion, (TADDR)nativeEntry);
+            // The method shares an identical body that was already published, so the new one is released
+            pJitInfo->BackoutJitData(pJitMgr);
+            nativeEntry = (PBYTE)PCODEToPINSTR(identicalCode);
         }
+        else
+        {
+            pJitInfo->WriteCode(pJitMgr);
+#if defined(DEBUGGING_SUPPORTED)
+            //
+            // Notify the debugger that we have successfully jitted the function
+            //
+            if (g_pDebugInterface)
+            {
+                g_pDebugInterface->JITComplete(nativeCodeVersion, (TADDR)nativeEntry);
+            }
 #endif // DEBUGGING_SUPPORTED
+        }
     }
     else
     {
@@ -13352,8 +13539,19 @@ PCODE UnsafeJitFunction(PrepareCodeConfig* config,
         }
     }
 
+    bool useInterpreter = interpreterMgr->IsInterpreterLoaded();
+#if defined(FEATURE_TIERED_COMPILATION) && defined(FEATURE_JIT)
+    // When tiering up from the interpreter, it is only used for tier 0 code and the JIT compiles the other tiers
+    if (useInterpreter &&
+        g_pConfig->TieredCompilation_InterpreterTierUp() &&
+        nativeCodeVersion.GetOptimizationTier() != NativeCodeVersion::OptimizationTier0)
+    {
+        useInterpreter = false;
+    }
+#endif // FEATURE_TIERED_COMPILATION && FEATURE_JIT
+
     // If the interpreter was loaded, use it.
-    if (interpreterMgr->IsInterpreterLoaded())
+    if (useInterpreter)
     {
         CInterpreterJitInfo interpreterJitInfo{ config, ftn, ILHeader, interpreterMgr };
         ret = UnsafeJitFunctionWorker(interpreterMgr, &interpreterJitInfo, nativeCodeVersion, pSizeOfCode);
@@ -13433,6 +13631,11 @@ PCODE UnsafeJitFunction(PrepareCodeConfig* config,
             sizeOfILCode = jitInfo.getMethodInfoInternal()->ILCodeSize;
             *isTier0 = jitInfo.getJitFlagsInternal()->IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
 
+            if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitStatistics))
+            {
+                jitInfo.FireJitStatisticsEvent(config);
+            }
+
             // We are done
             break;
         }
@@ -14288,6 +14491,10 @@ BOOL LoadDynamicInfoEntry(Module *currentModule,
             {
                 if (kind == READYTORUN_FIXUP_Check_IL_Body || (!fail && currentModule->GetReadyToRunInfo()->IsForbidProcessMoreILBodyFixups()))
                 {
+                    // The cross-module inlinee has changed since the image was compiled (or can no longer be resolved).
+                    // The precompiled code that depends on it is rejected and the method is jitted instead.
+                    STRESS_LOG2(LF_ZAP, LL_INFO100, "CHECK_IL_BODY fixup failed in module %p for inlinee MethodDesc %p, "
+                        "precompiled code will not be used\n", currentModule, pMDCompare);
                     return FALSE;
                 }
                 else
@@ -15040,6 +15247,12 @@ void EECodeInfo::Init(PCODE codeAddress, ExecutionManager::ScanFlag scanFlag)
     m_hdrInfoTable = NULL;
 #endif
 
+#ifndef DACCESS_COMPILE
+    LONG generation = ExecutionManager::GetCodeLookupGeneration();
+    if (TryInitFromLookupCache(codeAddress, generation))
+        return;
+#endif // !DACCESS_COMPILE
+
     RangeSection * pRS = ExecutionManager::FindCodeRange(codeAddress, scanFlag);
     if (pRS == NULL)
         goto Invalid;
@@ -15048,6 +15261,10 @@ void EECodeInfo::Init(PCODE codeAddress, ExecutionManager::ScanFlag scanFlag)
         goto Invalid;
 
     m_pJM = pRS->_pjit;
+
+#ifndef DACCESS_COMPILE
+    AddToLookupCache(generation);
+#endif // !DACCESS_COMPILE
     return;
 
 Invalid:
@@ -15060,6 +15277,81 @@ Invalid:
 #endif
 }
 
+#ifndef DACCESS_COMPILE
+thread_local EECodeInfo::LookupCache EECodeInfo::t_lookupCache;
+
+bool EECodeInfo::TryInitFromLookupCache(PCODE codeAddress, LONG generation)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (codeAddress == (PCODE)NULL)
+        return false;
+
+    LookupCache& cache = t_lookupCache;
+    if (cache.generation != generation)
+    {
+        // Code was removed since the cache was last filled, none of the entries can be trusted.
+        for (DWORD i = 0; i < LOOKUP_CACHE_SIZE; i++)
+        {
+            VolatileStoreWithoutBarrier(&cache.entries[i].codeAddress, (PCODE)NULL);
+        }
+        cache.generation = generation;
+        return false;
+    }
+
+    LookupCacheEntry& entry = cache.entries[LookupCacheIndex(codeAddress)];
+    if (VolatileLoadWithoutBarrier(&entry.codeAddress) != codeAddress)
+        return false;
+
+    m_methodToken = METHODTOKEN(entry.pRangeSection, entry.pCodeHeader);
+    m_pMD = entry.pMD;
+    m_pJM = entry.pJM;
+    m_relOffset = entry.relOffset;
+#ifdef FEATURE_EH_FUNCLETS
+    m_isFuncletCache = entry.isFuncletCache;
+    m_pFunctionEntry = entry.pFunctionEntry;
+#endif // FEATURE_EH_FUNCLETS
+
+    // A lookup done from a signal handler on this thread (e.g. for a hijack) may have replaced
+    // the entry while it was being copied.
+    if (VolatileLoadWithoutBarrier(&entry.codeAddress) != codeAddress)
+    {
+        m_pJM = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+void EECodeInfo::AddToLookupCache(LONG generation)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(IsValid());
+
+    // Do not cache the result if code was removed while we were looking it up.
+    LookupCache& cache = t_lookupCache;
+    if (cache.generation != generation || ExecutionManager::GetCodeLookupGeneration() != generation)
+        return;
+
+    LookupCacheEntry& entry = cache.entries[LookupCacheIndex(m_codeAddress)];
+
+    // Invalidate the entry first so that a lookup done from a signal handler on this thread never
+    // observes a partially written entry.
+    VolatileStoreWithoutBarrier(&entry.codeAddress, (PCODE)NULL);
+    entry.pRangeSection = m_methodToken.m_pRangeSection;
+    entry.pCodeHeader = m_methodToken.m_pCodeHeader;
+    entry.pMD = m_pMD;
+    entry.pJM = m_pJM;
+    entry.relOffset = m_relOffset;
+#ifdef FEATURE_EH_FUNCLETS
+    entry.isFuncletCache = m_isFuncletCache;
+    entry.pFunctionEntry = m_pFunctionEntry;
+#endif // FEATURE_EH_FUNCLETS
+    VolatileStoreWithoutBarrier(&entry.codeAddress, m_codeAddress);
+}
+#endif // !DACCESS_COMPILE
+
 TADDR EECodeInfo::GetSavedMethodCode()
 {
     CONTRACTL {
@@ -476,6 +476,7 @@ class  InterpreterJitManager;
 class  EECodeGenManager;
 struct  HeapList;
 struct CodeHeader;
+struct IdenticalCodeEntry;
 
 class CEECodeGenInfo : public CEEInfo
 {
@@ -571,6 +572,14 @@ public:
 
     virtual void WriteCode(EECodeGenManager * jitMgr) = 0;
 
+    // Returns the entry point of a published method body that is identical to the one that was just
+    // generated, in which case the method uses it and the generated one is backed out
+    virtual PCODE FindIdenticalCode(uint32_t codeSize)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (PCODE)NULL;
+    }
+
     void getHelperFtn(CorInfoHelpFunc         tnNum,                     /* IN  */
                       CORINFO_CONST_LOOKUP *  pNativeEntrypoint,         /* OUT */
                       CORINFO_METHOD_HANDLE * pMethodHandle) override;   /* OUT */
@@ -584,6 +593,9 @@ public:
     CORINFO_METHOD_INFO* getMethodInfoInternal();
     CORJIT_FLAGS* getJitFlagsInternal();
 
+    // Fires the MethodJitStatistics event with the statistics the JIT reported through reportMetadata
+    void FireJitStatisticsEvent(PrepareCodeConfig* config);
+
 protected:
 
     template <typename TCodeHeader>
@@ -634,6 +646,16 @@ protected:
     ICorDebugInfo::RichOffsetMapping *m_richOffsetMappings;
     ULONG32                           m_numRichOffsetMappings;
 
+    // Per-method statistics for the MethodJitStatistics event
+    struct JitStatistics
+    {
+        uint32_t CodeSize;
+        uint32_t InlineCount;
+        uint32_t FrontEndMicroseconds;
+        uint32_t OptimizerMicroseconds;
+        uint32_t BackEndMicroseconds;
+    } m_jitStatistics;
+
     // The first time a call is made to CEEJitInfo::GetProfilingHandle() from this thread
     // for this method, these values are filled in.   Thereafter, these values are used
     // in lieu of calling into the base CEEInfo::GetProfilingHandle() again.  This protects the
@@ -671,6 +693,10 @@ public:
 
     void WriteCodeBytes();
     void WriteCode(EECodeGenManager * jitMgr) override;
+#ifdef TARGET_AMD64
+    PCODE FindIdenticalCode(uint32_t codeSize) override;
+    IdenticalCodeEntry GetIdenticalCodeEntry(size_t writeableOffset);
+#endif
 
     void reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unwindSize) override;
 
@@ -744,6 +770,12 @@ public:
         m_totalUnwindInfos = 0;
         m_usedUnwindInfos = 0;
 #endif // FEATURE_EH_FUNCLETS
+
+#ifdef TARGET_AMD64
+        m_fHasRelocs = FALSE;
+        m_identicalCodeHash = 0;
+        m_identicalCodeSize = 0;
+#endif
     }
 
 #ifdef TARGET_AMD64
@@ -833,7 +865,10 @@ public:
           m_usedUnwindInfos(0)
 #endif
 #ifdef TARGET_AMD64
-        , m_fAllowRel32(FALSE)
+        , m_fAllowRel32(FALSE),
+          m_fHasRelocs(FALSE),
+          m_identicalCodeHash(0),
+          m_identicalCodeSize(0)
 #endif
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64)
         , m_fJumpStubOverflow(FALSE),
@@ -929,6 +964,9 @@ protected :
 
 #ifdef TARGET_AMD64
     BOOL                    m_fAllowRel32;      // Use 32-bit PC relative address modes
+    BOOL                    m_fHasRelocs;       // The code references locations outside of the method body
+    DWORD                   m_identicalCodeHash; // Hash of the code, GC info and unwind info, valid if m_identicalCodeSize is not 0
+    uint32_t                m_identicalCodeSize; // Size of the code that other methods may share, 0 if it cannot be shared
 #endif
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64)
     BOOL                    m_fJumpStubOverflow;   // Overflow while trying to alocate jump stub slot within PC relative branch region
@@ -371,6 +371,8 @@ public:
 
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
+    void * m_pLastUsedOptimizedCodeHeap;
+    void * m_pLastUsedHotCodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
 #ifdef FEATURE_INTERPRETER
     void * m_pLastUsedInterpreterCodeHeap;
@@ -341,7 +341,7 @@ struct MethodTableAuxiliaryData
         enum_flag_StreamOverriddenRead      = 0x0800,
         enum_flag_StreamOverriddenWrite     = 0x1000,
         enum_flag_EnsuredInstanceActive     = 0x2000,
-        // unused enum                      = 0x4000,
+        enum_flag_Pretenured                = 0x4000,     // Sampled allocations of this type mostly survive, see code:RecordPretenuringSample
         // unused enum                      = 0x8000,
     };
     union
@@ -486,6 +486,20 @@ public:
     }
 #endif
 
+    inline BOOL IsPretenured() const
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return VolatileLoad(&m_dwFlags) & enum_flag_Pretenured;
+    }
+
+#ifndef DACCESS_COMPILE
+    inline void SetPretenured()
+    {
+        LIMITED_METHOD_CONTRACT;
+        InterlockedOr((LONG*)&m_dwFlags, (LONG)enum_flag_Pretenured);
+    }
+#endif
+
     inline BOOL IsStaticDataAllocated() const
     {
         LIMITED_METHOD_DAC_CONTRACT;
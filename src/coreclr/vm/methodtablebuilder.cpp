@@ -7013,6 +7013,14 @@ VOID MethodTableBuilder::AllocAndInitMethodDescs()
     //  - Token range (upper 24 bits of the method token) has changed.
     //  - The maximum size of the chunk has been reached.
     //
+    // MethodDescs are created for all declared methods up front, including non-virtual methods that may never be
+    // called: MethodIterator, the MethodDef to MethodDesc map, the DAC and R2R fixups all rely on every method of a
+    // loaded type having a MethodDesc in one of its chunks. What is deferred to first use instead is everything
+    // that is not needed to describe the method: temporary entry points (precodes) are created on demand by
+    // code:MethodDesc::EnsureTemporaryEntryPoint, and unboxing and instantiating stubs for non-virtual methods by
+    // code:MethodDesc::FindOrCreateAssociatedMethodDesc. Keep per-method allocations out of this loop so large
+    // types stay cheap to load.
+    //
 
     int currentTokenRange = -1; // current token range
     SIZE_T sizeOfMethodDescs = 0; // current running size of methodDesc chunk
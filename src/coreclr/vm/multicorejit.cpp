@@ -392,9 +392,9 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 
     for (LONG i = 0 ; i < m_JitInfoCount; i++)
     {
-        if (m_JitInfoArray[i].IsModuleInfo())
+        if (m_JitInfoArray[i].IsModuleInfo() || m_JitInfoArray[i].IsTypeInfo())
         {
-            // Module records don't need preprocessing
+            // Module and type records don't need preprocessing
             continue;
         }
 
@@ -461,7 +461,7 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         header.recordID       = Pack8_24(MULTICOREJIT_HEADER_RECORD_ID, sizeof(HeaderRecord));
         header.version        = MULTICOREJIT_PROFILE_VERSION;
         header.moduleCount    = m_ModuleCount;
-        header.methodCount    = m_JitInfoCount - skipped - m_ModuleDepCount;
+        header.methodCount    = m_JitInfoCount - skipped - m_ModuleDepCount - m_TypeCount;
         header.moduleDepCount = m_ModuleDepCount;
 
         MulticoreJitCodeStorage & curStorage =  m_pDomain->GetMulticoreJitManager().GetMulticoreJitCodeStorage();
@@ -477,6 +477,9 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         header.shortCounters[ 7] = m_stats.m_nTotalDelay;
         header.shortCounters[ 8] = m_stats.m_nDelayCount;
         header.shortCounters[ 9] = m_stats.m_nWalkBack;
+        header.shortCounters[10] = m_stats.m_nPreloadedTypes;
+        header.shortCounters[11] = m_stats.m_nTypesAlreadyLoaded;
+        header.shortCounters[12] = m_stats.m_nPregeneratedILStubs;
 
         _ASSERTE(HEADER_W_COUNTER >= 14);
 
@@ -506,6 +509,18 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
             DWORD data1 = m_JitInfoArray[i].GetRawModuleData();
             hr = WriteData(pStream, &data1, sizeof(data1));
         }
+        else if (m_JitInfoArray[i].IsTypeInfo())
+        {
+            // Type record
+            DWORD data1 = m_JitInfoArray[i].GetRawTypeData1();
+            unsigned data2 = m_JitInfoArray[i].GetRawTypeData2();
+
+            hr = WriteData(pStream, &data1, sizeof(data1));
+            if (SUCCEEDED(hr))
+            {
+                hr = WriteData(pStream, &data2, sizeof(data2));
+            }
+        }
         else if (m_JitInfoArray[i].IsGenericMethodInfo())
         {
             // Method record
@@ -896,6 +911,46 @@ void MulticoreJitRecorder::RecordMethodJitOrLoad(MethodDesc * pMethod, bool appl
 }
 
 
+// Types are recorded in load order, interleaved with the methods, so that the player can load them ahead of the
+// methods that need them. Only typical definitions are recorded, instantiations are loaded by the player while
+// it decodes the generic method records that use them.
+void MulticoreJitRecorder::RecordTypeLoad(MethodTable * pMT)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(pMT->IsTypicalTypeDefinition());
+
+    Module * pModule = pMT->GetModule();
+
+    if ((m_TypeCount >= MAX_TYPE_RECORDS) || (m_JitInfoCount >= (LONG) MAX_METHODS))
+    {
+        return;
+    }
+
+    if (! MulticoreJitManager::IsSupportedModule(pModule, true))
+    {
+        return;
+    }
+
+    mdTypeDef token = pMT->GetCl();
+
+    if (IsNilToken(token))
+    {
+        return;
+    }
+
+    unsigned moduleIndex = RecordModuleInfo(pModule);
+
+    if ((moduleIndex == UINT_MAX) || (m_JitInfoCount >= (LONG) MAX_METHODS))
+    {
+        return;
+    }
+
+    m_TypeCount++;
+    m_JitInfoArray[m_JitInfoCount++].PackType(moduleIndex, token);
+}
+
+
 // Called from AppDomain::RaiseAssemblyResolveEvent, make it simple
 
 void MulticoreJitRecorder::AbortProfile()
@@ -1453,6 +1508,27 @@ void MulticoreJitManager::RecordMethodJitOrLoad(MethodDesc * pMethod)
 }
 
 
+// Call back from ClassLoader::LoadTypeHandleForTypeKey when a typical type definition reaches CLASS_LOADED
+// Threading: protected by m_playerLock
+
+void MulticoreJitManager::RecordTypeLoad(MethodTable * pMT)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->RecordTypeLoad(pMT);
+
+        if (m_pMulticoreJitRecorder->IsAtFullCapacity())
+        {
+            m_fRecorderActive = false;
+        }
+    }
+}
+
+
 // static
 bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 {
@@ -1470,6 +1546,29 @@ bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 }
 
 
+// static
+// P/Invoke methods are recorded so that the player can generate their IL stubs ahead of time
+bool MulticoreJitManager::IsNDirectMethodSupported(MethodDesc * pMethod)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!pMethod->IsNDirect() || pMethod->IsVarArg() || pMethod->GetLoaderAllocator()->IsCollectible())
+    {
+        return false;
+    }
+
+    // Crossgen2 precompiles non-shareable P/Invoke stubs, there is no IL stub to generate for those
+    Module * pModule = pMethod->GetModule();
+    return !(pModule->IsReadyToRun() && pModule->GetReadyToRunInfo()->HasNonShareablePInvokeStubs());
+}
+
+
 // static
 // Stop all multicore Jitting profile, called from EEShutDown
 void MulticoreJitManager::StopProfileAll()
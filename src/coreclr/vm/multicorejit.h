@@ -62,6 +62,9 @@ struct MulticoreJitPlayerStat
     unsigned short    m_nTotalDelay;
     unsigned short    m_nDelayCount;
     unsigned short    m_nWalkBack;
+    unsigned short    m_nPreloadedTypes;
+    unsigned short    m_nTypesAlreadyLoaded;
+    unsigned short    m_nPregeneratedILStubs;
 
     HRESULT           m_hr;
 
@@ -279,10 +282,15 @@ public:
 
     static bool IsMethodSupported(MethodDesc * pMethod);
 
+    static bool IsNDirectMethodSupported(MethodDesc * pMethod);
+
     MulticoreJitCodeInfo RequestMethodCode(MethodDesc * pMethod);
 
     void RecordMethodJitOrLoad(MethodDesc * pMethod);
 
+    // Track types loaded for recording
+    void RecordTypeLoad(MethodTable * pMT);
+
     MulticoreJitPlayerStat & GetStats()
     {
         LIMITED_METHOD_CONTRACT;
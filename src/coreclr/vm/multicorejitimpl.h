@@ -42,16 +42,18 @@ const int      HEADER_D_COUNTER  = 3;               // Extra 32-bit counters in
 
 const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MAX_WALKBACK      = 128;
+const unsigned MAX_TYPE_RECORDS  = MAX_METHODS / 4;  // Type records share the recorder array with methods
 
 enum
 {
-    MULTICOREJIT_PROFILE_VERSION   = 102,
+    MULTICOREJIT_PROFILE_VERSION   = 103,
 
     MULTICOREJIT_HEADER_RECORD_ID           = 1,
     MULTICOREJIT_MODULE_RECORD_ID           = 2,
     MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID = 3,
     MULTICOREJIT_METHOD_RECORD_ID           = 4,
     MULTICOREJIT_GENERICMETHOD_RECORD_ID    = 5,
+    MULTICOREJIT_TYPE_RECORD_ID             = 6,
 };
 
 inline unsigned Pack8_24(unsigned up, unsigned low)
@@ -63,7 +65,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 
 // Multicore JIT profile format.
 //
-// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> }
+// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> | <TypeDef> }
 //
 //  1. Each record is DWORD aligned
 //  2. Each record starts with a 1 byte recordType identifier
@@ -78,6 +80,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 // <ModuleDependency>::= <recordType=MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID> <loadLevel_1byte> <moduleIndex_2bytes>
 // <GenericMethod>::=    <recordType=MULTICOREJIT_GENERICMETHOD_RECORD_ID> <methodFlags_1byte> <moduleIndex_2byte> <sigSize_2byte> <signature> <optional padding>
 // <NonGenericMethod>::= <recordType=MULTICOREJIT_METHOD_RECORD_ID> <methodFlags_1byte> <moduleIndex_2byte> <methodToken_4byte>
+// <TypeDef>::=          <recordType=MULTICOREJIT_TYPE_RECORD_ID> <unused_1byte> <moduleIndex_2byte> <typeDefToken_4byte>
 //
 //
 // Actual profile has two representations: internal and the one, that is stored in file.
@@ -106,6 +109,11 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //     - bits 16-23 store method flags
 //     - bits 24-31 store tag (MULTICOREJIT_METHOD_RECORD_ID or MULTICOREJIT_GENERICMETHOD_RECORD_ID).
 //
+//   3. Types.
+//     Typical definitions of types loaded to CLASS_LOADED while recording. RecorderInfo::ptr is set to 0.
+//     RecorderInfo::data1 stores module index in bits 0-15 and tag (MULTICOREJIT_TYPE_RECORD_ID) in bits 24-31.
+//     RecorderInfo::data2 stores typedef token.
+//
 // II. Profile in file
 //
 //   Preprocessing is performed right before profile saving to file.
@@ -126,6 +134,9 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //
 //     File write order for generic methods: RecorderInfo::data1, RecorderInfo::data2, signature, extra alignment (this is optional). All of these represent JitInfRecord.
 //     File write order for non-generic methods: RecorderInfo::data1, RecorderInfo::data2. All of these represent JitInfRecord.
+//
+//   3. Types.
+//     For types, no preprocessing of RecorderInfo is required, RecorderInfo::data1 and RecorderInfo::data2 are written to file.
 
 struct HeaderRecord
 {
@@ -276,6 +287,14 @@ private:
 
     Thread                           * m_pThread;
 
+    // Second background thread loading the types of the profiled methods ahead of the JIT thread
+    Thread                           * m_pTypePreloadThread;
+    const BYTE                       * m_pTypePreloadBuffer;
+    unsigned                           m_nTypePreloadSize;
+
+    // Number of background threads using this player, the last one to finish deletes it
+    LONG                               m_nThreadRefCount;
+
     unsigned                           m_nBlockingCount;
     unsigned                           m_nMissingModule;
 
@@ -292,6 +311,7 @@ private:
     void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric);
 
     bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
+    bool PregenerateILStub(NDirectMethodDesc * pNMD);
     HRESULT PlayProfile();
 
     bool ShouldAbort(bool fast) const;
@@ -300,6 +320,16 @@ private:
 
     static DWORD WINAPI StaticJITThreadProc(void *args);
 
+    bool StartTypePreload(const BYTE * pBuffer, unsigned nSize);
+    void PreloadTypes();
+    void PreloadTypeDef(Module * pModule, mdTypeDef token);
+
+    HRESULT TypePreloadThreadProc();
+
+    static DWORD WINAPI StaticTypePreloadThreadProc(void *args);
+
+    void ReleaseThreadReference();
+
     void TraceSummary();
 
     HRESULT UpdateModuleInfo();
@@ -390,13 +420,21 @@ struct RecorderInfo
         return IsGenericMethodInfo() || IsNonGenericMethodInfo();
     }
 
+    bool IsTypeInfo()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsPartiallyInitialized());
+        return (data1 >> RECORD_TYPE_OFFSET) == MULTICOREJIT_TYPE_RECORD_ID;
+    }
+
     bool IsModuleInfo()
     {
         LIMITED_METHOD_CONTRACT;
 
         _ASSERTE(IsPartiallyInitialized());
         bool ret = (data1 >> RECORD_TYPE_OFFSET) == MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID;
-        _ASSERTE(ret == !IsMethodInfo());
+        _ASSERTE(ret == (!IsMethodInfo() && !IsTypeInfo()));
         return ret;
     }
 
@@ -412,7 +450,7 @@ struct RecorderInfo
         }
         else
         {
-            if (IsNonGenericMethodInfo())
+            if (IsNonGenericMethodInfo() || IsTypeInfo())
             {
                 return data2 != 0;
             }
@@ -447,6 +485,22 @@ struct RecorderInfo
         return (data1 >> MODULE_LEVEL_OFFSET) & (MAX_MODULE_LEVELS - 1);
     }
 
+    unsigned GetRawTypeData1()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsTypeInfo());
+        return data1;
+    }
+
+    unsigned GetRawTypeData2()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsTypeInfo());
+        return data2;
+    }
+
     unsigned GetRawMethodData1()
     {
         LIMITED_METHOD_CONTRACT;
@@ -583,6 +637,24 @@ struct RecorderInfo
         _ASSERTE(IsMethodInfo());
     }
 
+    void PackType(unsigned moduleIndex, mdTypeDef token)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(data1 == 0);
+        _ASSERTE(data2 == 0);
+        _ASSERTE(ptr == nullptr);
+
+        _ASSERTE(moduleIndex < MAX_MODULES);
+        _ASSERTE(TypeFromToken(token) == mdtTypeDef);
+
+        data1 = Pack8_24(MULTICOREJIT_TYPE_RECORD_ID, moduleIndex);
+        data2 = token;
+
+        _ASSERTE(IsTypeInfo());
+        _ASSERTE(IsFullyInitialized());
+    }
+
     void PackModule(FileLoadLevel needLevel, unsigned moduleIndex)
     {
         LIMITED_METHOD_CONTRACT;
@@ -612,6 +684,7 @@ private:
     RecorderModuleInfo        * m_ModuleList;
     unsigned                  m_ModuleCount;
     unsigned                  m_ModuleDepCount;
+    unsigned                  m_TypeCount;
 
     RecorderInfo              * m_JitInfoArray;
     LONG                      m_JitInfoCount;
@@ -656,6 +729,7 @@ public:
 
         m_ModuleCount = 0;
         m_ModuleDepCount = 0;
+        m_TypeCount = 0;
 
         m_JitInfoCount = 0;
         m_fFirstMethod = true;
@@ -713,6 +787,8 @@ public:
 
     void RecordMethodJitOrLoad(MethodDesc * pMethod, bool application);
 
+    void RecordTypeLoad(MethodTable * pMT);
+
     MulticoreJitCodeInfo RequestMethodCode(MethodDesc * pMethod, MulticoreJitManager * pManager);
 
     HRESULT StartProfile(const WCHAR * pRoot, const WCHAR * pFileName, int suffix, LONG nSession);
@@ -380,6 +380,10 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_nLoadedModuleCount = 0;
 
     m_pThread            = NULL;
+    m_pTypePreloadThread = NULL;
+    m_pTypePreloadBuffer = NULL;
+    m_nTypePreloadSize   = 0;
+    m_nThreadRefCount    = 1;
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
@@ -944,11 +948,49 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
     return hr;
 }
 
+// Generate the IL stub of a P/Invoke recorded in the profile, so that its first call finds it in the IL stub cache
+
+bool MulticoreJitProfilePlayer::PregenerateILStub(NDirectMethodDesc * pNMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!pNMD->IsPointingToPrestub())
+    {
+        // Already called
+        m_stats.m_nHasNativeCode++;
+        return true;
+    }
+
+    bool fSuccess = false;
+
+    EX_TRY
+    {
+        NDirect::PregenerateILStub(pNMD);
+
+        m_stats.m_nPregeneratedILStubs++;
+        fSuccess = true;
+    }
+    EX_CATCH
+    {
+        // Leave reporting the failure to the first call of the method
+    }
+    EX_END_CATCH
+
+    return fSuccess;
+}
+
 void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric)
 {
     STANDARD_VM_CONTRACT;
 
-    if (pMethod != NULL && MulticoreJitManager::IsMethodSupported(pMethod))
+    if (pMethod != NULL && MulticoreJitManager::IsNDirectMethodSupported(pMethod))
+    {
+        if (PregenerateILStub((NDirectMethodDesc *)pMethod))
+        {
+            return;
+        }
+    }
+    else if (pMethod != NULL && MulticoreJitManager::IsMethodSupported(pMethod))
     {
         if (!isGeneric)
         {
@@ -1135,6 +1177,9 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         nSize,
         GetAppDomain()->GetFriendlyName()));
 
+    bool typePreloadChecked = false;
+    bool typePreloadStarted = false;
+
     while ((SUCCEEDED(hr)) && (nSize > sizeof(unsigned)))
     {
         unsigned data1 = * (const unsigned *) pBuffer;
@@ -1149,7 +1194,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         {
             rcdLen = sizeof(unsigned);
         }
-        else if (rcdTyp == MULTICOREJIT_METHOD_RECORD_ID)
+        else if ((rcdTyp == MULTICOREJIT_METHOD_RECORD_ID) || (rcdTyp == MULTICOREJIT_TYPE_RECORD_ID))
         {
             rcdLen = 2 * sizeof(unsigned);
         }
@@ -1178,6 +1223,13 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
             break;
         }
 
+        // All module records come first, the remainder of the profile can be handed over to the type preloader
+        if (!typePreloadChecked && (rcdTyp != MULTICOREJIT_MODULE_RECORD_ID))
+        {
+            typePreloadChecked = true;
+            typePreloadStarted = StartTypePreload(pBuffer, nSize);
+        }
+
         if (rcdTyp == MULTICOREJIT_MODULE_RECORD_ID)
         {
             const ModuleRecord * pRec = (const ModuleRecord * ) pBuffer;
@@ -1201,6 +1253,20 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
             hr = HandleModuleInfoRecord(moduleIndex, level);
         }
+        else if (rcdTyp == MULTICOREJIT_TYPE_RECORD_ID)
+        {
+            // Type records are replayed by the type preload thread when there is one
+            if (!typePreloadStarted)
+            {
+                Module * pModule = GetModuleFromIndex(data1 & MODULE_MASK);
+                mdTypeDef token = * (((const unsigned *) pBuffer) + 1);
+
+                if ((pModule != NULL) && (TypeFromToken(token) == mdtTypeDef))
+                {
+                    PreloadTypeDef(pModule, token);
+                }
+            }
+        }
         else if (rcdTyp == MULTICOREJIT_METHOD_RECORD_ID || rcdTyp == MULTICOREJIT_GENERICMETHOD_RECORD_ID)
         {
             // Find all subsequent methods and jit/load them reversed
@@ -1405,7 +1471,7 @@ DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 
         // The background thread is responsible for deleting the MulticoreJitProfilePlayer object once it's started
         // Actually after Thread::StartThread succeeds
-        delete pPlayer;
+        pPlayer->ReleaseThreadReference();
     }
 
     MulticoreJitTrace(("StaticJITThreadProc endding(%x)", hr));
@@ -1414,6 +1480,266 @@ DWORD WINAPI MulticoreJitProfilePlayer::StaticJITThreadProc(void *args)
 }
 
 
+void MulticoreJitProfilePlayer::ReleaseThreadReference()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (InterlockedDecrement(&m_nThreadRefCount) == 0)
+    {
+        delete this;
+    }
+}
+
+
+// Types of the profiled methods are loaded on a second background thread, walking the same method records as the JIT
+// thread. Type loads for independent types then proceed in parallel with the JIT thread (and with the application
+// threads), which find them already at CLASS_LOADED. Concurrent loads of the same type are serialized by the
+// PendingTypeLoadTable as usual.
+bool MulticoreJitProfilePlayer::StartTypePreload(const BYTE * pBuffer, unsigned nSize)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitTypePreload) == 0)
+    {
+        return false;
+    }
+
+    // The JIT thread and the preloader are the only threads running besides the application, only use a second
+    // background thread if there are enough cores for it.
+    if (g_SystemInfo.dwNumberOfProcessors < 3)
+    {
+        return false;
+    }
+
+    _ASSERTE(m_pTypePreloadThread == NULL);
+
+    m_pTypePreloadBuffer = pBuffer;
+    m_nTypePreloadSize = nSize;
+
+    // The reference is taken before the thread can run and owned by it once it has started
+    InterlockedIncrement(&m_nThreadRefCount);
+
+    bool started = false;
+
+    EX_TRY
+    {
+        m_pTypePreloadThread = SetupUnstartedThread();
+
+        if (m_pTypePreloadThread->CreateNewThread(0, StaticTypePreloadThreadProc, this))
+        {
+            started = m_pTypePreloadThread->StartThread() > 0;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH
+
+    if (!started)
+    {
+        InterlockedDecrement(&m_nThreadRefCount);
+    }
+
+    return started;
+}
+
+
+// Loads a recorded type definition unless it is already loaded, keeping count of both for the player summary
+void MulticoreJitProfilePlayer::PreloadTypeDef(Module * pModule, mdTypeDef token)
+{
+    STANDARD_VM_CONTRACT;
+
+    TypeHandle th = pModule->LookupTypeDef(token);
+
+    if (!th.IsNull() && th.IsFullyLoaded())
+    {
+        m_stats.m_nTypesAlreadyLoaded++;
+        return;
+    }
+
+    EX_TRY
+    {
+        th = ClassLoader::LoadTypeDefThrowing(pModule, token,
+                                              ClassLoader::ReturnNullIfNotFound,
+                                              ClassLoader::PermitUninstDefs);
+        if (!th.IsNull())
+        {
+            m_stats.m_nPreloadedTypes++;
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH
+}
+
+
+void MulticoreJitProfilePlayer::PreloadTypes()
+{
+    STANDARD_VM_CONTRACT;
+
+    const BYTE * pBuffer = m_pTypePreloadBuffer;
+    unsigned nSize = m_nTypePreloadSize;
+
+    Module * pLastModule = NULL;
+    mdTypeDef lastType = mdTypeDefNil;
+
+    while ((nSize > sizeof(unsigned)) && !ShouldAbort(false))
+    {
+        unsigned data1 = * (const unsigned *) pBuffer;
+        unsigned rcdTyp = data1 >> RECORD_TYPE_OFFSET;
+        unsigned rcdLen = 0;
+
+        if (rcdTyp == MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID)
+        {
+            rcdLen = sizeof(unsigned);
+        }
+        else if ((rcdTyp == MULTICOREJIT_METHOD_RECORD_ID) || (rcdTyp == MULTICOREJIT_TYPE_RECORD_ID))
+        {
+            rcdLen = 2 * sizeof(unsigned);
+        }
+        else if (rcdTyp == MULTICOREJIT_GENERICMETHOD_RECORD_ID)
+        {
+            if (nSize < sizeof(unsigned) + sizeof(unsigned short))
+            {
+                break;
+            }
+
+            unsigned signatureLength = * (const unsigned short *) (((const unsigned *) pBuffer) + 1);
+            rcdLen = AlignUp(signatureLength + sizeof(DWORD) + sizeof(unsigned short), sizeof(DWORD));
+        }
+        else
+        {
+            // The JIT thread reports malformed profiles
+            break;
+        }
+
+        if (rcdLen > nSize)
+        {
+            break;
+        }
+
+        // Generic method records need the type context of the JIT thread to be decoded, only the recorded types and
+        // the declaring types of non-generic methods are preloaded. Records of modules that are not loaded yet are
+        // skipped, not waited for.
+        if (rcdTyp == MULTICOREJIT_TYPE_RECORD_ID)
+        {
+            Module * pModule = GetModuleFromIndex(data1 & MODULE_MASK);
+            mdTypeDef token = * (((const unsigned *) pBuffer) + 1);
+
+            if ((pModule != NULL) && (TypeFromToken(token) == mdtTypeDef) &&
+                ((token != lastType) || (pModule != pLastModule)))
+            {
+                pLastModule = pModule;
+                lastType = token;
+
+                PreloadTypeDef(pModule, token);
+            }
+        }
+        else if (rcdTyp == MULTICOREJIT_METHOD_RECORD_ID)
+        {
+            mdToken token = * (((const unsigned *) pBuffer) + 1);
+            Module * pModule = GetModuleFromIndex(data1 & MODULE_MASK);
+            mdTypeDef tkParent;
+
+            if ((pModule != NULL) &&
+                (TypeFromToken(token) == mdtMethodDef) &&
+                SUCCEEDED(pModule->GetMDImport()->GetParentToken(token, &tkParent)) &&
+                ((tkParent != lastType) || (pModule != pLastModule)))
+            {
+                pLastModule = pModule;
+                lastType = tkParent;
+
+                PreloadTypeDef(pModule, tkParent);
+            }
+        }
+
+        pBuffer += rcdLen;
+        nSize -= rcdLen;
+    }
+
+    MulticoreJitTrace(("Type preload thread loaded %d types, %d already loaded",
+        m_stats.m_nPreloadedTypes,
+        m_stats.m_nTypesAlreadyLoaded));
+
+    _FireEtwMulticoreJit(W("TYPEPRELOADSUMMARY"), W(""), m_stats.m_nPreloadedTypes, m_stats.m_nTypesAlreadyLoaded, 0);
+}
+
+
+HRESULT MulticoreJitProfilePlayer::TypePreloadThreadProc()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = S_OK;
+
+    EX_TRY
+    {
+        // Go into preemptive mode
+        GCX_PREEMP();
+
+        PreloadTypes();
+    }
+    EX_CATCH
+    {
+        hr = COR_E_EXCEPTION;
+    }
+    EX_END_CATCH
+
+    return hr;
+}
+
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticTypePreloadThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    HRESULT hr = S_OK;
+
+    MulticoreJitTrace(("StaticTypePreloadThreadProc starting"));
+
+    MulticoreJitProfilePlayer * pPlayer =  (MulticoreJitProfilePlayer *) args;
+
+    Thread * pThread = pPlayer->m_pTypePreloadThread;
+
+    if ((pThread != NULL) && pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+        pThread->SetBackground(TRUE);
+
+        hr = pPlayer->TypePreloadThreadProc();
+    }
+
+    if (pThread != NULL)
+    {
+        DestroyThread(pThread);
+    }
+
+    pPlayer->ReleaseThreadReference();
+
+    MulticoreJitTrace(("StaticTypePreloadThreadProc endding(%x)", hr));
+
+    return (DWORD) hr;
+}
+
+
 HRESULT MulticoreJitProfilePlayer::ProcessProfile(const WCHAR * pFileName)
 {
     STANDARD_VM_CONTRACT;
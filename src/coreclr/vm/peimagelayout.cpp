@@ -36,6 +36,14 @@ static bool AllowR2RForImage(PEImage* pOwner)
 #ifndef DACCESS_COMPILE
 extern BOOL g_useDefaultBaseAddr;
 
+INT64 PEImageLayout::s_relocatedPrivateBytes = 0;
+
+UINT64 PEImageLayout::GetRelocatedPrivateBytes()
+{
+    LIMITED_METHOD_CONTRACT;
+    return (UINT64)VolatileLoad(&s_relocatedPrivateBytes);
+}
+
 PEImageLayout* PEImageLayout::CreateFromByteArray(PEImage* pOwner, const BYTE* array, COUNT_T size)
 {
     STANDARD_VM_CONTRACT;
@@ -241,6 +249,10 @@ void PEImageLayout::ApplyBaseRelocations(bool relocationMustWriteCopy)
     // The page size of PE file relocs is always 4096 bytes
     const SIZE_T cbPageSize = 4096;
 
+    // Pages of sections that are not writable would otherwise stay shared with other processes
+    // mapping the same image; every one we patch becomes a private copy.
+    SIZE_T cbPrivateBytes = 0;
+
     COUNT_T dirPos = 0;
     while (dirPos < dirSize)
     {
@@ -348,6 +360,11 @@ void PEImageLayout::ApplyBaseRelocations(bool relocationMustWriteCopy)
             }
         }
 
+        if (dwOldProtection != 0 && pEndAddressToFlush != NULL)
+        {
+            cbPrivateBytes += cbPageSize;
+        }
+
         BOOL bExecRegion = (dwOldProtection & (PAGE_EXECUTE | PAGE_EXECUTE_READ |
             PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY)) != 0;
 
@@ -394,6 +411,12 @@ void PEImageLayout::ApplyBaseRelocations(bool relocationMustWriteCopy)
     {
         ClrFlushInstructionCache(pFlushRegion, cbFlushRegion);
     }
+
+    if (cbPrivateBytes != 0)
+    {
+        LOG((LF_LOADER, LL_INFO100, "PEImage: Base relocations made %zu bytes of read-only image pages private\n", cbPrivateBytes));
+        InterlockedExchangeAdd64(&s_relocatedPrivateBytes, (INT64)cbPrivateBytes);
+    }
 }
 
 static SIZE_T AllocatedPart(PVOID part)
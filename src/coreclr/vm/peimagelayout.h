@@ -63,6 +63,12 @@ public:
 
     void ApplyBaseRelocations(bool relocationMustWriteCopy);
 
+#ifndef DACCESS_COMPILE
+    // Total size of the read-only and executable image pages that base relocations have turned
+    // into private copies, across all images loaded by this process
+    static UINT64 GetRelocatedPrivateBytes();
+#endif
+
 public:
 #ifdef DACCESS_COMPILE
     void EnumMemoryRegions(CLRDataEnumMemoryFlags flags);
@@ -70,6 +76,9 @@ public:
 
 private:
     Volatile<LONG> m_refCount;
+#ifndef DACCESS_COMPILE
+    static INT64 s_relocatedPrivateBytes;
+#endif
 public:
     PEImage* m_pOwner;
 
@@ -18,6 +18,12 @@
 
 #define FMT_CODE_ADDR "%p"
 
+// With DOTNET_PerfMapAsyncWrites the perf map lines are batched into a buffer of this size;
+// the buffer is written when full, when it holds lines older than PERFMAP_FLUSH_INTERVAL_MS
+// or when the map is closed.
+#define PERFMAP_WRITE_BUFFER_SIZE (64 * 1024)
+#define PERFMAP_FLUSH_INTERVAL_MS 1000
+
 #ifndef __ANDROID__
 #define TEMP_DIRECTORY_PATH "/tmp"
 #else
@@ -110,7 +116,7 @@ void PerfMap::Enable(PerfMapType type, bool sendExisting)
 
         if (!PAL_PerfJitDump_IsStarted() && (type == PerfMapType::ALL || type == PerfMapType::JITDUMP))
         {
-            PAL_PerfJitDump_Start(basePath);
+            PAL_PerfJitDump_Start(basePath, CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapAsyncWrites) != 0);
 
             InitializeConfiguration();
 
@@ -214,6 +220,14 @@ PerfMap::PerfMap()
 
     // Initialize with no failures.
     m_ErrorEncountered = false;
+
+    m_WriteBuffer = nullptr;
+    m_WriteBufferUsed = 0;
+    m_WriteBufferStartTime = 0;
+    if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapAsyncWrites) != 0)
+    {
+        m_WriteBuffer = new (nothrow) char[PERFMAP_WRITE_BUFFER_SIZE];
+    }
 }
 
 // Clean-up resources.
@@ -221,6 +235,10 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    FlushWriteBuffer();
+    delete[] m_WriteBuffer;
+    m_WriteBuffer = nullptr;
+
     delete m_FileStream;
     m_FileStream = nullptr;
 }
@@ -252,29 +270,23 @@ void PerfMap::OpenFile(SString& path)
     }
 }
 
-// Write a line to the map file.
-void PerfMap::WriteLine(SString& line)
+// Write the data to the map file.
+void PerfMap::WriteToFile(const char * data, ULONG count)
 {
     STANDARD_VM_CONTRACT;
-#ifdef _DEBUG
-    _ASSERTE(s_csPerfMap.OwnedByCurrentThread());
-#endif
 
-    if (m_FileStream == nullptr || m_ErrorEncountered)
+    if (m_FileStream == nullptr || m_ErrorEncountered || count == 0)
     {
         return;
     }
 
     EX_TRY
     {
-        // Write the line.
         // The PAL already takes a lock when writing, so we don't need to do so here.
-        const char * strLine = line.GetUTF8();
-        ULONG inCount = line.GetCount();
         ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
+        m_FileStream->Write(data, count, &outCount);
 
-        if (inCount != outCount)
+        if (count != outCount)
         {
             // This will cause us to stop writing to the file.
             // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
@@ -285,6 +297,67 @@ void PerfMap::WriteLine(SString& line)
     EX_CATCH{} EX_END_CATCH
 }
 
+// Write the batched lines to the map file.
+void PerfMap::FlushWriteBuffer()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_WriteBuffer != nullptr && m_WriteBufferUsed > 0)
+    {
+        WriteToFile(m_WriteBuffer, (ULONG)m_WriteBufferUsed);
+        m_WriteBufferUsed = 0;
+    }
+}
+
+// Write a line to the map file.
+void PerfMap::WriteLine(SString& line)
+{
+    STANDARD_VM_CONTRACT;
+#ifdef _DEBUG
+    _ASSERTE(s_csPerfMap.OwnedByCurrentThread());
+#endif
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    const char * strLine = line.GetUTF8();
+    ULONG count = line.GetCount();
+
+    if (m_WriteBuffer == nullptr)
+    {
+        WriteToFile(strLine, count);
+        return;
+    }
+
+    // Batch the lines so each one isn't a separate write on the code generating thread.
+    if (m_WriteBufferUsed + count > PERFMAP_WRITE_BUFFER_SIZE)
+    {
+        FlushWriteBuffer();
+    }
+
+    if (count > PERFMAP_WRITE_BUFFER_SIZE)
+    {
+        WriteToFile(strLine, count);
+        return;
+    }
+
+    ULONGLONG now = minipal_lowres_ticks();
+    if (m_WriteBufferUsed == 0)
+    {
+        m_WriteBufferStartTime = now;
+    }
+
+    memcpy(m_WriteBuffer + m_WriteBufferUsed, strLine, count);
+    m_WriteBufferUsed += count;
+
+    if (now - m_WriteBufferStartTime >= PERFMAP_FLUSH_INTERVAL_MS)
+    {
+        FlushWriteBuffer();
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
@@ -45,6 +45,11 @@ private:
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Batched lines when DOTNET_PerfMapAsyncWrites is set, otherwise null.
+    char * m_WriteBuffer;
+    size_t m_WriteBufferUsed;
+    ULONGLONG m_WriteBufferStartTime;
+
     // Construct a new map
     PerfMap();
 
@@ -54,6 +59,12 @@ private:
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write the data to the map file.
+    void WriteToFile(const char * data, ULONG count);
+
+    // Write the batched lines to the map file.
+    void FlushWriteBuffer();
+
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
 
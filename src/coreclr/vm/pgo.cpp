@@ -34,6 +34,7 @@
 //    key for non-dynamic methods, and a field in the DynamicMethodDesc for the dynamic methods.
 // 2. For R2R lookups, lookup via IL token exact match, as well as a hash based lookup.
 // 3. For text based lookups, lookup by hash (only enabled if the ReadPGOData COMPlus is set).
+//    Data read from the binary format is looked up by hash in the mapped file, and decoded on first use.
 
 // For emission into output, we will use an approach that relies on walking linked lists
 // 1. InstrumentationDataHeader shall be placed before any instrumentation data. It will be part of a linked
@@ -52,6 +53,9 @@ const char* const         PgoManager::s_TypeHandle = "TypeHandle: %s\n";
 
 
 PtrSHash<PgoManager::Header, PgoManager::CodeAndMethodHash> PgoManager::s_textFormatPgoData;
+const uint8_t* PgoManager::s_binaryFormatPgoData;
+size_t PgoManager::s_binaryFormatPgoDataSize;
+PtrSHash<PgoManager::Header, PgoManager::CodeAndMethodHash> PgoManager::s_binaryFormatPgoCache;
 CrstStatic PgoManager::s_pgoMgrLock;
 PgoManager PgoManager::s_InitialPgoManager;
 
@@ -160,6 +164,214 @@ void CallFClose(FILE* file)
 
 typedef Holder<FILE*, DoNothing, CallFClose> FILEHolder;
 
+// Formats a type or method handle found in instrumentation data in the notation used by the PGO data files.
+// Returns false for null or unknown handles, and for names that are too long to be recorded.
+static bool GetPgoHandleString(ICorJitInfo::PgoInstrumentationKind kind, intptr_t handle, SString& result)
+{
+    if (handle == 0 || ICorJitInfo::IsUnknownHandle(handle))
+    {
+        return false;
+    }
+
+    if (kind == ICorJitInfo::PgoInstrumentationKind::TypeHandle)
+    {
+        TypeHandle th = TypeHandle::FromPtr((void*)handle);
+        TypeString::AppendType(result, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+        return result.GetCount() <= 8192;
+    }
+
+    _ASSERTE(kind == ICorJitInfo::PgoInstrumentationKind::MethodHandle);
+    MethodDesc* md = reinterpret_cast<MethodDesc*>(handle);
+    SString garbage1, tMethodName, garbage2;
+    md->GetMethodInfo(garbage1, tMethodName, garbage2);
+    StackSString tTypeName;
+    TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+    if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
+    {
+        return false;
+    }
+
+    // Format is:
+    // MethodName|@|fully_qualified_type_name
+    result.Set(tMethodName);
+    result.AppendUTF8("|@|");
+    result.Append(tTypeName);
+    return true;
+}
+
+static void AppendToByteArray(SArray<uint8_t>& array, const void* data, size_t size)
+{
+    COUNT_T start = array.GetCount();
+    array.SetCount(start + (COUNT_T)size);
+    memcpy(array.OpenRawBuffer() + start, data, size);
+    array.CloseRawBuffer();
+}
+
+static void PadByteArray(SArray<uint8_t>& array, size_t alignment)
+{
+    while ((array.GetCount() % alignment) != 0)
+    {
+        array.Append(0);
+    }
+}
+
+void PgoManager::WriteBinaryPgoData(LPCWSTR fileName, int pgoDataCount)
+{
+    struct StringFixup
+    {
+        COUNT_T slotOffset;   // Offset of a handle slot from the start of the method data
+        COUNT_T stringOffset; // Offset of its string from the start of the string data
+    };
+
+    StackSArray<BinaryPgoMethodEntry> entries;
+    StackSArray<uint8_t> methodData;
+    StackSArray<uint8_t> stringData;
+    StackSArray<StringFixup> fixups;
+    entries.Preallocate(pgoDataCount);
+
+    EnumeratePGOHeaders([&](HeaderList *pgoData)
+    {
+        const Header& header = pgoData->header;
+
+        StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaArray;
+        if (!ReadInstrumentationSchemaWithLayoutIntoSArray(header.GetData(), header.SchemaSizeMax(), header.countsOffset, &schemaArray) ||
+            (schemaArray.GetCount() == 0))
+        {
+            return true;
+        }
+
+        const ICorJitInfo::PgoInstrumentationSchema& lastSchema = schemaArray[schemaArray.GetCount() - 1];
+        size_t dataSize = lastSchema.Offset + lastSchema.Count * InstrumentationKindToSize(lastSchema.InstrumentationKind) - header.countsOffset;
+
+        // The schema is written as is, its size (countsOffset) is pointer aligned which keeps the data that follows aligned
+        BinaryPgoMethodEntry entry;
+        entry.codehash = header.codehash;
+        entry.methodhash = header.methodhash;
+        entry.ilSize = header.ilSize;
+        entry.schemaOffset = methodData.GetCount();
+        entry.schemaSize = header.countsOffset;
+        AppendToByteArray(methodData, header.GetData(), header.countsOffset);
+        entry.dataOffset = methodData.GetCount();
+        entry.dataSize = (uint32_t)dataSize;
+        AppendToByteArray(methodData, header.GetData() + header.countsOffset, dataSize);
+        PadByteArray(methodData, sizeof(size_t));
+
+        // Replace the handles by strings, the slots are filled in once the location of the strings is known
+        for (COUNT_T iSchema = 0; iSchema < schemaArray.GetCount(); iSchema++)
+        {
+            const ICorJitInfo::PgoInstrumentationSchema& schema = schemaArray[iSchema];
+            ICorJitInfo::PgoInstrumentationKind kind = schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask;
+            if ((kind != ICorJitInfo::PgoInstrumentationKind::TypeHandle) && (kind != ICorJitInfo::PgoInstrumentationKind::MethodHandle))
+            {
+                continue;
+            }
+
+            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+            {
+                size_t entryOffset = schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind);
+                COUNT_T slotOffset = (COUNT_T)(entry.dataOffset + entryOffset - header.countsOffset);
+
+                uint8_t* rawBuffer = methodData.OpenRawBuffer();
+                *(INT_PTR*)(rawBuffer + slotOffset) = 0;
+                methodData.CloseRawBuffer();
+
+                StackSString handleString;
+                if (GetPgoHandleString(kind, *(intptr_t*)(header.GetData() + entryOffset), handleString))
+                {
+                    StringFixup fixup = { slotOffset, stringData.GetCount() };
+                    fixups.Append(fixup);
+
+                    // Strings are kept at even offsets, as the low bit of a handle slot marks a string to resolve
+                    const char* utf8 = handleString.GetUTF8();
+                    AppendToByteArray(stringData, utf8, strlen(utf8) + 1);
+                    PadByteArray(stringData, 2);
+                }
+            }
+        }
+
+        entries.Append(entry);
+        return true;
+    });
+
+    COUNT_T methodCount = entries.GetCount();
+    if (methodCount == 0)
+    {
+        return;
+    }
+
+    uint32_t bucketCount = 1;
+    while (bucketCount < methodCount)
+    {
+        bucketCount <<= 1;
+    }
+
+    // Sort the entries by bucket, the index for bucket i is the range [buckets[i], buckets[i + 1])
+    NewArrayHolder<uint32_t> buckets = new uint32_t[bucketCount + 1];
+    NewArrayHolder<uint32_t> nextInBucket = new uint32_t[bucketCount];
+    NewArrayHolder<BinaryPgoMethodEntry> sortedEntries = new BinaryPgoMethodEntry[methodCount];
+    memset(buckets, 0, (bucketCount + 1) * sizeof(uint32_t));
+    for (COUNT_T i = 0; i < methodCount; i++)
+    {
+        buckets[(CodeAndMethodHash(entries[i].codehash, entries[i].methodhash).Hash() & (bucketCount - 1)) + 1]++;
+    }
+    for (uint32_t i = 0; i < bucketCount; i++)
+    {
+        buckets[i + 1] += buckets[i];
+        nextInBucket[i] = buckets[i];
+    }
+
+    BinaryPgoFileHeader fileHeader;
+    fileHeader.magic = s_BinaryFileMagic;
+    fileHeader.version = s_BinaryFileVersion;
+    fileHeader.pointerSize = sizeof(void*);
+    fileHeader.methodCount = methodCount;
+    fileHeader.bucketCount = bucketCount;
+    fileHeader.bucketsOffset = sizeof(BinaryPgoFileHeader);
+    fileHeader.entriesOffset = fileHeader.bucketsOffset + (bucketCount + 1) * sizeof(uint32_t);
+
+    S_SIZE_T methodDataStart = S_SIZE_T(AlignUp((size_t)fileHeader.entriesOffset + methodCount * sizeof(BinaryPgoMethodEntry), sizeof(size_t)));
+    S_SIZE_T stringDataStart = methodDataStart + S_SIZE_T(methodData.GetCount());
+    S_SIZE_T fileSize = stringDataStart + S_SIZE_T(stringData.GetCount());
+    if (fileSize.IsOverflow() || (fileSize.Value() > UINT32_MAX))
+    {
+        return;
+    }
+
+    for (COUNT_T i = 0; i < methodCount; i++)
+    {
+        BinaryPgoMethodEntry entry = entries[i];
+        entry.schemaOffset += (uint32_t)methodDataStart.Value();
+        entry.dataOffset += (uint32_t)methodDataStart.Value();
+        sortedEntries[nextInBucket[CodeAndMethodHash(entry.codehash, entry.methodhash).Hash() & (bucketCount - 1)]++] = entry;
+    }
+
+    uint8_t* rawMethodData = methodData.OpenRawBuffer();
+    for (COUNT_T i = 0; i < fixups.GetCount(); i++)
+    {
+        *(INT_PTR*)(rawMethodData + fixups[i].slotOffset) = (INT_PTR)(stringDataStart.Value() + fixups[i].stringOffset);
+    }
+    methodData.CloseRawBuffer();
+
+    FILE* const pgoDataFile = _wfopen(fileName, W("wb"));
+
+    if (pgoDataFile == NULL)
+    {
+        return;
+    }
+
+    FILEHolder fileHolder(pgoDataFile);
+
+    const uint8_t padding[sizeof(size_t)] = {};
+    fwrite(&fileHeader, sizeof(fileHeader), 1, pgoDataFile);
+    fwrite(buckets, sizeof(uint32_t), bucketCount + 1, pgoDataFile);
+    fwrite(sortedEntries, sizeof(BinaryPgoMethodEntry), methodCount, pgoDataFile);
+    fwrite(padding, 1, methodDataStart.Value() - (fileHeader.entriesOffset + methodCount * sizeof(BinaryPgoMethodEntry)), pgoDataFile);
+    fwrite(methodData.OpenRawBuffer(), 1, methodData.GetCount(), pgoDataFile);
+    methodData.CloseRawBuffer();
+    fwrite(stringData.OpenRawBuffer(), 1, stringData.GetCount(), pgoDataFile);
+    stringData.CloseRawBuffer();
+}
+
 void PgoManager::WritePgoData()
 {
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, JitInstrumentationDataVerbose))
@@ -205,6 +417,12 @@ void PgoManager::WritePgoData()
         return;
     }
 
+    if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_PGODataFormat) == 1)
+    {
+        WriteBinaryPgoData(fileName, pgoDataCount);
+        return;
+    }
+
     FILE* const pgoDataFile = _wfopen(fileName, W("wb"));
 
     if (pgoDataFile == NULL)
@@ -258,58 +476,36 @@ void PgoManager::WritePgoData()
                     case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
                         {
                             intptr_t thData = *(intptr_t*)(data + entryOffset);
+                            StackSString ss;
                             if (thData == 0)
                             {
                                 fprintf(pgoDataFile, s_TypeHandle, "NULL");
                             }
-                            else if (ICorJitInfo::IsUnknownHandle(thData))
+                            else if (!GetPgoHandleString(ICorJitInfo::PgoInstrumentationKind::TypeHandle, thData, ss))
                             {
                                 fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
                             }
                             else
                             {
-                                TypeHandle th = TypeHandle::FromPtr((void*)thData);
-                                StackSString ss;
-                                TypeString::AppendType(ss, th, TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                if (ss.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, "UNKNOWN");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
-                                }
+                                fprintf(pgoDataFile, s_TypeHandle, ss.GetUTF8());
                             }
                             break;
                         }
                     case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
                         {
                             intptr_t mdData = *(intptr_t*)(data + entryOffset);
+                            StackSString ss;
                             if (mdData == 0)
                             {
                                 fprintf(pgoDataFile, "MethodHandle: NULL\n");
                             }
-                            else if (ICorJitInfo::IsUnknownHandle(mdData))
+                            else if (!GetPgoHandleString(ICorJitInfo::PgoInstrumentationKind::MethodHandle, mdData, ss))
                             {
                                 fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
                             }
                             else
                             {
-                                MethodDesc* md = reinterpret_cast<MethodDesc*>(mdData);
-                                SString garbage1, tMethodName, garbage2;
-                                md->GetMethodInfo(garbage1, tMethodName, garbage2);
-                                StackSString tTypeName;
-                                TypeString::AppendType(tTypeName, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
-                                // Format is:
-                                // MethodName|@|fully_qualified_type_name
-                                if (tTypeName.GetCount() + 1 + tMethodName.GetCount() > 8192)
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: UNKNOWN\n");
-                                }
-                                else
-                                {
-                                    fprintf(pgoDataFile, "MethodHandle: %s|@|%s\n", tMethodName.GetUTF8(), tTypeName.GetUTF8());
-                                }
+                                fprintf(pgoDataFile, "MethodHandle: %s\n", ss.GetUTF8());
                             }
                             break;
                         }
@@ -367,6 +563,12 @@ void PgoManager::ReadPgoData()
         return;
     }
 
+    // Binary format files are only mapped here, the data for each method is decoded when it is first looked up
+    if (MapBinaryPgoData(fileName))
+    {
+        return;
+    }
+
     FILE* const pgoDataFile = _wfopen(fileName, W("rb"));
 
     if (pgoDataFile == NULL)
@@ -586,41 +788,227 @@ void PgoManager::ReadPgoData()
 
         methods++;
 
-        UINT offsetOfActualInstrumentationData;
-        HRESULT hr = ComputeOffsetOfActualInstrumentationData(schemaElements.GetElements(), schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
-        if (FAILED(hr))
+        Header* methodData = CreateTextFormatHeader(methodhash, codehash, ilSize, schemaElements.GetElements(), schemaCount,
+                                                    methodInstrumentationData.GetElements(), methodInstrumentationData.GetCount());
+        if (methodData == NULL)
         {
             continue;
         }
-        UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
 
-        // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
-        for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+        s_textFormatPgoData.Add(methodData);
+        probes += schemaCount;
+    }
+}
+
+// Allocates the header for a method read from a PGO data file, with the compressed schema placed in front of the
+// instrumentation data. The schema offsets are updated to be relative to the data region of the header.
+PgoManager::Header* PgoManager::CreateTextFormatHeader(unsigned methodhash, unsigned codehash, unsigned ilSize, ICorJitInfo::PgoInstrumentationSchema* pSchema, UINT32 countSchemaItems, const uint8_t* pInstrumentationData, size_t instrumentationDataSize)
+{
+    UINT offsetOfActualInstrumentationData;
+    HRESULT hr = ComputeOffsetOfActualInstrumentationData(pSchema, countSchemaItems, sizeof(Header), &offsetOfActualInstrumentationData);
+    if (FAILED(hr))
+    {
+        return NULL;
+    }
+    UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
+
+    // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
+    for (UINT32 iSchema = 0; iSchema < countSchemaItems; iSchema++)
+    {
+        pSchema[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+    }
+
+    S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(instrumentationDataSize);
+    if (allocationSize.IsOverflow())
+    {
+        _ASSERTE(!"Unexpected overflow");
+        return NULL;
+    }
+
+    Header* methodData = (Header*)malloc(allocationSize.Value());
+    if (methodData == NULL)
+    {
+        return NULL;
+    }
+    methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+
+    if (!WriteInstrumentationSchema(pSchema, countSchemaItems, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+    {
+        _ASSERTE(!"Unable to write schema");
+        free(methodData);
+        return NULL;
+    }
+
+    memcpy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, pInstrumentationData, instrumentationDataSize);
+    return methodData;
+}
+
+// Returns true if the file is in the binary format, whether or not it could be mapped
+bool PgoManager::MapBinaryPgoData(LPCWSTR fileName)
+{
+    STANDARD_VM_CONTRACT;
+
+    FileHandleHolder hFile(WszCreateFile(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    BinaryPgoFileHeader fileHeader;
+    DWORD bytesRead;
+    if (!ReadFile(hFile, &fileHeader, sizeof(fileHeader), &bytesRead, NULL) ||
+        (bytesRead != sizeof(fileHeader)) ||
+        (fileHeader.magic != s_BinaryFileMagic))
+    {
+        return false;
+    }
+
+    if ((fileHeader.version != s_BinaryFileVersion) || (fileHeader.pointerSize != sizeof(void*)))
+    {
+        return true;
+    }
+
+    DWORD fileSizeHigh;
+    DWORD fileSize = SafeGetFileSize(hFile, &fileSizeHigh);
+    if ((fileSize == 0xffffffff) || (fileSizeHigh != 0))
+    {
+        return true;
+    }
+
+    // Validate the index up front, so that lookups only have to check the entries they find
+    S_SIZE_T bucketsEnd = S_SIZE_T(fileHeader.bucketsOffset) + (S_SIZE_T(fileHeader.bucketCount) + S_SIZE_T(1)) * S_SIZE_T(sizeof(uint32_t));
+    S_SIZE_T entriesEnd = S_SIZE_T(fileHeader.entriesOffset) + S_SIZE_T(fileHeader.methodCount) * S_SIZE_T(sizeof(BinaryPgoMethodEntry));
+    if ((fileHeader.bucketCount == 0) || ((fileHeader.bucketCount & (fileHeader.bucketCount - 1)) != 0) ||
+        ((fileHeader.bucketsOffset % sizeof(uint32_t)) != 0) || ((fileHeader.entriesOffset % sizeof(uint32_t)) != 0) ||
+        bucketsEnd.IsOverflow() || (bucketsEnd.Value() > fileSize) ||
+        entriesEnd.IsOverflow() || (entriesEnd.Value() > fileSize))
+    {
+        return true;
+    }
+
+    HandleHolder hMap(CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL));
+    if (hMap == NULL)
+    {
+        return true;
+    }
+
+    CLRMapViewHolder view(CLRMapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
+    if (view == NULL)
+    {
+        return true;
+    }
+
+    // The view is kept for the lifetime of the process, as the decoded data refers to its strings
+    s_binaryFormatPgoDataSize = fileSize;
+    s_binaryFormatPgoData = (const uint8_t*)view.Extract();
+    return true;
+}
+
+PgoManager::Header* PgoManager::LookupBinaryPgoData(unsigned codehash, unsigned methodhash)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(s_binaryFormatPgoData != NULL);
+
+    const uint8_t* fileData = s_binaryFormatPgoData;
+    size_t fileSize = s_binaryFormatPgoDataSize;
+    const BinaryPgoFileHeader* fileHeader = (const BinaryPgoFileHeader*)fileData;
+    const uint32_t* buckets = (const uint32_t*)(fileData + fileHeader->bucketsOffset);
+    const BinaryPgoMethodEntry* entries = (const BinaryPgoMethodEntry*)(fileData + fileHeader->entriesOffset);
+
+    // Methods without data are common, so they are found absent in the mapped index without taking the lock
+    CodeAndMethodHash key(codehash, methodhash);
+    uint32_t bucket = key.Hash() & (fileHeader->bucketCount - 1);
+    uint32_t iEnd = min(buckets[bucket + 1], fileHeader->methodCount);
+    const BinaryPgoMethodEntry* entry = NULL;
+    for (uint32_t i = buckets[bucket]; i < iEnd; i++)
+    {
+        if ((entries[i].codehash == codehash) && (entries[i].methodhash == methodhash))
+        {
+            entry = &entries[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+
+    {
+        CrstHolder lock(&s_pgoMgrLock);
+        Header* decoded = s_binaryFormatPgoCache.Lookup(key);
+        if (decoded != NULL)
         {
-            schemaElements[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+            return decoded;
         }
+    }
 
-        S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(methodInstrumentationData.GetCount());
-        if (allocationSize.IsOverflow())
+    S_SIZE_T schemaEnd = S_SIZE_T(entry->schemaOffset) + S_SIZE_T(entry->schemaSize);
+    S_SIZE_T dataEnd = S_SIZE_T(entry->dataOffset) + S_SIZE_T(entry->dataSize);
+    if (schemaEnd.IsOverflow() || (schemaEnd.Value() > fileSize) ||
+        dataEnd.IsOverflow() || (dataEnd.Value() > fileSize))
+    {
+        return NULL;
+    }
+
+    StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaArray;
+    if (!ReadInstrumentationSchemaWithLayoutIntoSArray(fileData + entry->schemaOffset, entry->schemaSize, 0, &schemaArray))
+    {
+        return NULL;
+    }
+
+    for (COUNT_T iSchema = 0; iSchema < schemaArray.GetCount(); iSchema++)
+    {
+        const ICorJitInfo::PgoInstrumentationSchema& schema = schemaArray[iSchema];
+        S_SIZE_T schemaDataEnd = S_SIZE_T(schema.Offset) + S_SIZE_T((UINT32)schema.Count) * S_SIZE_T(InstrumentationKindToSize(schema.InstrumentationKind));
+        if ((schema.Count < 0) || schemaDataEnd.IsOverflow() || (schemaDataEnd.Value() > entry->dataSize))
         {
-            _ASSERTE(!"Unexpected overflow");
-            return;
+            return NULL;
         }
+    }
 
-        Header* methodData = (Header*)malloc(allocationSize.Value());
-        methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+    Header* methodData = CreateTextFormatHeader(methodhash, codehash, entry->ilSize, schemaArray.GetElements(), schemaArray.GetCount(),
+                                                fileData + entry->dataOffset, entry->dataSize);
+    if (methodData == NULL)
+    {
+        return NULL;
+    }
 
-        if (!WriteInstrumentationSchema(schemaElements.GetElements(), schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+    // Point the handle slots at the strings in the mapped file, tagged in the same way as by the text format reader
+    for (COUNT_T iSchema = 0; iSchema < schemaArray.GetCount(); iSchema++)
+    {
+        const ICorJitInfo::PgoInstrumentationSchema& schema = schemaArray[iSchema];
+        ICorJitInfo::PgoInstrumentationKind kind = schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask;
+        if ((kind != ICorJitInfo::PgoInstrumentationKind::TypeHandle) && (kind != ICorJitInfo::PgoInstrumentationKind::MethodHandle))
         {
-            _ASSERTE(!"Unable to write schema");
-            return;
+            continue;
         }
 
-        methodInstrumentationData.Copy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, methodInstrumentationData.Begin(), methodInstrumentationData.GetCount());
+        for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+        {
+            INT_PTR* handleValueAddress = (INT_PTR*)(methodData->GetData() + schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind));
+            size_t stringOffset = (size_t)*handleValueAddress;
+            INT_PTR ptrVal = 0;
+            if ((stringOffset != 0) && ((stringOffset & 1) == 0) && (stringOffset < fileSize) &&
+                (memchr(fileData + stringOffset, 0, fileSize - stringOffset) != NULL))
+            {
+                ptrVal = (INT_PTR)(fileData + stringOffset) + 1;
+            }
+            *handleValueAddress = ptrVal;
+        }
+    }
 
-        s_textFormatPgoData.Add(methodData);
-        probes += schemaCount;
+    CrstHolder lock(&s_pgoMgrLock);
+    Header* decoded = s_binaryFormatPgoCache.Lookup(key);
+    if (decoded != NULL)
+    {
+        free(methodData);
+        return decoded;
     }
+
+    s_binaryFormatPgoCache.Add(methodData);
+    return methodData;
 }
 #endif // DACCESS_COMPILE
 
@@ -818,7 +1206,7 @@ HRESULT PgoManager::getPgoInstrumentationResults(MethodDesc* pMD, BYTE** pAlloca
 
     // If there is text format PGO data, prefer that over any dynamic or static data.
     //
-    if (s_textFormatPgoData.GetCount() > 0)
+    if ((s_textFormatPgoData.GetCount() > 0) || (s_binaryFormatPgoData != NULL))
     {
         hr = getPgoInstrumentationResultsFromText(pMD, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource);
     }
@@ -857,6 +1245,11 @@ HRESULT PgoManager::getPgoInstrumentationResultsFromText(MethodDesc* pMD, BYTE**
 
     COUNT_T methodhash = pMD->GetStableHash();
     Header* found = s_textFormatPgoData.Lookup(CodeAndMethodHash(codehash, methodhash));
+    if ((found == NULL) && (s_binaryFormatPgoData != NULL))
+    {
+        found = LookupBinaryPgoData(codehash, methodhash);
+    }
+
     if (found == NULL)
     {
         return E_NOTIMPL;
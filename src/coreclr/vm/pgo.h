@@ -161,6 +161,40 @@ private:
 
     static void ReadPgoData();
     static void WritePgoData();
+    static void WriteBinaryPgoData(LPCWSTR fileName, int pgoDataCount);
+
+    static Header* CreateTextFormatHeader(unsigned methodhash, unsigned codehash, unsigned ilSize, ICorJitInfo::PgoInstrumentationSchema* pSchema, UINT32 countSchemaItems, const uint8_t* pInstrumentationData, size_t instrumentationDataSize);
+
+    // The binary format is a memory mapped file holding the same data as the text format, with a hash index keyed by
+    // CodeAndMethodHash. The file is only mapped at startup, and the data for a method is decoded the first time that
+    // the method is looked up.
+    struct BinaryPgoFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t pointerSize;
+        uint32_t methodCount;
+        uint32_t bucketCount;   // Must be a power of 2
+        uint32_t bucketsOffset; // bucketCount + 1 indices into the method entries, which are sorted by bucket
+        uint32_t entriesOffset;
+    };
+
+    struct BinaryPgoMethodEntry
+    {
+        uint32_t codehash;
+        uint32_t methodhash;
+        uint32_t ilSize;
+        uint32_t schemaOffset;  // Compressed schema, as written by WriteInstrumentationSchema
+        uint32_t schemaSize;
+        uint32_t dataOffset;    // Instrumentation data laid out from offset 0. Handle slots hold the file offset of
+        uint32_t dataSize;      //  a null terminated UTF8 string in the text format notation, or 0.
+    };
+
+    static const uint32_t s_BinaryFileMagic = 0x424F4750; // 'PGOB'
+    static const uint32_t s_BinaryFileVersion = 1;
+
+    static bool MapBinaryPgoData(LPCWSTR fileName);
+    static Header* LookupBinaryPgoData(unsigned codehash, unsigned methodhash);
 
 private:
 
@@ -179,6 +213,11 @@ private:
 
     static PtrSHash<Header, CodeAndMethodHash> s_textFormatPgoData;
 
+    // Mapped binary format data, and the methods decoded from it so far (protected by s_pgoMgrLock)
+    static const uint8_t* s_binaryFormatPgoData;
+    static size_t s_binaryFormatPgoDataSize;
+    static PtrSHash<Header, CodeAndMethodHash> s_binaryFormatPgoCache;
+
     PgoManager *m_next = NULL;
     PgoManager *m_prev = NULL;
     HeaderList *m_pgoHeaders = NULL;
@@ -998,8 +998,23 @@ PCODE MethodDesc::JitCompileCodeLocked(PrepareCodeConfig* pConfig, COR_ILMETHOD_
     {
         InterpreterPrecode* pPrecode = InterpreterPrecode::FromEntryPoint(pCode);
         InterpByteCodeStart* interpreterCode = dac_cast<InterpByteCodeStart*>(pPrecode->GetData()->ByteCodeAddr);
+#ifdef FEATURE_TIERED_COMPILATION
+        if (shouldCountCalls && g_pConfig->TieredCompilation_InterpreterTierUp())
+        {
+            // Calls from interpreted code bypass the call counting stubs, so the interpreter counts
+            // method entries and loop iterations itself.
+            interpreterCode->Method->tierUpCountdown = g_pConfig->TieredCompilation_InterpreterTierUpThreshold();
+        }
+#endif // FEATURE_TIERED_COMPILATION
         pConfig->GetMethodDesc()->SetInterpreterCode(interpreterCode);
     }
+    else if (pConfig->GetMethodDesc()->GetInterpreterCode() != NULL)
+    {
+        // The method was interpreted at a lower tier. Interpreted callers call the interpreter code
+        // directly, so clear it to make them call through the entry point, which leads to this code
+        // once it is activated.
+        pConfig->GetMethodDesc()->SetInterpreterCode(NULL);
+    }
 #endif // FEATURE_INTERPRETER
 
 #ifdef FEATURE_CODE_VERSIONING
@@ -2231,6 +2246,15 @@ PCODE MethodDesc::DoPrestub(MethodTable *pDispatchingMT, CallerGCMode callerGCMo
         if (pCode == (PCODE)NULL)
         {
             pCode = GetStubForInteropMethod(this);
+
+#ifdef FEATURE_MULTICOREJIT
+            // Record the P/Invoke so that a multi-core JIT player can generate its IL stub ahead of time
+            MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+            if (mcJitManager.IsRecorderActive() && MulticoreJitManager::IsNDirectMethodSupported(this))
+            {
+                mcJitManager.RecordMethodJitOrLoad(this);
+            }
+#endif
         }
 
         GetOrCreatePrecode();
@@ -3239,7 +3263,13 @@ PCODE DynamicHelperFixup(TransitionBlock * pTransitionBlock, TADDR * pCell, DWOR
                         }
                     }
 
-                    if (fNeedsNonTrivialHelper)
+                    if (!pMT->IsClassInitedOrPreinited())
+                    {
+                        // Delay the creation of the helper until the type is initialized. The cell keeps pointing
+                        // at the delay load helper until then, so that it gets backpatched with a helper that does
+                        // not have to check for class initialization on every access.
+                    }
+                    else if (fNeedsNonTrivialHelper)
                     {
                         if (pFD != NULL)
                         {
@@ -3259,9 +3289,7 @@ PCODE DynamicHelperFixup(TransitionBlock * pTransitionBlock, TADDR * pCell, DWOR
                     }
                     else
                     {
-                        // Delay the creation of the helper until the type is initialized
-                        if (pMT->IsClassInitedOrPreinited())
-                            pHelper = getHelperForInitializedStatic(pModule, (ReadyToRunFixupKind)kind, pMT, pFD);
+                        pHelper = getHelperForInitializedStatic(pModule, (ReadyToRunFixupKind)kind, pMT, pFD);
                     }
                 }
                 break;
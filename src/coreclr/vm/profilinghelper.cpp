@@ -220,6 +220,10 @@ void CurrentProfilerStatus::Set(ProfilerStatus newProfStatus)
 // See code:#LoadUnloadCallbackSynchronization.
 CRITSEC_COOKIE ProfilingAPIUtility::s_csStatus = NULL;
 
+// See code:ProfControlBlock#EnterLeaveSampling.
+DWORD ProfilingAPIUtility::s_dwEnterLeaveSamplingPeriodMs = 0;
+DWORD ProfilingAPIUtility::s_dwEnterLeaveSamplingWindowMs = 0;
+
 // ----------------------------------------------------------------------------
 // ProfilingAPIUtility::AppendSupplementaryInformation
 //
@@ -455,6 +459,10 @@ HRESULT ProfilingAPIUtility::InitializeProfiling()
     // Any event has been logged already by AttemptLoadProfilerForStartup, and
     // regardless of whether a profiler got loaded, we still need to continue.
 
+    // Enter/leave hooks can only be requested by startup profilers, so this is where the
+    // sampling of the hooks, if configured, gets started.
+    StartEnterLeaveSampling();
+
 
 #ifdef PROF_TEST_ONLY_FORCE_ELT
     // Test-only, debug-only code to enable ELT on startup regardless of whether a
@@ -496,6 +504,103 @@ HRESULT ProfilingAPIUtility::InitializeProfiling()
 }
 
 
+// ----------------------------------------------------------------------------
+// ProfilingAPIUtility::StartEnterLeaveSampling
+//
+// Description:
+//    If ProfAPI_EnterLeaveSamplingPeriodMs is set and a loaded profiler asked for the
+//    enter/leave/tailcall hooks, creates the thread that turns the hooks on for a window at
+//    the start of every sampling period. The JIT then emits a check of the flag the thread
+//    toggles before each hook, so the hooks cost a compare and a branch outside of the
+//    windows. If the thread cannot be created, the hooks are called unconditionally as usual.
+//
+
+// static
+void ProfilingAPIUtility::StartEnterLeaveSampling()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    DWORD dwPeriodMs = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ProfAPI_EnterLeaveSamplingPeriodMs);
+    DWORD dwWindowMs = max(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ProfAPI_EnterLeaveSamplingWindowMs), (DWORD)1);
+
+    // A window that covers the whole period is the same as not sampling
+    if ((dwWindowMs >= dwPeriodMs) || !CORProfilerTrackEnterLeave())
+    {
+        return;
+    }
+
+    s_dwEnterLeaveSamplingPeriodMs = dwPeriodMs;
+    s_dwEnterLeaveSamplingWindowMs = dwWindowMs;
+
+    // The sampling thread is intentionally not an EE Thread-object thread (it won't
+    // execute managed code).
+    HandleHolder hSamplingThread;
+    hSamplingThread = ::CreateThread(
+        NULL,       // lpThreadAttributes; don't want child processes inheriting this handle
+        0,          // dwStackSize (0 = use default)
+        EnterLeaveSamplingThreadStart,
+        NULL,       // lpParameter (none to pass)
+        0,          // dwCreationFlags (0 = use default flags, start thread immediately)
+        NULL        // lpThreadId (don't need thread ID)
+        );
+    if (hSamplingThread == NULL)
+    {
+        LOG((
+            LF_CORPROF,
+            LL_ERROR,
+            "**PROF: Failed to create enter/leave sampling thread.  GetLastError=%d.\n",
+            GetLastError()));
+
+        return;
+    }
+
+    g_profControlBlock.fEnterLeaveSamplingEnabled = TRUE;
+
+    LOG((
+        LF_CORPROF,
+        LL_INFO10,
+        "**PROF: Sampling enter/leave hooks for %u ms every %u ms.\n",
+        dwWindowMs,
+        dwPeriodMs));
+}
+
+// ----------------------------------------------------------------------------
+// ProfilingAPIUtility::EnterLeaveSamplingThreadStart
+//
+// Description:
+//    Thread proc of the enter/leave sampling thread created by
+//    code:ProfilingAPIUtility::StartEnterLeaveSampling. Runs for the lifetime of the
+//    process. A hook whose method is in flight when the flag flips gets only one of its
+//    enter and leave callbacks, which sampling profilers have to tolerate.
+//
+
+// static
+DWORD WINAPI ProfilingAPIUtility::EnterLeaveSamplingThreadStart(LPVOID)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    for (;;)
+    {
+        VolatileStore(&g_profControlBlock.enterLeaveSamplingActive, (BYTE)1);
+        ClrSleepEx(s_dwEnterLeaveSamplingWindowMs, FALSE);
+
+        VolatileStore(&g_profControlBlock.enterLeaveSamplingActive, (BYTE)0);
+        ClrSleepEx(s_dwEnterLeaveSamplingPeriodMs - s_dwEnterLeaveSamplingWindowMs, FALSE);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // ProfilingAPIUtility::ProfilerCLSIDFromString
 //
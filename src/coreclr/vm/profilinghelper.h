@@ -87,6 +87,10 @@ private:
     // See code:ProfilingAPIUtility::InitializeProfiling#LoadUnloadCallbackSynchronization
     static CRITSEC_COOKIE s_csStatus;
 
+    // See code:ProfControlBlock#EnterLeaveSampling
+    static DWORD s_dwEnterLeaveSamplingPeriodMs;
+    static DWORD s_dwEnterLeaveSamplingWindowMs;
+
     // Static-only class.  Private constructor enforces you don't try to make an instance
     ProfilingAPIUtility() {}
 
@@ -110,6 +114,8 @@ private:
     static HRESULT AttemptLoadProfilerForStartup();
     static HRESULT AttemptLoadDelayedStartupProfilers();
     static HRESULT AttemptLoadProfilerList();
+    static void StartEnterLeaveSampling();
+    static DWORD WINAPI EnterLeaveSamplingThreadStart(LPVOID);
 
     static void AppendSupplementaryInformation(int iStringResource, SString * pString);
 
@@ -325,6 +325,7 @@ static const Entry s_QCall[] =
     DllImportEntry(GCInterface_ReRegisterForFinalize)
     DllImportEntry(GCInterface_GetNextFinalizableObject)
     DllImportEntry(GCInterface_WaitForPendingFinalizers)
+    DllImportEntry(GCInterface_GetFinalizationStatistics)
     DllImportEntry(GCInterface_AddMemoryPressure)
     DllImportEntry(GCInterface_RemoveMemoryPressure)
 #ifdef FEATURE_BASICFREEZE
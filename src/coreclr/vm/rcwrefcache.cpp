@@ -172,6 +172,10 @@ void RCWRefCache::ShrinkDependentHandles()
     {
         OBJECTHANDLE depHnd = m_depHndList[i];
 
+        // Already cleared by a previous GC
+        if (ObjectFromHandle(depHnd) == NULL)
+            continue;
+
         IGCHandleManager *mgr = GCHandleUtilities::GetGCHandleManager();
         mgr->StoreObjectInHandle(depHnd, NULL);
         mgr->SetDependentHandleSecondary(depHnd, NULL);
@@ -258,14 +262,20 @@ HRESULT RCWRefCache::AddReferenceUsingDependentHandle(OBJECTREF obj1, OBJECTREF
         // Yes, there is a valid DependentHandle entry on the list, use that
         OBJECTHANDLE depHnd = (OBJECTHANDLE) m_depHndList[m_dwDepHndListFreeIndex];
 
+        // The references are found in the same order from one GC to the next, so when the
+        // reference graph hasn't changed, the slot already holds this reference and the
+        // handle writes (and their write barriers) can be skipped.
         IGCHandleManager *mgr = GCHandleUtilities::GetGCHandleManager();
-        mgr->StoreObjectInHandle(depHnd, OBJECTREFToObject(obj1));
-        mgr->SetDependentHandleSecondary(depHnd, OBJECTREFToObject(obj2));
+        if (ObjectFromHandle(depHnd) != obj1 || mgr->GetDependentHandleSecondary(depHnd) != OBJECTREFToObject(obj2))
+        {
+            mgr->StoreObjectInHandle(depHnd, OBJECTREFToObject(obj1));
+            mgr->SetDependentHandleSecondary(depHnd, OBJECTREFToObject(obj2));
 
-        STRESS_LOG3(
-            LF_INTEROP, LL_INFO1000,
-            "\t[RCWRefCache 0x%p] Reused DependentHandle 0x%p @ valid SLOT %d\n",
-            this, depHnd, m_dwDepHndListFreeIndex);
+            STRESS_LOG3(
+                LF_INTEROP, LL_INFO1000,
+                "\t[RCWRefCache 0x%p] Reused DependentHandle 0x%p @ valid SLOT %d\n",
+                this, depHnd, m_dwDepHndListFreeIndex);
+        }
 
         // Increment the index and the next one will be used
         m_dwDepHndListFreeIndex++;
@@ -256,10 +256,27 @@ public:
     }
 };
 
+// Layout of the arguments of a signature that has only primitive types and object references as arguments and return
+// value. The layout depends only on the shape of the signature, so it is computed once and shared by all methods with
+// the same shape. This makes the first invoke of a method with a known shape skip the signature walk, and all invokes
+// skip the argument iteration.
+struct MethodInvokeLayout
+{
+    uint64_t Shape;
+    // The cached flags of the argument iterator, without the flags specific to the method
+    DWORD ArgIteratorFlags;
+    UINT SizeOfArgStack;
+#ifdef CALLDESCR_REGTYPEMAP
+    UINT64 RegTypeMap;
+#endif
+    UINT NumArgs;
+    int ArgOffsets[0];
+};
+
 class ArgIteratorForMethodInvoke : public ArgIteratorTemplate<ArgIteratorBaseForMethodInvoke>
 {
 public:
-    ArgIteratorForMethodInvoke(SIGNATURENATIVEREF * ppNativeSig, BOOL fCtorOfVariableSizedObject)
+    ArgIteratorForMethodInvoke(SIGNATURENATIVEREF * ppNativeSig, BOOL fCtorOfVariableSizedObject, const MethodInvokeLayout * pLayout = NULL)
     {
         m_ppNativeSig = ppNativeSig;
 
@@ -279,7 +296,16 @@ public:
         // Compute flags and stack argument size, and cache them for next invocation
         //
 
-        ForceSigWalk();
+        if (pLayout != NULL)
+        {
+            // The signature has the same shape as a signature that was walked already
+            m_dwFlags = pLayout->ArgIteratorFlags;
+            m_nSizeOfArgStack = pLayout->SizeOfArgStack;
+        }
+        else
+        {
+            ForceSigWalk();
+        }
 
         if (IsActivationNeededForMethodInvoke((*m_ppNativeSig)->GetMethod()))
         {
@@ -299,8 +325,177 @@ public:
         LIMITED_METHOD_CONTRACT;
         return (m_dwFlags & METHOD_INVOKE_NEEDS_ACTIVATION) != 0;
     }
+
+    DWORD GetMethodIndependentFlags()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_dwFlags & ~(ITERATION_STARTED | METHOD_INVOKE_NEEDS_ACTIVATION);
+    }
+};
+
+enum MethodInvokeShapeKind
+{
+    MethodInvokeShapeKindNone,
+    MethodInvokeShapeKindInt1,
+    MethodInvokeShapeKindInt2,
+    MethodInvokeShapeKindInt4,
+    MethodInvokeShapeKindInt8,
+    MethodInvokeShapeKindPointer,
+    MethodInvokeShapeKindFloat,
+    MethodInvokeShapeKindDouble,
+    MethodInvokeShapeKindVoid,
 };
 
+// Number of bits used for "this", for the return value and for each of the arguments in the shape
+#define METHOD_INVOKE_SHAPE_HEADER_BITS 5
+#define METHOD_INVOKE_SHAPE_KIND_BITS 4
+#define METHOD_INVOKE_SHAPE_MAX_ARGS ((64 - METHOD_INVOKE_SHAPE_HEADER_BITS) / METHOD_INVOKE_SHAPE_KIND_BITS)
+
+// Number of entries in the direct mapped cache of the layouts
+#define METHOD_INVOKE_LAYOUT_CACHE_SIZE 256
+
+static MethodInvokeLayout* s_methodInvokeLayouts[METHOD_INVOKE_LAYOUT_CACHE_SIZE];
+
+static MethodInvokeShapeKind GetMethodInvokeShapeKind(CorElementType type)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    switch (type)
+    {
+        case ELEMENT_TYPE_BOOLEAN:
+        case ELEMENT_TYPE_I1:
+        case ELEMENT_TYPE_U1:
+            return MethodInvokeShapeKindInt1;
+        case ELEMENT_TYPE_CHAR:
+        case ELEMENT_TYPE_I2:
+        case ELEMENT_TYPE_U2:
+            return MethodInvokeShapeKindInt2;
+        case ELEMENT_TYPE_I4:
+        case ELEMENT_TYPE_U4:
+            return MethodInvokeShapeKindInt4;
+        case ELEMENT_TYPE_I8:
+        case ELEMENT_TYPE_U8:
+            return MethodInvokeShapeKindInt8;
+        case ELEMENT_TYPE_I:
+        case ELEMENT_TYPE_U:
+        case ELEMENT_TYPE_CLASS:
+        case ELEMENT_TYPE_OBJECT:
+        case ELEMENT_TYPE_STRING:
+        case ELEMENT_TYPE_PTR:
+        case ELEMENT_TYPE_BYREF:
+        case ELEMENT_TYPE_ARRAY:
+        case ELEMENT_TYPE_SZARRAY:
+        case ELEMENT_TYPE_FNPTR:
+            return MethodInvokeShapeKindPointer;
+        case ELEMENT_TYPE_R4:
+            return MethodInvokeShapeKindFloat;
+        case ELEMENT_TYPE_R8:
+            return MethodInvokeShapeKindDouble;
+        case ELEMENT_TYPE_VOID:
+            return MethodInvokeShapeKindVoid;
+        default:
+            return MethodInvokeShapeKindNone;
+    }
+}
+
+// Compute the shape of the signature from the presence of "this" and the kinds of the return value and arguments.
+// Returns false if the signature has arguments or return value that are not primitive types or object references.
+static bool GetMethodInvokeShape(SIGNATURENATIVEREF pSig, BOOL fHasThis, uint64_t * pShape)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    UINT nNumArgs = pSig->NumFixedArgs();
+    if (nNumArgs > METHOD_INVOKE_SHAPE_MAX_ARGS)
+        return false;
+
+    MethodInvokeShapeKind returnKind = GetMethodInvokeShapeKind(pSig->GetReturnTypeHandle().GetInternalCorElementType());
+    if (returnKind == MethodInvokeShapeKindNone)
+        return false;
+
+    uint64_t shape = ((uint64_t)returnKind << 1) | (fHasThis ? 1 : 0);
+
+    for (UINT i = 0; i < nNumArgs; i++)
+    {
+        MethodInvokeShapeKind argKind = GetMethodInvokeShapeKind(pSig->GetArgumentAt(i).GetInternalCorElementType());
+        if (argKind == MethodInvokeShapeKindNone || argKind == MethodInvokeShapeKindVoid)
+            return false;
+
+        shape |= (uint64_t)argKind << (METHOD_INVOKE_SHAPE_HEADER_BITS + i * METHOD_INVOKE_SHAPE_KIND_BITS);
+    }
+
+    *pShape = shape;
+    return true;
+}
+
+// Get the argument layout for the signature from the cache, or compute it and add it to the cache if the cache entry
+// is free. Returns NULL if the signature shape is not supported or the cache entry is used by another shape.
+static const MethodInvokeLayout* GetMethodInvokeLayout(SIGNATURENATIVEREF * ppSig, BOOL fCtorOfVariableSizedObject)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    uint64_t shape;
+    if (!GetMethodInvokeShape(*ppSig, (*ppSig)->HasThis() && !fCtorOfVariableSizedObject, &shape))
+        return NULL;
+
+    MethodInvokeLayout** ppEntry = &s_methodInvokeLayouts[(shape ^ (shape >> 32)) % METHOD_INVOKE_LAYOUT_CACHE_SIZE];
+    MethodInvokeLayout* pLayout = VolatileLoad(ppEntry);
+    if (pLayout != NULL)
+    {
+        return (pLayout->Shape == shape) ? pLayout : NULL;
+    }
+
+    UINT nNumArgs = (*ppSig)->NumFixedArgs();
+
+    // This computes the flags and the stack size and caches them in the signature, so the iterator used for the call
+    // doesn't need to compute them again.
+    ArgIteratorForMethodInvoke argit(ppSig, fCtorOfVariableSizedObject);
+
+    AllocMemTracker amTracker;
+    S_SIZE_T cbLayout = S_SIZE_T(sizeof(MethodInvokeLayout)) + S_SIZE_T(sizeof(int)) * S_SIZE_T(nNumArgs);
+    pLayout = (MethodInvokeLayout*)amTracker.Track(SystemDomain::GetGlobalLoaderAllocator()->GetLowFrequencyHeap()->AllocMem(cbLayout));
+
+    pLayout->Shape = shape;
+    pLayout->SizeOfArgStack = argit.SizeOfArgStack();
+#ifdef CALLDESCR_REGTYPEMAP
+    pLayout->RegTypeMap = 0;
+#endif
+    pLayout->NumArgs = nNumArgs;
+    for (UINT i = 0; i < nNumArgs; i++)
+    {
+        int ofs = argit.GetNextOffset();
+        _ASSERTE(ofs != TransitionBlock::InvalidOffset);
+        _ASSERTE(!argit.IsArgPassedByRef() && argit.GetArgLocDescForStructInRegs() == NULL);
+#ifdef CALLDESCR_REGTYPEMAP
+        FillInRegTypeMap(ofs, argit.GetArgType(), (BYTE *)&pLayout->RegTypeMap);
+#endif
+        pLayout->ArgOffsets[i] = ofs;
+    }
+    // Make sure that the return flags are computed before capturing the flags
+    argit.GetFPReturnSize();
+    pLayout->ArgIteratorFlags = argit.GetMethodIndependentFlags();
+
+    if (InterlockedCompareExchangeT(ppEntry, pLayout, NULL) != NULL)
+    {
+        // Another thread has filled the cache entry, let the amTracker release the memory of our layout
+        return NULL;
+    }
+
+    amTracker.SuppressRelease();
+    return pLayout;
+}
+
 extern "C" void QCALLTYPE RuntimeMethodHandle_InvokeMethod(
     QCall::ObjectHandleOnStack target,
     PVOID* args, // An array of byrefs
@@ -364,7 +559,8 @@ extern "C" void QCALLTYPE RuntimeMethodHandle_InvokeMethod(
     }
 
     {
-    ArgIteratorForMethodInvoke argit(&gc.pSig, fCtorOfVariableSizedObject);
+    const MethodInvokeLayout* pLayout = GetMethodInvokeLayout(&gc.pSig, fCtorOfVariableSizedObject);
+    ArgIteratorForMethodInvoke argit(&gc.pSig, fCtorOfVariableSizedObject, pLayout);
 
     if (argit.IsActivationNeeded())
         pMeth->EnsureActive();
@@ -396,7 +592,7 @@ extern "C" void QCALLTYPE RuntimeMethodHandle_InvokeMethod(
     callDescrData.pFloatArgumentRegisters = NULL;
 #endif
 #ifdef CALLDESCR_REGTYPEMAP
-    callDescrData.dwRegTypeMap = 0;
+    callDescrData.dwRegTypeMap = (pLayout != NULL) ? pLayout->RegTypeMap : 0;
 #endif
     callDescrData.fpReturnSize = argit.GetFPReturnSize();
 
@@ -524,6 +720,22 @@ extern "C" void QCALLTYPE RuntimeMethodHandle_InvokeMethod(
     for (UINT i = 0 ; i < nNumArgs; i++) {
         TypeHandle th = gc.pSig->GetArgumentAt(i);
 
+        if (pLayout != NULL)
+        {
+            // Arguments of the signatures with a layout are never passed by reference or as structs in registers
+            ArgDestination argDest(pTransitionBlock, pLayout->ArgOffsets[i], NULL);
+#ifdef CALLDESCR_FPARGREGS
+            if (TransitionBlock::HasFloatRegister(pLayout->ArgOffsets[i], NULL) &&
+                (callDescrData.pFloatArgumentRegisters == NULL))
+            {
+                callDescrData.pFloatArgumentRegisters = (FloatArgumentRegisters*) (pTransitionBlock +
+                                                                                   TransitionBlock::GetOffsetOfFloatArgumentRegisters());
+            }
+#endif
+            InvokeUtil::CopyArg(th, args[i], &argDest);
+            continue;
+        }
+
         int ofs = argit.GetNextOffset();
         _ASSERTE(ofs != TransitionBlock::InvalidOffset);
 
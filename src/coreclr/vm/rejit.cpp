@@ -150,6 +150,13 @@
 /* static */
 CrstStatic ReJitManager::s_csGlobalRequest;
 
+#ifndef DACCESS_COMPILE
+CrstStatic ReJitManager::s_csPendingRequests;
+CDynArray<ReJitManager::PendingReJITRequest> *ReJitManager::s_pPendingRequests = NULL;
+CLREventStatic ReJitManager::s_pendingRequestsAvailableEvent;
+bool ReJitManager::s_isBatchWorkerRunning = false;
+#endif // !DACCESS_COMPILE
+
 
 //---------------------------------------------------------------------------------------
 // Helpers
@@ -441,6 +448,11 @@ COR_IL_MAP* ProfilerFunctionControl::GetInstrumentedMapEntries()
 //      may encounter its own failure, which is reported by the ReJITError()
 //      callback, which is called into the profiler directly.
 //
+// Notes:
+//      When ProfAPI_ReJitBatchWindowMs is set, the request is queued and applied
+//      later on the batch worker thread along with the other requests made around
+//      the same time. See code:ReJitManager::QueueReJITRequests.
+//
 
 // static
 HRESULT ReJitManager::RequestReJIT(
@@ -449,9 +461,313 @@ HRESULT ReJitManager::RequestReJIT(
     mdMethodDef         rgMethodDefs[],
     COR_PRF_REJIT_FLAGS flags)
 {
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        CAN_TAKE_LOCK;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (ReJitBatchWindowMs() != 0)
+    {
+        HRESULT hr = QueueReJITRequests(cFunctions, rgModuleIDs, rgMethodDefs, flags);
+        if (hr != S_FALSE)
+        {
+            return hr;
+        }
+
+        // Requests that can't be queued are applied right away, after the queued ones to
+        // keep the requests in order
+        ProcessPendingReJITRequests();
+    }
+
     return ReJitManager::UpdateActiveILVersions(cFunctions, rgModuleIDs, rgMethodDefs, NULL, FALSE, flags);
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Queues a RequestReJIT call for the batch worker, which waits for ProfAPI_ReJitBatchWindowMs
+// after being woken up, so that requests made in quick succession, such as those of a profiler
+// instrumenting methods one at a time, are applied by a single UpdateActiveILVersions call.
+// That takes the rejit and code versioning locks and enumerates the loaded instantiations once
+// per batch rather than once per request.
+//
+// Return Value:
+//      S_OK if the request was queued, S_FALSE if it must be applied right away, or a
+//      failure HRESULT.
+//
+// Notes:
+//      Requests for methods in collectible modules are not queued, as the module could be
+//      unloaded before the batch is applied.
+//
+
+// static
+HRESULT ReJitManager::QueueReJITRequests(
+    ULONG               cFunctions,
+    ModuleID            rgModuleIDs[],
+    mdMethodDef         rgMethodDefs[],
+    COR_PRF_REJIT_FLAGS flags)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        CAN_TAKE_LOCK;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    for (ULONG i = 0; i < cFunctions; i++)
+    {
+        Module * pModule = reinterpret_cast< Module * >(rgModuleIDs[i]);
+        if (pModule == NULL || pModule->IsCollectible())
+        {
+            return S_FALSE;
+        }
+    }
+
+    bool createBatchWorker = false;
+    {
+        CrstHolder ch(&s_csPendingRequests);
+
+        if (s_pPendingRequests == NULL)
+        {
+            s_pPendingRequests = new (nothrow) CDynArray<PendingReJITRequest>();
+            if (s_pPendingRequests == NULL)
+            {
+                return E_OUTOFMEMORY;
+            }
+        }
+
+        for (ULONG i = 0; i < cFunctions; i++)
+        {
+            PendingReJITRequest * pRequest = s_pPendingRequests->Append();
+            if (pRequest == NULL)
+            {
+                return E_OUTOFMEMORY;
+            }
+
+            pRequest->m_moduleID = rgModuleIDs[i];
+            pRequest->m_methodDef = rgMethodDefs[i];
+            pRequest->m_flags = flags;
+        }
+
+        if (!s_isBatchWorkerRunning)
+        {
+            s_isBatchWorkerRunning = true;
+            createBatchWorker = true;
+        }
+    }
+
+    if (createBatchWorker)
+    {
+        bool createdBatchWorker = true;
+        EX_TRY
+        {
+            CreateBatchWorker();
+        }
+        EX_CATCH
+        {
+            {
+                CrstHolder ch(&s_csPendingRequests);
+                s_isBatchWorkerRunning = false;
+            }
+
+            STRESS_LOG1(LF_CORPROF, LL_WARNING, "ReJitManager::QueueReJITRequests: "
+                "Exception creating batch worker, hr=0x%x\n",
+                GET_EXCEPTION()->GetHR());
+            createdBatchWorker = false;
+        }
+        EX_END_CATCH
+
+        // Without a worker, the requests are applied on this thread
+        if (!createdBatchWorker)
+        {
+            return ProcessPendingReJITRequests();
+        }
+    }
+
+    s_pendingRequestsAvailableEvent.Set();
+    return S_OK;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Applies the queued RequestReJIT calls. Consecutive requests with the same flags, which
+// are usually all of them, are applied together. The global request lock is held
+// throughout, so a request that waits for the queue to be drained can't overtake a batch
+// that is being applied on another thread.
+//
+// Return Value:
+//      HRESULT indicating success or failure of the overall operation. Failures for
+//      individual methods are reported through the ReJITError() callback.
+//
+
+// static
+HRESULT ReJitManager::ProcessPendingReJITRequests()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        CAN_TAKE_LOCK;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    CrstHolder ch(&(s_csGlobalRequest));
+
+    NewHolder<CDynArray<PendingReJITRequest>> pRequests;
+    {
+        CrstHolder chPending(&s_csPendingRequests);
+        pRequests = s_pPendingRequests;
+        s_pPendingRequests = NULL;
+    }
+
+    if (pRequests == NULL)
+    {
+        return S_OK;
+    }
+
+    PendingReJITRequest * rgRequests = pRequests->Ptr();
+    int cRequests = pRequests->Count();
+    NewArrayHolder<ModuleID> rgModuleIDs = new (nothrow) ModuleID[cRequests];
+    NewArrayHolder<mdMethodDef> rgMethodDefs = new (nothrow) mdMethodDef[cRequests];
+    if (rgModuleIDs == NULL || rgMethodDefs == NULL)
+    {
+        return E_OUTOFMEMORY;
+    }
+
+    HRESULT hrResult = S_OK;
+    int i = 0;
+    while (i < cRequests)
+    {
+        COR_PRF_REJIT_FLAGS flags = rgRequests[i].m_flags;
+        ULONG cFunctions = 0;
+        for (; i < cRequests && rgRequests[i].m_flags == flags; i++, cFunctions++)
+        {
+            rgModuleIDs[cFunctions] = rgRequests[i].m_moduleID;
+            rgMethodDefs[cFunctions] = rgRequests[i].m_methodDef;
+        }
+
+        HRESULT hr = UpdateActiveILVersions(cFunctions, rgModuleIDs, rgMethodDefs, NULL, FALSE, flags);
+        if (FAILED(hr) && SUCCEEDED(hrResult))
+        {
+            hrResult = hr;
+        }
+    }
+
+    return hrResult;
+}
+
+void ReJitManager::CreateBatchWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (!s_pendingRequestsAvailableEvent.IsValid())
+    {
+        s_pendingRequestsAvailableEvent.CreateAutoEvent(false);
+    }
+
+    Thread *newThread = SetupUnstartedThread();
+    _ASSERTE(newThread != nullptr);
+#ifdef FEATURE_COMINTEROP
+    newThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+#endif
+    newThread->SetBackground(true);
+
+    if (!newThread->CreateNewThread(0, BatchWorkerBootstrapper0, newThread, W(".NET ReJIT Batch Worker")))
+    {
+        newThread->DecExternalCount(false);
+        ThrowOutOfMemory();
+    }
+
+    newThread->StartThread();
+}
+
+DWORD WINAPI ReJitManager::BatchWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        {
+            CrstHolder ch(&s_csPendingRequests);
+            s_isBatchWorkerRunning = false;
+        }
+
+        // Apply whatever is queued here, a later request will try to create the worker again
+        ProcessPendingReJITRequests();
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(BatchWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void ReJitManager::BatchWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    BatchWorkerStart();
+}
+
+void ReJitManager::BatchWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // The worker lives for the rest of the process, it only runs when requests are queued
+    for (;;)
+    {
+        s_pendingRequestsAvailableEvent.Wait(INFINITE, FALSE);
+
+        // Let requests made in quick succession join the batch
+        ClrSleepEx(ReJitBatchWindowMs(), FALSE);
+
+        HRESULT hr = ProcessPendingReJITRequests();
+        if (FAILED(hr))
+        {
+            STRESS_LOG1(LF_CORPROF, LL_WARNING, "ReJitManager::BatchWorkerStart: "
+                "Failed to apply queued rejit requests, hr=0x%x\n", hr);
+        }
+    }
+}
+
 // static
 HRESULT ReJitManager::UpdateActiveILVersions(
     ULONG               cFunctions,
@@ -943,6 +1259,12 @@ HRESULT ReJitManager::RequestRevert(
     }
     CONTRACTL_END;
 
+    // Apply any queued rejit requests first, so they can't undo the revert
+    if (ReJitBatchWindowMs() != 0)
+    {
+        ProcessPendingReJITRequests();
+    }
+
     return UpdateActiveILVersions(cFunctions, rgModuleIDs, rgMethodDefs, rgHrStatuses, TRUE, static_cast<COR_PRF_REJIT_FLAGS>(0));
 }
 
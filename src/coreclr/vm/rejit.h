@@ -88,6 +88,21 @@ private:
     // RequestRevert (which modify multiple ReJitManager instances).
     static CrstStatic s_csGlobalRequest;
 
+    // A RequestReJIT call queued when ProfAPI_ReJitBatchWindowMs is set. See
+    // code:ReJitManager::QueueReJITRequests.
+    struct PendingReJITRequest
+    {
+        ModuleID            m_moduleID;
+        mdMethodDef         m_methodDef;
+        COR_PRF_REJIT_FLAGS m_flags;
+    };
+
+    // Protects s_pPendingRequests and s_isBatchWorkerRunning
+    static CrstStatic s_csPendingRequests;
+    static CDynArray<PendingReJITRequest> *s_pPendingRequests;
+    static CLREventStatic s_pendingRequestsAvailableEvent;
+    static bool s_isBatchWorkerRunning;
+
 #endif //FEATURE_REJIT
 
 public:
@@ -182,6 +197,21 @@ private:
         ILCodeVersion      *pILCodeVersion,
         COR_PRF_REJIT_FLAGS flags);
 
+#ifndef DACCESS_COMPILE
+    static HRESULT QueueReJITRequests(
+        ULONG               cFunctions,
+        ModuleID            rgModuleIDs[],
+        mdMethodDef         rgMethodDefs[],
+        COR_PRF_REJIT_FLAGS flags);
+
+    static HRESULT ProcessPendingReJITRequests();
+
+    static void CreateBatchWorker();
+    static DWORD WINAPI BatchWorkerBootstrapper0(LPVOID args);
+    static void BatchWorkerBootstrapper1(LPVOID args);
+    static void BatchWorkerStart();
+#endif // !DACCESS_COMPILE
+
 #endif // FEATURE_REJIT
 
 };
@@ -17,7 +17,10 @@ inline void ReJitManager::InitStatic()
 {
     STANDARD_VM_CONTRACT;
 
-    s_csGlobalRequest.Init(CrstReJITGlobalRequest);
+    // Reentrant since the queued requests are applied while the lock is held, see
+    // code:ReJitManager::ProcessPendingReJITRequests
+    s_csGlobalRequest.Init(CrstReJITGlobalRequest, CrstFlags(CRST_REENTRANCY));
+    s_csPendingRequests.Init(CrstLeafLock);
 }
 
 static BOOL RejitOnAttachEnabled()
@@ -28,6 +31,14 @@ static BOOL RejitOnAttachEnabled()
     return rejitOnAttachEnabled.val(CLRConfig::EXTERNAL_ProfAPI_RejitOnAttach) != 0;
 }
 
+static DWORD ReJitBatchWindowMs()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static ConfigDWORD rejitBatchWindowMs;
+    return rejitBatchWindowMs.val(CLRConfig::EXTERNAL_ProfAPI_ReJitBatchWindowMs);
+}
+
 // static
 inline BOOL ReJitManager::IsReJITEnabled()
 {
@@ -227,7 +227,8 @@ SpinLock::SpinToAcquire()
              ulSpins < i;
              ulSpins++)
         {
-            YieldProcessorNormalized(normalizationInfo); // indicate to the processor that we are spinning
+            // indicate to the processor that we are spinning, waiting for the lock to be released
+            YieldProcessorNormalized(normalizationInfo, (const volatile uint32_t *)&m_lock, 1);
 
             // Note: Must use Volatile to ensure the lock is
             // refetched from memory.
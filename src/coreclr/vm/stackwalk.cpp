@@ -3058,10 +3058,18 @@ void StackFrameIterator::PreProcessingForManagedFrames(void)
 #endif // RECORD_RESUMABLE_FRAME_SP
 
 #if !defined(DACCESS_COMPILE)
-    m_pCachedGSCookie = (GSCookie*)m_crawl.GetCodeManager()->GetGSCookieAddr(
-                                                        m_crawl.pRD,
-                                                        &m_crawl.codeInfo,
-                                                        m_codeManFlags);
+    // Locating the GS cookie decodes the GC info of the method, don't bother when the cookie is not going to be checked
+    if (!(m_flags & SKIP_GSCOOKIE_CHECK))
+    {
+        m_pCachedGSCookie = (GSCookie*)m_crawl.GetCodeManager()->GetGSCookieAddr(
+                                                            m_crawl.pRD,
+                                                            &m_crawl.codeInfo,
+                                                            m_codeManFlags);
+    }
+    else
+    {
+        m_pCachedGSCookie = NULL;
+    }
 #endif // !DACCESS_COMPILE
 
     if (!(m_flags & SKIP_GSCOOKIE_CHECK) && m_pCachedGSCookie)
@@ -39,6 +39,12 @@
     will all come before destruction of the map, the hash table is safe for multiple readers,
     and we know the StringLiteralEntry so found 1) can't be destroyed because that table keeps
     an AddRef on it and 2) isn't internally modified once created.
+
+    The same holds for the frozen string table of the GlobalStringLiteralMap: frozen entries
+    are always alive (AddRef/Release are no-ops on them) and are never deleted from that table,
+    so ldstr and String.Intern of the common (frozen) literals never need the global lock.
+    A string is only ever added to one of the two global tables, since both are checked under
+    the lock before adding.
 */
 
 #define GLOBAL_STRING_TABLE_BUCKET_SIZE 128
@@ -158,6 +164,19 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Frozen literals are immortal and can be handed out without the lock or an AddRef.
+    StringLiteralEntry *pFrozenEntry = SystemDomain::GetGlobalStringLiteralMap()->LookupFrozenStringLiteral(pStringData, dwHash);
+    if (pFrozenEntry != NULL)
+    {
+        STRINGREF *pStrObj = pFrozenEntry->GetStringObject();
+        if (ppPinnedString != nullptr && !bIsCollectible)
+        {
+            *ppPinnedString = *reinterpret_cast<void**>(pStrObj);
+        }
+        return pStrObj;
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
@@ -243,6 +262,12 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     }
     else
     {
+        StringLiteralEntry *pFrozenEntry = SystemDomain::GetGlobalStringLiteralMap()->LookupFrozenStringLiteral(&StringData, dwHash);
+        if (pFrozenEntry != NULL)
+        {
+            return pFrozenEntry->GetStringObject();
+        }
+
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
         // TODO: We can be more efficient by checking our local hash table now to see if
@@ -296,6 +321,7 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
 
 GlobalStringLiteralMap::GlobalStringLiteralMap()
 : m_StringToEntryHashTable(NULL)
+, m_FrozenStringToEntryHashTable(NULL)
 , m_MemoryPool(NULL)
 , m_HashTableCrstGlobal(CrstGlobalStrLiteralMap)
 , m_PinnedHeapHandleTable(GLOBAL_STRING_TABLE_BUCKET_SIZE)
@@ -331,9 +357,11 @@ GlobalStringLiteralMap::~GlobalStringLiteralMap()
     {
         // if this isn't the real global table then it must be empty
         _ASSERTE(m_StringToEntryHashTable->IsEmpty());
+        _ASSERTE(m_FrozenStringToEntryHashTable->IsEmpty());
 
-        // Delete the hash table first. The dtor of the hash table would clean up all the entries.
+        // Delete the hash tables first. The dtor of the hash table would clean up all the entries.
         delete m_StringToEntryHashTable;
+        delete m_FrozenStringToEntryHashTable;
         // Delete the pool later, since the dtor above would need it.
         delete m_MemoryPool;
     }
@@ -361,9 +389,36 @@ void GlobalStringLiteralMap::Init()
 
     m_StringToEntryHashTable =  new EEUnicodeStringLiteralHashTable ();
 
+    m_FrozenStringToEntryHashTable =  new EEUnicodeStringLiteralHashTable ();
+
     LockOwner lock = {&m_HashTableCrstGlobal, IsOwnerOfCrst};
     if (!m_StringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
         ThrowOutOfMemory();
+    if (!m_FrozenStringToEntryHashTable->Init(INIT_NUM_GLOBAL_STRING_BUCKETS, &lock, m_MemoryPool))
+        ThrowOutOfMemory();
+}
+
+StringLiteralEntry *GlobalStringLiteralMap::LookupFrozenStringLiteral(EEStringData *pStringData, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pStringData));
+    }
+    CONTRACTL_END;
+
+    HashDatum Data;
+    if (m_FrozenStringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        StringLiteralEntry *pEntry = (StringLiteralEntry*)Data;
+        _ASSERTE(pEntry->IsStringFrozen());
+        return pEntry;
+    }
+
+    return NULL;
 }
 
 StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStringData, DWORD dwHash, BOOL bAddIfNotFound, BOOL bPreferFrozenObjectHeap)
@@ -382,7 +437,13 @@ StringLiteralEntry *GlobalStringLiteralMap::GetStringLiteral(EEStringData *pStri
     HashDatum Data;
     StringLiteralEntry *pEntry = NULL;
 
-    if (m_StringToEntryHashTable->GetValueSpeculative(pStringData, &Data, dwHash)) // Since we hold the critical section here, we can safely use the speculative variant of GetValue
+    // Since we hold the critical section here, we can safely use the speculative variant of GetValue
+    if (m_FrozenStringToEntryHashTable->GetValueSpeculative(pStringData, &Data, dwHash))
+    {
+        // Frozen entries are always alive, no need to addref them.
+        pEntry = (StringLiteralEntry*)Data;
+    }
+    else if (m_StringToEntryHashTable->GetValueSpeculative(pStringData, &Data, dwHash))
     {
         pEntry = (StringLiteralEntry*)Data;
         // If the entry is already in the table then addref it before we return it.
@@ -418,7 +479,12 @@ StringLiteralEntry *GlobalStringLiteralMap::GetInternedString(STRINGREF *pString
     HashDatum Data;
     StringLiteralEntry *pEntry = NULL;
 
-    if (m_StringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
+    if (m_FrozenStringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
+    {
+        // Frozen entries are always alive, no need to addref them.
+        pEntry = (StringLiteralEntry*)Data;
+    }
+    else if (m_StringToEntryHashTable->GetValue(&StringData, &Data, dwHash))
     {
         pEntry = (StringLiteralEntry*)Data;
         // If the entry is already in the table then addref it before we return it.
@@ -505,7 +571,7 @@ StringLiteralEntry *GlobalStringLiteralMap::AddStringLiteral(EEStringData *pStri
     {
         _ASSERT(preferFrozenObjHeap);
         StringLiteralEntryHolder pEntry(StringLiteralEntry::AllocateFrozenEntry(pStringData, strObj));
-        m_StringToEntryHashTable->InsertValue(pStringData, pEntry, FALSE);
+        m_FrozenStringToEntryHashTable->InsertValue(pStringData, pEntry, FALSE);
         pEntry.SuppressRelease();
         pRet = pEntry;
         _ASSERT(pRet->IsStringFrozen());
@@ -554,7 +620,7 @@ StringLiteralEntry *GlobalStringLiteralMap::AddInternedString(STRINGREF *pString
     StringLiteralEntry* pRet;
 
     {
-        // All frozen strings are expected to be registered in m_StringToEntryHashTable, we might relax this assert
+        // All frozen strings are expected to be registered in m_FrozenStringToEntryHashTable, we might relax this assert
         // in future if we start allocating frozen strings for non-literals
         _ASSERT(!GCHeapUtilities::GetGCHeap()->IsInFrozenSegment(STRINGREFToObject(*pString)));
 
@@ -76,6 +76,9 @@ public:
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
     StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
 
+    // Method to look up a frozen string literal. Does not require the lock.
+    StringLiteralEntry *LookupFrozenStringLiteral(EEStringData *pStringData, DWORD dwHash);
+
     // Method to calculate the hash
     DWORD GetHash(EEStringData* pData)
     {
@@ -103,7 +106,11 @@ private:
     // Hash tables that maps a Unicode string to a LiteralStringEntry.
     EEUnicodeStringLiteralHashTable    *m_StringToEntryHashTable;
 
-    // The memorypool for hash entries for this hash table.
+    // Hash table for the entries whose string lives on the frozen object heap. These entries are
+    // never released, so nothing is ever deleted from this table and it can be read without the lock.
+    EEUnicodeStringLiteralHashTable    *m_FrozenStringToEntryHashTable;
+
+    // The memorypool for hash entries for both hash tables.
     MemoryPool                  *m_MemoryPool;
 
     // The hash table table critical section.
@@ -1229,9 +1229,14 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
             if (*keyv)
             {
                 _ASSERTE (pSB);
+                DWORD hashCode = pSB->GetHashCode();
                 GCDeleteSyncBlock(pSB);
-                //clean the object syncblock header
-                ((Object*)(*keyv))->GetHeader()->GCResetIndex();
+                //clean the object syncblock header, an idle syncblock that only held a hash code is
+                //deflated back to the thin form with the hash code in the header
+                if (hashCode != 0)
+                    ((Object*)(*keyv))->GetHeader()->GCResetIndexToHashCode(hashCode);
+                else
+                    ((Object*)(*keyv))->GetHeader()->GCResetIndex();
             }
             else if (pSB)
             {
@@ -1513,7 +1518,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
     const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
     for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
     {
-        AwareLock::SpinWait(normalizationInfo, spinIteration);
+        AwareLock::SpinWait(normalizationInfo, spinIteration, (const volatile UINT32 *)m_SyncBlockValue.GetPointer());
 
         LONG oldValue = m_SyncBlockValue.LoadWithoutBarrier();
 
@@ -1537,15 +1542,19 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // The remainder of the spin is bounded by what recently worked for this lock
+            const DWORD lockSpinCount = spinIteration + awareLock->GetAdaptiveSpinCount(spinCount - spinIteration);
+            const bool spun = lockSpinCount > spinIteration + 1;
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
-                    AwareLock::SpinWait(normalizationInfo, spinIteration);
+                    AwareLock::SpinWait(normalizationInfo, spinIteration, awareLock->GetLockStateAddress());
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1554,6 +1563,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult::Entered)
                     {
+                        awareLock->RecordSpinSucceeded(spinCount);
                         return AwareLock::EnterHelperResult::Entered;
                     }
                     if (result == AwareLock::EnterHelperResult::UseSlowPath)
@@ -1565,8 +1575,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                if (spun)
+                {
+                    awareLock->RecordSpinSucceeded(spinCount);
+                }
                 return AwareLock::EnterHelperResult::Entered;
             }
+
+            if (spun)
+            {
+                awareLock->RecordSpinFailed();
+            }
             break;
         }
 
@@ -2603,7 +2622,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
                         break;
                     }
 
-                    SpinWait(normalizationInfo, spinIteration);
+                    SpinWait(normalizationInfo, spinIteration, m_lockState.GetStateAddress());
                 }
                 if (acquiredLock)
                 {
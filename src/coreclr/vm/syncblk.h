@@ -364,6 +364,12 @@ private:
         }
 
     public:
+        const volatile UINT32 *GetStateAddress() const
+        {
+            LIMITED_METHOD_CONTRACT;
+            return &m_state;
+        }
+
         LockState VolatileLoadWithoutBarrier() const
         {
             WRAPPER_NO_CONTRACT;
@@ -452,7 +458,14 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Number of spin iterations to perform on contention, adapted to the hold times observed on this lock. When
+    // zero or negative, spinning is skipped and the value counts contended acquisitions down to the next probe, see
+    // code:AwareLock::GetAdaptiveSpinCount. Updates are racy, a lost update only delays the adaptation.
+    LONG m_adaptiveSpinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const LONG AdaptiveSpinCountStep = 4;
+    static const LONG AdaptiveSpinSkipCountBeforeProbing = 100;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -462,7 +475,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_adaptiveSpinCount((LONG)g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -498,6 +512,12 @@ public:
         return m_lockState.VolatileLoadWithoutBarrier().GetState();
     }
 
+    const volatile UINT32 *GetLockStateAddress() const
+    {
+        WRAPPER_NO_CONTRACT;
+        return m_lockState.GetStateAddress();
+    }
+
     bool IsUnlockedWithNoWaiters() const
     {
         WRAPPER_NO_CONTRACT;
@@ -539,7 +559,8 @@ private: // friend access is required for this unsafe function
     }
 
 public:
-    static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
+    // The delay ends early once the value at 'address' changes from what it is at the time of the call
+    static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration, const volatile UINT32 *address);
 
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
@@ -548,6 +569,11 @@ public:
     EnterHelperResult TryEnterInsideSpinLoopHelper(Thread *pCurThread);
     bool TryEnterAfterSpinLoopHelper(Thread *pCurThread);
 
+    // Adaptive spinning, the spin loop is bounded by GetAdaptiveSpinCount() and reports its outcome back
+    DWORD GetAdaptiveSpinCount(DWORD maxSpinCount);
+    void RecordSpinSucceeded(DWORD maxSpinCount);
+    void RecordSpinFailed();
+
     // Helper encapsulating the core logic for leaving monitor. Returns what kind of
     // follow up action is necessary
     AwareLock::LeaveHelperAction LeaveHelper(Thread* pCurThread);
@@ -931,7 +957,9 @@ class SyncBlock
 
     // True is the syncblock and its index are disposable.
     // If new members are added to the syncblock, this
-    // method needs to be modified accordingly
+    // method needs to be modified accordingly.
+    // A hash code alone does not make the syncblock precious, it is moved back into
+    // the object header when the syncblock is discarded, see code:SyncBlockCache::GCWeakPtrScanElement
     BOOL IsIDisposable()
     {
         WRAPPER_NO_CONTRACT;
@@ -1006,8 +1034,13 @@ class SyncBlock
         DWORD result = InterlockedCompareExchange((LONG*)&m_dwHashCode, hashCode, 0);
         if (result == 0)
         {
-            // the sync block now holds a hash code, which we can't afford to lose.
-            SetPrecious();
+            // The sync block now holds a hash code, which we can't afford to lose. Hash codes that
+            // fit in the object header are moved back there when the sync block is discarded,
+            // any other hash code makes the sync block precious.
+            if ((hashCode & MASK_HASHCODE) != hashCode)
+            {
+                SetPrecious();
+            }
             return hashCode;
         }
         else
@@ -1384,6 +1417,17 @@ class ObjHeader
         m_SyncBlockValue.RawValue() &=~(BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX | BIT_SBLK_IS_HASHCODE | MASK_SYNCBLOCKINDEX);
     }
 
+    // Replaces the sync block index with the hash code that was stored in the discarded sync block
+    void GCResetIndexToHashCode(DWORD hashCode)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(hashCode != 0 && (hashCode & MASK_HASHCODE) == hashCode);
+
+        GCResetIndex();
+        m_SyncBlockValue.RawValue() |= BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX | BIT_SBLK_IS_HASHCODE | hashCode;
+    }
+
     // For now, use interlocked operations to twiddle bits in the bitfield portion.
     // If we ever have high-performance requirements where we can guarantee that no
     // other threads are accessing the ObjHeader, this can be reconsidered for those
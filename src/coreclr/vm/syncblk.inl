@@ -458,14 +458,65 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         (DWORD)minipal_lowres_ticks() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
-FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
+// Spinning only pays off when the lock is held for shorter than a spin. Each lock keeps track of how spinning went
+// recently: spinning that acquires the lock grows the spin count back up to the configured maximum, spinning that fails
+// halves it, down to skipping spinning entirely. A lock that stopped spinning tries again after
+// AdaptiveSpinSkipCountBeforeProbing contended acquisitions so that it can adapt to changing hold times.
+FORCEINLINE DWORD AwareLock::GetAdaptiveSpinCount(DWORD maxSpinCount)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG spinCount = VolatileLoadWithoutBarrier(&m_adaptiveSpinCount);
+    if (spinCount > 0)
+    {
+        return min((DWORD)spinCount, maxSpinCount);
+    }
+
+    if (spinCount <= -AdaptiveSpinSkipCountBeforeProbing)
+    {
+        // Probe with a short spin
+        VolatileStoreWithoutBarrier(&m_adaptiveSpinCount, AdaptiveSpinCountStep);
+        return min((DWORD)AdaptiveSpinCountStep, maxSpinCount);
+    }
+
+    VolatileStoreWithoutBarrier(&m_adaptiveSpinCount, spinCount - 1);
+    return 0;
+}
+
+FORCEINLINE void AwareLock::RecordSpinSucceeded(DWORD maxSpinCount)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG spinCount = VolatileLoadWithoutBarrier(&m_adaptiveSpinCount);
+    if (spinCount < (LONG)maxSpinCount)
+    {
+        LONG newSpinCount = max(spinCount, (LONG)0) + AdaptiveSpinCountStep;
+        VolatileStoreWithoutBarrier(&m_adaptiveSpinCount, min(newSpinCount, (LONG)maxSpinCount));
+    }
+}
+
+FORCEINLINE void AwareLock::RecordSpinFailed()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG spinCount = VolatileLoadWithoutBarrier(&m_adaptiveSpinCount);
+    if (spinCount > 0)
+    {
+        VolatileStoreWithoutBarrier(&m_adaptiveSpinCount, spinCount >= 2 * AdaptiveSpinCountStep ? spinCount / 2 : 0);
+    }
+}
+
+FORCEINLINE void AwareLock::SpinWait(
+    const YieldProcessorNormalizationInfo &normalizationInfo,
+    DWORD spinIteration,
+    const volatile UINT32 *address)
 {
     WRAPPER_NO_CONTRACT;
 
     _ASSERTE(g_SystemInfo.dwNumberOfProcessors != 1);
     _ASSERTE(spinIteration < g_SpinConstants.dwMonitorSpinCount);
 
-    YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
+    YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration, address, VolatileLoadWithoutBarrier(address));
 }
 
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
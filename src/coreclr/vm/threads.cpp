@@ -1297,6 +1297,61 @@ void Dbg_TrackSyncStack::LeaveSync(UINT_PTR caller, void *pAwareLock)
 
 static  DWORD dwHashCodeSeed = 123456789;
 
+//--------------------------------------------------------------------
+// Resources released by destroyed Thread objects that are kept for the
+// next Thread objects to be constructed, so that applications creating and
+// exiting threads at a high rate don't pay for allocating them every time.
+// Each slot is claimed and filled with a single interlocked operation, so
+// the cache can be used by threads without a Thread object and while
+// holding any lock.
+//--------------------------------------------------------------------
+template <typename T>
+class RecycledThreadResourceCache
+{
+    static const int Capacity = 16;
+
+    T* volatile m_slots[Capacity];
+
+public:
+    T* TryTake()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        for (int i = 0; i < Capacity; i++)
+        {
+            if (VolatileLoadWithoutBarrier(&m_slots[i]) != nullptr)
+            {
+                T* item = InterlockedExchangeT(&m_slots[i], nullptr);
+                if (item != nullptr)
+                    return item;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool TryAdd(T* item)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        for (int i = 0; i < Capacity; i++)
+        {
+            if (VolatileLoadWithoutBarrier(&m_slots[i]) == nullptr &&
+                InterlockedCompareExchangeT(&m_slots[i], item, nullptr) == nullptr)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+// Handles are only added while they hold null, so a new Thread can use them as they are
+static RecycledThreadResourceCache<OBJECTHANDLE__> s_recycledExposedObjectHandles;
+static RecycledThreadResourceCache<OBJECTHANDLE__> s_recycledStrongExposedObjectHandles;
+static RecycledThreadResourceCache<CONTEXT> s_recycledOSContexts;
+
 //--------------------------------------------------------------------
 // Thread construction
 //--------------------------------------------------------------------
@@ -1357,11 +1412,15 @@ Thread::Thread()
     // It can't be a LongWeakHandle because we zero stuff out of the exposed
     // object as it is finalized.  At that point, calls to GetCurrentThread()
     // had better get a new one,!
-    m_ExposedObject = CreateGlobalShortWeakHandle(NULL);
+    m_ExposedObject = s_recycledExposedObjectHandles.TryTake();
+    if (m_ExposedObject == NULL)
+        m_ExposedObject = CreateGlobalShortWeakHandle(NULL);
 
     GlobalShortWeakHandleHolder exposedObjectHolder(m_ExposedObject);
 
-    m_StrongHndToExposedObject = CreateGlobalStrongHandle(NULL);
+    m_StrongHndToExposedObject = s_recycledStrongExposedObjectHandles.TryTake();
+    if (m_StrongHndToExposedObject == NULL)
+        m_StrongHndToExposedObject = CreateGlobalStrongHandle(NULL);
     GlobalStrongHandleHolder strongHndToExposedObjectHolder(m_StrongHndToExposedObject);
 
     m_LastThrownObjectHandle = NULL;
@@ -1439,7 +1498,11 @@ Thread::Thread()
     m_dwAbortPoint = 0;
 #endif
 
-    m_OSContext = new CONTEXT();
+    m_OSContext = s_recycledOSContexts.TryTake();
+    if (m_OSContext != NULL)
+        memset(m_OSContext, 0, sizeof(CONTEXT));
+    else
+        m_OSContext = new CONTEXT();
     NewHolder<CONTEXT> contextHolder(m_OSContext);
 
     m_pSavedRedirectContext = NULL;
@@ -1503,6 +1566,7 @@ Thread::Thread()
 #endif // FEATURE_COMINTEROP
 
     m_fGCSpecial = FALSE;
+    m_stackScanClaimKey = 0;
 
 #ifndef TARGET_UNIX
     m_wCPUGroup = 0;
@@ -1523,6 +1587,7 @@ Thread::Thread()
     m_currentPrepareCodeConfig = nullptr;
     m_isInForbidSuspendForDebuggerRegion = false;
     m_hasPendingActivation = false;
+    m_lastSuspensionIP = (PCODE)NULL;
 
     m_ThreadLocalDataPtr = NULL;
 
@@ -2457,7 +2522,7 @@ Thread::~Thread()
         m_EventWait.CloseEvent();
     }
 
-    if (m_OSContext)
+    if (m_OSContext && (IsAtProcessExit() || !s_recycledOSContexts.TryAdd(m_OSContext)))
         delete m_OSContext;
 
     if (m_pOSContextBuffer)
@@ -2485,8 +2550,12 @@ Thread::~Thread()
         // Destroy any handles that we're using to hold onto exception objects
         SafeSetThrowables(NULL);
 
-        DestroyShortWeakHandle(m_ExposedObject);
-        DestroyStrongHandle(m_StrongHndToExposedObject);
+        // The exposed object usually has been collected by the time the Thread is destroyed,
+        // only handles that no longer reference an object can be handed to another Thread.
+        if ((*((void**)m_ExposedObject)) != NULL || !s_recycledExposedObjectHandles.TryAdd(m_ExposedObject))
+            DestroyShortWeakHandle(m_ExposedObject);
+        if ((*((void**)m_StrongHndToExposedObject)) != NULL || !s_recycledStrongExposedObjectHandles.TryAdd(m_StrongHndToExposedObject))
+            DestroyStrongHandle(m_StrongHndToExposedObject);
     }
 
     g_pThinLockThreadIdDispenser->DisposeId(GetThreadId());
@@ -3275,12 +3344,30 @@ DWORD Thread::DoAppropriateWaitWorker(int countHandles, HANDLE *handles, BOOL wa
             TRACE_LEVEL_VERBOSE,
             CLR_WAITHANDLE_KEYWORD);
 
+    // Waits shorter than the configured threshold are not interesting for off-CPU analysis, so when sending the wait
+    // events, first wait for up to the threshold without sending them. A wait that cannot outlast the threshold sends
+    // no events at all.
+    static ConfigDWORD waitEventThresholdMs;
+    DWORD thresholdMillis = sendWaitEvents ? waitEventThresholdMs.val(CLRConfig::INTERNAL_EventPipeWaitEventThresholdMs) : 0;
+    if (thresholdMillis != 0 && millis != INFINITE && millis <= thresholdMillis)
+    {
+        sendWaitEvents = false;
+    }
+
     // Monitor.Wait is typically a blocking wait. For other waits, when sending the wait events try a nonblocking wait first
     // such that the events sent are more likely to represent blocking waits.
-    bool tryNonblockingWaitFirst = sendWaitEvents && associatedObjectForMonitorWait == NULL;
+    bool tryNonblockingWaitFirst = sendWaitEvents && (associatedObjectForMonitorWait == NULL || thresholdMillis != 0);
     if (tryNonblockingWaitFirst)
     {
-        ret = DoAppropriateAptStateWait(countHandles, handles, waitAll, 0 /* timeout */, mode);
+        ULONGLONG probeStart = thresholdMillis != 0 ? minipal_lowres_ticks() : 0;
+        ret = DoAppropriateAptStateWait(countHandles, handles, waitAll, thresholdMillis, mode);
+        if (thresholdMillis != 0 && millis != INFINITE)
+        {
+            // Account for the time spent in the first wait. millis is greater than thresholdMillis here.
+            ULONGLONG probeElapsed = minipal_lowres_ticks() - probeStart;
+            millis -= (DWORD)std::min(probeElapsed, (ULONGLONG)thresholdMillis);
+        }
+
         if (ret == WAIT_TIMEOUT)
         {
             // Do a full wait and send the wait events
@@ -3715,6 +3715,24 @@ public:
     // object associated with them (e.g., the bgc thread).
     void SetGCSpecial();
 
+private:
+    // Key of the last GC root scanning pass that claimed this thread. Server GC threads
+    // claim threads with an interlocked exchange on this field so that a thread's stack
+    // is scanned exactly once per pass even when GC threads steal work from each other.
+    // See code:GCToEEInterface::GcScanRoots.
+    LONG m_stackScanClaimKey;
+
+public:
+    // Returns true if the calling GC thread won the right to scan this thread's roots
+    // in the pass identified by claimKey.
+    bool TryClaimForStackScan(LONG claimKey)
+    {
+        LIMITED_METHOD_CONTRACT;
+        LONG currentKey = VolatileLoad(&m_stackScanClaimKey);
+        return (currentKey != claimKey)
+            && (InterlockedCompareExchange(&m_stackScanClaimKey, claimKey, currentKey) == currentKey);
+    }
+
 private:
 
     PTR_GCFrame m_pGCFrame; // The topmost GC Frame
@@ -3935,6 +3953,26 @@ private:
 private:
     bool m_hasPendingActivation;
 
+    // The instruction pointer this thread was interrupted at by the most recent
+    // attempt to bring it to a safe point for a runtime suspension. Reported for
+    // the slowest thread of slow suspensions; see code:ThreadSuspend::SuspendAllThreads.
+    PCODE m_lastSuspensionIP;
+
+public:
+    PCODE GetLastSuspensionIP()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoadWithoutBarrier(&m_lastSuspensionIP);
+    }
+
+    void SetLastSuspensionIP(PCODE ip)
+    {
+        LIMITED_METHOD_CONTRACT;
+        VolatileStoreWithoutBarrier(&m_lastSuspensionIP, ip);
+    }
+
+private:
+
     friend struct ::cdac_data<Thread>;
 
 #ifdef FEATURE_INTERPRETER
@@ -3321,6 +3321,10 @@ void ThreadSuspend::SuspendAllThreads()
     uint32_t rehijackDelay = 8;
     uint32_t usecsSinceYield = 0;
 
+    // The last thread we saw in cooperative mode is the one that held up the suspension.
+    int64_t suspendStart = minipal_hires_ticks();
+    Thread* pStraggler = NULL;
+
     while(true)
     {
         int remaining = 0;
@@ -3333,6 +3337,15 @@ void ThreadSuspend::SuspendAllThreads()
             if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
             {
                 remaining++;
+                pStraggler = pTargetThread;
+
+                // Forget the IP recorded during an earlier suspension. The first pass only
+                // observes, so no activation of this suspension can be racing with us yet.
+                if (prevRemaining == INT32_MAX)
+                {
+                    pTargetThread->SetLastSuspensionIP((PCODE)NULL);
+                }
+
                 if (!observeOnly)
                 {
                     pTargetThread->Hijack();
@@ -3388,9 +3401,54 @@ void ThreadSuspend::SuspendAllThreads()
     ::FlushProcessWriteBuffers();
 #endif //TARGET_ARM || TARGET_ARM64
 
+    if (pStraggler != NULL)
+    {
+        ReportSuspensionStraggler(pStraggler, suspendStart);
+    }
+
     STRESS_LOG0(LF_SYNC, LL_INFO1000, "Thread::SuspendAllThreads() - Success\n");
 }
 
+//----------------------------------------------------------------------------
+//
+// ReportSuspensionStraggler - Report the thread that was last to reach a safe point
+//
+// If the suspension took longer than GCSuspendStragglerThresholdUSec, log the thread
+// and the method it was interrupted in by the last hijack attempt, so that the code
+// responsible for long time-to-suspend can be identified.
+//
+//----------------------------------------------------------------------------
+void ThreadSuspend::ReportSuspensionStraggler(Thread* pStraggler, int64_t suspendStart)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    static DWORD s_thresholdUSec = (DWORD)-1;
+    if (s_thresholdUSec == (DWORD)-1)
+    {
+        s_thresholdUSec = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCSuspendStragglerThresholdUSec);
+    }
+
+    int64_t elapsedUSec = (minipal_hires_ticks() - suspendStart) * 1000000 / minipal_hires_tick_frequency();
+    if (elapsedUSec < (int64_t)s_thresholdUSec)
+        return;
+
+    PCODE ip = pStraggler->GetLastSuspensionIP();
+    MethodDesc* pMD = (ip != (PCODE)NULL) ? ExecutionManager::GetCodeMethodDesc(ip) : NULL;
+
+    STRESS_LOG4(LF_SYNC, LL_INFO100, "Thread::SuspendAllThreads() - took %d usec, last thread 0x%x at IP %p in MethodDesc %p\n",
+        (int)elapsedUSec, pStraggler->GetOSThreadId(), (void*)ip, pMD);
+
+    FireEtwGCSuspendEEStraggler((elapsedUSec > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsedUSec,
+                                pStraggler->GetOSThreadId(),
+                                (const void*)ip,
+                                (ULONGLONG)pMD,
+                                GetClrInstanceId());
+}
+
 void Thread::Hijack()
 {
     if (IsGCSpecial())
@@ -5247,6 +5305,7 @@ BOOL Thread::HandledJITCase()
     }
 
     PCODE ip = GetIP(&ctx);
+    SetLastSuspensionIP(ip);
     if (!ExecutionManager::IsManagedCode(ip))
     {
         return FALSE;
@@ -5772,6 +5831,7 @@ void HandleSuspensionForInterruptedThread(CONTEXT *interruptedContext)
         return;
 
     PCODE ip = GetIP(interruptedContext);
+    pThread->SetLastSuspensionIP(ip);
 
     // This function can only be called when the interrupted thread is in
     // an activation safe point.
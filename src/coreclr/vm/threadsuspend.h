@@ -183,6 +183,7 @@ private:
     static SUSPEND_REASON    m_suspendReason;    // This contains the reason why the runtime is suspended
 
     static void SuspendAllThreads();
+    static void ReportSuspensionStraggler(Thread* pStraggler, int64_t suspendStart);
     static void ResumeAllThreads(BOOL SuspendSucceeded);
 public:
     // Initialize thread suspension support
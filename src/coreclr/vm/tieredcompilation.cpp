@@ -13,6 +13,7 @@
 #include "threadsuspend.h"
 #include "tieredcompilation.h"
 #include "minipal/time.h"
+#include "clrversion.h"
 
 // TieredCompilationManager determines which methods should be recompiled and
 // how they should be recompiled to best optimize the running code. It then
@@ -41,6 +42,11 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When TC_BackgroundWorkerCount is greater than one and the queue builds up a
+// backlog, the background worker may start helper workers that only drain
+// m_methodsToOptimize and exit once it is empty. Everything else (tiering delay,
+// call counting completion, stub deletion) remains on the one background worker.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -59,6 +65,14 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_backgroundHelperWorkerCount = 0;
+bool TieredCompilationManager::s_isWarmStartEnabled = false;
+SHash<TieredCompilationManager::WarmStartMethodTraits> *TieredCompilationManager::s_warmStartMethods = nullptr;
+CrstStatic TieredCompilationManager::s_warmStartLock;
+SArray<MethodDesc *> *TieredCompilationManager::s_warmStartPromotedMethods = nullptr;
+
+// Minimum number of queued methods per running worker before another helper worker is started
+static const UINT32 BackgroundHelperWorkerBacklogPerWorker = 64;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -251,6 +265,7 @@ bool TieredCompilationManager::TrySetCodeEntryPointAndRecordMethodForCallCountin
 
 void TieredCompilationManager::AsyncPromoteToTier1(
     NativeCodeVersion currentNativeCodeVersion,
+    bool isHotCode,
     bool *createTieringBackgroundWorkerRef)
 {
     CONTRACTL
@@ -308,8 +323,15 @@ void TieredCompilationManager::AsyncPromoteToTier1(
                 }
 #endif
 
-                // NOTE: we might consider using OptimizationTier1Instrumented if the previous Tier0
-                // made it to Tier1-OSR.
+#ifdef FEATURE_ON_STACK_REPLACEMENT
+                // If the tier 0 code made it to Tier1-OSR it has loops, and so it was already instrumented
+                // (see CORJIT_FLAG_BBINSTR_IF_LOOPS). Its profile is what the OSR variants were optimized with,
+                // so skip the instrumented tier and let tier 1 consume the same data.
+                if (currentNativeCodeVersion.GetILCodeVersion().GetOsrNativeCodeVersionCount(pMethodDesc) != 0)
+                {
+                    nextTier = NativeCodeVersion::OptimizationTier1;
+                }
+#endif
             }
         }
     }
@@ -323,6 +345,11 @@ void TieredCompilationManager::AsyncPromoteToTier1(
         ThrowHR(hr);
     }
 
+    if (isHotCode)
+    {
+        t1NativeCodeVersion.SetHotCode();
+    }
+
     // Insert the method into the optimization queue and trigger a thread to service
     // the queue if needed.
     SListElem<NativeCodeVersion>* pMethodListItem = new SListElem<NativeCodeVersion>(t1NativeCodeVersion);
@@ -574,6 +601,160 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+void TieredCompilationManager::TryCreateBackgroundHelperWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    // The background worker itself counts towards the limit, and a processor is left for foreground work
+    UINT32 processorCount = (UINT32)GetCurrentProcessCpuCount();
+    UINT32 maxHelperWorkerCount =
+        min((UINT32)g_pConfig->TieredCompilation_BackgroundWorkerCount(), processorCount > 1 ? processorCount - 1 : 1) - 1;
+    if (maxHelperWorkerCount == 0)
+    {
+        return;
+    }
+
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        if (s_backgroundHelperWorkerCount >= maxHelperWorkerCount ||
+            IsTieringDelayActive() ||
+            m_countOfMethodsToOptimize < (s_backgroundHelperWorkerCount + 1) * BackgroundHelperWorkerBacklogPerWorker)
+        {
+            return;
+        }
+
+        ++s_backgroundHelperWorkerCount;
+    }
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, BackgroundHelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Worker")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            _ASSERTE(s_backgroundHelperWorkerCount != 0);
+            --s_backgroundHelperWorkerCount;
+        }
+
+        // The background worker continues to drain the queue on its own
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::TryCreateBackgroundHelperWorker: "
+            "Exception creating helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+        RethrowTerminalExceptions();
+    }
+    EX_END_CATCH
+}
+
+DWORD WINAPI TieredCompilationManager::BackgroundHelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_backgroundHelperWorkerCount != 0);
+        --s_backgroundHelperWorkerCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(BackgroundHelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::BackgroundHelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->BackgroundHelperWorkerStart();
+}
+
+// Optimizes queued methods until the queue is empty or the tiering delay is activated, then exits. Unlike the background
+// worker, a helper worker does not wait for more work to be scheduled.
+void TieredCompilationManager::BackgroundHelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(GetThread() != s_backgroundWorkerThread);
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            if (!IsTieringDelayActive())
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                _ASSERTE(s_backgroundHelperWorkerCount != 0);
+                --s_backgroundHelperWorkerCount;
+                return;
+            }
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Give preference to possibly more important foreground work
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -873,6 +1054,13 @@ bool TieredCompilationManager::DoBackgroundWork(
             workDurationTicks = maxWorkDurationTicks;
         }
 
+        // A short sleep suggests that there are idle processors. If there is also a backlog of methods to optimize, let
+        // another worker help drain it.
+        if (workDurationTicks == minWorkDurationTicks)
+        {
+            TryCreateBackgroundHelperWorker();
+        }
+
         if (IsTieringDelayActive())
         {
             sendStopEvent = false;
@@ -933,6 +1121,11 @@ void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersio
     if (CompileCodeVersion(nativeCodeVersion))
     {
         ActivateCodeVersion(nativeCodeVersion);
+
+        if (s_isWarmStartEnabled && nativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier1)
+        {
+            RecordWarmStartMethod(nativeCodeVersion.GetMethodDesc());
+        }
     }
 }
 
@@ -1069,6 +1262,14 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
 
         _ASSERT(!methodDesc->RequestedAggressiveOptimization());
 
+        if (s_warmStartMethods != nullptr && IsWarmStartMethod(methodDesc))
+        {
+            // The method was promoted to tier 1 in a previous run, skip tier 0 and call counting
+            methodDesc->GetLoaderAllocator()->GetCallCountingManager()->DisableCallCounting(nativeCodeVersion);
+            nativeCodeVersion.SetOptimizationTier(NativeCodeVersion::OptimizationTierOptimized);
+            return flags;
+        }
+
         if (g_pConfig->TieredCompilation_QuickJit())
         {
             NativeCodeVersion::OptimizationTier currentTier = nativeCodeVersion.GetOptimizationTier();
@@ -1155,6 +1356,212 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(PrepareCodeConfig *config)
     return flags;
 }
 
+// Reads the methods recorded by a previous run. A missing or mismatching file is ignored, and replaced at shutdown.
+void TieredCompilationManager::InitializeWarmStart()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!g_pConfig->TieredCompilation())
+    {
+        return;
+    }
+
+    CLRConfigStringHolder fileName(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_WarmStartPath));
+    if (fileName == NULL)
+    {
+        return;
+    }
+
+    s_warmStartLock.Init(CrstLeafLock, CRST_DEFAULT);
+    s_warmStartPromotedMethods = new SArray<MethodDesc *>();
+    s_isWarmStartEnabled = true;
+
+    FileHandleHolder hFile(WszCreateFile(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    WarmStartFileHeader header;
+    DWORD bytesRead;
+    if (!ReadFile(hFile, &header, sizeof(header), &bytesRead, NULL) ||
+        (bytesRead != sizeof(header)) ||
+        (header.magic != WarmStartFileMagic) ||
+        (header.version != WarmStartFileVersion) ||
+        (strncmp(header.runtimeVersion, VER_FILEVERSION_STR, sizeof(header.runtimeVersion)) != 0) ||
+        (header.methodCount == 0))
+    {
+        return;
+    }
+
+    S_UINT32 methodsSize = S_UINT32(header.methodCount) * S_UINT32(sizeof(WarmStartMethod));
+    if (methodsSize.IsOverflow())
+    {
+        return;
+    }
+
+    NewArrayHolder<WarmStartMethod> methods = new WarmStartMethod[header.methodCount];
+    if (!ReadFile(hFile, methods, methodsSize.Value(), &bytesRead, NULL) || (bytesRead != methodsSize.Value()))
+    {
+        return;
+    }
+
+    NewHolder<SHash<WarmStartMethodTraits>> warmStartMethods = new SHash<WarmStartMethodTraits>();
+    warmStartMethods->Reallocate(header.methodCount * 2);
+    for (uint32_t i = 0; i < header.methodCount; i++)
+    {
+        if ((TypeFromToken(methods[i].methodDef) == mdtMethodDef) && !IsNilToken(methods[i].methodDef))
+        {
+            warmStartMethods->AddOrReplace(methods[i]);
+        }
+    }
+
+    s_warmStartMethods = warmStartMethods.Extract();
+}
+
+// Writes the methods read at startup and those promoted to tier 1 during this run
+void TieredCompilationManager::ShutdownWarmStart()
+{
+    STANDARD_VM_CONTRACT;
+
+    static bool written = false;
+    if (!s_isWarmStartEnabled || written)
+    {
+        return;
+    }
+    written = true;
+
+    SHash<WarmStartMethodTraits> methods;
+    if (s_warmStartMethods != nullptr)
+    {
+        for (SHash<WarmStartMethodTraits>::Iterator it = s_warmStartMethods->Begin(); it != s_warmStartMethods->End(); ++it)
+        {
+            methods.Add(*it);
+        }
+    }
+
+    // Background workers may still be promoting methods, take a snapshot since getting a module's MVID may take locks
+    SArray<MethodDesc *> promotedMethods;
+    {
+        CrstHolder lock(&s_warmStartLock);
+        promotedMethods.Set(*s_warmStartPromotedMethods);
+    }
+
+    for (COUNT_T i = 0; i < promotedMethods.GetCount(); i++)
+    {
+        MethodDesc *pMethodDesc = promotedMethods[i];
+        WarmStartMethod method;
+        pMethodDesc->GetModule()->GetPEAssembly()->GetMVID(&method.mvid);
+        method.methodDef = pMethodDesc->GetMemberDef();
+        methods.AddOrReplace(method);
+    }
+
+    if (methods.GetCount() == 0)
+    {
+        return;
+    }
+
+    CLRConfigStringHolder fileName(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_WarmStartPath));
+    FileHandleHolder hFile(WszCreateFile(fileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    WarmStartFileHeader header = {};
+    header.magic = WarmStartFileMagic;
+    header.version = WarmStartFileVersion;
+    strncpy_s(header.runtimeVersion, sizeof(header.runtimeVersion), VER_FILEVERSION_STR, _TRUNCATE);
+    header.methodCount = methods.GetCount();
+
+    DWORD bytesWritten;
+    if (!WriteFile(hFile, &header, sizeof(header), &bytesWritten, NULL))
+    {
+        return;
+    }
+
+    for (SHash<WarmStartMethodTraits>::Iterator it = methods.Begin(); it != methods.End(); ++it)
+    {
+        WarmStartMethod method = *it;
+        if (!WriteFile(hFile, &method, sizeof(method), &bytesWritten, NULL))
+        {
+            return;
+        }
+    }
+}
+
+// Only methods identified by a token in a module that is not unloaded are recorded
+bool TieredCompilationManager::IsWarmStartCandidate(MethodDesc* pMethodDesc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    return !pMethodDesc->IsDynamicMethod() &&
+        !pMethodDesc->HasClassOrMethodInstantiation() &&
+        !pMethodDesc->GetLoaderAllocator()->IsCollectible();
+}
+
+bool TieredCompilationManager::IsWarmStartMethod(MethodDesc* pMethodDesc)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_warmStartMethods != nullptr);
+
+    if (!IsWarmStartCandidate(pMethodDesc))
+    {
+        return false;
+    }
+
+    bool isWarmStartMethod = false;
+    EX_TRY
+    {
+        WarmStartMethod method;
+        pMethodDesc->GetModule()->GetPEAssembly()->GetMVID(&method.mvid);
+        method.methodDef = pMethodDesc->GetMemberDef();
+        isWarmStartMethod = s_warmStartMethods->LookupPtr(method) != nullptr;
+    }
+    EX_CATCH
+    {
+        RethrowTerminalExceptions();
+    }
+    EX_END_CATCH
+
+    return isWarmStartMethod;
+}
+
+void TieredCompilationManager::RecordWarmStartMethod(MethodDesc* pMethodDesc)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    if (!IsWarmStartCandidate(pMethodDesc))
+    {
+        return;
+    }
+
+    // An exception here (OOM) only means that the method would not be optimized on first call in a later run
+    EX_TRY
+    {
+        CrstHolder lock(&s_warmStartLock);
+        s_warmStartPromotedMethods->Append(pMethodDesc);
+    }
+    EX_CATCH
+    {
+        RethrowTerminalExceptions();
+    }
+    EX_END_CATCH
+}
+
 #ifdef _DEBUG
 bool TieredCompilationManager::IsLockOwnedByCurrentThread()
 {
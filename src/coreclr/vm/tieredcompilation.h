@@ -42,7 +42,7 @@ public:
 public:
     void HandleCallCountingForFirstCall(MethodDesc* pMethodDesc);
     bool TrySetCodeEntryPointAndRecordMethodForCallCounting(MethodDesc* pMethodDesc, PCODE codeEntryPoint);
-    void AsyncPromoteToTier1(NativeCodeVersion currentNativeCodeVersion, bool *createTieringBackgroundWorkerRef);
+    void AsyncPromoteToTier1(NativeCodeVersion currentNativeCodeVersion, bool isHotCode, bool *createTieringBackgroundWorkerRef);
     static CORJIT_FLAGS GetJitFlags(PrepareCodeConfig *config);
 
 #if !defined(DACCESS_COMPILE) && defined(_DEBUG)
@@ -62,6 +62,12 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    void TryCreateBackgroundHelperWorker();
+    static DWORD WINAPI BackgroundHelperWorkerBootstrapper0(LPVOID args);
+    static void BackgroundHelperWorkerBootstrapper1(LPVOID args);
+    void BackgroundHelperWorkerStart();
+
 private:
     bool TryDeactivateTieringDelay();
 
@@ -84,6 +90,75 @@ public:
     HRESULT DeoptimizeMethod(Module* pModule, mdMethodDef methodDef);
     HRESULT IsMethodDeoptimized(Module *pModule, mdMethodDef methodDef, BOOL *pResult);
 
+#ifndef DACCESS_COMPILE
+    // Warm start (TC_WarmStartPath): methods that were promoted to tier 1 are recorded at shutdown, identified by module MVID
+    // and method token. In later runs of the same runtime version, those methods are jitted optimized on their first call
+    // instead of going through tier 0 and call counting.
+public:
+    static void InitializeWarmStart();
+    static void ShutdownWarmStart();
+
+private:
+    static bool IsWarmStartCandidate(MethodDesc* pMethodDesc);
+    static bool IsWarmStartMethod(MethodDesc* pMethodDesc);
+    static void RecordWarmStartMethod(MethodDesc* pMethodDesc);
+
+    struct WarmStartMethod
+    {
+        GUID mvid;
+        mdMethodDef methodDef;
+    };
+
+    class WarmStartMethodTraits : public NoRemoveSHashTraits<DefaultSHashTraits<WarmStartMethod>>
+    {
+    public:
+        typedef WarmStartMethod key_t;
+
+        static key_t GetKey(const element_t &e)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return e;
+        }
+        static BOOL Equals(const key_t &k1, const key_t &k2)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return (k1.methodDef == k2.methodDef) && (memcmp(&k1.mvid, &k2.mvid, sizeof(GUID)) == 0);
+        }
+        static count_t Hash(const key_t &k)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return (count_t)HashBytes((const BYTE *)&k.mvid, sizeof(GUID)) ^ (count_t)k.methodDef;
+        }
+        static const element_t Null()
+        {
+            LIMITED_METHOD_CONTRACT;
+            WarmStartMethod e = {};
+            return e;
+        }
+        static bool IsNull(const element_t &e)
+        {
+            LIMITED_METHOD_CONTRACT;
+            return e.methodDef == 0;
+        }
+    };
+
+    struct WarmStartFileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        char runtimeVersion[32];
+        uint32_t methodCount;
+    };
+
+    static const uint32_t WarmStartFileMagic = 0x4D575443; // 'CTWM'
+    static const uint32_t WarmStartFileVersion = 1;
+
+    static bool s_isWarmStartEnabled;
+    static SHash<WarmStartMethodTraits> *s_warmStartMethods; // Read at startup, not modified afterwards
+    static CrstStatic s_warmStartLock;
+    static SArray<MethodDesc *> *s_warmStartPromotedMethods; // Protected by s_warmStartLock
+#endif // !DACCESS_COMPILE
+
 #ifndef DACCESS_COMPILE
 public:
     static void StaticInitialize()
@@ -124,6 +199,7 @@ private:
     static CLREventStatic s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static UINT32 s_backgroundHelperWorkerCount;
 #endif // !DACCESS_COMPILE
 
 private:
@@ -1892,6 +1892,11 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
 
     stats.worker_call++;
 
+    if (stubKind == STUB_CODE_BLOCK_VSD_RESOLVE_STUB)
+    {
+        g_resolveCache->RecordResolveStubMiss();
+    }
+
     LOG((LF_STUBS, LL_INFO100000, "ResolveWorker from %sStub, token" FMT_ADDR "object's MT" FMT_ADDR  "ind-cell" FMT_ADDR "call-site" FMT_ADDR "%s\n",
          (stubKind == STUB_CODE_BLOCK_VSD_DISPATCH_STUB) ? "Dispatch" : (stubKind == STUB_CODE_BLOCK_VSD_RESOLVE_STUB) ? "Resolve" : (stubKind == STUB_CODE_BLOCK_VSD_LOOKUP_STUB) ? "Lookup" : "Unknown",
          DBG_ADDR(token.To_SIZE_T()), DBG_ADDR(objectType), DBG_ADDR(pCallSite->GetIndirectCell()), DBG_ADDR(pCallSite->GetReturnAddress()),
@@ -3694,6 +3699,7 @@ DispatchCache::DispatchCache()
 
     // Initialize statistics
     memset(&stats, 0, sizeof(stats));
+    m_resolveStubMissCount = 0;
 #ifdef STUB_LOGGING
     memset(&cacheData, 0, sizeof(cacheData));
 #endif
@@ -3853,6 +3859,30 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
     return write || miss;
 }
 
+void DispatchCache::RecordResolveStubMiss()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    LONG misses = InterlockedIncrement(&m_resolveStubMissCount);
+    if ((misses % RESOLVE_STATISTICS_BATCH_SIZE) != 0)
+        return;
+
+    // The insert and promotion counters are updated under the write lock while we read them without it,
+    // so the event is a best effort snapshot.
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, ResolveCacheStatistics))
+    {
+        FireEtwResolveCacheStatistics((UINT32)misses,
+                                      stats.insert_cache_write,
+                                      stats.insert_cache_collide,
+                                      stats.chain_promote,
+                                      GetClrInstanceId());
+    }
+}
+
 #ifdef CHAIN_LOOKUP
 void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
 {
@@ -3864,6 +3894,7 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
 
     CrstHolder lh(&m_writeLock);
     g_chained_entry_promoted++;
+    stats.chain_promote++;
 
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
@@ -3921,6 +3952,7 @@ void DispatchCache::LogStats()
     stats.insert_cache_miss = 0;
     stats.insert_cache_collide = 0;
     stats.insert_cache_write = 0;
+    stats.chain_promote = 0;
 }
 #endif // FEATURE_VIRTUAL_STUB_DISPATCH
 
@@ -977,6 +977,8 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define CALL_STUB_EMPTY_ENTRY   0
 // number of successes for a chained element before it gets moved to the front
 #define CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT (0x100)
+// number of resolve stub cache misses between two ResolveCacheStatistics events
+#define RESOLVE_STATISTICS_BATCH_SIZE (0x400)
 
 /*******************************************************************************************************
 Entry is an abstract class.  We will make specific subclasses for each kind of
@@ -1258,6 +1260,12 @@ public:
     void PromoteChainEntry(ResolveCacheElem* elem);
 #endif
 
+    // Called by code:VirtualCallStubManager::ResolveWorker whenever a resolve stub missed in the cache.
+    // Every RESOLVE_STATISTICS_BATCH_SIZE misses the cache statistics are published as a
+    // ResolveCacheStatistics event so that megamorphic call sites thrashing the cache can be observed
+    // in release builds.
+    void RecordResolveStubMiss();
+
     // This is the heavyweight hashing algorithm. Use sparingly.
     static UINT16 HashToken(size_t token);
 
@@ -1313,8 +1321,12 @@ public:
         UINT32 insert_cache_miss;         //# of times Insert already had a matching cache entry
         UINT32 insert_cache_collide;      //# of times Insert found a used cache entry
         UINT32 insert_cache_write;        //# of times Insert wrote a cache entry
+        UINT32 chain_promote;             //# of times a chained entry was promoted to the head of its bucket
     } stats;
 
+    //# of times a resolve stub missed in the cache and called ResolveWorker
+    LONG m_resolveStubMissCount;
+
     void LogStats();
 
     // Unlocked iterator of entries. Use only when read/write access to the cache
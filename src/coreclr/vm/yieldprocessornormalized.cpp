@@ -3,8 +3,135 @@
 
 #include "common.h"
 #include "yieldprocessornormalized.h"
+#include "minipal/cpufeatures.h"
 #include "minipal/time.h"
 
 #include "finalizerthread.h"
 
+#if defined(FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS) && defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
 #include "yieldprocessornormalizedshared.cpp"
+
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+
+// Reads the clock that is used for the deadline of a wait on an address
+static FORCEINLINE uint64_t ReadWaitOnAddressClock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+#if defined(HOST_X86) || defined(HOST_AMD64)
+#ifdef _MSC_VER
+    return __rdtsc();
+#else
+    uint32_t low, high;
+    __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+#endif
+#elif defined(HOST_ARM64)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#endif
+}
+
+void YieldProcessorNormalization::InitializeWaitOnAddress()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_performanceCounterTicksPerS != 0);
+
+    if (!CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SpinWaitOnAddress))
+    {
+        return;
+    }
+
+    int cpuFeatures = minipal_getcpufeatures();
+    double clockTicksPerNs;
+
+#if defined(HOST_X86) || defined(HOST_AMD64)
+    if ((cpuFeatures & XArchIntrinsicConstants_WaitPkg) == 0)
+    {
+        return;
+    }
+
+    // The TSC frequency is not exposed to user mode, measure it against the high-resolution clock. A short duration is enough
+    // since the result only scales wait deadlines, which do not need to be precise.
+    const unsigned int MeasureDurationUs = 20;
+    int64_t measureDurationTicks = s_performanceCounterTicksPerS * MeasureDurationUs / (1000 * 1000);
+    int64_t startTicks = minipal_hires_ticks();
+    uint64_t startClockTicks = ReadWaitOnAddressClock();
+    int64_t elapsedTicks;
+    do
+    {
+        elapsedTicks = minipal_hires_ticks() - startTicks;
+    } while (elapsedTicks < measureDurationTicks);
+    uint64_t elapsedClockTicks = ReadWaitOnAddressClock() - startClockTicks;
+
+    clockTicksPerNs = (double)elapsedClockTicks * s_performanceCounterTicksPerS / ((double)elapsedTicks * NsPerS);
+#elif defined(HOST_ARM64)
+    if ((cpuFeatures & ARM64IntrinsicConstants_Wfxt) == 0)
+    {
+        return;
+    }
+
+    uint64_t clockTicksPerS;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(clockTicksPerS));
+    clockTicksPerNs = (double)clockTicksPerS / NsPerS;
+#endif
+
+    unsigned int ticksPerNormalizedYield = (unsigned int)(TargetNsPerNormalizedYield * clockTicksPerNs + 0.5);
+    VolatileStoreWithoutBarrier(&s_waitOnAddressTicksPerNormalizedYield, max(1u, ticksPerNormalizedYield));
+}
+
+void YieldProcessorNormalization::WaitOnAddress(const volatile uint32_t *address, uint32_t value, uint64_t ticks)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint64_t deadline = ReadWaitOnAddressClock() + ticks;
+
+    // The monitor is armed before the value is checked, so a write that happens after the check ends the wait
+#if defined(HOST_X86) || defined(HOST_AMD64)
+    // The lighter C0.1 state is requested for its faster wake-up, since the waits are short
+    const uint32_t UmwaitC01 = 1;
+#ifdef _MSC_VER
+    _umonitor((void *)address);
+    if (*address == value)
+    {
+        _umwait(UmwaitC01, deadline);
+    }
+#else
+    // umonitor eax/rax
+    __asm__ __volatile__(".byte 0xf3, 0x0f, 0xae, 0xf0" : : "a"(address) : "memory");
+    if (*address == value)
+    {
+        // umwait ecx
+        __asm__ __volatile__(
+            ".byte 0xf2, 0x0f, 0xae, 0xf1"
+            :
+            : "c"(UmwaitC01), "a"((uint32_t)deadline), "d"((uint32_t)(deadline >> 32))
+            : "memory", "cc");
+    }
+#endif
+#elif defined(HOST_ARM64)
+    // The exclusive load arms the monitor, and a write to the location by another processor generates a wake-up event
+    uint32_t observedValue;
+    __asm__ __volatile__("ldaxr %w0, [%1]" : "=&r"(observedValue) : "r"(address) : "memory");
+    if (observedValue == value)
+    {
+        // wfet x0
+        register uint64_t deadlineReg __asm__("x0") = deadline;
+        __asm__ __volatile__(".inst 0xd5031000" : : "r"(deadlineReg) : "memory");
+    }
+    __asm__ __volatile__("clrex" : : : "memory");
+#endif
+}
+
+#endif // FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
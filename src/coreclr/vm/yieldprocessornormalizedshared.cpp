@@ -150,6 +150,10 @@ void YieldProcessorNormalization::PerformMeasurement()
         s_performanceCounterTicksPerS = freq;
 #endif
 
+#ifdef FEATURE_YIELD_PROCESSOR_WAIT_ON_ADDRESS
+        InitializeWaitOnAddress();
+#endif
+
         unsigned int measureDurationUs = DetermineMeasureDurationUs();
         for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
         {
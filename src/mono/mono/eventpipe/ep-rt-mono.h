@@ -629,6 +629,21 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return value_uint32_t != 0;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_shared_streaming_thread (void)
+{
+	bool enable = false;
+	gchar *value = g_getenv ("DOTNET_EventPipeSharedStreamingThread");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeSharedStreamingThread");
+	if (value && atoi (value) == 1)
+		enable = true;
+	g_free (value);
+	return enable;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -304,6 +304,53 @@ test_queue_clear (void)
 	return OK;
 }
 
+static
+RESULT
+test_queue_arena_alloc (void)
+{
+	dn_allocator_arena_t allocator;
+	dn_allocator_arena_init (&allocator, 64);
+
+	dn_queue_t *queue = dn_queue_custom_alloc ((dn_allocator_t *)&allocator);
+	if (!queue)
+		return FAILED ("failed to custom alloc queue using arena");
+
+	for (int32_t i = 0; i < N_ELEMS; ++i) {
+		if (!dn_queue_push (queue, INT32_TO_POINTER (i)))
+			return FAILED ("failed queue push using arena");
+	}
+
+	if (!allocator._data._chunks || !allocator._data._chunks->next)
+		return FAILED ("expected arena to use multiple chunks");
+
+	for (int32_t i = 0; i < N_ELEMS; ++i) {
+		if (POINTER_TO_INT32 (*dn_queue_front_t (queue, void *)) != i)
+			return FAILED ("unexpected queue front using arena");
+		dn_queue_pop (queue);
+	}
+
+	dn_queue_free (queue);
+
+	dn_allocator_arena_reset (&allocator);
+	if (!allocator._data._chunks || allocator._data._chunks->next)
+		return FAILED ("expected arena reset to keep a single chunk");
+
+	void *block = dn_allocator_alloc ((dn_allocator_t *)&allocator, 1024);
+	if (!block)
+		return FAILED ("failed arena alloc larger than chunk size");
+
+	memset (block, 0xAB, 1024);
+	block = dn_allocator_realloc ((dn_allocator_t *)&allocator, block, 2048);
+	if (!block || ((uint8_t *)block) [1023] != 0xAB)
+		return FAILED ("arena realloc failed to preserve data");
+
+	dn_allocator_arena_dispose (&allocator);
+	if (allocator._data._chunks)
+		return FAILED ("expected arena dispose to release all chunks");
+
+	return OK;
+}
+
 static
 RESULT
 test_queue_teardown (void)
@@ -330,6 +377,7 @@ static Test dn_queue_tests [] = {
 	{"test_queue_size", test_queue_size},
 	{"test_queue_push_pop", test_queue_push_pop},
 	{"test_queue_clear", test_queue_clear},
+	{"test_queue_arena_alloc", test_queue_arena_alloc},
 	{"test_queue_teardown", test_queue_teardown},
 	{NULL, NULL}
 };
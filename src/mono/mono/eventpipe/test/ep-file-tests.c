@@ -139,6 +139,12 @@ test_create_file_nettrace_v4 (void)
 	return test_create_file (EP_SERIALIZATION_FORMAT_NETTRACE_V4);
 }
 
+static RESULT
+test_create_file_nettrace_v4_compressed (void)
+{
+	return test_create_file (EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED);
+}
+
 static RESULT
 test_file_write_event_netperf_v3 (void)
 {
@@ -151,6 +157,12 @@ test_file_write_event_nettrace_v4 (void)
 	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V4, true, false);
 }
 
+static RESULT
+test_file_write_event_nettrace_v4_compressed (void)
+{
+	return test_file_write_event (EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED, true, false);
+}
+
 static RESULT
 test_file_write_sequence_point_netperf_v3 (void)
 {
@@ -166,8 +178,10 @@ test_file_write_sequence_point_nettrace_v4 (void)
 static Test ep_file_tests [] = {
 	{"test_create_file_netperf_v3", test_create_file_netperf_v3},
 	{"test_create_file_nettrace_v4", test_create_file_nettrace_v4},
+	{"test_create_file_nettrace_v4_compressed", test_create_file_nettrace_v4_compressed},
 	{"test_file_write_event_netperf_v3", test_file_write_event_netperf_v3},
 	{"test_file_write_event_nettrace_v4", test_file_write_event_nettrace_v4},
+	{"test_file_write_event_nettrace_v4_compressed", test_file_write_event_nettrace_v4_compressed},
 	{"test_file_write_sequence_point_netperf_v3", test_file_write_sequence_point_netperf_v3},
 	{"test_file_write_sequence_point_nettrace_v4", test_file_write_sequence_point_nettrace_v4},
 	{NULL, NULL}
@@ -6,6 +6,7 @@
 #include <eventpipe/ep-config.h>
 #include <eventpipe/ep-event.h>
 #include <eventpipe/ep-session.h>
+#include <eventpipe/ep-session-provider.h>
 #include <eglib/test/test.h>
 
 #define TEST_PROVIDER_NAME "MyTestProvider"
@@ -153,6 +154,60 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static RESULT
+test_session_provider_counted_events (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+	uint32_t event_ids [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+	int64_t counts [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+
+	EventPipeSessionProvider *test_session_provider = ep_session_provider_alloc (TEST_PROVIDER_NAME, 1, EP_EVENT_LEVEL_LOGALWAYS, "Key=Value;" EP_SESSION_PROVIDER_COUNTED_EVENT_IDS_KEY "=81,82;Other=1", NULL, NULL);
+	ep_raise_error_if_nok (test_session_provider != NULL);
+
+	test_location = 1;
+
+	if (ep_session_provider_get_counted_events_len (test_session_provider) != 2) {
+		result = FAILED ("Unexpected number of counted events, expected 2, got %u", ep_session_provider_get_counted_events_len (test_session_provider));
+		ep_raise_error ();
+	}
+
+	test_location = 2;
+
+	if (!ep_session_provider_try_count_event (test_session_provider, 81) || !ep_session_provider_try_count_event (test_session_provider, 81)) {
+		result = FAILED ("Event 81 should be counted");
+		ep_raise_error ();
+	}
+
+	if (ep_session_provider_try_count_event (test_session_provider, 1)) {
+		result = FAILED ("Event 1 should not be counted");
+		ep_raise_error ();
+	}
+
+	test_location = 3;
+
+	if (ep_session_provider_get_changed_event_counts (test_session_provider, event_ids, counts, EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS) != 1 || event_ids [0] != 81 || counts [0] != 2) {
+		result = FAILED ("Unexpected changed event counts");
+		ep_raise_error ();
+	}
+
+	test_location = 4;
+
+	if (ep_session_provider_get_changed_event_counts (test_session_provider, event_ids, counts, EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS) != 0) {
+		result = FAILED ("Unchanged event counts should not be reported again");
+		ep_raise_error ();
+	}
+
+ep_on_exit:
+	ep_session_provider_free (test_session_provider);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
 static RESULT
 test_session_special_get_set (void)
 {
@@ -260,6 +315,7 @@ static Test ep_session_tests [] = {
 	{"test_session_setup", test_session_setup},
 	{"test_create_delete_session", test_create_delete_session},
 	{"test_add_session_providers", test_add_session_providers},
+	{"test_session_provider_counted_events", test_session_provider_counted_events},
 	{"test_session_special_get_set", test_session_special_get_set},
 	{"test_session_teardown", test_session_teardown},
 	{NULL, NULL}
@@ -1111,8 +1111,8 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 			 */
 			mono_os_mutex_lock (&image->szarray_cache_lock);
 			if (!image->szarray_cache)
-				image->szarray_cache = g_hash_table_new (mono_aligned_addr_hash, NULL);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
+				image->szarray_cache = dn_simdhash_ptr_ptr_new (0, NULL);
+			dn_simdhash_ptr_ptr_try_get_value (image->szarray_cache, eclass, (void **)&cached);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
@@ -1253,7 +1253,7 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 			mono_mem_manager_unlock (mm);
 		} else {
 			mono_os_mutex_lock (&image->szarray_cache_lock);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
+			dn_simdhash_ptr_ptr_try_get_value (image->szarray_cache, eclass, (void **)&cached);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
@@ -1296,7 +1296,7 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 			mono_mem_manager_unlock (mm);
 		} else {
 			mono_os_mutex_lock (&image->szarray_cache_lock);
-			g_hash_table_insert (image->szarray_cache, eclass, klass);
+			dn_simdhash_ptr_ptr_try_add (image->szarray_cache, eclass, klass);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
@@ -763,8 +763,8 @@ mono_image_init (MonoImage *image)
 	image->field_cache = mono_conc_hashtable_new (NULL, NULL);
 
 	image->typespec_cache = mono_conc_hashtable_new (NULL, NULL);
-	image->memberref_signatures = g_hash_table_new (NULL, NULL);
-	image->method_signatures = g_hash_table_new (NULL, NULL);
+	image->memberref_signatures = dn_simdhash_u32_ptr_new (0, NULL);
+	image->method_signatures = dn_simdhash_ptr_ptr_new (0, NULL);
 
 	image->property_hash = mono_property_hash_new ();
 }
@@ -2077,7 +2077,7 @@ mono_image_close_except_pools (MonoImage *image)
 		g_hash_table_destroy (image->array_cache);
 	}
 	if (image->szarray_cache)
-		g_hash_table_destroy (image->szarray_cache);
+		dn_simdhash_free (image->szarray_cache);
 	if (image->ptr_cache)
 		g_hash_table_destroy (image->ptr_cache);
 	if (image->name_cache) {
@@ -2100,8 +2100,8 @@ mono_image_close_except_pools (MonoImage *image)
 	mono_wrapper_caches_free (&image->wrapper_caches);
 
 	/* The ownership of signatures is not well defined */
-	g_hash_table_destroy (image->memberref_signatures);
-	g_hash_table_destroy (image->method_signatures);
+	dn_simdhash_free (image->memberref_signatures);
+	dn_simdhash_free (image->method_signatures);
 
 	if (image->rgctx_template_hash)
 		g_hash_table_destroy (image->rgctx_template_hash);
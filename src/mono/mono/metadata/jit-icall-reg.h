@@ -121,6 +121,7 @@ MONO_JIT_ICALL (__emul_rrem) \
 MONO_JIT_ICALL (g_free) \
 MONO_JIT_ICALL (interp_to_native_trampoline)	\
 MONO_JIT_ICALL (mini_llvm_init_method) \
+MONO_JIT_ICALL (mini_tiered_jit_method_enter) \
 MONO_JIT_ICALL (mini_llvmonly_init_delegate) \
 MONO_JIT_ICALL (mini_llvmonly_init_delegate_virtual) \
 MONO_JIT_ICALL (mini_llvmonly_init_vtable_slot) \
@@ -19,7 +19,7 @@
 #include <mono/utils/mono-error.h>
 #include "mono/utils/mono-conc-hashtable.h"
 #include "mono/utils/refcount.h"
-// for dn_simdhash_string_ptr_t and dn_simdhash_u32_ptr_t
+// for dn_simdhash_string_ptr_t, dn_simdhash_u32_ptr_t and dn_simdhash_ptr_ptr_t
 #include "../native/containers/dn-simdhash-specializations.h"
 
 struct _MonoType {
@@ -433,11 +433,11 @@ struct _MonoImage {
 
 	/* indexed by typespec tokens. */
 	MonoConcurrentHashTable *typespec_cache; /* protected by the image lock */
-	/* indexed by token */
-	GHashTable *memberref_signatures;
+	/* Indexed by blob heap indexes of memberref signatures */
+	dn_simdhash_u32_ptr_t *memberref_signatures;
 
 	/* Indexed by blob heap indexes */
-	GHashTable *method_signatures;
+	dn_simdhash_ptr_ptr_t *method_signatures;
 
 	/*
 	 * Indexes namespaces to hash tables that map class name to typedef token.
@@ -450,7 +450,7 @@ struct _MonoImage {
 	GHashTable *array_cache;
 	GHashTable *ptr_cache;
 
-	GHashTable *szarray_cache;
+	dn_simdhash_ptr_ptr_t *szarray_cache;
 	/* This has a separate lock to improve scalability */
 	mono_mutex_t szarray_cache_lock;
 
@@ -59,6 +59,7 @@
 #include <mono/utils/mono-time.h>
 #include <mono/utils/mono-mmap.h>
 #include <mono/utils/json.h>
+#include <mono/utils/mono-digest.h>
 #include <mono/utils/mono-threads-coop.h>
 #include <mono/profiler/aot.h>
 #include <mono/utils/w32api.h>
@@ -251,7 +252,9 @@ typedef struct MonoAotOptions {
 	char *mtriple;
 	char *llvm_path;
 	char *temp_path;
+	char *cache_dir;
 	char *instances_logfile_path;
+	char *method_order_file;
 	char *logfile;
 	char *llvm_opts;
 	char *llvm_llc;
@@ -290,6 +293,15 @@ typedef struct MonoAotStats {
 	int ginst_count, ginst_size;
 } MonoAotStats;
 
+typedef struct MethodCompileTime {
+	MonoMethod *method;
+	/* In 100ns ticks */
+	gint64 time;
+} MethodCompileTime;
+
+/* Number of methods with the longest compile times printed by the 'stats' option */
+#define SLOWEST_METHODS_TO_PRINT 20
+
 typedef struct GotInfo {
 	GHashTable *patch_to_got_offset;
 	GHashTable **patch_to_got_offset_by_type;
@@ -314,6 +326,8 @@ typedef enum {
 typedef struct MonoAotCompile {
 	MonoImage *image;
 	GPtrArray *methods;
+	/* MethodCompileTime entries, only collected with the 'stats' option */
+	GPtrArray *method_compile_times;
 	GHashTable *method_indexes;
 	GHashTable *method_depth;
 	MonoCompile **cfgs;
@@ -334,6 +348,8 @@ typedef struct MonoAotCompile {
 	GPtrArray *image_table;
 	GPtrArray *globals;
 	GPtrArray *method_order;
+	/* Maps method full names from the method-order profile -> their position in it + 1 */
+	GHashTable *method_order_ranks;
 	GHashTable *export_names;
 	/* Maps MonoClass* -> blob offset */
 	GHashTable *klass_blob_hash;
@@ -375,6 +391,9 @@ typedef struct MonoAotCompile {
 	FILE *fp;
 	char *tmpbasename;
 	char *asm_fname;
+	/* The output file and its copy in the AOT cache, if the output can be cached */
+	char *cache_output_fname;
+	char *cache_entry_fname;
 	char *temp_dir_to_delete;
 	char *llvm_sfile;
 	char *llvm_ofile;
@@ -8916,6 +8935,8 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->trimming_eligible_methods_outfile = g_strdup (arg + strlen ("trimming-eligible-methods-outfile="));
 		} else if (str_begins_with (arg, "temp-path=")) {
 			opts->temp_path = clean_path (g_strdup (arg + strlen ("temp-path=")));
+		} else if (str_begins_with (arg, "cache-dir=")) {
+			opts->cache_dir = g_strdup (arg + strlen ("cache-dir="));
 		} else if (str_begins_with (arg, "save-temps")) {
 			opts->save_temps = TRUE;
 		} else if (str_begins_with (arg, "keep-temps")) {
@@ -9073,6 +9094,9 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->profile_only = TRUE;
 		} else if (str_begins_with (arg, "mibc-profile=")) {
 			opts->mibc_profile_files = g_list_append (opts->mibc_profile_files, g_strdup (arg + strlen ("mibc-profile=")));
+		} else if (str_begins_with (arg, "method-order=")) {
+			g_free (opts->method_order_file);
+			opts->method_order_file = g_strdup (arg + strlen ("method-order="));
 		} else if (!strcmp (arg, "verbose")) {
 			opts->verbose = TRUE;
 		} else if (!strcmp (arg, "allow-errors")) {
@@ -9153,6 +9177,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    llvmonly                             - \n");
 			printf ("    llvm-outfile=<string>                - \n");
 			printf ("    llvm-path=<string>                   - \n");
+			printf ("    method-order=<string>                - Lay out the methods listed in the file, one full method name per line, first in the text section.\n");
 			printf ("    msym-dir=<string>                    - \n");
 			printf ("    mtriple                              - \n");
 			printf ("    nimt-trampolines=<value>             - \n");
@@ -9178,6 +9203,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    static                               - \n");
 			printf ("    stats                                - \n");
 			printf ("    temp-path=<string>                   - \n");
+			printf ("    cache-dir=<path>                     - Reuse the output of a previous compilation of the same assemblies with the same options.\n");
 			printf ("    tool-prefix=<value>                  - \n");
 			printf ("    threads=<value>                      - \n");
 			printf ("    write-symbols                        - \n");
@@ -9594,6 +9620,15 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 	cfg = mini_method_compile (method, acfg->jit_opts, flags, 0, index);
 	mono_time_track_end (&mono_jit_stats.jit_time, jit_time_start);
 
+	if (acfg->aot_opts.stats) {
+		MethodCompileTime *compile_time = g_new0 (MethodCompileTime, 1);
+		compile_time->method = method;
+		compile_time->time = mono_time_track_start () - jit_time_start;
+		mono_acfg_lock (acfg);
+		g_ptr_array_add (acfg->method_compile_times, compile_time);
+		mono_acfg_unlock (acfg);
+	}
+
 	if (cfg->prefer_instances) {
 		/*
 		 * Compile the original specific instances in addition to the gshared method
@@ -9881,17 +9916,43 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 	}
 }
 
+/*
+ * Methods are handed out one at a time from a shared queue, since compile times
+ * vary a lot between methods, so a static partitioning leaves threads idle.
+ */
+typedef struct {
+	MonoAotCompile *acfg;
+	MonoMethod **methods;
+	int nmethods;
+	/* Index of the next method to compile */
+	gint32 next;
+} CompileQueue;
+
+typedef struct {
+	CompileQueue *queue;
+	int ncompiled;
+	/* In 100ns ticks */
+	gint64 time;
+} CompileThreadData;
+
 static mono_thread_start_return_t WINAPI
 compile_thread_main (gpointer user_data)
 {
-	MonoAotCompile *acfg = ((MonoAotCompile **)user_data) [0];
-	GPtrArray *methods = ((GPtrArray **)user_data) [1];
+	CompileThreadData *data = (CompileThreadData *)user_data;
+	CompileQueue *queue = data->queue;
+	gint64 start = mono_time_track_start ();
 
 	mono_thread_set_name_constant_ignore_error (mono_thread_internal_current (), "AOT compiler", MonoSetThreadNameFlag_Permanent);
 
-	for (guint i = 0; i < methods->len; ++i)
-		compile_method (acfg, (MonoMethod *)g_ptr_array_index (methods, i));
+	while (TRUE) {
+		int i = mono_atomic_inc_i32 (&queue->next) - 1;
+		if (i >= queue->nmethods)
+			break;
+		compile_method (queue->acfg, queue->methods [i]);
+		data->ncompiled ++;
+	}
 
+	data->time = mono_time_track_start () - start;
 	return 0;
 }
 
@@ -11135,6 +11196,116 @@ emit_code (MonoAotCompile *acfg)
 	emit_int32 (acfg, 0);
 }
 
+/*
+ * load_method_order_file:
+ *
+ *   Load a method order profile, containing the methods which run during startup, hottest first. Each
+ * line holds a method name in the format printed by mono_method_get_full_name (), as used by the
+ * log-instances option, empty lines and lines starting with '#' are ignored.
+ */
+static gboolean
+load_method_order_file (MonoAotCompile *acfg, const char *filename)
+{
+	gchar *content = NULL;
+	gchar *content_ctx = NULL;
+	gchar *line;
+	guint rank = 0;
+
+	if (!g_file_get_contents (filename, &content, NULL, NULL)) {
+		aot_printerrf (acfg, "Failed to open and read the provided 'method-order' file '%s'.\n", filename);
+		return FALSE;
+	}
+
+	acfg->method_order_ranks = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+	line = strtok_r (content, "\n", &content_ctx);
+	while (line) {
+		g_strstrip (line);
+
+		/* The first occurrence of a method determines its position */
+		if (line [0] != '\0' && line [0] != '#' && !g_hash_table_lookup (acfg->method_order_ranks, line))
+			g_hash_table_insert (acfg->method_order_ranks, g_strdup (line), GUINT_TO_POINTER (++rank));
+
+		line = strtok_r (NULL, "\n", &content_ctx);
+	}
+
+	g_free (content);
+	return TRUE;
+}
+
+typedef struct {
+	guint rank;
+	guint oindex;
+	guint method_index;
+} MethodOrderEntry;
+
+static int
+compare_method_order_entries (const void *a, const void *b)
+{
+	const MethodOrderEntry *e1 = (const MethodOrderEntry *)a;
+	const MethodOrderEntry *e2 = (const MethodOrderEntry *)b;
+
+	if (e1->rank != e2->rank)
+		return e1->rank < e2->rank ? -1 : 1;
+	/* Keep methods with the same name in their original order */
+	return e1->oindex < e2->oindex ? -1 : (e1->oindex > e2->oindex ? 1 : 0);
+}
+
+/*
+ * apply_method_order_profile:
+ *
+ *   Move the methods listed in the method order profile to the front of acfg->method_order, in profile
+ * order, so the code running during startup is contiguous in the text section instead of being spread
+ * over the whole image. The other methods keep their compilation order. Methods compiled by LLVM are
+ * emitted by LLVM and are left alone.
+ */
+static void
+apply_method_order_profile (MonoAotCompile *acfg)
+{
+	GPtrArray *cold_methods;
+	MethodOrderEntry *hot_methods;
+	guint hot_count = 0;
+	gint64 hot_code_size = 0;
+
+	hot_methods = g_new0 (MethodOrderEntry, acfg->method_order->len);
+	cold_methods = g_ptr_array_sized_new (acfg->method_order->len);
+
+	for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+		guint method_index = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+		MonoCompile *cfg = acfg->cfgs [method_index];
+		guint rank = 0;
+
+		if (cfg && !cfg->compile_llvm) {
+			char *name = mono_method_get_full_name (cfg->orig_method);
+			rank = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->method_order_ranks, name));
+			g_free (name);
+		}
+
+		if (rank) {
+			hot_methods [hot_count].rank = rank;
+			hot_methods [hot_count].oindex = oindex;
+			hot_methods [hot_count].method_index = method_index;
+			hot_count ++;
+			hot_code_size += cfg->code_len;
+		} else {
+			g_ptr_array_add (cold_methods, GUINT_TO_POINTER (method_index));
+		}
+	}
+
+	mono_qsort (hot_methods, hot_count, sizeof (MethodOrderEntry), compare_method_order_entries);
+
+	g_ptr_array_set_size (acfg->method_order, 0);
+	for (guint i = 0; i < hot_count; ++i)
+		g_ptr_array_add (acfg->method_order, GUINT_TO_POINTER (hot_methods [i].method_index));
+	for (guint i = 0; i < cold_methods->len; ++i)
+		g_ptr_array_add (acfg->method_order, g_ptr_array_index (cold_methods, i));
+
+	aot_printf (acfg, "Method order: %d of %d profiled methods laid out first, %dk of code.\n", hot_count, g_hash_table_size (acfg->method_order_ranks), (int)(hot_code_size / 1024));
+
+	g_free (hot_methods);
+	g_ptr_array_free (cold_methods, TRUE);
+}
+
 static void
 emit_method_info_table (MonoAotCompile *acfg)
 {
@@ -13134,56 +13305,48 @@ compile_methods (MonoAotCompile *acfg)
 	int methods_len;
 
 	if (acfg->aot_opts.nthreads > 0) {
-		GPtrArray *frag;
-		int len;
-		GPtrArray *threads;
-		MonoThreadHandle *thread_handle;
-		gpointer *user_data;
-		MonoMethod **methods;
+		CompileQueue queue;
+		CompileThreadData *thread_data;
+		MonoThreadHandle **threads;
+		int nthreads;
 
 		methods_len = acfg->methods->len;
+		nthreads = MIN (acfg->aot_opts.nthreads, methods_len);
 
-		len = acfg->methods->len / acfg->aot_opts.nthreads;
-		g_assert (len > 0);
-		/*
-		 * Partition the list of methods into fragments, and hand it to threads to
-		 * process.
-		 */
-		threads = g_ptr_array_new ();
+		memset (&queue, 0, sizeof (queue));
+		queue.acfg = acfg;
+		queue.nmethods = methods_len;
 		/* Make a copy since acfg->methods is modified by compile_method () */
-		methods = g_new0 (MonoMethod*, methods_len);
-		//memcpy (methods, g_ptr_array_index (acfg->methods, 0), sizeof (MonoMethod*) * methods_len);
+		queue.methods = g_new0 (MonoMethod*, methods_len);
 		for (int i = 0; i < methods_len; ++i)
-			methods [i] = (MonoMethod *)g_ptr_array_index (acfg->methods, i);
-		int idx = 0;
-		while (idx < methods_len) {
+			queue.methods [i] = (MonoMethod *)g_ptr_array_index (acfg->methods, i);
+
+		threads = g_new0 (MonoThreadHandle*, nthreads);
+		thread_data = g_new0 (CompileThreadData, nthreads);
+		for (int i = 0; i < nthreads; ++i) {
 			ERROR_DECL (error);
 			MonoInternalThread *thread;
 
-			frag = g_ptr_array_new ();
-			for (int j = 0; j < len; ++j) {
-				if (idx < methods_len) {
-					g_ptr_array_add (frag, methods [idx]);
-					idx ++;
-				}
-			}
-
-			user_data = g_new0 (gpointer, 3);
-			user_data [0] = acfg;
-			user_data [1] = frag;
-
-			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, user_data, MONO_THREAD_CREATE_FLAGS_NONE, error);
+			thread_data [i].queue = &queue;
+			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, &thread_data [i], MONO_THREAD_CREATE_FLAGS_NONE, error);
 			mono_error_assert_ok (error);
 
-			thread_handle = mono_threads_open_thread_handle (thread->handle);
-			g_ptr_array_add (threads, thread_handle);
+			threads [i] = mono_threads_open_thread_handle (thread->handle);
 		}
-		g_free (methods);
 
-		for (guint i = 0; i < threads->len; ++i) {
-			mono_thread_info_wait_one_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i), MONO_INFINITE_WAIT, FALSE);
-			mono_threads_close_thread_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i));
+		for (int i = 0; i < nthreads; ++i) {
+			mono_thread_info_wait_one_handle (threads [i], MONO_INFINITE_WAIT, FALSE);
+			mono_threads_close_thread_handle (threads [i]);
 		}
+
+		if (acfg->aot_opts.stats) {
+			for (int i = 0; i < nthreads; ++i)
+				aot_printf (acfg, "Compile thread %d: %d methods in %dms\n", i, thread_data [i].ncompiled, (int)(thread_data [i].time / 10000));
+		}
+
+		g_free (threads);
+		g_free (thread_data);
+		g_free (queue.methods);
 	} else {
 		methods_len = 0;
 	}
@@ -14245,6 +14408,7 @@ acfg_create (MonoAssembly *ass, guint32 jit_opts)
 
 	acfg = g_new0 (MonoAotCompile, 1);
 	acfg->methods = g_ptr_array_new ();
+	acfg->method_compile_times = g_ptr_array_new ();
 	acfg->method_indexes = g_hash_table_new (NULL, NULL);
 	acfg->method_depth = g_hash_table_new (NULL, NULL);
 	acfg->plt_offset_to_entry = g_hash_table_new (NULL, NULL);
@@ -14328,7 +14492,9 @@ aot_opts_free (MonoAotOptions *aot_opts)
 	g_free (aot_opts->mtriple);
 	g_free (aot_opts->llvm_path);
 	g_free (aot_opts->temp_path);
+	g_free (aot_opts->cache_dir);
 	g_free (aot_opts->instances_logfile_path);
+	g_free (aot_opts->method_order_file);
 	g_free (aot_opts->logfile);
 	g_free (aot_opts->llvm_opts);
 	g_free (aot_opts->llvm_llc);
@@ -14359,7 +14525,12 @@ acfg_free (MonoAotCompile *acfg)
 	g_free (acfg->plt_symbol);
 	g_free (acfg->global_prefix);
 	g_free (acfg->assembly_name_sym);
+	g_free (acfg->cache_output_fname);
+	g_free (acfg->cache_entry_fname);
 	g_ptr_array_free (acfg->methods, TRUE);
+	for (guint i = 0; i < acfg->method_compile_times->len; ++i)
+		g_free (g_ptr_array_index (acfg->method_compile_times, i));
+	g_ptr_array_free (acfg->method_compile_times, TRUE);
 	g_ptr_array_free (acfg->image_table, TRUE);
 	g_ptr_array_free (acfg->globals, TRUE);
 	g_ptr_array_free (acfg->unwind_ops, TRUE);
@@ -14385,6 +14556,8 @@ acfg_free (MonoAotCompile *acfg)
 	g_hash_table_destroy (acfg->method_blob_hash);
 	if (acfg->blob_hash)
 		g_hash_table_destroy (acfg->blob_hash);
+	if (acfg->method_order_ranks)
+		g_hash_table_destroy (acfg->method_order_ranks);
 	got_info_free (&acfg->got_info);
 	got_info_free (&acfg->llvm_got_info);
 	arch_free_unwind_info_section_cache (acfg);
@@ -14923,6 +15096,185 @@ process_specified_direct_pinvokes (MonoAotCompile *acfg, const char *dpi)
 	return result;
 }
 
+/*
+ * The AOT cache stores the output of a compilation, keyed by everything which can
+ * affect it: the runtime build, the AOT and JIT options, the profiles, and the
+ * MVIDs of the assembly and of all the assemblies it references transitively.
+ * Code from referenced assemblies can be inlined and their type layouts are baked
+ * into the generated code, so any change to one of them invalidates the entry.
+ */
+
+static void
+aot_cache_hash_file (MonoSHA1Context *ctx, const char *fname)
+{
+	guchar digest [20];
+
+	memset (digest, 0, sizeof (digest));
+	mono_sha1_get_digest_from_file (fname, digest);
+	mono_sha1_update (ctx, digest, sizeof (digest));
+}
+
+static char*
+aot_cache_compute_key (MonoAotCompile *acfg)
+{
+	MonoSHA1Context ctx;
+	guchar digest [20];
+	char *build_info;
+
+	mono_sha1_init (&ctx);
+
+	build_info = mono_get_runtime_build_info ();
+	mono_sha1_update (&ctx, (const guchar*)build_info, (guint32)strlen (build_info) + 1);
+	g_free (build_info);
+	if (acfg->aot_opts.aot_options)
+		mono_sha1_update (&ctx, (const guchar*)acfg->aot_opts.aot_options, (guint32)strlen (acfg->aot_opts.aot_options) + 1);
+	mono_sha1_update (&ctx, (const guchar*)&acfg->jit_opts, sizeof (acfg->jit_opts));
+
+	for (GList *l = acfg->aot_opts.profile_files; l; l = l->next)
+		aot_cache_hash_file (&ctx, (const char*)l->data);
+	for (GList *l = acfg->aot_opts.mibc_profile_files; l; l = l->next)
+		aot_cache_hash_file (&ctx, (const char*)l->data);
+	for (GList *l = acfg->aot_opts.direct_pinvoke_lists; l; l = l->next)
+		aot_cache_hash_file (&ctx, (const char*)l->data);
+
+	GHashTable *visited = g_hash_table_new (NULL, NULL);
+	GPtrArray *images = g_ptr_array_new ();
+	g_ptr_array_add (images, acfg->image);
+	g_hash_table_insert (visited, acfg->image, acfg->image);
+	for (guint i = 0; i < images->len; ++i) {
+		MonoImage *image = (MonoImage*)g_ptr_array_index (images, i);
+
+		mono_sha1_update (&ctx, (const guchar*)image->guid, (guint32)strlen (image->guid) + 1);
+
+		for (int j = 0; j < image->nreferences; ++j) {
+			mono_assembly_load_reference (image, j);
+			MonoAssembly *ref = image->references [j];
+			if (!ref || ref == REFERENCE_MISSING || g_hash_table_lookup (visited, ref->image))
+				continue;
+			g_hash_table_insert (visited, ref->image, ref->image);
+			g_ptr_array_add (images, ref->image);
+		}
+	}
+	g_ptr_array_free (images, TRUE);
+	g_hash_table_destroy (visited);
+
+	mono_sha1_final (&ctx, digest);
+
+	GString *key = g_string_new ("");
+	for (int i = 0; i < 20; ++i)
+		g_string_append_printf (key, "%02x", digest [i]);
+	return g_string_free (key, FALSE);
+}
+
+/*
+ * aot_cache_get_output_fname:
+ *
+ *   Return the file produced by compiling ACFG, or NULL if the compilation
+ * produces other outputs which can't be cached.
+ */
+static char*
+aot_cache_get_output_fname (MonoAotCompile *acfg)
+{
+	if (acfg->llvm || acfg->aot_opts.llvm_only || acfg->aot_opts.data_outfile || acfg->aot_opts.export_symbols_outfile ||
+		acfg->aot_opts.trimming_eligible_methods_outfile || acfg->aot_opts.depfile || acfg->aot_opts.dump_json ||
+		acfg->aot_opts.gen_msym_dir || acfg->aot_opts.compile_in_child || acfg->aot_opts.child || acfg->dedup_phase != DEDUP_NONE)
+		return NULL;
+
+	if (acfg->aot_opts.asm_only)
+		return g_strdup (acfg->asm_fname);
+	if (acfg->aot_opts.outfile)
+		return g_strdup (acfg->aot_opts.outfile);
+	if (acfg->aot_opts.static_link)
+		return g_strdup_printf ("%s." AS_OBJECT_FILE_SUFFIX, acfg->image->name);
+	return g_strdup_printf ("%s%s", acfg->image->name, MONO_SOLIB_EXT);
+}
+
+static gboolean
+aot_cache_copy_file (const char *src, const char *dst)
+{
+	char buf [64 * 1024];
+	size_t n;
+	gboolean res = TRUE;
+	char *tmp_dst;
+	FILE *in, *out;
+
+	in = g_fopen (src, "rb");
+	if (!in)
+		return FALSE;
+	/* Write to a temporary file first so readers never see a partial file */
+	tmp_dst = g_strdup_printf ("%s.tmp", dst);
+	out = g_fopen (tmp_dst, "wb");
+	if (!out) {
+		fclose (in);
+		g_free (tmp_dst);
+		return FALSE;
+	}
+	while ((n = fread (buf, 1, sizeof (buf), in)) > 0) {
+		if (fwrite (buf, 1, n, out) != n) {
+			res = FALSE;
+			break;
+		}
+	}
+	if (ferror (in))
+		res = FALSE;
+	fclose (in);
+	if (fclose (out) != 0)
+		res = FALSE;
+
+	if (res) {
+		g_unlink (dst);
+		res = g_rename (tmp_dst, dst) == 0;
+	}
+	if (!res)
+		g_unlink (tmp_dst);
+	g_free (tmp_dst);
+	return res;
+}
+
+/*
+ * aot_cache_lookup:
+ *
+ *   Return TRUE if the output of ACFG was found in the AOT cache and copied to
+ * its destination. Otherwise, remember where the output should be stored once
+ * it is produced.
+ */
+static gboolean
+aot_cache_lookup (MonoAotCompile *acfg)
+{
+	char *output_fname = aot_cache_get_output_fname (acfg);
+	if (!output_fname) {
+		aot_printf (acfg, "The AOT cache is not supported with these options, compiling.\n");
+		return FALSE;
+	}
+
+	char *key = aot_cache_compute_key (acfg);
+	char *basename = g_path_get_basename (output_fname);
+	char *entry_fname = g_build_filename (acfg->aot_opts.cache_dir, key, basename, (const char*)NULL);
+	g_free (basename);
+	g_free (key);
+
+	if (g_file_test (entry_fname, G_FILE_TEST_EXISTS) && aot_cache_copy_file (entry_fname, output_fname)) {
+		aot_printf (acfg, "Output file '%s' copied from the AOT cache entry '%s'.\n", output_fname, entry_fname);
+		g_free (entry_fname);
+		g_free (output_fname);
+		return TRUE;
+	}
+
+	acfg->cache_output_fname = output_fname;
+	acfg->cache_entry_fname = entry_fname;
+	return FALSE;
+}
+
+static void
+aot_cache_store (MonoAotCompile *acfg)
+{
+	if (!acfg->cache_entry_fname)
+		return;
+
+	if (!g_ensure_directory_exists (acfg->cache_entry_fname) || !aot_cache_copy_file (acfg->cache_output_fname, acfg->cache_entry_fname))
+		aot_printerrf (acfg, "Unable to store '%s' in the AOT cache.\n", acfg->cache_output_fname);
+}
+
 static int
 aot_assembly (MonoAssembly *ass, guint32 jit_opts, MonoAotOptions *aot_options)
 {
@@ -15067,6 +15419,9 @@ aot_assembly (MonoAssembly *ass, guint32 jit_opts, MonoAotOptions *aot_options)
 		}
 	}
 
+	if (acfg->aot_opts.method_order_file && !load_method_order_file (acfg, acfg->aot_opts.method_order_file))
+		return 1;
+
 	if (acfg->aot_opts.static_link)
 		acfg->aot_opts.asm_writer = TRUE;
 
@@ -15195,6 +15550,11 @@ aot_assembly (MonoAssembly *ass, guint32 jit_opts, MonoAotOptions *aot_options)
 		acfg->llvm_eh_frame_symbol = g_strdup_printf ("%s_eh_frame", acfg->global_prefix);
 	}
 
+	if (acfg->aot_opts.cache_dir && aot_cache_lookup (acfg)) {
+		acfg_free (acfg);
+		return 0;
+	}
+
 	if (acfg->aot_opts.compile_in_child) {
 		if (acfg->aot_opts.dedup_include) {
 			if (acfg->image->assembly == dedup_assembly)
@@ -15323,6 +15683,18 @@ aot_assembly (MonoAssembly *ass, guint32 jit_opts, MonoAotOptions *aot_options)
 	return emit_aot_image (acfg);
 }
 
+static int
+compare_method_compile_time (gconstpointer a, gconstpointer b)
+{
+	const MethodCompileTime *t1 = *(const MethodCompileTime **)a;
+	const MethodCompileTime *t2 = *(const MethodCompileTime **)b;
+
+	/* Slowest first */
+	if (t1->time != t2->time)
+		return t1->time > t2->time ? -1 : 1;
+	return 0;
+}
+
 static void
 print_stats (MonoAotCompile *acfg)
 {
@@ -15383,6 +15755,17 @@ print_stats (MonoAotCompile *acfg)
 	aot_printf (acfg, "\tInstance:  %d\n", acfg->stats.method_categories [METHOD_CAT_INST]);
 	aot_printf (acfg, "\tGSharedvt: %d\n", acfg->stats.method_categories [METHOD_CAT_GSHAREDVT]);
 	aot_printf (acfg, "\tWrapper:   %d\n", acfg->stats.method_categories [METHOD_CAT_WRAPPER]);
+
+	if (acfg->method_compile_times->len) {
+		g_ptr_array_sort (acfg->method_compile_times, compare_method_compile_time);
+		aot_printf (acfg, "\nSlowest methods to compile:\n");
+		for (i = 0; i < MIN (SLOWEST_METHODS_TO_PRINT, (int)acfg->method_compile_times->len); ++i) {
+			MethodCompileTime *compile_time = (MethodCompileTime *)g_ptr_array_index (acfg->method_compile_times, i);
+			char *name = mono_method_get_full_name (compile_time->method);
+			aot_printf (acfg, "\t%dms: %s\n", (int)(compile_time->time / 10000), name);
+			g_free (name);
+		}
+	}
 }
 
 static void
@@ -15589,6 +15972,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->dwarf)
 		mono_dwarf_writer_emit_base_info (acfg->dwarf, g_path_get_basename (acfg->image->name), mono_unwind_get_cie_program ());
 
+	if (acfg->method_order_ranks)
+		apply_method_order_profile (acfg);
+
 	emit_code (acfg);
 
 	emit_method_info_table (acfg);
@@ -15689,6 +16075,8 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (res)
 		return res;
 
+	aot_cache_store (acfg);
+
 	if (acfg->aot_opts.stats)
 		print_stats (acfg);
 
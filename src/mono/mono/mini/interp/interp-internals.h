@@ -114,6 +114,14 @@ typedef enum {
 #define INTERP_IMETHOD_IS_TAGGED_UNBOX(im) INTERP_IMETHOD_IS_TAGGED_1(im)
 #define INTERP_IMETHOD_UNTAG_UNBOX(im) INTERP_IMETHOD_UNTAG_1(im)
 
+// Execution counts of a conditional branch in unoptimized code, used to record its direction
+// in the interpreter PGO profile once the method tiers up.
+typedef struct {
+	guint32 il_offset;
+	guint32 executed;
+	guint32 not_taken;
+} InterpPgoBranchCounter;
+
 /*
  * Structure representing a method transformed for the interpreter
  */
@@ -176,6 +184,9 @@ struct InterpMethod {
 	//
 	// Since we have both positive and negative keys in this array, we use G_MAXINTRE as terminator.
 	int *patchpoint_data;
+	// Only set for unoptimized methods compiled while recording the PGO profile
+	InterpPgoBranchCounter **pgo_branch_counters;
+	int num_pgo_branch_counters;
 	unsigned int init_locals : 1;
 	unsigned int vararg : 1;
 	unsigned int optimized : 1;
@@ -288,6 +299,7 @@ typedef struct {
 	gint64 optimize_bblocks_time;
 	gint64 cprop_time;
 	gint64 super_instructions_time;
+	gint64 loop_opt_time;
 	gint32 emitted_instructions;
 	gint32 inlined_methods;
 	gint32 inline_failures;
@@ -4,7 +4,8 @@
 //  along with infrastructure to support code generration
 
 // This file implements most of interpreter automatic PGO.
-// Loading/saving the actual table is your responsibility via mono_interp_pgo_(load|save)_table
+// On browser, loading/saving the actual table is your responsibility via mono_interp_pgo_(load|save)_table.
+// Elsewhere, the profile is loaded from and saved to the file passed with --interp-pgo-file.
 
 #ifndef __USE_ISOC99
 #define __USE_ISOC99
@@ -16,6 +17,13 @@
 #define TABLE_MINIMUM_SIZE 4096
 #define TABLE_GROWTH_FACTOR 150
 #define INTERP_PGO_LOG_INTERVAL_MS 10
+// A branch has to run this many times in unoptimized code before we record its direction
+#define INTERP_PGO_BRANCH_MIN_COUNT 32
+// Percentage of executions that have to go the same way for a branch direction to be recorded
+#define INTERP_PGO_BRANCH_BIAS_PERCENT 80
+
+#define INTERP_PGO_FILE_MAGIC 0x4750494d // "MIPG"
+#define INTERP_PGO_FILE_VERSION 1
 
 #include <mono/metadata/mono-config.h>
 #include <mono/utils/mono-threads.h>
@@ -189,12 +197,41 @@ static interp_pgo_table *loaded_table, *building_table;
 //  needs to be performed while holding this mutex.
 static mono_mutex_t building_table_lock;
 
+#define INTERP_PGO_BRANCH_TAKEN 1
+
+// Recorded direction of a conditional branch, identified by its method hash and IL offset
+typedef struct {
+	uint8_t hash[MM3_HASH_BYTE_SIZE];
+	uint32_t il_offset;
+	uint32_t flags;
+} interp_pgo_branch;
+
+typedef struct {
+	interp_pgo_branch *data;
+	uint32_t count, capacity;
+} interp_pgo_branch_table;
+
+// Same split as for the method tables. building_branch_table is also protected by building_table_lock.
+static interp_pgo_branch_table *loaded_branch_table, *building_branch_table;
+
 static int
 hash_comparer (const void *needle, const void *haystack)
 {
 	return memcmp (needle, haystack, MM3_HASH_BYTE_SIZE);
 }
 
+static int
+branch_comparer (const void *needle, const void *haystack)
+{
+	const interp_pgo_branch *a = (const interp_pgo_branch *)needle, *b = (const interp_pgo_branch *)haystack;
+	int result = memcmp (a->hash, b->hash, MM3_HASH_BYTE_SIZE);
+	if (result)
+		return result;
+	if (a->il_offset != b->il_offset)
+		return a->il_offset < b->il_offset ? -1 : 1;
+	return 0;
+}
+
 static gboolean
 table_lookup (interp_pgo_table *table, uint8_t hash[MM3_HASH_BYTE_SIZE]) {
 	// Early out if no table is loaded or the table is empty.
@@ -239,6 +276,26 @@ table_sort_locked (interp_pgo_table *table) {
 	mono_qsort (table->data, table->size / MM3_HASH_BYTE_SIZE, MM3_HASH_BYTE_SIZE, hash_comparer);
 }
 
+static void
+branch_table_add_locked (interp_pgo_branch_table **table_variable, const interp_pgo_branch *branch) {
+	interp_pgo_branch_table *table = *table_variable;
+	if (!table)
+		*table_variable = table = g_malloc0 (sizeof (interp_pgo_branch_table));
+
+	if (table->count == table->capacity) {
+		uint32_t new_capacity = MAX ((uint32_t)(TABLE_MINIMUM_SIZE / sizeof (interp_pgo_branch)), (table->capacity * TABLE_GROWTH_FACTOR / 100));
+		table->data = g_realloc (table->data, new_capacity * sizeof (interp_pgo_branch));
+		table->capacity = new_capacity;
+	}
+
+	table->data [table->count++] = *branch;
+}
+
+static void
+branch_table_sort_locked (interp_pgo_branch_table *table) {
+	mono_qsort (table->data, table->count, sizeof (interp_pgo_branch), branch_comparer);
+}
+
 static void
 compute_method_hash (MonoMethod *method, uint8_t outbuf[MM3_HASH_BYTE_SIZE]) {
 	// method token + image guid
@@ -298,6 +355,242 @@ mono_interp_pgo_method_was_tiered (MonoMethod *method) {
 	}
 }
 
+// Called before the optimized version of imethod is compiled. Biased branches observed while
+//  running the unoptimized code are added to the profile.
+void
+mono_interp_pgo_method_tiering_up (InterpMethod *imethod) {
+	if (!mono_opt_interp_pgo_recording || !imethod->num_pgo_branch_counters)
+		return;
+
+	interp_pgo_branch branch;
+	compute_method_hash (imethod->method, branch.hash);
+	int recorded = 0;
+
+	mono_os_mutex_lock (&building_table_lock);
+	for (int i = 0; i < imethod->num_pgo_branch_counters; i++) {
+		InterpPgoBranchCounter *counter = imethod->pgo_branch_counters [i];
+		// Counters are updated without synchronization, so they are only approximate
+		uint64_t executed = counter->executed;
+		uint64_t not_taken = MIN (counter->not_taken, executed);
+		uint64_t taken = executed - not_taken;
+		if (executed < INTERP_PGO_BRANCH_MIN_COUNT)
+			continue;
+
+		if (taken * 100 >= executed * INTERP_PGO_BRANCH_BIAS_PERCENT)
+			branch.flags = INTERP_PGO_BRANCH_TAKEN;
+		else if (not_taken * 100 >= executed * INTERP_PGO_BRANCH_BIAS_PERCENT)
+			branch.flags = 0;
+		else
+			continue;
+
+		branch.il_offset = counter->il_offset;
+		branch_table_add_locked (&building_branch_table, &branch);
+		recorded++;
+	}
+	mono_os_mutex_unlock (&building_table_lock);
+
+	if (mono_opt_interp_pgo_logging && recorded) {
+		char * name = mono_method_full_name (imethod->method, TRUE);
+		g_print ("added %d branch directions of %s to table\n", recorded, name);
+		g_free (name);
+	}
+}
+
+// Returns TRUE if the loaded profile has a direction recorded for the conditional branch
+//  at il_offset in method.
+gboolean
+mono_interp_pgo_get_branch_direction (MonoMethod *method, guint32 il_offset, gboolean *taken) {
+	if (!loaded_branch_table || !loaded_branch_table->count)
+		return FALSE;
+
+	interp_pgo_branch key;
+	compute_method_hash (method, key.hash);
+	key.il_offset = il_offset;
+
+	interp_pgo_branch *result = (interp_pgo_branch *)mono_binary_search (&key, loaded_branch_table->data, loaded_branch_table->count, sizeof (interp_pgo_branch), branch_comparer);
+	if (!result)
+		return FALSE;
+
+	*taken = (result->flags & INTERP_PGO_BRANCH_TAKEN) != 0;
+	return TRUE;
+}
+
+#if !HOST_BROWSER
+
+// The profile file format is
+//  [uint32 magic] [uint32 version]
+//  [uint32 size] [method hashes...]
+//  [uint32 size] [branch records...]
+// with both tables sorted, so they can be used for lookups directly once loaded.
+
+static gboolean
+read_table_section (const uint8_t *data, gsize length, gsize *offset, uint32_t element_size, uint8_t **result, uint32_t *result_size) {
+	uint32_t size;
+	if (*offset + sizeof (uint32_t) > length)
+		return FALSE;
+	memcpy (&size, data + *offset, sizeof (uint32_t));
+	*offset += sizeof (uint32_t);
+	if (size % element_size || size > length - *offset)
+		return FALSE;
+
+	*result = g_malloc (MAX (size, 1));
+	memcpy (*result, data + *offset, size);
+	*result_size = size;
+	*offset += size;
+	return TRUE;
+}
+
+static void
+load_profile_file (const char *path) {
+	gchar *contents = NULL;
+	gsize length = 0;
+	if (!g_file_get_contents (path, &contents, &length, NULL)) {
+		if (mono_opt_interp_pgo_logging)
+			g_print ("No interp_pgo profile loaded from '%s'\n", path);
+		return;
+	}
+
+	const uint8_t *data = (const uint8_t *)contents;
+	uint32_t header [2];
+	gsize offset = sizeof (header);
+	uint8_t *methods = NULL, *branches = NULL;
+	uint32_t methods_size = 0, branches_size = 0;
+
+	if (length < sizeof (header))
+		goto invalid;
+	memcpy (header, data, sizeof (header));
+	if (header [0] != INTERP_PGO_FILE_MAGIC || header [1] != INTERP_PGO_FILE_VERSION)
+		goto invalid;
+	if (!read_table_section (data, length, &offset, MM3_HASH_BYTE_SIZE, &methods, &methods_size))
+		goto invalid;
+	if (!read_table_section (data, length, &offset, sizeof (interp_pgo_branch), &branches, &branches_size))
+		goto invalid;
+
+	loaded_table = g_malloc0 (sizeof (interp_pgo_table));
+	loaded_table->data = methods;
+	loaded_table->size = loaded_table->capacity = methods_size;
+	table_sort_locked (loaded_table);
+
+	loaded_branch_table = g_malloc0 (sizeof (interp_pgo_branch_table));
+	loaded_branch_table->data = (interp_pgo_branch *)branches;
+	loaded_branch_table->count = loaded_branch_table->capacity = branches_size / sizeof (interp_pgo_branch);
+	branch_table_sort_locked (loaded_branch_table);
+
+	if (mono_opt_interp_pgo_logging)
+		g_print ("Loaded interp_pgo profile from '%s' (%u methods, %u branches)\n", path, methods_size / MM3_HASH_BYTE_SIZE, loaded_branch_table->count);
+
+	g_free (contents);
+	return;
+
+invalid:
+	g_warning ("Ignoring invalid interp_pgo profile '%s'", path);
+	g_free (methods);
+	g_free (branches);
+	g_free (contents);
+}
+
+static gboolean
+write_table_section (FILE *file, const void *data, uint32_t size) {
+	if (fwrite (&size, sizeof (uint32_t), 1, file) != 1)
+		return FALSE;
+	return !size || fwrite (data, size, 1, file) == 1;
+}
+
+// The saved profile is the union of the loaded one and of what this run recorded. When both have
+//  a direction for the same branch, the one observed during this run wins.
+static void
+save_profile_file (const char *path) {
+	interp_pgo_table *methods = NULL;
+	interp_pgo_branch_table *branches = NULL;
+
+	mono_os_mutex_lock (&building_table_lock);
+	if (building_table) {
+		table_sort_locked (building_table);
+		for (uint32_t i = 0; i < building_table->size; i += MM3_HASH_BYTE_SIZE)
+			if (!i || memcmp (building_table->data + i, building_table->data + i - MM3_HASH_BYTE_SIZE, MM3_HASH_BYTE_SIZE))
+				table_add_locked (&methods, building_table->data + i);
+	}
+	if (loaded_table) {
+		for (uint32_t i = 0; i < loaded_table->size; i += MM3_HASH_BYTE_SIZE)
+			if (!table_lookup (building_table, loaded_table->data + i))
+				table_add_locked (&methods, loaded_table->data + i);
+	}
+
+	if (building_branch_table) {
+		branch_table_sort_locked (building_branch_table);
+		for (uint32_t i = 0; i < building_branch_table->count; i++)
+			if (!i || branch_comparer (&building_branch_table->data [i], &building_branch_table->data [i - 1]))
+				branch_table_add_locked (&branches, &building_branch_table->data [i]);
+	}
+	if (loaded_branch_table) {
+		for (uint32_t i = 0; i < loaded_branch_table->count; i++) {
+			interp_pgo_branch *branch = &loaded_branch_table->data [i];
+			if (!building_branch_table || !mono_binary_search (branch, building_branch_table->data, building_branch_table->count, sizeof (interp_pgo_branch), branch_comparer))
+				branch_table_add_locked (&branches, branch);
+		}
+	}
+	mono_os_mutex_unlock (&building_table_lock);
+
+	if (methods)
+		table_sort_locked (methods);
+	if (branches)
+		branch_table_sort_locked (branches);
+
+	// Write to a temporary file first, so a crash while saving doesn't destroy the previous profile
+	char *tmp_path = g_strdup_printf ("%s.tmp", path);
+	gboolean success = FALSE;
+	FILE *file = g_fopen (tmp_path, "wb");
+	if (file) {
+		uint32_t header [2] = { INTERP_PGO_FILE_MAGIC, INTERP_PGO_FILE_VERSION };
+		success = fwrite (header, sizeof (header), 1, file) == 1 &&
+			write_table_section (file, methods ? methods->data : NULL, methods ? methods->size : 0) &&
+			write_table_section (file, branches ? branches->data : NULL, branches ? branches->count * (uint32_t)sizeof (interp_pgo_branch) : 0);
+		success = (fclose (file) == 0) && success;
+		if (success)
+			success = g_rename (tmp_path, path) == 0;
+		else
+			remove (tmp_path);
+	}
+
+	if (!success)
+		g_warning ("Failed to save interp_pgo profile to '%s'", path);
+	else if (mono_opt_interp_pgo_logging)
+		g_print ("Saved interp_pgo profile to '%s' (%u methods, %u branches)\n", path, methods ? methods->size / MM3_HASH_BYTE_SIZE : 0, branches ? branches->count : 0);
+
+	g_free (tmp_path);
+	if (methods) {
+		g_free (methods->data);
+		g_free (methods);
+	}
+	if (branches) {
+		g_free (branches->data);
+		g_free (branches);
+	}
+}
+
+#endif // !HOST_BROWSER
+
+void
+mono_interp_pgo_init (void) {
+	mono_os_mutex_init (&building_table_lock);
+
+#if !HOST_BROWSER
+	if (mono_opt_interp_pgo_file) {
+		// A persistent profile is always kept up to date with what the current run observes
+		mono_opt_interp_pgo_recording = TRUE;
+		load_profile_file (mono_opt_interp_pgo_file);
+	}
+#endif
+}
+
+void
+mono_interp_pgo_cleanup (void) {
+#if !HOST_BROWSER
+	if (mono_opt_interp_pgo_file)
+		save_profile_file (mono_opt_interp_pgo_file);
+#endif
+}
+
 #if HOST_BROWSER
 
 #include <emscripten.h>
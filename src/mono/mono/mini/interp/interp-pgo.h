@@ -13,4 +13,16 @@ mono_interp_pgo_generate_start (void);
 void
 mono_interp_pgo_generate_end (void);
 
+void
+mono_interp_pgo_init (void);
+
+void
+mono_interp_pgo_cleanup (void);
+
+void
+mono_interp_pgo_method_tiering_up (InterpMethod *imethod);
+
+gboolean
+mono_interp_pgo_get_branch_direction (MonoMethod *method, guint32 il_offset, gboolean *taken);
+
 #endif // __MONO_MINI_INTERP_PGO_H__
@@ -7722,6 +7722,13 @@ MINT_IN_CASE(MINT_BRTRUE_I8_SP) ZEROP_SP(gint64, !=); MINT_IN_BREAK;
 			ip += 4;
 			MINT_IN_BREAK;
 		}
+		MINT_IN_CASE(MINT_PGO_COUNT) {
+			++ip;
+			guint32 *p = (guint32*)GINT_TO_POINTER (READ64 (ip));
+			(*p)++;
+			ip += 4;
+			MINT_IN_BREAK;
+		}
 
 		MINT_IN_CASE(MINT_TIER_ENTER_METHOD) {
 			frame->imethod->entry_count++;
@@ -8207,6 +8214,8 @@ interp_parse_options (const char *options)
 				opt = INTERP_OPT_SSA;
 			else if (strncmp (arg, "precise", 7) == 0)
 				opt = INTERP_OPT_PRECISE_GC;
+			else if (strncmp (arg, "loops", 5) == 0)
+				opt = INTERP_OPT_LOOPS;
 			else if (strncmp (arg, "all", 3) == 0)
 				opt = ~INTERP_OPT_NONE;
 
@@ -9013,6 +9022,7 @@ interp_sufficient_stack (gsize size)
 static void
 interp_cleanup (void)
 {
+	mono_interp_pgo_cleanup ();
 #if COUNT_OPS
 	interp_print_op_count ();
 #endif
@@ -9051,6 +9061,8 @@ mono_ee_interp_init (const char *opts)
 	if (mono_interp_opt & INTERP_OPT_TIERING)
 		mono_interp_tiering_init ();
 
+	mono_interp_pgo_init ();
+
 	mini_install_interp_callbacks (&mono_interp_callbacks);
 
 #ifdef HOST_WASI
@@ -1,4 +1,5 @@
 #include "tiering.h"
+#include "interp-pgo.h"
 
 static mono_mutex_t tiering_mutex;
 // FIXME: The add/remove traffic on this table may require dn_simdhash to implement cascade flag cleanup
@@ -80,8 +81,10 @@ tier_up_method (InterpMethod *imethod, ThreadContext *context)
 	InterpMethod *new_imethod = get_tier_up_imethod (imethod);
 
 	// In theory we can race with other threads compiling the same imethod, but this is not a problem
-	if (!new_imethod->transformed)
+	if (!new_imethod->transformed) {
+		mono_interp_pgo_method_tiering_up (imethod);
 		mono_interp_transform_method (new_imethod, context, error);
+	}
 	// Unoptimized method compiled fine, optimized method should also compile without error
 	mono_error_assert_ok (error);
 
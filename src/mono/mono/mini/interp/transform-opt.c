@@ -3877,6 +3877,272 @@ retry_ins:
 	}
 }
 
+/*
+ * LOOP OPTIMIZATION
+ */
+
+static gboolean
+bb_dominates (TransformData *td, InterpBasicBlock *dom, InterpBasicBlock *bb)
+{
+	while (bb != dom && bb != td->entry_bb)
+		bb = td->idoms [bb->dfs_index];
+	return bb == dom;
+}
+
+// Collects in loop_bbs the natural loop of header, formed by the header together with all bblocks
+// that can reach one of its back edges without going through the header. Returns FALSE if header
+// is not the target of any back edge.
+static gboolean
+interp_compute_natural_loop (TransformData *td, InterpBasicBlock *header, MonoBitSet *loop_bbs, InterpBasicBlock **stack)
+{
+	int next_stack_index = 0;
+
+	mono_bitset_clear_all (loop_bbs);
+	mono_bitset_set_fast (loop_bbs, header->dfs_index);
+
+	gboolean has_back_edge = FALSE;
+	for (int i = 0; i < header->in_count; i++) {
+		InterpBasicBlock *latch = header->in_bb [i];
+		if (!is_bblock_ssa_cfg (td, latch) || !bb_dominates (td, header, latch))
+			continue;
+		has_back_edge = TRUE;
+		if (!mono_bitset_test_fast (loop_bbs, latch->dfs_index)) {
+			mono_bitset_set_fast (loop_bbs, latch->dfs_index);
+			stack [next_stack_index++] = latch;
+		}
+	}
+
+	if (!has_back_edge)
+		return FALSE;
+
+	while (next_stack_index > 0) {
+		InterpBasicBlock *bb = stack [--next_stack_index];
+		for (int i = 0; i < bb->in_count; i++) {
+			InterpBasicBlock *in_bb = bb->in_bb [i];
+			if (is_bblock_ssa_cfg (td, in_bb) && !mono_bitset_test_fast (loop_bbs, in_bb->dfs_index)) {
+				mono_bitset_set_fast (loop_bbs, in_bb->dfs_index);
+				stack [next_stack_index++] = in_bb;
+			}
+		}
+	}
+	return TRUE;
+}
+
+// Returns the single bblock outside the loop that enters the header, if it can receive hoisted code.
+// Loops that can be entered at a tiering patchpoint are skipped, since execution resuming inside
+// the loop would never run the code moved before it.
+static InterpBasicBlock*
+get_loop_preheader (TransformData *td, InterpBasicBlock *header, MonoBitSet *loop_bbs)
+{
+	InterpBasicBlock *preheader = NULL;
+
+	for (int i = 0; i < header->in_count; i++) {
+		InterpBasicBlock *in_bb = header->in_bb [i];
+		if (!is_bblock_ssa_cfg (td, in_bb))
+			return NULL;
+		if (mono_bitset_test_fast (loop_bbs, in_bb->dfs_index))
+			continue;
+		if (preheader)
+			return NULL;
+		preheader = in_bb;
+	}
+
+	if (!preheader || preheader->out_count != 1)
+		return NULL;
+
+	InterpInst *last_ins = interp_last_ins (preheader);
+	if (last_ins && last_ins->opcode != MINT_BR && last_ins->opcode != MINT_BR_S) {
+		int opcode = last_ins->opcode;
+		if (MINT_IS_UNCONDITIONAL_BRANCH (opcode) || MINT_IS_CONDITIONAL_BRANCH (opcode) || MINT_IS_SUPER_BRANCH (opcode) || opcode == MINT_SWITCH)
+			return NULL;
+	}
+
+	int i;
+	mono_bitset_foreach_bit (loop_bbs, i, td->bblocks_count_no_eh) {
+		InterpBasicBlock *bb = td->bblocks [i];
+		if (bb->patchpoint_data)
+			return NULL;
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			if (ins->opcode == MINT_TIER_PATCHPOINT_DATA)
+				return NULL;
+		}
+	}
+
+	return preheader;
+}
+
+// Pure instructions that can't throw, so they can be executed in the preheader even if the
+// loop body would have skipped them.
+static gboolean
+is_loop_invariant_candidate (int opcode)
+{
+	if (MINT_IS_LDC_I4 (opcode) || MINT_IS_LDC_I8 (opcode) || opcode == MINT_LDC_R4 || opcode == MINT_LDC_R8)
+		return TRUE;
+	if (MINT_IS_MOV (opcode))
+		return opcode != MINT_MOV_VT;
+	if (MINT_IS_BINOP (opcode))
+		return !(opcode >= MINT_DIV_I4 && opcode <= MINT_SUB_OVF_UN_I8) && !(opcode >= MINT_REM_I4 && opcode <= MINT_REM_UN_I8);
+	if (MINT_IS_UNOP (opcode))
+		return !(opcode >= MINT_CONV_OVF_I1_I4 && opcode <= MINT_CONV_OVF_U8_R8);
+	if (MINT_IS_BINOP_IMM (opcode))
+		return TRUE;
+	return FALSE;
+}
+
+// The hoisted definition must be the only definition of the var, for the whole method.
+// Fixed ssa vars are renamed back to the original var when exiting ssa, so they are excluded.
+static gboolean
+can_hoist_var_def (TransformData *td, int var)
+{
+	InterpVar *var_data = &td->vars [var];
+	if (!var_is_ssa_form (td, var))
+		return FALSE;
+	if (var_data->renamed_ssa_fixed || var_data->def_arg || var_data->call_args || var_data->il_global)
+		return FALSE;
+	return TRUE;
+}
+
+#define MAX_LOOP_LDLEN_ARRAYS 8
+
+// The header dominates every bblock in the loop. Once an array length is loaded there, any other
+// ldlen of the same ssa var in the loop can't throw and produces the same value.
+static void
+interp_loop_remove_redundant_ldlen (TransformData *td, InterpBasicBlock *header, MonoBitSet *loop_bbs)
+{
+	int array_vars [MAX_LOOP_LDLEN_ARRAYS];
+	int length_vars [MAX_LOOP_LDLEN_ARRAYS];
+	int count = 0;
+
+	for (InterpInst *ins = header->first_ins; ins != NULL; ins = ins->next) {
+		if (ins->opcode != MINT_LDLEN || count == MAX_LOOP_LDLEN_ARRAYS)
+			continue;
+		if (var_is_ssa_form (td, ins->sregs [0]) && can_hoist_var_def (td, ins->dreg)) {
+			array_vars [count] = ins->sregs [0];
+			length_vars [count] = ins->dreg;
+			count++;
+		}
+	}
+
+	if (!count)
+		return;
+
+	int i;
+	mono_bitset_foreach_bit (loop_bbs, i, td->bblocks_count_no_eh) {
+		InterpBasicBlock *bb = td->bblocks [i];
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			if (ins->opcode != MINT_LDLEN)
+				continue;
+			for (int j = 0; j < count; j++) {
+				if (ins->sregs [0] == array_vars [j] && ins->dreg != length_vars [j]) {
+					if (td->verbose_level) {
+						g_print ("Redundant ldlen in BB%d:\n\t", bb->index);
+						interp_dump_ins (ins, td->data_items);
+					}
+					ins->opcode = MINT_MOV_P;
+					ins->sregs [0] = length_vars [j];
+					break;
+				}
+			}
+		}
+	}
+}
+
+static void
+interp_loop_hoist_invariants (TransformData *td, InterpBasicBlock *preheader, MonoBitSet *loop_bbs, MonoBitSet *loop_vars)
+{
+	int i;
+
+	// Vars defined inside the loop. Since we are in ssa, every other ssa var has the same value
+	// for the whole duration of the loop.
+	mono_bitset_clear_all (loop_vars);
+	mono_bitset_foreach_bit (loop_bbs, i, td->bblocks_count_no_eh) {
+		InterpBasicBlock *bb = td->bblocks [i];
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			if (mono_interp_op_dregs [ins->opcode])
+				mono_bitset_set_fast (loop_vars, ins->dreg);
+		}
+	}
+
+	InterpInst *insert_after = interp_last_ins (preheader);
+	if (insert_after && (insert_after->opcode == MINT_BR || insert_after->opcode == MINT_BR_S))
+		insert_after = insert_after->prev;
+	else
+		insert_after = preheader->last_ins;
+
+	// We visit bblocks in dfs order so the definition of a var is reached before its uses
+	mono_bitset_foreach_bit (loop_bbs, i, td->bblocks_count_no_eh) {
+		InterpBasicBlock *bb = td->bblocks [i];
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			int opcode = ins->opcode;
+			if (!is_loop_invariant_candidate (opcode) || !can_hoist_var_def (td, ins->dreg))
+				continue;
+
+			gboolean invariant = TRUE;
+			for (int j = 0; j < mono_interp_op_sregs [opcode]; j++) {
+				int sreg = ins->sregs [j];
+				if (!var_is_ssa_form (td, sreg) || mono_bitset_test_fast (loop_vars, sreg)) {
+					invariant = FALSE;
+					break;
+				}
+			}
+			if (!invariant)
+				continue;
+
+			InterpInst *new_ins = interp_insert_ins_bb (td, preheader, insert_after, opcode);
+			new_ins->dreg = ins->dreg;
+			memcpy (new_ins->sregs, ins->sregs, sizeof (ins->sregs));
+			memcpy (new_ins->data, ins->data, (mono_interp_oplen [opcode] - 1) * sizeof (guint16));
+			// Keep the liveness marker on both instructions, so the liveness positions computed
+			// during ssa renaming remain valid for every other instruction
+			new_ins->flags = ins->flags;
+			insert_after = new_ins;
+
+			interp_clear_ins (ins);
+			mono_bitset_clear_fast (loop_vars, new_ins->dreg);
+
+			if (td->verbose_level) {
+				g_print ("Hoist from BB%d to BB%d:\n\t", bb->index, preheader->index);
+				interp_dump_ins (new_ins, td->data_items);
+			}
+		}
+	}
+}
+
+static void
+interp_loop_opt (TransformData *td)
+{
+	int bb_count = td->bblocks_count_no_eh;
+	if (bb_count < 2)
+		return;
+
+	if (td->verbose_level)
+		g_print ("\nLOOP OPTIMIZATION:\n");
+
+	MonoBitSet *loop_bbs = mono_bitset_mem_new (mono_mempool_alloc0 (td->opt_mempool, mono_bitset_alloc_size (bb_count, 0)), bb_count, 0);
+	MonoBitSet *loop_vars = mono_bitset_mem_new (mono_mempool_alloc0 (td->opt_mempool, mono_bitset_alloc_size (td->vars_size, 0)), td->vars_size, 0);
+	InterpBasicBlock **stack = (InterpBasicBlock**)g_malloc (sizeof (InterpBasicBlock*) * bb_count);
+
+	// Headers of inner loops come later in reverse postorder. Processing them first allows code
+	// hoisted into the preheader of an inner loop to be hoisted again out of the outer loop.
+	for (int i = bb_count - 1; i > 0; i--) {
+		InterpBasicBlock *header = td->bblocks [i];
+		if (!interp_compute_natural_loop (td, header, loop_bbs, stack))
+			continue;
+
+		InterpBasicBlock *preheader = get_loop_preheader (td, header, loop_bbs);
+		if (!preheader)
+			continue;
+
+		if (td->verbose_level)
+			g_print ("Loop with header BB%d, preheader BB%d\n", header->index, preheader->index);
+
+		interp_loop_remove_redundant_ldlen (td, header, loop_bbs);
+		interp_loop_hoist_invariants (td, preheader, loop_bbs, loop_vars);
+	}
+
+	g_free (stack);
+}
+
 static void
 interp_prepare_no_ssa_opt (TransformData *td)
 {
@@ -3929,6 +4195,103 @@ interp_remove_nops (TransformData *td)
 	}
 }
 
+/*
+ * PGO BLOCK LAYOUT
+ */
+
+// Returns the conditional branch that jumps when opcode doesn't, or -1
+static int
+interp_get_inverted_cond_branch (int opcode)
+{
+	if (opcode >= MINT_BRFALSE_I4 && opcode <= MINT_BRFALSE_I8)
+		return opcode + MINT_BRTRUE_I4 - MINT_BRFALSE_I4;
+	if (opcode >= MINT_BRTRUE_I4 && opcode <= MINT_BRTRUE_I8)
+		return opcode + MINT_BRFALSE_I4 - MINT_BRTRUE_I4;
+	if (opcode < MINT_BEQ_I4 || opcode > MINT_BLT_UN_R8)
+		return -1;
+
+	// Every compare branch is defined, in order, for I4, I8, R4 and R8
+	int type = (opcode - MINT_BEQ_I4) % 4;
+	// For floats, the inverted compare also needs to be true for unordered operands
+	gboolean is_float = type >= 2;
+	int inverted;
+	switch (opcode - type) {
+		case MINT_BEQ_I4: inverted = MINT_BNE_UN_I4; break;
+		case MINT_BNE_UN_I4: inverted = MINT_BEQ_I4; break;
+		case MINT_BGE_I4: inverted = is_float ? MINT_BLT_UN_I4 : MINT_BLT_I4; break;
+		case MINT_BGT_I4: inverted = is_float ? MINT_BLE_UN_I4 : MINT_BLE_I4; break;
+		case MINT_BLT_I4: inverted = is_float ? MINT_BGE_UN_I4 : MINT_BGE_I4; break;
+		case MINT_BLE_I4: inverted = is_float ? MINT_BGT_UN_I4 : MINT_BGT_I4; break;
+		case MINT_BGE_UN_I4: inverted = is_float ? MINT_BLT_I4 : MINT_BLT_UN_I4; break;
+		case MINT_BGT_UN_I4: inverted = is_float ? MINT_BLE_I4 : MINT_BLE_UN_I4; break;
+		case MINT_BLT_UN_I4: inverted = is_float ? MINT_BGE_I4 : MINT_BGE_UN_I4; break;
+		case MINT_BLE_UN_I4: inverted = is_float ? MINT_BGT_I4 : MINT_BGT_UN_I4; break;
+		default: return -1;
+	}
+	return inverted + type;
+}
+
+static gboolean
+interp_bb_falls_through (InterpBasicBlock *bb)
+{
+	if (!bb->out_count)
+		return FALSE;
+	InterpInst *last_ins = interp_last_ins (bb);
+	return !last_ins || last_ins->opcode != MINT_BR;
+}
+
+// For conditional branches that the PGO profile says are mostly taken, we move the
+// fallthrough bblock out of the way, at the end of the method, so the hot path becomes
+// the fallthrough. This is done before any optimizations, on the bblocks in IL order.
+void
+interp_pgo_layout_bblocks (TransformData *td)
+{
+	InterpBasicBlock *last_bb = td->entry_bb;
+	while (last_bb->next_bb)
+		last_bb = last_bb->next_bb;
+
+	for (InterpBasicBlock *bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		if (!bb->pgo_branch_taken)
+			continue;
+		InterpInst *branch = interp_last_ins (bb);
+		if (!branch)
+			continue;
+		int inverted_opcode = interp_get_inverted_cond_branch (branch->opcode);
+		if (inverted_opcode == -1)
+			continue;
+
+		InterpBasicBlock *cold_bb = bb->next_bb;
+		InterpBasicBlock *hot_bb = branch->info.target_bb;
+		if (!cold_bb || cold_bb == last_bb || cold_bb->next_bb != hot_bb || cold_bb->preserve)
+			continue;
+		// The last bblock will no longer be at the end, so it must not fall through
+		if (interp_bb_falls_through (last_bb))
+			continue;
+
+		if (interp_bb_falls_through (cold_bb)) {
+			// It can only fall through into hot_bb, add an explicit branch instead
+			InterpInst *cold_last_ins = interp_last_ins (cold_bb);
+			if (cold_bb->out_count != 1 || cold_bb->out_bb [0] != hot_bb ||
+					(cold_last_ins && (MINT_IS_CONDITIONAL_BRANCH (cold_last_ins->opcode) ||
+					MINT_IS_UNCONDITIONAL_BRANCH (cold_last_ins->opcode) || cold_last_ins->opcode == MINT_SWITCH)))
+				continue;
+			InterpInst *new_inst = interp_insert_ins_bb (td, cold_bb, cold_bb->last_ins, MINT_BR);
+			new_inst->info.target_bb = hot_bb;
+		}
+
+		branch->opcode = GINT_TO_OPCODE (inverted_opcode);
+		branch->info.target_bb = cold_bb;
+
+		bb->next_bb = hot_bb;
+		cold_bb->next_bb = NULL;
+		last_bb->next_bb = cold_bb;
+		last_bb = cold_bb;
+
+		if (td->verbose_level)
+			g_print ("PGO layout: moved BB%d to the end, BB%d falls through into BB%d\n", cold_bb->index, bb->index, hot_bb->index);
+	}
+}
+
 void
 interp_optimize_code (TransformData *td)
 {
@@ -3965,10 +4328,13 @@ optimization_retry:
 
 	td->need_optimization_retry = FALSE;
 
-	if (td->disable_ssa)
+	if (td->disable_ssa) {
 		interp_prepare_no_ssa_opt (td);
-	else
+	} else {
 		MONO_TIME_TRACK (mono_interp_stats.ssa_compute_time, interp_compute_ssa (td));
+		if (mono_interp_opt & INTERP_OPT_LOOPS)
+			MONO_TIME_TRACK (mono_interp_stats.loop_opt_time, interp_loop_opt (td));
+	}
 
 	MONO_TIME_TRACK (mono_interp_stats.cprop_time, interp_cprop (td));
 
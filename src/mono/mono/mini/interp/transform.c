@@ -798,6 +798,45 @@ try_fold_one_arg_branch (TransformData *td, int mint_op)
 	return -1;
 }
 
+static InterpPgoBranchCounter*
+interp_pgo_add_branch_counter (TransformData *td)
+{
+	InterpPgoBranchCounter *counter = (InterpPgoBranchCounter*)imethod_alloc0 (td, sizeof (InterpPgoBranchCounter));
+	counter->il_offset = td->current_il_offset;
+	td->pgo_branch_counters = g_slist_prepend (td->pgo_branch_counters, counter);
+	td->pgo_branch_counters_n++;
+	return counter;
+}
+
+static void
+interp_add_pgo_count (TransformData *td, guint32 *count)
+{
+	interp_add_ins (td, MINT_PGO_COUNT);
+	WRITE64_INS (td->last_ins, 0, &count);
+}
+
+// Called before emitting a conditional branch that wasn't folded. In unoptimized code that is
+// recorded for PGO, we count how many times the branch is executed. The returned counter is used
+// to also count the times it falls through, once the branch is emitted. In optimized code, we
+// remember the branches that the loaded profile says are mostly taken, for bblock layout.
+static InterpPgoBranchCounter*
+interp_pgo_handle_cond_branch (TransformData *td)
+{
+	if (td->pgo_record_branches) {
+		InterpPgoBranchCounter *counter = interp_pgo_add_branch_counter (td);
+		interp_add_pgo_count (td, &counter->executed);
+		return counter;
+	}
+
+	gboolean taken;
+	if (td->optimized && !td->inlined_method &&
+			mono_interp_pgo_get_branch_direction (td->method, td->current_il_offset, &taken) && taken) {
+		td->cbb->pgo_branch_taken = TRUE;
+		td->has_pgo_branch_hints = TRUE;
+	}
+	return NULL;
+}
+
 static gboolean
 one_arg_branch(TransformData *td, int mint_op, int offset, int inst_size)
 {
@@ -816,8 +855,12 @@ one_arg_branch(TransformData *td, int mint_op, int offset, int inst_size)
 				return TRUE;
 			}
 		} else {
+			InterpPgoBranchCounter *pgo_counter = interp_pgo_handle_cond_branch (td);
 			handle_branch (td, long_op, offset + inst_size);
 			interp_ins_set_sreg (td->last_ins, td->sp->var);
+			// Only reached when the branch is not taken
+			if (pgo_counter)
+				interp_add_pgo_count (td, &pgo_counter->not_taken);
 			return TRUE;
 		}
 	} else {
@@ -907,8 +950,11 @@ two_arg_branch(TransformData *td, int mint_op, int offset, int inst_size)
 				return TRUE;
 			}
 		} else {
+			InterpPgoBranchCounter *pgo_counter = interp_pgo_handle_cond_branch (td);
 			handle_branch (td, long_op, offset + inst_size);
 			interp_ins_set_sregs2 (td->last_ins, td->sp [0].var, td->sp [1].var);
+			if (pgo_counter)
+				interp_add_pgo_count (td, &pgo_counter->not_taken);
 			return TRUE;
 		}
 	} else {
@@ -2957,7 +3003,14 @@ interp_method_check_inlining (TransformData *td, MonoMethod *method, MonoMethodS
 	if (td->inline_depth > INLINE_DEPTH_LIMIT)
 		return FALSE;
 
-	if (header.code_size >= INLINE_LENGTH_LIMIT) {
+	int length_limit = INLINE_LENGTH_LIMIT;
+#if HOST_BROWSER
+	// Calls end jiterpreter traces, so keeping small callees inline lets traces run across them
+	if (mono_opt_jiterpreter_traces_enabled && mono_opt_jiterpreter_inline_length_limit > length_limit)
+		length_limit = mono_opt_jiterpreter_inline_length_limit;
+#endif
+
+	if (header.code_size >= length_limit) {
 		gboolean aggressive_inlining = (method->iflags & METHOD_IMPL_ATTRIBUTE_AGGRESSIVE_INLINING);
 		if (!aggressive_inlining)
 			aggressive_inlining = has_intrinsic_attribute(method);
@@ -9634,6 +9687,9 @@ retry:
 		td->optimized = rtm->optimized;
 		td->disable_inlining = !td->optimized;
 	}
+	// Branch directions are collected from the unoptimized code when the method tiers up
+	td->pgo_record_branches = mono_opt_interp_pgo_recording && !td->optimized &&
+		mono_interp_tiering_enabled () && method->wrapper_type == MONO_WRAPPER_NONE;
 	rtm->data_items = td->data_items;
 
 	if (td->prof_coverage)
@@ -9686,6 +9742,8 @@ retry:
 	}
 
 	if (td->optimized) {
+		if (td->has_pgo_branch_hints && !header->num_clauses)
+			interp_pgo_layout_bblocks (td);
 		MONO_TIME_TRACK (mono_interp_stats.optimize_time, interp_optimize_code (td));
 		interp_alloc_offsets (td);
 		interp_squash_initlocals (td);
@@ -9782,6 +9840,14 @@ retry:
 	mono_interp_register_imethod_data_items (rtm->data_items, td->imethod_items);
 	rtm->patchpoint_data = td->patchpoint_data;
 
+	if (td->pgo_branch_counters_n) {
+		int i = td->pgo_branch_counters_n;
+		rtm->pgo_branch_counters = (InterpPgoBranchCounter**)imethod_alloc0 (td, i * sizeof (InterpPgoBranchCounter*));
+		for (GSList *l = td->pgo_branch_counters; l; l = l->next)
+			rtm->pgo_branch_counters [--i] = (InterpPgoBranchCounter*)l->data;
+		rtm->num_pgo_branch_counters = td->pgo_branch_counters_n;
+	}
+
 	if (td->ref_slots) {
 		gpointer ref_slots_mem = mono_mem_manager_alloc0 (td->mem_manager, mono_bitset_alloc_size (rtm->alloca_size / sizeof (gpointer), 0));
 		rtm->ref_slots = mono_bitset_mem_new (ref_slots_mem, rtm->alloca_size / sizeof (gpointer), 0);
@@ -9854,6 +9920,7 @@ exit:
 	if (td->line_numbers)
 		g_array_free (td->line_numbers, TRUE);
 	g_slist_free (td->imethod_items);
+	g_slist_free (td->pgo_branch_counters);
 	mono_mempool_destroy (td->mempool);
 	mono_interp_pgo_generate_end ();
 	if (td->retry_compilation) {
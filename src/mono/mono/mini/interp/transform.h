@@ -167,6 +167,8 @@ struct _InterpBasicBlock {
 	// used by jiterpreter
 	guint backwards_branch_target: 1;
 	guint contains_call_instruction: 1;
+	// The conditional branch ending this bblock was mostly taken according to the loaded PGO profile
+	guint pgo_branch_taken: 1;
 };
 
 struct _InterpCallInfo {
@@ -345,6 +347,9 @@ typedef struct
 	int inline_depth;
 	int patchpoint_data_n;
 	int *patchpoint_data;
+	// Branch counters allocated while instrumenting unoptimized code for PGO, in reverse order
+	GSList *pgo_branch_counters;
+	int pgo_branch_counters_n;
 	// This marks each stack slot offset that might contain refs throughout the execution of this method
 	MonoBitSet *ref_slots;
 	guint has_localloc : 1;
@@ -362,6 +367,8 @@ typedef struct
 	guint eh_vars_computed : 1;
 	guint retry_compilation : 1;
 	guint retry_with_inlining : 1;
+	guint pgo_record_branches : 1;
+	guint has_pgo_branch_hints : 1;
 } TransformData;
 
 #define STACK_TYPE_I4 0
@@ -529,6 +536,9 @@ interp_compute_native_offset_estimates (TransformData *td, gboolean final_code);
 void
 interp_optimize_code (TransformData *td);
 
+void
+interp_pgo_layout_bblocks (TransformData *td);
+
 void
 interp_alloc_offsets (TransformData *td);
 
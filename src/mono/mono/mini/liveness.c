@@ -35,6 +35,13 @@
 
 #ifdef ENABLE_LIVENESS2
 static void mono_analyze_liveness2 (MonoCompile *cfg);
+
+/*
+ * When JITting, only compute precise live intervals for methods with loops, since
+ * spilling global vars around the loop bblocks is where the coarse ranges cost the
+ * most, and only up to this many bblocks, to bound the compile time.
+ */
+#define LIVENESS2_JIT_MAX_BBLOCKS 256
 #endif
 
 
@@ -358,6 +365,32 @@ analyze_liveness_bb (MonoCompile *cfg, MonoBasicBlock *bb)
 	}
 }
 
+#ifdef ENABLE_LIVENESS2
+/*
+ * need_liveness2:
+ *
+ *   Return whenever to compute precise live intervals for the vars of CFG. These
+ * allow mono_linear_scan () to assign the same hreg to vars whose live ranges
+ * interleave without overlapping, instead of spilling one of them.
+ */
+static gboolean
+need_liveness2 (MonoCompile *cfg)
+{
+	if (cfg->compile_aot)
+		return TRUE;
+
+	if (!(cfg->opt & MONO_OPT_LINEARS) || cfg->num_bblocks > LIVENESS2_JIT_MAX_BBLOCKS)
+		return FALSE;
+
+	/* bb->nesting is only computed with MONO_OPT_LOOP */
+	for (guint i = 0; i < cfg->num_bblocks; ++i) {
+		if (cfg->bblocks [i]->nesting > 0)
+			return TRUE;
+	}
+	return FALSE;
+}
+#endif
+
 /* generic liveness analysis code. CFG specific parts are
  * in update_gen_kill_set()
  */
@@ -632,8 +665,8 @@ mono_analyze_liveness (MonoCompile *cfg)
 		optimize_initlocals (cfg);
 
 #ifdef ENABLE_LIVENESS2
-	/* This improves code size by about 5% but slows down compilation too much */
-	if (cfg->compile_aot)
+	/* This improves code size by about 5% but slows down compilation too much to do it for all methods */
+	if (need_liveness2 (cfg))
 		mono_analyze_liveness2 (cfg);
 #endif
 }
@@ -12356,6 +12356,10 @@ all_bbs_done:
 	/* emit profiler enter code after a jit attach if there is one */
 	cfg->cbb = init_localsbb2;
 	mini_profiler_emit_enter (cfg);
+#ifdef ENABLE_EXPERIMENT_TIERED
+	if (cfg->tiered_llvm)
+		mini_tiered_emit_jit_enter (cfg);
+#endif
 	cfg->cbb = init_localsbb;
 
 	if (seq_points) {
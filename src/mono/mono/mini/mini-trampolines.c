@@ -754,8 +754,13 @@ common_call_trampoline (host_mgreg_t *regs, guint8 *code, MonoMethod *m, MonoVTa
 			/* LLVM code doesn't make direct calls */
 			if (ji && ji->from_llvm)
 				no_patch = TRUE;
-			if (!no_patch && ji)
+			if (!no_patch && ji) {
 				mono_arch_patch_callsite ((guint8 *)ji->code_start, code, (guint8 *)addr);
+#ifdef ENABLE_EXPERIMENT_TIERED
+				if (mono_opt_jit_llvm_tiering && target_ji && !target_ji->from_llvm)
+					mini_tiered_record_jit_callsite (code, jinfo_get_method (target_ji));
+#endif
+			}
 		}
 	}
 
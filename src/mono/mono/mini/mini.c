@@ -3222,6 +3222,13 @@ mini_method_compile (MonoMethod *method, guint32 opts, JitFlags flags, int parts
 
 #ifdef ENABLE_LLVM
 	try_llvm = mono_use_llvm || llvm;
+#ifdef ENABLE_EXPERIMENT_TIERED
+	/* Start with the JIT, hot methods are recompiled with LLVM by the tiered compilation thread */
+	gboolean tiered_llvm = mono_opt_jit_llvm_tiering && try_llvm && !llvm && !compile_aot && !try_generic_shared &&
+		!(flags & JIT_FLAG_LLVM_ONLY) && method->wrapper_type == MONO_WRAPPER_NONE;
+	if (tiered_llvm)
+		try_llvm = FALSE;
+#endif
 #endif
 
 #ifdef MONO_ARCH_FLOAT32_SUPPORTED
@@ -3295,6 +3302,9 @@ mini_method_compile (MonoMethod *method, guint32 opts, JitFlags flags, int parts
 	if (cfg->gshared)
 		cfg->rgctx_access = mini_get_rgctx_access_for_method (cfg->method);
 	cfg->compile_llvm = try_llvm;
+#if defined(ENABLE_LLVM) && defined(ENABLE_EXPERIMENT_TIERED)
+	cfg->tiered_llvm = tiered_llvm;
+#endif
 	cfg->token_info_hash = g_hash_table_new (NULL, NULL);
 	if (cfg->compile_aot)
 		cfg->method_index = aot_method_index;
@@ -4365,6 +4375,67 @@ mono_jit_compile_method_inner (MonoMethod *method, int opt, MonoError *error)
 	return MINI_ADDR_TO_FTNPTR (code);
 }
 
+#ifdef ENABLE_EXPERIMENT_TIERED
+/*
+ * mini_tiered_recompile_llvm:
+ *
+ *   Recompile METHOD, which was compiled by the JIT without LLVM, using LLVM, and make the new
+ * code the one returned by future lookups of METHOD. The old code stays valid since it might
+ * still be executing or referenced from vtables. Return NULL if LLVM couldn't compile the method.
+ */
+gpointer
+mini_tiered_recompile_llvm (MonoMethod *method, guint32 opt)
+{
+#ifdef ENABLE_LLVM
+	MonoCompile *cfg;
+	MonoJitInfo *jinfo;
+	gpointer code;
+	gint64 start;
+
+	start = mono_time_track_start ();
+	cfg = mini_method_compile (method, opt, JIT_FLAG_RUN_CCTORS | JIT_FLAG_LLVM, 0, -1);
+	gint64 jit_time = 0;
+	mono_time_track_end (&jit_time, start);
+	UnlockedAdd64 (&mono_jit_stats.jit_time, jit_time);
+
+	/* mini_method_compile () falls back to the JIT if LLVM fails */
+	if (cfg->exception_type != MONO_EXCEPTION_NONE || !cfg->compile_llvm) {
+		mono_destroy_compile (cfg);
+		return NULL;
+	}
+
+	mono_loader_lock ();
+
+	MonoJitMemoryManager *jit_mm = (MonoJitMemoryManager*)cfg->jit_mm;
+
+	jit_code_hash_lock (jit_mm);
+	mono_internal_hash_table_remove (&jit_mm->jit_code_hash, cfg->jit_info->d.method);
+	mono_internal_hash_table_insert (&jit_mm->jit_code_hash, cfg->jit_info->d.method, cfg->jit_info);
+	jit_code_hash_unlock (jit_mm);
+
+	code = cfg->native_code;
+	jinfo = cfg->jit_info;
+
+	mono_update_jit_stats (cfg);
+
+	mono_destroy_compile (cfg);
+
+	mini_patch_llvm_jit_callees (method, code);
+#ifndef DISABLE_JIT
+	mono_emit_jit_map (jinfo);
+	mono_emit_jit_dump (jinfo, code);
+#endif
+	mono_loader_unlock ();
+
+	MONO_PROFILER_RAISE (jit_done, (method, jinfo));
+
+	return MINI_ADDR_TO_FTNPTR (code);
+#else
+	return NULL;
+#endif
+}
+#endif
+
 /*
  * mini_get_underlying_type:
  *
@@ -1446,6 +1446,8 @@ typedef struct {
 	guint            compile_aot : 1;
 	guint            full_aot : 1;
 	guint            compile_llvm : 1;
+	/* Compiled without LLVM, to be recompiled with LLVM by the tiered compilation thread once hot */
+	guint            tiered_llvm : 1;
 	guint            got_var_allocated : 1;
 	guint            ret_var_is_local : 1;
 	guint            ret_var_set : 1;
@@ -2130,6 +2132,13 @@ void        mini_profiler_emit_samplepoint (MonoCompile *cfg);
 void        mini_profiler_emit_leave (MonoCompile *cfg, MonoInst *ret);
 void        mini_profiler_emit_tail_call (MonoCompile *cfg, MonoMethod *target);
 void        mini_profiler_emit_call_finally (MonoCompile *cfg, MonoMethodHeader *header, unsigned char *ip, guint32 index, MonoExceptionClause *clause);
+
+#ifdef ENABLE_EXPERIMENT_TIERED
+/* tiered compilation support */
+void        mini_tiered_emit_jit_enter (MonoCompile *cfg);
+void        mini_tiered_record_jit_callsite (gpointer callsite, MonoMethod *target_method);
+gpointer    mini_tiered_recompile_llvm (MonoMethod *method, guint32 opt);
+#endif
 void        mini_profiler_context_enable (void);
 gpointer    mini_profiler_context_get_this (MonoProfilerCallContext *ctx);
 gpointer    mini_profiler_context_get_argument (MonoProfilerCallContext *ctx, guint32 pos);
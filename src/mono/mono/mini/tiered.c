@@ -3,6 +3,7 @@
 
 #include "mini.h"
 #include "mini-runtime.h"
+#include "ir-emit.h"
 #include <mono/utils/mono-counters.h>
 #include <mono/utils/mono-logger-internals.h>
 
@@ -23,7 +24,11 @@ static const char* const patch_kind_str[] = {
 	"JIT",
 };
 
+/* Protected by callsites_mutex */
 static GHashTable *callsites_hash [TIERED_PATCH_KIND_NUM] = { NULL };
+/* MonoMethod -> MiniTieredJitMethod, protected by callsites_mutex */
+static GHashTable *jit_methods;
+static MonoCoopMutex callsites_mutex;
 
 /* TODO: use scientific methods (TM) to determine values */
 static const int threshold [NUM_TIERS] = {
@@ -31,6 +36,63 @@ static const int threshold [NUM_TIERS] = {
 	3000, /* tier 1 */
 };
 
+static GSList *
+take_callsites (MonoMethod *method, int patch_kind)
+{
+	GSList *patchsites = NULL;
+
+	mono_coop_mutex_lock (&callsites_mutex);
+	if (callsites_hash [patch_kind]) {
+		patchsites = (GSList *) g_hash_table_lookup (callsites_hash [patch_kind], method);
+		g_hash_table_remove (callsites_hash [patch_kind], method);
+	}
+	mono_coop_mutex_unlock (&callsites_mutex);
+
+	return patchsites;
+}
+
+static void
+process_patch_point (MiniTieredPatchPointContext *ppc)
+{
+	if (ppc->tier_level == TIERED_LEVEL_LLVM) {
+		MiniTieredJitMethod *jm;
+
+		mono_coop_mutex_lock (&callsites_mutex);
+		jm = (MiniTieredJitMethod *) g_hash_table_lookup (jit_methods, ppc->target_method);
+		mono_coop_mutex_unlock (&callsites_mutex);
+		g_assert (jm);
+
+		ppc->new_code = mini_tiered_recompile_llvm (ppc->target_method, jm->opt);
+		if (!ppc->new_code) {
+			mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: LLVM couldn't compile %s, keeping JIT code.", mono_method_full_name (ppc->target_method, TRUE));
+			g_slist_free (take_callsites (ppc->target_method, TIERED_PATCH_KIND_JIT));
+			return;
+		}
+	}
+
+	for (int patch_kind = 0; patch_kind < TIERED_PATCH_KIND_NUM; patch_kind++) {
+		/* JIT callsites can only be patched once there is new code for them */
+		if (patch_kind == TIERED_PATCH_KIND_JIT && !ppc->new_code)
+			continue;
+
+		GSList *patchsites = take_callsites (ppc->target_method, patch_kind);
+
+		for (GSList *l = patchsites; l != NULL; l = l->next) {
+			gpointer patchsite = (gpointer) l->data;
+
+			mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], ppc->tier_level);
+			mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> caller=%s", mono_pmip (patchsite));
+			mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> callee=%s", mono_method_full_name (ppc->target_method, TRUE));
+
+			gboolean success = patchers [patch_kind] (ppc, patchsite);
+
+			if (!success)
+				mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
+		}
+		g_slist_free (patchsites);
+	}
+}
+
 static void
 compiler_thread (void)
 {
@@ -40,45 +102,54 @@ compiler_thread (void)
 
 	mono_native_thread_set_name (mono_native_thread_id_get (), "Tiered Compilation Thread");
 
+	mono_coop_mutex_lock (&compilation_mutex);
 	while (TRUE) {
-		mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
+		GSList *queues [NUM_TIERS];
+		gboolean pending = FALSE;
+
+		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++)
+			pending |= compilation_queue [tier_level] != NULL;
+		if (!pending) {
+			mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
+			continue;
+		}
 
 		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
-			GSList *ppcs = compilation_queue [tier_level];
+			queues [tier_level] = compilation_queue [tier_level];
 			compilation_queue [tier_level] = NULL;
+		}
 
-			for (GSList *ppc_= ppcs; ppc_ != NULL; ppc_ = ppc_->next) {
-				MiniTieredPatchPointContext *ppc = (MiniTieredPatchPointContext *) ppc_->data;
-
-				for (int patch_kind = 0; patch_kind < TIERED_PATCH_KIND_NUM; patch_kind++) {
-					if (!callsites_hash [patch_kind])
-						continue;
-
-					GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
-
-					for (; patchsites != NULL; patchsites = patchsites->next) {
-						gpointer patchsite = (gpointer) patchsites->data;
-
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], tier_level);
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> caller=%s", mono_pmip (patchsite));
-						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> callee=%s", mono_method_full_name (ppc->target_method, TRUE));
+		/* Don't block threads queueing new methods while compiling */
+		mono_coop_mutex_unlock (&compilation_mutex);
 
-						gboolean success = patchers [patch_kind] (ppc, patchsite);
+		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
+			for (GSList *ppc_= queues [tier_level]; ppc_ != NULL; ppc_ = ppc_->next) {
+				MiniTieredPatchPointContext *ppc = (MiniTieredPatchPointContext *) ppc_->data;
 
-						if (!success)
-							mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
-					}
-					g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
-					g_slist_free (patchsites);
-				}
+				process_patch_point (ppc);
 				g_free (ppc);
 			}
-			g_slist_free (ppcs);
+			g_slist_free (queues [tier_level]);
 		}
-		mono_coop_mutex_unlock (&compilation_mutex);
+
+		mono_coop_mutex_lock (&compilation_mutex);
 	}
 }
 
+#ifdef ENABLE_LLVM
+static gboolean
+jit_callsite_patcher (MiniTieredPatchPointContext *ctx, gpointer patchsite)
+{
+	MonoJitInfo *ji = mini_jit_info_table_find ((char *) patchsite);
+
+	if (!ji || ji->from_llvm)
+		return FALSE;
+
+	mono_arch_patch_callsite ((guint8 *) ji->code_start, (guint8 *) patchsite, (guint8 *) ctx->new_code);
+	return TRUE;
+}
+#endif
+
 void
 mini_tiered_init (void)
 {
@@ -89,6 +160,13 @@ mini_tiered_init (void)
 
 	mono_coop_cond_init (&compilation_wait);
 	mono_coop_mutex_init (&compilation_mutex);
+	mono_coop_mutex_init (&callsites_mutex);
+	jit_methods = g_hash_table_new (NULL, NULL);
+
+#ifdef ENABLE_LLVM
+	if (mono_opt_jit_llvm_tiering)
+		mini_tiered_register_callsite_patcher (jit_callsite_patcher, TIERED_PATCH_KIND_JIT);
+#endif
 
 	mono_thread_create_internal ((MonoThreadStart)compiler_thread, NULL, MONO_THREAD_CREATE_FLAGS_THREADPOOL, error);
 	mono_error_assert_ok (error);
@@ -102,8 +180,8 @@ mini_tiered_register_callsite_patcher (CallsitePatcher func, int level)
 	patchers [level] = func;
 }
 
-void
-mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_kind)
+static void
+record_callsite_locked (gpointer ip, MonoMethod *target_method, int patch_kind)
 {
 	if (!callsites_hash [patch_kind])
 		callsites_hash [patch_kind] = g_hash_table_new (NULL, NULL);
@@ -113,10 +191,71 @@ mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_k
 	g_hash_table_insert (callsites_hash [patch_kind], target_method, patchsites);
 }
 
+void
+mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_kind)
+{
+	mono_coop_mutex_lock (&callsites_mutex);
+	record_callsite_locked (ip, target_method, patch_kind);
+	mono_coop_mutex_unlock (&callsites_mutex);
+}
+
+/*
+ * mini_tiered_record_jit_callsite:
+ *
+ *   Called by the trampoline code after patching the JIT callsite IP to call TARGET_METHOD.
+ * If TARGET_METHOD will be recompiled with LLVM, remember IP so it can be patched again.
+ */
+void
+mini_tiered_record_jit_callsite (gpointer ip, MonoMethod *target_method)
+{
+	mono_coop_mutex_lock (&callsites_mutex);
+	MiniTieredJitMethod *jm = (MiniTieredJitMethod *) g_hash_table_lookup (jit_methods, target_method);
+	/* Callsites resolved after the method got promoted are not tracked */
+	if (jm && !jm->counter.promoted)
+		record_callsite_locked (ip, target_method, TIERED_PATCH_KIND_JIT);
+	mono_coop_mutex_unlock (&callsites_mutex);
+}
+
+/*
+ * mini_tiered_emit_jit_enter:
+ *
+ *   Emit a call to mini_tiered_jit_method_enter () at the start of a method compiled without
+ * LLVM, which counts calls and queues the method for LLVM recompilation once it gets hot.
+ */
+void
+mini_tiered_emit_jit_enter (MonoCompile *cfg)
+{
+	MonoInst *iargs [1];
+	MiniTieredJitMethod *jm;
+
+	if (cfg->current_method != cfg->method)
+		return;
+
+	mono_coop_mutex_lock (&callsites_mutex);
+	jm = (MiniTieredJitMethod *) g_hash_table_lookup (jit_methods, cfg->method);
+	if (!jm) {
+		jm = (MiniTieredJitMethod *) mono_mem_manager_alloc0 (cfg->mem_manager, sizeof (MiniTieredJitMethod));
+		jm->method = cfg->method;
+		jm->opt = cfg->opt;
+		g_hash_table_insert (jit_methods, cfg->method, jm);
+	}
+	mono_coop_mutex_unlock (&callsites_mutex);
+
+	EMIT_NEW_PCONST (cfg, iargs [0], jm);
+	mono_emit_jit_icall (cfg, mini_tiered_jit_method_enter, iargs);
+}
+
+void
+mini_tiered_jit_method_enter (MiniTieredJitMethod *jm)
+{
+	mini_tiered_inc (jm->method, &jm->counter, TIERED_LEVEL_LLVM);
+}
+
 void
 mini_tiered_inc (MonoMethod *method, MiniTieredCounter *tcnt, int tier_level)
 {
-	if (G_UNLIKELY (tcnt->hotness == threshold [tier_level] && !tcnt->promoted)) {
+	/* The counter is updated without synchronization, so the threshold can be overshot */
+	if (G_UNLIKELY (tcnt->hotness >= threshold [tier_level] && !tcnt->promoted)) {
 		tcnt->promoted = TRUE;
 		mini_tiered_stats.methods_promoted++;
 
@@ -7,6 +7,10 @@
 #define TIERED_PATCH_KIND_JIT 1
 #define TIERED_PATCH_KIND_NUM 2
 
+/* Tier levels, used to index the promotion thresholds */
+#define TIERED_LEVEL_INTERP 0
+#define TIERED_LEVEL_LLVM 1
+
 typedef struct {
 	int hotness;
 	gboolean promoted;
@@ -19,8 +23,17 @@ typedef struct {
 typedef struct {
 	MonoMethod *target_method;
 	int tier_level;
+	/* Code to patch JIT callsites with, set for TIERED_LEVEL_LLVM */
+	gpointer new_code;
 } MiniTieredPatchPointContext;
 
+/* A method compiled by the JIT without LLVM which can be recompiled with LLVM once hot */
+typedef struct {
+	MiniTieredCounter counter;
+	MonoMethod *method;
+	guint32 opt;
+} MiniTieredJitMethod;
+
 typedef gboolean (*CallsitePatcher)(MiniTieredPatchPointContext *context, gpointer patchsite);
 
 void
@@ -35,5 +48,8 @@ mini_tiered_record_callsite (gpointer callsite, MonoMethod *target_method, int l
 void
 mini_tiered_register_callsite_patcher (CallsitePatcher func, int level);
 
+void
+mini_tiered_jit_method_enter (MiniTieredJitMethod *jm);
+
 #endif /* __MONO_MINI_TIERED_H__ */
 #endif /* ENABLE_EXPERIMENT_TIERED */
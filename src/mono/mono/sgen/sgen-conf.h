@@ -231,6 +231,12 @@ typedef target_mword SgenDescriptor;
 #define SGEN_CEMENT_HASH(hv)	(((hv) ^ ((hv) >> SGEN_CEMENT_HASH_SHIFT)) & (SGEN_CEMENT_HASH_SIZE - 1))
 #define SGEN_CEMENT_THRESHOLD	1000
 
+/*
+ * Number of gray objects the major collector's drain loop dequeues and prefetches ahead
+ * of scanning them.  Must be a power of two.
+ */
+#define SGEN_GRAY_PREFETCH_FIFO_SIZE	4
+
 /*
  * Default values for the nursery size
  */
@@ -249,6 +255,19 @@ typedef target_mword SgenDescriptor;
 
 #define SGEN_PAUSE_MODE_MAX_PAUSE_MARGIN 0.5f
 
+/*
+ * In pause mode a concurrent major collection is started once this fraction of the
+ * allowance has been used, so that marking is more likely to be done by the time the
+ * allowance runs out, instead of being completed in the finishing pause.
+ */
+#define SGEN_PAUSE_MODE_CONCURRENT_START_RATIO 0.75
+
+/*
+ * In pause mode a concurrent collection whose workers are still marking can grow the
+ * heap by this fraction more than usual before its finishing pause is forced.
+ */
+#define SGEN_PAUSE_MODE_CONCURRENT_FINISH_SLACK_RATIO 0.5
+
 /*
  * In practice, for nurseries smaller than this, the parallel minor tends to be
  * ineffective, even leading to regressions. Avoid using it for smaller nurseries.
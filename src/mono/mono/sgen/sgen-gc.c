@@ -276,6 +276,9 @@ static guint64 stat_wbarrier_set_root = 0;
 #endif
 
 static guint64 stat_pinned_objects = 0;
+/* Bytes of nursery objects pinned by the last minor collection and in total. */
+static guint64 stat_minor_pinned_bytes_last = 0;
+static guint64 stat_minor_pinned_bytes = 0;
 
 static guint64 time_minor_pre_collection_fragment_clear = 0;
 static guint64 time_minor_pinning = 0;
@@ -306,6 +309,8 @@ static guint64 timestamp_last_start = 0;
 
 static int sgen_max_pause_time = SGEN_DEFAULT_MAX_PAUSE_TIME;
 static float sgen_max_pause_margin = SGEN_DEFAULT_MAX_PAUSE_MARGIN;
+/* Set by `mode=pause`: collections should stay within sgen_max_pause_time */
+static gboolean pause_budget_mode = FALSE;
 
 static SGEN_TV_DECLARE (time_major_conc_collection_start);
 static SGEN_TV_DECLARE (time_major_conc_collection_end);
@@ -595,6 +600,7 @@ pin_objects_from_nursery_pin_queue (gboolean do_scan_objects, ScanCopyContext ct
 	void *end_nursery = section->end_data;
 	void *last = NULL;
 	int count = 0;
+	size_t pinned_bytes = 0;
 	void *search_start;
 	void *addr;
 	void *pinning_front = start_nursery;
@@ -728,6 +734,7 @@ pin_objects_from_nursery_pin_queue (gboolean do_scan_objects, ScanCopyContext ct
 			GRAY_OBJECT_ENQUEUE_SERIAL (queue, obj_to_pin, desc);
 			sgen_pin_stats_register_object (obj_to_pin, GENERATION_NURSERY);
 			definitely_pinned [count] = obj_to_pin;
+			pinned_bytes += obj_to_pin_size;
 			count++;
 		}
 		if (sgen_concurrent_collection_in_progress)
@@ -739,6 +746,11 @@ pin_objects_from_nursery_pin_queue (gboolean do_scan_objects, ScanCopyContext ct
 	}
 	sgen_client_nursery_objects_pinned (definitely_pinned, count);
 	stat_pinned_objects += count;
+	if (!do_scan_objects && sgen_current_collection_generation == GENERATION_NURSERY) {
+		SGEN_LOG (2, "Minor collection pinned %d objects, %" G_GSIZE_FORMAT "u bytes", count, pinned_bytes);
+		stat_minor_pinned_bytes_last = pinned_bytes;
+		stat_minor_pinned_bytes += pinned_bytes;
+	}
 	return count;
 }
 
@@ -1327,6 +1339,8 @@ init_stats (void)
 	mono_counters_register ("Major fragment creation", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_TIME, &time_major_fragment_creation);
 
 	mono_counters_register ("Number of pinned objects", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_pinned_objects);
+	mono_counters_register ("Minor pinned bytes", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_BYTES, &stat_minor_pinned_bytes);
+	mono_counters_register ("Minor pinned bytes (last)", MONO_COUNTER_GC | MONO_COUNTER_ULONG | MONO_COUNTER_BYTES | MONO_COUNTER_VARIABLE, &stat_minor_pinned_bytes_last);
 
 #ifdef HEAVY_STATISTICS
 	mono_counters_register ("WBarrier remember pointer", MONO_COUNTER_GC | MONO_COUNTER_ULONG, &stat_wbarrier_add_to_global_remset);
@@ -2709,6 +2723,10 @@ sgen_perform_collection_inner (size_t requested_size, int generation_to_collect,
 
 	time_max = MAX (time_max, time_last);
 
+	/* time_last is in 100ns ticks, the pause budget in milliseconds */
+	if (pause_budget_mode && time_last > (guint64)sgen_max_pause_time * 10000)
+		sgen_binary_protocol_pause_budget_overrun (oldest_generation_collected, (long long)(time_last / 10), (long long)sgen_max_pause_time * 1000);
+
 	if (stw)
 		sgen_restart_world (oldest_generation_collected, forced_serial || !sgen_major_collector.is_concurrent);
 }
@@ -3423,6 +3441,8 @@ init_sgen_mode (SgenMode mode)
 		major = SGEN_MAJOR_CONCURRENT;
 		dynamic_nursery = TRUE;
 		sgen_max_pause_margin = SGEN_PAUSE_MODE_MAX_PAUSE_MARGIN;
+		pause_budget_mode = TRUE;
+		sgen_memgov_set_pause_budget_mode (TRUE);
 		break;
 	default:
 		g_assert_not_reached ();
@@ -20,6 +20,8 @@ static unsigned long histogram [NUM_HISTOGRAM_ENTRIES];
 static unsigned long count_bitmap_overflow;
 static unsigned long count_ref_array;
 static unsigned long count_vtype_array;
+static unsigned long count_drained_objects;
+static gint64 drain_time;
 
 void
 sgen_object_layout_scanned_bitmap (unsigned int bitmap)
@@ -46,6 +48,13 @@ sgen_object_layout_scanned_vtype_array (void)
 	++count_vtype_array;
 }
 
+void
+sgen_object_layout_drained (unsigned long num_objects, gint64 elapsed)
+{
+	count_drained_objects += num_objects;
+	drain_time += elapsed;
+}
+
 void
 sgen_object_layout_dump (FILE *out)
 {
@@ -59,6 +68,11 @@ sgen_object_layout_dump (FILE *out)
 	fprintf (out, "bitmap-overflow %lu\n", count_bitmap_overflow);
 	fprintf (out, "ref-array %lu\n", count_ref_array);
 	fprintf (out, "vtype-array %lu\n", count_vtype_array);
+	/* drain_time is in 100ns ticks */
+	fprintf (out, "drained-objects %lu\n", count_drained_objects);
+	fprintf (out, "drain-time-ms %.3f\n", drain_time / 10000.0);
+	if (drain_time)
+		fprintf (out, "objects-per-ms %.1f\n", count_drained_objects / (drain_time / 10000.0));
 }
 #else
 
@@ -15,6 +15,7 @@ void sgen_object_layout_scanned_bitmap (unsigned int bitmap);
 void sgen_object_layout_scanned_bitmap_overflow (void);
 void sgen_object_layout_scanned_ref_array (void);
 void sgen_object_layout_scanned_vtype_array (void);
+void sgen_object_layout_drained (unsigned long num_objects, gint64 elapsed);
 
 void sgen_object_layout_dump (FILE *out);
 
@@ -33,12 +34,18 @@ void sgen_object_layout_dump (FILE *out);
 			sgen_object_layout_scanned_bitmap (__object_layout_bitmap); \
 	} while (0)
 
+/* Marking rate of the major collector's gray stack drains */
+#define SGEN_OBJECT_LAYOUT_STATISTICS_DECLARE_DRAIN	gint64 __drain_start = sgen_timestamp (); unsigned long __drain_num_objects = 0
+#define SGEN_OBJECT_LAYOUT_STATISTICS_COUNT_DRAINED	(++__drain_num_objects)
+#define SGEN_OBJECT_LAYOUT_STATISTICS_COMMIT_DRAIN	sgen_object_layout_drained (__drain_num_objects, sgen_timestamp () - __drain_start)
+
 #else
 
 #define sgen_object_layout_scanned_bitmap(bitmap)
 #define sgen_object_layout_scanned_bitmap_overflow()
 #define sgen_object_layout_scanned_ref_array()
 #define sgen_object_layout_scanned_vtype_array()
+#define sgen_object_layout_drained(num_objects,elapsed)
 
 #define sgen_object_layout_dump(out)
 
@@ -46,6 +53,10 @@ void sgen_object_layout_dump (FILE *out);
 #define SGEN_OBJECT_LAYOUT_STATISTICS_MARK_BITMAP(o,p)
 #define SGEN_OBJECT_LAYOUT_STATISTICS_COMMIT_BITMAP
 
+#define SGEN_OBJECT_LAYOUT_STATISTICS_DECLARE_DRAIN
+#define SGEN_OBJECT_LAYOUT_STATISTICS_COUNT_DRAINED
+#define SGEN_OBJECT_LAYOUT_STATISTICS_COMMIT_DRAIN
+
 #endif
 
 #endif
@@ -24,6 +24,9 @@
 #ifdef HAVE_SGEN_GC
 
 #include <string.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 
 #include "mono/sgen/sgen-gc.h"
 #include "mono/sgen/sgen-protocol.h"
@@ -33,7 +36,15 @@
 #include "mono/sgen/sgen-array-list.h"
 #include "mono/sgen/sgen-pinning.h"
 
+/*
+ * Define SGEN_LOS_HUGE_PAGE_SECTIONS to use 2MB sections.  Sections are aligned to
+ * their size, so each one can then be backed by a single transparent huge page.
+ */
+#ifdef SGEN_LOS_HUGE_PAGE_SECTIONS
+#define LOS_SECTION_SIZE	(2 * 1024 * 1024)
+#else
 #define LOS_SECTION_SIZE	(1024 * 1024)
+#endif
 
 /*
  * This shouldn't be much smaller or larger than MAX_SMALL_OBJ_SIZE.
@@ -52,6 +63,23 @@
 
 #define LOS_NUM_FAST_SIZES		32
 
+/* Number of completely free sections a sweep keeps instead of returning them to the OS. */
+#define LOS_NUM_KEPT_EMPTY_SECTIONS	2
+
+/*
+ * Objects too large for a section get their own OS allocation.  Its size is rounded up
+ * to LOS_HUGE_SIZE_GRANULE, and blocks freed by a sweep are cached until the next sweep
+ * so that an allocation of the same size class can reuse them without a syscall.
+ */
+#define LOS_HUGE_SIZE_GRANULE		(64 * 1024)
+#define LOS_HUGE_CACHE_NUM_BLOCKS	16
+#define LOS_HUGE_CACHE_MAX_SIZE		(32 * 1024 * 1024)
+
+typedef struct {
+	gpointer addr;
+	size_t size;
+} LOSHugeBlock;
+
 typedef struct _LOSFreeChunks LOSFreeChunks;
 struct _LOSFreeChunks {
 	LOSFreeChunks *next_size;
@@ -130,6 +158,10 @@ static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larg
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
 
+static LOSHugeBlock los_huge_block_cache [LOS_HUGE_CACHE_NUM_BLOCKS];
+static int los_huge_block_cache_count = 0;
+static size_t los_huge_block_cache_size = 0;
+
 //#define USE_MALLOC
 //#define LOS_CONSISTENCY_CHECK
 //#define LOS_DUMMY
@@ -252,6 +284,63 @@ get_from_size_list (LOSFreeChunks **list, size_t size)
 	return free_chunks;
 }
 
+/*
+ * Size of the OS allocation backing an object too large for a section, given its
+ * page aligned size.
+ */
+static size_t
+los_huge_alloc_size (size_t page_aligned_size)
+{
+	return SGEN_ALIGN_UP_TO (page_aligned_size, LOS_HUGE_SIZE_GRANULE);
+}
+
+/*
+ * Take a cached block of exactly `size` bytes, clearing the first `clear_size` bytes.
+ * Returns NULL if there is none.
+ */
+static gpointer
+los_huge_block_cache_take (size_t size, size_t clear_size)
+{
+	int i;
+
+	for (i = 0; i < los_huge_block_cache_count; ++i) {
+		if (los_huge_block_cache [i].size == size) {
+			gpointer addr = los_huge_block_cache [i].addr;
+			los_huge_block_cache [i] = los_huge_block_cache [--los_huge_block_cache_count];
+			los_huge_block_cache_size -= size;
+			memset (addr, 0, clear_size);
+			return addr;
+		}
+	}
+	return NULL;
+}
+
+static gboolean
+los_huge_block_cache_put (gpointer addr, size_t size)
+{
+	if (los_huge_block_cache_count == LOS_HUGE_CACHE_NUM_BLOCKS || los_huge_block_cache_size + size > LOS_HUGE_CACHE_MAX_SIZE)
+		return FALSE;
+
+	los_huge_block_cache [los_huge_block_cache_count].addr = addr;
+	los_huge_block_cache [los_huge_block_cache_count].size = size;
+	++los_huge_block_cache_count;
+	los_huge_block_cache_size += size;
+	return TRUE;
+}
+
+static void
+los_huge_block_cache_release (void)
+{
+	int i;
+
+	for (i = 0; i < los_huge_block_cache_count; ++i) {
+		sgen_free_os_memory (los_huge_block_cache [i].addr, los_huge_block_cache [i].size, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+		sgen_los_memory_usage_total -= los_huge_block_cache [i].size;
+	}
+	los_huge_block_cache_count = 0;
+	los_huge_block_cache_size = 0;
+}
+
 static LOSObject*
 randomize_los_object_start (gpointer addr, size_t obj_size, size_t alloced_size, size_t addr_alignment)
 {
@@ -319,6 +408,10 @@ get_los_section_memory (size_t size)
 	if (!section)
 		return NULL;
 
+#if defined(SGEN_LOS_HUGE_PAGE_SECTIONS) && defined(MADV_HUGEPAGE)
+	madvise (section, LOS_SECTION_SIZE, MADV_HUGEPAGE);
+#endif
+
 	free_chunks = (LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE);
 	free_chunks->size = LOS_SECTION_SIZE - LOS_CHUNK_SIZE;
 	free_chunks->next_size = los_fast_free_lists [0];
@@ -395,10 +488,13 @@ sgen_los_free_object (LOSObject *obj)
 #else
 	if (size > LOS_SECTION_OBJECT_LIMIT) {
 		int pagesize = mono_pagesize ();
+		gpointer block = (gpointer)SGEN_ALIGN_DOWN_TO ((mword)obj, pagesize);
 		size += sizeof (LOSObject);
-		size = SGEN_ALIGN_UP_TO (size, pagesize);
-		sgen_free_os_memory ((gpointer)SGEN_ALIGN_DOWN_TO ((mword)obj, pagesize), size, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
-		sgen_los_memory_usage_total -= size;
+		size = los_huge_alloc_size (SGEN_ALIGN_UP_TO (size, pagesize));
+		if (!los_huge_block_cache_put (block, size)) {
+			sgen_free_os_memory (block, size, SGEN_ALLOC_HEAP, MONO_MEM_ACCOUNT_SGEN_LOS);
+			sgen_los_memory_usage_total -= size;
+		}
 		sgen_memgov_release_space (size, SPACE_LOS);
 	} else {
 		free_los_section_memory (obj, size + sizeof (LOSObject));
@@ -453,13 +549,18 @@ sgen_los_alloc_large_inner (GCVTable vtable, size_t size)
 	if (size > LOS_SECTION_OBJECT_LIMIT) {
 		size_t obj_size = size + sizeof (LOSObject);
 		int pagesize = mono_pagesize ();
-		size_t alloc_size = SGEN_ALIGN_UP_TO (obj_size, pagesize);
+		size_t page_aligned_size = SGEN_ALIGN_UP_TO (obj_size, pagesize);
+		size_t alloc_size = los_huge_alloc_size (page_aligned_size);
 		if (sgen_memgov_try_alloc_space (alloc_size, SPACE_LOS)) {
-			obj = (LOSObject *)sgen_alloc_os_memory (alloc_size, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
-			if (obj) {
-				sgen_los_memory_usage_total += alloc_size;
-				obj = randomize_los_object_start (obj, obj_size, alloc_size, pagesize);
+			obj = (LOSObject *)los_huge_block_cache_take (alloc_size, page_aligned_size);
+			if (!obj) {
+				obj = (LOSObject *)sgen_alloc_os_memory (alloc_size, (SgenAllocFlags)(SGEN_ALLOC_HEAP | SGEN_ALLOC_ACTIVATE), NULL, MONO_MEM_ACCOUNT_SGEN_LOS);
+				if (obj)
+					sgen_los_memory_usage_total += alloc_size;
 			}
+			/* Only randomize within the first page so the block start can be recovered on free. */
+			if (obj)
+				obj = randomize_los_object_start (obj, obj_size, page_aligned_size, pagesize);
 		}
 	} else {
 		obj = get_los_section_memory (size + sizeof (LOSObject));
@@ -503,6 +604,10 @@ sgen_los_sweep (void)
 	LOSSection *section, *prev;
 	int i;
 	int num_sections = 0;
+	int num_empty_sections = 0;
+
+	/* Blocks cached by the previous sweep that weren't reused since go back to the OS. */
+	los_huge_block_cache_release ();
 
 	/* sweep the big objects list */
 	FOREACH_LOS_OBJECT_NO_LOCK (obj) {
@@ -537,7 +642,8 @@ sgen_los_sweep (void)
 	prev = NULL;
 	section = los_sections;
 	while (section) {
-		if (section->num_free_chunks == LOS_SECTION_NUM_CHUNKS) {
+		/* The first LOS_NUM_KEPT_EMPTY_SECTIONS empty sections are kept for the next allocations. */
+		if (section->num_free_chunks == LOS_SECTION_NUM_CHUNKS && num_empty_sections++ >= LOS_NUM_KEPT_EMPTY_SECTIONS) {
 			LOSSection *next = section->next;
 			if (prev)
 				prev->next = next;
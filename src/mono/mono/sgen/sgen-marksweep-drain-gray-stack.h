@@ -322,9 +322,21 @@ SCAN_PTR_FIELD_FUNCTION_NAME (GCObject *full_object, GCObject **ptr, SgenGrayQue
 }
 #endif
 
+/*
+ * Objects are dequeued a few entries before they are scanned and prefetched when they
+ * are dequeued, so the cache miss on an object's header overlaps with the scanning of
+ * the objects ahead of it.
+ */
 static gboolean
 DRAIN_GRAY_STACK_FUNCTION_NAME (SgenGrayQueue *queue)
 {
+	GCObject *prefetch_obj [SGEN_GRAY_PREFETCH_FIFO_SIZE];
+	SgenDescriptor prefetch_desc [SGEN_GRAY_PREFETCH_FIFO_SIZE];
+	int prefetch_head = 0;
+	int prefetch_count = 0;
+	gboolean done = FALSE;
+	SGEN_OBJECT_LAYOUT_STATISTICS_DECLARE_DRAIN;
+
 #if defined(COPY_OR_MARK_CONCURRENT) || defined(COPY_OR_MARK_CONCURRENT_WITH_EVACUATION) || defined(COPY_OR_MARK_PARALLEL)
 	int i;
 	for (i = 0; i < 32; i++) {
@@ -336,17 +348,47 @@ DRAIN_GRAY_STACK_FUNCTION_NAME (SgenGrayQueue *queue)
 
 		HEAVY_STAT (++stat_drain_loops);
 
+		while (prefetch_count < SGEN_GRAY_PREFETCH_FIFO_SIZE) {
+			int tail;
 #if defined(COPY_OR_MARK_PARALLEL)
-		GRAY_OBJECT_DEQUEUE_PARALLEL (queue, &obj, &desc);
+			GRAY_OBJECT_DEQUEUE_PARALLEL (queue, &obj, &desc);
 #else
-		GRAY_OBJECT_DEQUEUE_SERIAL (queue, &obj, &desc);
+			GRAY_OBJECT_DEQUEUE_SERIAL (queue, &obj, &desc);
 #endif
-		if (!obj)
-			return TRUE;
+			if (!obj)
+				break;
+
+			PREFETCH_READ (obj);
+			tail = (prefetch_head + prefetch_count) & (SGEN_GRAY_PREFETCH_FIFO_SIZE - 1);
+			prefetch_obj [tail] = obj;
+			prefetch_desc [tail] = desc;
+			++prefetch_count;
+		}
+
+		if (!prefetch_count) {
+			done = TRUE;
+			break;
+		}
+
+		obj = prefetch_obj [prefetch_head];
+		desc = prefetch_desc [prefetch_head];
+		prefetch_head = (prefetch_head + 1) & (SGEN_GRAY_PREFETCH_FIFO_SIZE - 1);
+		--prefetch_count;
 
 		SCAN_OBJECT_FUNCTION_NAME (obj, desc, queue);
+		SGEN_OBJECT_LAYOUT_STATISTICS_COUNT_DRAINED;
 	}
-	return FALSE;
+
+	/* A bounded drain must not return with objects it has already dequeued. */
+	while (prefetch_count) {
+		SCAN_OBJECT_FUNCTION_NAME (prefetch_obj [prefetch_head], prefetch_desc [prefetch_head], queue);
+		SGEN_OBJECT_LAYOUT_STATISTICS_COUNT_DRAINED;
+		prefetch_head = (prefetch_head + 1) & (SGEN_GRAY_PREFETCH_FIFO_SIZE - 1);
+		--prefetch_count;
+	}
+
+	SGEN_OBJECT_LAYOUT_STATISTICS_COMMIT_DRAIN;
+	return done;
 }
 
 #undef COPY_OR_MARK_PARALLEL
@@ -62,6 +62,9 @@ static gboolean debug_print_allowance = FALSE;
 
 /* use this to tune when to do a major/minor collection */
 static mword major_collection_trigger_size;
+static mword major_collection_allowance;
+
+static gboolean pause_budget_mode = FALSE;
 
 static mword major_pre_sweep_heap_size;
 static mword major_start_heap_size;
@@ -120,6 +123,7 @@ sgen_memgov_calculate_minor_collection_allowance (void)
 		sgen_major_collector.free_swept_blocks (GDOUBLE_TO_SIZE (sgen_major_collector.get_num_major_sections () * SGEN_DEFAULT_ALLOWANCE_HEAP_SIZE_RATIO));
 
 	major_collection_trigger_size = new_heap_size + allowance;
+	major_collection_allowance = allowance;
 
 	need_calculate_minor_collection_allowance = FALSE;
 
@@ -193,8 +197,16 @@ sgen_need_major_collection (mword space_needed, gboolean *forced)
 		 * If the heap grows so much that we would need to have a negative allowance,
 		 * we force the finishing of the collection, to avoid increased memory usage.
 		 */
-		if ((heap_size - major_start_heap_size) > major_start_heap_size * SGEN_DEFAULT_ALLOWANCE_HEAP_SIZE_RATIO)
+		if ((heap_size - major_start_heap_size) > major_start_heap_size * SGEN_DEFAULT_ALLOWANCE_HEAP_SIZE_RATIO) {
+			/*
+			 * In pause mode, give the workers some more time to finish marking in the
+			 * background, so the finishing pause doesn't have to complete it.
+			 */
+			if (pause_budget_mode && !sgen_workers_all_done () && heap_size <= soft_heap_limit &&
+					(heap_size - major_start_heap_size) <= major_start_heap_size * SGEN_DEFAULT_ALLOWANCE_HEAP_SIZE_RATIO * (1 + SGEN_PAUSE_MODE_CONCURRENT_FINISH_SLACK_RATIO))
+				return FALSE;
 			return TRUE;
+		}
 		return FALSE;
 	}
 
@@ -212,6 +224,11 @@ sgen_need_major_collection (mword space_needed, gboolean *forced)
 	heap_size = get_heap_size ();
 
 	*forced = heap_size > soft_heap_limit;
+
+	/* In pause mode, start concurrent collections early, see SGEN_PAUSE_MODE_CONCURRENT_START_RATIO. */
+	if (pause_budget_mode && sgen_major_collector.is_concurrent)
+		return heap_size > major_collection_trigger_size - GDOUBLE_TO_SIZE (major_collection_allowance * (1 - SGEN_PAUSE_MODE_CONCURRENT_START_RATIO));
+
 	return heap_size > major_collection_trigger_size;
 }
 
@@ -527,6 +544,12 @@ sgen_memgov_try_alloc_space (mword size, int space)
 	return TRUE;
 }
 
+void
+sgen_memgov_set_pause_budget_mode (gboolean enabled)
+{
+	pause_budget_mode = enabled;
+}
+
 void
 sgen_memgov_init (size_t max_heap, size_t soft_limit, gboolean debug_allowance, double allowance_ratio, double save_target)
 {
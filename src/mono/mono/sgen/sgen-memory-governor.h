@@ -12,6 +12,7 @@
 void sgen_memgov_init (size_t max_heap, size_t soft_limit, gboolean debug_allowance, double min_allowance_ratio, double save_target);
 void sgen_memgov_release_space (mword size, int space);
 gboolean sgen_memgov_try_alloc_space (mword size, int space);
+void sgen_memgov_set_pause_budget_mode (gboolean enabled);
 
 /* GC trigger heuristics */
 void sgen_memgov_minor_collection_start (void);
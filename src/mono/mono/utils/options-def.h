@@ -59,6 +59,7 @@ DEFINE_BOOL_READONLY(readonly_flag, "readonly-flag", FALSE, "Example")
 
 DEFINE_BOOL(wasm_exceptions, "wasm-exceptions", FALSE, "Enable codegen for WASM exceptions")
 DEFINE_BOOL(aot_lazy_assembly_load, "aot-lazy-assembly-load", FALSE, "Load assemblies referenced by AOT images lazily")
+DEFINE_BOOL(jit_llvm_tiering, "jit-llvm-tiering", FALSE, "Compile methods with the JIT first and recompile hot ones with LLVM in the background (requires ENABLE_EXPERIMENT_TIERED)")
 
 #if HOST_BROWSER
 DEFINE_BOOL(interp_pgo_recording, "interp-pgo-recording", FALSE, "Record interpreter tiering information for automatic PGO")
@@ -67,6 +68,7 @@ DEFINE_BOOL(interp_pgo_recording, "interp-pgo-recording", FALSE, "Record interpr
 DEFINE_BOOL(wasm_gc_safepoints, "wasm-gc-safepoints", FALSE, "Use GC safepoints on WASM")
 #endif
 DEFINE_BOOL(interp_pgo_logging, "interp-pgo-logging", FALSE, "Log messages when interpreter PGO optimizes a method or updates its table")
+DEFINE_STRING(interp_pgo_file, "interp-pgo-file", NULL, "Load the interpreter PGO profile from this file at startup, record it and save it back at shutdown")
 DEFINE_BOOL(interp_codegen_timing, "interp-codegen-timing", FALSE, "Measure time spent generating interpreter code and log it periodically")
 
 #if HOST_BROWSER
@@ -172,6 +174,8 @@ DEFINE_INT(jiterpreter_table_size, "jiterpreter-table-size", 6 * 1024, "Size of
 DEFINE_INT(jiterpreter_aot_table_size, "jiterpreter-aot-table-size", 3 * 1024, "Size of the jiterpreter AOT trampoline function tables")
 DEFINE_INT(jiterpreter_max_module_size, "jiterpreter-max-module-size", 16384, "Size limit for jiterpreter generated WASM modules")
 DEFINE_INT(jiterpreter_max_switch_size, "jiterpreter-max-switch-size", 128, "Jump table size limit for jiterpreter switch opcodes (0 to disable)")
+// Calls end traces (or turn into trace exits), so inlining small callees into their callers keeps more code inside traces
+DEFINE_INT(jiterpreter_inline_length_limit, "jiterpreter-inline-length-limit", 60, "Inline callees with less than this many bytes of IL into their callers when traces are enabled")
 #endif // HOST_BROWSER
 
 #if defined(TARGET_WASM) || defined(TARGET_IOS)  || defined(TARGET_TVOS) || defined (TARGET_MACCAT)
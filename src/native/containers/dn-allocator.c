@@ -78,6 +78,43 @@ fixed_or_malloc_free (
 	dn_allocator_fixed_or_malloc_data_t *data,
 	void *block);
 
+static void *
+arena_vtable_alloc (
+	dn_allocator_t *allocator,
+	size_t size);
+
+static void *
+arena_vtable_realloc (
+	dn_allocator_t *allocator,
+	void *block,
+	size_t size);
+
+static void
+arena_vtable_free (
+	dn_allocator_t *allocator,
+	void *block);
+
+static void *
+arena_alloc (
+	dn_allocator_arena_data_t *data,
+	size_t size);
+
+static void *
+arena_realloc (
+	dn_allocator_arena_data_t *data,
+	void *block,
+	size_t size);
+
+static bool
+arena_add_chunk (
+	dn_allocator_arena_data_t *data,
+	size_t size);
+
+static void
+arena_free_chunks (dn_allocator_arena_chunk_t *chunk);
+
+#define ARENA_CHUNK_HEADER_SIZE DN_ALLOCATOR_ALIGN_SIZE (sizeof (dn_allocator_arena_chunk_t), DN_ALLOCATOR_MEM_ALIGN8)
+
 static dn_allocator_vtable_t fixed_vtable = {
 	fixed_vtable_alloc,
 	fixed_vtable_realloc,
@@ -90,6 +127,12 @@ static dn_allocator_vtable_t fixed_or_malloc_vtable = {
 	fixed_or_malloc_vtable_free,
 };
 
+static dn_allocator_vtable_t arena_vtable = {
+	arena_vtable_alloc,
+	arena_vtable_realloc,
+	arena_vtable_free,
+};
+
 static void *
 fixed_vtable_alloc (
 	dn_allocator_t *allocator,
@@ -267,6 +310,105 @@ fixed_or_malloc_free (
 		free (block);
 }
 
+static void *
+arena_vtable_alloc (
+	dn_allocator_t *allocator,
+	size_t size)
+{
+	return arena_alloc (&((dn_allocator_arena_t *)allocator)->_data, size);
+}
+
+static void *
+arena_vtable_realloc (
+	dn_allocator_t *allocator,
+	void *block,
+	size_t size)
+{
+	return arena_realloc (&((dn_allocator_arena_t *)allocator)->_data, block, size);
+}
+
+static void
+arena_vtable_free (
+	dn_allocator_t *allocator,
+	void *block)
+{
+	DN_UNREFERENCED_PARAMETER (allocator);
+	DN_UNREFERENCED_PARAMETER (block);
+
+	// Arena memory is only released by reset or dispose.
+}
+
+static void *
+arena_alloc (
+	dn_allocator_arena_data_t *data,
+	size_t size)
+{
+	void *result = data->_chunks ? fixed_alloc (&data->_current, size) : NULL;
+	if (!result && arena_add_chunk (data, size))
+		result = fixed_alloc (&data->_current, size);
+
+	return result;
+}
+
+static void *
+arena_realloc (
+	dn_allocator_arena_data_t *data,
+	void *block,
+	size_t size)
+{
+	// Blocks can't grow in place, but the current chunk may still have room for a copy.
+	void *result = NULL;
+	if (data->_chunks && (!block || fixed_owns_ptr (&data->_current, block)))
+		result = fixed_realloc (&data->_current, block, size);
+
+	if (!result) {
+		result = arena_alloc (data, size);
+		if (block && result)
+			result = fixed_memcpy (result, block, size);
+	}
+
+	return result;
+}
+
+static bool
+arena_add_chunk (
+	dn_allocator_arena_data_t *data,
+	size_t size)
+{
+	// fixed_alloc needs room for the size header and requires the bump pointer to stay
+	// below the end of the chunk, so reserve one extra alignment unit.
+	size_t min_size = DN_ALLOCATOR_ALIGN_SIZE (size + DN_ALLOCATOR_MEM_ALIGN8, DN_ALLOCATOR_MEM_ALIGN8) + DN_ALLOCATOR_MEM_ALIGN8;
+	if (min_size < size)
+		return false;
+
+	size_t chunk_size = data->_chunk_size > min_size ? data->_chunk_size : min_size;
+	if (chunk_size + ARENA_CHUNK_HEADER_SIZE < chunk_size)
+		return false;
+
+	dn_allocator_arena_chunk_t *chunk = (dn_allocator_arena_chunk_t *)malloc (chunk_size + ARENA_CHUNK_HEADER_SIZE);
+	if (!chunk)
+		return false;
+
+	chunk->next = data->_chunks;
+	data->_chunks = chunk;
+
+	data->_current._begin = (uint8_t *)chunk + ARENA_CHUNK_HEADER_SIZE;
+	data->_current._ptr = data->_current._begin;
+	data->_current._end = (uint8_t *)data->_current._begin + chunk_size;
+
+	return true;
+}
+
+static void
+arena_free_chunks (dn_allocator_arena_chunk_t *chunk)
+{
+	while (chunk) {
+		dn_allocator_arena_chunk_t *next = chunk->next;
+		free (chunk);
+		chunk = next;
+	}
+}
+
 dn_allocator_fixed_t *
 dn_allocator_fixed_init (
 	dn_allocator_fixed_t *allocator,
@@ -322,3 +464,37 @@ dn_allocator_fixed_or_malloc_init (
 
 	return allocator;
 }
+
+dn_allocator_arena_t *
+dn_allocator_arena_init (
+	dn_allocator_arena_t *allocator,
+	size_t chunk_size)
+{
+	// Chunks are allocated on first use.
+	memset (&allocator->_data, 0, sizeof (allocator->_data));
+	allocator->_data._chunk_size = chunk_size;
+
+	allocator->_vtable = &arena_vtable;
+
+	return allocator;
+}
+
+dn_allocator_arena_t *
+dn_allocator_arena_reset (dn_allocator_arena_t *allocator)
+{
+	dn_allocator_arena_chunk_t *chunk = allocator->_data._chunks;
+	if (chunk) {
+		arena_free_chunks (chunk->next);
+		chunk->next = NULL;
+		allocator->_data._current._ptr = allocator->_data._current._begin;
+	}
+
+	return allocator;
+}
+
+void
+dn_allocator_arena_dispose (dn_allocator_arena_t *allocator)
+{
+	arena_free_chunks (allocator->_data._chunks);
+	memset (&allocator->_data, 0, sizeof (allocator->_data));
+}
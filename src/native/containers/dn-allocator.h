@@ -24,6 +24,9 @@ typedef struct _dn_allocator_fixed_t dn_allocator_fixed_t;
 typedef struct _dn_allocator_fixed_data_t dn_allocator_fixed_data_t;
 typedef struct _dn_allocator_fixed_or_malloc_t dn_allocator_fixed_or_malloc_t;
 typedef struct _dn_allocator_fixed_data_t dn_allocator_fixed_or_malloc_data_t;
+typedef struct _dn_allocator_arena_t dn_allocator_arena_t;
+typedef struct _dn_allocator_arena_data_t dn_allocator_arena_data_t;
+typedef struct _dn_allocator_arena_chunk_t dn_allocator_arena_chunk_t;
 
 struct _dn_allocator_vtable_t {
 	void *(*_alloc)(dn_allocator_t *, size_t);
@@ -51,6 +54,24 @@ struct _dn_allocator_fixed_or_malloc_t {
 	dn_allocator_fixed_or_malloc_data_t _data;
 };
 
+struct _dn_allocator_arena_chunk_t {
+	dn_allocator_arena_chunk_t *next;
+};
+
+// Bump allocator over a list of heap chunks. Individual frees are no-ops,
+// all memory is released at once by reset/dispose.
+struct _dn_allocator_arena_data_t {
+	// Bump range of the most recently allocated chunk.
+	dn_allocator_fixed_data_t _current;
+	dn_allocator_arena_chunk_t *_chunks;
+	size_t _chunk_size;
+};
+
+struct _dn_allocator_arena_t {
+	dn_allocator_vtable_t *_vtable;
+	dn_allocator_arena_data_t _data;
+};
+
 static inline void *
 dn_allocator_alloc (
 	dn_allocator_t *allocator,
@@ -100,6 +121,18 @@ dn_allocator_fixed_or_malloc_init (
 dn_allocator_fixed_or_malloc_t *
 dn_allocator_fixed_or_malloc_reset (dn_allocator_fixed_or_malloc_t *allocator);
 
+dn_allocator_arena_t *
+dn_allocator_arena_init (
+	dn_allocator_arena_t *allocator,
+	size_t chunk_size);
+
+// Releases all allocations, keeping the most recent chunk for reuse.
+dn_allocator_arena_t *
+dn_allocator_arena_reset (dn_allocator_arena_t *allocator);
+
+void
+dn_allocator_arena_dispose (dn_allocator_arena_t *allocator);
+
 #define DN_ALLOCATOR_FIXED_OR_MALLOC(var_name, buffer_size) \
 	uint8_t __buffer_##var_name [buffer_size]; \
 	dn_allocator_fixed_or_malloc_t var_name; \
@@ -15,7 +15,10 @@
 
 #if defined(__clang__) || defined (__GNUC__) // use vector intrinsics
 
-#if defined(__wasm_simd128__)
+#if DN_SIMDHASH_VECTOR_WIDTH > 16
+// Wide buckets are only selected in dn-simdhash.h when AVX2 or AVX-512BW is available
+#include <immintrin.h>
+#elif defined(__wasm_simd128__)
 #include <wasm_simd128.h>
 #elif DN_SIMDHASH_USE_SSE2
 #include <emmintrin.h>
@@ -40,7 +43,11 @@
 typedef uint8_t dn_u8x16 __attribute__ ((vector_size (DN_SIMDHASH_VECTOR_WIDTH), aligned(DN_SIMDHASH_VECTOR_WIDTH)));
 typedef union {
 	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) dn_u8x16 vec;
-#if DN_SIMDHASH_USE_SSE2
+#if DN_SIMDHASH_VECTOR_WIDTH == 64
+	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) __m512i m512;
+#elif DN_SIMDHASH_VECTOR_WIDTH == 32
+	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) __m256i m256;
+#elif DN_SIMDHASH_USE_SSE2
 	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) __m128i m128;
 #endif
 	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) uint8_t values[DN_SIMDHASH_VECTOR_WIDTH];
@@ -97,6 +104,14 @@ build_search_vector (uint8_t needle)
 {
 #ifdef DN_SIMDHASH_USE_SCALAR_FALLBACK
 	return needle;
+#elif DN_SIMDHASH_VECTOR_WIDTH == 64
+	dn_simdhash_suffixes result;
+	result.m512 = _mm512_set1_epi8((char)needle);
+	return result;
+#elif DN_SIMDHASH_VECTOR_WIDTH == 32
+	dn_simdhash_suffixes result;
+	result.m256 = _mm256_set1_epi8((char)needle);
+	return result;
 #else
 	dn_simdhash_suffixes result;
 	// this produces a splat in wasm, and the other architectures are fine too
@@ -110,6 +125,7 @@ build_search_vector (uint8_t needle)
 }
 
 // returns an index in range 0-13 on match, 14-32 if no match
+// (for wide buckets: 0-29 on match and 30-32 if no match, or 0-61 and 62-64)
 static DN_FORCEINLINE(uint32_t)
 find_first_matching_suffix_simd (
 	dn_simdhash_search_vector needle,
@@ -119,6 +135,10 @@ find_first_matching_suffix_simd (
 #ifdef DN_SIMDHASH_USE_SCALAR_FALLBACK
     dn_simdhash_assert(!"Scalar fallback should be in use here");
     return 32;
+#elif DN_SIMDHASH_VECTOR_WIDTH == 64
+	return (uint32_t)ctzll(_mm512_cmpeq_epi8_mask(needle.m512, haystack.m512));
+#elif DN_SIMDHASH_VECTOR_WIDTH == 32
+	return ctz((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(needle.m256, haystack.m256)));
 #elif defined(__wasm_simd128__)
 	return ctz(wasm_i8x16_bitmask(wasm_i8x16_eq(needle.vec, haystack.vec)));
 #elif DN_SIMDHASH_USE_SSE2
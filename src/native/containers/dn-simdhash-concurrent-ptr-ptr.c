@@ -0,0 +1,353 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef NO_CONFIG_H
+#include <dn-config.h>
+#endif
+#include <string.h>
+#include <minipal/mutex.h>
+#include "dn-simdhash.h"
+
+#include "dn-simdhash-utils.h"
+#include "dn-simdhash-arch.h"
+#include "dn-simdhash-concurrent-ptr-ptr.h"
+
+// Values are stored inline next to their keys so that a whole table is one allocation
+//  that can be published with a single pointer store.
+// 128-byte buckets for 64-bit pointers, 64-byte buckets for 32-bit pointers
+#if SIZEOF_VOID_P == 4
+#define BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(6, 8)
+#else
+#define BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(7, 16)
+#endif
+
+#define SCAN_BUCKET_NO_OVERFLOW -1
+#define SCAN_BUCKET_OVERFLOWED -2
+
+typedef struct bucket_t {
+	_Alignas(DN_SIMDHASH_VECTOR_WIDTH) dn_simdhash_suffixes suffixes;
+	void *keys[BUCKET_CAPACITY];
+	void *values[BUCKET_CAPACITY];
+} bucket_t;
+
+static_assert((sizeof (bucket_t) % DN_SIMDHASH_VECTOR_WIDTH) == 0, "Bucket size is not vector aligned");
+
+typedef struct table_t {
+	// Always a power of two, so that lookups can mask instead of doing a modulo.
+	// Doubling on every resize also keeps the rehash cost amortized.
+	uint32_t buckets_length;
+	struct table_t *next_retired;
+	bucket_t *buckets;
+} table_t;
+
+struct dn_simdhash_concurrent_ptr_ptr_t {
+	// Published with release semantics and loaded with acquire semantics by lookups.
+	table_t *table;
+	// Everything below is only touched while holding lock.
+	uint32_t count, grow_at_count;
+	table_t *retired;
+	dn_allocator_t *allocator;
+	minipal_mutex lock;
+};
+
+// Lookups synchronize with inserts through the bucket count byte and with resizes
+//  through the table pointer, so those are the only accesses that need ordering.
+#if defined(__GNUC__) || defined(__clang__)
+#define load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define store_release(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#if defined(_M_ARM64)
+#define DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER() __dmb(_ARM64_BARRIER_ISH)
+#else
+// x86 and x64 don't reorder loads with loads or stores with stores, so preventing
+//  compiler reordering is enough.
+#define DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER() _ReadWriteBarrier()
+#endif
+#else
+#error "Missing atomics implementation for dn-simdhash-concurrent-ptr-ptr"
+#endif
+
+static DN_FORCEINLINE(uint8_t)
+load_acquire_u8 (uint8_t *ptr)
+{
+#ifdef DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER
+	uint8_t result = *(volatile uint8_t *)ptr;
+	DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER();
+	return result;
+#else
+	return load_acquire(ptr);
+#endif
+}
+
+static DN_FORCEINLINE(void)
+store_release_u8 (uint8_t *ptr, uint8_t value)
+{
+#ifdef DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER
+	DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER();
+	*(volatile uint8_t *)ptr = value;
+#else
+	store_release(ptr, value);
+#endif
+}
+
+static DN_FORCEINLINE(table_t *)
+load_acquire_table (table_t **ptr)
+{
+#ifdef DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER
+	table_t *result = *(table_t *volatile *)ptr;
+	DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER();
+	return result;
+#else
+	return load_acquire(ptr);
+#endif
+}
+
+static DN_FORCEINLINE(void)
+store_release_table (table_t **ptr, table_t *value)
+{
+#ifdef DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER
+	DN_SIMDHASH_ACQUIRE_RELEASE_BARRIER();
+	*(table_t *volatile *)ptr = value;
+#else
+	store_release(ptr, value);
+#endif
+}
+
+static table_t *
+table_new (dn_allocator_t *allocator, uint32_t buckets_length)
+{
+	dn_simdhash_assert(buckets_length && !(buckets_length & (buckets_length - 1)));
+	// pad the allocation by the width of one vector so we can align the buckets
+	size_t size = sizeof(table_t) + DN_SIMDHASH_VECTOR_WIDTH + ((size_t)buckets_length * sizeof(bucket_t));
+	table_t *result = (table_t *)dn_allocator_alloc(allocator, size);
+	dn_simdhash_assert(result);
+	memset(result, 0, size);
+	result->buckets_length = buckets_length;
+	uintptr_t buckets = (uintptr_t)(result + 1);
+	buckets = (buckets + DN_SIMDHASH_VECTOR_WIDTH - 1) & ~(uintptr_t)(DN_SIMDHASH_VECTOR_WIDTH - 1);
+	result->buckets = (bucket_t *)buckets;
+	return result;
+}
+
+static void
+table_free (dn_allocator_t *allocator, table_t *table)
+{
+	dn_allocator_free(allocator, (void *)table);
+}
+
+static DN_FORCEINLINE(int)
+scan_bucket (bucket_t *bucket, void *needle, uint8_t suffix, dn_simdhash_search_vector search_vector)
+{
+	// The count is published after the key, value and suffix of every slot below it,
+	//  so once it has been loaded those slots are safe to read. Slots at or above it
+	//  may be in the middle of being written by an insert and are never inspected.
+	uint8_t count = load_acquire_u8(&bucket->suffixes.values[DN_SIMDHASH_COUNT_SLOT]);
+#ifdef DN_SIMDHASH_USE_SCALAR_FALLBACK
+	(void)search_vector;
+	for (uint32_t index = 0; index < count; index++) {
+		if ((bucket->suffixes.values[index] == suffix) && (bucket->keys[index] == needle))
+			return (int)index;
+	}
+#else
+	(void)suffix;
+	// Lanes past count can change underneath us, but they are ignored below: each lane
+	//  is an independent byte, so a torn vector load cannot corrupt the ones we use.
+	dn_simdhash_suffixes bucket_suffixes = bucket->suffixes;
+	uint32_t index = find_first_matching_suffix_simd(search_vector, bucket_suffixes);
+	for (; index < count; index++) {
+		if (bucket->keys[index] == needle)
+			return (int)index;
+	}
+#endif
+
+	if (DN_UNLIKELY(load_acquire_u8(&bucket->suffixes.values[DN_SIMDHASH_CASCADED_SLOT])))
+		return SCAN_BUCKET_OVERFLOWED;
+	else
+		return SCAN_BUCKET_NO_OVERFLOW;
+}
+
+static DN_FORCEINLINE(bucket_t *)
+find_key (table_t *table, void *key, uint32_t key_hash, uint32_t *slot)
+{
+	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
+	dn_simdhash_search_vector search_vector = build_search_vector(suffix);
+	uint32_t mask = table->buckets_length - 1,
+		initial_index = key_hash & mask, bucket_index = initial_index;
+
+	do {
+		bucket_t *bucket = &table->buckets[bucket_index];
+		int index = scan_bucket(bucket, key, suffix, search_vector);
+		if (index >= 0) {
+			*slot = (uint32_t)index;
+			return bucket;
+		} else if (index == SCAN_BUCKET_NO_OVERFLOW) {
+			return NULL;
+		}
+		bucket_index = (bucket_index + 1) & mask;
+	} while (bucket_index != initial_index);
+
+	return NULL;
+}
+
+// Caller holds the lock (or owns a table that hasn't been published yet) and has
+//  checked that the key isn't already present.
+static void
+insert_new_key (table_t *table, void *key, uint32_t key_hash, void *value)
+{
+	uint8_t suffix = dn_simdhash_select_suffix(key_hash);
+	uint32_t mask = table->buckets_length - 1,
+		initial_index = key_hash & mask, bucket_index = initial_index;
+
+	do {
+		bucket_t *bucket = &table->buckets[bucket_index];
+		uint8_t count = dn_simdhash_bucket_count(bucket->suffixes);
+		if (count < BUCKET_CAPACITY) {
+			bucket->keys[count] = key;
+			bucket->values[count] = value;
+			dn_simdhash_bucket_set_suffix(bucket->suffixes, count, suffix);
+			// Makes the slot visible to lookups.
+			store_release_u8(&bucket->suffixes.values[DN_SIMDHASH_COUNT_SLOT], (uint8_t)(count + 1));
+			return;
+		}
+
+		// Lookups that race with this insert may stop at this bucket before they observe
+		//  the cascade, which is fine since the key doesn't have to be visible to them yet.
+		uint8_t cascaded_count = dn_simdhash_bucket_cascaded_count(bucket->suffixes);
+		if (cascaded_count < 255)
+			store_release_u8(&bucket->suffixes.values[DN_SIMDHASH_CASCADED_SLOT], (uint8_t)(cascaded_count + 1));
+
+		bucket_index = (bucket_index + 1) & mask;
+	} while (bucket_index != initial_index);
+
+	dn_simdhash_assert(!"Concurrent simdhash table is full");
+}
+
+static uint32_t
+compute_grow_at_count (uint32_t buckets_length)
+{
+	uint64_t result = (uint64_t)buckets_length * BUCKET_CAPACITY;
+	result *= 100;
+	result /= DN_SIMDHASH_SIZING_PERCENTAGE;
+	return (uint32_t)result;
+}
+
+// Called with the lock held. Builds a larger table from the current one, publishes it,
+//  then retires the old one because lookups that loaded it earlier may still be scanning it.
+static void
+grow (dn_simdhash_concurrent_ptr_ptr_t *hash)
+{
+	table_t *old_table = hash->table;
+	dn_simdhash_assert(old_table->buckets_length <= (UINT32_MAX / 2));
+	table_t *new_table = table_new(hash->allocator, old_table->buckets_length * 2);
+
+	for (uint32_t i = 0; i < old_table->buckets_length; i++) {
+		bucket_t *bucket = &old_table->buckets[i];
+		uint8_t count = dn_simdhash_bucket_count(bucket->suffixes);
+		for (uint32_t j = 0; j < count; j++)
+			insert_new_key(new_table, bucket->keys[j], MurmurHash3_32_ptr(bucket->keys[j], 0), bucket->values[j]);
+	}
+
+	store_release_table(&hash->table, new_table);
+	hash->grow_at_count = compute_grow_at_count(new_table->buckets_length);
+
+	old_table->next_retired = hash->retired;
+	hash->retired = old_table;
+}
+
+dn_simdhash_concurrent_ptr_ptr_t *
+dn_simdhash_concurrent_ptr_ptr_new (uint32_t capacity, dn_allocator_t *allocator)
+{
+	dn_simdhash_concurrent_ptr_ptr_t *result = (dn_simdhash_concurrent_ptr_ptr_t *)dn_allocator_alloc(allocator, sizeof(dn_simdhash_concurrent_ptr_ptr_t));
+	dn_simdhash_assert(result);
+	memset(result, 0, sizeof(dn_simdhash_concurrent_ptr_ptr_t));
+
+	uint64_t adjusted_capacity = capacity;
+	adjusted_capacity *= DN_SIMDHASH_SIZING_PERCENTAGE;
+	adjusted_capacity /= 100;
+	uint64_t buckets_length = (adjusted_capacity + BUCKET_CAPACITY - 1) / BUCKET_CAPACITY;
+	if (buckets_length < DN_SIMDHASH_MIN_BUCKET_COUNT)
+		buckets_length = DN_SIMDHASH_MIN_BUCKET_COUNT;
+	dn_simdhash_assert(buckets_length <= (UINT32_MAX / 2));
+
+	result->allocator = allocator;
+	result->table = table_new(allocator, next_power_of_two((uint32_t)buckets_length));
+	result->grow_at_count = compute_grow_at_count(result->table->buckets_length);
+
+	bool ok = minipal_mutex_init(&result->lock);
+	dn_simdhash_assert(ok);
+	(void)ok;
+
+	return result;
+}
+
+void
+dn_simdhash_concurrent_ptr_ptr_free (dn_simdhash_concurrent_ptr_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	dn_simdhash_concurrent_ptr_ptr_reclaim(hash);
+	table_free(hash->allocator, hash->table);
+	minipal_mutex_destroy(&hash->lock);
+	dn_allocator_t *allocator = hash->allocator;
+	memset(hash, 0, sizeof(dn_simdhash_concurrent_ptr_ptr_t));
+	dn_allocator_free(allocator, (void *)hash);
+}
+
+uint8_t
+dn_simdhash_concurrent_ptr_ptr_try_add (dn_simdhash_concurrent_ptr_ptr_t *hash, void *key, void *value)
+{
+	dn_simdhash_assert(hash);
+	uint32_t key_hash = MurmurHash3_32_ptr(key, 0), slot;
+	uint8_t added = 0;
+
+	minipal_mutex_enter(&hash->lock);
+	if (!find_key(hash->table, key, key_hash, &slot)) {
+		if (hash->count >= hash->grow_at_count)
+			grow(hash);
+		insert_new_key(hash->table, key, key_hash, value);
+		hash->count++;
+		added = 1;
+	}
+	minipal_mutex_leave(&hash->lock);
+
+	return added;
+}
+
+uint8_t
+dn_simdhash_concurrent_ptr_ptr_try_get_value (dn_simdhash_concurrent_ptr_ptr_t *hash, void *key, void **result)
+{
+	dn_simdhash_assert(hash);
+	uint32_t slot;
+	bucket_t *bucket = find_key(load_acquire_table(&hash->table), key, MurmurHash3_32_ptr(key, 0), &slot);
+	if (!bucket)
+		return 0;
+	if (result)
+		*result = bucket->values[slot];
+	return 1;
+}
+
+uint32_t
+dn_simdhash_concurrent_ptr_ptr_count (dn_simdhash_concurrent_ptr_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	minipal_mutex_enter(&hash->lock);
+	uint32_t result = hash->count;
+	minipal_mutex_leave(&hash->lock);
+	return result;
+}
+
+void
+dn_simdhash_concurrent_ptr_ptr_reclaim (dn_simdhash_concurrent_ptr_ptr_t *hash)
+{
+	dn_simdhash_assert(hash);
+	minipal_mutex_enter(&hash->lock);
+	table_t *retired = hash->retired;
+	hash->retired = NULL;
+	minipal_mutex_leave(&hash->lock);
+
+	while (retired) {
+		table_t *next = retired->next_retired;
+		table_free(hash->allocator, retired);
+		retired = next;
+	}
+}
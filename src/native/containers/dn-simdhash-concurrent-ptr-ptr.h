@@ -0,0 +1,54 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __DN_SIMDHASH_CONCURRENT_PTR_PTR_H__
+#define __DN_SIMDHASH_CONCURRENT_PTR_PTR_H__
+
+#include <stdint.h>
+#include "dn-utils.h"
+#include "dn-allocator.h"
+
+// A read-mostly, insert-only pointer -> pointer simdhash for shared caches.
+// Lookups are lock-free and may run concurrently with inserts from any number of
+//  threads. Inserts are serialized by an internal lock. When the table grows, a new
+//  table is built and published, and the old one is retired instead of freed, since
+//  readers may still be scanning it. Retired tables are freed by
+//  dn_simdhash_concurrent_ptr_ptr_reclaim, which the owner must only call at a point
+//  where no lookup can be in flight (e.g. while the runtime is suspended).
+// Keys cannot be removed and their values cannot be replaced once added.
+
+typedef struct dn_simdhash_concurrent_ptr_ptr_t dn_simdhash_concurrent_ptr_ptr_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+dn_simdhash_concurrent_ptr_ptr_t *
+dn_simdhash_concurrent_ptr_ptr_new (uint32_t capacity, dn_allocator_t *allocator);
+
+// Frees the hash, including any retired tables. No other thread may be using it.
+void
+dn_simdhash_concurrent_ptr_ptr_free (dn_simdhash_concurrent_ptr_ptr_t *hash);
+
+// Returns 1 if the key was added, 0 if it was already present (in which case the
+//  existing value is left in place).
+uint8_t
+dn_simdhash_concurrent_ptr_ptr_try_add (dn_simdhash_concurrent_ptr_ptr_t *hash, void *key, void *value);
+
+// Safe to call without any locking. Keys added concurrently with this call may not be found.
+uint8_t
+dn_simdhash_concurrent_ptr_ptr_try_get_value (dn_simdhash_concurrent_ptr_ptr_t *hash, void *key, void **result);
+
+uint32_t
+dn_simdhash_concurrent_ptr_ptr_count (dn_simdhash_concurrent_ptr_ptr_t *hash);
+
+// Frees tables retired by previous resizes. The caller guarantees that no thread is
+//  inside dn_simdhash_concurrent_ptr_ptr_try_get_value for this hash.
+void
+dn_simdhash_concurrent_ptr_ptr_reclaim (dn_simdhash_concurrent_ptr_ptr_t *hash);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // __DN_SIMDHASH_CONCURRENT_PTR_PTR_H__
@@ -58,9 +58,9 @@ dn_simdhash_ght_replaced (dn_simdhash_ght_data data, void * old_key, void * new_
 #define DN_SIMDHASH_ON_REPLACE dn_simdhash_ght_replaced
 // perfect cache alignment. 128-byte buckets for 64-bit pointers, 64-byte buckets for 32-bit pointers
 #if SIZEOF_VOID_P == 8
-#define DN_SIMDHASH_BUCKET_CAPACITY 14
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(14, 8)
 #else
-#define DN_SIMDHASH_BUCKET_CAPACITY 12
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(12, 4)
 #endif
 #define DN_SIMDHASH_NO_DEFAULT_NEW 1
 
@@ -15,9 +15,9 @@
 #define DN_SIMDHASH_KEY_EQUALS(data, lhs, rhs) (lhs == rhs)
 // perfect cache alignment. 128-byte buckets for 64-bit pointers, 64-byte buckets for 32-bit pointers
 #if SIZEOF_VOID_P == 4
-#define DN_SIMDHASH_BUCKET_CAPACITY 12
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(12, 4)
 #else
-#define DN_SIMDHASH_BUCKET_CAPACITY 11
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(11, 8)
 #endif
 
 #include "dn-simdhash-specialization.h"
@@ -30,10 +30,10 @@ dn_ptrpair_t_equals (dn_ptrpair_t lhs, dn_ptrpair_t rhs)
 #define DN_SIMDHASH_KEY_EQUALS(data, lhs, rhs) dn_ptrpair_t_equals(lhs, rhs)
 #if SIZEOF_VOID_P == 8
 // 192 bytes holds 12 16-byte blocks, so 11 keys and one suffix table
-#define DN_SIMDHASH_BUCKET_CAPACITY 11
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(11, 16)
 #else
 // 128 bytes holds 16 8-byte blocks, so 14 keys and one suffix table
-#define DN_SIMDHASH_BUCKET_CAPACITY 14
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(14, 8)
 #endif
 
 #include "dn-simdhash-specialization.h"
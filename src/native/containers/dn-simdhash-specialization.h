@@ -72,7 +72,7 @@
 #ifndef DN_SIMDHASH_BUCKET_CAPACITY
 // TODO: Find some way to automatically select an ideal bucket capacity based on key size.
 // Some sort of trick using _Generic?
-#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_DEFAULT_BUCKET_CAPACITY
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(DN_SIMDHASH_DEFAULT_BUCKET_CAPACITY, sizeof(DN_SIMDHASH_KEY_T))
 #endif
 
 #include "dn-simdhash-specialization-declarations.h"
@@ -41,9 +41,9 @@ dn_simdhash_str_hash (dn_simdhash_str_key v1)
 
 // perfect cache alignment. 32-bit ptrs: 8-byte keys. 64-bit: 16-byte keys.
 #if SIZEOF_VOID_P == 8
-#define DN_SIMDHASH_BUCKET_CAPACITY 11
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(11, 16)
 #else
-#define DN_SIMDHASH_BUCKET_CAPACITY 12
+#define DN_SIMDHASH_BUCKET_CAPACITY DN_SIMDHASH_SCALE_BUCKET_CAPACITY(12, 8)
 #endif
 
 #include "dn-simdhash-specialization.h"
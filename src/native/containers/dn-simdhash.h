@@ -12,16 +12,42 @@
 extern "C" {
 #endif // __cplusplus
 
+// We default to 16-byte-wide vectors (I've tested this, 32-byte vectors are slower
+//  for the key sizes we use). Defining DN_SIMDHASH_WIDE_BUCKETS=1 when building with
+//  -mavx2 or -mavx512bw opts into 32- or 64-byte suffix vectors instead, which lets each
+//  bucket hold more keys so that high load factors cascade into neighboring buckets less.
+// The bucket layout is baked into every specialization, so this is a build-time choice
+//  and all translation units have to agree on it.
+#if defined(DN_SIMDHASH_WIDE_BUCKETS) && DN_SIMDHASH_WIDE_BUCKETS && (defined(__clang__) || defined(__GNUC__))
+#if defined(__AVX512BW__)
+#define DN_SIMDHASH_VECTOR_WIDTH 64
+#elif defined(__AVX2__)
+#define DN_SIMDHASH_VECTOR_WIDTH 32
+#endif
+#endif
+#ifndef DN_SIMDHASH_VECTOR_WIDTH
+#define DN_SIMDHASH_VECTOR_WIDTH 16
+#endif
 // We reserve the last two bytes of each suffix vector to store data
-#define DN_SIMDHASH_MAX_BUCKET_CAPACITY 14
+#define DN_SIMDHASH_MAX_BUCKET_CAPACITY (DN_SIMDHASH_VECTOR_WIDTH - 2)
 // The ideal capacity depends on the size of your keys. For 4-byte keys, it is 12.
 #define DN_SIMDHASH_DEFAULT_BUCKET_CAPACITY 12
+// Bucket capacities are tuned for 16-byte suffix vectors. For wider vectors this gives the
+//  number of keys that fit in a bucket scaled up by the same factor as the vector.
+#if DN_SIMDHASH_VECTOR_WIDTH == 16
+#define DN_SIMDHASH_SCALE_BUCKET_CAPACITY(capacity, key_size) (capacity)
+#else
+#define DN_SIMDHASH_SCALED_BUCKET_CAPACITY_INNER(capacity, key_size) \
+	(((((16 + ((capacity) * (key_size)) + 15) / 16) * DN_SIMDHASH_VECTOR_WIDTH) - DN_SIMDHASH_VECTOR_WIDTH) / (key_size))
+#define DN_SIMDHASH_SCALE_BUCKET_CAPACITY(capacity, key_size) \
+	((DN_SIMDHASH_SCALED_BUCKET_CAPACITY_INNER(capacity, key_size) < DN_SIMDHASH_MAX_BUCKET_CAPACITY) \
+		? DN_SIMDHASH_SCALED_BUCKET_CAPACITY_INNER(capacity, key_size) \
+		: DN_SIMDHASH_MAX_BUCKET_CAPACITY)
+#endif
 // We use the last two bytes specifically to store item count and cascade flag
 #define DN_SIMDHASH_COUNT_SLOT (DN_SIMDHASH_MAX_BUCKET_CAPACITY)
 // The cascade flag indicates that an item overflowed from this bucket into the next one
 #define DN_SIMDHASH_CASCADED_SLOT (DN_SIMDHASH_MAX_BUCKET_CAPACITY + 1)
-// We always use 16-byte-wide vectors (I've tested this, 32-byte vectors are slower)
-#define DN_SIMDHASH_VECTOR_WIDTH 16
 // Set a minimum number of buckets when created, regardless of requested capacity
 #define DN_SIMDHASH_MIN_BUCKET_COUNT 1
 // User-specified capacity values will be increased to this percentage in order
@@ -3,6 +3,15 @@
 
 #include "ghashtable.h"
 
+// The multithreaded measurements use pthreads, which the MSVC and wasm builds don't have
+#ifndef BENCHMARK_THREADS
+#if !defined(_MSC_VER) && !defined(__wasm)
+#define BENCHMARK_THREADS 1
+#else
+#define BENCHMARK_THREADS 0
+#endif
+#endif
+
 #ifndef MEASUREMENTS_IMPLEMENTATION
 #define MEASUREMENTS_IMPLEMENTATION 1
 
@@ -47,8 +56,22 @@ static uint32_t random_uint () {
     return (uint32_t)(xoshiro256ss() & 0xFFFFFFFFu);
 }
 
+// Wider suffix vectors change how full buckets get before items cascade, so report
+//  the load factor and the number of buckets that had to hand items to a neighbor.
+static void print_table_stats (const char *name, dn_simdhash_t *hash) {
+    uint32_t count = dn_simdhash_count(hash), capacity = dn_simdhash_capacity(hash),
+        bucket_count = capacity / hash->meta->bucket_capacity,
+        overflow_count = dn_simdhash_overflow_count(hash);
+    printf(
+        "%s: %u item(s) in %u bucket(s) of %u, load factor %.3f, %u cascade(s) (%.3f per bucket)\n",
+        name, count, bucket_count, hash->meta->bucket_capacity,
+        (double)count / capacity, overflow_count, (double)overflow_count / bucket_count
+    );
+}
+
 static void init_data () {
     printf("Random u32 key count: %d. Bad hash key count: %d\n", INNER_COUNT, BH_INNER_COUNT);
+    printf("Suffix vector width: %d byte(s)\n", DN_SIMDHASH_VECTOR_WIDTH);
 
     random_u32s_hash = dn_simdhash_u32_ptr_new(INNER_COUNT, NULL);
     sequential_u32s = dn_vector_alloc(sizeof(uint32_t));
@@ -76,6 +99,8 @@ retry2: {
         dn_vector_push_back(random_unused_u32s, key);
 }
     }
+
+    print_table_stats("random u32 keys", random_u32s_hash);
 }
 
 static uint32_t bad_hash_func (const void * key) {
@@ -207,6 +232,253 @@ static void * create_instance_dnght_sequential_keys () {
     return result;
 }
 
+
+// Key shapes used by the Mono metadata caches: blob heap indexes and pointers into
+//  the blob heap (byte granularity, small irregular strides) and MonoClass pointers
+//  (8-byte aligned, large strides)
+static dn_vector_t *blob_indexes, *blob_ptrs, *class_ptrs, *unused_class_ptrs;
+
+static void * create_instance_ptr_ptr (dn_vector_t *keys);
+
+static void init_metadata_data () {
+    if (!random_u32s)
+        init_data();
+
+    blob_indexes = dn_vector_alloc(sizeof(uint32_t));
+    blob_ptrs = dn_vector_alloc(sizeof(void *));
+    class_ptrs = dn_vector_alloc(sizeof(void *));
+    unused_class_ptrs = dn_vector_alloc(sizeof(void *));
+
+    size_t blob_address = 0x10000000u, class_address = 0x20000000u;
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        blob_address += 3 + (random_uint() & 31);
+        uint32_t blob_index = (uint32_t)(blob_address - 0x10000000u);
+        dn_vector_push_back(blob_indexes, blob_index);
+        void *blob_ptr = (void *)blob_address;
+        dn_vector_push_back(blob_ptrs, blob_ptr);
+
+        class_address += 8 * (16 + (random_uint() & 63));
+        void *class_ptr = (void *)class_address;
+        dn_vector_push_back(class_ptrs, class_ptr);
+        // Classes without a cache entry live in between the ones which have one
+        void *unused_class_ptr = (void *)(class_address + 64);
+        dn_vector_push_back(unused_class_ptrs, unused_class_ptr);
+    }
+
+    dn_simdhash_ptr_ptr_t *class_ptrs_hash = create_instance_ptr_ptr(class_ptrs);
+    print_table_stats("class ptr keys", class_ptrs_hash);
+    dn_simdhash_free(class_ptrs_hash);
+}
+
+static guint aligned_addr_hash (gconstpointer ptr) {
+    return (guint)(((size_t)ptr) >> 3);
+}
+
+static void * create_instance_u32_ptr_blob_indexes () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    dn_simdhash_u32_ptr_t *result = dn_simdhash_u32_ptr_new(0, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(blob_indexes, uint32_t, i);
+        dn_simdhash_u32_ptr_try_add(result, key, (void *)(size_t)i);
+    }
+    return result;
+}
+
+static void * create_instance_ght_blob_indexes () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    GHashTable *result = g_hash_table_new(NULL, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(blob_indexes, uint32_t, i);
+        g_hash_table_insert(result, (gpointer)(size_t)key, (gpointer)(size_t)i);
+    }
+    return result;
+}
+
+static void * create_instance_ptr_ptr (dn_vector_t *keys) {
+    dn_simdhash_ptr_ptr_t *result = dn_simdhash_ptr_ptr_new(0, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(keys, void *, i);
+        dn_simdhash_ptr_ptr_try_add(result, key, (void *)(size_t)i);
+    }
+    return result;
+}
+
+static void * create_instance_ght_ptrs (dn_vector_t *keys, GHashFunc hash_func) {
+    GHashTable *result = g_hash_table_new(hash_func, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(keys, void *, i);
+        g_hash_table_insert(result, key, (gpointer)(size_t)i);
+    }
+    return result;
+}
+
+static void * create_instance_ptr_ptr_blob_ptrs () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    return create_instance_ptr_ptr(blob_ptrs);
+}
+
+static void * create_instance_ght_blob_ptrs () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    return create_instance_ght_ptrs(blob_ptrs, NULL);
+}
+
+static void * create_instance_ptr_ptr_class_ptrs () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    return create_instance_ptr_ptr(class_ptrs);
+}
+
+static void * create_instance_ght_class_ptrs () {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    return create_instance_ght_ptrs(class_ptrs, aligned_addr_hash);
+}
+
+#if BENCHMARK_THREADS
+#include <pthread.h>
+#include "../dn-simdhash-concurrent-ptr-ptr.h"
+
+#define MAX_READER_COUNT 64
+
+// A pool of reader threads that each look up every class ptr once per iteration,
+//  either lock-free in a concurrent simdhash or under a mutex in a plain one (which is
+//  what shared caches do today). Each iteration does reader_count * INNER_COUNT lookups,
+//  so perfect scaling shows up as a flat time per iteration as readers are added.
+typedef struct {
+    dn_simdhash_concurrent_ptr_ptr_t *concurrent_hash;
+    dn_simdhash_ptr_ptr_t *locked_hash;
+    pthread_mutex_t hash_lock;
+
+    pthread_mutex_t lock;
+    pthread_cond_t start_cond, done_cond;
+    uint32_t reader_count, generation, remaining;
+    uint8_t exiting;
+    pthread_t readers[MAX_READER_COUNT];
+} reader_pool_t;
+
+static void reader_pool_pass (reader_pool_t *pool) {
+    void *temp = NULL;
+    if (pool->concurrent_hash) {
+        for (int i = 0; i < INNER_COUNT; i++) {
+            void *key = *dn_vector_index_t(class_ptrs, void *, i);
+            dn_simdhash_assert(dn_simdhash_concurrent_ptr_ptr_try_get_value(pool->concurrent_hash, key, &temp));
+        }
+    } else {
+        for (int i = 0; i < INNER_COUNT; i++) {
+            void *key = *dn_vector_index_t(class_ptrs, void *, i);
+            pthread_mutex_lock(&pool->hash_lock);
+            uint8_t found = dn_simdhash_ptr_ptr_try_get_value(pool->locked_hash, key, &temp);
+            pthread_mutex_unlock(&pool->hash_lock);
+            dn_simdhash_assert(found);
+        }
+    }
+}
+
+static void * reader_pool_thread (void *_pool) {
+    reader_pool_t *pool = _pool;
+    uint32_t seen_generation = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (1) {
+        while ((pool->generation == seen_generation) && !pool->exiting)
+            pthread_cond_wait(&pool->start_cond, &pool->lock);
+        if (pool->exiting)
+            break;
+        seen_generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        reader_pool_pass(pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->remaining == 0)
+            pthread_cond_signal(&pool->done_cond);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static void * create_reader_pool (uint32_t reader_count, uint8_t locked) {
+    if (!blob_indexes)
+        init_metadata_data();
+
+    dn_simdhash_assert(reader_count <= MAX_READER_COUNT);
+    reader_pool_t *pool = calloc(1, sizeof(reader_pool_t));
+    if (locked) {
+        pool->locked_hash = create_instance_ptr_ptr(class_ptrs);
+        pthread_mutex_init(&pool->hash_lock, NULL);
+    } else {
+        // Start small so that the readers see tables published by several resizes
+        pool->concurrent_hash = dn_simdhash_concurrent_ptr_ptr_new(0, NULL);
+        for (int i = 0; i < INNER_COUNT; i++) {
+            void *key = *dn_vector_index_t(class_ptrs, void *, i);
+            dn_simdhash_concurrent_ptr_ptr_try_add(pool->concurrent_hash, key, (void *)(size_t)i);
+        }
+        dn_simdhash_concurrent_ptr_ptr_reclaim(pool->concurrent_hash);
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    pool->reader_count = reader_count;
+    for (uint32_t i = 0; i < reader_count; i++)
+        dn_simdhash_assert(pthread_create(&pool->readers[i], NULL, reader_pool_thread, pool) == 0);
+    return pool;
+}
+
+static void run_reader_pool (reader_pool_t *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->remaining = pool->reader_count;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start_cond);
+    while (pool->remaining)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void destroy_reader_pool (void *_pool) {
+    reader_pool_t *pool = _pool;
+    pthread_mutex_lock(&pool->lock);
+    pool->exiting = 1;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (uint32_t i = 0; i < pool->reader_count; i++)
+        pthread_join(pool->readers[i], NULL);
+
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_mutex_destroy(&pool->lock);
+    if (pool->locked_hash) {
+        pthread_mutex_destroy(&pool->hash_lock);
+        dn_simdhash_free(pool->locked_hash);
+    } else {
+        dn_simdhash_concurrent_ptr_ptr_free(pool->concurrent_hash);
+    }
+    free(pool);
+}
+
+#define READER_POOL_SETUP(reader_count) \
+    static void * create_reader_pool_concurrent_ ## reader_count () { return create_reader_pool(reader_count, 0); } \
+    static void * create_reader_pool_locked_ ## reader_count () { return create_reader_pool(reader_count, 1); }
+
+READER_POOL_SETUP(1)
+READER_POOL_SETUP(2)
+READER_POOL_SETUP(4)
+READER_POOL_SETUP(8)
+READER_POOL_SETUP(16)
+READER_POOL_SETUP(32)
+READER_POOL_SETUP(64)
+#endif // BENCHMARK_THREADS
+
 #endif // MEASUREMENTS_IMPLEMENTATION
 
 // These go outside the guard because we include this file multiple times.
@@ -355,3 +627,85 @@ MEASUREMENT(dnght_find_sequential_keys, dn_simdhash_ght_t *, create_instance_dng
         dn_simdhash_assert(dn_simdhash_ght_get_value_or_default(data, (gpointer)(size_t)key) == (gpointer)(size_t)i);
     }
 })
+
+
+MEASUREMENT(dn_find_blob_indexes, dn_simdhash_u32_ptr_t *, create_instance_u32_ptr_blob_indexes, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(blob_indexes, uint32_t, i);
+        dn_simdhash_assert(dn_simdhash_u32_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(ght_find_blob_indexes, GHashTable *, create_instance_ght_blob_indexes, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        uint32_t key = *dn_vector_index_t(blob_indexes, uint32_t, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, (gpointer)(size_t)key) == (gpointer)(size_t)i);
+    }
+})
+
+
+MEASUREMENT(dnptr_find_blob_ptrs, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_blob_ptrs, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(blob_ptrs, void *, i);
+        dn_simdhash_assert(dn_simdhash_ptr_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(ght_find_blob_ptrs, GHashTable *, create_instance_ght_blob_ptrs, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(blob_ptrs, void *, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, key) == (gpointer)(size_t)i);
+    }
+})
+
+
+MEASUREMENT(dnptr_find_class_ptrs, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_class_ptrs, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(class_ptrs, void *, i);
+        dn_simdhash_assert(dn_simdhash_ptr_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(ght_find_class_ptrs, GHashTable *, create_instance_ght_class_ptrs, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(class_ptrs, void *, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, key) == (gpointer)(size_t)i);
+    }
+})
+
+MEASUREMENT(dnptr_find_missing_class_ptrs, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_class_ptrs, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(unused_class_ptrs, void *, i);
+        dn_simdhash_assert(!dn_simdhash_ptr_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(ght_find_missing_class_ptrs, GHashTable *, create_instance_ght_class_ptrs, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(unused_class_ptrs, void *, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, key) == NULL);
+    }
+})
+
+#if BENCHMARK_THREADS
+// Names starting with mt_ are timed by wall clock instead of process CPU time.
+MEASUREMENT(mt_concurrent_find_class_ptrs_01_readers, reader_pool_t *, create_reader_pool_concurrent_1, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_02_readers, reader_pool_t *, create_reader_pool_concurrent_2, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_04_readers, reader_pool_t *, create_reader_pool_concurrent_4, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_08_readers, reader_pool_t *, create_reader_pool_concurrent_8, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_16_readers, reader_pool_t *, create_reader_pool_concurrent_16, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_32_readers, reader_pool_t *, create_reader_pool_concurrent_32, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_concurrent_find_class_ptrs_64_readers, reader_pool_t *, create_reader_pool_concurrent_64, destroy_reader_pool, run_reader_pool(data))
+
+MEASUREMENT(mt_locked_find_class_ptrs_01_readers, reader_pool_t *, create_reader_pool_locked_1, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_02_readers, reader_pool_t *, create_reader_pool_locked_2, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_04_readers, reader_pool_t *, create_reader_pool_locked_4, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_08_readers, reader_pool_t *, create_reader_pool_locked_8, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_16_readers, reader_pool_t *, create_reader_pool_locked_16, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_32_readers, reader_pool_t *, create_reader_pool_locked_32, destroy_reader_pool, run_reader_pool(data))
+MEASUREMENT(mt_locked_find_class_ptrs_64_readers, reader_pool_t *, create_reader_pool_locked_64, destroy_reader_pool, run_reader_pool(data))
+#endif // BENCHMARK_THREADS
@@ -43,6 +43,9 @@ dn_simdhash_assert_fail (const char *file, int line, const char *condition) {
 
 #define MTICKS_PER_SEC (10 * 1000 * 1000)
 
+// Set for multithreaded measurements, since process CPU time adds up the time of every thread
+static uint8_t use_wall_clock;
+
 int64_t get_100ns_ticks () {
 #ifdef _MSC_VER
 	static LARGE_INTEGER freq;
@@ -64,7 +67,7 @@ int64_t get_100ns_ticks () {
 #ifdef __wasm
     dn_simdhash_assert(clock_gettime(CLOCK_MONOTONIC, &ts) == 0);
 #else
-    dn_simdhash_assert(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) == 0);
+    dn_simdhash_assert(clock_gettime(use_wall_clock ? CLOCK_MONOTONIC : CLOCK_PROCESS_CPUTIME_ID, &ts) == 0);
 #endif
     return ((int64_t)ts.tv_sec * MTICKS_PER_SEC + ts.tv_nsec / 100);
 #endif
@@ -125,6 +128,8 @@ void foreach_measurement (const char *name, void *_info, void *_args) {
     if (!match)
         return;
 
+    use_wall_clock = strncmp(name, "mt_", 3) == 0;
+
     int64_t warmup_duration = 20000000,
         target_step_duration = 10000000,
         target_duration = warmup_duration * 10,
@@ -14,7 +14,7 @@ bool file_entry_t::is_valid() const
         static_cast<file_type_t>(m_type) < file_type_t::__last;
 }
 
-file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction)
+file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool load_native_from_memory)
 {
     // First read the fixed-sized portion of file-entry
     file_entry_fixed_t fixed_data;
@@ -32,7 +32,7 @@ file_entry_t file_entry_t::read(reader_t &reader, uint32_t bundle_major_version,
 
     fixed_data.type   = (file_type_t)reader.read_byte();
 
-    file_entry_t entry(&fixed_data, force_extraction);
+    file_entry_t entry(&fixed_data, force_extraction, load_native_from_memory);
 
     if (!entry.is_valid())
     {
@@ -52,6 +52,9 @@ bool file_entry_t::needs_extraction() const
     if (m_force_extraction)
         return true;
 
+    if (m_load_from_memory)
+        return false;
+
     switch (m_type)
     {
     case file_type_t::deps_json:
@@ -42,12 +42,14 @@ namespace bundle
             , m_relative_path()
             , m_disabled(false)
             , m_force_extraction(false)
+            , m_load_from_memory(false)
         {
         }
 
         file_entry_t(
             const file_entry_fixed_t *fixed_data,
-            const bool force_extraction = false)
+            const bool force_extraction = false,
+            const bool load_native_from_memory = false)
             : m_relative_path()
             , m_disabled(false)
             , m_force_extraction(force_extraction)
@@ -61,6 +63,10 @@ namespace bundle
             m_size = fixed_data->size;
             m_compressedSize = fixed_data->compressedSize;
             m_type = fixed_data->type;
+
+            // Only uncompressed native binaries can be copied straight into memory.
+            m_load_from_memory = load_native_from_memory && !force_extraction
+                && m_type == file_type_t::native_binary && m_compressedSize == 0;
         }
 
         const pal::string_t relative_path() const { return m_relative_path; }
@@ -71,9 +77,10 @@ namespace bundle
         void disable() { m_disabled = true; }
         bool is_disabled() const { return m_disabled; }
         bool needs_extraction() const;
+        bool loads_from_memory() const { return m_load_from_memory; }
         bool matches(const pal::string_t& path) const { return (pal::pathcmp(relative_path(), path) == 0) && !is_disabled(); }
 
-        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction);
+        static file_entry_t read(reader_t &reader, uint32_t bundle_major_version, bool force_extraction, bool load_native_from_memory);
 
     private:
         int64_t m_offset;
@@ -87,6 +94,8 @@ namespace bundle
         // in such case, and the lookup logic will behave as if the file is not present in the bundle.
         bool m_disabled;
         bool m_force_extraction;
+        // Native binaries that are loaded directly from the bundle through an in-memory file instead of being extracted.
+        bool m_load_from_memory;
         bool is_valid() const;
     };
 }
@@ -5,15 +5,16 @@
 
 using namespace bundle;
 
-manifest_t manifest_t::read(reader_t& reader, const header_t& header)
+manifest_t manifest_t::read(reader_t& reader, const header_t& header, bool load_native_from_memory)
 {
     manifest_t manifest;
 
     for (int32_t i = 0; i < header.num_embedded_files(); i++)
     {
-        file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode());
-        manifest.files.push_back(std::move(entry));
+        file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode(), load_native_from_memory);
         manifest.m_files_need_extraction |= entry.needs_extraction();
+        manifest.m_files_load_from_memory |= entry.loads_from_memory();
+        manifest.files.push_back(std::move(entry));
     }
 
     return manifest;
@@ -18,20 +18,27 @@ namespace bundle
     public:
         manifest_t()
             : m_files_need_extraction(false)
+            , m_files_load_from_memory(false)
         {
         }
 
         std::vector<file_entry_t> files;
 
-        static manifest_t read(reader_t &reader, const header_t &header);
+        static manifest_t read(reader_t &reader, const header_t &header, bool load_native_from_memory);
 
         bool files_need_extraction() const
         {
             return m_files_need_extraction;
         }
 
+        bool files_load_from_memory() const
+        {
+            return m_files_load_from_memory;
+        }
+
     private:
         bool m_files_need_extraction;
+        bool m_files_load_from_memory;
     };
 }
 #endif // __MANIFEST_H__
@@ -11,6 +11,21 @@
 
 using namespace bundle;
 
+namespace
+{
+    // Loading native libraries from memory is opt-in: a library whose dependencies are also bundled
+    // must be loaded after them, and the path reported for it by the loader is not a real file.
+    bool load_native_from_memory_enabled()
+    {
+#if defined(__linux__)
+        pal::string_t value;
+        return pal::getenv(_X("DOTNET_BUNDLE_LOAD_NATIVE_FROM_MEMORY"), &value) && value == _X("1");
+#else
+        return false;
+#endif
+    }
+}
+
 // This method processes the bundle manifest.
 // It also implements the extraction of files that cannot be directly processed from the bundle.
 StatusCode runner_t::extract()
@@ -29,7 +44,7 @@ StatusCode runner_t::extract()
         m_runtimeconfig_json.set_location(&m_header.runtimeconfig_json_location());
 
         // Read the bundle manifest
-        m_manifest = manifest_t::read(reader, m_header);
+        m_manifest = manifest_t::read(reader, m_header, load_native_from_memory_enabled());
 
         // Extract the files if necessary
         if (m_manifest.files_need_extraction())
@@ -66,8 +81,9 @@ bool runner_t::probe(const pal::string_t& relative_path, int64_t* offset, int64_
 {
     const bundle::file_entry_t* entry = probe(relative_path);
 
-    // Do not report extracted entries - those should be reported through either TPA or resource paths
-    if (entry == nullptr || entry->needs_extraction())
+    // Do not report extracted entries - those should be reported through either TPA or resource paths.
+    // Native libraries loaded from memory are resolved through resolve_native_import instead.
+    if (entry == nullptr || entry->needs_extraction() || entry->loads_from_memory())
     {
         return false;
     }
@@ -116,3 +132,71 @@ bool runner_t::disable(const pal::string_t& relative_path)
     return false;
 }
 
+
+const file_entry_t* runner_t::probe_native_library(const pal::string_t& library_name) const
+{
+    // The runtime passes the name as written in the DllImport, so also try the platform's
+    // library naming conventions. Only libraries at the root of the bundle are considered.
+    const pal::string_t candidates[] =
+    {
+        library_name,
+        library_name + _STRINGIFY(LIB_FILE_EXT),
+        _STRINGIFY(LIB_PREFIX) + library_name + _STRINGIFY(LIB_FILE_EXT),
+    };
+
+    for (const pal::string_t& candidate : candidates)
+    {
+        const file_entry_t* entry = probe(candidate);
+        if (entry != nullptr && entry->loads_from_memory())
+        {
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+const void* runner_t::resolve_native_import(const char* library_name, const char* entry_point_name) const
+{
+    pal::string_t name;
+    if (!pal::clr_palstring(library_name, &name) || name.find(DIR_SEPARATOR) != pal::string_t::npos)
+    {
+        return nullptr;
+    }
+
+    const file_entry_t* entry = probe_native_library(name);
+    if (entry == nullptr)
+    {
+        return nullptr;
+    }
+
+    pal::dll_t dll;
+    {
+        std::lock_guard<std::mutex> lock{ m_native_libraries_lock };
+        auto iter = m_native_libraries.find(entry);
+        if (iter != m_native_libraries.end())
+        {
+            dll = iter->second;
+        }
+        else
+        {
+            if (pal::load_library_from_file_range(m_bundle_path, entry->offset() + m_offset_in_file, entry->size(), entry->relative_path(), &dll))
+            {
+                trace::info(_X("Loaded bundled native library [%s] from memory"), entry->relative_path().c_str());
+            }
+            else
+            {
+                trace::warning(_X("Failed to load bundled native library [%s] from memory"), entry->relative_path().c_str());
+            }
+
+            m_native_libraries.emplace(entry, dll);
+        }
+    }
+
+    if (dll == nullptr)
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const void*>(pal::get_symbol(dll, entry_point_name));
+}
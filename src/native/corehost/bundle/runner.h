@@ -4,6 +4,8 @@
 #ifndef __RUNNER_H__
 #define __RUNNER_H__
 
+#include <mutex>
+#include <unordered_map>
 #include "error_codes.h"
 #include "header.h"
 #include "manifest.h"
@@ -12,6 +14,7 @@
 // bundle::runner extends bundle::info to supports:
 // * Reading the bundle manifest and identifying file locations for the runtime
 // * Extracting bundled files to disk when necessary
+// * Loading bundled native libraries from memory, where supported
 // bundle::runner is used by HostPolicy.
 
 namespace bundle
@@ -37,6 +40,9 @@ namespace bundle
         }
         bool disable(const pal::string_t& relative_path);
 
+        bool has_native_libraries_in_memory() const { return m_manifest.files_load_from_memory(); }
+        const void* resolve_native_import(const char* library_name, const char* entry_point_name) const;
+
         static StatusCode process_manifest_and_extract()
         {
             return mutable_app()->extract();
@@ -48,9 +54,15 @@ namespace bundle
     private:
 
         StatusCode extract();
+        const file_entry_t* probe_native_library(const pal::string_t& library_name) const;
 
         manifest_t m_manifest;
         pal::string_t m_extraction_path;
+
+        // Native libraries loaded from memory, keyed by their manifest entry. Failed loads are recorded
+        // as nullptr so that they are not retried for every import.
+        mutable std::mutex m_native_libraries_lock;
+        mutable std::unordered_map<const file_entry_t*, pal::dll_t> m_native_libraries;
     };
 }
 
@@ -207,7 +207,9 @@ int exe_start(const int argc, const pal::char_t* argv[])
     app_path.append(_X(".dll"));
 #endif
 
+    trace::timing_scope_t resolve_fxr_timing{_X("hostfxr_resolve")};
     hostfxr_resolver_t fxr{app_root};
+    resolve_fxr_timing.end();
 
     // Obtain the entrypoints.
     int rc = fxr.status_code();
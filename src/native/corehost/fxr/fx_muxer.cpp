@@ -70,6 +70,7 @@ int load_hostpolicy(
     pal::dll_t* h_host,
     hostpolicy_contract_t& hostpolicy_contract)
 {
+    trace::timing_scope_t timing{_X("hostpolicy_load")};
     int rc = hostpolicy_resolver::load(lib_dir, h_host, hostpolicy_contract);
     if (rc != StatusCode::Success)
     {
@@ -431,7 +432,9 @@ namespace
         fx_definition_vector_t fx_definitions;
         auto app = new fx_definition_t();
         fx_definitions.push_back(std::unique_ptr<fx_definition_t>(app));
+        trace::timing_scope_t read_config_timing{_X("runtimeconfig_read")};
         int rc = read_config(*app, app_candidate, runtime_config, override_settings);
+        read_config_timing.end();
         if (rc != StatusCode::Success)
             return rc;
 
@@ -466,6 +469,7 @@ namespace
             }
             else
             {
+                trace::timing_scope_t timing{_X("framework_resolve")};
                 rc = fx_resolver_t::resolve_frameworks_for_app(host_info.dotnet_root, override_settings, app_config, fx_definitions, mode == host_mode_t::muxer ? app_candidate.c_str() : host_info.host_path.c_str());
                 if (rc != StatusCode::Success)
                 {
@@ -24,6 +24,16 @@
 #define HOST_PROPERTY_PLATFORM_RESOURCE_ROOTS "PLATFORM_RESOURCE_ROOTS"
 #define HOST_PROPERTY_TRUSTED_PLATFORM_ASSEMBLIES "TRUSTED_PLATFORM_ASSEMBLIES"
 
+// Entry in the trusted platform assembly table provided by the host
+struct host_runtime_tpa_entry
+{
+    // Simple name of the assembly (file name without the .dll or .exe extension)
+    const char* simple_name;
+
+    // Absolute path to the assembly
+    const char* path;
+};
+
 // Any callbacks set on this contract are expected to be valid for the lifetime of the process
 struct host_runtime_contract
 {
@@ -60,6 +70,15 @@ struct host_runtime_contract
         const char* path,
         /*out*/ void **data_start,
         /*out*/ int64_t* size);
+
+    // Get the trusted platform assemblies as a table with one entry per unique simple name, in the same
+    // order and with the same contents as the TRUSTED_PLATFORM_ASSEMBLIES property. The table and its
+    // strings must remain valid for the lifetime of the process.
+    // Returns true if the table is provided, false otherwise. If false, the runtime parses TRUSTED_PLATFORM_ASSEMBLIES.
+    bool(HOST_CONTRACT_CALLTYPE* get_trusted_platform_assemblies)(
+        /*out*/ const struct host_runtime_tpa_entry** entries,
+        /*out*/ size_t* count,
+        void* contract_context);
 };
 
 #endif // __HOST_RUNTIME_CONTRACT_H__
@@ -293,6 +293,9 @@ namespace pal
     bool fullpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
     bool is_directory(const pal::string_t& path);
+    // Gets the last write time (in platform-specific ticks) and size of a file or directory.
+    // Returns false if the path does not exist.
+    bool get_file_stamp(const string_t& path, int64_t* last_write_time, int64_t* size);
     inline bool directory_exists(const string_t& path) { return file_exists(path); }
     void readdir(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
     void readdir(const string_t& path, std::vector<string_t>* list);
@@ -352,6 +355,9 @@ namespace pal
 
     bool get_loaded_library(const char_t* library_name, const char* symbol_name, /*out*/ dll_t* dll, /*out*/ string_t* path);
     bool load_library(const string_t* path, dll_t* dll);
+    // Loads a library from the 'size' bytes at 'offset' within 'path' without writing it to disk.
+    // Returns false if this is not supported on the current platform.
+    bool load_library_from_file_range(const string_t& path, int64_t offset, int64_t size, const string_t& name, dll_t* dll);
     proc_t get_symbol(dll_t library, const char* name);
     void unload_library(dll_t library);
 
@@ -39,6 +39,11 @@
 #define DT_LNK 10
 #endif
 
+#ifdef __linux__
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __linux__
 #define PAL_CWD_SIZE 0
 #elif defined(MAXPATHLEN)
@@ -236,6 +241,73 @@ bool pal::load_library(const string_t* path, dll_t* dll)
     return true;
 }
 
+bool pal::load_library_from_file_range(const string_t& path, int64_t offset, int64_t size, const string_t& name, dll_t* dll)
+{
+#if defined(__linux__) && defined(__NR_memfd_create)
+    *dll = nullptr;
+
+    // Copy the range into an anonymous memory-backed file and load it through its /proc/self/fd path.
+    // The copy happens in the kernel (sendfile), so the library is never written to a real file system.
+    int mem_fd = static_cast<int>(syscall(__NR_memfd_create, name.c_str(), 1 /* MFD_CLOEXEC */));
+    if (mem_fd == -1)
+    {
+        trace::verbose(_X("memfd_create(%s) failed with error %d"), name.c_str(), errno);
+        return false;
+    }
+
+    int src_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (src_fd == -1)
+    {
+        trace::verbose(_X("open(%s) failed with error %d"), path.c_str(), errno);
+        close(mem_fd);
+        return false;
+    }
+
+    off_t src_offset = static_cast<off_t>(offset);
+    int64_t remaining = size;
+    while (remaining > 0)
+    {
+        ssize_t copied = sendfile(mem_fd, src_fd, &src_offset, static_cast<size_t>(remaining));
+        if (copied < 0 && errno == EINTR)
+            continue;
+
+        if (copied <= 0)
+            break;
+
+        remaining -= copied;
+    }
+
+    close(src_fd);
+    if (remaining != 0)
+    {
+        trace::verbose(_X("Failed to copy %s into memory, error %d"), name.c_str(), errno);
+        close(mem_fd);
+        return false;
+    }
+
+    char fd_path[32];
+    snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", mem_fd);
+    *dll = dlopen(fd_path, RTLD_LAZY);
+
+    // The loader keeps its own mappings of the file, so the descriptor is no longer needed.
+    close(mem_fd);
+    if (*dll == nullptr)
+    {
+        trace::verbose(_X("Failed to load %s from memory, error: %s"), name.c_str(), dlerror());
+        return false;
+    }
+
+    return true;
+#else
+    (void)path;
+    (void)offset;
+    (void)size;
+    (void)name;
+    *dll = nullptr;
+    return false;
+#endif
+}
+
 pal::proc_t pal::get_symbol(dll_t library, const char* name)
 {
     auto result = dlsym(library, name);
@@ -999,6 +1071,22 @@ bool pal::is_directory(const pal::string_t& path)
     return S_ISDIR(sb.st_mode);
 }
 
+bool pal::get_file_stamp(const pal::string_t& path, int64_t* last_write_time, int64_t* size)
+{
+    struct stat sb;
+    if (::stat(path.c_str(), &sb) != 0)
+        return false;
+
+#if defined(__APPLE__)
+    int64_t nsec = static_cast<int64_t>(sb.st_mtimespec.tv_nsec);
+#else
+    int64_t nsec = static_cast<int64_t>(sb.st_mtim.tv_nsec);
+#endif
+    *last_write_time = static_cast<int64_t>(sb.st_mtime) * 1000000000 + nsec;
+    *size = static_cast<int64_t>(sb.st_size);
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
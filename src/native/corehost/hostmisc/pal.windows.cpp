@@ -315,6 +315,13 @@ pal::proc_t pal::get_symbol(dll_t library, const char* name)
     return result;
 }
 
+bool pal::load_library_from_file_range(const string_t& path, int64_t offset, int64_t size, const string_t& name, dll_t* dll)
+{
+    // Windows cannot map an image that is not backed by its own file.
+    *dll = nullptr;
+    return false;
+}
+
 void pal::unload_library(dll_t library)
 {
     // No-op. On windows, we pin the library, so it can't be unloaded.
@@ -1024,6 +1031,17 @@ bool pal::is_directory(const pal::string_t& path)
     return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
 }
 
+bool pal::get_file_stamp(const string_t& path, int64_t* last_write_time, int64_t* size)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+        return false;
+
+    *last_write_time = (static_cast<int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    *size = (static_cast<int64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
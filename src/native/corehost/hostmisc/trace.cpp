@@ -6,6 +6,7 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <minipal/utils.h>
 
 #define TRACE_VERBOSITY_WARN 2
@@ -21,6 +22,8 @@
 //  COREHOST_TRACE=1 COREHOST_TRACE_VERBOSITY=1          implies g_trace_verbosity = 1.  // Trace "enabled".  error() messages will be produced
 static int g_trace_verbosity = 0;
 static FILE * g_trace_file = nullptr;
+static FILE * g_timing_file = nullptr;
+static pal::string_t g_timing_component;
 thread_local static trace::error_writer_fn g_error_writer = nullptr;
 
 namespace
@@ -52,6 +55,44 @@ namespace
     };
 
     spin_lock g_trace_lock;
+
+    int64_t get_monotonic_us()
+    {
+        // steady_clock is backed by a system-wide monotonic clock, so values from
+        // hostfxr, hostpolicy and the executable can be compared with each other.
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void timing_println(const pal::char_t* format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        pal::file_vprintf(g_timing_file, format, args);
+        va_end(args);
+    }
+
+    void setup_timing()
+    {
+        pal::string_t timing_file_str;
+        if (g_timing_file != nullptr || !pal::getenv(_X("COREHOST_TRACE_TIMING"), &timing_file_str))
+        {
+            return;
+        }
+
+        std::lock_guard<spin_lock> lock(g_trace_lock);
+        if (g_timing_file != nullptr)
+        {
+            return;
+        }
+
+        pal::string_t module_path;
+        g_timing_component = pal::get_own_module_path(&module_path)
+            ? get_filename_without_ext(module_path)
+            : pal::string_t(_X("host"));
+
+        g_timing_file = pal::file_open(timing_file_str, _X("a"));
+    }
 }
 
 //
@@ -59,6 +100,8 @@ namespace
 //
 void trace::setup()
 {
+    setup_timing();
+
     // Read trace environment variable
     pal::string_t trace_str;
     if (!pal::getenv(_X("COREHOST_TRACE"), &trace_str))
@@ -266,3 +309,32 @@ trace::error_writer_fn trace::get_error_writer()
     // No need for locking since g_error_writer is thread local.
     return g_error_writer;
 }
+
+trace::timing_scope_t::timing_scope_t(const pal::char_t* stage)
+    : m_stage(stage)
+    , m_start(g_timing_file != nullptr || g_trace_verbosity ? get_monotonic_us() : -1)
+{
+}
+
+void trace::timing_scope_t::end()
+{
+    if (m_start < 0)
+        return;
+
+    int64_t end = get_monotonic_us();
+    int64_t start = m_start;
+    m_start = -1;
+
+    trace::verbose(_X("Host stage [%s] took %lld us"), m_stage, static_cast<long long>(end - start));
+
+    if (g_timing_file == nullptr)
+        return;
+
+    std::lock_guard<spin_lock> lock(g_trace_lock);
+    timing_println(
+        _X("{\"pid\":%d,\"component\":\"%s\",\"stage\":\"%s\",\"start_us\":%lld,\"end_us\":%lld}"),
+        pal::get_pid(), g_timing_component.c_str(), m_stage, static_cast<long long>(start), static_cast<long long>(end));
+
+    // Other components of the process append to the same file, so write each record out immediately.
+    fflush(g_timing_file);
+}
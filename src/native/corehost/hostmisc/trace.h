@@ -30,6 +30,29 @@ namespace trace
 
     // Returns the currently set callback for error writing
     error_writer_fn get_error_writer();
+
+    // Records the duration of a host startup stage.
+    //
+    // When COREHOST_TRACE_TIMING is set to a file path, a JSON object is appended to that file
+    // (one per line) for every stage with the process id, the host component, the stage name and
+    // monotonic start/end timestamps in microseconds. Timestamps are comparable across components
+    // of the same process. When tracing is enabled, stage durations are also written to the trace.
+    class timing_scope_t
+    {
+    public:
+        explicit timing_scope_t(const pal::char_t* stage);
+        ~timing_scope_t() { end(); }
+
+        timing_scope_t(const timing_scope_t&) = delete;
+        timing_scope_t& operator=(const timing_scope_t&) = delete;
+
+        // Ends the stage before the scope exits. Subsequent calls have no effect.
+        void end();
+
+    private:
+        const pal::char_t* m_stage;
+        int64_t m_start;
+    };
 };
 
 #endif // TRACE_H
@@ -33,7 +33,10 @@ pal::hresult_t coreclr_t::create(
     const coreclr_property_bag_t &properties,
     std::unique_ptr<coreclr_t> &inst)
 {
-    if (!coreclr_bind(libcoreclr_path))
+    trace::timing_scope_t bind_timing{_X("coreclr_bind")};
+    bool bound = coreclr_bind(libcoreclr_path);
+    bind_timing.end();
+    if (!bound)
     {
         trace::error(_X("Failed to bind to CoreCLR at '%s'"), libcoreclr_path.c_str());
         return StatusCode::CoreClrBindFailure;
@@ -68,6 +71,7 @@ pal::hresult_t coreclr_t::create(
         coreclr_contract.coreclr_set_error_writer(log_error);
     }
 
+    trace::timing_scope_t initialize_timing{_X("coreclr_initialize")};
     pal::hresult_t hr;
     hr = coreclr_contract.coreclr_initialize(
         exe_path,
@@ -77,6 +81,7 @@ pal::hresult_t coreclr_t::create(
         values.data(),
         &host_handle,
         &domain_id);
+    initialize_timing.end();
 
     if (coreclr_contract.coreclr_set_error_writer != nullptr)
     {
@@ -105,6 +110,7 @@ pal::hresult_t coreclr_t::execute_assembly(
 {
     assert(coreclr_contract.coreclr_execute_assembly != nullptr);
 
+    trace::timing_scope_t timing{_X("execute_assembly")};
     return coreclr_contract.coreclr_execute_assembly(
         _host_handle,
         _domain_id,
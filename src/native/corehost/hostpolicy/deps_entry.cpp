@@ -20,6 +20,55 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
     return normalized_path;
 }
 
+// -----------------------------------------------------------------------------
+// Determine whether 'path' exists on disk.
+//
+// The first query for a directory is answered with a stat, since package layouts
+// typically contain a single asset per directory. Once a directory is queried again
+// it is enumerated and all further queries are answered from the listing. A name that
+// only matches with different casing falls back to a stat so that the result agrees
+// with the file system's case sensitivity.
+bool dir_listing_cache_t::file_exists(const pal::string_t& path)
+{
+    size_t sep = path.find_last_of(DIR_SEPARATOR);
+    if (sep == pal::string_t::npos)
+    {
+        return pal::file_exists(path);
+    }
+
+    listing_t& listing = m_listings[path.substr(0, sep)];
+    if (!listing.enumerated)
+    {
+        if (listing.queries++ == 0)
+        {
+            return pal::file_exists(path);
+        }
+
+        std::vector<pal::string_t> files;
+        pal::readdir(path.substr(0, sep), &files);
+        for (const pal::string_t& file : files)
+        {
+            listing.lower_names.insert(to_lower(file.c_str()));
+            listing.names.insert(file);
+        }
+
+        listing.enumerated = true;
+    }
+
+    pal::string_t name = path.substr(sep + 1);
+    if (listing.names.count(name) != 0)
+    {
+        return true;
+    }
+
+    if (listing.lower_names.count(to_lower(name.c_str())) != 0)
+    {
+        return pal::file_exists(path);
+    }
+
+    return false;
+}
+
 // -----------------------------------------------------------------------------
 // Given a "base" directory, determine the resolved path for this file.
 //
@@ -33,12 +82,13 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
 //    str  - (out parameter) If the method returns true, contains the file path for this deps entry
 //    search_options - Flags to instruct where to look for this deps entry
 //    found_in_bundle - (out parameter) True if the candidate is located within the single-file bundle.
+//    listing_cache - If not null, used to answer file existence checks.
 //
 // Returns:
 //    If the file exists in the path relative to the "base" directory within the
 //    single-file or on disk.
 
-bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle) const
+bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle, dir_listing_cache_t* listing_cache) const
 {
     pal::string_t& candidate = *str;
 
@@ -98,7 +148,8 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
     const pal::char_t* query_type = look_in_base ? _X("Local") : _X("Relative");
     if (search_options & deps_entry_t::search_options::file_existence)
     {
-        if (!pal::file_exists(candidate))
+        bool exists = listing_cache != nullptr ? listing_cache->file_exists(candidate) : pal::file_exists(candidate);
+        if (!exists)
         {
             trace::verbose(_X("    %s path query did not exist %s"), query_type, candidate.c_str());
             candidate.clear();
@@ -144,7 +195,7 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const
+bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, dir_listing_cache_t* listing_cache) const
 {
     pal::string_t ietf_dir;
 
@@ -169,7 +220,7 @@ bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, ui
 
     search_options |= deps_entry_t::search_options::look_in_base;
     search_options &= ~deps_entry_t::search_options::is_servicing;
-    return to_path(base, ietf_dir, str, search_options, found_in_bundle);
+    return to_path(base, ietf_dir, str, search_options, found_in_bundle, listing_cache);
 }
 
 // -----------------------------------------------------------------------------
@@ -184,11 +235,11 @@ bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, ui
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const
+bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, dir_listing_cache_t* listing_cache) const
 {
     bool found_in_bundle;
     search_options &= ~deps_entry_t::search_options::look_in_base;
-    bool result = to_path(base, _X(""), str, search_options, found_in_bundle);
+    bool result = to_path(base, _X(""), str, search_options, found_in_bundle, listing_cache);
     assert(!found_in_bundle);
     return result;
 }
@@ -205,7 +256,7 @@ bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, ui
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const
+bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, dir_listing_cache_t* listing_cache) const
 {
     str->clear();
 
@@ -228,5 +279,5 @@ bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, u
     }
 
     search_options &= ~deps_entry_t::search_options::look_in_bundle;
-    return to_rel_path(new_base, str, search_options);
+    return to_rel_path(new_base, str, search_options, listing_cache);
 }
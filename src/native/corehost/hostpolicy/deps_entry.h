@@ -7,9 +7,31 @@
 #include <iostream>
 #include <array>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include "pal.h"
 #include "version.h"
 
+// Answers file existence queries for probe candidates from a single listing of each probed
+// directory instead of a stat per candidate.
+class dir_listing_cache_t
+{
+public:
+    bool file_exists(const pal::string_t& path);
+
+private:
+    struct listing_t
+    {
+        bool enumerated = false;
+        uint32_t queries = 0;
+        std::unordered_set<pal::string_t> names;
+        std::unordered_set<pal::string_t> lower_names;
+    };
+
+    // Keyed on the directory path without a trailing separator.
+    std::unordered_map<pal::string_t, listing_t> m_listings;
+};
+
 struct deps_asset_t
 {
     deps_asset_t() : deps_asset_t(_X(""), _X(""), version_t(), version_t()) { }
@@ -61,19 +83,19 @@ struct deps_entry_t
     bool is_rid_specific;
 
     // Given a "base" dir, yield the file path within this directory or single-file bundle.
-    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const;
+    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, dir_listing_cache_t* listing_cache = nullptr) const;
 
     // Given a "base" dir, yield the relative path in the package layout or servicing directory.
-    bool to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const;
+    bool to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, dir_listing_cache_t* listing_cache = nullptr) const;
 
     // Given a "base" dir, yield the relative path with package name/version in the package layout or servicing location.
-    bool to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const;
+    bool to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, dir_listing_cache_t* listing_cache = nullptr) const;
 
 private:
     // Given a "base" dir, yield the filepath within this directory or relative to this directory based on "look_in_base"
     // flag in "search_options".
     // Returns a path within the single-file bundle, or a file on disk,
-    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle) const;
+    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle, dir_listing_cache_t* listing_cache) const;
 
 };
 
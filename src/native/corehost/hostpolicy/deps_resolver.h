@@ -256,6 +256,9 @@ private:
 
     // File existence checks must be performed for probed paths.This will cause symlinks to be resolved.
     bool m_needs_file_existence_checks;
+
+    // Directory listings used to answer those file existence checks.
+    dir_listing_cache_t m_dir_listing_cache;
 };
 
 #endif // DEPS_RESOLVER_H
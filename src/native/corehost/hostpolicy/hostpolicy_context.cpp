@@ -52,11 +52,14 @@ namespace
     extern "C" const void* SystemResolveDllImport(const char* name);
     extern "C" const void* CryptoResolveDllImport(const char* name);
     extern "C" const void* CryptoAppleResolveDllImport(const char* name);
+#endif
 
     // pinvoke_override:
-    // Check if given function belongs to one of statically linked libraries and return a pointer if found.
+    // Check if given function belongs to one of statically linked libraries or to a native library
+    // loaded from the single-file bundle, and return a pointer if found.
     const void* STDMETHODCALLTYPE pinvoke_override(const char* library_name, const char* entry_point_name)
     {
+#if defined(NATIVE_LIBS_EMBEDDED)
         // This function is only called with the library name specified for a p/invoke, not any variations.
         // It must handle exact matches to the names specified. See Interop.Libraries.cs for each platform.
 #if !defined(_WIN32)
@@ -101,10 +104,29 @@ namespace
             return CryptoAppleResolveDllImport(entry_point_name);
         }
 #endif
+#endif // NATIVE_LIBS_EMBEDDED
+
+        if (bundle::runner_t::app()->has_native_libraries_in_memory())
+        {
+            return bundle::runner_t::app()->resolve_native_import(library_name, entry_point_name);
+        }
 
         return nullptr;
     }
-#endif
+
+    bool HOST_CONTRACT_CALLTYPE get_trusted_platform_assemblies(
+        const host_runtime_tpa_entry** entries,
+        size_t* count,
+        void* contract_context)
+    {
+        const hostpolicy_context_t* context = static_cast<const hostpolicy_context_t*>(contract_context);
+        if (context->tpa_entries.empty())
+            return false;
+
+        *entries = context->tpa_entries.data();
+        *count = context->tpa_entries.size();
+        return true;
+    }
 
     size_t HOST_CONTRACT_CALLTYPE get_runtime_property(
         const char* key,
@@ -147,37 +169,19 @@ namespace
     }
 }
 
-bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_t &init)
-{
-    const auto &iter = std::find(init.cfg_keys.cbegin(), init.cfg_keys.cend(), _X("System.Runtime.Loader.UseRidGraph"));
-    if (iter != init.cfg_keys.cend())
-    {
-        size_t idx = iter - init.cfg_keys.cbegin();
-        return pal::strcasecmp(init.cfg_values[idx].data(), _X("true")) == 0;
-    }
-
-    // Reading the RID fallback graph is disabled by default
-    return false;
-}
-
-int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+int hostpolicy_context_t::resolve_dependencies(
+    const hostpolicy_init_t &hostpolicy_init,
+    const arguments_t &args,
+    const std::vector<pal::string_t> &shared_stores,
+    const deps_json_t::rid_resolution_options_t &rid_resolution_options,
+    startup_cache::resolved_t *resolved)
 {
-    application = args.managed_application;
-    host_mode = hostpolicy_init.host_mode;
-    host_path = hostpolicy_init.host_info.host_path;
-    breadcrumbs_enabled = enable_breadcrumbs;
-
-    deps_json_t::rid_resolution_options_t rid_resolution_options
-    {
-        should_read_rid_fallback_graph(hostpolicy_init),
-        nullptr, /*rid_fallback_graph*/
-    };
     deps_resolver_t resolver
     {
         args,
         hostpolicy_init.fx_definitions,
         hostpolicy_init.additional_deps_serialized.c_str(),
-        shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
+        shared_stores,
         hostpolicy_init.probe_paths,
         rid_resolution_options,
         hostpolicy_init.is_framework_dependent
@@ -190,8 +194,6 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         return StatusCode::ResolverInitFailure;
     }
 
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -202,19 +204,155 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
 
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, &breadcrumbs))
         {
             return StatusCode::ResolverResolveFailure;
         }
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, nullptr))
         {
             return StatusCode::ResolverResolveFailure;
         }
     }
 
+    if (resolver.is_framework_dependent())
+    {
+        // Use the root fx to define FX_DEPS_FILE
+        resolved->fx_deps_file = resolver.get_root_deps().get_deps_file();
+    }
+
+    pal::string_t& app_context_deps_str = resolved->app_context_deps_files;
+    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+    {
+        if (!app_context_deps_str.empty())
+            app_context_deps_str += _X(';');
+
+        // For the application's .deps.json if this is single file, 3.1 backward compat
+        // then the path used internally is the bundle path, but externally we need to report
+        // the path to the extraction folder.
+        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+        {
+            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+            append_path(&deps_path, get_filename(deps_file).c_str());
+            app_context_deps_str += deps_path;
+        }
+        else
+        {
+            app_context_deps_str += deps_file;
+        }
+    });
+
+    resolver.get_app_dir(&resolved->app_base);
+    resolved->probing_directories = resolver.get_lookup_probe_directories();
+    return StatusCode::Success;
+}
+
+// Split the TPA list into (simple name, path) pairs the same way the runtime's binder would, so that the
+// runtime can populate its TPA map without re-parsing the property. If any entry is not something the
+// table can represent (relative path, native image, unknown extension), no table is built and the
+// runtime falls back to parsing the property, reporting errors as it always has.
+void hostpolicy_context_t::build_tpa_table(const pal::string_t &tpa)
+{
+    tpa_strings.clear();
+    tpa_entries.clear();
+
+    std::vector<std::pair<size_t, size_t>> offsets;
+    std::unordered_set<pal::string_t> seen_names;
+    std::vector<char> utf8;
+
+    pal::string_t path;
+    pal::stringstream_t ss(tpa);
+    while (std::getline(ss, path, PATH_SEPARATOR))
+    {
+        if (path.empty())
+            continue;
+
+        if (!pal::is_path_fully_qualified(path))
+            return;
+
+        pal::string_t file_name = get_filename(path);
+        if (utils::ends_with(file_name, _X(".ni.dll"), false) || utils::ends_with(file_name, _X(".ni.exe"), false))
+            return;
+
+        if (!utils::ends_with(file_name, _X(".dll"), false) && !utils::ends_with(file_name, _X(".exe"), false))
+            return;
+
+        // Simple names differing only in case refer to the same assembly; the first one wins.
+        pal::string_t simple_name = file_name.substr(0, file_name.length() - STRING_LENGTH(".dll"));
+        if (!seen_names.insert(to_lower(simple_name.c_str())).second)
+            continue;
+
+        size_t name_offset = tpa_strings.size();
+        if (!pal::pal_utf8string(simple_name, &utf8))
+            return;
+
+        tpa_strings.insert(tpa_strings.end(), utf8.begin(), utf8.end());
+
+        size_t path_offset = tpa_strings.size();
+        if (!pal::pal_utf8string(path, &utf8))
+            return;
+
+        tpa_strings.insert(tpa_strings.end(), utf8.begin(), utf8.end());
+        offsets.push_back(std::make_pair(name_offset, path_offset));
+    }
+
+    // Only take pointers once the string buffer has stopped growing.
+    tpa_entries.reserve(offsets.size());
+    for (const auto& offset : offsets)
+    {
+        tpa_entries.push_back({ &tpa_strings[offset.first], &tpa_strings[offset.second] });
+    }
+}
+
+bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_t &init)
+{
+    const auto &iter = std::find(init.cfg_keys.cbegin(), init.cfg_keys.cend(), _X("System.Runtime.Loader.UseRidGraph"));
+    if (iter != init.cfg_keys.cend())
+    {
+        size_t idx = iter - init.cfg_keys.cbegin();
+        return pal::strcasecmp(init.cfg_values[idx].data(), _X("true")) == 0;
+    }
+
+    // Reading the RID fallback graph is disabled by default
+    return false;
+}
+
+int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+{
+    application = args.managed_application;
+    host_mode = hostpolicy_init.host_mode;
+    host_path = hostpolicy_init.host_info.host_path;
+    breadcrumbs_enabled = enable_breadcrumbs;
+
+    deps_json_t::rid_resolution_options_t rid_resolution_options
+    {
+        should_read_rid_fallback_graph(hostpolicy_init),
+        nullptr, /*rid_fallback_graph*/
+    };
+    std::vector<pal::string_t> shared_stores = shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path);
+
+    trace::timing_scope_t resolve_timing{_X("deps_resolve")};
+
+    // Breadcrumbs are a by-product of probing, so the cache cannot be used when they are needed.
+    startup_cache::cache_t cache;
+    bool use_cache = !breadcrumbs_enabled && cache.init(hostpolicy_init, args, shared_stores, rid_resolution_options.use_fallback_graph);
+
+    startup_cache::resolved_t resolved;
+    if (!use_cache || !cache.try_read(&resolved))
+    {
+        int rc = resolve_dependencies(hostpolicy_init, args, shared_stores, rid_resolution_options, &resolved);
+        if (rc != StatusCode::Success)
+            return rc;
+
+        if (use_cache)
+            cache.write(resolved);
+    }
+
+    resolve_timing.end();
+    probe_paths_t& probe_paths = resolved.probe_paths;
+
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::fullpath(&clr_path))
     {
@@ -254,44 +392,15 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    build_tpa_table(probe_paths.tpa);
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
-    coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextBaseDirectory, resolved.app_base.c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolved.app_context_deps_files.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolved.fx_deps_file.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolved.probing_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_runtime_id().c_str());
 
     bool set_app_paths = false;
@@ -318,7 +427,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
     // and that could indicate the app paths shouldn't be set.
     if (set_app_paths)
     {
-        if (!coreclr_properties.add(common_property::AppPaths, app_base.c_str()))
+        if (!coreclr_properties.add(common_property::AppPaths, resolved.app_base.c_str()))
         {
             log_duplicate_property_error(coreclr_property_bag_t::common_property_to_string(common_property::AppPaths));
             return StatusCode::LibHostDuplicateProperty;
@@ -348,10 +457,16 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
             host_contract.bundle_probe = &bundle_probe;
 #if defined(NATIVE_LIBS_EMBEDDED)
             host_contract.pinvoke_override = &pinvoke_override;
+#else
+            if (bundle::runner_t::app()->has_native_libraries_in_memory())
+            {
+                host_contract.pinvoke_override = &pinvoke_override;
+            }
 #endif
         }
 
         host_contract.get_runtime_property = &get_runtime_property;
+        host_contract.get_trusted_platform_assemblies = &get_trusted_platform_assemblies;
         pal::char_t buffer[STRING_LENGTH("0xffffffffffffffff")];
         pal::snwprintf(buffer, ARRAY_SIZE(buffer), _X("0x%zx"), (size_t)(&host_contract));
         if (!coreclr_properties.add(_STRINGIFY(HOST_PROPERTY_RUNTIME_CONTRACT), buffer))
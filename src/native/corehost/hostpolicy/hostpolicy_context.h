@@ -11,6 +11,7 @@
 #include <corehost_context_contract.h>
 #include <host_runtime_contract.h>
 #include "hostpolicy_init.h"
+#include "startup_cache.h"
 
 struct hostpolicy_context_t
 {
@@ -30,10 +31,25 @@ public:
 
     host_runtime_contract host_contract;
 
+    // Trusted platform assemblies handed to the runtime through the host contract.
+    // Entries point into tpa_strings, which holds the UTF-8 names and paths.
+    std::vector<char> tpa_strings;
+    std::vector<host_runtime_tpa_entry> tpa_entries;
+
     int initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs);
 
 public: // static
     static bool should_read_rid_fallback_graph(const hostpolicy_init_t &init);
+
+private:
+    int resolve_dependencies(
+        const hostpolicy_init_t &hostpolicy_init,
+        const arguments_t &args,
+        const std::vector<pal::string_t> &shared_stores,
+        const deps_json_t::rid_resolution_options_t &rid_resolution_options,
+        startup_cache::resolved_t *resolved);
+
+    void build_tpa_table(const pal::string_t &tpa);
 };
 
 #endif // __HOSTPOLICY_CONTEXT_H__
@@ -0,0 +1,374 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache.h"
+#include <cstring>
+#include <set>
+#include <trace.h>
+#include <utils.h>
+#include "bundle/info.h"
+
+#define HOST_RESOLUTION_CACHE_ENV _X("DOTNET_HOST_RESOLUTION_CACHE")
+
+namespace
+{
+    // 'DHRC'
+    const uint32_t cache_magic = 0x43524844;
+
+    // Bump whenever the layout of the cache file or the set of key inputs changes.
+    const uint32_t cache_format_version = 1;
+
+    // Stamp recorded for inputs that did not exist when the entry was written.
+    const int64_t missing_stamp = -1;
+
+    class reader_t
+    {
+    public:
+        reader_t(const uint8_t* data, size_t length)
+            : m_cur(data)
+            , m_end(data + length) { }
+
+        bool read(void* dest, size_t size)
+        {
+            if (static_cast<size_t>(m_end - m_cur) < size)
+                return false;
+
+            memcpy(dest, m_cur, size);
+            m_cur += size;
+            return true;
+        }
+
+        bool read_string(pal::string_t* value)
+        {
+            uint32_t length;
+            if (!read(&length, sizeof(length)))
+                return false;
+
+            size_t size = static_cast<size_t>(length) * sizeof(pal::char_t);
+            if (static_cast<size_t>(m_end - m_cur) < size)
+                return false;
+
+            // The mapping may not be aligned for pal::char_t, so copy through the byte view.
+            value->resize(length);
+            if (length > 0)
+                memcpy(&(*value)[0], m_cur, size);
+
+            m_cur += size;
+            return true;
+        }
+
+        bool at_end() const { return m_cur == m_end; }
+
+    private:
+        const uint8_t* m_cur;
+        const uint8_t* m_end;
+    };
+
+    class writer_t
+    {
+    public:
+        void write(const void* src, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(src);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        }
+
+        void write_string(const pal::string_t& value)
+        {
+            uint32_t length = static_cast<uint32_t>(value.size());
+            write(&length, sizeof(length));
+            write(value.data(), value.size() * sizeof(pal::char_t));
+        }
+
+        const std::vector<uint8_t>& buffer() const { return m_buffer; }
+
+    private:
+        std::vector<uint8_t> m_buffer;
+    };
+
+    void get_stamp(const pal::string_t& path, int64_t* last_write_time, int64_t* size)
+    {
+        if (!pal::get_file_stamp(path, last_write_time, size))
+        {
+            *last_write_time = missing_stamp;
+            *size = missing_stamp;
+        }
+    }
+
+    void add_directories(const pal::string_t& paths, bool paths_are_files, std::set<pal::string_t>* dirs)
+    {
+        pal::string_t tok;
+        pal::stringstream_t ss(paths);
+        while (std::getline(ss, tok, PATH_SEPARATOR))
+        {
+            if (tok.empty())
+                continue;
+
+            pal::string_t dir = paths_are_files ? get_directory(tok) : tok;
+            remove_trailing_dir_separator(&dir);
+            if (!dir.empty())
+                dirs->insert(dir);
+        }
+    }
+
+    // Directories whose contents were probed to produce 'resolved'. Adding or removing a file in any
+    // of them updates the directory's last write time, which invalidates the entry.
+    std::set<pal::string_t> get_asset_directories(const startup_cache::resolved_t& resolved)
+    {
+        std::set<pal::string_t> dirs;
+        add_directories(resolved.probe_paths.tpa, true, &dirs);
+        add_directories(resolved.probe_paths.native, false, &dirs);
+        add_directories(resolved.probe_paths.resources, false, &dirs);
+        if (!resolved.probe_paths.coreclr.empty())
+            add_directories(resolved.probe_paths.coreclr, true, &dirs);
+
+        if (!resolved.app_base.empty())
+            add_directories(resolved.app_base, false, &dirs);
+
+        return dirs;
+    }
+
+    uint64_t hash_key(const std::vector<pal::string_t>& key)
+    {
+        // FNV-1a over the key strings, each followed by a null so that adjacent values cannot alias.
+        uint64_t hash = 14695981039346656037ULL;
+        for (const pal::string_t& value : key)
+        {
+            for (pal::char_t c : value)
+            {
+                hash ^= static_cast<uint64_t>(c);
+                hash *= 1099511628211ULL;
+            }
+
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    bool read_entry(
+        const uint8_t* data,
+        size_t length,
+        const std::vector<pal::string_t>& expected_key,
+        startup_cache::resolved_t* resolved)
+    {
+        reader_t reader(data, length);
+
+        uint32_t magic;
+        uint32_t version;
+        if (!reader.read(&magic, sizeof(magic)) || magic != cache_magic
+            || !reader.read(&version, sizeof(version)) || version != cache_format_version)
+        {
+            trace::verbose(_X("Host resolution cache entry has an unrecognized format"));
+            return false;
+        }
+
+        uint32_t key_count;
+        if (!reader.read(&key_count, sizeof(key_count)) || key_count != expected_key.size())
+            return false;
+
+        pal::string_t value;
+        for (const pal::string_t& expected : expected_key)
+        {
+            if (!reader.read_string(&value) || value != expected)
+            {
+                trace::verbose(_X("Host resolution cache entry was written for different inputs"));
+                return false;
+            }
+        }
+
+        uint32_t stamp_count;
+        if (!reader.read(&stamp_count, sizeof(stamp_count)))
+            return false;
+
+        for (uint32_t i = 0; i < stamp_count; ++i)
+        {
+            int64_t cached_time;
+            int64_t cached_size;
+            if (!reader.read_string(&value)
+                || !reader.read(&cached_time, sizeof(cached_time))
+                || !reader.read(&cached_size, sizeof(cached_size)))
+            {
+                return false;
+            }
+
+            int64_t time;
+            int64_t size;
+            get_stamp(value, &time, &size);
+            if (time != cached_time || size != cached_size)
+            {
+                trace::verbose(_X("Host resolution cache entry is stale: [%s] has changed"), value.c_str());
+                return false;
+            }
+        }
+
+        return reader.read_string(&resolved->probe_paths.tpa)
+            && reader.read_string(&resolved->probe_paths.native)
+            && reader.read_string(&resolved->probe_paths.resources)
+            && reader.read_string(&resolved->probe_paths.coreclr)
+            && reader.read_string(&resolved->app_base)
+            && reader.read_string(&resolved->fx_deps_file)
+            && reader.read_string(&resolved->app_context_deps_files)
+            && reader.read_string(&resolved->probing_directories)
+            && reader.at_end();
+    }
+}
+
+bool startup_cache::cache_t::init(
+    const hostpolicy_init_t& hostpolicy_init,
+    const arguments_t& args,
+    const std::vector<pal::string_t>& shared_stores,
+    bool use_rid_fallback_graph)
+{
+    pal::string_t cache_dir;
+    if (!pal::getenv(HOST_RESOLUTION_CACHE_ENV, &cache_dir) || cache_dir.empty())
+        return false;
+
+    // Single-file bundles resolve against the bundle manifest and additional deps can
+    // pull in arbitrary files, neither of which is covered by the validation below.
+    if (bundle::info_t::is_single_file_bundle())
+    {
+        trace::verbose(_X("Host resolution cache is not used for single-file bundles"));
+        return false;
+    }
+
+    if (!hostpolicy_init.additional_deps_serialized.empty())
+    {
+        trace::verbose(_X("Host resolution cache is not used when additional deps are specified"));
+        return false;
+    }
+
+    if (!pal::fullpath(&cache_dir, true) || !pal::is_directory(cache_dir))
+    {
+        trace::verbose(_X("Host resolution cache directory [%s] (%s) does not exist"), cache_dir.c_str(), HOST_RESOLUTION_CACHE_ENV);
+        return false;
+    }
+
+    m_key.push_back(_STRINGIFY(HOST_VERSION));
+    m_key.push_back(pal::to_string(static_cast<int>(args.host_mode)));
+    m_key.push_back(args.managed_application);
+    m_key.push_back(args.app_root);
+    m_key.push_back(args.deps_path);
+    m_key.push_back(get_runtime_id());
+    m_key.push_back(use_rid_fallback_graph ? _X("1") : _X("0"));
+    m_key.push_back(hostpolicy_init.is_framework_dependent ? _X("1") : _X("0"));
+
+    pal::string_t servicing;
+    pal::get_default_servicing_directory(&servicing);
+    m_key.push_back(servicing);
+
+    m_key.push_back(pal::to_string(static_cast<int>(shared_stores.size())));
+    m_key.insert(m_key.end(), shared_stores.cbegin(), shared_stores.cend());
+    m_key.push_back(pal::to_string(static_cast<int>(hostpolicy_init.probe_paths.size())));
+    m_key.insert(m_key.end(), hostpolicy_init.probe_paths.cbegin(), hostpolicy_init.probe_paths.cend());
+
+    const fx_definition_vector_t& fx_definitions = hostpolicy_init.fx_definitions;
+    m_key.push_back(pal::to_string(static_cast<int>(fx_definitions.size())));
+    for (size_t i = 0; i < fx_definitions.size(); ++i)
+    {
+        m_key.push_back(fx_definitions[i]->get_name());
+        m_key.push_back(fx_definitions[i]->get_found_version());
+        m_key.push_back(fx_definitions[i]->get_dir());
+
+        m_deps_files.push_back(i == 0
+            ? args.deps_path
+            : deps_resolver_t::get_fx_deps(fx_definitions[i]->get_dir(), fx_definitions[i]->get_name()));
+    }
+
+    pal::stringstream_t file_name;
+    file_name << get_filename(args.managed_application) << _X('.') << std::hex << hash_key(m_key) << _X(".cache");
+
+    m_cache_path = cache_dir;
+    append_path(&m_cache_path, file_name.str().c_str());
+    return true;
+}
+
+bool startup_cache::cache_t::try_read(startup_cache::resolved_t* resolved) const
+{
+    if (!pal::file_exists(m_cache_path))
+    {
+        trace::verbose(_X("Host resolution cache entry [%s] does not exist"), m_cache_path.c_str());
+        return false;
+    }
+
+    size_t length;
+    const void* data = pal::mmap_read(m_cache_path, &length);
+    if (data == nullptr)
+        return false;
+
+    resolved_t cached;
+    bool valid = read_entry(static_cast<const uint8_t*>(data), length, m_key, &cached);
+    pal::munmap(const_cast<void*>(data), length);
+    if (!valid)
+        return false;
+
+    trace::verbose(_X("Using host resolution cache entry [%s]"), m_cache_path.c_str());
+    *resolved = std::move(cached);
+    return true;
+}
+
+void startup_cache::cache_t::write(const startup_cache::resolved_t& resolved) const
+{
+    writer_t writer;
+    writer.write(&cache_magic, sizeof(cache_magic));
+    writer.write(&cache_format_version, sizeof(cache_format_version));
+
+    uint32_t key_count = static_cast<uint32_t>(m_key.size());
+    writer.write(&key_count, sizeof(key_count));
+    for (const pal::string_t& value : m_key)
+        writer.write_string(value);
+
+    std::vector<pal::string_t> stamped(m_deps_files);
+    std::set<pal::string_t> dirs = get_asset_directories(resolved);
+    stamped.insert(stamped.end(), dirs.cbegin(), dirs.cend());
+
+    uint32_t stamp_count = static_cast<uint32_t>(stamped.size());
+    writer.write(&stamp_count, sizeof(stamp_count));
+    for (const pal::string_t& path : stamped)
+    {
+        int64_t time;
+        int64_t size;
+        get_stamp(path, &time, &size);
+        writer.write_string(path);
+        writer.write(&time, sizeof(time));
+        writer.write(&size, sizeof(size));
+    }
+
+    writer.write_string(resolved.probe_paths.tpa);
+    writer.write_string(resolved.probe_paths.native);
+    writer.write_string(resolved.probe_paths.resources);
+    writer.write_string(resolved.probe_paths.coreclr);
+    writer.write_string(resolved.app_base);
+    writer.write_string(resolved.fx_deps_file);
+    writer.write_string(resolved.app_context_deps_files);
+    writer.write_string(resolved.probing_directories);
+
+    // Write to a process-specific file and move it into place so concurrent readers
+    // never observe a partially written entry.
+    pal::string_t temp_path = m_cache_path + _X(".") + pal::to_string(pal::get_pid()) + _X(".tmp");
+    FILE* file = pal::file_open(temp_path, _X("wb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Failed to create host resolution cache entry [%s]"), temp_path.c_str());
+        return;
+    }
+
+    const std::vector<uint8_t>& buffer = writer.buffer();
+    bool written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+    written = (fclose(file) == 0) && written;
+
+#if defined(_WIN32)
+    // rename does not replace an existing file on Windows
+    if (written)
+        (void)pal::remove(m_cache_path.c_str());
+#endif
+
+    if (!written || pal::rename(temp_path.c_str(), m_cache_path.c_str()) != 0)
+    {
+        trace::verbose(_X("Failed to write host resolution cache entry [%s]"), m_cache_path.c_str());
+        (void)pal::remove(temp_path.c_str());
+        return;
+    }
+
+    trace::verbose(_X("Wrote host resolution cache entry [%s]"), m_cache_path.c_str());
+}
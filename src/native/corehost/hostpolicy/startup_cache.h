@@ -0,0 +1,50 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef STARTUP_CACHE_H
+#define STARTUP_CACHE_H
+
+#include <pal.h>
+#include "args.h"
+#include "deps_resolver.h"
+#include "hostpolicy_init.h"
+
+namespace startup_cache
+{
+    // Results of dependency resolution that are persisted across runs.
+    struct resolved_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t app_base;
+        pal::string_t fx_deps_file;
+        pal::string_t app_context_deps_files;
+        pal::string_t probing_directories;
+    };
+
+    // Opt-in binary cache of the resolved TPA list, native search paths and probe results.
+    //
+    // The cache is enabled by pointing DOTNET_HOST_RESOLUTION_CACHE at an existing directory.
+    // Entries are keyed on everything that feeds dependency resolution (host version, app, RID,
+    // frameworks, probe paths) and are validated on read against the last write time and size of
+    // every deps file and of every directory that contributed assets, so a stale entry is never used.
+    class cache_t
+    {
+    public:
+        // Returns false if the cache is disabled or cannot be used for this activation.
+        bool init(
+            const hostpolicy_init_t& hostpolicy_init,
+            const arguments_t& args,
+            const std::vector<pal::string_t>& shared_stores,
+            bool use_rid_fallback_graph);
+
+        bool try_read(resolved_t* resolved) const;
+        void write(const resolved_t& resolved) const;
+
+    private:
+        pal::string_t m_cache_path;
+        std::vector<pal::string_t> m_key;
+        std::vector<pal::string_t> m_deps_files;
+    };
+}
+
+#endif // STARTUP_CACHE_H
@@ -26,6 +26,28 @@ process_info_payload_flatten (
 	uint8_t **buffer,
 	uint16_t *size);
 
+static
+uint16_t
+runtime_metrics_payload_get_size (DiagnosticsRuntimeMetricsPayload *payload);
+
+static
+bool
+runtime_metrics_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size);
+
+static
+uint16_t
+startup_phases_payload_get_size (DiagnosticsStartupPhasesPayload *payload);
+
+static
+bool
+startup_phases_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size);
+
 static
 uint16_t
 env_info_payload_get_size (DiagnosticsEnvironmentInfoPayload *payload);
@@ -71,6 +93,18 @@ process_protocol_helper_get_process_env (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+bool
+process_protocol_helper_get_runtime_metrics (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
+static
+bool
+process_protocol_helper_get_startup_phases (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 static
 bool
 process_protocol_helper_resume_runtime_startup (
@@ -517,6 +551,165 @@ ds_process_info_3_payload_fini (DiagnosticsProcessInfo3Payload *payload)
 	;
 }
 
+/*
+ * DiagnosticsRuntimeMetricsPayload.
+ */
+
+static
+uint16_t
+runtime_metrics_payload_get_size (DiagnosticsRuntimeMetricsPayload *payload)
+{
+	// uint32_t Version;                  -> 4 bytes
+	// uint64_t GenerationSizes[5];       -> 40 bytes
+	// uint64_t GCCounts[3];              -> 24 bytes
+	// uint64_t GCTotalPauseDuration;     -> 8 bytes
+	// uint64_t JitMethodCount;           -> 8 bytes
+	// uint64_t JitTime;                  -> 8 bytes
+	// uint64_t LockContentionCount;      -> 8 bytes
+
+	EP_ASSERT (payload != NULL);
+
+	size_t size = 0;
+	size += sizeof (payload->version);
+	size += sizeof (payload->generation_sizes);
+	size += sizeof (payload->gc_counts);
+	size += sizeof (payload->gc_total_pause_duration);
+	size += sizeof (payload->jit_method_count);
+	size += sizeof (payload->jit_time);
+	size += sizeof (payload->lock_contention_count);
+
+	EP_ASSERT (size <= UINT16_MAX);
+	return (uint16_t)size;
+}
+
+static
+inline
+void
+runtime_metrics_payload_write (
+	uint8_t **buffer,
+	uint16_t *size,
+	const void *value,
+	size_t value_size)
+{
+	memcpy (*buffer, value, value_size);
+	*buffer += value_size;
+	*size -= (uint16_t)value_size;
+}
+
+static
+bool
+runtime_metrics_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size)
+{
+	DiagnosticsRuntimeMetricsPayload *metrics = (DiagnosticsRuntimeMetricsPayload *)payload;
+
+	EP_ASSERT (payload != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (*buffer != NULL);
+	EP_ASSERT (size != NULL);
+	EP_ASSERT (runtime_metrics_payload_get_size (metrics) == *size);
+
+	runtime_metrics_payload_write (buffer, size, &metrics->version, sizeof (metrics->version));
+	runtime_metrics_payload_write (buffer, size, metrics->generation_sizes, sizeof (metrics->generation_sizes));
+	runtime_metrics_payload_write (buffer, size, metrics->gc_counts, sizeof (metrics->gc_counts));
+	runtime_metrics_payload_write (buffer, size, &metrics->gc_total_pause_duration, sizeof (metrics->gc_total_pause_duration));
+	runtime_metrics_payload_write (buffer, size, &metrics->jit_method_count, sizeof (metrics->jit_method_count));
+	runtime_metrics_payload_write (buffer, size, &metrics->jit_time, sizeof (metrics->jit_time));
+	runtime_metrics_payload_write (buffer, size, &metrics->lock_contention_count, sizeof (metrics->lock_contention_count));
+
+	// Assert we've used the whole buffer we were given
+	EP_ASSERT (*size == 0);
+
+	return true;
+}
+
+DiagnosticsRuntimeMetricsPayload *
+ds_runtime_metrics_payload_init (DiagnosticsRuntimeMetricsPayload *payload)
+{
+	ep_return_null_if_nok (payload != NULL);
+
+	// As with ProcessInfo3, new counters are only ever appended and the version is
+	// incremented, so clients know which fields to expect.
+	memset (payload, 0, sizeof (*payload));
+	payload->version = 1;
+
+	return payload;
+}
+
+void
+ds_runtime_metrics_payload_fini (DiagnosticsRuntimeMetricsPayload *payload)
+{
+	;
+}
+
+/*
+ * DiagnosticsStartupPhasesPayload.
+ */
+
+static
+uint16_t
+startup_phases_payload_get_size (DiagnosticsStartupPhasesPayload *payload)
+{
+	// uint32_t Version;                  -> 4 bytes
+	// uint32_t PhaseCount;               -> 4 bytes
+	// uint64_t PhaseDurations[];         -> PhaseCount * 8 bytes
+
+	EP_ASSERT (payload != NULL);
+	EP_ASSERT (payload->phase_count <= DS_STARTUP_PHASES_MAX_COUNT);
+
+	size_t size = 0;
+	size += sizeof (payload->version);
+	size += sizeof (payload->phase_count);
+	size += payload->phase_count * sizeof (payload->phase_durations [0]);
+
+	EP_ASSERT (size <= UINT16_MAX);
+	return (uint16_t)size;
+}
+
+static
+bool
+startup_phases_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size)
+{
+	DiagnosticsStartupPhasesPayload *phases = (DiagnosticsStartupPhasesPayload *)payload;
+
+	EP_ASSERT (payload != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (*buffer != NULL);
+	EP_ASSERT (size != NULL);
+	EP_ASSERT (startup_phases_payload_get_size (phases) == *size);
+
+	runtime_metrics_payload_write (buffer, size, &phases->version, sizeof (phases->version));
+	runtime_metrics_payload_write (buffer, size, &phases->phase_count, sizeof (phases->phase_count));
+	runtime_metrics_payload_write (buffer, size, phases->phase_durations, phases->phase_count * sizeof (phases->phase_durations [0]));
+
+	// Assert we've used the whole buffer we were given
+	EP_ASSERT (*size == 0);
+
+	return true;
+}
+
+DiagnosticsStartupPhasesPayload *
+ds_startup_phases_payload_init (DiagnosticsStartupPhasesPayload *payload)
+{
+	ep_return_null_if_nok (payload != NULL);
+
+	memset (payload, 0, sizeof (*payload));
+	payload->version = 1;
+
+	return payload;
+}
+
+void
+ds_startup_phases_payload_fini (DiagnosticsStartupPhasesPayload *payload)
+{
+	;
+}
+
 
 /*
  * DiagnosticsEnvironmentInfoPayload.
@@ -901,6 +1094,103 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+process_protocol_helper_get_runtime_metrics (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+	DiagnosticsRuntimeMetricsPayload payload;
+	DiagnosticsRuntimeMetricsPayload *runtime_metrics_payload = NULL;
+	ds_ipc_result_t ipc_result = DS_IPC_S_OK;
+
+	runtime_metrics_payload = ds_runtime_metrics_payload_init (&payload);
+	ep_raise_error_if_nok (runtime_metrics_payload != NULL);
+
+	// Counters are read straight from runtime state, no session is needed to observe them.
+	ipc_result = ds_rt_get_runtime_metrics (
+		runtime_metrics_payload->generation_sizes,
+		runtime_metrics_payload->gc_counts,
+		&runtime_metrics_payload->gc_total_pause_duration,
+		&runtime_metrics_payload->jit_method_count,
+		&runtime_metrics_payload->jit_time,
+		&runtime_metrics_payload->lock_contention_count);
+	ep_raise_error_if_nok (ipc_result == DS_IPC_S_OK);
+
+	ep_raise_error_if_nok (ds_ipc_message_initialize_buffer (
+		message,
+		ds_ipc_header_get_generic_success (),
+		(void *)runtime_metrics_payload,
+		runtime_metrics_payload_get_size (runtime_metrics_payload),
+		runtime_metrics_payload_flatten));
+
+	ep_raise_error_if_nok (ds_ipc_message_send (message, stream));
+
+	result = true;
+
+ep_on_exit:
+	ds_runtime_metrics_payload_fini (runtime_metrics_payload);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ds_ipc_message_send_error (stream, ipc_result != DS_IPC_S_OK ? ipc_result : DS_IPC_E_FAIL);
+	DS_LOG_WARNING_0 ("Failed to send DiagnosticsIPC response");
+	ep_exit_error_handler ();
+}
+
+static
+bool
+process_protocol_helper_get_startup_phases (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+	DiagnosticsStartupPhasesPayload payload;
+	DiagnosticsStartupPhasesPayload *startup_phases_payload = NULL;
+	ds_ipc_result_t ipc_result = DS_IPC_S_OK;
+
+	startup_phases_payload = ds_startup_phases_payload_init (&payload);
+	ep_raise_error_if_nok (startup_phases_payload != NULL);
+
+	// Phase names are not sent, clients map the index to the phase order the runtime documents.
+	ipc_result = ds_rt_get_startup_phases (
+		startup_phases_payload->phase_durations,
+		DS_STARTUP_PHASES_MAX_COUNT,
+		&startup_phases_payload->phase_count);
+	ep_raise_error_if_nok (ipc_result == DS_IPC_S_OK);
+
+	ep_raise_error_if_nok (ds_ipc_message_initialize_buffer (
+		message,
+		ds_ipc_header_get_generic_success (),
+		(void *)startup_phases_payload,
+		startup_phases_payload_get_size (startup_phases_payload),
+		startup_phases_payload_flatten));
+
+	ep_raise_error_if_nok (ds_ipc_message_send (message, stream));
+
+	result = true;
+
+ep_on_exit:
+	ds_startup_phases_payload_fini (startup_phases_payload);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ds_ipc_message_send_error (stream, ipc_result != DS_IPC_S_OK ? ipc_result : DS_IPC_E_FAIL);
+	DS_LOG_WARNING_0 ("Failed to send DiagnosticsIPC response");
+	ep_exit_error_handler ();
+}
+
 static
 bool
 process_protocol_helper_resume_runtime_startup (
@@ -1253,6 +1543,12 @@ ds_process_protocol_helper_handle_ipc_message (
 	case DS_PROCESS_COMMANDID_GET_PROCESS_INFO_3:
 		result = process_protocol_helper_get_process_info_3 (message, stream);
 		break;
+	case DS_PROCESS_COMMANDID_GET_RUNTIME_METRICS:
+		result = process_protocol_helper_get_runtime_metrics (message, stream);
+		break;
+	case DS_PROCESS_COMMANDID_GET_STARTUP_PHASES:
+		result = process_protocol_helper_get_startup_phases (message, stream);
+		break;
 	default:
 		result = process_protocol_helper_unknown_command (message, stream);
 		break;
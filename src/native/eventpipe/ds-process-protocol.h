@@ -150,6 +150,70 @@ ds_process_info_3_payload_init (
 void
 ds_process_info_3_payload_fini (DiagnosticsProcessInfo3Payload *payload);
 
+/*
+* DiagnosticsRuntimeMetricsPayload
+*/
+
+// Generation sizes are reported for gen0, gen1, gen2, LOH and POH, collection counts for gen0, gen1 and gen2.
+#define DS_RUNTIME_METRICS_HEAP_GENERATION_COUNT 5
+#define DS_RUNTIME_METRICS_GC_GENERATION_COUNT 3
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsRuntimeMetricsPayload {
+#else
+struct _DiagnosticsRuntimeMetricsPayload_Internal {
+#endif
+	uint32_t version;
+	uint64_t generation_sizes [DS_RUNTIME_METRICS_HEAP_GENERATION_COUNT];
+	uint64_t gc_counts [DS_RUNTIME_METRICS_GC_GENERATION_COUNT];
+	uint64_t gc_total_pause_duration;
+	uint64_t jit_method_count;
+	uint64_t jit_time;
+	uint64_t lock_contention_count;
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsRuntimeMetricsPayload {
+	uint8_t _internal [sizeof (struct _DiagnosticsRuntimeMetricsPayload_Internal)];
+};
+#endif
+
+DiagnosticsRuntimeMetricsPayload *
+ds_runtime_metrics_payload_init (DiagnosticsRuntimeMetricsPayload *payload);
+
+void
+ds_runtime_metrics_payload_fini (DiagnosticsRuntimeMetricsPayload *payload);
+
+/*
+* DiagnosticsStartupPhasesPayload
+*/
+
+// Upper bound on the number of startup phases a runtime can report.
+#define DS_STARTUP_PHASES_MAX_COUNT 32
+
+#if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsStartupPhasesPayload {
+#else
+struct _DiagnosticsStartupPhasesPayload_Internal {
+#endif
+	uint32_t version;
+	uint32_t phase_count;
+	// Only the first phase_count entries are sent.
+	uint64_t phase_durations [DS_STARTUP_PHASES_MAX_COUNT];
+};
+
+#if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_PROCESS_PROTOCOL_GETTER_SETTER)
+struct _DiagnosticsStartupPhasesPayload {
+	uint8_t _internal [sizeof (struct _DiagnosticsStartupPhasesPayload_Internal)];
+};
+#endif
+
+DiagnosticsStartupPhasesPayload *
+ds_startup_phases_payload_init (DiagnosticsStartupPhasesPayload *payload);
+
+void
+ds_startup_phases_payload_fini (DiagnosticsStartupPhasesPayload *payload);
+
 /*
 * DiagnosticsEnvironmentInfoPayload
 */
@@ -124,6 +124,35 @@ static
 uint32_t
 ds_rt_apply_startup_hook (const ep_char16_t *startup_hook_path);
 
+/*
+* Runtime metrics
+*/
+
+// generation_sizes holds DS_RUNTIME_METRICS_HEAP_GENERATION_COUNT entries and gc_counts
+// DS_RUNTIME_METRICS_GC_GENERATION_COUNT entries. Durations are in 100ns units.
+static
+uint32_t
+ds_rt_get_runtime_metrics (
+	uint64_t *generation_sizes,
+	uint64_t *gc_counts,
+	uint64_t *gc_total_pause_duration,
+	uint64_t *jit_method_count,
+	uint64_t *jit_time,
+	uint64_t *lock_contention_count);
+
+/*
+* Startup phases
+*/
+
+// Fills phase_durations, which holds max_count entries, with the duration of each
+// runtime startup phase in microseconds, and sets phase_count to the number written.
+static
+uint32_t
+ds_rt_get_startup_phases (
+	uint64_t *phase_durations,
+	uint32_t max_count,
+	uint32_t *phase_count);
+
 static
 inline
 const ep_char8_t *
@@ -34,6 +34,8 @@ typedef struct _DiagnosticsPortVtable DiagnosticsPortVtable;
 typedef struct _DiagnosticsProcessInfoPayload DiagnosticsProcessInfoPayload;
 typedef struct _DiagnosticsProcessInfo2Payload DiagnosticsProcessInfo2Payload;
 typedef struct _DiagnosticsProcessInfo3Payload DiagnosticsProcessInfo3Payload;
+typedef struct _DiagnosticsRuntimeMetricsPayload DiagnosticsRuntimeMetricsPayload;
+typedef struct _DiagnosticsStartupPhasesPayload DiagnosticsStartupPhasesPayload;
 typedef struct _EventPipeCollectTracingCommandPayload EventPipeCollectTracingCommandPayload;
 typedef struct _EventPipeStopTracingCommandPayload EventPipeStopTracingCommandPayload;
 
@@ -95,7 +97,9 @@ typedef enum {
 	DS_PROCESS_COMMANDID_ENABLE_PERFMAP = 0x05,
 	DS_PROCESS_COMMANDID_DISABLE_PERFMAP = 0x06,
 	DS_PROCESS_COMMANDID_APPLY_STARTUP_HOOK = 0x07,
-	DS_PROCESS_COMMANDID_GET_PROCESS_INFO_3 = 0x08
+	DS_PROCESS_COMMANDID_GET_PROCESS_INFO_3 = 0x08,
+	DS_PROCESS_COMMANDID_GET_RUNTIME_METRICS = 0x09,
+	DS_PROCESS_COMMANDID_GET_STARTUP_PHASES = 0x0A
 	// future
 } DiagnosticsProcessCommandId;
 
@@ -138,6 +138,7 @@ block_get_block_version (EventPipeSerializationFormat format)
 	case EP_SERIALIZATION_FORMAT_NETPERF_V3 :
 		return 1;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED :
 		return 2;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
@@ -153,6 +154,7 @@ block_get_block_minimum_version (EventPipeSerializationFormat format)
 	case EP_SERIALIZATION_FORMAT_NETPERF_V3 :
 		return 0;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED :
 		return 2;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
@@ -160,6 +162,142 @@ block_get_block_minimum_version (EventPipeSerializationFormat format)
 	}
 }
 
+/*
+ * LZ4 block format compression of block payloads.
+ *
+ * Only the compressor is needed here, see the LZ4 block format description for the layout:
+ * a sequence is a token (4 bits literal length, 4 bits match length - 4), optional literal length
+ * bytes, the literals, a 2 byte little endian offset and optional match length bytes. The last
+ * sequence only holds literals, the last 5 bytes are always literals and the last match starts
+ * at least 12 bytes before the end of the input.
+ */
+
+#define BLOCK_LZ4_HASH_BITS 12
+#define BLOCK_LZ4_MIN_MATCH 4
+#define BLOCK_LZ4_LAST_LITERALS 5
+#define BLOCK_LZ4_MF_LIMIT 12
+#define BLOCK_LZ4_MAX_OFFSET 65535
+
+static
+inline
+uint32_t
+block_lz4_read_uint32 (const uint8_t *ptr)
+{
+	uint32_t value;
+	memcpy (&value, ptr, sizeof (value));
+	return value;
+}
+
+static
+inline
+uint32_t
+block_lz4_hash (uint32_t value)
+{
+	return (value * 2654435761U) >> (32 - BLOCK_LZ4_HASH_BITS);
+}
+
+static
+inline
+uint8_t *
+block_lz4_write_length (
+	uint8_t *write_pointer,
+	uint32_t length)
+{
+	while (length >= 255) {
+		*write_pointer++ = 255;
+		length -= 255;
+	}
+	*write_pointer++ = (uint8_t)length;
+	return write_pointer;
+}
+
+// Returns the compressed size, or 0 if the compressed data doesn't fit in dst_capacity bytes.
+static
+uint32_t
+block_lz4_compress (
+	const uint8_t *src,
+	uint32_t src_size,
+	uint8_t *dst,
+	uint32_t dst_capacity,
+	uint32_t *hash_table)
+{
+	const uint8_t *ip = src;
+	const uint8_t *anchor = src;
+	const uint8_t *iend = src + src_size;
+	uint8_t *op = dst;
+	uint8_t *oend = dst + dst_capacity;
+	uint32_t literal_len;
+
+	memset (hash_table, 0, (1 << BLOCK_LZ4_HASH_BITS) * sizeof (uint32_t));
+
+	if (src_size > BLOCK_LZ4_MF_LIMIT) {
+		const uint8_t *mflimit = iend - BLOCK_LZ4_MF_LIMIT;
+		const uint8_t *matchlimit = iend - BLOCK_LZ4_LAST_LITERALS;
+
+		ip++;
+		while (ip < mflimit) {
+			uint32_t sequence = block_lz4_read_uint32 (ip);
+			uint32_t hash = block_lz4_hash (sequence);
+			const uint8_t *ref = src + hash_table [hash];
+			hash_table [hash] = (uint32_t)(ip - src);
+
+			if (ref >= ip || (ip - ref) > BLOCK_LZ4_MAX_OFFSET || block_lz4_read_uint32 (ref) != sequence) {
+				ip++;
+				continue;
+			}
+
+			while (ip > anchor && ref > src && ip [-1] == ref [-1]) {
+				ip--;
+				ref--;
+			}
+
+			const uint8_t *match_end = ip + BLOCK_LZ4_MIN_MATCH;
+			const uint8_t *ref_end = ref + BLOCK_LZ4_MIN_MATCH;
+			while (match_end < matchlimit && *match_end == *ref_end) {
+				match_end++;
+				ref_end++;
+			}
+
+			literal_len = (uint32_t)(ip - anchor);
+			uint32_t match_len = (uint32_t)(match_end - ip) - BLOCK_LZ4_MIN_MATCH;
+
+			// token + literal length bytes + literals + offset + match length bytes
+			if ((size_t)(oend - op) < (size_t)1 + (literal_len / 255 + 1) + literal_len + 2 + (match_len / 255 + 1))
+				return 0;
+
+			uint8_t *token = op++;
+			*token = (uint8_t)((literal_len >= 15 ? 15 : literal_len) << 4);
+			if (literal_len >= 15)
+				op = block_lz4_write_length (op, literal_len - 15);
+			memcpy (op, anchor, literal_len);
+			op += literal_len;
+
+			uint16_t offset = (uint16_t)(ip - ref);
+			*op++ = (uint8_t)offset;
+			*op++ = (uint8_t)(offset >> 8);
+
+			*token |= (uint8_t)(match_len >= 15 ? 15 : match_len);
+			if (match_len >= 15)
+				op = block_lz4_write_length (op, match_len - 15);
+
+			ip = match_end;
+			anchor = ip;
+		}
+	}
+
+	literal_len = (uint32_t)(iend - anchor);
+	if ((size_t)(oend - op) < (size_t)1 + (literal_len / 255 + 1) + literal_len)
+		return 0;
+
+	*op++ = (uint8_t)((literal_len >= 15 ? 15 : literal_len) << 4);
+	if (literal_len >= 15)
+		op = block_lz4_write_length (op, literal_len - 15);
+	memcpy (op, anchor, literal_len);
+	op += literal_len;
+
+	return (uint32_t)(op - dst);
+}
+
 static
 void
 block_fast_serialize_func (
@@ -221,6 +359,9 @@ ep_block_init (
 	memset (block->block, 0, max_block_size);
 	block->write_pointer = block->block;
 	block->end_of_the_buffer = block->block + max_block_size;
+	block->compressed_block = NULL;
+	block->compression_hash_table = NULL;
+	block->compressed_size = 0;
 	block->format = format;
 
 ep_on_exit:
@@ -237,6 +378,21 @@ ep_block_fini (EventPipeBlock *block)
 {
 	ep_return_void_if_nok (block != NULL);
 	ep_rt_byte_array_free (block->block);
+	ep_rt_byte_array_free (block->compressed_block);
+	ep_rt_byte_array_free ((uint8_t *)block->compression_hash_table);
+}
+
+bool
+ep_block_enable_compression (EventPipeBlock *block)
+{
+	EP_ASSERT (block != NULL);
+	EP_ASSERT (block->compressed_block == NULL);
+
+	// A compressed payload is only kept when smaller than the original, so the same size is enough.
+	block->compressed_block = ep_rt_byte_array_alloc ((uint32_t)(block->end_of_the_buffer - block->block));
+	block->compression_hash_table = (uint32_t *)ep_rt_byte_array_alloc ((1 << BLOCK_LZ4_HASH_BITS) * sizeof (uint32_t));
+
+	return block->compressed_block != NULL && block->compression_hash_table != NULL;
 }
 
 void
@@ -326,6 +482,17 @@ ep_block_fast_serialize (
 	uint32_t data_size = ep_block_get_bytes_written (block);
 	EP_ASSERT (data_size != 0);
 
+	// The header reflects compressed_size, so the payload has to be compressed before the header is sized.
+	const uint8_t *data = block->block;
+	block->compressed_size = 0;
+	if (block->compressed_block != NULL) {
+		block->compressed_size = block_lz4_compress (block->block, data_size, block->compressed_block, data_size - 1, block->compression_hash_table);
+		if (block->compressed_size != 0) {
+			data = block->compressed_block;
+			data_size = block->compressed_size;
+		}
+	}
+
 	uint32_t header_size =  ep_block_get_header_size_vcall (block);
 	uint32_t total_size = data_size + header_size;
 	ep_fast_serializer_write_uint32_t (fast_serializer, total_size);
@@ -341,7 +508,9 @@ ep_block_fast_serialize (
 	}
 
 	ep_block_serialize_header_vcall (block, fast_serializer);
-	ep_fast_serializer_write_buffer (fast_serializer, block->block, data_size);
+	ep_fast_serializer_write_buffer (fast_serializer, data, data_size);
+
+	block->compressed_size = 0;
 }
 
 /*
@@ -440,6 +609,9 @@ ep_event_block_base_init (
 		max_block_size,
 		format) != NULL);
 
+	if (format == EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED)
+		ep_raise_error_if_nok (ep_block_enable_compression (&event_block_base->block));
+
 	event_block_base->use_header_compression = use_header_compression;
 
 	memset (event_block_base->compressed_header, 0, ARRAY_SIZE (event_block_base->compressed_header));
@@ -479,10 +651,15 @@ ep_event_block_base_get_header_size (const EventPipeEventBlockBase *event_block_
 
 	ep_return_zero_if_nok (((EventPipeBlock *)event_block_base)->format != EP_SERIALIZATION_FORMAT_NETPERF_V3);
 
-	return	sizeof(uint16_t) + // header size
+	uint32_t header_size =	sizeof(uint16_t) + // header size
 			sizeof(uint16_t) + // flags
 			sizeof(ep_timestamp_t)  + // min timestamp
 			sizeof(ep_timestamp_t);   // max timestamp
+
+	if (ep_block_get_compressed_size ((EventPipeBlock *)event_block_base) != 0)
+		header_size += sizeof(uint32_t); // uncompressed payload size
+
+	return header_size;
 }
 
 void
@@ -498,7 +675,11 @@ ep_event_block_base_serialize_header (
 	const uint16_t header_size = (uint16_t)ep_block_get_header_size_vcall ((EventPipeBlock *)event_block_base);
 	ep_fast_serializer_write_uint16_t (fast_serializer, header_size);
 
-	const uint16_t flags = event_block_base->use_header_compression ? 1 : 0;
+	bool compressed = ep_block_get_compressed_size ((EventPipeBlock *)event_block_base) != 0;
+
+	uint16_t flags = event_block_base->use_header_compression ? EP_EVENT_BLOCK_FLAG_HEADER_COMPRESSION : 0;
+	if (compressed)
+		flags |= EP_EVENT_BLOCK_FLAG_LZ4_PAYLOAD;
 	ep_fast_serializer_write_uint16_t (fast_serializer, flags);
 
 	ep_timestamp_t min_timestamp = event_block_base->min_timestamp;
@@ -506,6 +687,9 @@ ep_event_block_base_serialize_header (
 
 	ep_timestamp_t max_timestamp = event_block_base->max_timestamp;
 	ep_fast_serializer_write_int64_t (fast_serializer, max_timestamp);
+
+	if (compressed)
+		ep_fast_serializer_write_uint32_t (fast_serializer, ep_block_get_bytes_written ((EventPipeBlock *)event_block_base));
 }
 
 bool
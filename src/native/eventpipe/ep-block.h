@@ -43,6 +43,11 @@ struct _EventPipeBlock_Internal {
 	uint8_t *block;
 	uint8_t *write_pointer;
 	uint8_t *end_of_the_buffer;
+	// Only allocated for blocks that can be serialized compressed, see ep_block_enable_compression.
+	uint8_t *compressed_block;
+	uint32_t *compression_hash_table;
+	// Size of the compressed payload being serialized, 0 while serializing an uncompressed payload.
+	uint32_t compressed_size;
 	EventPipeSerializationFormat format;
 };
 
@@ -56,6 +61,7 @@ EP_DEFINE_GETTER(EventPipeBlock *, block, uint8_t*, block)
 EP_DEFINE_GETTER(EventPipeBlock *, block, uint8_t*, write_pointer)
 EP_DEFINE_SETTER(EventPipeBlock *, block, uint8_t*, write_pointer)
 EP_DEFINE_GETTER(EventPipeBlock *, block, uint8_t*, end_of_the_buffer)
+EP_DEFINE_GETTER(EventPipeBlock *, block, uint32_t, compressed_size)
 EP_DEFINE_GETTER(EventPipeBlock *, block, EventPipeSerializationFormat, format)
 
 static
@@ -76,6 +82,11 @@ ep_block_init (
 void
 ep_block_fini (EventPipeBlock *block);
 
+// Allocates the buffers needed to serialize the block payload compressed.
+// Only block types whose header can flag a compressed payload should call this.
+bool
+ep_block_enable_compression (EventPipeBlock *block);
+
 void
 ep_block_clear (EventPipeBlock *block);
 
@@ -108,6 +119,16 @@ ep_block_fast_serialize_vcall (
 	EventPipeBlock *block,
 	FastSerializer *fast_serializer);
 
+/*
+ * EventPipeEventBlockBase header flags.
+ */
+
+// Event headers in the block are compressed relative to the previous event.
+#define EP_EVENT_BLOCK_FLAG_HEADER_COMPRESSION 0x1
+// The block payload is compressed using the LZ4 block format. The header then ends with
+// the uint32_t size of the uncompressed payload.
+#define EP_EVENT_BLOCK_FLAG_LZ4_PAYLOAD 0x2
+
 /*
  * EventPipeEventHeader.
  */
@@ -69,6 +69,22 @@ buffer_manager_deallocate_buffer (
 	EventPipeBufferManager *buffer_manager,
 	EventPipeBuffer *buffer);
 
+// Take a recycled buffer of exactly buffer_size bytes out of the free buffers, without taking the lock.
+// A NULL return value means that no such buffer is available.
+static
+EventPipeBuffer *
+buffer_manager_try_take_free_buffer (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size);
+
+// Store a cleared buffer into the free buffers, without taking the lock.
+// Returns false if all the slots are in use, in which case the caller still owns the buffer.
+static
+bool
+buffer_manager_try_put_free_buffer (
+	EventPipeBufferManager *buffer_manager,
+	EventPipeBuffer *buffer);
+
 // Attempt to reserve space for a buffer
 static
 bool
@@ -493,7 +509,13 @@ buffer_manager_allocate_buffer_for_thread (
 
 	// The sequence counter is exclusively mutated on this thread so this is a thread-local read.
 	sequence_number = ep_thread_session_state_get_volatile_sequence_number (thread_session_state);
-	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
+
+	// Prefer a buffer the reader has already drained over getting fresh pages from the OS.
+	new_buffer = buffer_manager_try_take_free_buffer (buffer_manager, buffer_size);
+	if (new_buffer != NULL)
+		ep_buffer_reinit (new_buffer, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
+	else
+		new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
 	ep_raise_error_if_nok (new_buffer != NULL);
 
 	// Adding a buffer to the buffer list requires us to take the lock.
@@ -561,13 +583,62 @@ buffer_manager_deallocate_buffer (
 
 	if (buffer) {
 		buffer_manager_release_buffer(buffer_manager, ep_buffer_get_size (buffer));
-		ep_buffer_free (buffer);
+		ep_buffer_clear (buffer);
+		if (!buffer_manager_try_put_free_buffer (buffer_manager, buffer))
+			ep_buffer_free (buffer);
 #ifdef EP_CHECKED_BUILD
 		buffer_manager->num_buffers_allocated--;
 #endif
 	}
 }
 
+static
+EventPipeBuffer *
+buffer_manager_try_take_free_buffer (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t buffer_size)
+{
+	EP_ASSERT (buffer_manager != NULL);
+
+	EventPipeBuffer *buffer;
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_FREE_BUFFER_COUNT; ++i) {
+		buffer = (EventPipeBuffer *)ep_rt_volatile_load_ptr ((volatile void **)&buffer_manager->free_buffers [i]);
+		if (buffer == NULL)
+			continue;
+
+		// Claim the slot before looking at the buffer, another thread could take it and free it at any point.
+		if (ep_rt_atomic_compare_exchange_size_t ((volatile size_t *)&buffer_manager->free_buffers [i], (size_t)buffer, (size_t)NULL) != (size_t)buffer)
+			continue;
+
+		if (ep_buffer_get_size (buffer) == buffer_size)
+			return buffer;
+
+		// Wrong size, give it back for a thread that needs exactly this size.
+		if (!buffer_manager_try_put_free_buffer (buffer_manager, buffer))
+			ep_buffer_free (buffer);
+	}
+
+	return NULL;
+}
+
+static
+bool
+buffer_manager_try_put_free_buffer (
+	EventPipeBufferManager *buffer_manager,
+	EventPipeBuffer *buffer)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (buffer != NULL);
+
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_FREE_BUFFER_COUNT; ++i) {
+		if (ep_rt_volatile_load_ptr ((volatile void **)&buffer_manager->free_buffers [i]) == NULL &&
+			ep_rt_atomic_compare_exchange_size_t ((volatile size_t *)&buffer_manager->free_buffers [i], (size_t)NULL, (size_t)buffer) == (size_t)NULL)
+			return true;
+	}
+
+	return false;
+}
+
 static
 void
 buffer_manager_move_next_event_any_thread (
@@ -827,6 +898,9 @@ ep_buffer_manager_alloc (
 	instance->size_of_all_buffers = 0;
 	instance->num_oversized_events_dropped = 0;
 
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_FREE_BUFFER_COUNT; ++i)
+		instance->free_buffers [i] = NULL;
+
 #ifdef EP_CHECKED_BUILD
 	instance->num_buffers_allocated = 0;
 	instance->num_buffers_stolen = 0;
@@ -867,6 +941,11 @@ ep_buffer_manager_free (EventPipeBufferManager * buffer_manager)
 
 	ep_buffer_manager_deallocate_buffers (buffer_manager);
 
+	for (uint32_t i = 0; i < EP_BUFFER_MANAGER_FREE_BUFFER_COUNT; ++i) {
+		ep_buffer_free (buffer_manager->free_buffers [i]);
+		buffer_manager->free_buffers [i] = NULL;
+	}
+
 	dn_list_free (buffer_manager->sequence_points);
 
 	dn_list_free (buffer_manager->thread_session_state_list);
@@ -1027,9 +1106,12 @@ ep_buffer_manager_write_event (
 		}
 	}
 
-	if (should_signal_reader_thread)
+	if (should_signal_reader_thread) {
 		// Indicate that there is new data to be read
 		ep_rt_wait_event_set (&buffer_manager->rt_wait_event);
+		if (ep_session_get_shared_streaming (session))
+			ep_session_signal_shared_streaming_thread ();
+	}
 
 #ifdef EP_CHECKED_BUILD
 	if (!alloc_new_buffer)
@@ -86,6 +86,9 @@ ep_buffer_list_ensure_consistency (EventPipeBufferList *buffer_list);
  * EventPipeBufferManager.
  */
 
+// Number of recycled buffers a buffer manager keeps around for reuse.
+#define EP_BUFFER_MANAGER_FREE_BUFFER_COUNT 16
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_BUFFER_MANAGER_GETTER_SETTER)
 struct _EventPipeBufferManager {
 #else
@@ -128,6 +131,11 @@ struct _EventPipeBufferManager_Internal {
 	// number of times an event was dropped due to it being too
 	// large to fit in the 64KB size limit
 	volatile int64_t num_oversized_events_dropped;
+	// Buffers that have been fully read and are kept to be handed out again instead of
+	// going back to the OS. Slots are claimed and released with atomic exchanges, so writer
+	// threads can pick up a buffer without taking rt_lock. Buffers in here are not accounted
+	// in size_of_all_buffers.
+	EventPipeBuffer * volatile free_buffers [EP_BUFFER_MANAGER_FREE_BUFFER_COUNT];
 
 #ifdef EP_CHECKED_BUILD
 	volatile int64_t num_events_stored;
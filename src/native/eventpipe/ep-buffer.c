@@ -63,6 +63,42 @@ ep_buffer_free (EventPipeBuffer *buffer)
 	ep_rt_object_free (buffer);
 }
 
+void
+ep_buffer_clear (EventPipeBuffer *buffer)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (ep_rt_volatile_load_uint32_t (&buffer->state) == (uint32_t)EP_BUFFER_STATE_READ_ONLY);
+
+	// Only the written portion needs to be zeroed, the rest of the buffer has never been touched.
+	memset (buffer->buffer, 0, buffer->current - buffer->buffer);
+	buffer->current = ep_buffer_get_next_aligned_address (buffer, buffer->buffer);
+
+	buffer->writer_thread = NULL;
+	buffer->current_read_event = NULL;
+	buffer->prev_buffer = NULL;
+	buffer->next_buffer = NULL;
+}
+
+void
+ep_buffer_reinit (
+	EventPipeBuffer *buffer,
+	EventPipeThread *writer_thread,
+	uint32_t event_sequence_number)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (ep_rt_volatile_load_uint32_t (&buffer->state) == (uint32_t)EP_BUFFER_STATE_READ_ONLY);
+	EP_ASSERT (buffer->current == ep_buffer_get_next_aligned_address (buffer, buffer->buffer));
+	EP_ASSERT ((buffer->prev_buffer == NULL) && (buffer->next_buffer == NULL));
+
+	buffer->writer_thread = writer_thread;
+	buffer->event_sequence_number = event_sequence_number;
+
+	buffer->creation_timestamp = ep_perf_timestamp_get ();
+	EP_ASSERT (buffer->creation_timestamp > 0);
+
+	ep_rt_volatile_store_uint32_t (&buffer->state, (uint32_t)EP_BUFFER_STATE_WRITABLE);
+}
+
 bool
 ep_buffer_write_event (
 	EventPipeBuffer *buffer,
@@ -90,6 +90,17 @@ ep_buffer_alloc (
 void
 ep_buffer_free (EventPipeBuffer *buffer);
 
+// Clears the written portion of a buffer that has been fully read, so that it can be recycled.
+void
+ep_buffer_clear (EventPipeBuffer *buffer);
+
+// Hands a cleared buffer to a new writer thread, as if it was returned from ep_buffer_alloc.
+void
+ep_buffer_reinit (
+	EventPipeBuffer *buffer,
+	EventPipeThread *writer_thread,
+	uint32_t event_sequence_number);
+
 static
 inline
 uint32_t
@@ -98,7 +98,12 @@ ep_event_source_init (EventPipeEventSource *event_source)
 	ep_char16_t *os_info_arg_utf16 = NULL;
 	ep_char16_t *arch_info_arg_utf16 = NULL;
 	ep_char16_t *event_name_utf16  = NULL;
+	ep_char16_t *provider_name_arg_utf16 = NULL;
+	ep_char16_t *event_id_arg_utf16 = NULL;
+	ep_char16_t *count_arg_utf16 = NULL;
+	ep_char16_t *event_count_name_utf16 = NULL;
 	uint8_t *metadata = NULL;
+	uint8_t *event_count_metadata = NULL;
 
 	EP_ASSERT (event_source != NULL);
 
@@ -155,13 +160,64 @@ ep_event_source_init (EventPipeEventSource *event_source)
 
 	ep_raise_error_if_nok (event_source->process_info_event);
 
+	// Generate metadata for the event reporting counted events.
+	EventPipeParameterDesc event_count_params [3];
+	uint32_t event_count_params_len;
+	event_count_params_len = (uint32_t)ARRAY_SIZE (event_count_params);
+
+	provider_name_arg_utf16 = ep_rt_utf8_to_utf16le_string ("ProviderName");
+	ep_raise_error_if_nok (provider_name_arg_utf16 != NULL);
+	ep_parameter_desc_init (&event_count_params[0], EP_PARAMETER_TYPE_STRING, provider_name_arg_utf16);
+
+	event_id_arg_utf16 = ep_rt_utf8_to_utf16le_string ("EventID");
+	ep_raise_error_if_nok (event_id_arg_utf16 != NULL);
+	ep_parameter_desc_init (&event_count_params[1], EP_PARAMETER_TYPE_UINT32, event_id_arg_utf16);
+
+	count_arg_utf16 = ep_rt_utf8_to_utf16le_string ("Count");
+	ep_raise_error_if_nok (count_arg_utf16 != NULL);
+	ep_parameter_desc_init (&event_count_params[2], EP_PARAMETER_TYPE_UINT64, count_arg_utf16);
+
+	event_count_name_utf16 = ep_rt_utf8_to_utf16le_string ("EventCount");
+	ep_raise_error_if_nok (event_count_name_utf16 != NULL);
+
+	metadata_len = 0;
+	event_count_metadata = ep_metadata_generator_generate_event_metadata (
+		2,		/* eventID */
+		event_count_name_utf16,
+		0,		/* keywords */
+		0,		/* version */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		0,		/* opcode */
+		event_count_params,
+		event_count_params_len,
+		&metadata_len);
+
+	ep_raise_error_if_nok (event_count_metadata != NULL);
+
+	event_source->event_count_event = ep_provider_add_event (
+		event_source->provider,
+		2,		/* eventID */
+		0,		/* keywords */
+		0,		/* eventVersion */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		false,  /* needStack */
+		event_count_metadata,
+		(uint32_t)metadata_len);
+
+	ep_raise_error_if_nok (event_source->event_count_event);
+
 ep_on_exit:
 	// Delete the metadata after the event is created.
 	// The metadata blob will be copied into EventPipe-owned memory.
+	ep_rt_byte_array_free (event_count_metadata);
 	ep_rt_byte_array_free (metadata);
 
 	// Delete the strings after the event is created.
 	// The strings will be copied into EventPipe-owned memory.
+	ep_rt_utf16_string_free (event_count_name_utf16);
+	ep_rt_utf16_string_free (count_arg_utf16);
+	ep_rt_utf16_string_free (event_id_arg_utf16);
+	ep_rt_utf16_string_free (provider_name_arg_utf16);
 	ep_rt_utf16_string_free (event_name_utf16);
 	ep_rt_utf16_string_free (arch_info_arg_utf16);
 	ep_rt_utf16_string_free (os_info_arg_utf16);
@@ -238,6 +294,34 @@ ep_event_source_send_process_info (
 	ep_rt_utf16_string_free (command_line_utf16);
 }
 
+void
+ep_event_source_send_event_count (
+	EventPipeEventSource *event_source,
+	EventPipeSession *session,
+	const ep_char8_t *provider_name,
+	uint32_t event_id,
+	uint64_t count)
+{
+	EP_ASSERT (event_source != NULL);
+	EP_ASSERT (session != NULL);
+
+	ep_char16_t *provider_name_utf16 = ep_rt_utf8_to_utf16le_string (provider_name);
+
+	EventData data [3] = { { 0 } };
+	if (provider_name_utf16)
+		ep_event_data_init (&data[0], (uint64_t)provider_name_utf16, (uint32_t)((ep_rt_utf16_string_len (provider_name_utf16) + 1) * sizeof (ep_char16_t)), 0);
+	ep_event_data_init (&data[1], (uint64_t)&event_id, sizeof (event_id), 0);
+	ep_event_data_init (&data[2], (uint64_t)&count, sizeof (count), 0);
+
+	// Only the session that counted the events gets the event, write it directly to that session.
+	EventPipeEventPayload payload;
+	EventPipeEventPayload *event_payload = ep_event_payload_init_2 (&payload, data, (uint32_t)ARRAY_SIZE (data));
+	ep_session_write_event (session, ep_rt_thread_get_handle (), event_source->event_count_event, event_payload, NULL, NULL, NULL, NULL);
+	ep_event_payload_fini (event_payload);
+
+	ep_rt_utf16_string_free (provider_name_utf16);
+}
+
 #endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
 #endif /* ENABLE_PERFTRACING */
 
@@ -29,6 +29,7 @@ struct _EventPipeEventSource_Internal {
 	EventPipeProvider *provider;
 	const ep_char8_t *process_info_event_name;
 	EventPipeEvent *process_info_event;
+	EventPipeEvent *event_count_event;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EVENT_SOURCE_GETTER_SETTER)
@@ -71,6 +72,15 @@ ep_event_source_enable (EventPipeEventSource *event_source, EventPipeSession *se
 void
 ep_event_source_send_process_info (EventPipeEventSource *event_source, const ep_char8_t *command_line);
 
+// Writes the EventCount event to a single session, reporting how many times a counted event was written.
+void
+ep_event_source_send_event_count (
+	EventPipeEventSource *event_source,
+	EventPipeSession *session,
+	const ep_char8_t *provider_name,
+	uint32_t event_id,
+	uint64_t count);
+
 static
 inline
 EventPipeEventSource *
@@ -33,6 +33,18 @@ void
 DN_CALLBACK_CALLTYPE
 stack_hash_value_free_func (void *entry);
 
+static
+void
+file_stack_hash_lru_unlink (
+	EventPipeFile *file,
+	StackHashEntry *entry);
+
+static
+void
+file_stack_hash_lru_push_front (
+	EventPipeFile *file,
+	StackHashEntry *entry);
+
 static
 uint32_t
 file_get_stack_id (
@@ -152,6 +164,47 @@ file_write_end (EventPipeFile *file)
 	ep_fast_serializer_write_tag (file->fast_serializer, FAST_SERIALIZER_TAGS_NULL_REFERENCE, NULL, 0);
 }
 
+static
+void
+file_stack_hash_lru_unlink (
+	EventPipeFile *file,
+	StackHashEntry *entry)
+{
+	EP_ASSERT (file != NULL);
+	EP_ASSERT (entry != NULL);
+
+	if (entry->lru_prev)
+		entry->lru_prev->lru_next = entry->lru_next;
+	else
+		file->stack_hash_lru_head = entry->lru_next;
+
+	if (entry->lru_next)
+		entry->lru_next->lru_prev = entry->lru_prev;
+	else
+		file->stack_hash_lru_tail = entry->lru_prev;
+
+	entry->lru_prev = NULL;
+	entry->lru_next = NULL;
+}
+
+static
+void
+file_stack_hash_lru_push_front (
+	EventPipeFile *file,
+	StackHashEntry *entry)
+{
+	EP_ASSERT (file != NULL);
+	EP_ASSERT (entry != NULL);
+	EP_ASSERT (entry->lru_prev == NULL && entry->lru_next == NULL);
+
+	entry->lru_next = file->stack_hash_lru_head;
+	if (file->stack_hash_lru_head)
+		file->stack_hash_lru_head->lru_prev = entry;
+	else
+		file->stack_hash_lru_tail = entry;
+	file->stack_hash_lru_head = entry;
+}
+
 static
 uint32_t
 file_get_stack_id (
@@ -173,9 +226,20 @@ file_get_stack_id (
 	if (dn_umap_it_end (found)) {
 		stack_id = file->stack_id_counter + 1;
 		file->stack_id_counter = stack_id;
+
+		// Bound the table, forgetting a stack only means it gets written again under a new id.
+		if (dn_umap_size (stack_hash) >= EP_FILE_MAX_STACK_HASH_ENTRIES) {
+			StackHashEntry *evicted = file->stack_hash_lru_tail;
+			EP_ASSERT (evicted != NULL);
+			file_stack_hash_lru_unlink (file, evicted);
+			dn_umap_erase_key (stack_hash, ep_stack_hash_entry_get_key_ref (evicted));
+		}
+
 		StackHashEntry *entry = ep_stack_hash_entry_alloc (stack_contents, stack_id, ep_stack_hash_key_get_hash (&key));
 		if (entry) {
-			if (!dn_umap_insert (stack_hash, ep_stack_hash_entry_get_key_ref (entry), entry).result)
+			if (dn_umap_insert (stack_hash, ep_stack_hash_entry_get_key_ref (entry), entry).result)
+				file_stack_hash_lru_push_front (file, entry);
+			else
 				ep_stack_hash_entry_free (entry);
 			entry = NULL;
 		}
@@ -189,7 +253,12 @@ file_get_stack_id (
 				EP_UNREACHABLE ("Should never fail to add event to a clear block. If we do the max size is too small.");
 		}
 	} else {
-		stack_id = ep_stack_hash_entry_get_id (dn_umap_it_value_t (found, StackHashEntry *));
+		StackHashEntry *entry = dn_umap_it_value_t (found, StackHashEntry *);
+		if (entry != file->stack_hash_lru_head) {
+			file_stack_hash_lru_unlink (file, entry);
+			file_stack_hash_lru_push_front (file, entry);
+		}
+		stack_id = ep_stack_hash_entry_get_id (entry);
 	}
 
 	ep_stack_hash_key_fini (&key);
@@ -287,6 +356,8 @@ file_get_file_version (EventPipeSerializationFormat format)
 		return 3;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 4;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED :
+		return 5;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
@@ -302,6 +373,9 @@ file_get_file_minimum_version (EventPipeSerializationFormat format)
 		return 0;
 	case EP_SERIALIZATION_FORMAT_NETTRACE_V4 :
 		return 4;
+	case EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED :
+		// Readers that don't understand compressed blocks must not try to parse this file.
+		return 5;
 	default :
 		EP_ASSERT (!"Unrecognized EventPipeSerializationFormat");
 		return 0;
@@ -361,6 +435,8 @@ ep_file_alloc (
 	ep_rt_volatile_store_uint32_t (&instance->metadata_id_counter, 0);
 
 	// Start at 0 - The value is always incremented prior to use, so the first ID will be 1.
+	instance->stack_hash_lru_head = NULL;
+	instance->stack_hash_lru_tail = NULL;
 	instance->stack_id_counter = 0;
 
 	ep_rt_volatile_store_uint32_t (&instance->initialized, 0);
@@ -502,6 +578,8 @@ ep_file_write_sequence_point (
 	// stack cache resets on sequence points
 	file->stack_id_counter = 0;
 	dn_umap_clear (file->stack_hash);
+	file->stack_hash_lru_head = NULL;
+	file->stack_hash_lru_tail = NULL;
 
 ep_on_exit:
 	return;
@@ -565,6 +643,8 @@ ep_stack_hash_entry_alloc (
 	ep_raise_error_if_nok (entry != NULL);
 
 	entry->id = id;
+	entry->lru_prev = NULL;
+	entry->lru_next = NULL;
 	entry->key.hash = hash;
 	entry->key.stack_size_in_bytes = stack_size;
 	entry->key.stack_bytes = entry->stack_bytes;
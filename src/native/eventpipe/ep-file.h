@@ -36,6 +36,10 @@ struct _EventPipeFile_Internal {
 	// Hashtable of metadata labels.
 	dn_umap_t *metadata_ids;
 	dn_umap_t *stack_hash;
+	// Entries of stack_hash ordered from most to least recently used, used to
+	// evict stacks once the table reaches EP_FILE_MAX_STACK_HASH_ENTRIES.
+	StackHashEntry *stack_hash_lru_head;
+	StackHashEntry *stack_hash_lru_tail;
 	// The timestamp when the file was opened.  Used for calculating file-relative timestamps.
 	ep_timestamp_t file_open_timestamp;
 #ifdef EP_CHECKED_BUILD
@@ -102,6 +106,10 @@ ep_file_flush (
  * StackHashKey.
  */
 
+// Maximum number of distinct stacks remembered between two sequence points. Once reached, the least
+// recently used stack is forgotten; if it shows up again it is written again under a new id.
+#define EP_FILE_MAX_STACK_HASH_ENTRIES 8192
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_FILE_GETTER_SETTER)
 struct _StackHashKey {
 #else
@@ -138,6 +146,8 @@ struct _StackHashEntry {
 struct _StackHashEntry_Internal {
 #endif
 	StackHashKey key;
+	StackHashEntry *lru_prev;
+	StackHashEntry *lru_next;
 	uint32_t id;
 	// This is the first byte of StackSizeInBytes bytes of stack data
 	uint8_t stack_bytes[1];
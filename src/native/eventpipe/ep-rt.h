@@ -196,6 +196,11 @@ inline
 bool
 ep_rt_config_value_get_enable_stackwalk (void);
 
+static
+inline
+bool
+ep_rt_config_value_get_shared_streaming_thread (void);
+
 /*
  * EventPipeSampleProfiler.
  */
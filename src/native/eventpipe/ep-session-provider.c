@@ -429,6 +429,41 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+void
+session_provider_parse_counted_event_ids (EventPipeSessionProvider *session_provider)
+{
+	EP_ASSERT (session_provider != NULL);
+
+	const ep_char8_t *key = EP_SESSION_PROVIDER_COUNTED_EVENT_IDS_KEY "=";
+	const size_t key_len = strlen (key);
+
+	const ep_char8_t *current = session_provider->filter_data;
+	while (current && *current) {
+		if (strncmp (current, key, key_len) == 0) {
+			current += key_len;
+			while (*current && *current != ';' && session_provider->counted_events_len < EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS) {
+				char *end = NULL;
+				uint32_t event_id = (uint32_t)strtoul (current, &end, 10);
+				if (end == current)
+					break;
+
+				session_provider->counted_event_ids [session_provider->counted_events_len++] = event_id;
+				current = end;
+				if (*current == ',')
+					current++;
+			}
+			return;
+		}
+
+		// Skip to the next key.
+		while (*current && *current != ';')
+			current++;
+		if (*current == ';')
+			current++;
+	}
+}
+
 EventPipeSessionProvider *
 ep_session_provider_alloc (
 	const ep_char8_t *provider_name,
@@ -455,6 +490,9 @@ ep_session_provider_alloc (
 	instance->logging_level = logging_level;
 	instance->event_filter = NULL;
 	instance->tracepoint_config = NULL;
+	instance->counted_events_len = 0;
+
+	session_provider_parse_counted_event_ids (instance);
 
 	if (event_filter) {
 		instance->event_filter = session_provider_event_filter_alloc (event_filter);
@@ -527,6 +565,48 @@ ep_session_provider_allows_event (
 	return event_filter_enables_event_id (session_provider->event_filter, event_id);
 }
 
+bool
+ep_session_provider_try_count_event (
+	EventPipeSessionProvider *session_provider,
+	uint32_t event_id)
+{
+	EP_ASSERT (session_provider != NULL);
+
+	for (uint32_t i = 0; i < session_provider->counted_events_len; ++i) {
+		if (session_provider->counted_event_ids [i] == event_id) {
+			ep_rt_atomic_inc_int64_t (&session_provider->counted_event_counts [i]);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+uint32_t
+ep_session_provider_get_changed_event_counts (
+	EventPipeSessionProvider *session_provider,
+	uint32_t *event_ids,
+	int64_t *counts,
+	uint32_t len)
+{
+	EP_ASSERT (session_provider != NULL);
+	EP_ASSERT (event_ids != NULL && counts != NULL);
+
+	uint32_t result = 0;
+	for (uint32_t i = 0; i < session_provider->counted_events_len && result < len; ++i) {
+		int64_t count = ep_rt_volatile_load_int64_t (&session_provider->counted_event_counts [i]);
+		if (count == session_provider->reported_event_counts [i])
+			continue;
+
+		session_provider->reported_event_counts [i] = count;
+		event_ids [result] = session_provider->counted_event_ids [i];
+		counts [result] = count;
+		result++;
+	}
+
+	return result;
+}
+
 /*
  * EventPipeSessionProviderList.
  */
@@ -164,6 +164,12 @@ struct _EventPipeSessionProviderTracepointConfiguration {
  * EventPipeSessionProvider.
  */
 
+// Reserved filter data key, "EventPipeCountedEventIds=id1,id2,...", listing events of the provider
+// that are counted instead of written. Counts are periodically reported by the
+// Microsoft-DotNETCore-EventPipe provider EventCount event.
+#define EP_SESSION_PROVIDER_COUNTED_EVENT_IDS_KEY "EventPipeCountedEventIds"
+#define EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS 16
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_PROVIDER_GETTER_SETTER)
 struct _EventPipeSessionProvider {
 #else
@@ -175,6 +181,12 @@ struct _EventPipeSessionProvider_Internal {
 	ep_char8_t *filter_data;
 	EventPipeSessionProviderEventFilter *event_filter;
 	EventPipeSessionProviderTracepointConfiguration *tracepoint_config;
+	uint32_t counted_event_ids [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+	// Number of times each counted event was written since the session started.
+	volatile int64_t counted_event_counts [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+	// Counts as of the last call to ep_session_provider_get_changed_event_counts.
+	int64_t reported_event_counts [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+	uint32_t counted_events_len;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_PROVIDER_GETTER_SETTER)
@@ -187,6 +199,7 @@ EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint64_t, keywords)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, EventPipeEventLevel, logging_level)
 EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, const ep_char8_t *, filter_data)
+EP_DEFINE_GETTER(EventPipeSessionProvider *, session_provider, uint32_t, counted_events_len)
 
 EventPipeSessionProvider *
 ep_session_provider_alloc (
@@ -205,6 +218,21 @@ ep_session_provider_allows_event (
 	EventPipeSessionProvider *session_provider,
 	const EventPipeEvent *ep_event);
 
+// Returns true, counting it, if the event is configured to be counted instead of written.
+bool
+ep_session_provider_try_count_event (
+	EventPipeSessionProvider *session_provider,
+	uint32_t event_id);
+
+// Copies the cumulative counts of counted events that changed since the previous call.
+// Returns the number of entries copied.
+uint32_t
+ep_session_provider_get_changed_event_counts (
+	EventPipeSessionProvider *session_provider,
+	uint32_t *event_ids,
+	int64_t *counts,
+	uint32_t len);
+
 /*
 * EventPipeSessionProviderList.
  */
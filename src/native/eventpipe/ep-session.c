@@ -11,6 +11,7 @@
 #include "ep-file.h"
 #include "ep-session.h"
 #include "ep-event-payload.h"
+#include "ep-event-source.h"
 #include "ep-rt.h"
 
 #if HAVE_UNISTD_H
@@ -38,10 +39,31 @@ static
 void
 session_create_streaming_thread (EventPipeSession *session);
 
+#ifndef PERFTRACING_DISABLE_THREADS
+static
+void
+session_disable_shared_streaming (EventPipeSession *session);
+
+// _Requires_lock_held (ep)
+static
+void
+session_enable_shared_streaming (EventPipeSession *session);
+#endif // PERFTRACING_DISABLE_THREADS
+
 static
 void
 ep_session_remove_dangling_session_states (EventPipeSession *session);
 
+static
+bool
+session_try_count_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event);
+
+static
+uint32_t
+session_write_counted_events_if_due (EventPipeSession *session);
+
 static
 bool
 session_user_events_tracepoints_init (
@@ -64,6 +86,22 @@ construct_extension_activity_ids_buffer (
 	const uint8_t *activity_id,
 	const uint8_t *related_activity_id);
 
+#if HAVE_SYS_UIO_H && HAVE_ERRNO_H
+static
+void
+session_tracepoint_template_init (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeSessionTracepointTemplate *tracepoint_template);
+
+static
+const EventPipeSessionTracepointTemplate *
+session_tracepoint_get_template (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeSessionTracepointTemplate *uncached_template);
+#endif // HAVE_SYS_UIO_H && HAVE_ERRNO_H
+
 static
 bool
 session_tracepoint_write_event (
@@ -76,6 +114,41 @@ session_tracepoint_write_event (
 	ep_rt_thread_handle_t event_thread,
 	EventPipeStackContents *stack);
 
+/*
+ * Globals and volatile access functions.
+ */
+
+#ifndef PERFTRACING_DISABLE_THREADS
+// Streaming sessions serviced by the shared streaming thread, indexed by session index.
+static volatile EventPipeSession *_shared_streaming_sessions [EP_MAX_NUMBER_OF_SESSIONS] = { 0 };
+
+// Signaled when any session serviced by the shared streaming thread has new data, or is being disabled.
+static ep_rt_wait_event_handle_t _shared_streaming_wait_event = { 0 };
+
+// Created on first use, once created the shared streaming thread lives for the lifetime of the process.
+static volatile uint32_t _shared_streaming_thread_created = 0;
+
+static
+inline
+EventPipeSession *
+shared_streaming_session_volatile_load (uint32_t index)
+{
+	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
+	return (EventPipeSession *)ep_rt_volatile_load_ptr ((volatile void **)(&_shared_streaming_sessions [index]));
+}
+
+static
+inline
+void
+shared_streaming_session_volatile_store (
+	uint32_t index,
+	EventPipeSession *session)
+{
+	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
+	ep_rt_volatile_store_ptr ((volatile void **)(&_shared_streaming_sessions [index]), session);
+}
+#endif // PERFTRACING_DISABLE_THREADS
+
 /*
  * EventPipeSession.
  */
@@ -106,6 +179,8 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 
 	EP_GCX_PREEMP_ENTER
 		while (ep_session_get_streaming_enabled (session)) {
+			uint32_t wait_timeout = session_write_counted_events_if_due (session);
+
 			bool events_written = false;
 			if (!ep_session_write_all_buffers_to_file (session, &events_written)) {
 				success = false;
@@ -114,7 +189,7 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 
 			if (!events_written) {
 				// No events were available, sleep until more are available
-				ep_rt_wait_event_wait (wait_event, EP_INFINITE_WAIT, false);
+				ep_rt_wait_event_wait (wait_event, wait_timeout, false);
 			}
 
 			// Wait until it's time to sample again.
@@ -132,6 +207,124 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 	return (ep_rt_thread_start_func_return_t)0;
 }
 
+EP_RT_DEFINE_THREAD_FUNC (shared_streaming_disable_session_thread)
+{
+	EP_ASSERT (data != NULL);
+	if (data == NULL)
+		return 1;
+
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+	ep_disable ((EventPipeSessionID)thread_params->thread_params);
+
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+static
+void
+shared_streaming_detach_session (EventPipeSession *session)
+{
+	shared_streaming_session_volatile_store (session->index, NULL);
+	session->streaming_thread = NULL;
+	ep_rt_wait_event_set (&session->rt_thread_shutdown_event);
+}
+
+EP_RT_DEFINE_THREAD_FUNC (shared_streaming_thread)
+{
+	EP_ASSERT (data != NULL);
+	if (data == NULL)
+		return 1;
+
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+	if (!thread_params->thread || !ep_rt_thread_has_started (thread_params->thread))
+		return 1;
+
+	EP_GCX_PREEMP_ENTER
+		while (!ep_rt_process_shutdown ()) {
+			uint32_t wait_timeout = EP_INFINITE_WAIT;
+			bool events_written = false;
+			for (uint32_t i = 0; i < EP_MAX_NUMBER_OF_SESSIONS; ++i) {
+				EventPipeSession *const session = shared_streaming_session_volatile_load (i);
+				if (!session)
+					continue;
+
+				if (!ep_session_get_streaming_enabled (session)) {
+					// Session is being disabled, session_disable_shared_streaming waits on this.
+					shared_streaming_detach_session (session);
+					continue;
+				}
+
+				session->streaming_thread = thread_params->thread;
+				ep_rt_volatile_store_uint32_t (&session->started, 1);
+
+				uint32_t session_wait_timeout = session_write_counted_events_if_due (session);
+				if (session_wait_timeout < wait_timeout)
+					wait_timeout = session_wait_timeout;
+
+				bool session_events_written = false;
+				if (!ep_session_write_all_buffers_to_file (session, &session_events_written)) {
+					// Disabling the session takes the EventPipe lock, that could be held by a thread
+					// waiting for this thread to detach another session, so disable it on a separate thread.
+					shared_streaming_detach_session (session);
+					ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+					if (!ep_rt_thread_create ((void *)shared_streaming_disable_session_thread, (void *)session, EP_THREAD_TYPE_SESSION, &thread_id))
+						EP_UNREACHABLE ("Unable to create stream disabling thread.");
+					continue;
+				}
+
+				events_written |= session_events_written;
+			}
+
+			if (!events_written) {
+				// No events were available, sleep until more are available
+				ep_rt_wait_event_wait (&_shared_streaming_wait_event, wait_timeout, false);
+			}
+
+			// Wait until it's time to sample again.
+			const uint32_t timeout_ns = 100000000; // 100 msec.
+			ep_rt_thread_sleep (timeout_ns);
+		}
+	EP_GCX_PREEMP_EXIT
+
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
+static
+void
+session_enable_shared_streaming (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->shared_streaming);
+
+	ep_requires_lock_held ();
+
+	if (ep_rt_volatile_load_uint32_t (&_shared_streaming_thread_created) == 0) {
+		ep_rt_wait_event_alloc (&_shared_streaming_wait_event, false, false);
+		if (!ep_rt_wait_event_is_valid (&_shared_streaming_wait_event))
+			EP_UNREACHABLE ("Unable to create shared streaming thread wait event.");
+
+		ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+		if (!ep_rt_thread_create ((void *)shared_streaming_thread, NULL, EP_THREAD_TYPE_SESSION, &thread_id))
+			EP_UNREACHABLE ("Unable to create shared stream flushing thread.");
+
+		ep_rt_volatile_store_uint32_t (&_shared_streaming_thread_created, 1);
+	}
+
+	EP_ASSERT (shared_streaming_session_volatile_load (session->index) == NULL);
+	shared_streaming_session_volatile_store (session->index, session);
+	ep_rt_wait_event_set (&_shared_streaming_wait_event);
+}
+
+static
+void
+session_disable_shared_streaming (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->shared_streaming);
+
+	// The shared streaming thread detaches the session once it observes streaming is disabled.
+	ep_rt_wait_event_set (&_shared_streaming_wait_event);
+}
+
 #else // PERFTRACING_DISABLE_THREADS
 
 static size_t streaming_loop_tick(EventPipeSession *const session) {
@@ -143,6 +336,7 @@ static size_t streaming_loop_tick(EventPipeSession *const session) {
 		return 1; // done
 	}
 	EP_GCX_PREEMP_ENTER
+	session_write_counted_events_if_due (session);
 	ok = ep_session_write_all_buffers_to_file (session, &events_written);
 	EP_GCX_PREEMP_EXIT
 	if (!ok) {
@@ -169,6 +363,11 @@ session_create_streaming_thread (EventPipeSession *session)
 		EP_UNREACHABLE ("Unable to create stream flushing thread shutdown event.");
 
 #ifndef PERFTRACING_DISABLE_THREADS
+	if (session->shared_streaming) {
+		session_enable_shared_streaming (session);
+		return;
+	}
+
 	ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
 	if (!ep_rt_thread_create ((void *)streaming_thread, (void *)session, EP_THREAD_TYPE_SESSION, &thread_id))
 		EP_UNREACHABLE ("Unable to create stream flushing thread.");
@@ -195,6 +394,10 @@ session_disable_streaming_thread (EventPipeSession *session)
 
 	// Thread could be waiting on the event that there is new data to read.
 	ep_rt_wait_event_set (ep_buffer_manager_get_rt_wait_event_ref (session->buffer_manager));
+#ifndef PERFTRACING_DISABLE_THREADS
+	if (session->shared_streaming)
+		session_disable_shared_streaming (session);
+#endif
 
 	// Wait for the streaming thread to clean itself up.
 	ep_rt_wait_event_handle_t *rt_thread_shutdown_event = &session->rt_thread_shutdown_event;
@@ -224,6 +427,9 @@ session_user_events_tracepoints_init (
 	ep_raise_error_if_nok (user_events_data_fd != -1);
 	session->user_events_data_fd = user_events_data_fd;
 
+	session->tracepoint_templates = ep_rt_object_array_alloc (EventPipeSessionTracepointTemplate *, EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_SIZE);
+	ep_raise_error_if_nok (session->tracepoint_templates != NULL);
+
 	DN_LIST_FOREACH_BEGIN (EventPipeSessionProvider *, session_provider, ep_session_provider_list_get_providers (providers)) {
 		EP_ASSERT (session_provider != NULL);
 		ep_raise_error_if_nok (ep_session_provider_register_tracepoints (session_provider, session->user_events_data_fd));
@@ -275,6 +481,14 @@ ep_session_alloc (
 	instance->providers = ep_session_provider_list_alloc (providers, providers_len);
 	ep_raise_error_if_nok (instance->providers != NULL);
 
+	instance->has_counted_events = false;
+	if (ep_session_type_uses_buffer_manager (session_type)) {
+		DN_LIST_FOREACH_BEGIN (EventPipeSessionProvider *, session_provider, ep_session_provider_list_get_providers (instance->providers)) {
+			if (ep_session_provider_get_counted_events_len (session_provider) != 0)
+				instance->has_counted_events = true;
+		} DN_LIST_FOREACH_END;
+	}
+
 	instance->index = index;
 	instance->rundown_enabled = 0;
 	instance->session_type = session_type;
@@ -328,9 +542,15 @@ ep_session_alloc (
 
 	instance->session_start_time = ep_system_timestamp_get ();
 	instance->session_start_timestamp = ep_perf_timestamp_get ();
+	instance->counted_events_timestamp = instance->session_start_timestamp;
 	instance->paused = false;
 	instance->enable_stackwalk = ep_rt_config_value_get_enable_stackwalk () && stackwalk_requested;
 	instance->started = 0;
+#ifndef PERFTRACING_DISABLE_THREADS
+	instance->shared_streaming = (session_type == EP_SESSION_TYPE_IPCSTREAM || session_type == EP_SESSION_TYPE_FILESTREAM) && ep_rt_config_value_get_shared_streaming_thread ();
+#else
+	instance->shared_streaming = false;
+#endif
 
 ep_on_exit:
 	ep_requires_lock_held ();
@@ -412,6 +632,12 @@ ep_session_dec_ref (EventPipeSession *session)
 
 	ep_session_remove_dangling_session_states (session);
 
+	if (session->tracepoint_templates) {
+		for (uint32_t i = 0; i < EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_SIZE; ++i)
+			ep_rt_object_free (session->tracepoint_templates [i]);
+		ep_rt_object_array_free ((EventPipeSessionTracepointTemplate **)session->tracepoint_templates);
+	}
+
 	ep_rt_object_free (session);
 }
 
@@ -698,6 +924,85 @@ construct_extension_activity_ids_buffer (
 }
 
 #if HAVE_SYS_UIO_H && HAVE_ERRNO_H
+static
+void
+session_tracepoint_template_init (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeSessionTracepointTemplate *tracepoint_template)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_event != NULL);
+	EP_ASSERT (tracepoint_template != NULL);
+
+	EventPipeProvider *provider = ep_event_get_provider (ep_event);
+	EventPipeSessionProviderList *session_provider_list = session->providers;
+	EventPipeSessionProvider *session_provider = ep_session_provider_list_find_by_name (ep_session_provider_list_get_providers (session_provider_list), ep_provider_get_provider_name (provider));
+
+	tracepoint_template->ep_event = ep_event;
+	tracepoint_template->tracepoint = session_provider != NULL ? ep_session_provider_get_tracepoint_for_event (session_provider, ep_event) : NULL;
+
+	uint32_t write_index = tracepoint_template->tracepoint != NULL ? ep_session_provider_tracepoint_get_write_index (tracepoint_template->tracepoint) : 0;
+	uint8_t version = 0x01; // Format V1
+	// For parity with EventSource, there shouldn't be any that need more than 16 bits.
+	uint16_t truncated_event_id = ep_event_get_event_id (ep_event) & 0xFFFF;
+	memcpy (tracepoint_template->header, &write_index, sizeof (write_index));
+	memcpy (tracepoint_template->header + sizeof (write_index), &version, sizeof (version));
+	memcpy (tracepoint_template->header + sizeof (write_index) + sizeof (version), &truncated_event_id, sizeof (truncated_event_id));
+
+	uint32_t metadata_len = ep_event_get_metadata_len (ep_event);
+	tracepoint_template->extension_metadata [0] = 0x01; // label
+	memcpy (tracepoint_template->extension_metadata + 1, &metadata_len, sizeof (metadata_len));
+}
+
+/*
+ *  session_tracepoint_get_template
+ *
+ *  Returns the cached template for the event, creating it on first use. Events outlive the session
+ *  (providers are only deleted without sessions), so the event pointer identifies the template.
+ *  Slots are only ever filled, never replaced, so readers need no lock. If the probed slots are
+ *  taken by other events, the template is built in uncached_template instead.
+ */
+static
+const EventPipeSessionTracepointTemplate *
+session_tracepoint_get_template (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event,
+	EventPipeSessionTracepointTemplate *uncached_template)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_event != NULL);
+	EP_ASSERT (uncached_template != NULL);
+
+	if (session->tracepoint_templates != NULL) {
+		size_t start = ((size_t)ep_event >> 4) % EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_SIZE;
+		for (size_t i = 0; i < EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_PROBES; ++i) {
+			EventPipeSessionTracepointTemplate * volatile *slot = &session->tracepoint_templates [(start + i) % EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_SIZE];
+			EventPipeSessionTracepointTemplate *tracepoint_template = (EventPipeSessionTracepointTemplate *)ep_rt_volatile_load_ptr ((volatile void **)slot);
+			if (tracepoint_template == NULL) {
+				tracepoint_template = ep_rt_object_alloc (EventPipeSessionTracepointTemplate);
+				if (tracepoint_template == NULL)
+					break;
+
+				session_tracepoint_template_init (session, ep_event, tracepoint_template);
+				size_t previous = ep_rt_atomic_compare_exchange_size_t ((volatile size_t *)slot, (size_t)NULL, (size_t)tracepoint_template);
+				if (previous == (size_t)NULL)
+					return tracepoint_template;
+
+				// Another thread filled the slot first.
+				ep_rt_object_free (tracepoint_template);
+				tracepoint_template = (EventPipeSessionTracepointTemplate *)previous;
+			}
+
+			if (tracepoint_template->ep_event == ep_event)
+				return tracepoint_template;
+		}
+	}
+
+	session_tracepoint_template_init (session, ep_event, uncached_template);
+	return uncached_template;
+}
+
 /*
  *  session_tracepoint_write_event
  *
@@ -719,10 +1024,11 @@ session_tracepoint_write_event (
 	EP_ASSERT (session != NULL);
 	EP_ASSERT (ep_event != NULL);
 
-	EventPipeProvider *provider = ep_event_get_provider (ep_event);
-	EventPipeSessionProviderList *session_provider_list = session->providers;
-	EventPipeSessionProvider *session_provider = ep_session_provider_list_find_by_name (ep_session_provider_list_get_providers (session_provider_list), ep_provider_get_provider_name (provider));
-	const EventPipeSessionProviderTracepoint *tracepoint = ep_session_provider_get_tracepoint_for_event (session_provider, ep_event);
+	// The provider and tracepoint lookups and the event specific parts of the write are cached per event,
+	// so a write with the tracepoint disabled costs a cache probe and a write with it enabled a single writev.
+	EventPipeSessionTracepointTemplate uncached_template;
+	const EventPipeSessionTracepointTemplate *tracepoint_template = session_tracepoint_get_template (session, ep_event, &uncached_template);
+	const EventPipeSessionProviderTracepoint *tracepoint = tracepoint_template->tracepoint;
 	if (tracepoint == NULL)
 		return false;
 
@@ -747,34 +1053,15 @@ session_tracepoint_write_event (
 
 	int io_index = 0;
 
-	// Write Index
-	uint32_t write_index = ep_session_provider_tracepoint_get_write_index (tracepoint);
-	io[io_index].iov_base = (void *)&write_index;
-	io[io_index].iov_len = sizeof(write_index);
-	io_index++;
-
-	// Version
-	uint8_t version = 0x01; // Format V1
-	io[io_index].iov_base = &version;
-	io[io_index].iov_len = sizeof(version);
-	io_index++;
-
-	// Truncated event id
-	// For parity with EventSource, there shouldn't be any that need more than 16 bits.
-	uint16_t truncated_event_id = ep_event_get_event_id (ep_event) & 0xFFFF;
-	io[io_index].iov_base = &truncated_event_id;
-	io[io_index].iov_len = sizeof(truncated_event_id);
+	// Write index, version and truncated event id
+	io[io_index].iov_base = (void *)tracepoint_template->header;
+	io[io_index].iov_len = sizeof(tracepoint_template->header);
 	io_index++;
 
 	// Extension and payload relative locations (to be fixed up later)
-	uint32_t extension_rel_loc = 0;
-	io[io_index].iov_base = &extension_rel_loc;
-	io[io_index].iov_len = sizeof(extension_rel_loc);
-	io_index++;
-
-	uint32_t payload_rel_loc = 0;
-	io[io_index].iov_base = &payload_rel_loc;
-	io[io_index].iov_len = sizeof(payload_rel_loc);
+	uint32_t rel_locs[2] = { 0 };
+	io[io_index].iov_base = rel_locs;
+	io[io_index].iov_len = sizeof(rel_locs);
 	io_index++;
 
 	// Extension
@@ -782,13 +1069,10 @@ session_tracepoint_write_event (
 
 	// Extension Event Metadata
 	uint32_t metadata_len = ep_event_get_metadata_len (ep_event);
-	uint8_t extension_metadata[1 + sizeof(uint32_t)];
-	extension_metadata[0] = 0x01; // label
-	*(uint32_t*)&extension_metadata[1] = metadata_len;
-	io[io_index].iov_base = extension_metadata;
-	io[io_index].iov_len = sizeof(extension_metadata);
+	io[io_index].iov_base = (void *)tracepoint_template->extension_metadata;
+	io[io_index].iov_len = sizeof(tracepoint_template->extension_metadata);
 	io_index++;
-	extension_len += sizeof(extension_metadata);
+	extension_len += sizeof(tracepoint_template->extension_metadata);
 
 	io[io_index].iov_base = (void *)ep_event_get_metadata (ep_event);
 	io[io_index].iov_len = metadata_len;
@@ -833,11 +1117,11 @@ session_tracepoint_write_event (
 	}
 
 	// Calculate the relative locations for extension and payload.
-	extension_rel_loc = extension_len << 16 | (sizeof(payload_rel_loc) & 0xFFFF);
-	payload_rel_loc = ep_event_payload_total_size << 16 | (extension_len & 0xFFFF);
+	rel_locs[0] = extension_len << 16 | (sizeof(rel_locs[1]) & 0xFFFF);
+	rel_locs[1] = ep_event_payload_total_size << 16 | (extension_len & 0xFFFF);
 
 	ssize_t bytes_written;
-	while ((bytes_written = writev(session->user_events_data_fd, (const struct iovec *)io, io_index) < 0) && errno == EINTR);
+	while ((bytes_written = writev(session->user_events_data_fd, (const struct iovec *)io, io_index)) < 0 && errno == EINTR);
 
 	if (io != static_io)
 		free (io);
@@ -883,6 +1167,9 @@ ep_session_write_event (
 
 	// Filter events specific to "this" session based on precomputed flag on provider/events.
 	if (ep_event_is_enabled_by_mask (ep_event, ep_session_get_mask (session))) {
+		if (session->has_counted_events && session_try_count_event (session, ep_event))
+			return true;
+
 		switch (session->session_type) {
 		case EP_SESSION_TYPE_FILE:
 		case EP_SESSION_TYPE_LISTENER:
@@ -1026,6 +1313,70 @@ ep_session_has_started (EventPipeSession *session)
 	return ep_rt_volatile_load_uint32_t (&session->started) == 1 ? true : false;
 }
 
+static
+bool
+session_try_count_event (
+	EventPipeSession *session,
+	EventPipeEvent *ep_event)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	EventPipeSessionProvider *session_provider = ep_session_provider_list_find_by_name (
+		ep_session_provider_list_get_providers (session->providers),
+		ep_provider_get_provider_name (ep_event_get_provider (ep_event)));
+
+	return session_provider != NULL && ep_session_provider_try_count_event (session_provider, ep_event_get_event_id (ep_event));
+}
+
+// Reports counted events once per EP_SESSION_COUNTED_EVENTS_INTERVAL_MS, returns how long the
+// streaming thread can wait for new data before reporting again.
+static
+uint32_t
+session_write_counted_events_if_due (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	if (!session->has_counted_events)
+		return EP_INFINITE_WAIT;
+
+	ep_timestamp_t now = ep_perf_timestamp_get ();
+	int64_t interval = (ep_perf_frequency_query () * EP_SESSION_COUNTED_EVENTS_INTERVAL_MS) / 1000;
+	if (now - session->counted_events_timestamp >= interval) {
+		session->counted_events_timestamp = now;
+		ep_session_write_counted_events (session);
+	}
+
+	return EP_SESSION_COUNTED_EVENTS_INTERVAL_MS;
+}
+
+void
+ep_session_write_counted_events (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_return_void_if_nok (session->has_counted_events);
+
+	// Counts are cumulative, reporting the same count twice when disable races with the
+	// streaming thread is harmless.
+	DN_LIST_FOREACH_BEGIN (EventPipeSessionProvider *, session_provider, ep_session_provider_list_get_providers (session->providers)) {
+		uint32_t event_ids [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+		int64_t counts [EP_SESSION_PROVIDER_MAX_COUNTED_EVENTS];
+		uint32_t len = ep_session_provider_get_changed_event_counts (session_provider, event_ids, counts, (uint32_t)ARRAY_SIZE (event_ids));
+		for (uint32_t i = 0; i < len; ++i)
+			ep_event_source_send_event_count (ep_event_source_get (), session, ep_session_provider_get_provider_name (session_provider), event_ids [i], (uint64_t)counts [i]);
+	} DN_LIST_FOREACH_END;
+}
+
+void
+ep_session_signal_shared_streaming_thread (void)
+{
+#ifndef PERFTRACING_DISABLE_THREADS
+	if (ep_rt_volatile_load_uint32_t (&_shared_streaming_thread_created) != 0)
+		ep_rt_wait_event_set (&_shared_streaming_wait_event);
+#endif
+}
+
 bool
 ep_session_type_uses_buffer_manager (EventPipeSessionType session_type)
 {
@@ -17,6 +17,24 @@
  * EventPipeSession.
  */
 
+// How often streaming sessions report counted events.
+#define EP_SESSION_COUNTED_EVENTS_INTERVAL_MS 1000
+
+// Slots in the per session cache of user_events write templates, and how many slots are probed per lookup.
+#define EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_SIZE 256
+#define EP_SESSION_TRACEPOINT_TEMPLATE_CACHE_PROBES 8
+
+// Parts of a user_events write that only depend on the event, computed once per event and session.
+struct _EventPipeSessionTracepointTemplate {
+	const EventPipeEvent *ep_event;
+	// NULL if the session has no tracepoint for the event.
+	const EventPipeSessionProviderTracepoint *tracepoint;
+	// Write index, format version and truncated event id.
+	uint8_t header [sizeof (uint32_t) + sizeof (uint8_t) + sizeof (uint16_t)];
+	// Extension metadata label and metadata length.
+	uint8_t extension_metadata [sizeof (uint8_t) + sizeof (uint32_t)];
+};
+
 //! Encapsulates an EventPipe session information and memory management.
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_GETTER_SETTER)
 struct _EventPipeSession {
@@ -67,10 +85,19 @@ struct _EventPipeSession_Internal {
 	bool enable_stackwalk;
 	// Indicate that session is fully running (streaming thread started).
 	volatile uint32_t started;
+	// When true, the session is streamed by the thread shared by all streaming sessions
+	// instead of having a streaming thread of its own.
+	bool shared_streaming;
+	// True if any session provider counts events instead of writing them, see EP_SESSION_PROVIDER_COUNTED_EVENT_IDS_KEY.
+	bool has_counted_events;
+	// Timestamp of the last time counted events were reported by the streaming thread.
+	ep_timestamp_t counted_events_timestamp;
 	// Reference count for the session. This is used to track the number of references to the session.
 	volatile uint32_t ref_count;
 	// The user_events_data file descriptor to register Tracepoints and write user_events to.
 	int user_events_data_fd;
+	// Templates for user_events writes, indexed by a hash of the event.
+	EventPipeSessionTracepointTemplate * volatile *tracepoint_templates;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_GETTER_SETTER)
@@ -88,6 +115,8 @@ EP_DEFINE_GETTER(EventPipeSession *, session, ep_timestamp_t, session_start_time
 EP_DEFINE_GETTER(EventPipeSession *, session, ep_timestamp_t, session_start_timestamp)
 EP_DEFINE_GETTER(EventPipeSession *, session, EventPipeFile *, file)
 EP_DEFINE_GETTER(EventPipeSession *, session, bool, enable_stackwalk)
+EP_DEFINE_GETTER(EventPipeSession *, session, bool, shared_streaming)
+EP_DEFINE_GETTER(EventPipeSession *, session, bool, has_counted_events)
 
 EventPipeSession *
 ep_session_alloc (
@@ -217,6 +246,14 @@ ep_session_resume (EventPipeSession *session);
 bool
 ep_session_has_started (EventPipeSession *session);
 
+// Writes an EventCount event for each counted event whose count changed since it was last reported.
+void
+ep_session_write_counted_events (EventPipeSession *session);
+
+// Wakes up the shared streaming thread, if running, because a session it services has new data.
+void
+ep_session_signal_shared_streaming_thread (void);
+
 bool
 ep_session_type_uses_buffer_manager (EventPipeSessionType session_type);
 
@@ -50,6 +50,7 @@ typedef struct _EventPipeThread EventPipeThread;
 typedef struct _EventPipeThreadHolder EventPipeThreadHolder;
 typedef struct _EventPipeThreadSessionState EventPipeThreadSessionState;
 typedef struct _EventPipeSessionProviderTracepoint EventPipeSessionProviderTracepoint;
+typedef struct _EventPipeSessionTracepointTemplate EventPipeSessionTracepointTemplate;
 typedef struct _FastSerializableObject FastSerializableObject;
 typedef struct _FastSerializableObjectVtable FastSerializableObjectVtable;
 typedef struct _FastSerializer FastSerializer;
@@ -145,6 +146,10 @@ typedef enum {
 	// Default format we plan to use in .Net Core 3 Preview7+
 	// for most if not all scenarios.
 	EP_SERIALIZATION_FORMAT_NETTRACE_V4,
+	// NetTrace V4 layout where the payload of event blocks can be
+	// compressed using the LZ4 block format. Compressed blocks are
+	// flagged in the block header so readers can tell them apart.
+	EP_SERIALIZATION_FORMAT_NETTRACE_V4_COMPRESSED,
 	EP_SERIALIZATION_FORMAT_COUNT
 } EventPipeSerializationFormat;
 
@@ -149,6 +149,9 @@ struct _EventPipeProviderCallbackDataQueue {
 struct _EventPipeProviderCallbackDataQueue_Internal {
 #endif
 	dn_queue_t *queue;
+	// Queue nodes and queued callback data are short lived, they are
+	// bump allocated and released together when the queue is finalized.
+	dn_allocator_arena_t allocator;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EP_GETTER_SETTER)
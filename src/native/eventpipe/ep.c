@@ -197,11 +197,23 @@ ep_event_filter_desc_free (EventFilterDescriptor * filter_desc)
  * EventPipeProviderCallbackDataQueue.
  */
 
+// Fits the queue and the callback data for a few dozen providers.
+#define EP_PROVIDER_CALLBACK_DATA_QUEUE_ARENA_CHUNK_SIZE 4096
+
+static
+void
+DN_CALLBACK_CALLTYPE
+provider_callback_data_queue_dispose_func (void *data)
+{
+	ep_provider_callback_data_fini ((EventPipeProviderCallbackData *)data);
+}
+
 EventPipeProviderCallbackDataQueue *
 ep_provider_callback_data_queue_init (EventPipeProviderCallbackDataQueue *provider_callback_data_queue)
 {
 	EP_ASSERT (provider_callback_data_queue != NULL);
-	provider_callback_data_queue->queue = dn_queue_alloc ();
+	dn_allocator_arena_init (&provider_callback_data_queue->allocator, EP_PROVIDER_CALLBACK_DATA_QUEUE_ARENA_CHUNK_SIZE);
+	provider_callback_data_queue->queue = dn_queue_custom_alloc ((dn_allocator_t *)&provider_callback_data_queue->allocator);
 	return provider_callback_data_queue->queue ? provider_callback_data_queue : NULL;
 }
 
@@ -209,8 +221,10 @@ void
 ep_provider_callback_data_queue_fini (EventPipeProviderCallbackDataQueue *provider_callback_data_queue)
 {
 	ep_return_void_if_nok (provider_callback_data_queue != NULL);
-	dn_queue_free (provider_callback_data_queue->queue);
+	// Queue memory lives in the arena, only data owned by callback data still in the queue needs to be released.
+	dn_queue_custom_free (provider_callback_data_queue->queue, provider_callback_data_queue_dispose_func);
 	provider_callback_data_queue->queue = NULL;
+	dn_allocator_arena_dispose (&provider_callback_data_queue->allocator);
 }
 
 /*
@@ -648,6 +662,9 @@ disable_holding_lock (
 		// Log the process information event.
 		log_process_info_event (ep_event_source_get ());
 
+		// Report the final counts of counted events while the session still accepts events.
+		ep_session_write_counted_events (session);
+
 		// Disable session tracing.
 		config_enable_disable (ep_config_get (), session, provider_callback_data_queue, false);
 
@@ -1729,14 +1746,18 @@ ep_provider_callback_data_queue_enqueue (
 	EventPipeProviderCallbackData *provider_callback_data)
 {
 	EP_ASSERT (provider_callback_data_queue != NULL);
-	EventPipeProviderCallbackData *provider_callback_data_move = ep_provider_callback_data_alloc_move (provider_callback_data);
+	EP_ASSERT (provider_callback_data != NULL);
+
+	EventPipeProviderCallbackData *provider_callback_data_move = (EventPipeProviderCallbackData *)dn_allocator_alloc ((dn_allocator_t *)&provider_callback_data_queue->allocator, sizeof (EventPipeProviderCallbackData));
 	ep_raise_error_if_nok (provider_callback_data_move != NULL);
+
+	// Move only after the push succeeded, so the caller keeps ownership on failure.
 	ep_raise_error_if_nok (dn_queue_push (ep_provider_callback_data_queue_get_queue (provider_callback_data_queue), provider_callback_data_move));
+	ep_provider_callback_data_init_move (provider_callback_data_move, provider_callback_data);
 
 	return true;
 
 ep_on_error:
-	ep_provider_callback_data_free (provider_callback_data_move);
 	return false;
 }
 
@@ -1754,8 +1775,8 @@ ep_provider_callback_data_queue_try_dequeue (
 	dn_queue_pop (queue);
 
 	ep_raise_error_if_nok (value != NULL);
+	// value is owned by the queue arena.
 	ep_provider_callback_data_init_move (provider_callback_data, value);
-	ep_provider_callback_data_free (value);
 
 	return true;
 
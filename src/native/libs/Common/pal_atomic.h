@@ -19,3 +19,13 @@ static int pal_atomic_cas_ptr(void* volatile* dest, void* exchange, void* compar
     return InterlockedCompareExchangePointer(dest, exchange, comparand) == comparand;
 #endif
 }
+
+// Reads the pointer with acquire semantics, so that writes made before it was published are visible
+static inline void* pal_atomic_load_acquire_ptr(void* const volatile* src)
+{
+#if defined(TARGET_UNIX) || defined(TARGET_WASI)
+    return __atomic_load_n(src, __ATOMIC_ACQUIRE);
+#elif defined(TARGET_WINDOWS)
+    return ReadPointerAcquire((PVOID const volatile*)src);
+#endif
+}
@@ -58,6 +58,9 @@ struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
     SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    // Set when the IgnoreCase collator treats every ASCII letter pair as equal, which lets
+    // CompareString answer ASCII case-insensitive equality without calling into ICU.
+    int32_t isAsciiIgnoreCaseEquivalent;
 };
 
 // Hiragana character range
@@ -443,10 +446,41 @@ static void CreateSortHandle(SortHandle** ppSortHandle)
     memset(*ppSortHandle, 0, sizeof(SortHandle));
 }
 
+static const UCollator* GetCollatorFromSortHandle(SortHandle* pSortHandle, int32_t options, UErrorCode* pErr);
+
+/*
+Clones the IgnoreCase collator up front, since it is by far the most common non-default option set,
+and probes whether it folds ASCII letters the same way ordinal ignore-case does (it doesn't for
+Turkic locales, where 'I' and 'i' are different letters).
+*/
+static void WarmSortHandle(SortHandle* pSortHandle)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, CompareOptionsIgnoreCase, &err);
+    if (U_FAILURE(err) || pColl == NULL)
+    {
+        return;
+    }
+
+    for (UChar ch = 'a'; ch <= 'z'; ch++)
+    {
+        UChar upper = (UChar)(ch - 'a' + 'A');
+        if (ucol_strcoll(pColl, &ch, 1, &upper, 1) != UCOL_EQUAL)
+        {
+            return;
+        }
+    }
+
+    pSortHandle->isAsciiIgnoreCaseEquivalent = true;
+}
+
 ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandle** ppSortHandle)
 {
     assert(ppSortHandle != NULL);
 
+    // All other collation entry points operate on a sort handle, so binding the group here covers them
+    EnsureICUFunctionGroupBound(ICUFunctionGroup_Collation);
+
     CreateSortHandle(ppSortHandle);
     if ((*ppSortHandle) == NULL)
     {
@@ -462,6 +496,10 @@ ResultCode GlobalizationNative_GetSortHandle(const char* lpLocaleName, SortHandl
         free(*ppSortHandle);
         (*ppSortHandle) = NULL;
     }
+    else
+    {
+        WarmSortHandle(*ppSortHandle);
+    }
 
     return GetResultCode(err);
 }
@@ -876,6 +914,48 @@ int32_t GlobalizationNative_GetSortVersion(SortHandle* pSortHandle)
     return result;
 }
 
+/*
+Returns true if the strings are known to compare equal without consulting ICU: identical code units
+always collate equal, and under IgnoreCase so do strings that differ only in ASCII letter case when
+the locale's collator was probed to agree (see WarmSortHandle).
+*/
+static int32_t AreEqualFastPath(
+    SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
+{
+    if (cwStr1Length != cwStr2Length || cwStr1Length < 0 || lpStr1 == NULL || lpStr2 == NULL)
+    {
+        return false;
+    }
+
+    if (options == 0)
+    {
+        return memcmp(lpStr1, lpStr2, (size_t)cwStr1Length * sizeof(UChar)) == 0;
+    }
+
+    if (options != CompareOptionsIgnoreCase || !pSortHandle->isAsciiIgnoreCaseEquivalent)
+    {
+        return false;
+    }
+
+    for (int32_t i = 0; i < cwStr1Length; i++)
+    {
+        UChar ch1 = lpStr1[i];
+        UChar ch2 = lpStr2[i];
+        if (ch1 == ch2)
+        {
+            continue;
+        }
+
+        // Only ASCII letters differing in case are folded here; anything else goes to ICU.
+        if ((ch1 | 0x20) != (ch2 | 0x20) || (UChar)((ch1 | 0x20) - 'a') > 'z' - 'a')
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /*
 Function:
 CompareString
@@ -883,6 +963,11 @@ CompareString
 int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
+    if (AreEqualFastPath(pSortHandle, lpStr1, cwStr1Length, lpStr2, cwStr2Length, options))
+    {
+        return UCOL_EQUAL;
+    }
+
     UCollationResult result = UCOL_EQUAL;
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
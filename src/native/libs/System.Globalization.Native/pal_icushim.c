@@ -18,6 +18,7 @@
 #include <assert.h>
 
 #include "pal_icushim.h"
+#include "pal_atomic.h"
 
 // Define pointers to all the used ICU functions
 #define PER_FUNCTION_BLOCK(fn, lib, required) TYPEOF(fn)* fn##_ptr;
@@ -47,6 +48,12 @@ static void* libicuuc = NULL;
 static void* libicui18n = NULL;
 ucol_safeClone_func ucol_safeClone_ptr = NULL;
 
+// The version suffix of the loaded ICU symbols, kept to bind the function groups on first use
+static char s_symbolVersion[MaxICUVersionStringWithSuffixLength + 1] = "";
+
+#define ICU_FUNCTION_GROUP_BOUND ((void*)1)
+static void* volatile s_icuFunctionGroupBound[ICUFunctionGroup_Count] = { NULL };
+
 #if defined (TARGET_UNIX)
 
 #define PER_FUNCTION_BLOCK(fn, lib, required) \
@@ -442,6 +449,13 @@ static void InitializeUColClonePointers(char* symbolVersion)
     }
 }
 
+static void SaveSymbolVersion(const char* symbolVersion)
+{
+    size_t symbolVersionLength = strlen(symbolVersion);
+    assert(symbolVersionLength < sizeof(s_symbolVersion));
+    memcpy(s_symbolVersion, symbolVersion, symbolVersionLength + 1);
+}
+
 // GlobalizationNative_LoadICU
 // This method get called from the managed side during the globalization initialization.
 // This method shouldn't get called at all if we are running in globalization invariant mode
@@ -476,10 +490,11 @@ int32_t GlobalizationNative_LoadICU(void)
 #if defined(ANDROID_FORCE_ICU_DATA_DIR)
     setenv ("ICU_DATA", "/system/usr/icu/", 0);
 #endif
-    FOR_ALL_ICU_FUNCTIONS
+    FOR_ALL_UNCONDITIONAL_ICU_FUNCTIONS
+    FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS
     ValidateICUDataCanLoad();
 
-    InitializeUColClonePointers(symbolVersion);
+    SaveSymbolVersion(symbolVersion);
 
     return true;
 }
@@ -532,10 +547,54 @@ void GlobalizationNative_InitICUFunctions(void* icuuc, void* icuin, const char*
         abort();
     }
 
-    FOR_ALL_ICU_FUNCTIONS
+    FOR_ALL_UNCONDITIONAL_ICU_FUNCTIONS
+    FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS
     ValidateICUDataCanLoad();
 
-    InitializeUColClonePointers(symbolVersion);
+    SaveSymbolVersion(symbolVersion);
+}
+
+static void BindICUFunctionGroup(ICUFunctionGroup group)
+{
+    char symbolName[SYMBOL_NAME_SIZE];
+    char* symbolVersion = s_symbolVersion;
+
+    switch (group)
+    {
+        case ICUFunctionGroup_Collation:
+        {
+            FOR_ALL_COLLATION_ICU_FUNCTIONS
+            FOR_ALL_OPTIONAL_ICU_FUNCTIONS
+            InitializeUColClonePointers(symbolVersion);
+            break;
+        }
+        case ICUFunctionGroup_Normalization:
+        {
+            FOR_ALL_NORMALIZATION_ICU_FUNCTIONS
+            break;
+        }
+        case ICUFunctionGroup_Idna:
+        {
+            FOR_ALL_IDNA_ICU_FUNCTIONS
+            break;
+        }
+        default:
+            assert(false && "Unknown ICU function group");
+            break;
+    }
+}
+
+void EnsureICUFunctionGroupBound(ICUFunctionGroup group)
+{
+    assert(group < ICUFunctionGroup_Count);
+
+    if (pal_atomic_load_acquire_ptr(&s_icuFunctionGroupBound[group]) == NULL)
+    {
+        // Threads that race here each resolve and store the same addresses, so there is no need for a lock.
+        // Publishing the flag afterwards with a full barrier makes the pointers visible to the acquiring readers.
+        BindICUFunctionGroup(group);
+        pal_atomic_cas_ptr(&s_icuFunctionGroupBound[group], ICU_FUNCTION_GROUP_BOUND, NULL);
+    }
 }
 
 #undef PER_FUNCTION_BLOCK
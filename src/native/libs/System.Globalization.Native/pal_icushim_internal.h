@@ -89,8 +89,6 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(u_tolower, libicuuc, true) \
     PER_FUNCTION_BLOCK(u_toupper, libicuuc, true) \
     PER_FUNCTION_BLOCK(u_uastrncpy, libicuuc, true) \
-    PER_FUNCTION_BLOCK(ubrk_close, libicuuc, true) \
-    PER_FUNCTION_BLOCK(ubrk_openRules, libicuuc, true) \
     PER_FUNCTION_BLOCK(ucal_add, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucal_close, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucal_get, libicui18n, true) \
@@ -105,21 +103,6 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(ucal_openTimeZoneIDEnumeration, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucal_set, libicui18n, true) \
     PER_FUNCTION_BLOCK(ucal_setMillis, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_close, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_closeElements, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_getOffset, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_getRules, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_getSortKey, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_getStrength, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_getVersion, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_next, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_previous, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_open, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_openElements, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_openRules, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_setAttribute, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_setMaxVariable, libicui18n, true) \
-    PER_FUNCTION_BLOCK(ucol_strcoll, libicui18n, true) \
     PER_FUNCTION_BLOCK(udat_close, libicui18n, true) \
     PER_FUNCTION_BLOCK(udat_countSymbols, libicui18n, true) \
     PER_FUNCTION_BLOCK(udat_format, libicui18n, true) \
@@ -133,10 +116,6 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(uenum_close, libicuuc, true) \
     PER_FUNCTION_BLOCK(uenum_count, libicuuc, true) \
     PER_FUNCTION_BLOCK(uenum_next, libicuuc, true) \
-    PER_FUNCTION_BLOCK(uidna_close, libicuuc, true) \
-    PER_FUNCTION_BLOCK(uidna_nameToASCII, libicuuc, true) \
-    PER_FUNCTION_BLOCK(uidna_nameToUnicode, libicuuc, true) \
-    PER_FUNCTION_BLOCK(uidna_openUTS46, libicuuc, true) \
     PER_FUNCTION_BLOCK(uloc_canonicalize, libicuuc, true) \
     PER_FUNCTION_BLOCK(uloc_countAvailable, libicuuc, true) \
     PER_FUNCTION_BLOCK(uloc_getAvailable, libicuuc, true) \
@@ -157,12 +136,6 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(uloc_setKeywordValue, libicuuc, true) \
     PER_FUNCTION_BLOCK(ulocdata_getCLDRVersion, libicui18n, true) \
     PER_FUNCTION_BLOCK(ulocdata_getMeasurementSystem, libicui18n, true) \
-    PER_FUNCTION_BLOCK(unorm2_getNFCInstance, libicuuc, true) \
-    PER_FUNCTION_BLOCK(unorm2_getNFDInstance, libicuuc, true) \
-    PER_FUNCTION_BLOCK(unorm2_getNFKCInstance, libicuuc, true) \
-    PER_FUNCTION_BLOCK(unorm2_getNFKDInstance, libicuuc, true) \
-    PER_FUNCTION_BLOCK(unorm2_isNormalized, libicuuc, true) \
-    PER_FUNCTION_BLOCK(unorm2_normalize, libicuuc, true) \
     PER_FUNCTION_BLOCK(unum_close, libicui18n, true) \
     PER_FUNCTION_BLOCK(unum_getAttribute, libicui18n, true) \
     PER_FUNCTION_BLOCK(unum_getSymbol, libicui18n, true) \
@@ -172,7 +145,28 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(ures_getByKey, libicuuc, true) \
     PER_FUNCTION_BLOCK(ures_getSize, libicuuc, true) \
     PER_FUNCTION_BLOCK(ures_getStringByIndex, libicuuc, true) \
-    PER_FUNCTION_BLOCK(ures_open, libicuuc, true) \
+    PER_FUNCTION_BLOCK(ures_open, libicuuc, true)
+
+// The functions in the following groups are only used by a single feature area, so rather than being bound
+// when ICU is loaded, they are bound by EnsureICUFunctionGroupBound on the first use of that area.
+#define FOR_ALL_COLLATION_ICU_FUNCTIONS \
+    PER_FUNCTION_BLOCK(ubrk_close, libicuuc, true) \
+    PER_FUNCTION_BLOCK(ubrk_openRules, libicuuc, true) \
+    PER_FUNCTION_BLOCK(ucol_close, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_closeElements, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getOffset, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getRules, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getSortKey, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getStrength, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_getVersion, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_next, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_previous, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_open, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_openElements, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_openRules, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_setAttribute, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_setMaxVariable, libicui18n, true) \
+    PER_FUNCTION_BLOCK(ucol_strcoll, libicui18n, true) \
     PER_FUNCTION_BLOCK(usearch_close, libicui18n, true) \
     PER_FUNCTION_BLOCK(usearch_first, libicui18n, true) \
     PER_FUNCTION_BLOCK(usearch_getBreakIterator, libicui18n, true) \
@@ -182,6 +176,20 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
     PER_FUNCTION_BLOCK(usearch_setPattern, libicui18n, true) \
     PER_FUNCTION_BLOCK(usearch_setText, libicui18n, true)
 
+#define FOR_ALL_NORMALIZATION_ICU_FUNCTIONS \
+    PER_FUNCTION_BLOCK(unorm2_getNFCInstance, libicuuc, true) \
+    PER_FUNCTION_BLOCK(unorm2_getNFDInstance, libicuuc, true) \
+    PER_FUNCTION_BLOCK(unorm2_getNFKCInstance, libicuuc, true) \
+    PER_FUNCTION_BLOCK(unorm2_getNFKDInstance, libicuuc, true) \
+    PER_FUNCTION_BLOCK(unorm2_isNormalized, libicuuc, true) \
+    PER_FUNCTION_BLOCK(unorm2_normalize, libicuuc, true)
+
+#define FOR_ALL_IDNA_ICU_FUNCTIONS \
+    PER_FUNCTION_BLOCK(uidna_close, libicuuc, true) \
+    PER_FUNCTION_BLOCK(uidna_nameToASCII, libicuuc, true) \
+    PER_FUNCTION_BLOCK(uidna_nameToUnicode, libicuuc, true) \
+    PER_FUNCTION_BLOCK(uidna_openUTS46, libicuuc, true)
+
 #if defined(TARGET_WINDOWS)
 #define FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS \
     PER_FUNCTION_BLOCK(ucurr_forLocale, libicuuc, true) \
@@ -202,13 +210,29 @@ extern ucol_safeClone_func ucol_safeClone_ptr;
 
 // The following are the list of the ICU APIs which are optional. If these APIs exist in the ICU version we load at runtime, then we'll use it.
 // Otherwise, we'll just not provide the functionality to users which needed these APIs.
+// ucol_clone is only used for collation, so it is bound along with the collation group.
 #define FOR_ALL_OPTIONAL_ICU_FUNCTIONS \
     PER_FUNCTION_BLOCK(ucol_clone, libicui18n, false)
 
 #define FOR_ALL_ICU_FUNCTIONS \
     FOR_ALL_UNCONDITIONAL_ICU_FUNCTIONS \
     FOR_ALL_OPTIONAL_ICU_FUNCTIONS \
-    FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS
+    FOR_ALL_OS_CONDITIONAL_ICU_FUNCTIONS \
+    FOR_ALL_COLLATION_ICU_FUNCTIONS \
+    FOR_ALL_NORMALIZATION_ICU_FUNCTIONS \
+    FOR_ALL_IDNA_ICU_FUNCTIONS
+
+typedef enum
+{
+    ICUFunctionGroup_Collation,
+    ICUFunctionGroup_Normalization,
+    ICUFunctionGroup_Idna,
+    ICUFunctionGroup_Count
+} ICUFunctionGroup;
+
+// Binds the pointers of the given function group if that has not been done yet. Must be called
+// by the entry points of a feature area before any of the functions of its group are used.
+void EnsureICUFunctionGroupBound(ICUFunctionGroup group);
 
 // Declare pointers to all the used ICU functions
 #define PER_FUNCTION_BLOCK(fn, lib, required) EXTERN_C TYPEOF(fn)* fn##_ptr;
@@ -328,6 +352,9 @@ FOR_ALL_ICU_FUNCTIONS
 
 #else // !defined(STATIC_ICU)
 
+// ICU is linked statically, so all functions are bound already
+#define EnsureICUFunctionGroupBound(group)
+
 #if defined(TARGET_MACCATALYST) || defined(TARGET_IOS) || defined(TARGET_TVOS)
 const char* GlobalizationNative_GetICUDataPathRelativeToAppBundleRoot(const char* path);
 const char* GlobalizationNative_GetICUDataPathFallback(void);
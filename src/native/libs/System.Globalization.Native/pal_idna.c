@@ -57,6 +57,8 @@ Return values:
 int32_t GlobalizationNative_ToAscii(
     uint32_t flags, const UChar* lpSrc, int32_t cwSrcLength, UChar* lpDst, int32_t cwDstLength)
 {
+    EnsureICUFunctionGroupBound(ICUFunctionGroup_Idna);
+
     UErrorCode err = U_ZERO_ERROR;
     UIDNAInfo info = UIDNA_INFO_INITIALIZER;
 
@@ -86,6 +88,8 @@ Return values:
 int32_t GlobalizationNative_ToUnicode(
     uint32_t flags, const UChar* lpSrc, int32_t cwSrcLength, UChar* lpDst, int32_t cwDstLength)
 {
+    EnsureICUFunctionGroupBound(ICUFunctionGroup_Idna);
+
     UErrorCode err = U_ZERO_ERROR;
     UIDNAInfo info = UIDNA_INFO_INITIALIZER;
 
@@ -42,6 +42,8 @@ Return values:
 int32_t GlobalizationNative_IsNormalized(
     NormalizationForm normalizationForm, const UChar* lpStr, int32_t cwStrLength)
 {
+    EnsureICUFunctionGroupBound(ICUFunctionGroup_Normalization);
+
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
     UBool isNormalized = unorm2_isNormalized(pNormalizer, lpStr, cwStrLength, &err);
@@ -71,6 +73,8 @@ Return values:
 int32_t GlobalizationNative_NormalizeString(
     NormalizationForm normalizationForm, const UChar* lpSrc, int32_t cwSrcLength, UChar* lpDst, int32_t cwDstLength)
 {
+    EnsureICUFunctionGroupBound(ICUFunctionGroup_Normalization);
+
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
     int32_t normalizedLen = unorm2_normalize(pNormalizer, lpSrc, cwSrcLength, lpDst, cwDstLength, &err);
@@ -26,12 +26,15 @@ static const Entry s_compressionNative[] =
     DllImportEntry(BrotliEncoderSetParameter)
     DllImportEntry(CompressionNative_Crc32)
     DllImportEntry(CompressionNative_Deflate)
+    DllImportEntry(CompressionNative_DeflateBuffer)
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateSegments)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
     DllImportEntry(CompressionNative_InflateReset2_)
+    DllImportEntry(CompressionNative_InflateSegments)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
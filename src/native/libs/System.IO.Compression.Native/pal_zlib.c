@@ -29,6 +29,10 @@ c_static_assert(PAL_Z_BESTSPEED == Z_BEST_SPEED);
 c_static_assert(PAL_Z_DEFAULTCOMPRESSION == Z_DEFAULT_COMPRESSION);
 
 c_static_assert(PAL_Z_DEFAULTSTRATEGY == Z_DEFAULT_STRATEGY);
+c_static_assert(PAL_Z_FILTERED == Z_FILTERED);
+c_static_assert(PAL_Z_HUFFMANONLY == Z_HUFFMAN_ONLY);
+c_static_assert(PAL_Z_RLE == Z_RLE);
+c_static_assert(PAL_Z_FIXED == Z_FIXED);
 
 c_static_assert(PAL_Z_DEFLATED == Z_DEFLATED);
 
@@ -133,6 +137,126 @@ int32_t CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush)
     return result;
 }
 
+/*
+Runs deflate or inflate over the input segments into the output segments, moving to the next segment
+whenever zlib has drained or filled the current one.
+*/
+static int32_t ProcessSegments(
+    z_stream* zStream, int isInflate, PAL_ZSegment* input, int32_t inputCount, PAL_ZSegment* output, int32_t outputCount, int32_t flush, int64_t* totalIn, int64_t* totalOut)
+{
+    int32_t inputIndex = 0, outputIndex = 0;
+    int32_t result = PAL_Z_OK;
+
+    *totalIn = 0;
+    *totalOut = 0;
+    zStream->avail_in = 0;
+    zStream->avail_out = 0;
+
+    while (1)
+    {
+        while (zStream->avail_in == 0 && inputIndex < inputCount)
+        {
+            zStream->next_in = input[inputIndex].data;
+            zStream->avail_in = input[inputIndex].length;
+            inputIndex++;
+        }
+
+        int lastInput = inputIndex == inputCount;
+        if (lastInput && zStream->avail_in == 0 && zStream->avail_out != 0 && result == PAL_Z_OK && flush == PAL_Z_NOFLUSH)
+        {
+            break; // all input consumed and nothing is pending
+        }
+
+        while (zStream->avail_out == 0 && outputIndex < outputCount)
+        {
+            zStream->next_out = output[outputIndex].data;
+            zStream->avail_out = output[outputIndex].length;
+            outputIndex++;
+        }
+
+        if (zStream->avail_out == 0)
+        {
+            result = PAL_Z_BUFERROR;
+            break;
+        }
+
+        uInt availIn = zStream->avail_in;
+        uInt availOut = zStream->avail_out;
+        result = isInflate ? inflate(zStream, lastInput ? flush : Z_NO_FLUSH) : deflate(zStream, lastInput ? flush : Z_NO_FLUSH);
+        *totalIn += availIn - zStream->avail_in;
+        *totalOut += availOut - zStream->avail_out;
+
+        if (result == PAL_Z_BUFERROR)
+        {
+            // No progress was possible: either the last input is exhausted or output is full, handled above
+            result = PAL_Z_OK;
+            if (lastInput && zStream->avail_in == 0 && zStream->avail_out != 0)
+            {
+                break;
+            }
+        }
+        else if (result != PAL_Z_OK)
+        {
+            break; // PAL_Z_STREAMEND or an error
+        }
+        else if (lastInput && zStream->avail_in == 0 && zStream->avail_out != 0 && flush == PAL_Z_NOFLUSH)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* input, int32_t inputCount, PAL_ZSegment* output, int32_t outputCount, int32_t flush, int64_t* totalIn, int64_t* totalOut)
+{
+    assert(stream != NULL);
+    assert(inputCount == 0 || input != NULL);
+    assert(outputCount == 0 || output != NULL);
+    assert(totalIn != NULL && totalOut != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = ProcessSegments(zStream, 0, input, inputCount, output, outputCount, flush, totalIn, totalOut);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
+int32_t CompressionNative_DeflateBuffer(
+    uint8_t* destination, int32_t* destinationLength, uint8_t* source, int32_t sourceLength, int32_t level, int32_t windowBits, int32_t memLevel, int32_t strategy)
+{
+    assert(destination != NULL && destinationLength != NULL && *destinationLength >= 0);
+    assert(source != NULL && sourceLength >= 0);
+
+    z_stream zStream = { 0 };
+    int32_t result = deflateInit2(&zStream, level, Z_DEFLATED, windowBits, memLevel, strategy);
+    if (result != PAL_Z_OK)
+    {
+        *destinationLength = 0;
+        return result;
+    }
+
+    zStream.next_in = source;
+    zStream.avail_in = (uInt)sourceLength;
+    zStream.next_out = destination;
+    zStream.avail_out = (uInt)*destinationLength;
+
+    // With the whole input available zlib picks its best match strategy for the buffer in one pass
+    result = deflate(&zStream, Z_FINISH);
+    *destinationLength = (int32_t)zStream.total_out;
+    deflateEnd(&zStream);
+
+    if (result == PAL_Z_STREAMEND)
+    {
+        return PAL_Z_OK;
+    }
+
+    // Z_OK or Z_BUF_ERROR here both mean the output didn't fit
+    *destinationLength = 0;
+    return result == PAL_Z_OK || result == PAL_Z_BUFERROR ? PAL_Z_BUFERROR : result;
+}
+
 int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -170,6 +294,21 @@ int32_t CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush)
     return result;
 }
 
+int32_t CompressionNative_InflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* input, int32_t inputCount, PAL_ZSegment* output, int32_t outputCount, int32_t flush, int64_t* totalIn, int64_t* totalOut)
+{
+    assert(stream != NULL);
+    assert(inputCount == 0 || input != NULL);
+    assert(outputCount == 0 || output != NULL);
+    assert(totalIn != NULL && totalOut != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = ProcessSegments(zStream, 1, input, inputCount, output, outputCount, flush, totalIn, totalOut);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
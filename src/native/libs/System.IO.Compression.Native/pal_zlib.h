@@ -30,6 +30,16 @@ typedef struct PAL_ZStream
     uint32_t availOut; // remaining free space at nextOut
 } PAL_ZStream;
 
+/*
+One input or output segment for the DeflateSegments and InflateSegments functions.
+*/
+typedef struct PAL_ZSegment
+{
+    uint8_t* data;   // start of the segment
+    uint32_t length; // number of bytes in the segment
+    uint32_t padding;
+} PAL_ZSegment;
+
 /*
 Allowed flush values for the Deflate and Inflate functions.
 */
@@ -68,7 +78,11 @@ Compression strategy
 */
 enum PAL_CompressionStrategy
 {
-    PAL_Z_DEFAULTSTRATEGY = 0
+    PAL_Z_DEFAULTSTRATEGY = 0,
+    PAL_Z_FILTERED = 1,
+    PAL_Z_HUFFMANONLY = 2,
+    PAL_Z_RLE = 3,
+    PAL_Z_FIXED = 4
 };
 
 /*
@@ -95,6 +109,26 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush);
 
+/*
+Deflates the input segments in order into the output segments in order, applying flush only once the
+last input segment has been handed to zlib. totalIn and totalOut receive the number of bytes consumed
+from the input segments and written to the output segments.
+
+Returns PAL_Z_OK once all input is consumed (PAL_Z_STREAMEND once the stream is finished for PAL_Z_FINISH),
+PAL_Z_BUFERROR if the output segments filled up first, or another PAL_ErrorCode on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* input, int32_t inputCount, PAL_ZSegment* output, int32_t outputCount, int32_t flush, int64_t* totalIn, int64_t* totalOut);
+
+/*
+Compresses sourceLength bytes at source into destination in a single call. destinationLength holds the
+size of destination on input and receives the compressed size.
+
+Returns PAL_Z_OK on success, PAL_Z_BUFERROR if destination is too small, or another PAL_ErrorCode on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateBuffer(
+    uint8_t* destination, int32_t* destinationLength, uint8_t* source, int32_t sourceLength, int32_t level, int32_t windowBits, int32_t memLevel, int32_t strategy);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
@@ -117,6 +151,15 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_Inflate(PAL_ZStream* stream, int32_t flush);
 
+/*
+Inflates the input segments in order into the output segments in order; see DeflateSegments.
+
+Returns PAL_Z_OK once all input is consumed, PAL_Z_STREAMEND at the end of the compressed stream,
+PAL_Z_BUFERROR if the output segments filled up first, or another PAL_ErrorCode on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_InflateSegments(
+    PAL_ZStream* stream, PAL_ZSegment* input, int32_t inputCount, PAL_ZSegment* output, int32_t outputCount, int32_t flush, int64_t* totalIn, int64_t* totalOut);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
@@ -67,6 +67,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmOpen)
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_ReadDir)
+    DllImportEntry(SystemNative_ReadDirBatch)
+    DllImportEntry(SystemNative_LStatAtBatch)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -164,6 +166,14 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ReceiveSocketError)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_EnableZeroCopySend)
+    DllImportEntry(SystemNative_SendZeroCopy)
+    DllImportEntry(SystemNative_ReceiveZeroCopyCompletion)
+    DllImportEntry(SystemNative_ReceiveMessages)
+    DllImportEntry(SystemNative_SendMessages)
+    DllImportEntry(SystemNative_SetUdpSegmentation)
+    DllImportEntry(SystemNative_GetUdpSegmentControlMessageBufferSize)
+    DllImportEntry(SystemNative_TryGetUdpReceiveSegmentSize)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -186,7 +196,14 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_CreateSocketEventBuffer)
     DllImportEntry(SystemNative_FreeSocketEventBuffer)
     DllImportEntry(SystemNative_TryChangeSocketEventRegistration)
+    DllImportEntry(SystemNative_TryChangeSocketEventRegistrations)
     DllImportEntry(SystemNative_WaitForSocketEvents)
+    DllImportEntry(SystemNative_CreateSocketIoRing)
+    DllImportEntry(SystemNative_CloseSocketIoRing)
+    DllImportEntry(SystemNative_QueueSocketIoRingOperations)
+    DllImportEntry(SystemNative_SubmitAndWaitSocketIoRing)
+    DllImportEntry(SystemNative_RegisterSocketIoRingFiles)
+    DllImportEntry(SystemNative_RegisterSocketIoRingBuffers)
     DllImportEntry(SystemNative_GetWasiSocketDescriptor)
     DllImportEntry(SystemNative_PlatformSupportsDualModeIPv4PacketInfo)
     DllImportEntry(SystemNative_GetDomainSocketSizes)
@@ -70,6 +70,9 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #include <procfs.h>
 #endif
 
+#if HAVE_GETDENTS64
+#include <sys/syscall.h>
+#endif
 #ifdef __linux__
 #include <sys/utsname.h>
 
@@ -103,10 +106,12 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #define stat_ stat64
 #define fstat_ fstat64
 #define lstat_ lstat64
+#define fstatat_ fstatat64
 #else /* HAVE_STAT64 */
 #define stat_ stat
 #define fstat_ fstat
 #define lstat_ lstat
+#define fstatat_ fstatat
 #endif  /* HAVE_STAT64 */
 
 // These numeric values are specified by POSIX.
@@ -527,6 +532,170 @@ int32_t SystemNative_ReadDir(DIR* dir, DirectoryEntry* outputEntry)
     return 0;
 }
 
+#if HAVE_GETDENTS64
+// getdents64 records; glibc only declares the struct and wrapper starting with 2.30.
+struct pal_linux_dirent64
+{
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+// Stores one entry in the batch. Returns false if the entry doesn't fit.
+static bool AddDirectoryBatchEntry(DirectoryBatchEntry* entries, int32_t count, char* nameBuffer, int32_t nameBufferSize, int32_t* nameBufferUsed,
+                                   uint64_t inode, int32_t inodeType, const char* name)
+{
+    size_t nameLength = strlen(name);
+    if (nameLength + 1 > (size_t)(nameBufferSize - *nameBufferUsed))
+    {
+        return false;
+    }
+
+    memcpy(nameBuffer + *nameBufferUsed, name, nameLength + 1);
+    entries[count].Inode = inode;
+    entries[count].NameOffset = *nameBufferUsed;
+    entries[count].NameLength = (int32_t)nameLength;
+#if !defined(DT_UNKNOWN) || defined(TARGET_WASM)
+    (void)inodeType;
+    entries[count].InodeType = PAL_DT_UNKNOWN;   // see ConvertDirent
+#else
+    entries[count].InodeType = inodeType;
+#endif
+    entries[count].Padding = 0;
+    *nameBufferUsed += (int32_t)nameLength + 1;
+    return true;
+}
+
+int32_t SystemNative_ReadDirBatch(DIR* dir, DirectoryBatchEntry* entries, int32_t maxEntries, char* nameBuffer, int32_t nameBufferSize, int32_t* entryCount)
+{
+    assert(dir != NULL);
+    assert(entries != NULL);
+    assert(nameBuffer != NULL);
+    assert(entryCount != NULL);
+
+    *entryCount = 0;
+    if (maxEntries <= 0 || nameBufferSize <= 0)
+    {
+        return EINVAL;
+    }
+
+    int32_t count = 0;
+    int32_t nameBufferUsed = 0;
+
+#if HAVE_GETDENTS64
+    int fd = dirfd(dir);
+    char buffer[32 * 1024];
+
+    while (count < maxEntries)
+    {
+        // Position of the next unconsumed entry, used to rewind when the caller's buffers fill up mid-read.
+        off_t resumeOffset = lseek(fd, 0, SEEK_CUR);
+        long read;
+        while ((read = syscall(SYS_getdents64, fd, buffer, sizeof(buffer))) < 0 && errno == EINTR);
+        if (read < 0)
+        {
+            return count > 0 ? 0 : errno;
+        }
+        if (read == 0)
+        {
+            break; // end-of-stream
+        }
+
+        for (long offset = 0; offset < read; )
+        {
+            struct pal_linux_dirent64* entry = (struct pal_linux_dirent64*)(buffer + offset);
+            if (count == maxEntries ||
+                !AddDirectoryBatchEntry(entries, count, nameBuffer, nameBufferSize, &nameBufferUsed, entry->d_ino, (int32_t)entry->d_type, entry->d_name))
+            {
+                if (count == 0)
+                {
+                    return ENAMETOOLONG;
+                }
+
+                // Rewind so the next call starts with this entry.
+                if (lseek(fd, resumeOffset, SEEK_SET) < 0)
+                {
+                    return errno;
+                }
+                *entryCount = count;
+                return 0;
+            }
+            count++;
+            resumeOffset = (off_t)entry->d_off;
+            offset += entry->d_reclen;
+        }
+    }
+#else
+    // The caller must not interleave SystemNative_ReadDir calls; the same stream position is shared.
+    while (count < maxEntries)
+    {
+        errno = 0;
+        long position = telldir(dir);
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            if (errno != 0 && count == 0)
+            {
+                return errno;
+            }
+            break;
+        }
+
+#if !defined(DT_UNKNOWN) || defined(TARGET_WASM)
+        int32_t inodeType = PAL_DT_UNKNOWN;
+#else
+        int32_t inodeType = (int32_t)entry->d_type;
+#endif
+        if (!AddDirectoryBatchEntry(entries, count, nameBuffer, nameBufferSize, &nameBufferUsed, (uint64_t)entry->d_ino, inodeType, entry->d_name))
+        {
+            if (count == 0)
+            {
+                return ENAMETOOLONG;
+            }
+            seekdir(dir, position);
+            break;
+        }
+        count++;
+    }
+#endif
+
+    *entryCount = count;
+    return 0;
+}
+
+int32_t SystemNative_LStatAtBatch(DIR* dir, const char* nameBuffer, const DirectoryBatchEntry* entries, int32_t count, FileStatus* outputs, int32_t* errors)
+{
+    assert(dir != NULL);
+    assert(nameBuffer != NULL);
+    assert(entries != NULL);
+    assert(outputs != NULL);
+    assert(errors != NULL);
+
+    int fd = dirfd(dir);
+    for (int32_t i = 0; i < count; i++)
+    {
+        struct stat_ result;
+        int ret;
+        while ((ret = fstatat_(fd, nameBuffer + entries[i].NameOffset, &result, AT_SYMLINK_NOFOLLOW)) < 0 && errno == EINTR);
+
+        if (ret == 0)
+        {
+            ConvertFileStatus(&result, &outputs[i]);
+            errors[i] = 0;
+        }
+        else
+        {
+            memset(&outputs[i], 0, sizeof(outputs[i]));
+            errors[i] = errno;
+        }
+    }
+
+    return 0;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
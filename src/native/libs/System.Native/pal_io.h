@@ -300,6 +300,18 @@ typedef struct
     int32_t InodeType; // The inode type as described in the NodeType enum
 } DirectoryEntry;
 
+/**
+ * One entry returned by SystemNative_ReadDirBatch; the name lives in the caller's name buffer
+ */
+typedef struct
+{
+    uint64_t Inode;     // The inode number of the entry
+    int32_t NameOffset; // Offset of the null-terminated name in the name buffer
+    int32_t NameLength; // Length (in chars) of the inode name, excluding the terminator
+    int32_t InodeType;  // The inode type as described in the NodeType enum
+    int32_t Padding;    // Unused; keeps the struct size identical on all platforms
+} DirectoryBatchEntry;
+
 /**
 * Constants passed in the mask argument of INotifyAddWatch which identify inotify events.
 */
@@ -404,6 +416,23 @@ PALEXPORT int32_t SystemNative_ShmUnlink(const char* name);
  */
 PALEXPORT int32_t SystemNative_ReadDir(DIR* dir, DirectoryEntry* outputEntry);
 
+/**
+ * Reads up to maxEntries dirents from the directory stream pointed to by dir, copying their names into nameBuffer.
+ * On Linux this reads the directory with getdents64 directly instead of one readdir call per entry.
+ * Must not be mixed with SystemNative_ReadDir on the same stream.
+ *
+ * Returns 0 on success and sets entryCount; an entryCount of 0 means end-of-stream. Returns an error code on failure.
+ */
+PALEXPORT int32_t SystemNative_ReadDirBatch(DIR* dir, DirectoryBatchEntry* entries, int32_t maxEntries, char* nameBuffer, int32_t nameBufferSize, int32_t* entryCount);
+
+/**
+ * lstats each entry returned by SystemNative_ReadDirBatch relative to the directory stream, without following symlinks.
+ * errors[i] receives 0 or the errno for entries[i].
+ *
+ * Returns 0.
+ */
+PALEXPORT int32_t SystemNative_LStatAtBatch(DIR* dir, const char* nameBuffer, const DirectoryBatchEntry* entries, int32_t count, FileStatus* outputs, int32_t* errors);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -26,6 +26,11 @@
 #include <sys/poll.h>
 #include <sys/select.h>
 #endif
+#if HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 #if HAVE_SYS_PROCINFO_H
 #include <sys/proc_info.h>
 #include <libproc.h>
@@ -34,12 +39,16 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 #if HAVE_NET_IF_H
 #include <net/if.h>
 #endif
 #include <string.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #if HAVE_SYS_SOCKIO_H
 #include <sys/sockio.h>
 #endif
@@ -1561,6 +1570,115 @@ int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageH
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define HAVE_ZEROCOPY_SEND 1
+#else
+#define HAVE_ZEROCOPY_SEND 0
+#endif
+
+int32_t SystemNative_EnableZeroCopySend(intptr_t socket)
+{
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+    int value = 1;
+    return setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
+{
+#if HAVE_ZEROCOPY_SEND
+    if (buffer == NULL || bufferLen < 0 || sent == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    ssize_t res;
+    while ((res = send(fd, buffer, (size_t)bufferLen, socketFlags | MSG_ZEROCOPY | MSG_NOSIGNAL)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *sent = (int32_t)res;
+        return Error_SUCCESS;
+    }
+
+    *sent = 0;
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    (void)buffer;
+    (void)bufferLen;
+    (void)flags;
+    if (sent != NULL)
+    {
+        *sent = 0;
+    }
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* first, uint32_t* last, int32_t* copied)
+{
+    if (first == NULL || last == NULL || copied == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    *first = 0;
+    *last = 0;
+    *copied = 0;
+
+#if HAVE_ZEROCOPY_SEND
+    int fd = ToFileDescriptor(socket);
+
+    char control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t res;
+    while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+    if (res == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != NULL; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+            (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))
+        {
+            struct sock_extended_err* e = (struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (e->ee_origin == SO_EE_ORIGIN_ZEROCOPY && e->ee_errno == 0)
+            {
+                // The notification covers the range of sends [ee_info, ee_data]
+                *first = e->ee_info;
+                *last = e->ee_data;
+                *copied = (e->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0 ? 1 : 0;
+                return Error_SUCCESS;
+            }
+        }
+    }
+
+    // Some other error queue entry (e.g. ICMP) was consumed
+    return Error_EAGAIN;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
 int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received)
 {
     if (messageHeader == NULL || received == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -1691,6 +1809,255 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// The mmsghdr arrays are built on the stack in chunks of this many messages.
+#define MAX_MESSAGES_PER_CALL 64
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t count, int32_t flags, int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || received == NULL || messagesReceived == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesReceived = 0;
+
+#if HAVE_RECVMMSG && defined(MSG_WAITFORONE) && defined(CMSG_SPACE)
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MAX_MESSAGES_PER_CALL];
+    int32_t total = 0;
+    while (total < count)
+    {
+        int32_t chunk = Min(count - total, MAX_MESSAGES_PER_CALL);
+        for (int32_t i = 0; i < chunk; i++)
+        {
+            ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[total + i], fd);
+            headers[i].msg_len = 0;
+        }
+
+        // Only wait for the first message; later chunks never wait.
+        int res;
+        int chunkFlags = total == 0 ? (socketFlags | MSG_WAITFORONE) : (socketFlags | MSG_DONTWAIT);
+        while ((res = recvmmsg(fd, headers, (unsigned int)chunk, chunkFlags, NULL)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (total > 0)
+            {
+                break;
+            }
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (int32_t i = 0; i < res; i++)
+        {
+            MessageHeader* messageHeader = &messageHeaders[total + i];
+            struct msghdr* header = &headers[i].msg_hdr;
+            messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+            messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+            messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+            received[total + i] = headers[i].msg_len;
+        }
+
+        total += res;
+        if (res < chunk)
+        {
+            break;
+        }
+    }
+
+    *messagesReceived = total;
+    return Error_SUCCESS;
+#else
+    // One receive per message; only the first one may wait.
+    int32_t total = 0;
+    for (; total < count; total++)
+    {
+        int32_t error = SystemNative_ReceiveMessage(socket, &messageHeaders[total], total == 0 ? flags : (flags | SocketFlags_MSG_DONTWAIT), &received[total]);
+        if (error != Error_SUCCESS)
+        {
+            if (total > 0)
+            {
+                break;
+            }
+            return error;
+        }
+    }
+
+    *messagesReceived = total;
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t count, int32_t flags, int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sent == NULL || messagesSent == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesSent = 0;
+
+#if HAVE_SENDMMSG && defined(CMSG_SPACE)
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MAX_MESSAGES_PER_CALL];
+    int32_t total = 0;
+    while (total < count)
+    {
+        int32_t chunk = Min(count - total, MAX_MESSAGES_PER_CALL);
+        for (int32_t i = 0; i < chunk; i++)
+        {
+            ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[total + i], fd);
+            headers[i].msg_len = 0;
+        }
+
+        int res;
+        while ((res = sendmmsg(fd, headers, (unsigned int)chunk, socketFlags)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (total > 0)
+            {
+                break;
+            }
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (int32_t i = 0; i < res; i++)
+        {
+            sent[total + i] = headers[i].msg_len;
+        }
+
+        total += res;
+        if (res < chunk)
+        {
+            break;
+        }
+    }
+
+    *messagesSent = total;
+    return Error_SUCCESS;
+#else
+    int32_t total = 0;
+    for (; total < count; total++)
+    {
+        int32_t error = SystemNative_SendMessage(socket, &messageHeaders[total], flags, &sent[total]);
+        if (error != Error_SUCCESS)
+        {
+            if (total > 0)
+            {
+                break;
+            }
+            return error;
+        }
+    }
+
+    *messagesSent = total;
+    return Error_SUCCESS;
+#endif
+}
+
+int32_t SystemNative_SetUdpSegmentation(intptr_t socket, int32_t segmentSize, int32_t enableReceiveCoalescing)
+{
+#if defined(UDP_SEGMENT) && defined(UDP_GRO)
+    if (segmentSize < 0)
+    {
+        return Error_EINVAL;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int value = segmentSize;
+    if (setsockopt(fd, IPPROTO_UDP, UDP_SEGMENT, &value, sizeof(value)) != 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    value = enableReceiveCoalescing != 0 ? 1 : 0;
+    if (setsockopt(fd, IPPROTO_UDP, UDP_GRO, &value, sizeof(value)) != 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    (void)segmentSize;
+    (void)enableReceiveCoalescing;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_GetUdpSegmentControlMessageBufferSize(void)
+{
+#if defined(UDP_GRO) && defined(CMSG_SPACE)
+    return CMSG_SPACE(sizeof(int));
+#else
+    return 0;
+#endif
+}
+
+int32_t SystemNative_TryGetUdpReceiveSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+    *segmentSize = 0;
+
+#if defined(UDP_GRO) && defined(CMSG_SPACE)
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO &&
+            controlMessage->cmsg_len >= CMSG_LEN(sizeof(int)))
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(value));
+            *segmentSize = value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -3133,6 +3500,19 @@ static int32_t TryChangeSocketEventRegistrationInner(
     return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+static void TryChangeSocketEventRegistrationsInner(int32_t port, SocketEventRegistrationChange* changes, int32_t count)
+{
+    // epoll has no batched form of epoll_ctl
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (changes[i].Error == Error_SUCCESS && changes[i].CurrentEvents != changes[i].NewEvents)
+        {
+            changes[i].Error = TryChangeSocketEventRegistrationInner(
+                port, ToFileDescriptor(changes[i].Socket), (SocketEvents)changes[i].CurrentEvents, (SocketEvents)changes[i].NewEvents, changes[i].Data);
+        }
+    }
+}
+
 static void ConvertEventEPollToSocketAsync(SocketEvent* sae, struct epoll_event* epoll)
 {
     assert(sae != NULL);
@@ -3326,24 +3706,112 @@ static int32_t TryChangeSocketEventRegistrationInner(
     return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
-static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
+static void TryChangeSocketEventRegistrationsInner(int32_t port, SocketEventRegistrationChange* changes, int32_t count)
 {
-    assert(buffer != NULL);
-    assert(count != NULL);
-    assert(*count >= 0);
+#if defined(EV_RECEIPT) && !defined(__FreeBSD__)
+    // Each change needs at most two kevents (read and write filters). With EV_RECEIPT every kevent
+    // is returned in the event list, in order, with EV_ERROR set and data holding its errno or 0.
+    enum { MaxChangesPerCall = 64 };
+    struct kevent events[MaxChangesPerCall * 2];
+    struct kevent receipts[MaxChangesPerCall * 2];
+    int32_t eventChange[MaxChangesPerCall * 2];
+
+    int32_t next = 0;
+    while (next < count)
+    {
+        int n = 0;
+        for (; next < count && n + 2 <= MaxChangesPerCall * 2; next++)
+        {
+            SocketEventRegistrationChange* change = &changes[next];
+            if (change->Error != Error_SUCCESS || change->CurrentEvents == change->NewEvents)
+            {
+                continue;
+            }
 
-    struct kevent* events = (struct kevent*)buffer;
-    int numEvents;
-    while ((numEvents = kevent(port, NULL, 0, events, GetKeventNchanges(*count), NULL)) < 0 && errno == EINTR);
-    if (numEvents == -1)
-    {
-        *count = -1;
-        return SystemNative_ConvertErrorPlatformToPal(errno);
-    }
+            int32_t changed = change->CurrentEvents ^ change->NewEvents;
+            if ((changed & SocketEvents_SA_READ) != 0)
+            {
+                eventChange[n] = next;
+                EV_SET(&events[n++],
+                       (uint64_t)ToFileDescriptor(change->Socket),
+                       EVFILT_READ,
+                       (change->NewEvents & SocketEvents_SA_READ) == 0 ? (EV_DELETE | EV_RECEIPT) : (EV_ADD | EV_CLEAR | EV_RECEIPT),
+                       0,
+                       0,
+                       GetKeventUdata(change->Data));
+            }
+            if ((changed & SocketEvents_SA_WRITE) != 0)
+            {
+                eventChange[n] = next;
+                EV_SET(&events[n++],
+                       (uint64_t)ToFileDescriptor(change->Socket),
+                       EVFILT_WRITE,
+                       (change->NewEvents & SocketEvents_SA_WRITE) == 0 ? (EV_DELETE | EV_RECEIPT) : (EV_ADD | EV_CLEAR | EV_RECEIPT),
+                       0,
+                       0,
+                       GetKeventUdata(change->Data));
+            }
+        }
 
-    // We should never see 0 events. Given an infinite timeout, kevent will never return
-    // 0 events even if there are no file descriptors registered with the kqueue fd. In
-    // that case, the wait will block until a file descriptor is added and an event occurs
+        if (n == 0)
+        {
+            continue;
+        }
+
+        int received;
+        while ((received = kevent(port, events, GetKeventNchanges(n), receipts, GetKeventNchanges(n), NULL)) < 0 && errno == EINTR);
+        if (received < 0)
+        {
+            int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+            for (int i = 0; i < n; i++)
+            {
+                changes[eventChange[i]].Error = error;
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received && i < n; i++)
+        {
+            assert(receipts[i].ident == events[i].ident && receipts[i].filter == events[i].filter);
+            if ((GetKeventFlags(receipts[i].flags) & EV_ERROR) != 0 && receipts[i].data != 0 &&
+                changes[eventChange[i]].Error == Error_SUCCESS)
+            {
+                changes[eventChange[i]].Error = SystemNative_ConvertErrorPlatformToPal((int)receipts[i].data);
+            }
+        }
+    }
+#else
+    // Without EV_RECEIPT the individual errors can't be told apart, and FreeBSD needs separate
+    // calls for the read and write filters (see TryChangeSocketEventRegistrationInner).
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (changes[i].Error == Error_SUCCESS && changes[i].CurrentEvents != changes[i].NewEvents)
+        {
+            changes[i].Error = TryChangeSocketEventRegistrationInner(
+                port, ToFileDescriptor(changes[i].Socket), (SocketEvents)changes[i].CurrentEvents, (SocketEvents)changes[i].NewEvents, changes[i].Data);
+        }
+    }
+#endif
+}
+
+static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
+{
+    assert(buffer != NULL);
+    assert(count != NULL);
+    assert(*count >= 0);
+
+    struct kevent* events = (struct kevent*)buffer;
+    int numEvents;
+    while ((numEvents = kevent(port, NULL, 0, events, GetKeventNchanges(*count), NULL)) < 0 && errno == EINTR);
+    if (numEvents == -1)
+    {
+        *count = -1;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    // We should never see 0 events. Given an infinite timeout, kevent will never return
+    // 0 events even if there are no file descriptors registered with the kqueue fd. In
+    // that case, the wait will block until a file descriptor is added and an event occurs
     // on the added file descriptor.
     assert(numEvents != 0);
     assert(numEvents <= *count);
@@ -3379,6 +3847,13 @@ uintptr_t data)
 {
     return Error_ENOSYS;
 }
+static void TryChangeSocketEventRegistrationsInner(int32_t port, SocketEventRegistrationChange* changes, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        changes[i].Error = Error_ENOSYS;
+    }
+}
 static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32_t* count)
 {
     return Error_ENOSYS;
@@ -3478,6 +3953,34 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
         portFd, socketFd, (SocketEvents)currentEvents, (SocketEvents)newEvents, data);
 }
 
+int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistrationChange* changes, int32_t count)
+{
+    if (changes == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    const int32_t SupportedEvents = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR;
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        changes[i].Error = (changes[i].CurrentEvents & ~SupportedEvents) != 0 || (changes[i].NewEvents & ~SupportedEvents) != 0 ?
+            Error_EINVAL : Error_SUCCESS;
+    }
+
+    TryChangeSocketEventRegistrationsInner(ToFileDescriptor(port), changes, count);
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (changes[i].Error != Error_SUCCESS)
+        {
+            return changes[i].Error;
+        }
+    }
+
+    return Error_SUCCESS;
+}
+
 int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count)
 {
     if (buffer == NULL || count == NULL || *count < 0)
@@ -3490,6 +3993,505 @@ int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int
     return WaitForSocketEventsInner(fd, buffer, count);
 }
 
+#if HAVE_LINUX_IO_URING_H
+
+typedef struct
+{
+    int fd;
+    void* sqRing;
+    size_t sqRingSize;
+    void* cqRing;
+    size_t cqRingSize;
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+    uint32_t* sqHead;
+    uint32_t* sqTail;
+    uint32_t sqMask;
+    uint32_t sqEntries;
+    uint32_t* sqArray;
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqMask;
+    struct io_uring_cqe* cqes;
+    uint32_t pending;   // entries queued since the last submit
+} SocketIoRing;
+
+static void FreeSocketIoRing(SocketIoRing* ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if (ring->cqRing != NULL && ring->cqRing != MAP_FAILED && ring->cqRing != ring->sqRing)
+    {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing != NULL && ring->sqRing != MAP_FAILED)
+    {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+    if (ring->fd != -1)
+    {
+        close(ring->fd);
+    }
+    free(ring);
+}
+
+int32_t SystemNative_CreateSocketIoRing(int32_t entries, intptr_t* ring)
+{
+    if (ring == NULL || entries <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *ring = 0;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int fd = (int)syscall(__NR_io_uring_setup, (unsigned)entries, &params);
+    if (fd == -1)
+    {
+        // ENOSYS: the kernel doesn't support io_uring; EPERM: it's disabled (io_uring_disabled sysctl or seccomp)
+        return errno == ENOSYS || errno == EPERM ? Error_ENOTSUP : SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    SocketIoRing* ioRing = (SocketIoRing*)calloc(1, sizeof(SocketIoRing));
+    if (ioRing == NULL)
+    {
+        close(fd);
+        return Error_ENOMEM;
+    }
+    ioRing->fd = fd;
+
+    ioRing->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ioRing->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0 && ioRing->cqRingSize > ioRing->sqRingSize)
+    {
+        ioRing->sqRingSize = ioRing->cqRingSize;
+    }
+
+    ioRing->sqRing = mmap(NULL, ioRing->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ioRing->sqRing == MAP_FAILED)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        FreeSocketIoRing(ioRing);
+        return error;
+    }
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        ioRing->cqRing = ioRing->sqRing;
+    }
+    else
+    {
+        ioRing->cqRing = mmap(NULL, ioRing->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ioRing->cqRing == MAP_FAILED)
+        {
+            int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+            FreeSocketIoRing(ioRing);
+            return error;
+        }
+    }
+
+    ioRing->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ioRing->sqes = (struct io_uring_sqe*)mmap(NULL, ioRing->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ioRing->sqes == MAP_FAILED)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        FreeSocketIoRing(ioRing);
+        return error;
+    }
+
+    uint8_t* sqRing = (uint8_t*)ioRing->sqRing;
+    ioRing->sqHead = (uint32_t*)(sqRing + params.sq_off.head);
+    ioRing->sqTail = (uint32_t*)(sqRing + params.sq_off.tail);
+    ioRing->sqMask = *(uint32_t*)(sqRing + params.sq_off.ring_mask);
+    ioRing->sqEntries = *(uint32_t*)(sqRing + params.sq_off.ring_entries);
+    ioRing->sqArray = (uint32_t*)(sqRing + params.sq_off.array);
+
+    uint8_t* cqRing = (uint8_t*)ioRing->cqRing;
+    ioRing->cqHead = (uint32_t*)(cqRing + params.cq_off.head);
+    ioRing->cqTail = (uint32_t*)(cqRing + params.cq_off.tail);
+    ioRing->cqMask = *(uint32_t*)(cqRing + params.cq_off.ring_mask);
+    ioRing->cqes = (struct io_uring_cqe*)(cqRing + params.cq_off.cqes);
+
+    *ring = (intptr_t)ioRing;
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_CloseSocketIoRing(intptr_t ring)
+{
+    if (ring == 0)
+    {
+        return Error_EFAULT;
+    }
+
+    FreeSocketIoRing((SocketIoRing*)ring);
+    return Error_SUCCESS;
+}
+
+static int32_t PrepareSocketIoRingFileEntry(struct io_uring_sqe* sqe, const SocketIoRingOperation* operation)
+{
+    const int32_t supportedFlags = SocketIoRingFileFlags_FixedFile | SocketIoRingFileFlags_FixedBuffer | SocketIoRingFileFlags_DataSync;
+    if ((operation->Flags & ~supportedFlags) != 0 || operation->Offset < -1)
+    {
+        return Error_EINVAL;
+    }
+
+    if ((operation->Flags & SocketIoRingFileFlags_FixedFile) != 0)
+    {
+        // The kernel looks the file up in the registered file table instead of the fd table
+        sqe->flags |= IOSQE_FIXED_FILE;
+    }
+    sqe->off = (uint64_t)operation->Offset;
+
+    int32_t fixedBuffer = (operation->Flags & SocketIoRingFileFlags_FixedBuffer) != 0;
+    switch (operation->Op)
+    {
+        case SocketIoRingOp_ReadFile:
+        case SocketIoRingOp_WriteFile:
+            if (operation->Length < 0 || (fixedBuffer && operation->BufferId < 0))
+            {
+                return Error_EINVAL;
+            }
+            if (fixedBuffer)
+            {
+                sqe->opcode = operation->Op == SocketIoRingOp_ReadFile ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+                sqe->buf_index = (uint16_t)operation->BufferId;
+            }
+            else
+            {
+                sqe->opcode = operation->Op == SocketIoRingOp_ReadFile ? IORING_OP_READ : IORING_OP_WRITE;
+            }
+            sqe->addr = (uint64_t)(uintptr_t)operation->Buffer;
+            sqe->len = (uint32_t)operation->Length;
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_ReadVFile:
+        case SocketIoRingOp_WriteVFile:
+            if (fixedBuffer || operation->Buffer == NULL || operation->Count <= 0)
+            {
+                return Error_EINVAL;
+            }
+            // IOVector matches struct iovec; the vectors must stay alive until the operation completes
+            sqe->opcode = operation->Op == SocketIoRingOp_ReadVFile ? IORING_OP_READV : IORING_OP_WRITEV;
+            sqe->addr = (uint64_t)(uintptr_t)operation->Buffer;
+            sqe->len = (uint32_t)operation->Count;
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_FsyncFile:
+            if (fixedBuffer)
+            {
+                return Error_EINVAL;
+            }
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->off = 0;
+            if ((operation->Flags & SocketIoRingFileFlags_DataSync) != 0)
+            {
+                sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+            }
+            return Error_SUCCESS;
+
+        default:
+            return Error_EINVAL;
+    }
+}
+
+static int32_t PrepareSocketIoRingEntry(struct io_uring_sqe* sqe, const SocketIoRingOperation* operation)
+{
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->fd = ToFileDescriptor(operation->Socket);
+    sqe->user_data = operation->Data;
+
+    int socketFlags = 0;
+    switch (operation->Op)
+    {
+        case SocketIoRingOp_Accept:
+        case SocketIoRingOp_MultishotAccept:
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->accept_flags = SOCK_CLOEXEC;
+            if (operation->Op == SocketIoRingOp_MultishotAccept)
+            {
+#ifdef IORING_ACCEPT_MULTISHOT
+                sqe->ioprio |= IORING_ACCEPT_MULTISHOT;
+#else
+                return Error_ENOTSUP;
+#endif
+            }
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_Recv:
+        case SocketIoRingOp_MultishotRecv:
+        case SocketIoRingOp_Send:
+            if (!ConvertSocketFlagsPalToPlatform(operation->Flags, &socketFlags))
+            {
+                return Error_ENOTSUP;
+            }
+            if (operation->Length < 0)
+            {
+                return Error_EINVAL;
+            }
+            sqe->opcode = operation->Op == SocketIoRingOp_Send ? IORING_OP_SEND : IORING_OP_RECV;
+            sqe->addr = (uint64_t)(uintptr_t)operation->Buffer;
+            sqe->len = (uint32_t)operation->Length;
+#ifdef MSG_NOSIGNAL
+            if (operation->Op == SocketIoRingOp_Send)
+            {
+                socketFlags |= MSG_NOSIGNAL;
+            }
+#endif
+            sqe->msg_flags = (uint32_t)socketFlags;
+            if (operation->Op == SocketIoRingOp_MultishotRecv)
+            {
+#ifdef IORING_RECV_MULTISHOT
+                // The kernel picks a buffer from the group for each receive
+                sqe->ioprio |= IORING_RECV_MULTISHOT;
+                sqe->flags |= IOSQE_BUFFER_SELECT;
+                sqe->buf_group = (uint16_t)operation->BufferGroup;
+                sqe->addr = 0;
+                sqe->len = 0;
+#else
+                return Error_ENOTSUP;
+#endif
+            }
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_ProvideBuffers:
+            if (operation->Buffer == NULL || operation->Length <= 0 || operation->Count <= 0 || operation->BufferId < 0)
+            {
+                return Error_EINVAL;
+            }
+            sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+            sqe->fd = operation->Count;
+            sqe->addr = (uint64_t)(uintptr_t)operation->Buffer;
+            sqe->len = (uint32_t)operation->Length;
+            sqe->off = (uint64_t)operation->BufferId;
+            sqe->buf_group = (uint16_t)operation->BufferGroup;
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_Cancel:
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = operation->CancelData;
+            return Error_SUCCESS;
+
+        case SocketIoRingOp_ReadFile:
+        case SocketIoRingOp_WriteFile:
+        case SocketIoRingOp_ReadVFile:
+        case SocketIoRingOp_WriteVFile:
+        case SocketIoRingOp_FsyncFile:
+            return PrepareSocketIoRingFileEntry(sqe, operation);
+
+        default:
+            return Error_EINVAL;
+    }
+}
+
+int32_t SystemNative_QueueSocketIoRingOperations(intptr_t ring, SocketIoRingOperation* operations, int32_t count, int32_t* queued)
+{
+    if (ring == 0 || operations == NULL || queued == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    SocketIoRing* ioRing = (SocketIoRing*)ring;
+    *queued = 0;
+
+    // Only this thread advances the tail; the kernel advances the head as it consumes entries
+    uint32_t tail = *ioRing->sqTail;
+    uint32_t head = __atomic_load_n(ioRing->sqHead, __ATOMIC_ACQUIRE);
+
+    int32_t error = Error_SUCCESS;
+    int32_t i;
+    for (i = 0; i < count; i++)
+    {
+        if (tail - head >= ioRing->sqEntries)
+        {
+            error = Error_EAGAIN;
+            break;
+        }
+
+        uint32_t index = tail & ioRing->sqMask;
+        error = PrepareSocketIoRingEntry(&ioRing->sqes[index], &operations[i]);
+        if (error != Error_SUCCESS)
+        {
+            break;
+        }
+        ioRing->sqArray[index] = index;
+        tail++;
+    }
+
+    __atomic_store_n(ioRing->sqTail, tail, __ATOMIC_RELEASE);
+    ioRing->pending += (uint32_t)i;
+    *queued = i;
+    return error;
+}
+
+int32_t SystemNative_SubmitAndWaitSocketIoRing(intptr_t ring, int32_t waitCount, SocketIoRingCompletion* completions, int32_t* count)
+{
+    if (ring == 0 || completions == NULL || count == NULL || *count < 0 || waitCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    SocketIoRing* ioRing = (SocketIoRing*)ring;
+    uint32_t head = *ioRing->cqHead;
+    uint32_t tail = __atomic_load_n(ioRing->cqTail, __ATOMIC_ACQUIRE);
+
+    // Skip the system call if there's nothing to submit and enough completions are already posted
+    if (ioRing->pending > 0 || tail - head < (uint32_t)waitCount)
+    {
+        unsigned flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+        int res;
+        while ((res = (int)syscall(__NR_io_uring_enter, ioRing->fd, ioRing->pending, (unsigned)waitCount, flags, NULL, 0)) < 0 && errno == EINTR);
+        if (res < 0)
+        {
+            *count = 0;
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+        ioRing->pending -= (uint32_t)res < ioRing->pending ? (uint32_t)res : ioRing->pending;
+
+        tail = __atomic_load_n(ioRing->cqTail, __ATOMIC_ACQUIRE);
+    }
+
+    int32_t returned = 0;
+    while (head != tail && returned < *count)
+    {
+        const struct io_uring_cqe* cqe = &ioRing->cqes[head & ioRing->cqMask];
+        SocketIoRingCompletion* completion = &completions[returned++];
+
+        completion->Data = cqe->user_data;
+        completion->Result = cqe->res >= 0 ? cqe->res : -SystemNative_ConvertErrorPlatformToPal(-cqe->res);
+        completion->Flags = SocketIoRingCompletionFlags_None;
+        completion->BufferId = 0;
+        completion->Padding = 0;
+        if ((cqe->flags & IORING_CQE_F_MORE) != 0)
+        {
+            completion->Flags |= SocketIoRingCompletionFlags_More;
+        }
+        if ((cqe->flags & IORING_CQE_F_BUFFER) != 0)
+        {
+            completion->Flags |= SocketIoRingCompletionFlags_Buffer;
+            completion->BufferId = (int32_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        }
+        head++;
+    }
+
+    __atomic_store_n(ioRing->cqHead, head, __ATOMIC_RELEASE);
+    *count = returned;
+    return Error_SUCCESS;
+}
+
+static int32_t RegisterSocketIoRingResources(SocketIoRing* ioRing, unsigned registerOpcode, unsigned unregisterOpcode, const void* args, int32_t count)
+{
+    int res;
+
+    // Registering again requires dropping the previous table first; ENXIO means there was none
+    while ((res = (int)syscall(__NR_io_uring_register, ioRing->fd, unregisterOpcode, NULL, 0)) < 0 && errno == EINTR);
+    if (res < 0 && errno != ENXIO)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    if (count == 0)
+    {
+        return Error_SUCCESS;
+    }
+
+    while ((res = (int)syscall(__NR_io_uring_register, ioRing->fd, registerOpcode, args, (unsigned)count)) < 0 && errno == EINTR);
+    return res < 0 ? SystemNative_ConvertErrorPlatformToPal(errno) : Error_SUCCESS;
+}
+
+int32_t SystemNative_RegisterSocketIoRingFiles(intptr_t ring, intptr_t* files, int32_t count)
+{
+    if (ring == 0 || count < 0 || (count > 0 && files == NULL))
+    {
+        return Error_EFAULT;
+    }
+
+    int* fds = NULL;
+    if (count > 0)
+    {
+        fds = (int*)malloc((size_t)count * sizeof(int));
+        if (fds == NULL)
+        {
+            return Error_ENOMEM;
+        }
+        for (int32_t i = 0; i < count; i++)
+        {
+            fds[i] = ToFileDescriptor(files[i]);
+        }
+    }
+
+    int32_t error = RegisterSocketIoRingResources((SocketIoRing*)ring, IORING_REGISTER_FILES, IORING_UNREGISTER_FILES, fds, count);
+    free(fds);
+    return error;
+}
+
+int32_t SystemNative_RegisterSocketIoRingBuffers(intptr_t ring, IOVector* buffers, int32_t count)
+{
+    if (ring == 0 || count < 0 || (count > 0 && buffers == NULL))
+    {
+        return Error_EFAULT;
+    }
+
+    return RegisterSocketIoRingResources((SocketIoRing*)ring, IORING_REGISTER_BUFFERS, IORING_UNREGISTER_BUFFERS, buffers, count);
+}
+
+#else // HAVE_LINUX_IO_URING_H
+
+int32_t SystemNative_CreateSocketIoRing(int32_t entries, intptr_t* ring)
+{
+    (void)entries;
+    if (ring != NULL)
+    {
+        *ring = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_CloseSocketIoRing(intptr_t ring)
+{
+    (void)ring;
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_QueueSocketIoRingOperations(intptr_t ring, SocketIoRingOperation* operations, int32_t count, int32_t* queued)
+{
+    (void)ring, (void)operations, (void)count;
+    if (queued != NULL)
+    {
+        *queued = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_SubmitAndWaitSocketIoRing(intptr_t ring, int32_t waitCount, SocketIoRingCompletion* completions, int32_t* count)
+{
+    (void)ring, (void)waitCount, (void)completions;
+    if (count != NULL)
+    {
+        *count = 0;
+    }
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_RegisterSocketIoRingFiles(intptr_t ring, intptr_t* files, int32_t count)
+{
+    (void)ring, (void)files, (void)count;
+    return Error_ENOTSUP;
+}
+
+int32_t SystemNative_RegisterSocketIoRingBuffers(intptr_t ring, IOVector* buffers, int32_t count)
+{
+    (void)ring, (void)buffers, (void)count;
+    return Error_ENOTSUP;
+}
+
+#endif // HAVE_LINUX_IO_URING_H
+
 int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void)
 {
 #if HAVE_SUPPORT_FOR_DUAL_MODE_IPV4_PACKET_INFO
@@ -3557,6 +4559,58 @@ int32_t SystemNative_Disconnect(intptr_t socket)
     return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+#if HAVE_SENDFILE_4 && HAVE_SPLICE
+// sendfile requires an mmap-able source; move the data from other sources (pipes, sockets, character
+// devices) through a pipe with splice, which still avoids copying them to user space.
+static int32_t SpliceFile(int outfd, int infd, off_t* offset, int64_t count, int64_t* sent)
+{
+    *sent = 0;
+
+    int pipeFds[2];
+    if (pipe2(pipeFds, O_CLOEXEC) != 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    int savedErrno = 0;
+    while (*sent < count)
+    {
+        size_t chunk = (size_t)Min((int64_t)(1024 * 1024), count - *sent);
+        ssize_t in;
+        while ((in = splice(infd, offset, pipeFds[1], NULL, chunk, SPLICE_F_MOVE | SPLICE_F_MORE)) < 0 && errno == EINTR);
+        if (in <= 0)
+        {
+            savedErrno = in < 0 ? errno : 0;
+            break;
+        }
+
+        // Drain everything that was moved into the pipe
+        while (in > 0)
+        {
+            ssize_t out;
+            while ((out = splice(pipeFds[0], NULL, outfd, NULL, (size_t)in, SPLICE_F_MOVE | SPLICE_F_MORE)) < 0 && errno == EINTR);
+            if (out <= 0)
+            {
+                // The data still in the pipe is lost; report what made it to the destination.
+                savedErrno = out < 0 ? errno : EIO;
+                break;
+            }
+            in -= out;
+            *sent += out;
+        }
+        if (savedErrno != 0)
+        {
+            break;
+        }
+    }
+
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+
+    return savedErrno == 0 || (*sent > 0 && savedErrno == EAGAIN) ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(savedErrno);
+}
+#endif
+
 int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent)
 {
     assert(sent != NULL);
@@ -3575,6 +4629,17 @@ int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, i
         return Error_SUCCESS;
     }
 
+#if HAVE_SPLICE
+    if (errno == EINVAL || errno == ENOSYS)
+    {
+        // Sources without a file position (pipes, sockets) can't take an offset.
+        struct stat st;
+        bool seekable = fstat(infd, &st) == 0 && S_ISREG(st.st_mode);
+        offtOffset = (off_t)offset;
+        return SpliceFile(outfd, infd, seekable ? &offtOffset : NULL, count, sent);
+    }
+#endif
+
     *sent = 0;
     return SystemNative_ConvertErrorPlatformToPal(errno);
 
@@ -298,6 +298,80 @@ typedef struct
     uint32_t Padding;    // Pad out to 8-byte alignment
 } SocketEvent;
 
+typedef struct
+{
+    intptr_t Socket;       // Socket whose registration changes
+    uintptr_t Data;        // User data for the socket's events
+    int32_t CurrentEvents; // Currently registered SocketEvents
+    int32_t NewEvents;     // SocketEvents to register
+    int32_t Error;         // Out: the PAL Error for this change
+    uint32_t Padding;      // Pad out to 8-byte alignment
+} SocketEventRegistrationChange;
+
+/**
+ * Operations that can be queued on a socket io ring (io_uring on Linux).
+ */
+typedef enum
+{
+    SocketIoRingOp_Accept = 0,          // Accept a connection on Socket; the completion Result is the new socket
+    SocketIoRingOp_MultishotAccept = 1, // Accept connections on Socket until canceled; one completion per connection
+    SocketIoRingOp_Recv = 2,            // Receive into Buffer/Length
+    SocketIoRingOp_MultishotRecv = 3,   // Receive into buffers selected from BufferGroup until canceled or out of buffers
+    SocketIoRingOp_Send = 4,            // Send from Buffer/Length
+    SocketIoRingOp_ProvideBuffers = 5,  // Add Count buffers of Length bytes at Buffer to BufferGroup, with ids starting at BufferId
+    SocketIoRingOp_Cancel = 6,          // Cancel the queued operation whose Data matches CancelData
+    SocketIoRingOp_ReadFile = 7,        // Read Length bytes at Offset from the file in Socket into Buffer
+    SocketIoRingOp_WriteFile = 8,       // Write Length bytes from Buffer at Offset to the file in Socket
+    SocketIoRingOp_ReadVFile = 9,       // Read at Offset into the Count IOVectors at Buffer
+    SocketIoRingOp_WriteVFile = 10,     // Write the Count IOVectors at Buffer at Offset
+    SocketIoRingOp_FsyncFile = 11,      // Flush the file in Socket to storage
+} SocketIoRingOp;
+
+/**
+ * Flags of the file operations of a socket io ring, passed in SocketIoRingOperation.Flags.
+ */
+typedef enum
+{
+    SocketIoRingFileFlags_None = 0x00,
+    SocketIoRingFileFlags_FixedFile = 0x01,   // Socket is an index into the files registered with SystemNative_RegisterSocketIoRingFiles
+    SocketIoRingFileFlags_FixedBuffer = 0x02, // ReadFile/WriteFile only: Buffer lies in the registered buffer BufferId
+    SocketIoRingFileFlags_DataSync = 0x04,    // FsyncFile only: flush data but not unneeded metadata, like fdatasync
+} SocketIoRingFileFlags;
+
+/**
+ * Flags of a socket io ring completion.
+ */
+typedef enum
+{
+    SocketIoRingCompletionFlags_None = 0x00,
+    SocketIoRingCompletionFlags_More = 0x01,   // A multishot operation will post more completions
+    SocketIoRingCompletionFlags_Buffer = 0x02, // BufferId identifies the BufferGroup buffer holding the data
+} SocketIoRingCompletionFlags;
+
+typedef struct
+{
+    uint64_t Data;       // User data returned with the completion
+    uint64_t CancelData; // SocketIoRingOp_Cancel only: the Data of the operation to cancel
+    int64_t Offset;      // File operations only: the file offset, or -1 for the current file position
+    uint8_t* Buffer;
+    intptr_t Socket;     // The socket, or the file for file operations
+    int32_t Op;          // SocketIoRingOp
+    int32_t Flags;       // SocketFlags for the socket operations and SocketIoRingFileFlags for the file operations
+    int32_t Length;
+    int32_t Count;
+    int32_t BufferGroup;
+    int32_t BufferId;
+} SocketIoRingOperation;
+
+typedef struct
+{
+    uint64_t Data;       // User data of the completed operation
+    int32_t Result;      // Bytes transferred or accepted socket on success, otherwise the negated PAL Error
+    int32_t Flags;       // SocketIoRingCompletionFlags
+    int32_t BufferId;    // Valid when Flags contains SocketIoRingCompletionFlags_Buffer
+    uint32_t Padding;    // Pad out to 8-byte alignment
+} SocketIoRingCompletion;
+
 PALEXPORT int32_t SystemNative_GetHostEntryForName(const uint8_t* address, int32_t addressFamily, HostEntry* entry);
 
 PALEXPORT void SystemNative_FreeHostEntry(HostEntry* entry);
@@ -362,10 +436,61 @@ PALEXPORT int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* me
 
 PALEXPORT int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageHeader);
 
+/**
+ * Enables MSG_ZEROCOPY sends on the socket (SO_ZEROCOPY). Returns Error_ENOTSUP where zero-copy send isn't available.
+ */
+PALEXPORT int32_t SystemNative_EnableZeroCopySend(intptr_t socket);
+
+/**
+ * Sends with MSG_ZEROCOPY. The kernel keeps referencing the buffer after the call returns; every successful
+ * call is assigned the next 32-bit sequence number of the socket (starting at 0) and the buffer may only be
+ * reused once SystemNative_ReceiveZeroCopyCompletion reports that number as completed.
+ */
+PALEXPORT int32_t SystemNative_SendZeroCopy(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
+
+/**
+ * Reads one zero-copy completion notification from the socket error queue without waiting. On success the
+ * sends numbered [*first, *last] are complete; *copied is 1 if the kernel fell back to copying the data
+ * (zero-copy didn't help for this destination). Returns Error_EAGAIN if there is no pending notification.
+ */
+PALEXPORT int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* first, uint32_t* last, int32_t* copied);
+
 PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+/**
+ * Receives up to count messages with a single recvmmsg call where available. Only the first message
+ * waits (if the socket is blocking); received[i] is the byte count of message i and *messagesReceived
+ * the number of messages filled in. Returns an error only if no message was received.
+ */
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t count, int32_t flags, int32_t* messagesReceived);
+
+/**
+ * Sends up to count messages with a single sendmmsg call where available. sent[i] is the byte count of
+ * message i and *messagesSent the number of messages sent. Returns an error only if no message was sent.
+ */
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t count, int32_t flags, int32_t* messagesSent);
+
+/**
+ * Sets the UDP generic segmentation offload segment size (0 disables it) and enables or disables
+ * generic receive offload. Returns Error_ENOTSUP where they aren't available.
+ */
+PALEXPORT int32_t SystemNative_SetUdpSegmentation(intptr_t socket, int32_t segmentSize, int32_t enableReceiveCoalescing);
+
+/**
+ * Returns the control buffer size needed to receive the UDP receive offload segment size, 0 if not available.
+ */
+PALEXPORT int32_t SystemNative_GetUdpSegmentControlMessageBufferSize(void);
+
+/**
+ * Gets the segment size of a coalesced UDP datagram received with SystemNative_ReceiveMessage(s).
+ * Returns 1 if the message was coalesced, otherwise 0.
+ */
+PALEXPORT int32_t SystemNative_TryGetUdpReceiveSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -419,6 +544,49 @@ PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistration(
 
 PALEXPORT int32_t SystemNative_WaitForSocketEvents(intptr_t port, SocketEvent* buffer, int32_t* count);
 
+/**
+ * Applies a batch of socket event registration changes; a single kevent call on kqueue platforms.
+ * Each change receives its own result in Error.
+ *
+ * Returns Error_SUCCESS if all the changes succeeded, otherwise the first failing change's Error.
+ */
+PALEXPORT int32_t SystemNative_TryChangeSocketEventRegistrations(intptr_t port, SocketEventRegistrationChange* changes, int32_t count);
+
+/**
+ * Creates a socket io ring with at least the specified number of submission entries.
+ * A ring must only be used by one thread at a time.
+ *
+ * Returns Error_SUCCESS on success, Error_ENOTSUP if io_uring isn't available, otherwise another PAL Error.
+ */
+PALEXPORT int32_t SystemNative_CreateSocketIoRing(int32_t entries, intptr_t* ring);
+
+PALEXPORT int32_t SystemNative_CloseSocketIoRing(intptr_t ring);
+
+/**
+ * Queues the operations on the ring without submitting them to the kernel. Stops at the first
+ * operation that can't be queued; *queued receives the number of operations queued.
+ */
+PALEXPORT int32_t SystemNative_QueueSocketIoRingOperations(intptr_t ring, SocketIoRingOperation* operations, int32_t count, int32_t* queued);
+
+/**
+ * Submits the queued operations and waits for at least waitCount completions with a single system call,
+ * then returns up to *count completions in the buffer. *count receives the number of completions returned.
+ */
+PALEXPORT int32_t SystemNative_SubmitAndWaitSocketIoRing(intptr_t ring, int32_t waitCount, SocketIoRingCompletion* completions, int32_t* count);
+
+/**
+ * Registers the files with the ring, replacing any earlier registration, so file operations queued with
+ * SocketIoRingFileFlags_FixedFile skip the per-operation file reference lookup. A count of 0 unregisters.
+ */
+PALEXPORT int32_t SystemNative_RegisterSocketIoRingFiles(intptr_t ring, intptr_t* files, int32_t count);
+
+/**
+ * Registers the buffers with the ring, replacing any earlier registration. The kernel pins the pages once,
+ * so ReadFile/WriteFile operations with SocketIoRingFileFlags_FixedBuffer avoid mapping them on each
+ * operation; this is the preferred way to drive O_DIRECT files. A count of 0 unregisters.
+ */
+PALEXPORT int32_t SystemNative_RegisterSocketIoRingBuffers(intptr_t ring, IOVector* buffers, int32_t count);
+
 PALEXPORT int32_t SystemNative_PlatformSupportsDualModeIPv4PacketInfo(void);
 
 PALEXPORT void SystemNative_GetDomainSocketSizes(int32_t* pathOffset, int32_t* pathSize, int32_t* addressSize);
@@ -25,6 +25,11 @@
 #endif
 #include <pthread.h>
 
+#if HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP && defined(__APPLE__)
+#include <spawn.h>
+#define USE_POSIX_SPAWN 1
+#endif
+
 #if HAVE_SCHED_SETAFFINITY || HAVE_SCHED_GETAFFINITY
 #include <sched.h>
 #endif
@@ -209,6 +214,73 @@ handler_from_sigaction (struct sigaction *sa)
     }
 }
 
+#if USE_POSIX_SPAWN
+// Starts the process with posix_spawn, which on macOS is a single system call that neither copies nor
+// write-protects the parent's address space; there, fork() is the only other choice since vfork() isn't
+// trusted. posix_spawn can't change credentials, so callers fall back to fork() for setCredentials.
+// Returns 0 on success, otherwise the errno for the failure, including exec failures.
+static int SpawnProcess(const char* filename,
+                        char* const argv[],
+                        char* const envp[],
+                        const char* cwd,
+                        int stdinFd,
+                        int stdoutFd,
+                        int stderrFd,
+                        pid_t* processId)
+{
+    posix_spawn_file_actions_t fileActions;
+    posix_spawnattr_t attributes;
+    int error;
+
+    if ((error = posix_spawn_file_actions_init(&fileActions)) != 0)
+    {
+        return error;
+    }
+    if ((error = posix_spawnattr_init(&attributes)) != 0)
+    {
+        posix_spawn_file_actions_destroy(&fileActions);
+        return error;
+    }
+
+    // Like the fork path: signals with custom handlers get their default disposition back in the child,
+    // and the child starts with the calling thread's signal mask.
+    sigset_t defaultSignals;
+    sigset_t signalMask;
+    sigemptyset(&defaultSignals);
+    for (int sig = 1; sig < NSIG; ++sig)
+    {
+        struct sigaction sa_old;
+        if (sig != SIGKILL && sig != SIGSTOP && !sigaction(sig, NULL, &sa_old))
+        {
+            void (*oldhandler)(int) = handler_from_sigaction(&sa_old);
+            if (oldhandler != SIG_IGN && oldhandler != SIG_DFL)
+            {
+                sigaddset(&defaultSignals, sig);
+            }
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, NULL, &signalMask);
+
+    if ((error = posix_spawnattr_setsigdefault(&attributes, &defaultSignals)) != 0 ||
+        (error = posix_spawnattr_setsigmask(&attributes, &signalMask)) != 0 ||
+        (error = posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK)) != 0 ||
+        (stdinFd != -1 && (error = posix_spawn_file_actions_adddup2(&fileActions, stdinFd, STDIN_FILENO)) != 0) ||
+        (stdoutFd != -1 && (error = posix_spawn_file_actions_adddup2(&fileActions, stdoutFd, STDOUT_FILENO)) != 0) ||
+        (stderrFd != -1 && (error = posix_spawn_file_actions_adddup2(&fileActions, stderrFd, STDERR_FILENO)) != 0) ||
+        (cwd != NULL && (error = posix_spawn_file_actions_addchdir_np(&fileActions, cwd)) != 0))
+    {
+        goto done;
+    }
+
+    error = posix_spawn(processId, filename, &fileActions, &attributes, argv, envp);
+
+done:
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&fileActions);
+    return error;
+}
+#endif
+
 int32_t SystemNative_ForkAndExecProcess(const char* filename,
                                       char* const argv[],
                                       char* const envp[],
@@ -297,6 +369,28 @@ int32_t SystemNative_ForkAndExecProcess(const char* filename,
         goto done;
     }
 
+#if USE_POSIX_SPAWN
+    if (!setCredentials)
+    {
+        int spawnError = SpawnProcess(filename, argv, envp, cwd,
+                                      stdinFds[READ_END_OF_PIPE], stdoutFds[WRITE_END_OF_PIPE], stderrFds[WRITE_END_OF_PIPE],
+                                      &processId);
+        if (spawnError != 0)
+        {
+            processId = -1;
+            errno = spawnError;
+            success = false;
+            goto done;
+        }
+
+        *childPid = processId;
+        *stdinFd = stdinFds[WRITE_END_OF_PIPE];
+        *stdoutFd = stdoutFds[READ_END_OF_PIPE];
+        *stderrFd = stderrFds[READ_END_OF_PIPE];
+        goto done;
+    }
+#endif
+
     // We create a pipe purely for the benefit of knowing when the child process has called exec.
     // We can use that to block waiting on the pipe to be closed, which lets us block the parent
     // from returning until the child process is actually transitioned to the target program.  This
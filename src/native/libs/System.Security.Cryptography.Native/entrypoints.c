@@ -122,6 +122,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpCipherGetGcmTag)
     DllImportEntry(CryptoNative_EvpCipherGetAeadTag)
     DllImportEntry(CryptoNative_EvpCipherSetAeadTag)
+    DllImportEntry(CryptoNative_EvpCipherAeadSealBatch)
+    DllImportEntry(CryptoNative_EvpCipherAeadOpenBatch)
     DllImportEntry(CryptoNative_EvpCipherReset)
     DllImportEntry(CryptoNative_EvpCipherSetCcmNonceLength)
     DllImportEntry(CryptoNative_EvpCipherSetCcmTag)
@@ -141,6 +143,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestFinalXOF)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
+    DllImportEntry(CryptoNative_EvpDigestBatch)
     DllImportEntry(CryptoNative_EvpDigestReset)
     DllImportEntry(CryptoNative_EvpDigestSqueeze)
     DllImportEntry(CryptoNative_EvpDigestUpdate)
@@ -348,6 +351,9 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_IsSslStateOK)
     DllImportEntry(CryptoNative_SslCtxAddExtraChainCert)
     DllImportEntry(CryptoNative_SslCtxSetCaching)
+    DllImportEntry(CryptoNative_SslCtxSetShardedSessionCache)
+    DllImportEntry(CryptoNative_SslCtxSetAsyncMode)
+    DllImportEntry(CryptoNative_SslGetAsyncWaitFds)
     DllImportEntry(CryptoNative_SslCtxRemoveSession)
     DllImportEntry(CryptoNative_SslCtxSetCiphers)
     DllImportEntry(CryptoNative_SslCtxSetDefaultOcspCallback)
@@ -407,6 +413,10 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslUsePrivateKey)
     DllImportEntry(CryptoNative_SslV2_3Method)
     DllImportEntry(CryptoNative_SslWrite)
+    DllImportEntry(CryptoNative_SslSetSocket)
+    DllImportEntry(CryptoNative_SslEnableKtls)
+    DllImportEntry(CryptoNative_SslIsKtlsSend)
+    DllImportEntry(CryptoNative_SslSendFile)
     DllImportEntry(CryptoNative_Tls13Supported)
     DllImportEntry(CryptoNative_X509DecodeOcspToExpiration)
     DllImportEntry(CryptoNative_X509Duplicate)
@@ -1247,6 +1247,23 @@ static void ExDataFreeNoOp(
     // do nothing.
 }
 
+static void ExDataFreeSessionCache(
+    void* parent,
+    void* ptr,
+    CRYPTO_EX_DATA* ad,
+    int idx,
+    long argl,
+    void* argp)
+{
+    (void)parent;
+    (void)ad;
+    (void)idx;
+    (void)argl;
+    (void)argp;
+
+    SslSessionCacheFree(ptr);
+}
+
 static int ExDataDupNoOp(
     CRYPTO_EX_DATA* to,
 #if OPENSSL_VERSION_NUMBER >= OPENSSL_VERSION_1_1_0_RTM
@@ -1436,6 +1453,8 @@ static int32_t EnsureOpenSsl10Initialized(void)
     g_x509_ocsp_index = CRYPTO_get_ex_new_index(10, 0, NULL, NULL, ExDataDupOcspResponse, ExDataFreeOcspResponse);
     // In OpenSSL 1.0.2-, CRYPTO_EX_INDEX_SSL_SESSION is 3.
     g_ssl_sess_cert_index = CRYPTO_get_ex_new_index(3, 0, NULL, NULL, ExDataDupNoOp, ExDataFreeNoOp);
+    // In OpenSSL 1.0.2-, CRYPTO_EX_INDEX_SSL_CTX is 2.
+    g_ssl_ctx_session_cache_index = CRYPTO_get_ex_new_index(2, 0, NULL, NULL, ExDataDupNoOp, ExDataFreeSessionCache);
 
 done:
     if (ret != 0)
@@ -1506,6 +1525,8 @@ static int32_t EnsureOpenSsl11Initialized(void)
     g_x509_ocsp_index = CRYPTO_get_ex_new_index(3, 0, NULL, NULL, ExDataDupOcspResponse, ExDataFreeOcspResponse);
     // In OpenSSL 1.1.0+, CRYPTO_EX_INDEX_SSL_SESSION is 2.
     g_ssl_sess_cert_index = CRYPTO_get_ex_new_index(2, 0, NULL, NULL, ExDataDupNoOp, ExDataFreeNoOp);
+    // In OpenSSL 1.1.0+, CRYPTO_EX_INDEX_SSL_CTX is 1.
+    g_ssl_ctx_session_cache_index = CRYPTO_get_ex_new_index(1, 0, NULL, NULL, ExDataDupNoOp, ExDataFreeSessionCache);
     return 0;
 }
 
@@ -1525,6 +1546,7 @@ int32_t CryptoNative_OpenSslAvailable(void)
 static int32_t g_initStatus = 1;
 int g_x509_ocsp_index = -1;
 int g_ssl_sess_cert_index = -1;
+int g_ssl_ctx_session_cache_index = -1;
 
 static int32_t EnsureOpenSslInitializedCore(void)
 {
@@ -1561,6 +1583,7 @@ static int32_t EnsureOpenSslInitializedCore(void)
         // On OpenSSL 1.1.0+ 0 is a reserved value and we expect 1.
         assert(g_x509_ocsp_index != -1);
         assert(g_ssl_sess_cert_index != -1);
+        assert(g_ssl_ctx_session_cache_index != -1);
     }
 
     return ret;
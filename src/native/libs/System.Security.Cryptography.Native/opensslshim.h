@@ -702,6 +702,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_CTX_get_ex_data) \
     FALLBACK_FUNCTION(SSL_is_init_finished) \
     REQUIRED_FUNCTION(SSL_CTX_new) \
+    REQUIRED_FUNCTION(SSL_CTX_sess_set_get_cb) \
     REQUIRED_FUNCTION(SSL_CTX_sess_set_new_cb) \
     REQUIRED_FUNCTION(SSL_CTX_sess_set_remove_cb) \
     REQUIRED_FUNCTION(SSL_CTX_remove_session) \
@@ -725,6 +726,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_get_sigalgs) \
     REQUIRED_FUNCTION(SSL_get_client_CA_list) \
     REQUIRED_FUNCTION(SSL_get_current_cipher) \
+    LIGHTUP_FUNCTION(SSL_get_all_async_fds) \
     REQUIRED_FUNCTION(SSL_get_error) \
     REQUIRED_FUNCTION(SSL_get_ex_data) \
     REQUIRED_FUNCTION(SSL_get_finished) \
@@ -733,6 +735,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_get_servername) \
     REQUIRED_FUNCTION(SSL_get_SSL_CTX) \
     REQUIRED_FUNCTION(SSL_get_version) \
+    REQUIRED_FUNCTION(SSL_get_wbio) \
     LIGHTUP_FUNCTION(SSL_get0_alpn_selected) \
     RENAMED_FUNCTION(SSL_get1_peer_certificate, SSL_get_peer_certificate) \
     REQUIRED_FUNCTION(SSL_get_certificate) \
@@ -745,6 +748,8 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_renegotiate_pending) \
     REQUIRED_FUNCTION(SSL_SESSION_free) \
     REQUIRED_FUNCTION(SSL_SESSION_get_ex_data) \
+    REQUIRED_FUNCTION(SSL_SESSION_get_id) \
+    LIGHTUP_FUNCTION(SSL_SESSION_up_ref) \
     REQUIRED_FUNCTION(SSL_SESSION_set_ex_data) \
     LIGHTUP_FUNCTION(SSL_SESSION_get0_hostname) \
     LIGHTUP_FUNCTION(SSL_SESSION_set1_hostname) \
@@ -756,10 +761,12 @@ extern bool g_libSslUses32BitTime;
     LIGHTUP_FUNCTION(SSL_set_ciphersuites) \
     REQUIRED_FUNCTION(SSL_set_connect_state) \
     REQUIRED_FUNCTION(SSL_set_ex_data) \
+    REQUIRED_FUNCTION(SSL_set_fd) \
     FALLBACK_FUNCTION(SSL_set_options) \
     REQUIRED_FUNCTION(SSL_set_session) \
     REQUIRED_FUNCTION(SSL_get_session) \
     REQUIRED_FUNCTION(SSL_set_verify) \
+    LIGHTUP_FUNCTION(SSL_sendfile) \
     REQUIRED_FUNCTION(SSL_shutdown) \
     LEGACY_FUNCTION(SSL_state) \
     LEGACY_FUNCTION(SSLeay) \
@@ -1278,6 +1285,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_CTX_free SSL_CTX_free_ptr
 #define SSL_CTX_get_ex_data SSL_CTX_get_ex_data_ptr
 #define SSL_CTX_new SSL_CTX_new_ptr
+#define SSL_CTX_sess_set_get_cb SSL_CTX_sess_set_get_cb_ptr
 #define SSL_CTX_sess_set_new_cb SSL_CTX_sess_set_new_cb_ptr
 #define SSL_CTX_sess_set_remove_cb SSL_CTX_sess_set_remove_cb_ptr
 #define SSL_CTX_remove_session SSL_CTX_remove_session_ptr
@@ -1302,6 +1310,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_get_client_CA_list SSL_get_client_CA_list_ptr
 #define SSL_get_certificate SSL_get_certificate_ptr
 #define SSL_get_current_cipher SSL_get_current_cipher_ptr
+#define SSL_get_all_async_fds SSL_get_all_async_fds_ptr
 #define SSL_get_error SSL_get_error_ptr
 #define SSL_get_ex_data SSL_get_ex_data_ptr
 #define SSL_get_finished SSL_get_finished_ptr
@@ -1310,6 +1319,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_get_servername SSL_get_servername_ptr
 #define SSL_get_SSL_CTX SSL_get_SSL_CTX_ptr
 #define SSL_get_version SSL_get_version_ptr
+#define SSL_get_wbio SSL_get_wbio_ptr
 #define SSL_get0_alpn_selected SSL_get0_alpn_selected_ptr
 #define SSL_get1_peer_certificate SSL_get1_peer_certificate_ptr
 #define SSL_is_init_finished SSL_is_init_finished_ptr
@@ -1326,6 +1336,8 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_SESSION_set1_hostname SSL_SESSION_set1_hostname_ptr
 #define SSL_session_reused SSL_session_reused_ptr
 #define SSL_SESSION_get_ex_data SSL_SESSION_get_ex_data_ptr
+#define SSL_SESSION_get_id SSL_SESSION_get_id_ptr
+#define SSL_SESSION_up_ref SSL_SESSION_up_ref_ptr
 #define SSL_SESSION_set_ex_data SSL_SESSION_set_ex_data_ptr
 #define SSL_set_accept_state SSL_set_accept_state_ptr
 #define SSL_set_bio SSL_set_bio_ptr
@@ -1334,10 +1346,12 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_set_ciphersuites SSL_set_ciphersuites_ptr
 #define SSL_set_connect_state SSL_set_connect_state_ptr
 #define SSL_set_ex_data SSL_set_ex_data_ptr
+#define SSL_set_fd SSL_set_fd_ptr
 #define SSL_set_options SSL_set_options_ptr
 #define SSL_set_session SSL_set_session_ptr
 #define SSL_get_session SSL_get_session_ptr
 #define SSL_set_verify SSL_set_verify_ptr
+#define SSL_sendfile SSL_sendfile_ptr
 #define SSL_shutdown SSL_shutdown_ptr
 #define SSL_state SSL_state_ptr
 #define SSLeay SSLeay_ptr
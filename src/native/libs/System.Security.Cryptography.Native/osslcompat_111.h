@@ -22,6 +22,9 @@ typedef struct stack_st OPENSSL_STACK;
 #define OPENSSL_INIT_ADD_ALL_DIGESTS 0x00000008L
 #define OPENSSL_INIT_LOAD_CONFIG 0x00000040L
 #define OPENSSL_INIT_LOAD_SSL_STRINGS 0x00200000L
+#define SSL_MODE_ASYNC 0x00000100U
+#define SSL_ERROR_WANT_ASYNC 9
+#define SSL_ERROR_WANT_ASYNC_JOB 10
 
 int ASN1_TIME_to_tm(const ASN1_TIME* s, struct tm* tm);
 int BN_abs_is_word(const BIGNUM *a, const BN_ULONG w);
@@ -93,6 +96,8 @@ int X509_set1_notAfter(X509* x509, const ASN1_TIME*);
 int X509_set1_notBefore(X509* x509, const ASN1_TIME*);
 int32_t X509_up_ref(X509* x509);
 const char *SSL_SESSION_get0_hostname(const SSL_SESSION *s);
+int SSL_SESSION_up_ref(SSL_SESSION *ses);
+int SSL_get_all_async_fds(SSL *s, int *fds, size_t *numfds);
 int SSL_SESSION_set1_hostname(SSL_SESSION *s, const char *hostname);
 void SSL_CTX_set_keylog_callback(SSL_CTX *ctx, SSL_CTX_keylog_cb_func cb);
 
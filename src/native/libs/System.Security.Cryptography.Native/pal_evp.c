@@ -11,8 +11,17 @@
 #define SUCCESS 1
 
 static const EVP_MD* g_evpFetchMd5 = NULL;
+static const EVP_MD* g_evpFetchSha1 = NULL;
+static const EVP_MD* g_evpFetchSha256 = NULL;
+static const EVP_MD* g_evpFetchSha384 = NULL;
+static const EVP_MD* g_evpFetchSha512 = NULL;
 static pthread_once_t g_evpFetch = PTHREAD_ONCE_INIT;
 
+// Per-thread EVP_MD_CTX reused by the one-shot digest functions on OpenSSL 3.
+static pthread_key_t g_oneShotMdCtxKey;
+static int g_oneShotMdCtxKeyCreated = 0;
+static pthread_once_t g_oneShotMdCtxKeyOnce = PTHREAD_ONCE_INIT;
+
 static void EnsureFetchEvpMdAlgorithms(void)
 {
     // This is called from a pthread_once - this method should not be called directly.
@@ -25,6 +34,14 @@ static void EnsureFetchEvpMdAlgorithms(void)
         // Try to fetch an MD5 implementation that will work regardless if
         // FIPS is enforced or not.
         g_evpFetchMd5 = EVP_MD_fetch(NULL, "MD5", "-fips");
+
+        // Passing the legacy EVP_shaN() objects to EVP_DigestInit_ex makes OpenSSL 3 perform an implicit
+        // provider fetch on every initialization. Fetch them once, honoring the default property query.
+        g_evpFetchSha1 = EVP_MD_fetch(NULL, "SHA1", NULL);
+        g_evpFetchSha256 = EVP_MD_fetch(NULL, "SHA256", NULL);
+        g_evpFetchSha384 = EVP_MD_fetch(NULL, "SHA384", NULL);
+        g_evpFetchSha512 = EVP_MD_fetch(NULL, "SHA512", NULL);
+        ERR_clear_error();
     }
 #endif
 
@@ -34,6 +51,85 @@ static void EnsureFetchEvpMdAlgorithms(void)
     {
         g_evpFetchMd5 = EVP_md5();
     }
+    if (g_evpFetchSha1 == NULL)
+    {
+        g_evpFetchSha1 = EVP_sha1();
+    }
+    if (g_evpFetchSha256 == NULL)
+    {
+        g_evpFetchSha256 = EVP_sha256();
+    }
+    if (g_evpFetchSha384 == NULL)
+    {
+        g_evpFetchSha384 = EVP_sha384();
+    }
+    if (g_evpFetchSha512 == NULL)
+    {
+        g_evpFetchSha512 = EVP_sha512();
+    }
+}
+
+static void FreeOneShotMdCtx(void* ctx)
+{
+    EVP_MD_CTX_free((EVP_MD_CTX*)ctx);
+}
+
+static void CreateOneShotMdCtxKey(void)
+{
+    // This is called from a pthread_once - this method should not be called directly.
+    g_oneShotMdCtxKeyCreated = pthread_key_create(&g_oneShotMdCtxKey, FreeOneShotMdCtx) == 0;
+}
+
+/*
+Gets an EVP_MD_CTX initialized for type for a one-shot operation. On OpenSSL 3 this is the calling
+thread's cached context, which avoids allocating the context and its provider state on every call;
+OpenSSL 1.x always gets a new context so EvpMdCtxCreate can apply the MD5 FIPS flag.
+*/
+static EVP_MD_CTX* AcquireOneShotMdCtx(const EVP_MD* type)
+{
+    if (CryptoNative_OpenSslVersionNumber() >= OPENSSL_VERSION_3_0_RTM)
+    {
+        pthread_once(&g_oneShotMdCtxKeyOnce, CreateOneShotMdCtxKey);
+
+        if (g_oneShotMdCtxKeyCreated)
+        {
+            EVP_MD_CTX* ctx = (EVP_MD_CTX*)pthread_getspecific(g_oneShotMdCtxKey);
+
+            if (ctx == NULL)
+            {
+                ctx = EVP_MD_CTX_new();
+
+                if (ctx != NULL && pthread_setspecific(g_oneShotMdCtxKey, ctx) != 0)
+                {
+                    EVP_MD_CTX_free(ctx);
+                    ctx = NULL;
+                }
+            }
+
+            if (ctx != NULL)
+            {
+                if (!EVP_DigestInit_ex(ctx, type, NULL))
+                {
+                    // Don't keep a context in an unknown state around
+                    pthread_setspecific(g_oneShotMdCtxKey, NULL);
+                    EVP_MD_CTX_free(ctx);
+                    return NULL;
+                }
+
+                return ctx;
+            }
+        }
+    }
+
+    return CryptoNative_EvpMdCtxCreate(type);
+}
+
+static void ReleaseOneShotMdCtx(EVP_MD_CTX* ctx)
+{
+    if (!g_oneShotMdCtxKeyCreated || pthread_getspecific(g_oneShotMdCtxKey) != ctx)
+    {
+        CryptoNative_EvpMdCtxDestroy(ctx);
+    }
 }
 
 EVP_MD_CTX* CryptoNative_EvpMdCtxCreate(const EVP_MD* type)
@@ -211,7 +307,7 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
         return 0;
     }
 
-    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+    EVP_MD_CTX* ctx = AcquireOneShotMdCtx(type);
 
     if (ctx == NULL)
     {
@@ -222,13 +318,56 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
 
     if (ret != SUCCESS)
     {
-        CryptoNative_EvpMdCtxDestroy(ctx);
+        ReleaseOneShotMdCtx(ctx);
         return 0;
     }
 
     ret = CryptoNative_EvpDigestFinalEx(ctx, md, mdSize);
 
-    CryptoNative_EvpMdCtxDestroy(ctx);
+    ReleaseOneShotMdCtx(ctx);
+    return ret;
+}
+
+int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdLength)
+{
+    ERR_clear_error();
+
+    if (type == NULL || count < 0 || (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)))
+    {
+        return 0;
+    }
+
+    int mdSize = EVP_MD_get_size(type);
+
+    if (mdSize <= 0 || (int64_t)mdSize * count > mdLength)
+    {
+        return 0;
+    }
+
+    EVP_MD_CTX* ctx = AcquireOneShotMdCtx(type);
+
+    if (ctx == NULL)
+    {
+        return 0;
+    }
+
+    int32_t ret = SUCCESS;
+
+    for (int32_t i = 0; i < count && ret == SUCCESS; i++)
+    {
+        unsigned int size;
+
+        if (sourceSizes[i] < 0 ||
+            (i > 0 && !EVP_DigestInit_ex(ctx, NULL, NULL)) ||
+            !EVP_DigestUpdate(ctx, sources[i], (size_t)sourceSizes[i]) ||
+            !EVP_DigestFinal_ex(ctx, md + (size_t)i * (size_t)mdSize, &size))
+        {
+            ret = 0;
+        }
+    }
+
+    ReleaseOneShotMdCtx(ctx);
     return ret;
 }
 
@@ -241,7 +380,7 @@ int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source,
         return 0;
     }
 
-    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(type);
+    EVP_MD_CTX* ctx = AcquireOneShotMdCtx(type);
 
     if (ctx == NULL)
     {
@@ -252,13 +391,13 @@ int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source,
 
     if (ret != SUCCESS)
     {
-        CryptoNative_EvpMdCtxDestroy(ctx);
+        ReleaseOneShotMdCtx(ctx);
         return 0;
     }
 
     ret = CryptoNative_EvpDigestFinalXOF(ctx, md, len);
 
-    CryptoNative_EvpMdCtxDestroy(ctx);
+    ReleaseOneShotMdCtx(ctx);
     return ret;
 }
 
@@ -299,26 +438,26 @@ const EVP_MD* CryptoNative_EvpMd5(void)
 
 const EVP_MD* CryptoNative_EvpSha1(void)
 {
-    // No error queue impact.
-    return EVP_sha1();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha1;
 }
 
 const EVP_MD* CryptoNative_EvpSha256(void)
 {
-    // No error queue impact.
-    return EVP_sha256();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha256;
 }
 
 const EVP_MD* CryptoNative_EvpSha384(void)
 {
-    // No error queue impact.
-    return EVP_sha384();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha384;
 }
 
 const EVP_MD* CryptoNative_EvpSha512(void)
 {
-    // No error queue impact.
-    return EVP_sha512();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha512;
 }
 
 const EVP_MD* CryptoNative_EvpSha3_256(void)
@@ -81,6 +81,16 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestBatch
+
+Hashes each of the count sources with a single EVP_MD_CTX, writing the digests back to back into md,
+which must hold count * EVP_MD_get_size(type) bytes.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestBatch(
+    const EVP_MD* type, const uint8_t** sources, const int32_t* sourceSizes, int32_t count, uint8_t* md, int32_t mdLength);
+
 /*
 Function:
 EvpDigestXOFOneShot
@@ -126,7 +136,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpMd5(void);
 Function:
 EvpSha1
 
-Direct shim to EVP_sha1.
+Returns the SHA-1 EVP_MD, pre-fetched from the default provider on OpenSSL 3.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha1(void);
 
@@ -134,7 +144,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha1(void);
 Function:
 EvpSha256
 
-Direct shim to EVP_sha256.
+Returns the SHA-256 EVP_MD, pre-fetched from the default provider on OpenSSL 3.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha256(void);
 
@@ -142,7 +152,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha256(void);
 Function:
 EvpSha384
 
-Direct shim to EVP_sha384.
+Returns the SHA-384 EVP_MD, pre-fetched from the default provider on OpenSSL 3.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha384(void);
 
@@ -150,7 +160,7 @@ PALEXPORT const EVP_MD* CryptoNative_EvpSha384(void);
 Function:
 EvpSha512
 
-Direct shim to EVP_sha512.
+Returns the SHA-512 EVP_MD, pre-fetched from the default provider on OpenSSL 3.
 */
 PALEXPORT const EVP_MD* CryptoNative_EvpSha512(void);
 
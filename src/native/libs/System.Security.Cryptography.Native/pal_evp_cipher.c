@@ -239,6 +239,90 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+static int32_t AeadProcessRecord(EVP_CIPHER_CTX* ctx, AeadRecord* record, int32_t tagLength, int32_t enc)
+{
+    int outLength;
+
+    // Only the nonce changes between records; the key schedule set up on ctx is kept.
+    if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, record->Nonce, enc))
+    {
+        return 0;
+    }
+
+    if (!enc && !EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, tagLength, record->Tag))
+    {
+        return 0;
+    }
+
+    if (record->AadLength > 0 && !EVP_CipherUpdate(ctx, NULL, &outLength, record->Aad, record->AadLength))
+    {
+        return 0;
+    }
+
+    int written = 0;
+    if (record->InputLength > 0)
+    {
+        if (!EVP_CipherUpdate(ctx, record->Output, &outLength, record->Input, record->InputLength))
+        {
+            return 0;
+        }
+        written = outLength;
+    }
+
+    // GCM and ChaCha20-Poly1305 are stream modes, so Final never produces output; for open it checks the tag.
+    if (!EVP_CipherFinal_ex(ctx, record->Output + written, &outLength))
+    {
+        return 0;
+    }
+
+    return enc ? EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, tagLength, record->Tag) : SUCCESS;
+}
+
+static int32_t AeadProcessBatch(EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t count, int32_t nonceLength, int32_t tagLength, int32_t enc)
+{
+    assert(ctx != NULL);
+    assert(count >= 0 && (records != NULL || count == 0));
+    ERR_clear_error();
+
+    // EVP_CTRL_GCM_SET_IVLEN has the same value as EVP_CTRL_AEAD_SET_IVLEN and applies to ChaCha20-Poly1305 as well
+    if (!EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, nonceLength, NULL))
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            records[i].Result = 0;
+        }
+        return 0;
+    }
+
+    int32_t ret = SUCCESS;
+    for (int32_t i = 0; i < count; i++)
+    {
+        AeadRecord* record = &records[i];
+        record->Result = AeadProcessRecord(ctx, record, tagLength, enc) == SUCCESS ? 1 : 0;
+
+        if (!record->Result)
+        {
+            if (!enc && record->InputLength > 0)
+            {
+                OPENSSL_cleanse(record->Output, (size_t)record->InputLength);
+            }
+            ret = 0;
+        }
+    }
+
+    return ret;
+}
+
+int32_t CryptoNative_EvpCipherAeadSealBatch(EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t count, int32_t nonceLength, int32_t tagLength)
+{
+    return AeadProcessBatch(ctx, records, count, nonceLength, tagLength, 1);
+}
+
+int32_t CryptoNative_EvpCipherAeadOpenBatch(EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t count, int32_t nonceLength, int32_t tagLength)
+{
+    return AeadProcessBatch(ctx, records, count, nonceLength, tagLength, 0);
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
     // No error queue impact.
@@ -5,6 +5,22 @@
 #include "pal_compiler.h"
 #include "opensslshim.h"
 
+/*
+One record for EvpCipherAeadSealBatch and EvpCipherAeadOpenBatch.
+*/
+typedef struct
+{
+    uint8_t* Nonce;      // nonceLength bytes
+    uint8_t* Aad;        // AadLength bytes of associated data; may be NULL when AadLength is 0
+    uint8_t* Input;      // InputLength bytes of plaintext (seal) or ciphertext (open)
+    uint8_t* Output;     // InputLength bytes; may be the same buffer as Input
+    uint8_t* Tag;        // tagLength bytes, written by seal and verified by open
+    int32_t AadLength;
+    int32_t InputLength;
+    int32_t Result;      // Out: 1 on success, 0 on failure (including authentication failure for open)
+    int32_t Padding;
+} AeadRecord;
+
 PALEXPORT EVP_CIPHER_CTX*
 CryptoNative_EvpCipherCreate2(const EVP_CIPHER* type, uint8_t* key, int32_t keyLength, unsigned char* iv, int32_t enc);
 
@@ -110,6 +126,28 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpCipherAeadSealBatch
+
+Encrypts and authenticates each record with the key already set on ctx, re-keying only the nonce
+between records. ctx must be an AES-GCM or ChaCha20-Poly1305 context.
+
+Returns 1 if every record succeeded, otherwise 0; each record's Result tells which ones failed.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadSealBatch(EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t count, int32_t nonceLength, int32_t tagLength);
+
+/*
+Function:
+EvpCipherAeadOpenBatch
+
+Verifies and decrypts each record with the key already set on ctx. The Output of a record that fails
+authentication is zeroed. ctx must be an AES-GCM or ChaCha20-Poly1305 context.
+
+Returns 1 if every record succeeded, otherwise 0; each record's Result tells which ones failed.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadOpenBatch(EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t count, int32_t nonceLength, int32_t tagLength);
+
 /*
 Function:
 EvpAes128Ecb
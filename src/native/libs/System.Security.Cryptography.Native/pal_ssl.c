@@ -9,6 +9,7 @@
 #include "pal_x509.h"
 
 #include <assert.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdbool.h>
 
@@ -18,6 +19,8 @@ c_static_assert(PAL_SSL_ERROR_WANT_READ == SSL_ERROR_WANT_READ);
 c_static_assert(PAL_SSL_ERROR_WANT_WRITE == SSL_ERROR_WANT_WRITE);
 c_static_assert(PAL_SSL_ERROR_SYSCALL == SSL_ERROR_SYSCALL);
 c_static_assert(PAL_SSL_ERROR_ZERO_RETURN == SSL_ERROR_ZERO_RETURN);
+c_static_assert(PAL_SSL_ERROR_WANT_ASYNC == SSL_ERROR_WANT_ASYNC);
+c_static_assert(PAL_SSL_ERROR_WANT_ASYNC_JOB == SSL_ERROR_WANT_ASYNC_JOB);
 c_static_assert(SSL_CTRL_SET_TLSEXT_STATUS_REQ_TYPE == 65);
 c_static_assert(TLSEXT_STATUSTYPE_ocsp == 1);
 
@@ -457,6 +460,80 @@ int32_t CryptoNative_SslWrite(SSL* ssl, const void* buf, int32_t num, int32_t* e
     return result;
 }
 
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS ((uint64_t)1 << (uint64_t)3)
+#endif
+
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+
+int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t socket)
+{
+    ERR_clear_error();
+    return SSL_set_fd(ssl, (int)socket) == 1 ? 1 : 0;
+}
+
+int32_t CryptoNative_SslEnableKtls(SSL* ssl)
+{
+#ifdef NEED_OPENSSL_3_0
+    // SSL_sendfile and kernel TLS were both introduced in OpenSSL 3.0
+    if (API_EXISTS(SSL_sendfile))
+    {
+        SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+        return 1;
+    }
+#else
+    (void)ssl;
+#endif
+    return 0;
+}
+
+int32_t CryptoNative_SslIsKtlsSend(SSL* ssl)
+{
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile))
+    {
+        BIO* bio = SSL_get_wbio(ssl);
+        return bio != NULL && BIO_ctrl(bio, BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0 ? 1 : 0;
+    }
+#else
+    (void)ssl;
+#endif
+    return 0;
+}
+
+int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t size, int32_t* error)
+{
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile) && size >= 0)
+    {
+        int64_t result = (int64_t)SSL_sendfile(ssl, (int)fd, (off_t)offset, (size_t)size, 0);
+
+        if (result > 0)
+        {
+            *error = SSL_ERROR_NONE;
+        }
+        else
+        {
+            *error = CryptoNative_SslGetError(ssl, (int32_t)result);
+        }
+
+        return result;
+    }
+#else
+    (void)ssl;
+    (void)fd;
+    (void)offset;
+    (void)size;
+#endif
+
+    *error = SSL_ERROR_SSL;
+    return -1;
+}
+
 int32_t CryptoNative_SslRead(SSL* ssl, void* buf, int32_t num, int32_t* error)
 {
     ERR_clear_error();
@@ -706,6 +783,243 @@ int CryptoNative_SslCtxSetCaching(SSL_CTX* ctx, int mode, int cacheSize, int con
     return retValue;
 }
 
+#define SESSION_CACHE_SHARD_COUNT 16
+
+#if OPENSSL_VERSION_NUMBER >= OPENSSL_VERSION_1_1_0_RTM
+#define SESSION_ID_CONST const
+#else
+#define SESSION_ID_CONST
+#endif
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    SSL_SESSION** entries; // direct-mapped by session id hash; a new session evicts the one in its slot
+} SessionCacheShard;
+
+typedef struct
+{
+    uint32_t entriesPerShard;
+    SessionCacheShard shards[SESSION_CACHE_SHARD_COUNT];
+} SessionCache;
+
+static uint32_t HashSessionId(const unsigned char* id, unsigned int length)
+{
+    // FNV-1a; session ids are random, so this only needs to mix the bytes.
+    uint32_t hash = 2166136261u;
+    for (unsigned int i = 0; i < length; i++)
+    {
+        hash = (hash ^ id[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static SSL_SESSION** GetSessionCacheSlot(SessionCache* cache, const unsigned char* id, unsigned int length, SessionCacheShard** shard)
+{
+    uint32_t hash = HashSessionId(id, length);
+    *shard = &cache->shards[hash % SESSION_CACHE_SHARD_COUNT];
+    return &(*shard)->entries[(hash / SESSION_CACHE_SHARD_COUNT) % cache->entriesPerShard];
+}
+
+static SessionCache* GetSessionCache(SSL_CTX* ctx)
+{
+    return (SessionCache*)SSL_CTX_get_ex_data(ctx, g_ssl_ctx_session_cache_index);
+}
+
+static int ShardedCacheNewSession(SSL* ssl, SSL_SESSION* session)
+{
+    SessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    if (cache == NULL)
+    {
+        return 0;
+    }
+
+    unsigned int length;
+    const unsigned char* id = SSL_SESSION_get_id(session, &length);
+    SessionCacheShard* shard;
+    SSL_SESSION** slot = GetSessionCacheSlot(cache, id, length, &shard);
+
+    pthread_mutex_lock(&shard->lock);
+    SSL_SESSION* evicted = *slot;
+    *slot = session;
+    pthread_mutex_unlock(&shard->lock);
+
+    if (evicted != NULL)
+    {
+        SSL_SESSION_free(evicted);
+    }
+
+    // Returning 1 keeps the reference OpenSSL passed us.
+    return 1;
+}
+
+static SSL_SESSION* ShardedCacheGetSession(SSL* ssl, SESSION_ID_CONST unsigned char* id, int length, int* copy)
+{
+    SessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    *copy = 0;
+    if (cache == NULL || length <= 0)
+    {
+        return NULL;
+    }
+
+    SessionCacheShard* shard;
+    SSL_SESSION** slot = GetSessionCacheSlot(cache, id, (unsigned int)length, &shard);
+    SSL_SESSION* session = NULL;
+
+    pthread_mutex_lock(&shard->lock);
+    if (*slot != NULL)
+    {
+        unsigned int cachedLength;
+        const unsigned char* cachedId = SSL_SESSION_get_id(*slot, &cachedLength);
+        if (cachedLength == (unsigned int)length && memcmp(cachedId, id, cachedLength) == 0)
+        {
+            // Take the caller's reference under the lock, so a concurrent eviction can't free the session first.
+            session = *slot;
+            SSL_SESSION_up_ref(session);
+        }
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    return session;
+}
+
+static void ShardedCacheRemoveSession(SSL_CTX* ctx, SSL_SESSION* session)
+{
+    SessionCache* cache = GetSessionCache(ctx);
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    unsigned int length;
+    const unsigned char* id = SSL_SESSION_get_id(session, &length);
+    SessionCacheShard* shard;
+    SSL_SESSION** slot = GetSessionCacheSlot(cache, id, length, &shard);
+    bool removed = false;
+
+    pthread_mutex_lock(&shard->lock);
+    if (*slot == session)
+    {
+        *slot = NULL;
+        removed = true;
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (removed)
+    {
+        SSL_SESSION_free(session);
+    }
+}
+
+void SslSessionCacheFree(void* ptr)
+{
+    SessionCache* cache = (SessionCache*)ptr;
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    for (int i = 0; i < SESSION_CACHE_SHARD_COUNT; i++)
+    {
+        SessionCacheShard* shard = &cache->shards[i];
+        if (shard->entries != NULL)
+        {
+            for (uint32_t j = 0; j < cache->entriesPerShard; j++)
+            {
+                if (shard->entries[j] != NULL)
+                {
+                    SSL_SESSION_free(shard->entries[j]);
+                }
+            }
+            free(shard->entries);
+        }
+        pthread_mutex_destroy(&shard->lock);
+    }
+
+    free(cache);
+}
+
+int32_t CryptoNative_SslCtxSetShardedSessionCache(SSL_CTX* ctx, int32_t cacheSize)
+{
+    // void shim functions don't lead to exceptions, so skip the unconditional error clearing.
+    if (ctx == NULL || cacheSize <= 0 || !API_EXISTS(SSL_SESSION_up_ref) || GetSessionCache(ctx) != NULL)
+    {
+        return 0;
+    }
+
+    SessionCache* cache = (SessionCache*)calloc(1, sizeof(SessionCache));
+    if (cache == NULL)
+    {
+        return 0;
+    }
+
+    cache->entriesPerShard = (uint32_t)((cacheSize + SESSION_CACHE_SHARD_COUNT - 1) / SESSION_CACHE_SHARD_COUNT);
+    for (int i = 0; i < SESSION_CACHE_SHARD_COUNT; i++)
+    {
+        pthread_mutex_init(&cache->shards[i].lock, NULL);
+        cache->shards[i].entries = (SSL_SESSION**)calloc(cache->entriesPerShard, sizeof(SSL_SESSION*));
+        if (cache->shards[i].entries == NULL)
+        {
+            SslSessionCacheFree(cache);
+            return 0;
+        }
+    }
+
+    if (!SSL_CTX_set_ex_data(ctx, g_ssl_ctx_session_cache_index, cache))
+    {
+        SslSessionCacheFree(cache);
+        return 0;
+    }
+
+    SSL_CTX_ctrl(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL, NULL);
+    SSL_CTX_sess_set_new_cb(ctx, ShardedCacheNewSession);
+    SSL_CTX_sess_set_get_cb(ctx, ShardedCacheGetSession);
+    SSL_CTX_sess_set_remove_cb(ctx, ShardedCacheRemoveSession);
+    return 1;
+}
+
+int32_t CryptoNative_SslCtxSetAsyncMode(SSL_CTX* ctx, int32_t enable)
+{
+    // Async jobs arrived in OpenSSL 1.1.0, together with SSL_get_all_async_fds.
+    if (!API_EXISTS(SSL_get_all_async_fds))
+    {
+        return 0;
+    }
+
+    SSL_CTX_ctrl(ctx, enable ? SSL_CTRL_MODE : SSL_CTRL_CLEAR_MODE, SSL_MODE_ASYNC, NULL);
+    return 1;
+}
+
+int32_t CryptoNative_SslGetAsyncWaitFds(SSL* ssl, int32_t* fds, int32_t* count)
+{
+    assert(count != NULL && *count >= 0);
+    ERR_clear_error();
+
+    if (!API_EXISTS(SSL_get_all_async_fds))
+    {
+        *count = 0;
+        return 0;
+    }
+
+    size_t numFds = 0;
+    if (!SSL_get_all_async_fds(ssl, NULL, &numFds))
+    {
+        *count = 0;
+        return 0;
+    }
+
+    if (numFds > (size_t)*count || fds == NULL)
+    {
+        *count = (int32_t)numFds;
+        return numFds == 0 ? 1 : 0;
+    }
+
+    // OSSL_ASYNC_FD is an int on Unix.
+    int ret = SSL_get_all_async_fds(ssl, (int*)fds, &numFds);
+    *count = ret ? (int32_t)numFds : 0;
+    return ret ? 1 : 0;
+}
+
 int CryptoNative_SslCtxRemoveSession(SSL_CTX* ctx, SSL_SESSION* session)
 {
     return SSL_CTX_remove_session(ctx, session);
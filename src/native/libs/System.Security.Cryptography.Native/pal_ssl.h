@@ -9,6 +9,15 @@
 // we need dedicated index in order to tell OpenSSL how to copy the pointer during SSL_SESSION_dup.
 extern int g_ssl_sess_cert_index;
 
+// index for storing the sharded server session cache created by SslCtxSetShardedSessionCache in SSL_CTX.
+// the cache is freed by the ex_data free callback when the SSL_CTX is finally released.
+extern int g_ssl_ctx_session_cache_index;
+
+/*
+Frees a session cache stored at g_ssl_ctx_session_cache_index; used by the ex_data free callback.
+*/
+void SslSessionCacheFree(void* cache);
+
 /*
 These values should be kept in sync with System.Security.Authentication.SslProtocols.
 */
@@ -112,6 +121,8 @@ typedef enum
     PAL_SSL_ERROR_WANT_WRITE = 3,
     PAL_SSL_ERROR_SYSCALL = 5,
     PAL_SSL_ERROR_ZERO_RETURN = 6,
+    PAL_SSL_ERROR_WANT_ASYNC = 9,
+    PAL_SSL_ERROR_WANT_ASYNC_JOB = 10,
 } SslErrorCode;
 
 // the function pointer definition for the callback used in SslCtxSetAlpnSelectCb
@@ -171,6 +182,32 @@ Sets session caching. 0 is disabled.
 */
 PALEXPORT int CryptoNative_SslCtxSetCaching(SSL_CTX* ctx, int mode, int cacheSize, int contextIdLength, uint8_t* contextId, SslCtxNewSessionCallback newSessionCb, SslCtxRemoveSessionCallback removeSessionCb);
 
+/*
+Replaces OpenSSL's internal server session cache, which serializes every lookup and insert on one
+SSL_CTX lock, with a cache of cacheSize sessions split into independently locked shards.
+Only for server contexts, after SslCtxSetCaching enabled caching.
+
+Returns 1 on success, 0 if it isn't supported by the loaded OpenSSL or allocation failed.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetShardedSessionCache(SSL_CTX* ctx, int32_t cacheSize);
+
+/*
+Enables or disables SSL_MODE_ASYNC so handshake crypto can run as an asynchronous job (e.g. on an
+offload engine). While a job is in flight, operations fail with PAL_SSL_ERROR_WANT_ASYNC and should be
+retried once one of the fds from SslGetAsyncWaitFds becomes readable.
+
+Returns 1 on success, 0 if async jobs aren't supported by the loaded OpenSSL.
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetAsyncMode(SSL_CTX* ctx, int32_t enable);
+
+/*
+Gets the fds to wait on for the async job of ssl. count holds the capacity of fds on input and
+receives the number of fds, or the required capacity if fds was too small.
+
+Returns 1 on success, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslGetAsyncWaitFds(SSL* ssl, int32_t* fds, int32_t* count);
+
 /*
 Removes a session from internal cache.
 */
@@ -273,6 +310,35 @@ when an error is encountered.
 */
 PALEXPORT int32_t CryptoNative_SslWrite(SSL* ssl, const void* buf, int32_t num, int32_t* error);
 
+/*
+Uses the socket directly for the SSL I/O (SSL_set_fd) instead of the memory BIOs. Required for kernel TLS.
+
+Returns 1 on success, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t socket);
+
+/*
+Requests kernel TLS (SSL_OP_ENABLE_KTLS) for the connection. Must be called before the handshake.
+
+Returns 1 if the OpenSSL version supports kernel TLS, otherwise 0. Whether the kernel actually took
+over the record layer is only known after the handshake (CryptoNative_SslIsKtlsSend).
+*/
+PALEXPORT int32_t CryptoNative_SslEnableKtls(SSL* ssl);
+
+/*
+Returns 1 if the records written on this connection are encrypted by the kernel, otherwise 0.
+*/
+PALEXPORT int32_t CryptoNative_SslIsKtlsSend(SSL* ssl);
+
+/*
+Shims the SSL_sendfile method: sends size bytes of the file at offset over a kernel TLS connection
+without copying them to user space.
+
+Returns the positive number of bytes sent when successful, 0 or a negative number when an error is
+encountered (SSL_ERROR_SSL when kernel TLS isn't active for sending).
+*/
+PALEXPORT int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t size, int32_t* error);
+
 /*
 Shims the SSL_read method.
 
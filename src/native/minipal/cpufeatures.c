@@ -51,6 +51,9 @@
 #ifndef HWCAP2_SVE2
 #define HWCAP2_SVE2   (1 << 1)
 #endif
+#ifndef HWCAP2_WFXT
+#define HWCAP2_WFXT   (1UL << 31)
+#endif
 
 #endif
 
@@ -486,6 +489,9 @@ int minipal_getcpufeatures(void)
     if (hwCap2 & HWCAP2_SVE2)
         result |= ARM64IntrinsicConstants_Sve2;
 
+    if (hwCap2 & HWCAP2_WFXT)
+        result |= ARM64IntrinsicConstants_Wfxt;
+
 #else // !HAVE_AUXV_HWCAP_H
 
 #if HAVE_SYSCTLBYNAME
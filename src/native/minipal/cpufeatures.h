@@ -43,6 +43,7 @@
 #define ARM64IntrinsicConstants_Rcpc2 (1 << 8)
 #define ARM64IntrinsicConstants_Sve (1 << 9)
 #define ARM64IntrinsicConstants_Sve2 (1 << 10)
+#define ARM64IntrinsicConstants_Wfxt (1 << 11)
 
 #include <assert.h>
 
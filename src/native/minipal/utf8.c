@@ -2056,6 +2056,169 @@ static size_t GetByteCount(UTF8Encoding* self, CHAR16_T *chars, size_t count)
     return byteCount;
 }
 
+// ASCII fast paths. Strings converted by the runtime (tracing, host paths, type and
+// method names) are mostly or entirely ASCII, and an ASCII prefix converts to the same
+// number of units without any validation or decoder state. The prefix is copied in
+// vectors, and the remainder, starting at the first non-ASCII unit, goes through the
+// regular validating converter above.
+
+#if !BIGENDIAN && (defined(HOST_AMD64) || defined(HOST_ARM64))
+#define MINIPAL_UTF8_ASCII_SIMD 1
+#endif
+
+#ifdef MINIPAL_UTF8_ASCII_SIMD
+
+#if defined(HOST_AMD64)
+#include <immintrin.h>
+#include <minipal/cpufeatures.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MINIPAL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MINIPAL_TARGET_AVX2
+#endif
+
+static bool HasAvx2(void)
+{
+    // -1 until the first call. Racing first calls compute the same value.
+    static volatile int s_hasAvx2 = -1;
+    int hasAvx2 = s_hasAvx2;
+    if (hasAvx2 < 0)
+    {
+        hasAvx2 = (minipal_getcpufeatures() & XArchIntrinsicConstants_Avx2) != 0;
+        s_hasAvx2 = hasAvx2;
+    }
+    return hasAvx2 != 0;
+}
+
+MINIPAL_TARGET_AVX2
+static size_t WidenAsciiAvx2(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        if (_mm256_movemask_epi8(v) != 0)
+            break;
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256((__m256i*)(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    }
+    return i;
+}
+
+MINIPAL_TARGET_AVX2
+static size_t NarrowAsciiAvx2(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    const __m256i nonAsciiMask = _mm256_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i lo = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i hi = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+        if (!_mm256_testz_si256(_mm256_or_si256(lo, hi), nonAsciiMask))
+            break;
+        // packus works within 128-bit lanes, so put the quadwords back in order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+        _mm256_storeu_si256((__m256i*)(dst + i), packed);
+    }
+    return i;
+}
+
+static size_t WidenAsciiSse2(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        if (_mm_movemask_epi8(v) != 0)
+            break;
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+    return i;
+}
+
+static size_t NarrowAsciiSse2(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    const __m128i nonAsciiMask = _mm_set1_epi16((short)0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        __m128i nonAscii = _mm_and_si128(_mm_or_si128(lo, hi), nonAsciiMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(nonAscii, zero)) != 0xFFFF)
+            break;
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    return i;
+}
+
+static size_t WidenAsciiVector(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    size_t i = HasAvx2() ? WidenAsciiAvx2(src, dst, count) : 0;
+    return i + WidenAsciiSse2(src + i, dst + i, count - i);
+}
+
+static size_t NarrowAsciiVector(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    size_t i = HasAvx2() ? NarrowAsciiAvx2(src, dst, count) : 0;
+    return i + NarrowAsciiSse2(src + i, dst + i, count - i);
+}
+
+#elif defined(HOST_ARM64)
+#include <arm_neon.h>
+
+static size_t WidenAsciiVector(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(src + i);
+        if (vmaxvq_u8(v) >= 0x80)
+            break;
+        vst1q_u16((uint16_t*)(dst + i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t*)(dst + i + 8), vmovl_high_u8(v));
+    }
+    return i;
+}
+
+static size_t NarrowAsciiVector(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        uint16x8_t lo = vld1q_u16((const uint16_t*)(src + i));
+        uint16x8_t hi = vld1q_u16((const uint16_t*)(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(lo, hi)) >= 0x80)
+            break;
+        vst1q_u8(dst + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+    return i;
+}
+#endif
+
+// Copies the ASCII prefix of source, up to count units, and returns its length.
+static size_t WidenAsciiPrefix(const unsigned char* src, CHAR16_T* dst, size_t count)
+{
+    size_t i = WidenAsciiVector(src, dst, count);
+    for (; i < count && src[i] < 0x80; i++)
+        dst[i] = (CHAR16_T)src[i];
+    return i;
+}
+
+static size_t NarrowAsciiPrefix(const CHAR16_T* src, unsigned char* dst, size_t count)
+{
+    size_t i = NarrowAsciiVector(src, dst, count);
+    for (; i < count && src[i] < 0x80; i++)
+        dst[i] = (unsigned char)src[i];
+    return i;
+}
+
+#endif // MINIPAL_UTF8_ASCII_SIMD
+
 size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength, unsigned int flags)
 {
     errno = 0;
@@ -2116,8 +2279,24 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
 #endif
     };
 
-    ret = GetChars(&enc, (unsigned char*)source, sourceLength, destination, destinationLength);
+    size_t asciiLength = 0;
+#ifdef MINIPAL_UTF8_ASCII_SIMD
+    if (destination != NULL)
+    {
+        asciiLength = WidenAsciiPrefix((const unsigned char*)source, destination,
+            sourceLength < destinationLength ? sourceLength : destinationLength);
+        if (asciiLength == sourceLength)
+            return asciiLength;
+        // Hand the last ASCII unit to the converter too: it reports insufficient buffer
+        // when it produces nothing, e.g. for an incomplete trailing sequence alone.
+        if (asciiLength > 0)
+            asciiLength--;
+    }
+#endif
+
+    ret = GetChars(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength, destination + asciiLength, destinationLength - asciiLength);
     if (errno) ret = 0;
+    else ret += asciiLength;
 
     return ret;
 }
@@ -2144,8 +2323,24 @@ size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength
     (void)flags; // unused
 #endif
 
-    ret = GetBytes(&enc, (CHAR16_T*)source, sourceLength, (unsigned char*)destination, destinationLength);
+    size_t asciiLength = 0;
+#ifdef MINIPAL_UTF8_ASCII_SIMD
+    if (destination != NULL)
+    {
+        asciiLength = NarrowAsciiPrefix(source, (unsigned char*)destination,
+            sourceLength < destinationLength ? sourceLength : destinationLength);
+        if (asciiLength == sourceLength)
+            return asciiLength;
+        // Hand the last ASCII unit to the converter too: it reports insufficient buffer
+        // when it produces nothing, e.g. for an incomplete trailing sequence alone.
+        if (asciiLength > 0)
+            asciiLength--;
+    }
+#endif
+
+    ret = GetBytes(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength, (unsigned char*)destination + asciiLength, destinationLength - asciiLength);
     if (errno) ret = 0;
+    else ret += asciiLength;
 
     return ret;
 }
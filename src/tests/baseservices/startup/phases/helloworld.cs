@@ -0,0 +1,19 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+
+namespace StartupPhases
+{
+    class HelloWorld
+    {
+        static int Main()
+        {
+            Console.WriteLine("Hello World!");
+
+            // Stay alive until the benchmark has queried the startup phases over the diagnostics port
+            Console.ReadLine();
+            return 0;
+        }
+    }
+}
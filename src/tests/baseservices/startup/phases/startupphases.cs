@@ -0,0 +1,183 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.IO.Pipes;
+using System.Linq;
+using System.Net.Sockets;
+using System.Reflection;
+using System.Text;
+
+using Xunit;
+
+namespace StartupPhases
+{
+    // Runs a hello world app a number of times and reports the distribution of the time spent in each
+    // EEStartupHelper phase, as returned by the GetStartupPhases diagnostics IPC command. The number of
+    // runs can be set with the STARTUP_PHASES_ITERATIONS environment variable.
+    public class Program
+    {
+        // Matches the EEStartupPhase enum in the runtime
+        private static readonly string[] PhaseNames =
+        {
+            "Config",
+            "ThreadManager",
+            "DiagnosticServer",
+            "DiagnosticsPause",
+            "EventTracing",
+            "Binder",
+            "GCInitialize",
+            "SystemDomain",
+            "Debugger",
+            "Profiler",
+            "JitHelpers",
+            "GCHeap",
+            "ThreadSetup",
+            "SystemAssemblies",
+        };
+
+        private const int DefaultIterations = 5;
+        private const int ConnectTimeoutMs = 10000;
+
+        private const byte ProcessCommandSet = 0x04;
+        private const byte GetStartupPhasesCommandId = 0x0A;
+        private const byte ServerCommandSet = 0xFF;
+        private const byte ServerResponseOK = 0x00;
+        private static readonly byte[] IpcMagic = Encoding.ASCII.GetBytes("DOTNET_IPC_V1\0");
+        private const int IpcHeaderSize = 20;
+
+        private static Stream ConnectToDiagnosticPort(int pid)
+        {
+            if (OperatingSystem.IsWindows())
+            {
+                var pipe = new NamedPipeClientStream(".", $"dotnet-diagnostic-{pid}", PipeDirection.InOut);
+                pipe.Connect(ConnectTimeoutMs);
+                return pipe;
+            }
+
+            // The socket is created before Main runs, so it exists once the app has written its output
+            string[] sockets = Directory.GetFiles(Path.GetTempPath(), $"dotnet-diagnostic-{pid}-*-socket");
+            if (sockets.Length != 1)
+            {
+                throw new Exception($"Expected one diagnostic socket for process {pid}, found {sockets.Length}");
+            }
+
+            var socket = new Socket(AddressFamily.Unix, SocketType.Stream, ProtocolType.Unspecified);
+            socket.Connect(new UnixDomainSocketEndPoint(sockets[0]));
+            return new NetworkStream(socket, ownsSocket: true);
+        }
+
+        private static ulong[] GetStartupPhases(int pid)
+        {
+            using Stream stream = ConnectToDiagnosticPort(pid);
+
+            byte[] request = new byte[IpcHeaderSize];
+            IpcMagic.CopyTo(request, 0);
+            BinaryPrimitives.WriteUInt16LittleEndian(request.AsSpan(14), IpcHeaderSize);
+            request[16] = ProcessCommandSet;
+            request[17] = GetStartupPhasesCommandId;
+            stream.Write(request);
+            stream.Flush();
+
+            byte[] header = new byte[IpcHeaderSize];
+            stream.ReadExactly(header);
+            if (header[16] != ServerCommandSet || header[17] != ServerResponseOK)
+            {
+                throw new Exception($"GetStartupPhases failed, response command 0x{header[16]:X2}/0x{header[17]:X2}");
+            }
+
+            byte[] payload = new byte[BinaryPrimitives.ReadUInt16LittleEndian(header.AsSpan(14)) - IpcHeaderSize];
+            stream.ReadExactly(payload);
+
+            uint phaseCount = BinaryPrimitives.ReadUInt32LittleEndian(payload.AsSpan(4));
+            ulong[] durations = new ulong[phaseCount];
+            for (int i = 0; i < phaseCount; i++)
+            {
+                durations[i] = BinaryPrimitives.ReadUInt64LittleEndian(payload.AsSpan(8 + i * 8));
+            }
+
+            return durations;
+        }
+
+        private static ulong[] RunHelloWorld()
+        {
+            Process process = new Process();
+            process.StartInfo.FileName = Path.Combine(Environment.GetEnvironmentVariable("CORE_ROOT"), "corerun");
+            process.StartInfo.Arguments = Path.Combine(Path.GetDirectoryName(Assembly.GetExecutingAssembly().Location), "helloworld.dll");
+            process.StartInfo.RedirectStandardInput = true;
+            process.StartInfo.RedirectStandardOutput = true;
+            process.Start();
+
+            try
+            {
+                string line = process.StandardOutput.ReadLine();
+                if (line != "Hello World!")
+                {
+                    throw new Exception($"Unexpected output from helloworld: \"{line}\"");
+                }
+
+                return GetStartupPhases(process.Id);
+            }
+            finally
+            {
+                process.StandardInput.WriteLine();
+                process.WaitForExit();
+            }
+        }
+
+        private static ulong Percentile(List<ulong> sorted, int percentile)
+        {
+            return sorted[(sorted.Count - 1) * percentile / 100];
+        }
+
+        [Fact]
+        public static void TestEntryPoint()
+        {
+            // Mono and NativeAOT do not implement the command
+            if (TestLibrary.Utilities.IsMonoRuntime || TestLibrary.Utilities.IsNativeAot)
+            {
+                return;
+            }
+
+            int iterations = DefaultIterations;
+            string iterationsSetting = Environment.GetEnvironmentVariable("STARTUP_PHASES_ITERATIONS");
+            if (!string.IsNullOrEmpty(iterationsSetting))
+            {
+                iterations = Math.Max(1, int.Parse(iterationsSetting));
+            }
+
+            var samples = new List<ulong>[PhaseNames.Length];
+            for (int phase = 0; phase < PhaseNames.Length; phase++)
+            {
+                samples[phase] = new List<ulong>(iterations);
+            }
+
+            for (int i = 0; i < iterations; i++)
+            {
+                ulong[] durations = RunHelloWorld();
+                if (durations.Length != PhaseNames.Length)
+                {
+                    throw new Exception($"Expected {PhaseNames.Length} startup phases, got {durations.Length}");
+                }
+
+                for (int phase = 0; phase < durations.Length; phase++)
+                {
+                    samples[phase].Add(durations[phase]);
+                }
+            }
+
+            Console.WriteLine($"Startup phase durations in microseconds over {iterations} runs");
+            Console.WriteLine($"{"Phase",-20}{"Min",10}{"Median",10}{"P90",10}{"Max",10}{"Mean",10}");
+            for (int phase = 0; phase < PhaseNames.Length; phase++)
+            {
+                List<ulong> sorted = samples[phase];
+                sorted.Sort();
+                Console.WriteLine($"{PhaseNames[phase],-20}{sorted[0],10}{Percentile(sorted, 50),10}{Percentile(sorted, 90),10}{sorted[sorted.Count - 1],10}{(ulong)sorted.Average(d => (double)d),10}");
+            }
+        }
+    }
+}